@@ -112,6 +112,43 @@ inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     /// \param[in] _label The label of the bounding box.
     public: void SetLabel(uint32_t _label);
 
+    /// \brief Get the number of image pixels where the object is visible.
+    /// \return Number of pixels of the object that are not occluded and
+    /// inside the image, 0 by default.
+    public: uint32_t VisiblePixelCount() const;
+
+    /// \brief Set the number of image pixels where the object is visible.
+    /// \param[in] _count Number of visible pixels of the object.
+    public: void SetVisiblePixelCount(uint32_t _count);
+
+    /// \brief Get the area the object would cover inside the image if
+    /// nothing occluded it.
+    /// \return Unoccluded projected area in pixels, 0 if unknown.
+    public: double ProjectedArea() const;
+
+    /// \brief Set the area the object would cover inside the image if
+    /// nothing occluded it.
+    /// \param[in] _area Unoccluded projected area in pixels.
+    public: void SetProjectedArea(double _area);
+
+    /// \brief Get the fraction of the projected object outside the image.
+    /// \return Truncation in [0, 1], 0 if unknown.
+    public: double Truncation() const;
+
+    /// \brief Set the fraction of the projected object outside the image.
+    /// \param[in] _truncation Truncation in [0, 1].
+    public: void SetTruncation(double _truncation);
+
+    /// \brief Get the fraction of the projected area inside the image that
+    /// other objects occlude.
+    /// \return Occlusion in [0, 1], 0 if unknown.
+    public: double Occlusion() const;
+
+    /// \brief Set the fraction of the projected area inside the image that
+    /// other objects occlude.
+    /// \param[in] _occlusion Occlusion in [0, 1].
+    public: void SetOcclusion(double _occlusion);
+
     /// \internal
     /// \brief Private data
     GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
@@ -18,6 +18,8 @@
 #define GZ_RENDERING_BOUNDINGBOXCAMERA_HH_
 
 #include <cstdint>
+#include <functional>
+#include <string>
 #include <vector>
 
 #include <gz/common/Event.hh>
@@ -26,6 +28,7 @@
 
 #include "gz/rendering/BoundingBox.hh"
 #include "gz/rendering/Camera.hh"
+#include "gz/rendering/SegmentationCamera.hh"
 
 namespace gz
 {
@@ -36,7 +39,8 @@ namespace gz
     /// \brief BoundingBox types for Visible / Full 2D Boxes / 3D Boxes
     enum class BoundingBoxType
     {
-      /// 2D box that shows the full box of occluded objects
+      /// 2D box that shows the full box of occluded objects. Also reports
+      /// the projected area, truncation and occlusion of the objects.
       BBT_FULLBOX2D = 0,
 
       /// 2D box that shows the visible part of the
@@ -84,6 +88,34 @@ namespace gz
       /// \param[in] _box bounding box to be drawn
       public: virtual void DrawBoundingBox(unsigned char *_data,
         const math::Color &_color, const BoundingBox &_box) const = 0;
+
+      /// \brief Connect to the segmentation image of new frames, derived
+      /// from the same id render the boxes come from, so rigs that need
+      /// both boxes and masks at the same pose do not need a
+      /// SegmentationCamera. The image has the layout of
+      /// SegmentationCamera::SegmentationData without colored map: in
+      /// ST_SEMANTIC mode the label is in all three channels, in
+      /// ST_PANOPTIC mode the first two channels are the instance count and
+      /// the last is the label. Instances are numbered per label from 1,
+      /// in the order their top level models appear in the image from the
+      /// top left. Background pixels have the background label in all
+      /// channels.
+      /// \param[in] _subscriber Subscriber callback function.
+      /// The callback function arguments are:
+      /// <segmentation data, width, height, channels, format>
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual gz::common::ConnectionPtr ConnectNewSegmentationFrame(
+          std::function<void(const uint8_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) = 0;
+
+      /// \brief Set the type of the segmentation image, see
+      /// ConnectNewSegmentationFrame. Defaults to ST_SEMANTIC.
+      /// \param[in] _type Segmentation type
+      public: virtual void SetSegmentationType(SegmentationType _type) = 0;
+
+      /// \brief Get the type of the segmentation image
+      /// \return Segmentation type
+      public: virtual SegmentationType SegmentationMapType() const = 0;
     };
   }
   }
@@ -17,12 +17,18 @@
 #ifndef GZ_RENDERING_CAMERA_HH_
 #define GZ_RENDERING_CAMERA_HH_
 
+#include <chrono>
+#include <cstddef>
+#include <future>
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 #include <gz/math/Matrix4.hh>
 
 #include "gz/rendering/config.hh"
+#include "gz/rendering/FrameInfo.hh"
+#include "gz/rendering/FrameView.hh"
 #include "gz/rendering/Image.hh"
 #include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/Sensor.hh"
@@ -51,6 +57,22 @@ namespace gz
       CPT_ORTHOGRAPHIC
     };
 
+    /// \brief Anti-aliasing methods of a camera, see
+    /// Camera::SetAntiAliasingMode
+    enum GZ_RENDERING_VISIBLE CameraAntiAliasingMode
+    {
+      /// \brief No anti-aliasing, the scene is rendered with a single
+      /// sample per pixel regardless of the anti-aliasing level
+      CAAM_NONE = 0,
+      /// \brief Multisample anti-aliasing with the number of samples set by
+      /// Camera::SetAntiAliasing
+      CAAM_MSAA = 1,
+      /// \brief Fast approximate anti-aliasing: the scene is rendered with a
+      /// single sample per pixel and edges are smoothed by a post-process
+      /// pass
+      CAAM_FXAA = 2
+    };
+
     /// \class Camera Camera.hh gz/rendering/Camera.hh
     /// \brief Posable camera used for rendering the scene graph
     class GZ_RENDERING_VISIBLE Camera :
@@ -60,6 +82,19 @@ namespace gz
       public: typedef std::function<void(const void*, unsigned int,
           unsigned int, unsigned int, const std::string&)> NewFrameListener;
 
+      /// \brief Callback function for new frame view event listeners
+      public: typedef std::function<void(const FrameView &)>
+          NewFrameViewListener;
+
+      /// \brief Callback function for frames that were skipped because they
+      /// would not differ from the last rendered frame
+      public: typedef std::function<void()> FrameUnchangedListener;
+
+      /// \brief Callback function for frames rendered by RenderViewpoints,
+      /// called with the index of the viewpoint and its image
+      public: typedef std::function<void(std::size_t, const Image &)>
+          ViewpointListener;
+
       /// \brief Destructor
       public: virtual ~Camera();
 
@@ -134,6 +169,21 @@ namespace gz
       /// \param[in] _aa Level of anti-aliasing used during rendering
       public: virtual void SetAntiAliasing(const unsigned int _aa) = 0;
 
+      /// \brief Set the anti-aliasing method. Multisampling costs memory
+      /// and fill rate proportionally to the number of samples, which adds
+      /// up on high resolution cameras; FXAA is a single full screen pass.
+      /// \remarks Cameras whose output must not be blended between
+      /// neighbouring pixels, e.g. depth and segmentation cameras, always
+      /// render a single sample and ignore the mode. In ogre2 wide-angle
+      /// cameras render FXAA like CAAM_NONE.
+      /// \param[in] _mode Anti-aliasing method, CAAM_MSAA by default
+      public: virtual void SetAntiAliasingMode(
+                  CameraAntiAliasingMode _mode) = 0;
+
+      /// \brief Get the anti-aliasing method
+      /// \return Anti-aliasing method
+      public: virtual CameraAntiAliasingMode AntiAliasingMode() const = 0;
+
       /// \brief Get the camera's far clipping plane distance
       /// \return Far clipping plane distance
       public: virtual double FarClipPlane() const = 0;
@@ -150,6 +200,19 @@ namespace gz
       /// \param[in] _near Near clipping plane distance
       public: virtual void SetNearClipPlane(const double _near) = 0;
 
+      /// \brief Get the level of detail bias of the camera
+      /// \return Level of detail bias
+      /// \sa SetLodBias
+      public: virtual double LodBias() const = 0;
+
+      /// \brief Set the level of detail bias of the camera. Meshes with
+      /// levels of detail, see MeshDescriptor::lodDistances, switch to
+      /// coarser levels sooner for values below 1 and later for values
+      /// above 1. Sensors that do not need full detail, e.g. depth cameras
+      /// or lidars, can use a lower bias than user cameras. The default is 1.
+      /// \param[in] _bias Level of detail bias, must be greater than 0
+      public: virtual void SetLodBias(double _bias) = 0;
+
       /// \brief Renders the current scene using this camera. This function
       /// assumes PreRender() has already been called on the parent Scene,
       /// allowing the camera and the scene itself to prepare for rendering.
@@ -167,6 +230,31 @@ namespace gz
       public: virtual VisualPtr VisualAt(const gz::math::Vector2i
                   &_mousePos) = 0;
 
+      /// \brief Get all visuals visible in a screen rectangle, e.g. for box
+      /// selection. All visuals are found with a single selection render.
+      /// \param[in] _min Top left corner of the rectangle in pixels
+      /// \param[in] _max Bottom right corner of the rectangle in pixels,
+      /// exclusive. The rectangle is clipped to the image.
+      /// \return Visuals in the rectangle, without duplicates
+      public: virtual std::vector<VisualPtr> VisualsInRegion(
+                  const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) = 0;
+
+      /// \brief Asynchronous version of VisualsInRegion. The selection
+      /// render is issued right away but the result is read back from the
+      /// GPU only when the returned future is accessed, which does not stall
+      /// once the GPU finished rendering, e.g. on the next frame. This is
+      /// suited for hover highlighting.
+      /// The future must be accessed from the rendering thread. The result
+      /// is empty if the camera was destroyed in the meantime.
+      /// \param[in] _min Top left corner of the rectangle in pixels
+      /// \param[in] _max Bottom right corner of the rectangle in pixels,
+      /// exclusive. The rectangle is clipped to the image.
+      /// \return Future holding the visuals in the rectangle
+      public: virtual std::future<std::vector<VisualPtr>>
+                  VisualsInRegionAsync(const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) = 0;
+
       /// \brief Renders a new frame.
       /// This is a convenience function for single-camera scenes. It wraps the
       /// pre-render, render, and post-render into a single
@@ -189,6 +277,39 @@ namespace gz
       /// \param[out] _image Output image buffer
       public: virtual void Capture(Image &_image) = 0;
 
+      /// \brief Asynchronous version of Capture. The frame is rendered and
+      /// its download from the GPU is started right away, but the data is
+      /// written to the image only when the returned future is accessed.
+      /// Rendering the next frame, or other cameras, overlaps the download
+      /// and accessing the future does not stall once the download
+      /// finished. Several captures may be in flight at once.
+      /// The image must stay alive and must not be resized until the future
+      /// is accessed, and the future must be accessed from the rendering
+      /// thread. Destroying the future without accessing it discards the
+      /// frame.
+      /// \param[out] _image Output image buffer
+      /// \return Future that is true once the frame was written to the
+      /// image, false if the camera was destroyed in the meantime
+      public: virtual std::future<bool> CaptureAsync(Image &_image) = 0;
+
+      /// \brief Render the scene from a sequence of camera poses, e.g. to
+      /// generate datasets. Several frames are kept in flight so that
+      /// moving the camera and rendering the next viewpoints overlaps the
+      /// download of the previous ones, see CaptureAsync. Between
+      /// viewpoints only objects that changed are pre-rendered, see
+      /// Scene::SetPreRenderDirtyTracking. The listener is called on the
+      /// calling thread, in order, once per viewpoint. The camera is moved
+      /// back to its pose afterwards.
+      /// \param[in] _poses World poses of the camera
+      /// \param[in] _listener Called with the index of each viewpoint and
+      /// its image, which is only valid for the duration of the call
+      /// \param[in] _framesInFlight Maximum number of frames rendered but
+      /// not delivered yet
+      public: virtual void RenderViewpoints(
+                  const std::vector<math::Pose3d> &_poses,
+                  ViewpointListener _listener,
+                  unsigned int _framesInFlight = 3u) = 0;
+
       /// \brief Writes the last rendered image to the given image buffer. This
       /// function can be called multiple times after PostRender has been
       /// called, without rendering the scene again. Calling this function
@@ -196,18 +317,189 @@ namespace gz
       /// \param[out] _image Output image buffer
       public: virtual void Copy(Image &_image) const = 0;
 
+      /// \brief Restrict Copy and CaptureAsync to a rectangular region of
+      /// the rendered image so that only that region is downloaded from
+      /// the GPU. CreateImage then returns images of the region's size.
+      /// Frame listeners still receive the full image. A zero size clears
+      /// the region. Regions that do not fit in the image are rejected.
+      /// \param[in] _offset Top left pixel of the region
+      /// \param[in] _size Width and height of the region in pixels
+      public: virtual void SetReadbackRegion(const math::Vector2i &_offset,
+                  const math::Vector2i &_size) = 0;
+
+      /// \brief Get the top left pixel of the readback region
+      /// \return Offset of the region, zero if no region is set
+      /// \sa SetReadbackRegion
+      public: virtual math::Vector2i ReadbackRegionOffset() const = 0;
+
+      /// \brief Get the size of the readback region
+      /// \return Size of the region, zero if the full image is read back
+      /// \sa SetReadbackRegion
+      public: virtual math::Vector2i ReadbackRegionSize() const = 0;
+
+      /// \brief Add an extra output of a different resolution, e.g. a small
+      /// image for inference next to the full image for storage. Outputs
+      /// are resized from the rendered image, on the GPU by render engines
+      /// that support it, so the scene is rendered once and only the
+      /// resized image is downloaded. Each output has its own frame
+      /// listeners, see ConnectNewImageOutputFrame.
+      /// \param[in] _width Output width in pixels
+      /// \param[in] _height Output height in pixels
+      /// \return Index of the new output, see ImageOutputCount
+      public: virtual unsigned int AddImageOutput(unsigned int _width,
+                  unsigned int _height) = 0;
+
+      /// \brief Get the number of extra outputs
+      /// \return Number of outputs added with AddImageOutput
+      public: virtual unsigned int ImageOutputCount() const = 0;
+
+      /// \brief Get the size of an extra output
+      /// \param[in] _index Index of the output
+      /// \return Width and height of the output in pixels, zero if there is
+      /// no such output
+      public: virtual math::Vector2i ImageOutputSize(unsigned int _index)
+                  const = 0;
+
+      /// \brief Remove all extra outputs and disconnect their listeners
+      public: virtual void RemoveImageOutputs() = 0;
+
+      /// \brief Writes the last rendered image, resized to an extra output,
+      /// to the given image buffer. The image must have the size of the
+      /// output, its format may differ from the camera's.
+      /// \param[in] _index Index of the output
+      /// \param[out] _image Output image buffer
+      public: virtual void CopyImageOutput(unsigned int _index,
+                  Image &_image) const = 0;
+
+      /// \brief Subscribes a listener to new frames of an extra output.
+      /// Listeners are notified after PostRender with the frame in the
+      /// camera's image format.
+      /// \param[in] _index Index of the output
+      /// \param[in] _listener New frame listener callback
+      /// \return Pointer to the new Connection, null if there is no such
+      /// output. This must be kept in scope
+      public: virtual common::ConnectionPtr ConnectNewImageOutputFrame(
+                  unsigned int _index, NewFrameListener _listener) = 0;
+
+      /// \brief Enable dynamic resolution. The scene is rendered at a
+      /// fraction of the image resolution that is adjusted from the
+      /// measured frame time toward the target, and is upscaled to the
+      /// image resolution before post-processing. This is meant for GUI
+      /// cameras on shared GPUs; sensor cameras do not support it.
+      /// \param[in] _targetFrameTime Frame time to aim for, zero disables
+      /// dynamic resolution
+      /// \param[in] _minScale Smallest fraction of the image width and
+      /// height the scene is rendered at, in (0, 1]
+      public: virtual void SetDynamicResolution(
+                  std::chrono::steady_clock::duration _targetFrameTime,
+                  double _minScale = 0.5) = 0;
+
+      /// \brief Get the frame time dynamic resolution aims for
+      /// \return Target frame time, zero if dynamic resolution is disabled
+      /// \sa SetDynamicResolution
+      public: virtual std::chrono::steady_clock::duration
+                  DynamicResolutionTarget() const = 0;
+
+      /// \brief Get the fraction of the image resolution the scene is
+      /// currently rendered at
+      /// \return Resolution scale, 1 if dynamic resolution is disabled
+      /// \sa SetDynamicResolution
+      public: virtual double DynamicResolutionScale() const = 0;
+
+      /// \brief Hold back image size changes until the size stopped
+      /// changing for a while, e.g. while a window edge is dragged. In the
+      /// meantime frames are rendered at the previous size, which is
+      /// enough for display stretched to the new size, but Capture and Copy
+      /// fail. This is meant for GUI cameras; sensor cameras do not support
+      /// it.
+      /// \param[in] _delay Time the size must stay unchanged before the
+      /// render target is rebuilt, zero rebuilds it on the next render
+      public: virtual void SetResizeDelay(
+                  std::chrono::steady_clock::duration _delay) = 0;
+
+      /// \brief Get how long image size changes are held back
+      /// \return Resize delay, zero by default
+      /// \sa SetResizeDelay
+      public: virtual std::chrono::steady_clock::duration
+                  ResizeDelay() const = 0;
+
       /// \brief Writes the previously rendered frame to a file. This function
       /// can be called multiple times after PostRender has been called,
       /// without rendering the scene again. Calling this function before a
       /// single image has been rendered will have undefined behavior.
+      /// The frame is written as PNG on the calling thread, see
+      /// FrameEncoder to encode frames in the background.
       /// \param[in] _name Name of the output file
+      /// \return True if the file was written
       public: virtual bool SaveFrame(const std::string &_name) = 0;
 
-      /// \brief Subscribes a new listener to this camera's new frame event
+      /// \brief Subscribes a new listener to this camera's new frame event.
+      /// Listeners are notified after PostRender with the full image.
       /// \param[in] _listener New camera listener callback
       public: virtual common::ConnectionPtr ConnectNewImageFrame(
                   NewFrameListener _listener) = 0;
 
+      /// \brief Subscribes a listener to a read-only view of each new frame
+      /// of sensor output data. The view points directly into the memory the
+      /// frame was downloaded to, which avoids copying the data into the
+      /// sensor's own output buffers. It is only valid for the duration of
+      /// the callback; listeners that need the data afterwards must copy it.
+      /// When a sensor only has frame view listeners, the copy into its
+      /// own output buffers (e.g. DepthCamera::DepthData) is skipped.
+      /// Not all sensors and render engines support frame views; a null
+      /// connection is returned otherwise.
+      /// \param[in] _listener New frame view listener callback
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  NewFrameViewListener _listener) = 0;
+
+      /// \brief Get the metadata of the frame last passed to the new frame
+      /// events of the camera, e.g. of the new image, depth, gpu rays or
+      /// segmentation frame events. Listeners can call it to find out when
+      /// and from where the frame they receive was rendered, which differs
+      /// from the current state with asynchronous readback. Frame views
+      /// carry the same metadata in FrameView::info. Render engines that do
+      /// not record frame metadata leave the sequence number at 0.
+      /// \return Metadata of the latest delivered frame
+      public: virtual FrameInfo LastFrameInfo() const = 0;
+
+      /// \brief Skip rendering frames that would not differ from the last
+      /// rendered frame, e.g. of fixed cameras looking at a static part of
+      /// the scene. A frame is skipped if the camera did not move or change
+      /// its projection or image size and no change recorded by
+      /// Scene::ChangeTracker intersects its view frustum. Skipped frames
+      /// are not read back, the frame unchanged listeners are notified
+      /// instead and Copy returns the last rendered frame. Changes of
+      /// objects outside of the frustum, e.g. through shadows or
+      /// reflections, and changes that are not recorded by the change
+      /// tracker, are not detected. Enabling it enables the change tracker
+      /// of the scene. Disabled by default.
+      /// \param[in] _skip True to skip unchanged frames
+      /// \sa ConnectFrameUnchanged
+      public: virtual void SetSkipUnchangedFrames(bool _skip) = 0;
+
+      /// \brief Get whether unchanged frames are skipped
+      /// \return True if unchanged frames are skipped
+      /// \sa SetSkipUnchangedFrames
+      public: virtual bool SkipUnchangedFrames() const = 0;
+
+      /// \brief Check whether the next frame can be skipped because it would
+      /// not differ from the last rendered frame, and notify the frame
+      /// unchanged listeners if so. Update and Scene::RenderSensors call it
+      /// after Scene::PreRender, before rendering the camera.
+      /// \return True if the frame must not be rendered, always false if
+      /// unchanged frames are not skipped
+      /// \sa SetSkipUnchangedFrames
+      public: virtual bool CheckFrameUnchanged() = 0;
+
+      /// \brief Subscribes a listener to frames that were skipped because
+      /// they would not differ from the last rendered frame
+      /// \param[in] _listener Frame unchanged listener callback
+      /// \return Pointer to the new Connection. This must be kept in scope
+      /// \sa SetSkipUnchangedFrames
+      public: virtual common::ConnectionPtr ConnectFrameUnchanged(
+                  FrameUnchangedListener _listener) = 0;
+
       /// \brief Create a render window.
       /// \return A pointer to the render window.
       public: virtual RenderWindowPtr CreateRenderWindow() = 0;
@@ -246,6 +538,17 @@ namespace gz
       public: virtual math::Vector2i Project(const math::Vector3d &_pt) const
            = 0;
 
+      /// \brief Project many points in 3d world space to 2d screen space,
+      /// e.g. the vertices of a mesh to label it. The view and projection
+      /// matrices are computed once for all points, which is much faster
+      /// than calling Project for every point.
+      /// \param[in] _pts Points in 3d world space
+      /// \param[out] _screenPts Points in 2d screen space, in pixels with
+      /// subpixel precision. Must hold _count points.
+      /// \param[in] _count Number of points
+      public: virtual void ProjectPoints(const math::Vector3d *_pts,
+           math::Vector2d *_screenPts, size_t _count) const = 0;
+
       /// \brief Set a node for camera to track. The camera will automatically
       /// change its orientation to face the target being tracked. If null is
       /// specified, tracking is disabled. In contrast to SetFollowTarget
@@ -343,6 +646,14 @@ namespace gz
       /// \param[out] _textureIdPtr the address of a void* pointer.
       public: virtual void RenderTextureMetalId(void *_textureIdPtr) const = 0;
 
+      /// \brief Get a pointer to the contents of the render texture used by
+      /// this camera in CUDA device memory, so that CUDA based consumers,
+      /// e.g. inference engines, can read the frames without a copy to host
+      /// memory. A valid pointer is returned only if the underlying render
+      /// engine renders with CUDA. See RenderTexture::CudaDevicePointer.
+      /// \return Device pointer, null if not supported
+      public: virtual void *RenderTextureCudaPointer() const = 0;
+
       /// \brief Right now this is Vulkan-only. This function needs to be
       /// called after rendering, and before handling the texture pointer
       /// (i.e. by calling RenderTextureMetalId()) so that external APIs
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_CAMERAARRAY_HH_
+#define GZ_RENDERING_CAMERAARRAY_HH_
+
+#include <gz/math/Pose3.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/RenderTypes.hh"
+#include "gz/rendering/Sensor.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class CameraArray CameraArray.hh gz/rendering/CameraArray.hh
+    /// \brief A rig of cameras that are rendered together, e.g. a stereo
+    /// pair or a surround view array. Each view is a regular camera that
+    /// is a child of the array, so moving the array moves the whole rig
+    /// and every view keeps its own image size, clip planes and listeners.
+    ///
+    /// Update renders all views like Scene::RenderSensors does, after one
+    /// shared cull pass: top level visuals whose world bounding box is
+    /// outside of the frustum of every view are hidden for the duration of
+    /// the render, so that the render engine does not cull or generate
+    /// draw commands for them once per view. Culling is skipped for
+    /// visuals that may cast a shadow into a view, for visuals that hold
+    /// lights, projectors or particle emitters and for rigs with a view
+    /// whose frustum is not known, e.g. orthographic views.
+    class GZ_RENDERING_VISIBLE CameraArray :
+      public virtual Sensor
+    {
+      /// \brief Destructor
+      public: virtual ~CameraArray();
+
+      /// \brief Add a view to the array. The view is a new camera of the
+      /// scene with the default image size and field of view.
+      /// \param[in] _pose Pose of the view relative to the array
+      /// \return The camera of the new view
+      public: virtual CameraPtr AddView(const math::Pose3d &_pose) = 0;
+
+      /// \brief Get the number of views
+      /// \return Number of views
+      public: virtual unsigned int ViewCount() const = 0;
+
+      /// \brief Get the camera of a view
+      /// \param[in] _index Index of the view
+      /// \return Camera of the view, null if the index is out of range
+      public: virtual CameraPtr ViewByIndex(unsigned int _index) const = 0;
+
+      /// \brief Enable or disable the shared cull pass. Enabled by default.
+      /// \param[in] _enabled True to hide visuals outside of every view
+      /// while rendering
+      public: virtual void SetSharedCulling(bool _enabled) = 0;
+
+      /// \brief Get whether the shared cull pass is enabled
+      /// \return True if the shared cull pass is enabled
+      public: virtual bool SharedCulling() const = 0;
+
+      /// \brief Render all views. The visibility of culled visuals is
+      /// restored before this function returns.
+      /// \remark Must not be called between Scene::PreRender and
+      /// Scene::PostRender
+      public: virtual void Update() = 0;
+
+      /// \brief Get the number of visuals hidden by the cull pass of the
+      /// last Update
+      /// \return Number of culled visuals
+      public: virtual unsigned int CulledVisualCount() const = 0;
+
+      /// \brief Get whether a visual was hidden by the cull pass of the
+      /// last Update
+      /// \param[in] _visual Visual to check
+      /// \return True if the visual was outside of every view
+      public: virtual bool IsCulled(ConstVisualPtr _visual) const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,10 @@
 #ifndef GZ_RENDERING_DEPTHCAMERA_HH_
 #define GZ_RENDERING_DEPTHCAMERA_HH_
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 
 #include <gz/common/Event.hh>
@@ -27,10 +31,60 @@ namespace gz
   namespace rendering
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \enum DepthCameraOutputFormat DepthCamera.hh
+    /// gz/rendering/DepthCamera.hh
+    /// \brief Layout of the depth image produced by a DepthCamera
+    enum GZ_RENDERING_VISIBLE DepthCameraOutputFormat
+    {
+      /// \brief One float32 channel per pixel containing the depth in
+      /// metres. This is the default.
+      DCOF_DEPTH_FLOAT32 = 0,
+      /// \brief One float16 channel per pixel containing the depth in
+      /// metres
+      DCOF_DEPTH_FLOAT16 = 1,
+      /// \brief One uint16 channel per pixel containing the depth in
+      /// millimetres, like the raw output of most structured light and time
+      /// of flight sensors. Depths beyond 65.535 m saturate and pixels
+      /// without a valid depth are 0.
+      DCOF_DEPTH_UINT16_MM = 2
+    };
+
+    /// \brief A point of a packed point cloud: position in the camera frame
+    /// followed by its 8 bit color, 16 bytes per point.
+    struct PackedPoint
+    {
+      /// \brief X coordinate
+      float x;
+
+      /// \brief Y coordinate
+      float y;
+
+      /// \brief Z coordinate
+      float z;
+
+      /// \brief Red channel
+      uint8_t r;
+
+      /// \brief Green channel
+      uint8_t g;
+
+      /// \brief Blue channel
+      uint8_t b;
+
+      /// \brief Alpha channel
+      uint8_t a;
+    };
+
     /// \class Camera Camera.hh gz/rendering/Camera.hh
     /// \brief Poseable depth camera used for rendering the scene graph.
     /// This camera is designed to produced depth data, instead of a 2D
     /// image.
+    ///
+    /// The colour of the points returned by ConnectNewRgbPointCloud and
+    /// ConnectNewPackedPointCloud, and the images returned by
+    /// ConnectNewRgbFrame, come from the same scene render as the depth
+    /// data, so a co-located RGB-D sensor does not need a separate Camera.
     class GZ_RENDERING_VISIBLE DepthCamera :
       public virtual Camera
     {
@@ -48,6 +102,14 @@ namespace gz
       /// \return The z-buffer as a float array
       public: virtual const float *DepthData() const = 0;
 
+      /// \brief Get a lease of the latest depth data, so that it can be
+      /// processed on another thread while the next frames are written
+      /// into other buffers, see GpuRays::AcquireData
+      /// \return Lease of the data DepthData() points to, null if there is
+      /// none
+      public: virtual std::shared_ptr<const float> AcquireDepthData() const
+          = 0;
+
       /// \brief Connect to the new depth image signal
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
@@ -75,6 +137,100 @@ namespace gz
           std::function<void(const float *_pointCloud, unsigned int _width,
           unsigned int _height, unsigned int _depth,
           const std::string &_format)> _subscriber) = 0;
+
+      /// \brief Callback function for new packed point cloud listeners.
+      /// The arguments of the callback function are:
+      ///   _points Packed points
+      ///   _count Number of points in _points
+      ///   _width Point cloud width, _count if invalid points are filtered
+      ///   _height Point cloud height, 1 if invalid points are filtered
+      public: typedef std::function<void(const PackedPoint *_points,
+          unsigned int _count, unsigned int _width, unsigned int _height)>
+          NewPackedPointCloudListener;
+
+      /// \brief Connect to the new packed point cloud signal. Unlike the
+      /// rgb point cloud, color is stored as separate 8 bit channels and,
+      /// if SetPackedPointCloudFilterInvalid is enabled, points that are
+      /// not finite (e.g. outside the clip range) are dropped.
+      /// \param[in] _listener Listener callback function
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual common::ConnectionPtr ConnectNewPackedPointCloud(
+          NewPackedPointCloudListener _listener) = 0;
+
+      /// \brief Set whether invalid points are removed from the packed point
+      /// cloud. When enabled the cloud is unorganized: it holds only the
+      /// valid points, in row major order. When disabled (default) the cloud
+      /// is organized and invalid points keep non finite coordinates.
+      /// \param[in] _filter True to remove invalid points
+      public: virtual void SetPackedPointCloudFilterInvalid(bool _filter) = 0;
+
+      /// \brief Get whether invalid points are removed from the packed point
+      /// cloud.
+      /// \return True if invalid points are removed
+      /// \sa SetPackedPointCloudFilterInvalid
+      public: virtual bool PackedPointCloudFilterInvalid() const = 0;
+
+      /// \brief Connect to the new rgb image signal. The images are the
+      /// colour of the scene render the depth data was computed from, in
+      /// RgbFrameFormat(), and are delivered with the depth data, see
+      /// SetReadbackBufferCount.
+      /// \param[in] _listener Listener callback function, called with the
+      /// same arguments as the listeners of Camera::ConnectNewImageFrame
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual common::ConnectionPtr ConnectNewRgbFrame(
+          Camera::NewFrameListener _listener) = 0;
+
+      /// \brief Set the pixel format of the images passed to the new rgb
+      /// image listeners: PF_R8G8B8 (default), PF_B8G8R8 or PF_R8G8B8A8.
+      /// \param[in] _format Pixel format
+      /// \sa ConnectNewRgbFrame
+      public: virtual void SetRgbFrameFormat(PixelFormat _format) = 0;
+
+      /// \brief Get the pixel format of the rgb images
+      /// \return Pixel format
+      /// \sa SetRgbFrameFormat
+      public: virtual PixelFormat RgbFrameFormat() const = 0;
+
+      /// \brief Set the number of buffers used to read back depth data from
+      /// the GPU. A value greater than 1 enables asynchronous readback:
+      /// the depth texture is downloaded into a ring of _count buffers
+      /// without stalling the CPU, and the new depth frame and rgb point
+      /// cloud events are emitted _count - 1 frames after the frame was
+      /// rendered. Use DepthDataTime() to get the scene time of the frame
+      /// being delivered. A value of 0 or 1 (default) reads back depth data
+      /// synchronously in PostRender. Render engines that do not support
+      /// asynchronous readback ignore this setting.
+      /// \param[in] _count Number of readback buffers
+      public: virtual void SetReadbackBufferCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of buffers used to read back depth data.
+      /// \return Number of readback buffers
+      /// \sa SetReadbackBufferCount
+      public: virtual unsigned int ReadbackBufferCount() const = 0;
+
+      /// \brief Get the scene time at which the depth data returned by
+      /// DepthData() and passed to the new depth frame and rgb point cloud
+      /// events was rendered. With asynchronous readback this lags
+      /// Scene::Time() by ReadbackBufferCount() - 1 frames.
+      /// \return Scene time of the latest delivered depth frame
+      public: virtual std::chrono::steady_clock::duration DepthDataTime()
+          const = 0;
+
+      /// \brief Set the layout of the depth image produced by the camera.
+      /// The float16 and uint16 formats are converted on the GPU and
+      /// delivered through ConnectNewFrameView() only, as PF_FLOAT16_R and
+      /// PF_L16 views. With these formats the float32 point cloud texture is
+      /// only read back while ConnectNewDepthFrame(),
+      /// ConnectNewRgbPointCloud() or ConnectNewPackedPointCloud() have
+      /// listeners, and DepthData() is only updated then.
+      /// \param[in] _format Output format
+      public: virtual void SetOutputFormat(DepthCameraOutputFormat _format)
+          = 0;
+
+      /// \brief Get the layout of the depth image produced by the camera.
+      /// \return Output format
+      /// \sa SetOutputFormat
+      public: virtual DepthCameraOutputFormat OutputFormat() const = 0;
     };
   }
   }
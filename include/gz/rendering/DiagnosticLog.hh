@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_DIAGNOSTICLOG_HH_
+#define GZ_RENDERING_DIAGNOSTICLOG_HH_
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderStats.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class DiagnosticLogPrivate;
+
+    /// \class DiagnosticLog DiagnosticLog.hh gz/rendering/DiagnosticLog.hh
+    /// \brief Rate limiter for diagnostics raised on rendering hot paths,
+    /// e.g. once per item and frame. Each diagnostic is identified by a
+    /// key; the caller asks whether to log it and writes the message
+    /// itself, so suppressed messages cost a map lookup instead of console
+    /// I/O:
+    ///
+    ///     if (scene->Diagnostics().Raise("LidarVisual/noData"))
+    ///       gzwarn << "New lidar data not received" << std::endl;
+    ///
+    /// Every scene owns one, see Scene::Diagnostics. The counters of each
+    /// key are reported by Scene::Stats. Thread safe.
+    class GZ_RENDERING_VISIBLE DiagnosticLog
+    {
+      /// \brief Constructor
+      public: DiagnosticLog();
+
+      /// \brief Destructor
+      public: ~DiagnosticLog();
+
+      /// \brief Count a diagnostic and check whether it should be logged.
+      /// A key is logged the first time it is raised and then at most once
+      /// per interval, see SetInterval.
+      /// \param[in] _key Key of the diagnostic
+      /// \return True if the caller should log the message
+      public: bool Raise(const std::string &_key);
+
+      /// \brief Count a diagnostic and check whether it should be logged.
+      /// A key is only logged the first time it is raised, or the first
+      /// time since Clear was called.
+      /// \param[in] _key Key of the diagnostic
+      /// \return True if the caller should log the message
+      public: bool RaiseOnce(const std::string &_key);
+
+      /// \brief Set the minimum time between two logs of the same key by
+      /// Raise
+      /// \param[in] _interval Minimum time, 10 seconds by default
+      public: void SetInterval(std::chrono::steady_clock::duration _interval);
+
+      /// \brief Get the minimum time between two logs of the same key
+      /// \return Minimum time
+      public: std::chrono::steady_clock::duration Interval() const;
+
+      /// \brief Get the counters of every key raised since the last reset
+      /// \return Counters indexed by key
+      public: std::map<std::string, DiagnosticStats> Counts() const;
+
+      /// \brief Reset the counters of all keys. Keys that were logged
+      /// stay rate limited, so RaiseOnce does not log them again.
+      public: void Reset();
+
+      /// \brief Forget all keys and their counters. Keys raised after
+      /// Clear are logged again.
+      public: void Clear();
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<DiagnosticLogPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
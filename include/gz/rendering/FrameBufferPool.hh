@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_FRAMEBUFFERPOOL_HH_
+#define GZ_RENDERING_FRAMEBUFFERPOOL_HH_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class FrameBufferPoolPrivate;
+
+    /// \class FrameBufferPool FrameBufferPool.hh
+    /// gz/rendering/FrameBufferPool.hh
+    /// \brief Pool of CPU buffers that sensors download their frames into.
+    /// Buffers are grouped in power of two size buckets and returned to the
+    /// pool when the last lease is released, so cameras of different
+    /// resolutions share memory instead of each allocating their own.
+    /// Every render engine owns one, see RenderEngine::BufferPool.
+    ///
+    /// A lease is a shared pointer: listeners that want to hold on to a
+    /// frame keep a copy of the lease instead of copying the data. Leases
+    /// stay valid after the pool is destroyed. Thread safe.
+    ///
+    /// The buffers are pageable memory by default. SetAllocator lets them
+    /// come from pinned or otherwise registered host memory instead, e.g.
+    /// cudaHostAlloc, so that frames can be sent on to a device with
+    /// asynchronous copies without going through a bounce buffer.
+    class GZ_RENDERING_VISIBLE FrameBufferPool
+    {
+      /// \brief Alignment of every buffer in bytes
+      public: static constexpr std::size_t kAlignment = 64u;
+
+      /// \brief Function that allocates a buffer of the given size in
+      /// bytes, aligned to kAlignment bytes. Returns null on failure.
+      public: using AllocateFunction = std::function<void *(std::size_t)>;
+
+      /// \brief Function that frees a buffer returned by the matching
+      /// AllocateFunction, given its size in bytes
+      public: using FreeFunction = std::function<void(void *, std::size_t)>;
+
+      /// \brief Constructor
+      public: FrameBufferPool();
+
+      /// \brief Destructor. Frees the buffers that are not leased.
+      public: ~FrameBufferPool();
+
+      /// \brief Lease a buffer. Its content is undefined.
+      /// \param[in] _size Minimum size of the buffer in bytes
+      /// \return Buffer aligned to kAlignment bytes that returns to the pool
+      /// when the last copy of the lease is released, null if _size is 0
+      public: std::shared_ptr<unsigned char> Acquire(std::size_t _size);
+
+      /// \brief Make sure a lease can be written with new data of the given
+      /// size. The lease is replaced with a new one if it is empty, too
+      /// small, or also held by someone else, e.g. a listener that kept the
+      /// previous frame.
+      /// \param[in,out] _lease Lease to reuse or replace
+      /// \param[in] _size Minimum size of the buffer in bytes
+      /// \return Buffer of the lease
+      public: unsigned char *Reserve(std::shared_ptr<unsigned char> &_lease,
+                  std::size_t _size);
+
+      /// \brief Get the usable size of a leased buffer
+      /// \param[in] _lease Lease acquired from any pool
+      /// \return Size of the buffer in bytes, 0 if the buffer does not come
+      /// from a pool
+      public: static std::size_t Capacity(
+                  const std::shared_ptr<unsigned char> &_lease);
+
+      /// \brief Get the number of buffers waiting in the pool to be leased
+      /// \return Number of free buffers
+      public: std::size_t FreeBufferCount() const;
+
+      /// \brief Get the total size of the buffers waiting in the pool
+      /// \return Size of the free buffers in bytes
+      public: std::size_t FreeBytes() const;
+
+      /// \brief Set the maximum total size of the free buffers kept by the
+      /// pool. Released buffers that do not fit are freed.
+      /// \param[in] _bytes Maximum size in bytes
+      public: void SetMaxFreeBytes(std::size_t _bytes);
+
+      /// \brief Get the maximum total size of the free buffers kept by the
+      /// pool
+      /// \return Maximum size in bytes, 256 MiB by default
+      public: std::size_t MaxFreeBytes() const;
+
+      /// \brief Free all buffers that are not leased
+      public: void Clear();
+
+      /// \brief Set the functions new buffers are allocated and freed
+      /// with. The free buffers are freed; leased buffers are freed with the
+      /// functions they were allocated with once they are released. If the
+      /// allocation fails, the buffer is allocated from pageable memory.
+      /// \param[in] _allocate Allocation function, null for the default
+      /// pageable allocation
+      /// \param[in] _free Function freeing the buffers of _allocate
+      public: void SetAllocator(AllocateFunction _allocate,
+                  FreeFunction _free);
+
+      /// \brief Check if the buffers are allocated with custom functions
+      /// \return True if SetAllocator was given an allocation function
+      public: bool HasCustomAllocator() const;
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::shared_ptr<FrameBufferPoolPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
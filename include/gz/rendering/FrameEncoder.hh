@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_FRAMEENCODER_HH_
+#define GZ_RENDERING_FRAMEENCODER_HH_
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gz/common/Event.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/Image.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class FrameEncoderPrivate;
+
+    /// \class FrameEncoder FrameEncoder.hh
+    /// gz/rendering/FrameEncoder.hh
+    /// \brief Compresses camera frames on a pool of worker threads, so that
+    /// recording does not stall rendering. Frames are copied when they are
+    /// queued, so the caller may reuse its image right away.
+    ///
+    /// Frames are encoded as PNG by default. SetEncodeFunction replaces the
+    /// encoder, e.g. with a hardware JPEG or video encoder, which is then
+    /// called on the worker threads. Thread safe.
+    class GZ_RENDERING_VISIBLE FrameEncoder
+    {
+      /// \brief Function that compresses an image. Returns false if the
+      /// image can not be encoded.
+      public: using EncodeFunction = std::function<bool(const Image &,
+                  std::vector<unsigned char> &)>;
+
+      /// \brief Constructor
+      /// \param[in] _threadCount Number of worker threads, 0 for the number
+      /// of logical cores
+      public: explicit FrameEncoder(unsigned int _threadCount = 0u);
+
+      /// \brief Destructor. Waits for the queued frames.
+      public: ~FrameEncoder();
+
+      /// \brief Get the number of worker threads
+      /// \return Number of worker threads, at least 1
+      public: unsigned int ThreadCount() const;
+
+      /// \brief Set the function frames are encoded with
+      /// \param[in] _encode Encode function, null for PNG
+      public: void SetEncodeFunction(EncodeFunction _encode);
+
+      /// \brief Queue a frame to be encoded
+      /// \param[in] _image Frame to encode
+      /// \return Future of the encoded frame, empty if encoding failed
+      public: std::future<std::vector<unsigned char>> Encode(
+                  const Image &_image);
+
+      /// \brief Queue a frame to be encoded and written to a file
+      /// \param[in] _image Frame to encode
+      /// \param[in] _filename Path of the file to write
+      /// \return Future that is true once the file was written
+      public: std::future<bool> Save(const Image &_image,
+                  const std::string &_filename);
+
+      /// \brief Save every new frame of a camera to a directory, as
+      /// <camera name>_<frame number>.png. The camera must emit new frame
+      /// events, see Camera::ConnectNewImageFrame. The encoder must outlive
+      /// the returned connection.
+      /// \param[in] _camera Camera to record
+      /// \param[in] _directory Directory to write the frames to, it must
+      /// exist
+      /// \return Connection that stops recording when it is destroyed
+      public: common::ConnectionPtr Record(const CameraPtr &_camera,
+                  const std::string &_directory);
+
+      /// \brief Get the number of frames queued or being encoded
+      /// \return Number of pending frames
+      public: std::size_t PendingCount() const;
+
+      /// \brief Wait until all queued frames are encoded
+      public: void Wait();
+
+      /// \brief Encode an image as PNG on the calling thread
+      /// \param[in] _image Image to encode. 8 bit grayscale, RGB, BGR and
+      /// RGBA and 16 bit grayscale images are supported.
+      /// \param[out] _data Encoded image
+      /// \return True if the image was encoded
+      public: static bool EncodePng(const Image &_image,
+                  std::vector<unsigned char> &_data);
+
+      /// \brief Encode an image as PNG and write it to a file on the
+      /// calling thread
+      /// \param[in] _image Image to encode, see EncodePng
+      /// \param[in] _filename Path of the file to write
+      /// \return True if the file was written
+      public: static bool SavePng(const Image &_image,
+                  const std::string &_filename);
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<FrameEncoderPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
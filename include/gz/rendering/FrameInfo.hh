@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_FRAMEINFO_HH_
+#define GZ_RENDERING_FRAMEINFO_HH_
+
+#include <chrono>
+#include <cstdint>
+
+#include <gz/math/Pose3.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class FrameInfo FrameInfo.hh gz/rendering/FrameInfo.hh
+    /// \brief Metadata of a frame delivered by a camera or sensor, see
+    /// Camera::LastFrameInfo. With asynchronous readback, frames are
+    /// delivered a few updates after they were rendered, and this tells
+    /// when and from where that was. The difference between readbackTime
+    /// and submitTime bounds the latency of the frame on the GPU.
+    class GZ_RENDERING_VISIBLE FrameInfo
+    {
+      /// \brief Number of the frame, counting the frames rendered by the
+      /// camera from 1. Gaps mean frames were dropped, e.g. because the
+      /// readback ring was recreated. 0 if no frame was rendered.
+      public: uint64_t sequence = 0u;
+
+      /// \brief Scene time the frame was rendered at, see Scene::Time
+      public: std::chrono::steady_clock::duration time{0};
+
+      /// \brief World pose of the camera the frame was rendered from
+      public: math::Pose3d pose;
+
+      /// \brief Wall clock time at which the render commands of the frame
+      /// were submitted
+      public: std::chrono::steady_clock::time_point submitTime;
+
+      /// \brief Wall clock time at which the data of the frame was
+      /// available on the CPU, right before it was passed to the new frame
+      /// events
+      public: std::chrono::steady_clock::time_point readbackTime;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_FRAMEVIEW_HH_
+#define GZ_RENDERING_FRAMEVIEW_HH_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/FrameInfo.hh"
+#include "gz/rendering/PixelFormat.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class FrameView FrameView.hh gz/rendering/FrameView.hh
+    /// \brief A read-only, strided view into sensor output data as it was
+    /// downloaded from the GPU. The view does not own the memory it points
+    /// to and is only valid for the duration of the callback it is passed
+    /// to. Rows may be padded, so always use RowPitch() or Row() to step
+    /// between rows.
+    class GZ_RENDERING_VISIBLE FrameView
+    {
+      /// \brief Pointer to the first pixel of the frame
+      public: const void *data = nullptr;
+
+      /// \brief Frame width in pixels
+      public: unsigned int width = 0u;
+
+      /// \brief Frame height in pixels
+      public: unsigned int height = 0u;
+
+      /// \brief Number of bytes between the start of two consecutive rows
+      public: size_t rowPitch = 0u;
+
+      /// \brief Pixel format of the data
+      public: PixelFormat format = PF_UNKNOWN;
+
+      /// \brief Metadata of the frame
+      public: FrameInfo info;
+
+      /// \brief Get a pointer to the start of a row
+      /// \param[in] _row Row index
+      /// \return Pointer to the first pixel of the row
+      public: template <typename T>
+              const T *Row(unsigned int _row) const
+              {
+                return reinterpret_cast<const T *>(
+                    static_cast<const unsigned char *>(this->data) +
+                    _row * this->rowPitch);
+              }
+
+      /// \brief Compute a 64 bit hash of the pixels of the frame, skipping
+      /// the row padding. Equal frames have equal hashes, so comparisons
+      /// of sensor output, e.g. across builds, can skip unchanged frames.
+      /// The hash is not cryptographic; it processes 8 bytes at a time so
+      /// it costs about as much as copying the frame.
+      /// \return Hash of the frame, 0 if the view points to no data
+      public: uint64_t Hash() const;
+
+      /// \brief Returns false if the view does not point to any data
+      public: operator bool() const
+              {
+                return this->data != nullptr;
+              }
+    };
+    }
+  }
+}
+#endif
@@ -70,6 +70,22 @@ namespace gz
       /// based on the bias mean and bias standard deviation.
       /// \sa SetBiasMean
       public: virtual void SetBiasStdDev(double _biasStdDev) = 0;
+
+      /// \brief Set the seed of the noise. The noise of a pixel only
+      /// depends on the seed, the pixel and the number of frames rendered
+      /// since the seed was set, so passes with the same seed produce the
+      /// same noise sequence across runs. Setting the seed restarts the
+      /// sequence.
+      /// \param[in] _seed Seed of the noise. Defaults to a value drawn from
+      /// gz::math::Rand, so seeding gz::math::Rand makes the default
+      /// deterministic too.
+      /// \sa Seed
+      public: virtual void SetSeed(unsigned int _seed) = 0;
+
+      /// \brief Get the seed of the noise
+      /// \return Seed of the noise
+      /// \sa SetSeed
+      public: virtual unsigned int Seed() const = 0;
     };
     }
   }
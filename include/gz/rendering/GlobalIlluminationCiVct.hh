@@ -271,6 +271,24 @@ namespace gz
     /// \param[in] _camera Camera to bind. Nullptr to unbind.
     public: virtual void Bind(const CameraPtr &_camera) = 0;
 
+    /// \brief Set how often the cascades follow the bound camera. Moving
+    /// the cascades re-voxelizes and relights the regions they uncover, so
+    /// a larger interval spreads that work over more frames at the cost of
+    /// GI lagging behind a fast moving camera. Coarse cascades already
+    /// update less often than fine ones, see CiVctCascade::SetCameraStepSize.
+    /// \param[in] _frames Number of frames between cascade updates. 0 and 1
+    /// update the cascades every frame, which is the default.
+    public: virtual void SetUpdateInterval(uint32_t _frames) = 0;
+
+    /// \brief Get how often the cascades follow the bound camera.
+    /// \return Number of frames between cascade updates
+    public: virtual uint32_t UpdateInterval() const = 0;
+
+    /// \brief Immediately move all cascades to the bound camera and update
+    /// them, regardless of the update interval. Useful e.g. in tests or
+    /// after teleporting the camera.
+    public: virtual void Converge() = 0;
+
     /// \brief Whether anisotropic setting is on
     /// \return Anisotropy setting
     public: virtual bool Anisotropic() const = 0;
@@ -148,6 +148,16 @@ namespace gz
       /// \return Visualization mode
       public: virtual DebugVisualizationMode DebugVisualization() const = 0;
 
+      /// \brief Like Build, but skips voxelizing the scene when no
+      /// participating visual was added, removed, moved, hidden or given a
+      /// different material since the last build. Visuals excluded with
+      /// SetParticipatingVisuals never trigger a build, e.g. moving dynamic
+      /// visuals when only static visuals bounce GI. Changes to the
+      /// parameters of an existing material are not detected, call Build
+      /// after those.
+      /// \return True if the scene was voxelized
+      public: virtual bool BuildIfChanged() = 0;
+
       /// \brief Called by Scene when lighting changes so that
       /// GI can be updated
       public: virtual void LightingChanged() = 0;
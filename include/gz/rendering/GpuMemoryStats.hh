@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_GPUMEMORYSTATS_HH_
+#define GZ_RENDERING_GPUMEMORYSTATS_HH_
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief GPU memory used by a render engine, broken down by what the
+    /// memory holds. See RenderEngine::MemoryStats. All sizes are in bytes.
+    class GZ_RENDERING_VISIBLE GpuMemoryStats
+    {
+      /// \brief Vertex, index and other GPU buffers, mostly meshes
+      public: uint64_t meshes = 0u;
+
+      /// \brief Textures loaded by materials, heightmaps and the like
+      public: uint64_t textures = 0u;
+
+      /// \brief Shadow map atlases
+      public: uint64_t shadowMaps = 0u;
+
+      /// \brief 3D textures, i.e. the voxel volumes of global illumination
+      public: uint64_t globalIllumination = 0u;
+
+      /// \brief Render targets and depth buffers of cameras and sensors,
+      /// excluding cubemaps
+      public: uint64_t renderTargets = 0u;
+
+      /// \brief Cubemaps, e.g. environment maps, reflection probes and the
+      /// targets of wide angle cameras and point light shadows
+      public: uint64_t cubemaps = 0u;
+
+      /// \brief Staging buffers used to upload and download textures
+      public: uint64_t staging = 0u;
+
+      /// \brief Sum of all the categories above
+      public: uint64_t total = 0u;
+
+      /// \brief GPU memory of the render targets owned by each sensor,
+      /// indexed by sensor name. See Sensor::MemoryUsage.
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<std::string, uint64_t> sensors;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief GPU memory of the render targets owned by the sensors of
+      /// each scene, indexed by scene name
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<std::string, uint64_t> scenes;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
@@ -17,9 +17,14 @@
 #ifndef GZ_RENDERING_GPURAYS_HH_
 #define GZ_RENDERING_GPURAYS_HH_
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector2.hh>
 
 #include "gz/rendering/Image.hh"
 #include "gz/rendering/Sensor.hh"
@@ -32,6 +37,35 @@ namespace gz
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
+    /// \enum GpuRaysOutputFormat GpuRays.hh gz/rendering/GpuRays.hh
+    /// \brief Layout of the data produced by a GpuRays sensor
+    enum GZ_RENDERING_VISIBLE GpuRaysOutputFormat
+    {
+      /// \brief Three float32 channels per ray: range, retro and an unused
+      /// channel. This is the default.
+      GROF_RANGE_RETRO_FLOAT32 = 0,
+      /// \brief One float32 channel per ray containing the range
+      GROF_RANGE_FLOAT32 = 1,
+      /// \brief Two float16 channels per ray: range and retro
+      GROF_RANGE_RETRO_FLOAT16 = 2,
+      /// \brief One uint16 channel per ray containing the range in
+      /// millimetres. Ranges beyond 65.535 m saturate.
+      GROF_RANGE_UINT16_MM = 3,
+      /// \brief Four float32 channels per ray: the range of the first, last
+      /// and strongest return among the samples of the beam, and the retro
+      /// of the strongest return. The strongest return is the one with the
+      /// highest retro, the nearest one on ties. Rays without any hit
+      /// report the no-hit value in all three ranges.
+      /// See GpuRays::SetBeamDivergence.
+      GROF_MULTI_RETURN_FLOAT32 = 4,
+      /// \brief Four float32 channels per ray: the x, y and z coordinates
+      /// of the return in the sensor frame (x forward, y left, z up) and
+      /// its retro as intensity. Rays without a return lie at the no-hit
+      /// range, i.e. have non finite coordinates unless clamping is
+      /// enabled. See GpuRays::SetPointCloudCompaction.
+      GROF_POINT_XYZI_FLOAT32 = 5
+    };
+
     /// \class GpuRays GpuRays.hh gz/rendering/GpuRays.hh
     /// \brief Generate depth ray data.
     class GZ_RENDERING_VISIBLE GpuRays :
@@ -51,6 +85,16 @@ namespace gz
       /// \brief Copy to the specified memory direction the gpu rays data.
       public: virtual void Copy(float *_data) = 0;
 
+      /// \brief Get a lease of the latest frame of gpu rays data, e.g. to
+      /// process it on another thread instead of copying it in the new
+      /// frame listeners. While a lease is held the sensor writes the next
+      /// frames into other buffers of RenderEngine::BufferPool, so the data
+      /// stays unchanged; each held frame keeps one more buffer in use.
+      /// Release the lease by resetting the pointer. This may be called in
+      /// the new frame listeners.
+      /// \return Lease of the data Data() points to, null if there is none
+      public: virtual std::shared_ptr<const float> AcquireData() const = 0;
+
       /// \brief Configure behaviour for data values outside of camera range
       /// \param[in] _clamp True to clamp data to camera clip distances,
       // false to leave data values as +/-inf when out of camera range
@@ -190,6 +234,136 @@ namespace gz
       /// \return The vertical resolution.
       /// \sa VerticalRayCount()
       public: virtual double VerticalResolution() const = 0;
+
+      /// \brief Set the layout of the data produced by the sensor. Compact
+      /// formats reduce the amount of data read back from the GPU. Only the
+      /// float32 formats are available through Data(), Copy() and
+      /// ConnectNewGpuRaysFrame(); the float16 and uint16 formats are only
+      /// delivered through ConnectNewFrameView(). Changing the format
+      /// recreates the sensor's render textures on the next render.
+      /// \param[in] _format Output format
+      /// \sa Channels()
+      public: virtual void SetOutputFormat(GpuRaysOutputFormat _format) = 0;
+
+      /// \brief Get the layout of the data produced by the sensor.
+      /// \return Output format
+      public: virtual GpuRaysOutputFormat OutputFormat() const = 0;
+
+      /// \brief Set the number of buffers used to read back data from the
+      /// GPU. A value greater than 1 enables asynchronous readback: the
+      /// sensor texture is downloaded into a ring of _count buffers without
+      /// stalling the CPU, and the new frame events are emitted _count - 1
+      /// frames after the frame was rendered. Use DataTime() to get the
+      /// scene time of the frame being delivered. A value of 0 or 1
+      /// (default) reads back data synchronously in PostRender. Render
+      /// engines that do not support asynchronous readback ignore this
+      /// setting.
+      /// \param[in] _count Number of readback buffers
+      public: virtual void SetReadbackBufferCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of buffers used to read back data.
+      /// \return Number of readback buffers
+      /// \sa SetReadbackBufferCount
+      public: virtual unsigned int ReadbackBufferCount() const = 0;
+
+      /// \brief Get the scene time at which the data returned by Data()
+      /// and passed to the new frame events was rendered. With asynchronous
+      /// readback this lags Scene::Time() by ReadbackBufferCount() - 1
+      /// frames.
+      /// \return Scene time of the latest delivered frame
+      public: virtual std::chrono::steady_clock::duration DataTime()
+          const = 0;
+
+      /// \brief Set an arbitrary scan pattern. Rays are cast along the
+      /// given directions instead of the regular grid defined by the angle
+      /// ranges and ray counts, e.g. for non-uniform beam elevations or
+      /// non-repetitive patterns. Only the cubemap faces the rays touch are
+      /// rendered. The output has _width rays per row and
+      /// _directions.size() / _width rows, which RangeCount() and
+      /// VerticalRangeCount() report while a pattern is set. Setting a
+      /// pattern of the same size again, e.g. to rotate it every frame, only
+      /// updates the lookup texture unless the rays move to other cubemap
+      /// faces. Ray timestamps are up to the caller: all rays of a frame
+      /// are rendered at the same scene time, see DataTime().
+      /// \param[in] _directions Direction of each ray in row major order,
+      /// as azimuth (X) and elevation (Y) in radians using the same
+      /// convention as AngleMin() and VerticalAngleMin(). Empty to use the
+      /// regular grid again.
+      /// \param[in] _width Number of rays per output row. The number of
+      /// directions must be a multiple of it.
+      public: virtual void SetRayDirections(
+          const std::vector<math::Vector2d> &_directions,
+          unsigned int _width) = 0;
+
+      /// \brief Get the directions of the scan pattern
+      /// \return Direction of each ray, empty if the rays follow the
+      /// regular grid
+      /// \sa SetRayDirections
+      public: virtual const std::vector<math::Vector2d> &RayDirections()
+          const = 0;
+
+      /// \brief Emulate the motion distortion of a scanning sensor that
+      /// moves during a scan, e.g. a spinning lidar on a moving vehicle.
+      /// The columns of the output are assumed to be cast in order, from
+      /// the first column at _start to the last column at _end, and the
+      /// rays are cast from the pose interpolated in between. The ranges
+      /// are measured from that pose, like a real sensor reports them in
+      /// its frame at the firing time. The ogre2 render engine renders each
+      /// cubemap face once at the pose of the mean time of its rays, so this
+      /// costs a single render but the interpolation is per face rather
+      /// than per ray. The motion applies to every update until it is set
+      /// again or cleared.
+      /// \param[in] _start World pose of the sensor at the start of the scan
+      /// \param[in] _end World pose of the sensor at the end of the scan
+      /// \sa ClearScanMotion
+      public: virtual void SetScanMotion(const math::Pose3d &_start,
+          const math::Pose3d &_end) = 0;
+
+      /// \brief Cast all rays from the sensor's pose again
+      /// \sa SetScanMotion
+      public: virtual void ClearScanMotion() = 0;
+
+      /// \brief Get whether the rays are cast from a moving pose
+      /// \return True if a scan motion is set
+      /// \sa SetScanMotion
+      public: virtual bool HasScanMotion() const = 0;
+
+      /// \brief Model the footprint of the beams. Each ray gathers _samples
+      /// samples within a cone of the given full angle around its direction
+      /// on the GPU, so only one value per ray is read back. With
+      /// GROF_MULTI_RETURN_FLOAT32 the first, last and strongest returns of
+      /// the samples are reported, the other output formats report the
+      /// first return.
+      /// \param[in] _divergence Full angle of the beam cone in radians, 0
+      /// for ideal rays (default)
+      /// \param[in] _samples Number of samples per beam, from 1 (default)
+      /// to 16
+      public: virtual void SetBeamDivergence(double _divergence,
+          unsigned int _samples) = 0;
+
+      /// \brief Get the full angle of the beam cone
+      /// \return Beam divergence in radians
+      /// \sa SetBeamDivergence
+      public: virtual double BeamDivergence() const = 0;
+
+      /// \brief Get the number of samples per beam
+      /// \return Number of samples per beam
+      /// \sa SetBeamDivergence
+      public: virtual unsigned int BeamSampleCount() const = 0;
+
+      /// \brief Drop the rays without a return from the frames of the
+      /// GROF_POINT_XYZI_FLOAT32 output format. The frames delivered by
+      /// ConnectNewGpuRaysFrame are then a single row of points, as wide
+      /// as the number of returns, and Data() holds the points of the last
+      /// frame. Frame views always get the full range image.
+      /// \param[in] _compact True to drop the rays without a return
+      public: virtual void SetPointCloudCompaction(bool _compact) = 0;
+
+      /// \brief Get whether rays without a return are dropped from point
+      /// cloud frames
+      /// \return True if the point clouds are compacted
+      /// \sa SetPointCloudCompaction
+      public: virtual bool PointCloudCompaction() const = 0;
     };
   }
   }
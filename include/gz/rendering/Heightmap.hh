@@ -17,6 +17,11 @@
 #ifndef GZ_RENDERING_HEIGHTMAP_HH_
 #define GZ_RENDERING_HEIGHTMAP_HH_
 
+#include <vector>
+
+#include <gz/math/Angle.hh>
+#include <gz/math/Vector2.hh>
+
 #include "gz/rendering/config.hh"
 #include "gz/rendering/Geometry.hh"
 #include "gz/rendering/HeightmapDescriptor.hh"
@@ -35,6 +40,81 @@ namespace gz
       /// \brief Get the immutable heightmap descriptor.
       /// \return Descriptor with heightmap information.
       public: virtual const HeightmapDescriptor &Descriptor() = 0;
+
+      /// \brief Get whether the heightmap finished loading. Heightmaps
+      /// created with HeightmapDescriptor::SetAsyncLoading(true) prepare
+      /// their data on a worker thread and are not rendered until loaded.
+      /// \return True if the heightmap is loaded.
+      public: virtual bool IsLoaded() const = 0;
+
+      /// \brief Set the minimum change in light direction that triggers a
+      /// recomputation of the terrain shadows. Smaller changes keep the
+      /// current shadows. Useful when the sun moves slowly every frame,
+      /// e.g. in day / night cycles. Defaults to 0, which recomputes the
+      /// shadows on every change.
+      /// \param[in] _angle Minimum change in light direction
+      public: virtual void SetShadowUpdateThreshold(
+                  const math::Angle &_angle) = 0;
+
+      /// \brief Get the minimum change in light direction that triggers a
+      /// recomputation of the terrain shadows.
+      /// \return Minimum change in light direction
+      public: virtual math::Angle ShadowUpdateThreshold() const = 0;
+
+      /// \brief Set the minimum number of frames between two recomputations
+      /// of the terrain shadows. Light direction changes within that many
+      /// frames of the last recomputation are coalesced into a single
+      /// recomputation. Defaults to 0.
+      /// \param[in] _frames Minimum number of frames between recomputations
+      public: virtual void SetShadowUpdateInterval(unsigned int _frames) = 0;
+
+      /// \brief Get the minimum number of frames between two recomputations
+      /// of the terrain shadows.
+      /// \return Minimum number of frames between recomputations
+      public: virtual unsigned int ShadowUpdateInterval() const = 0;
+
+      /// \brief Set how far a camera has to move before the terrain cells
+      /// it renders and their level of detail are selected again. The cells
+      /// are selected for each camera and kept while the camera does not
+      /// rotate or change its projection, so fixed cameras never select
+      /// them again. Cells at the edge of the view may be missing until a
+      /// moving camera went that far. Defaults to 0, which selects the
+      /// cells again whenever the camera moves.
+      /// \param[in] _distance Distance in meters
+      public: virtual void SetLodUpdateDistance(double _distance) = 0;
+
+      /// \brief Get how far a camera has to move before the terrain cells
+      /// are selected again
+      /// \return Distance in meters
+      public: virtual double LodUpdateDistance() const = 0;
+
+      /// \brief Set after how many frames without being seen by any camera
+      /// the textures of the terrain layers are unloaded from the GPU, see
+      /// HeightmapDescriptor::AddTexture. They are loaded again once a
+      /// camera sees the terrain, and loaded the first time then as well.
+      /// Saves GPU memory in scenes with many textured terrains. Defaults
+      /// to 0, which never unloads them.
+      /// \param[in] _frames Number of frames without being seen
+      public: virtual void SetTextureUnloadFrames(unsigned int _frames) = 0;
+
+      /// \brief Get after how many frames without being seen the textures
+      /// of the terrain layers are unloaded
+      /// \return Number of frames, 0 if they are never unloaded
+      public: virtual unsigned int TextureUnloadFrames() const = 0;
+
+      /// \brief Get the terrain heights at many positions at once, e.g. to
+      /// place vegetation or spawn vehicles, instead of casting one ray per
+      /// position. The heights are interpolated from the heightmap data
+      /// the same way the terrain is rendered and do not depend on the
+      /// scene graph, so it can be called any time after loading.
+      /// \param[in] _positions XY positions in the frame of the visual the
+      /// heightmap is attached to
+      /// \return Height at each position in the same frame, NaN for
+      /// positions outside of the terrain, if the heightmap is not loaded
+      /// yet, see IsLoaded, or if it was created without
+      /// HeightmapDescriptor::SetHeightQueries
+      public: virtual std::vector<double> HeightsAt(
+                  const std::vector<math::Vector2d> &_positions) const = 0;
     };
     }
   }
@@ -210,6 +210,27 @@ inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     /// \param[in] _use True to use.
     public: void SetUseTerrainPaging(bool _use);
 
+    /// \brief Get whether the heightmap data is prepared asynchronously.
+    /// \return True if the heightmap data is prepared on a worker thread.
+    public: bool AsyncLoading() const;
+
+    /// \brief Set whether the heightmap data is prepared on a worker thread
+    /// instead of the thread that creates the heightmap. The heightmap is
+    /// not rendered until Heightmap::IsLoaded returns true. Defaults to
+    /// false.
+    /// \param[in] _async True to prepare the data asynchronously.
+    public: void SetAsyncLoading(bool _async);
+
+    /// \brief Get whether the heights stay in memory for height queries.
+    /// \return True if Heightmap::HeightsAt can be used.
+    public: bool HeightQueries() const;
+
+    /// \brief Set whether a copy of the heights stays in memory after they
+    /// are uploaded to the GPU, so Heightmap::HeightsAt can be used. Large
+    /// terrains save a lot of memory without it. Defaults to false.
+    /// \param[in] _enabled True to keep the heights for height queries.
+    public: void SetHeightQueries(bool _enabled);
+
     /// \brief Get the heightmap's sampling per datum.
     /// \return The heightmap's sampling.
     public: unsigned int Sampling() const;
@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_IMAGE_HH_
 #define GZ_RENDERING_IMAGE_HH_
 
+#include <functional>
 #include <memory>
 
 #include <gz/utils/ImplPtr.hh>
@@ -45,6 +46,25 @@ namespace gz
       public: Image(unsigned int _width, unsigned int _height,
                   PixelFormat _format);
 
+      /// \brief Constructor that wraps a buffer provided by the caller,
+      /// e.g. a message buffer, a shared memory segment or pinned host
+      /// memory, so that cameras write into it directly. Invalid arguments
+      /// result in an empty image.
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      /// \param[in] _format Image pixel format
+      /// \param[in] _data Image buffer of at least _rowStride * _height
+      /// bytes
+      /// \param[in] _rowStride Number of bytes between the starts of two
+      /// rows, at least a row of pixels. 0 for tightly packed rows.
+      /// \param[in] _deleter Called with _data once the image and all its
+      /// copies are destroyed. Null if the caller keeps ownership, in
+      /// which case the buffer must outlive the image and its copies.
+      public: Image(unsigned int _width, unsigned int _height,
+                  PixelFormat _format, void *_data,
+                  unsigned int _rowStride = 0u,
+                  std::function<void(void *)> _deleter = nullptr);
+
       /// \brief Destructor
       public: virtual ~Image();
 
@@ -64,10 +84,27 @@ namespace gz
       /// \return The image channel depth
       public: unsigned int Depth() const;
 
-      /// \brief Get image channel depth
-      /// \return The image channel depth
+      /// \brief Get the size of the image buffer in bytes, which includes
+      /// the row padding of images with a row stride
+      /// \return The image buffer size in bytes
       public: unsigned int MemorySize() const;
 
+      /// \brief Get the number of bytes between the starts of two rows
+      /// \return The row stride in bytes
+      public: unsigned int RowStride() const;
+
+      /// \brief Check if the rows of the image are tightly packed
+      /// \return True if the row stride equals the size of a row of pixels
+      public: bool IsPacked() const;
+
+      /// \brief Copy the pixels of an image of the same size and format
+      /// into the buffer of this image. The row strides of both images are
+      /// honoured.
+      /// \param[in] _image Image to copy from
+      /// \return True if the pixels were copied, false if the size or
+      /// format differ
+      public: bool CopyFrom(const Image &_image);
+
       /// \brief Get a const pointer to image data
       /// \return The const pointer to image data
       public: const void *Data() const;
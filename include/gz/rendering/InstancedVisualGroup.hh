@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_INSTANCEDVISUALGROUP_HH_
+#define GZ_RENDERING_INSTANCEDVISUALGROUP_HH_
+
+#include <memory>
+
+#include <gz/math/Color.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class InstancedVisualGroupPrivate;
+
+    /// \class InstancedVisualGroup InstancedVisualGroup.hh
+    /// gz/rendering/InstancedVisualGroup.hh
+    /// \brief A group of many copies of the same mesh, e.g. trees in a
+    /// forest or boxes in a parcel stack. All instances share one mesh and
+    /// one material per distinct color, which lets render engines that
+    /// batch identical renderables, like ogre2, draw the whole group in a
+    /// handful of draw calls.
+    ///
+    /// Each instance is a regular child visual of Visual(), so sensors
+    /// keep working as usual. Per-instance properties that sensors rely
+    /// on, such as the segmentation "label" or the thermal "temperature",
+    /// are set as user data on the visual returned by InstanceByIndex().
+    /// Use Scene::CreateInstancedVisualGroup to create a group.
+    class GZ_RENDERING_VISIBLE InstancedVisualGroup
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene to create the instances in
+      /// \param[in] _desc Descriptor of the mesh every instance renders
+      /// \param[in] _material Material shared by all instances. The
+      /// scene's default material is used if null.
+      public: InstancedVisualGroup(ScenePtr _scene,
+                  const MeshDescriptor &_desc, MaterialPtr _material);
+
+      /// \brief Destructor. The visuals stay in the scene until Destroy is
+      /// called or the scene is destroyed.
+      public: virtual ~InstancedVisualGroup();
+
+      /// \brief Get the parent visual of all instances. Add it to the scene
+      /// graph to show the group.
+      /// \return Parent visual of the group
+      public: VisualPtr Visual() const;
+
+      /// \brief Add an instance that uses the group's material
+      /// \param[in] _pose Pose of the instance relative to Visual()
+      /// \return Index of the new instance
+      public: unsigned int AddInstance(const math::Pose3d &_pose);
+
+      /// \brief Add an instance with its own diffuse color. Instances with
+      /// the same color share a material.
+      /// \param[in] _pose Pose of the instance relative to Visual()
+      /// \param[in] _color Diffuse color of the instance
+      /// \return Index of the new instance
+      public: unsigned int AddInstance(const math::Pose3d &_pose,
+                  const math::Color &_color);
+
+      /// \brief Get the number of instances in the group
+      /// \return Number of instances
+      public: unsigned int InstanceCount() const;
+
+      /// \brief Get the visual of an instance, e.g. to set user data
+      /// \param[in] _index Index of the instance
+      /// \return Visual of the instance, null if the index is out of range
+      public: VisualPtr InstanceByIndex(unsigned int _index) const;
+
+      /// \brief Set the pose of an instance
+      /// \param[in] _index Index of the instance
+      /// \param[in] _pose Pose of the instance relative to Visual()
+      public: void SetInstancePose(unsigned int _index,
+                  const math::Pose3d &_pose);
+
+      /// \brief Set the diffuse color of an instance
+      /// \param[in] _index Index of the instance
+      /// \param[in] _color Diffuse color of the instance
+      public: void SetInstanceColor(unsigned int _index,
+                  const math::Color &_color);
+
+      /// \brief Destroy all instances, their materials and the parent
+      /// visual
+      public: void Destroy();
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<InstancedVisualGroupPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
@@ -188,6 +188,21 @@ namespace gz
       /// \brief Get if non-hitting rays will be displayed
       /// \return Boolean value if non-hitting rays will be displayed
       public: virtual bool DisplayNonHitting() const = 0;
+
+      /// \brief Visualize the output of a GpuRays sensor of the same scene.
+      /// Update then reads the sensor's latest frame in place, see
+      /// GpuRays::AcquireData, so the ranges are neither copied by the
+      /// caller nor converted to double, and frames that were already
+      /// visualized are skipped. The angles, ray counts, ranges and scan
+      /// pattern of the sensor replace those set on the visual. Only the
+      /// float32 output formats with ranges in the first channel are
+      /// supported. SetPoints and ClearPoints unbind the sensor.
+      /// \param[in] _gpuRays Sensor to visualize, null to unbind it
+      public: virtual void SetGpuRays(const GpuRaysPtr &_gpuRays) = 0;
+
+      /// \brief Get the sensor the visual is bound to
+      /// \return Sensor set by SetGpuRays, null if there is none
+      public: virtual GpuRaysPtr GpuRays() const = 0;
     };
     }
   }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_LIGHTCLUSTERCONFIG_HH_
+#define GZ_RENDERING_LIGHTCLUSTERCONFIG_HH_
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Configuration of clustered forward lighting, see
+    /// Scene::SetLightClustering. The view frustum of every camera is split
+    /// into a grid of width x height tiles and a number of depth slices.
+    /// Each pixel is only shaded with the lights that touch its cluster,
+    /// which keeps the cost of scenes with many point and spot lights
+    /// proportional to the lights that actually reach a pixel.
+    class GZ_RENDERING_VISIBLE LightClusterConfig
+    {
+      /// \brief True to shade point and spot lights per cluster. Point and
+      /// spot lights that do not cast shadows are only rendered when
+      /// clustering is enabled.
+      public: bool enabled = true;
+
+      /// \brief Number of tiles along the width of the view
+      public: unsigned int width = 16u;
+
+      /// \brief Number of tiles along the height of the view
+      public: unsigned int height = 8u;
+
+      /// \brief Number of depth slices between minDistance and maxDistance
+      public: unsigned int slices = 24u;
+
+      /// \brief Maximum number of lights per cluster. Lights beyond the
+      /// budget are dropped from the cluster.
+      public: unsigned int lightsPerCell = 96u;
+
+      /// \brief Maximum number of decals, e.g. projectors, per cluster.
+      /// Decals beyond the budget are dropped from the cluster, so raise it
+      /// when many projectors overlap, e.g. for structured light.
+      public: unsigned int decalsPerCell = 16u;
+
+      /// \brief Distance from the camera at which the first slice starts
+      public: double minDistance = 1.0;
+
+      /// \brief Distance from the camera beyond which lights are not
+      /// clustered
+      public: double maxDistance = 500.0;
+    };
+    }
+  }
+}
+#endif
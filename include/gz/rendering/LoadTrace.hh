@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_LOADTRACE_HH_
+#define GZ_RENDERING_LOADTRACE_HH_
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class LoadTracePrivate;
+
+    /// \brief Timed phase recorded by a LoadTrace
+    class GZ_RENDERING_VISIBLE LoadTraceEvent
+    {
+      /// \brief Name of the phase, e.g. "Ogre2MeshFactory::Load"
+      public: std::string name;
+
+      /// \brief Category of the phase, e.g. "engine", "mesh", "texture",
+      /// "heightmap" or "shader"
+      public: std::string category;
+
+      /// \brief Asset the phase loaded, e.g. a mesh name or texture path.
+      /// Empty for phases that do not load a single asset.
+      public: std::string detail;
+
+      /// \brief Start of the phase, relative to when tracing was enabled
+      public: std::chrono::steady_clock::duration start{};
+
+      /// \brief Duration of the phase
+      public: std::chrono::steady_clock::duration duration{};
+
+      /// \brief Number of phases of the same thread the phase is nested in
+      public: unsigned int depth = 0u;
+
+      /// \brief Index of the thread that ran the phase, 0 for the first
+      /// thread that recorded a phase
+      public: unsigned int thread = 0u;
+    };
+
+    /// \class LoadTrace LoadTrace.hh gz/rendering/LoadTrace.hh
+    /// \brief Records where startup and world load time goes: engine
+    /// initialization, resource registration, mesh, texture and heightmap
+    /// loads and shader compiles. Phases are timed with LoadTraceScope,
+    /// which costs a flag check while tracing is disabled, and can be
+    /// exported to the Chrome trace event format, e.g. for chrome://tracing
+    /// or Perfetto.
+    ///
+    /// Every render engine owns one, see RenderEngine::Trace. It is enabled
+    /// by the "loadTrace" render engine parameter or the
+    /// GZ_RENDERING_LOAD_TRACE environment variable, either set to the
+    /// path of the trace file written when the engine is finalized. Thread
+    /// safe.
+    class GZ_RENDERING_VISIBLE LoadTrace
+    {
+      /// \brief Constructor
+      public: LoadTrace();
+
+      /// \brief Destructor
+      public: ~LoadTrace();
+
+      /// \brief Enable or disable recording. Event start times are relative
+      /// to when recording was first enabled since the last Clear.
+      /// \param[in] _enabled True to record phases, disabled by default
+      public: void SetEnabled(bool _enabled);
+
+      /// \brief Check whether phases are recorded
+      /// \return True if recording is enabled
+      public: bool Enabled() const;
+
+      /// \brief Set the path of the Chrome trace file written by
+      /// WriteOutput
+      /// \param[in] _path Path of the file, empty for none
+      public: void SetOutputPath(const std::string &_path);
+
+      /// \brief Get the path of the Chrome trace file written by
+      /// WriteOutput
+      /// \return Path of the file, empty if none is set
+      public: std::string OutputPath() const;
+
+      /// \brief Record a phase. Usually called by LoadTraceScope.
+      /// Ignored while recording is disabled.
+      /// \param[in] _event Phase to record
+      public: void Record(const LoadTraceEvent &_event);
+
+      /// \brief Get the recorded phases
+      /// \return Phases in the order they ended
+      public: std::vector<LoadTraceEvent> Events() const;
+
+      /// \brief Get the total time spent in each named phase, e.g. all
+      /// mesh loads together
+      /// \return Sum of the durations of the phases of each name
+      public: std::map<std::string, std::chrono::steady_clock::duration>
+                  Totals() const;
+
+      /// \brief Get the start time the event start times are relative to
+      /// \return Time recording was first enabled since the last Clear
+      public: std::chrono::steady_clock::time_point Origin() const;
+
+      /// \brief Remove the recorded phases
+      public: void Clear();
+
+      /// \brief Write the recorded phases in the Chrome trace event format
+      /// \param[in] _path Path of the file to write
+      /// \return True if the file was written
+      public: bool WriteChromeTrace(const std::string &_path) const;
+
+      /// \brief Write the recorded phases to the output path, if one is set
+      /// \return True if no output path is set or the file was written
+      public: bool WriteOutput() const;
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<LoadTracePrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+
+    /// \class LoadTraceScope LoadTrace.hh gz/rendering/LoadTrace.hh
+    /// \brief Times the phase from its construction to its destruction and
+    /// records it in a LoadTrace. Scopes of the same thread nest:
+    ///
+    ///     LoadTraceScope scope(engine->Trace(), "Ogre2MeshFactory::Load",
+    ///         "mesh", _desc.meshName);
+    class GZ_RENDERING_VISIBLE LoadTraceScope
+    {
+      /// \brief Constructor, starts timing the phase if the trace is
+      /// enabled
+      /// \param[in] _trace Trace to record the phase in
+      /// \param[in] _name Name of the phase, must outlive the scope
+      /// \param[in] _category Category of the phase, must outlive the scope
+      /// \param[in] _detail Asset the phase loads, empty for none
+      public: LoadTraceScope(LoadTrace &_trace, const char *_name,
+                  const char *_category, const std::string &_detail = "");
+
+      /// \brief Destructor, records the phase
+      public: ~LoadTraceScope();
+
+      /// \brief Not copyable
+      public: LoadTraceScope(const LoadTraceScope &) = delete;
+
+      /// \brief Not copyable
+      public: LoadTraceScope &operator=(const LoadTraceScope &) = delete;
+
+      /// \brief Trace to record the phase in, null if it was disabled when
+      /// the phase started
+      private: LoadTrace *trace = nullptr;
+
+      /// \brief Name of the phase
+      private: const char *name = nullptr;
+
+      /// \brief Category of the phase
+      private: const char *category = nullptr;
+
+      /// \brief Asset the phase loads
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::string detail;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Time the phase started
+      private: std::chrono::steady_clock::time_point start;
+    };
+    }
+  }
+}
+#endif
@@ -143,6 +143,25 @@ namespace gz
       /// \param[in] _value The new positional vector of the point
       public: virtual void SetPoint(unsigned int _index,
                   const gz::math::Vector3d &_value) = 0;
+
+      /// \brief Replace all points of the marker. This is much faster than
+      /// calling ClearPoints and AddPoint for every point of a large point
+      /// cloud.
+      /// \param[in] _xyz Point positions, 3 consecutive floats per point
+      /// \param[in] _rgba Point colors, 4 consecutive floats per point. If
+      /// null, all points are white.
+      /// \param[in] _count Number of points
+      public: virtual void SetPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) = 0;
+
+      /// \brief Add many points at once to the end of the point list
+      /// \param[in] _xyz Point positions, 3 consecutive floats per point
+      /// \param[in] _rgba Point colors, 4 consecutive floats per point. If
+      /// null, all points are white.
+      /// \param[in] _count Number of points
+      /// \sa SetPoints
+      public: virtual void AppendPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) = 0;
     };
     }
   }
@@ -20,6 +20,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <gz/math/Matrix4.hh>
 #include "gz/rendering/config.hh"
 #include "gz/rendering/Geometry.hh"
@@ -76,6 +77,45 @@ namespace gz
       public: virtual void SetSkeletonWeights(
             const std::unordered_map<std::string, float> &_weights) = 0;
 
+      /// \brief Get the names of the skeleton nodes in the order used by
+      /// the index based skeleton functions, e.g. SetSkeletonBoneTransforms.
+      /// Query the order once and keep per-bone data in contiguous arrays
+      /// of the same order to avoid looking bones up by name every frame.
+      /// \return Skeleton node names, empty if the mesh has no skeleton
+      public: virtual std::vector<std::string> SkeletonBoneNames() const = 0;
+
+      /// \brief Get the local transforms of the skeleton nodes
+      /// \param[out] _tfs Local transforms in SkeletonBoneNames() order.
+      /// The vector is resized to the number of skeleton nodes.
+      public: virtual void SkeletonBoneTransforms(
+            std::vector<math::Matrix4d> &_tfs) const = 0;
+
+      /// \brief Set the local transforms of the skeleton nodes
+      /// \param[in] _tfs Array of local transforms in SkeletonBoneNames()
+      /// order
+      /// \param[in] _count Number of transforms in _tfs. Nodes past _count
+      /// are left unchanged.
+      public: virtual void SetSkeletonBoneTransforms(
+            const math::Matrix4d *_tfs, unsigned int _count) = 0;
+
+      /// \brief Set the local transforms of the skeleton nodes from single
+      /// precision 3x4 matrices
+      /// \param[in] _tfs Array of _count row-major 3x4 matrices, i.e. 12
+      /// floats per node holding the rotation and the translation in the
+      /// last column, in SkeletonBoneNames() order
+      /// \param[in] _count Number of matrices in _tfs. Nodes past _count
+      /// are left unchanged.
+      public: virtual void SetSkeletonBoneTransforms3x4(const float *_tfs,
+            unsigned int _count) = 0;
+
+      /// \brief Set the weights of the skeleton nodes
+      /// \param[in] _weights Array of weights in SkeletonBoneNames() order
+      /// \param[in] _count Number of weights in _weights. Nodes past _count
+      /// are left unchanged.
+      /// \sa SetSkeletonWeights
+      public: virtual void SetSkeletonBoneWeights(const float *_weights,
+            unsigned int _count) = 0;
+
       /// \brief Set whether a skeleton animation should be enabled or not
       /// \param[in] _name Name of animation
       /// \param[in] _enabled True to enable animation, false to disable
@@ -95,6 +135,45 @@ namespace gz
       public: virtual void UpdateSkeletonAnimation(
           std::chrono::steady_clock::duration _time) = 0;
 
+      /// \brief Set whether the skeleton animation of the mesh is played
+      /// instanced. The enabled animation is sampled once at _bakeRate
+      /// into a pose table shared by all the meshes of the scene with the
+      /// same skeleton that play it instanced, and UpdateSkeletonAnimation
+      /// only interpolates the pose of the mesh from the table. Meshes
+      /// then differ only by their playback time, which makes large crowds
+      /// of animated actors affordable. Only one animation plays at a time
+      /// in this mode: enabling an animation disables the others, and
+      /// animation weights and skeleton weights are ignored. Render engines
+      /// that do not support instanced animation ignore this setting.
+      /// \param[in] _instanced True to play the animation instanced
+      /// \param[in] _bakeRate Rate in Hz the animation is sampled at
+      public: virtual void SetSkeletonAnimationInstanced(bool _instanced,
+          double _bakeRate = 30.0) = 0;
+
+      /// \brief Get whether the skeleton animation is played instanced
+      /// \return True if the animation is played instanced
+      /// \sa SetSkeletonAnimationInstanced
+      public: virtual bool SkeletonAnimationInstanced() const = 0;
+
+      /// \brief Replace the vertex positions, and optionally the normals,
+      /// of a sub-mesh, e.g. of cloth, cables or soft bodies simulated on
+      /// the CPU. The mesh must be created from a descriptor with
+      /// MeshDescriptor::dynamic set. The topology and texture coordinates
+      /// are kept and the bounds of the mesh are updated. Meshes created
+      /// from the same descriptor share their vertices.
+      /// \param[in] _subMeshIndex Index of the sub-mesh
+      /// \param[in] _positions Three floats per vertex
+      /// \param[in] _normals Three floats per vertex, null to recompute
+      /// the normals of triangle lists from the new positions
+      /// \param[in] _vertexCount Number of vertices, which must match the
+      /// vertex count of the sub-mesh
+      /// \return True if the vertices were updated, false if the mesh is
+      /// not dynamic, the arguments do not match the sub-mesh or the render
+      /// engine does not support it
+      public: virtual bool UpdateVertices(unsigned int _subMeshIndex,
+                  const float *_positions, const float *_normals,
+                  unsigned int _vertexCount) = 0;
+
       /// \brief Get the sub-mesh count
       /// \return The sub-mesh count
       public: virtual unsigned int SubMeshCount() const = 0;
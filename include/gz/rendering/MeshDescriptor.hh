@@ -18,6 +18,7 @@
 #define GZ_RENDERING_MESHDESCRIPTOR_HH_
 
 #include <string>
+#include <vector>
 
 #include <gz/utils/SuppressWarning.hh>
 
@@ -77,6 +78,44 @@ namespace gz
 
       /// \brief Denotes if the loaded sub-mesh vertices should be centered
       public: bool centerSubMesh = false;
+
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      /// \brief Camera distances, in meters and in increasing order, at
+      /// which the mesh switches to the next coarser level of detail. One
+      /// level of detail is generated when the mesh is loaded for each
+      /// distance. Empty by default, i.e. the mesh is always rendered at
+      /// full detail. Not all render engines support levels of detail.
+      /// \sa Camera::SetLodBias
+      public: std::vector<double> lodDistances;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Fraction of triangles kept by each generated level of
+      /// detail relative to the previous one, in (0, 1).
+      public: double lodReduction = 0.5;
+
+      /// \brief Denotes if the vertices are updated after loading, see
+      /// Mesh::UpdateVertices. Dynamic meshes keep full precision
+      /// positions and normals in buffers that are cheap to update, and
+      /// have no levels of detail or skeleton. Not all render engines
+      /// support dynamic meshes.
+      public: bool dynamic = false;
+
+      /// \brief Denotes if vertex positions are stored as half floats,
+      /// which saves a quarter of the vertex memory at the cost of
+      /// precision. Only suitable for meshes close to their origin, e.g.
+      /// centered submeshes. Ignored by dynamic meshes and meshes with a
+      /// skeleton or levels of detail. Not all render engines support half
+      /// float positions.
+      public: bool halfPositions = false;
+
+      /// \brief Denotes if the mesh is optimized for rendering when it is
+      /// loaded: duplicate vertices are merged, triangles are reordered for
+      /// the vertex cache and to draw less overdraw, and vertices are
+      /// reordered in the order the triangles use them. Takes longer to
+      /// load, so it suits meshes that are cached on disk. Ignored by
+      /// dynamic meshes and meshes with a skeleton. Not all render engines
+      /// optimize meshes.
+      public: bool optimize = false;
     };
     }
   }
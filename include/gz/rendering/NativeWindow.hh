@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_NATIVEWINDOW_HH_
 #define GZ_RENDERING_NATIVEWINDOW_HH_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include "gz/rendering/config.hh"
@@ -75,6 +76,42 @@ namespace gz
       /// be stretched.
       /// \param[in] _camera Camera to draw
       public: virtual void Draw(CameraPtr _camera) = 0;
+
+      /// \brief Set the number of vertical blanks to wait for between two
+      /// presented frames.
+      /// \param[in] _interval Swap interval, 0 disables vsync
+      public: virtual void SetSwapInterval(unsigned int _interval) = 0;
+
+      /// \brief Get the number of vertical blanks to wait for between two
+      /// presented frames.
+      /// \return Swap interval, 0 if vsync is disabled
+      public: virtual unsigned int SwapInterval() const = 0;
+
+      /// \brief Limit the number of frames drawn to the window that the GPU
+      /// has not finished yet. Once the limit is reached, Draw either waits
+      /// for the oldest one or skips the frame, see SetNonBlockingPresent.
+      /// \param[in] _frames Maximum number of frames in flight, 0 for no
+      /// limit other than the render system's
+      public: virtual void SetMaxFramesInFlight(unsigned int _frames) = 0;
+
+      /// \brief Get the maximum number of frames in flight
+      /// \return Maximum number of frames in flight, 0 if unlimited
+      public: virtual unsigned int MaxFramesInFlight() const = 0;
+
+      /// \brief Set whether Draw skips frames instead of waiting when the
+      /// maximum number of frames in flight is reached, so presenting never
+      /// blocks the thread that also renders sensors.
+      /// \param[in] _nonBlocking True to skip frames, false to wait
+      public: virtual void SetNonBlockingPresent(bool _nonBlocking) = 0;
+
+      /// \brief Get whether Draw skips frames instead of waiting
+      /// \return True if frames are skipped, false by default
+      public: virtual bool NonBlockingPresent() const = 0;
+
+      /// \brief Get the number of frames Draw skipped because the maximum
+      /// number of frames in flight was reached
+      /// \return Number of skipped frames
+      public: virtual uint64_t SkippedFrameCount() const = 0;
     };
     }
   }
@@ -20,6 +20,7 @@
 #include <map>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include <gz/math/Pose3.hh>
 #include <gz/math/Quaternion.hh>
@@ -27,6 +28,7 @@
 #include "gz/rendering/config.hh"
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/Object.hh"
+#include "gz/rendering/UserDataKey.hh"
 #include "gz/rendering/Export.hh"
 
 namespace gz
@@ -337,6 +339,42 @@ namespace gz
       /// \param[in] _key Unique key
       /// \return True if node has custom data with the specified key
       public: virtual bool HasUserData(const std::string &_key) const = 0;
+
+      /// \brief Get the keys of the custom data stored in this node
+      /// \return Keys of the custom data, in lexicographic order
+      public: virtual std::vector<std::string> UserDataKeys() const = 0;
+
+      /// \brief Store any custom data associated with this node. The data
+      /// is also accessible by the name of the key.
+      /// \param[in] _key Interned key, resolve it once and reuse it
+      /// \param[in] _value Value in any type
+      public: virtual void SetUserData(
+        const UserDataKey &_key, Variant _value) = 0;
+
+      /// \brief Get custom data stored in this node without copying it
+      /// \param[in] _key Interned key
+      /// \return Pointer to the value, null if _key does not exist for the
+      /// node. The pointer is invalidated when custom data is set.
+      public: virtual const Variant *UserDataValue(
+        const UserDataKey &_key) const = 0;
+
+      /// \brief Check if node has custom data
+      /// \param[in] _key Interned key
+      /// \return True if node has custom data with the specified key
+      public: virtual bool HasUserData(const UserDataKey &_key) const = 0;
+
+      /// \brief Get custom data of a given type stored in this node. Does not
+      /// throw if the data does not exist or holds another type.
+      /// \param[in] _key Interned key
+      /// \return Pointer to the value, null if _key does not exist for the
+      /// node or its value is not a T. The pointer is invalidated when
+      /// custom data is set.
+      public: template <typename T>
+              const T *UserDataAs(const UserDataKey &_key) const
+      {
+        const Variant *value = this->UserDataValue(_key);
+        return value ? std::get_if<T>(value) : nullptr;
+      }
     };
     }
   }
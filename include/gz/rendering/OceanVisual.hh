@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OCEANVISUAL_HH_
+#define GZ_RENDERING_OCEANVISUAL_HH_
+
+#include <gz/math/Vector2.hh>
+#include <gz/math/Vector3.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Visual.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class OceanVisual OceanVisual.hh
+    /// gz/rendering/OceanVisual.hh
+    /// \brief A water surface animated by a sum of Gerstner waves, for
+    /// ocean scenes several kilometers wide.
+    ///
+    /// The surface is the z = 0 plane of the visual's frame displaced by
+    /// the waves at the scene time. It is drawn as nested square rings of
+    /// cells around Center(), each ring with cells twice as large as the
+    /// ring inside it, so the detail is highest near the center, which
+    /// usually follows the camera. The displaced vertices are regular
+    /// geometry, so depth cameras, GPU rays and the other sensors see the
+    /// same surface as color cameras, and Height matches what is rendered.
+    class GZ_RENDERING_VISIBLE OceanVisual :
+      public virtual Visual
+    {
+      /// \brief Constructor
+      protected: OceanVisual();
+
+      /// \brief Destructor
+      public: virtual ~OceanVisual();
+
+      /// \brief Add a wave. Its speed follows from the deep water
+      /// dispersion relation, i.e. longer waves travel faster.
+      /// \param[in] _amplitude Amplitude in meters
+      /// \param[in] _wavelength Wavelength in meters
+      /// \param[in] _direction Direction of travel, angle from the x axis
+      /// of the visual in radians
+      /// \param[in] _choppiness Horizontal displacement relative to the
+      /// amplitude, 0 for rolling sine waves and 1 for circular orbits.
+      /// Crests fold over where the sum of choppiness * amplitude *
+      /// 2 * pi / wavelength of all waves exceeds 1.
+      /// \param[in] _phase Phase offset in radians
+      public: virtual void AddWave(double _amplitude, double _wavelength,
+                  double _direction, double _choppiness = 1.0,
+                  double _phase = 0.0) = 0;
+
+      /// \brief Remove all waves, leaving a flat surface
+      public: virtual void ClearWaves() = 0;
+
+      /// \brief Get the number of waves
+      /// \return Number of waves
+      public: virtual unsigned int WaveCount() const = 0;
+
+      /// \brief Set the layout of the rings of cells
+      /// \param[in] _cellSize Edge length of the cells of the innermost
+      /// ring in meters, 0.5 by default
+      /// \param[in] _cellsPerRing Number of cells along an edge of a ring,
+      /// a multiple of 4, 64 by default
+      /// \param[in] _ringCount Number of rings, 8 by default
+      public: virtual void SetGrid(double _cellSize,
+                  unsigned int _cellsPerRing, unsigned int _ringCount) = 0;
+
+      /// \brief Get the edge length of the cells of the innermost ring
+      /// \return Cell size in meters
+      public: virtual double CellSize() const = 0;
+
+      /// \brief Get the number of cells along an edge of a ring
+      /// \return Number of cells
+      public: virtual unsigned int CellsPerRing() const = 0;
+
+      /// \brief Get the number of rings
+      /// \return Number of rings
+      public: virtual unsigned int RingCount() const = 0;
+
+      /// \brief Get the edge length of the square covered by the surface,
+      /// i.e. of the outermost ring
+      /// \return Edge length in meters
+      public: virtual double Extent() const = 0;
+
+      /// \brief Set the center of the rings, usually the position of the
+      /// camera below which the surface has the most detail. The center is
+      /// snapped to twice the cell size of the innermost ring so that its
+      /// vertices do not slide over the waves as the center moves.
+      /// \param[in] _center Center in the frame of the visual
+      public: virtual void SetCenter(const math::Vector2d &_center) = 0;
+
+      /// \brief Get the center of the rings
+      /// \return Center in the frame of the visual, as set by SetCenter
+      public: virtual math::Vector2d Center() const = 0;
+
+      /// \brief Get the height of the surface at the time it was last
+      /// rendered, e.g. for buoyancy
+      /// \param[in] _position Position in the frame of the visual
+      /// \return Height of the surface above the position, in the frame of
+      /// the visual
+      public: virtual double Height(const math::Vector2d &_position)
+                  const = 0;
+
+      /// \brief Get the number of triangles drawn
+      /// \return Number of triangles
+      public: virtual unsigned int TriangleCount() const = 0;
+    };
+    }
+  }
+}
+#endif
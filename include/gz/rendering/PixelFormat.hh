@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_PIXELFORMAT_HH_
 #define GZ_RENDERING_PIXELFORMAT_HH_
 
+#include <cstdint>
 #include <string>
 #include "gz/rendering/config.hh"
 #include "gz/rendering/Export.hh"
@@ -57,8 +58,12 @@ namespace gz
       PF_L16          = 11,
       /// < RGBA, 1-byte per channel
       PF_R8G8B8A8     = 12,
+      /// < Float16 format, two channels
+      PF_FLOAT16_RG   = 13,
+      /// < Float16 format, one channel
+      PF_FLOAT16_R    = 14,
       /// < Number of pixel format types
-      PF_COUNT        = 13
+      PF_COUNT        = 15
     };
 
     /// \class PixelUtil PixelFormat.hh gz/rendering/PixelFormat.hh
@@ -117,6 +122,36 @@ namespace gz
       /// \return The specified PixelFormat enum value
       public: static PixelFormat Enum(const std::string &_name);
 
+      /// \brief Copy the first channel of _count float RGBA pixels into a
+      /// tightly packed single channel row, e.g. depth out of a
+      /// PF_FLOAT32_RGBA point cloud texture.
+      /// \param[in] _src Source row, 4 floats per pixel
+      /// \param[out] _dst Destination row, 1 float per pixel
+      /// \param[in] _count Number of pixels
+      public: static void PackFloat4ToFloat1(const float *_src, float *_dst,
+                  unsigned int _count);
+
+      /// \brief Drop the fourth channel of _count float RGBA pixels.
+      /// \param[in] _src Source row, 4 floats per pixel
+      /// \param[out] _dst Destination row, 3 floats per pixel
+      /// \param[in] _count Number of pixels
+      public: static void PackFloat4ToFloat3(const float *_src, float *_dst,
+                  unsigned int _count);
+
+      /// \brief Drop the alpha channel of _count 8 bit RGBA pixels.
+      /// \param[in] _src Source row, 4 bytes per pixel
+      /// \param[out] _dst Destination row, 3 bytes per pixel
+      /// \param[in] _count Number of pixels
+      public: static void PackRgba8ToRgb8(const uint8_t *_src, uint8_t *_dst,
+                  unsigned int _count);
+
+      /// \brief Zero extend _count 8 bit single channel pixels to 16 bit.
+      /// \param[in] _src Source row, 1 byte per pixel
+      /// \param[out] _dst Destination row, 2 bytes per pixel
+      /// \param[in] _count Number of pixels
+      public: static void WidenL8ToL16(const uint8_t *_src, uint16_t *_dst,
+                  unsigned int _count);
+
       /// \brief Array of human-readable names for each PixelFormat
       private: static const char *names[PF_COUNT];
 
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_POINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_POINTCLOUDVISUAL_HH_
+
+#include <gz/math/Color.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Visual.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Layouts of the points given to PointCloudVisual::SetPoints.
+    /// Every layout takes 16 bytes per point and starts with the x, y and z
+    /// coordinates as 32 bit floats.
+    enum GZ_RENDERING_VISIBLE PointCloudFormat
+    {
+      /// \brief PackedPoint, i.e. 8 bit red, green, blue and alpha channels
+      /// after the coordinates, as given by
+      /// DepthCamera::ConnectNewPackedPointCloud
+      PCF_PACKED_XYZRGBA = 0,
+
+      /// \brief Four 32 bit floats [X, Y, Z, RGBA], the color stored in the
+      /// bits of the last float, as given by
+      /// DepthCamera::ConnectNewRgbPointCloud
+      PCF_XYZRGBA_FLOAT32 = 1,
+
+      /// \brief Four 32 bit floats [X, Y, Z, I], the intensity mapped to a
+      /// color by PointCloudVisual::SetIntensityColors, as given by GpuRays
+      /// in the GROF_POINT_XYZI_FLOAT32 output format
+      PCF_XYZI_FLOAT32 = 2
+    };
+
+    /// \class PointCloudVisual PointCloudVisual.hh
+    /// gz/rendering/PointCloudVisual.hh
+    /// \brief A visual for large point clouds, e.g. maps or the output of
+    /// depth cameras and GPU rays.
+    ///
+    /// Points are kept on the GPU in the layout they are given in and
+    /// rendered as round screen-space splats. Points with non finite
+    /// coordinates, e.g. depth camera pixels without a return, are not
+    /// drawn. Clouds larger than MaxRenderedPointCount are decimated
+    /// uniformly.
+    class GZ_RENDERING_VISIBLE PointCloudVisual :
+      public virtual Visual
+    {
+      /// \brief Constructor
+      protected: PointCloudVisual();
+
+      /// \brief Destructor
+      public: virtual ~PointCloudVisual();
+
+      /// \brief Replace the points of the cloud. The points are copied, so
+      /// the buffer can be reused by the caller, and uploaded on the next
+      /// PreRender.
+      /// \param[in] _data Points, 16 bytes each, see PointCloudFormat
+      /// \param[in] _count Number of points in _data
+      /// \param[in] _format Layout of the points
+      public: virtual void SetPoints(const void *_data, unsigned int _count,
+                  PointCloudFormat _format) = 0;
+
+      /// \brief Remove all points
+      public: virtual void ClearPoints() = 0;
+
+      /// \brief Get the number of points, including the ones that are not
+      /// rendered
+      /// \return Number of points
+      public: virtual unsigned int PointCount() const = 0;
+
+      /// \brief Get the layout of the points
+      /// \return Layout of the points given to SetPoints
+      public: virtual PointCloudFormat Format() const = 0;
+
+      /// \brief Set the size of the points, in pixels, or in meters if size
+      /// attenuation is enabled
+      /// \param[in] _size Point size, 2 pixels by default
+      /// \sa SetSizeAttenuation
+      public: virtual void SetPointSize(double _size) = 0;
+
+      /// \brief Get the size of the points
+      /// \return Point size, in pixels or meters
+      /// \sa SetPointSize
+      public: virtual double PointSize() const = 0;
+
+      /// \brief Set whether points get smaller with distance. The size of
+      /// the points is then given in meters and converted to pixels with
+      /// the projection of the camera.
+      /// \param[in] _attenuation True to attenuate the size of the points
+      public: virtual void SetSizeAttenuation(bool _attenuation) = 0;
+
+      /// \brief Get whether points get smaller with distance
+      /// \return True if the size of the points is attenuated
+      public: virtual bool SizeAttenuation() const = 0;
+
+      /// \brief Set the maximum size of a point on screen, which limits the
+      /// size of attenuated points close to the camera
+      /// \param[in] _size Maximum point size in pixels, 64 by default
+      public: virtual void SetMaxPixelSize(double _size) = 0;
+
+      /// \brief Get the maximum size of a point on screen
+      /// \return Maximum point size in pixels
+      public: virtual double MaxPixelSize() const = 0;
+
+      /// \brief Set the intensities mapped to the low and high intensity
+      /// colors. Intensities outside the range are clamped. Only used for
+      /// PCF_XYZI_FLOAT32 points.
+      /// \param[in] _min Intensity of the low color, 0 by default
+      /// \param[in] _max Intensity of the high color, 1 by default
+      public: virtual void SetIntensityRange(double _min, double _max) = 0;
+
+      /// \brief Get the intensity mapped to the low intensity color
+      /// \return Minimum intensity
+      public: virtual double IntensityMin() const = 0;
+
+      /// \brief Get the intensity mapped to the high intensity color
+      /// \return Maximum intensity
+      public: virtual double IntensityMax() const = 0;
+
+      /// \brief Set the colors intensities are interpolated between. Only
+      /// used for PCF_XYZI_FLOAT32 points.
+      /// \param[in] _low Color of the minimum intensity, black by default
+      /// \param[in] _high Color of the maximum intensity, white by default
+      public: virtual void SetIntensityColors(const math::Color &_low,
+                  const math::Color &_high) = 0;
+
+      /// \brief Get the color of the minimum intensity
+      /// \return Low intensity color
+      public: virtual math::Color IntensityLowColor() const = 0;
+
+      /// \brief Get the color of the maximum intensity
+      /// \return High intensity color
+      public: virtual math::Color IntensityHighColor() const = 0;
+
+      /// \brief Set the maximum number of points rendered. Larger clouds
+      /// are decimated: an evenly spread subset of the points is drawn,
+      /// without uploading the points again.
+      /// \param[in] _count Maximum number of points, 0 for no limit.
+      /// 10,000,000 by default.
+      public: virtual void SetMaxRenderedPointCount(unsigned int _count) = 0;
+
+      /// \brief Get the maximum number of points rendered
+      /// \return Maximum number of points, 0 if there is no limit
+      public: virtual unsigned int MaxRenderedPointCount() const = 0;
+
+      /// \brief Get the number of points rendered after decimation
+      /// \return Number of rendered points
+      public: virtual unsigned int RenderedPointCount() const = 0;
+    };
+    }
+  }
+}
+#endif
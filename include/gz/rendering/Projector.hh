@@ -35,7 +35,14 @@ namespace gz
     /// \class Projector Projector.hh
     /// gz/rendering/Projector.hh
     //
-    /// \brief A projector that projects a texture onto a surface
+    /// \brief A projector that projects a texture onto a surface.
+    ///
+    /// In ogre2, projectors are decals shaded per cluster, see
+    /// LightClusterConfig::decalsPerCell, so many projectors cost little
+    /// more than one. The textures of all projectors of a scene share one
+    /// texture array, sized after the first texture loaded and at most
+    /// 1024 x 1024; other textures are rescaled to it. Projectors with the
+    /// same texture share its slice.
     class GZ_RENDERING_VISIBLE Projector :
       public virtual Visual
     {
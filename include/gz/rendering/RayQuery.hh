@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_RAYQUERY_HH_
 #define GZ_RENDERING_RAYQUERY_HH_
 
+#include <vector>
+
 #include <gz/utils/SuppressWarning.hh>
 #include <gz/math/Vector3.hh>
 
@@ -136,6 +138,22 @@ namespace gz
       /// \return A vector of intersection results
       public: virtual RayQueryResult ClosestPoint(
             bool _forceSceneUpdate = true) = 0;
+
+      /// \brief Compute the closest intersection of many rays at once.
+      /// This is much faster than calling ClosestPoint once per ray since
+      /// the scene is updated only once and the rays are distributed across
+      /// worker threads by render engines that support it.
+      /// The origin and direction set on this query are not used nor
+      /// changed.
+      /// \param[in] _origins Ray origins
+      /// \param[in] _directions Ray directions, one per origin
+      /// \param[in] _forceSceneUpdate See ClosestPoint
+      /// \return One intersection result per ray, in the same order as the
+      /// input. Empty if the number of origins and directions differ.
+      public: virtual std::vector<RayQueryResult> ClosestPoints(
+            const std::vector<math::Vector3d> &_origins,
+            const std::vector<math::Vector3d> &_directions,
+            bool _forceSceneUpdate = true) = 0;
     };
     }
   }
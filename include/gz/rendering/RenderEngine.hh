@@ -17,10 +17,15 @@
 #ifndef GZ_RENDERING_RENDERENGINE_HH_
 #define GZ_RENDERING_RENDERENGINE_HH_
 
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <string>
 #include "gz/rendering/config.hh"
+#include "gz/rendering/FrameBufferPool.hh"
+#include "gz/rendering/GpuMemoryStats.hh"
 #include "gz/rendering/GraphicsAPI.hh"
+#include "gz/rendering/LoadTrace.hh"
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/Export.hh"
 
@@ -36,6 +41,11 @@ namespace gz
     /// creating, storing, and destroying scenes.
     class GZ_RENDERING_VISIBLE RenderEngine
     {
+      /// \brief Callback function for GPU memory warnings
+      /// \sa SetMemoryWarning
+      public: typedef std::function<void(const GpuMemoryStats &)>
+          MemoryWarningCallback;
+
       /// \brief Destructor
       public: virtual ~RenderEngine();
 
@@ -196,8 +206,66 @@ namespace gz
       /// \param[in] _path Absolute path to resource location
       public: virtual void AddResourcePath(const std::string &_path) = 0;
 
+      /// \brief Set the maximum width and height of textures loaded by
+      /// materials. Larger textures are downscaled, keeping their aspect
+      /// ratio, before being uploaded to the GPU, which is equivalent to
+      /// dropping their highest mip levels. Only affects textures loaded
+      /// after this call. Can also be set by passing "textureMaxSize" = <n>
+      /// to Load.
+      /// \param[in] _size Maximum texture size in pixels, 0 for no limit
+      public: virtual void SetTextureMaxSize(unsigned int _size) = 0;
+
+      /// \brief Get the maximum width and height of textures loaded by
+      /// materials.
+      /// \return Maximum texture size in pixels, 0 if there is no limit
+      /// \sa SetTextureMaxSize
+      public: virtual unsigned int TextureMaxSize() const = 0;
+
+      /// \brief Get the amount of GPU memory currently used by textures,
+      /// including render targets and textures that are still streaming.
+      /// \return GPU texture memory in bytes, 0 if not supported by the
+      /// render engine
+      public: virtual size_t TextureMemoryUsage() const = 0;
+
+      /// \brief Get the GPU memory used by the render engine, by category
+      /// and by sensor and scene. The categories are derived from the
+      /// buffer and texture managers of the render engine, so they include
+      /// memory held by scenes that are not managed by gz-rendering.
+      /// \return GPU memory statistics, default constructed if not
+      /// supported by the render engine
+      public: virtual GpuMemoryStats MemoryStats() const = 0;
+
+      /// \brief Get notified when the GPU memory used by the render engine
+      /// exceeds a threshold. The usage is checked whenever a scene ends a
+      /// frame with Scene::PostRender, and the callback is called once each
+      /// time the total crosses the threshold, e.g. to release idle sensors
+      /// with Scene::ReleaseSensorRenderTextures.
+      /// \param[in] _threshold Total GPU memory in bytes, 0 to disable the
+      /// warning
+      /// \param[in] _callback Function called with the statistics that
+      /// exceeded the threshold, may be empty to only log a warning
+      public: virtual void SetMemoryWarning(size_t _threshold,
+                  MemoryWarningCallback _callback = nullptr) = 0;
+
+      /// \brief Get the GPU memory threshold of the memory warning
+      /// \return Threshold in bytes, 0 if the warning is disabled
+      /// \sa SetMemoryWarning
+      public: virtual size_t MemoryWarningThreshold() const = 0;
+
       /// \brief Get the render pass system for this engine.
       public: virtual RenderPassSystemPtr RenderPassSystem() const = 0;
+
+      /// \brief Get the pool that sensors of this engine lease their CPU
+      /// frame buffers from
+      /// \return Frame buffer pool of this engine
+      public: virtual FrameBufferPool &BufferPool() = 0;
+
+      /// \brief Get the trace that records where the startup and world
+      /// load time of this engine goes, see LoadTrace. Set the "loadTrace"
+      /// parameter of Load or the GZ_RENDERING_LOAD_TRACE environment
+      /// variable to a file path to record engine startup too.
+      /// \return Load trace of this engine
+      public: virtual LoadTrace &Trace() = 0;
     };
     }
   }
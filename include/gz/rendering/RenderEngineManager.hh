@@ -130,6 +130,23 @@ namespace gz
       /// \param[in] _index Index of the render-engine to unregister
       public: void UnregisterEngineAt(unsigned int _index);
 
+      /// \brief Set whether unloaded render-engines are recycled. A
+      /// recycled engine only destroys its scenes when it is unloaded and
+      /// keeps its context, compiled shaders, resources and mesh caches,
+      /// so the next Engine call returns it without loading and
+      /// initializing it again. This suits workers that run many short
+      /// jobs in one process. Recycled engines are reported as not loaded.
+      /// Requesting a recycled engine with different parameters than it
+      /// was loaded with reloads it. Disabling recycling destroys the
+      /// recycled engines. Disabled by default.
+      /// \param[in] _recycle True to recycle engines when they are unloaded
+      public: void SetRecycleEngines(bool _recycle);
+
+      /// \brief Get whether unloaded render-engines are recycled
+      /// \return True if engines are recycled
+      /// \sa SetRecycleEngines
+      public: bool RecycleEngines() const;
+
       /// \brief Set the plugin paths from which render engines can be loaded.
       /// \param[in] _paths The list of the plugin paths
       public: void SetPluginPaths(const std::list<std::string> &_paths);
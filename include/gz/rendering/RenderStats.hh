@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_RENDERSTATS_HH_
+#define GZ_RENDERING_RENDERSTATS_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Phases of a sensor update that are timed by RenderStats
+    enum GZ_RENDERING_VISIBLE SensorPhase
+    {
+      /// \brief Sensor::PreRender
+      SP_PRE_RENDER = 0,
+      /// \brief Camera::Render, including the GPU flush of the sensor's
+      /// own commands when the render engine performs one
+      SP_RENDER = 1,
+      /// \brief Camera::PostRender, i.e. data readback and listeners
+      SP_POST_RENDER = 2
+    };
+
+    /// \brief CPU timings of a single sensor
+    class GZ_RENDERING_VISIBLE SensorStats
+    {
+      /// \brief Duration of the last PreRender call
+      public: std::chrono::steady_clock::duration preRenderTime{0};
+
+      /// \brief Duration of the last Render call
+      public: std::chrono::steady_clock::duration renderTime{0};
+
+      /// \brief Duration of the last PostRender call
+      public: std::chrono::steady_clock::duration postRenderTime{0};
+
+      /// \brief Accumulated duration of all timed calls of the sensor since
+      /// the statistics were last reset
+      public: std::chrono::steady_clock::duration totalTime{0};
+
+      /// \brief Number of times the sensor was rendered since the
+      /// statistics were last reset
+      public: uint64_t renderCount = 0u;
+    };
+
+    /// \brief Counters of a diagnostic message. See DiagnosticLog.
+    class GZ_RENDERING_VISIBLE DiagnosticStats
+    {
+      /// \brief Number of times the diagnostic was raised since the
+      /// statistics were last reset
+      public: uint64_t count = 0u;
+
+      /// \brief Number of times the diagnostic was logged, the others were
+      /// suppressed by the rate limit
+      public: uint64_t logged = 0u;
+    };
+
+    /// \brief Rendering statistics of a scene. See Scene::Stats.
+    class GZ_RENDERING_VISIBLE RenderStats
+    {
+      /// \brief Number of frames, i.e. Scene::PostRender calls, since the
+      /// statistics were last reset
+      public: uint64_t frameCount = 0u;
+
+      /// \brief Duration of the GPU flush performed by the last
+      /// Scene::PostRender call
+      public: std::chrono::steady_clock::duration flushTime{0};
+
+      /// \brief Number of draw calls issued during the last frame
+      public: uint64_t drawCalls = 0u;
+
+      /// \brief Number of batches issued during the last frame
+      public: uint64_t batches = 0u;
+
+      /// \brief Number of instances drawn during the last frame
+      public: uint64_t instances = 0u;
+
+      /// \brief Number of triangles drawn during the last frame
+      public: uint64_t triangles = 0u;
+
+      /// \brief Number of vertices drawn during the last frame
+      public: uint64_t vertices = 0u;
+
+      /// \brief Number of lights in the scene during the last frame
+      public: uint64_t lights = 0u;
+
+      /// \brief Number of lights that were culled because they do not
+      /// reach the view of any camera during the last frame
+      public: uint64_t culledLights = 0u;
+
+      /// \brief Number of items tested for occlusion during the last
+      /// frame, summed over cameras. See Scene::SetOcclusionCulling.
+      public: uint64_t occlusionTested = 0u;
+
+      /// \brief Number of items that were not drawn because they were
+      /// occluded during the last frame, summed over cameras
+      public: uint64_t occlusionCulled = 0u;
+
+      /// \brief True if the last Scene::PreRender traversed the whole
+      /// scene graph. False if dirty tracking is enabled and only the
+      /// sensors and dirty objects were pre-rendered, see
+      /// Scene::SetPreRenderDirtyTracking.
+      public: bool preRenderFullTraversal = false;
+
+      /// \brief Ids of the objects, besides sensors, that the last
+      /// Scene::PreRender pre-rendered because they were marked dirty.
+      /// Empty after a full traversal.
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::vector<unsigned int> preRenderDirtyObjects;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief CPU timings of every sensor rendered since the statistics
+      /// were last reset, indexed by sensor name
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<std::string, SensorStats> sensors;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Counters of the diagnostics raised by the scene and its
+      /// objects since the statistics were last reset, indexed by key. See
+      /// Scene::Diagnostics.
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<std::string, DiagnosticStats> diagnostics;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
@@ -80,6 +80,24 @@ namespace gz
       /// \param[out] _image Image to which output will be written
       public: virtual void Copy(Image &_image) const = 0;
 
+      /// \brief Write a region of the rendered image to the given Image.
+      /// The region starts at the given pixel and has the size of the
+      /// image. Render engines that support it only download the region.
+      /// No work is done if the region does not fit in the render target.
+      /// \param[out] _image Image to which the region will be written
+      /// \param[in] _x Left column of the region
+      /// \param[in] _y Top row of the region
+      public: virtual void CopyRegion(Image &_image, unsigned int _x,
+                  unsigned int _y) const = 0;
+
+      /// \brief Write the rendered image, resized to the size of the given
+      /// Image, to the given Image. Render engines that support it resize
+      /// the image on the GPU and only download the resized image, others
+      /// download the full image and pick the nearest pixels.
+      /// \param[out] _image Image to which the resized image will be
+      /// written
+      public: virtual void CopyResized(Image &_image) const = 0;
+
       /// \brief Get the background color of the render target.
       /// This should be the same as the scene background color.
       /// \return Render target background color.
@@ -133,6 +151,17 @@ namespace gz
       /// id<MTLTexture> using CFBridgingRelease.
       /// \param[out] _textureIdPtr the address of a void* pointer.
       public: virtual void MetalId(void *_textureIdPtr) const = 0;
+
+      /// \brief Get a pointer to the texture contents in CUDA device memory.
+      /// A valid pointer is returned only if the render engine renders with
+      /// CUDA, e.g. optix, where it points to Width() * Height() RGB
+      /// float triplets in [0, 1]. It lets CUDA based consumers read the
+      /// rendered frames without copying them to host memory. The contents
+      /// are valid until the next render.
+      /// For OpenGL based engines, register GLId() with
+      /// cudaGraphicsGLRegisterImage instead.
+      /// \return Device pointer, null if not supported
+      public: virtual void *CudaDevicePointer() const = 0;
     };
 
     /* \class RenderWindow RenderWindow.hh \
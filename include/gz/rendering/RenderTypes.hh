@@ -50,6 +50,7 @@ namespace gz
     class AxisVisual;
     class BoundingBoxCamera;
     class Camera;
+    class CameraArray;
     class Capsule;
     class CiVctCascade;
     class COMVisual;
@@ -67,6 +68,7 @@ namespace gz
     class Heightmap;
     class Image;
     class InertiaVisual;
+    class InstancedVisualGroup;
     class LensFlarePass;
     class Light;
     class LightVisual;
@@ -80,7 +82,9 @@ namespace gz
     class Node;
     class Object;
     class ObjectFactory;
+    class OceanVisual;
     class ParticleEmitter;
+    class PointCloudVisual;
     class PointLight;
     class Projector;
     class RayQuery;
@@ -93,12 +97,14 @@ namespace gz
     class Scene;
     class SegmentationCamera;
     class Sensor;
+    class SensorGBuffer;
     class ShaderParams;
     class SpotLight;
     class SubMesh;
     class Text;
     class ThermalCamera;
     class Visual;
+    class VoxelGridVisual;
     class WideAngleCamera;
     class WireBox;
 
@@ -114,6 +120,10 @@ namespace gz
     /// \brief Shared pointer to Camera
     typedef shared_ptr<Camera> CameraPtr;
 
+    /// \typedef CameraArrayPtr
+    /// \brief Shared pointer to CameraArray
+    typedef shared_ptr<CameraArray> CameraArrayPtr;
+
     /// \typedef CiVctCascadePtr
     /// \brief Shared pointer to CiVctCascade
     typedef std::shared_ptr<CiVctCascade> CiVctCascadePtr;
@@ -218,6 +228,10 @@ namespace gz
     /// \brief Shared pointer to Mesh
     typedef shared_ptr<Mesh> MeshPtr;
 
+    /// \typedef InstancedVisualGroupPtr
+    /// \brief Shared pointer to InstancedVisualGroup
+    typedef shared_ptr<InstancedVisualGroup> InstancedVisualGroupPtr;
+
     /// \typedef NativeWindowPtr
     /// \brief Shared pointer to NativeWindow
     typedef shared_ptr<NativeWindow> NativeWindowPtr;
@@ -234,6 +248,10 @@ namespace gz
     /// \brief Shared pointer to ObjectFactory
     typedef shared_ptr<ObjectFactory> ObjectFactoryPtr;
 
+    /// \typedef OceanVisualPtr
+    /// \brief Shared pointer to OceanVisual
+    typedef shared_ptr<OceanVisual> OceanVisualPtr;
+
     /// \typedef ParticleEmitterPtr
     /// \brief Shared pointer to ParticleEmitter
     typedef shared_ptr<ParticleEmitter> ParticleEmitterPtr;
@@ -250,6 +268,10 @@ namespace gz
     /// \brief Shared pointer to GlobalIlluminationVct
     typedef shared_ptr<GlobalIlluminationVct> GlobalIlluminationVctPtr;
 
+    /// \typedef PointCloudVisualPtr
+    /// \brief Shared pointer to PointCloudVisual
+    typedef shared_ptr<PointCloudVisual> PointCloudVisualPtr;
+
     /// \typedef PointLightPtr
     /// \brief Shared pointer to PointLight
     typedef shared_ptr<PointLight> PointLightPtr;
@@ -289,6 +311,10 @@ namespace gz
     /// \brief Shared pointer to Sensor
     typedef shared_ptr<Sensor> SensorPtr;
 
+    /// \typedef SensorGBufferPtr
+    /// \brief Shared pointer to SensorGBuffer
+    typedef shared_ptr<SensorGBuffer> SensorGBufferPtr;
+
     /// \brief Shared pointer to ShaderParams
     typedef shared_ptr<ShaderParams> ShaderParamsPtr;
 
@@ -308,6 +334,10 @@ namespace gz
     /// \brief Shared pointer to Visual
     typedef shared_ptr<Visual> VisualPtr;
 
+    /// \typedef VoxelGridVisualPtr
+    /// \brief Shared pointer to VoxelGridVisual
+    typedef shared_ptr<VoxelGridVisual> VoxelGridVisualPtr;
+
     /// \typedef WireBoxPtr
     /// \brief Shared pointer to WireBox
     typedef shared_ptr<WireBox> WireBoxPtr;
@@ -324,6 +354,10 @@ namespace gz
     /// \brief Shared pointer to const Camera
     typedef shared_ptr<const Camera> ConstCameraPtr;
 
+    /// \typedef const CameraArrayPtr
+    /// \brief Shared pointer to const CameraArray
+    typedef shared_ptr<const CameraArray> ConstCameraArrayPtr;
+
     /// \typedef const DepthCameraPtr
     /// \brief Shared pointer to const DepthCamera
     typedef shared_ptr<const DepthCamera> ConstDepthCameraPtr;
@@ -404,10 +438,18 @@ namespace gz
     /// \brief Shared pointer to const ObjectFactory
     typedef shared_ptr<const ObjectFactory> ConstObjectFactoryPtr;
 
+    /// \typedef const OceanVisualPtr
+    /// \brief Shared pointer to const OceanVisual
+    typedef shared_ptr<const OceanVisual> ConstOceanVisualPtr;
+
     /// \typedef const ParticleEmitterPtr
     /// \brief Shared pointer to const ParticleEmitter
     typedef shared_ptr<const ParticleEmitter> ConstParticleEmitterPtr;
 
+    /// \typedef const PointCloudVisualPtr
+    /// \brief Shared pointer to const PointCloudVisual
+    typedef shared_ptr<const PointCloudVisual> ConstPointCloudVisualPtr;
+
     /// \typedef const PointLightPtr
     /// \brief Shared pointer to const PointLight
     typedef shared_ptr<const PointLight> ConstPointLightPtr;
@@ -466,6 +508,10 @@ namespace gz
     /// \typedef const VisualPtr
     /// \brief Shared pointer to const Visual
     typedef shared_ptr<const Visual> ConstVisualPtr;
+
+    /// \typedef const VoxelGridVisualPtr
+    /// \brief Shared pointer to const VoxelGridVisual
+    typedef shared_ptr<const VoxelGridVisual> ConstVoxelGridVisualPtr;
     }
   }
 }
@@ -18,21 +18,38 @@
 #define GZ_RENDERING_SCENE_HH_
 
 #include <array>
+#include <functional>
 #include <string>
 #include <limits>
+#include <set>
+#include <vector>
 
 #include <gz/common/Material.hh>
 #include <gz/common/Mesh.hh>
 
+#include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/Color.hh>
+#include <gz/math/Pose3.hh>
 
 #include "gz/rendering/base/SceneExt.hh"
 
 #include "gz/rendering/config.hh"
+#include "gz/rendering/DiagnosticLog.hh"
+#include "gz/rendering/FrameView.hh"
 #include "gz/rendering/HeightmapDescriptor.hh"
+#include "gz/rendering/LightClusterConfig.hh"
 #include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RenderStats.hh"
 #include "gz/rendering/RenderTypes.hh"
+#include "gz/rendering/SceneChangeTracker.hh"
+#include "gz/rendering/SceneCommandQueue.hh"
+#include "gz/rendering/SceneDebugDraw.hh"
+#include "gz/rendering/SceneMarkerPool.hh"
+#include "gz/rendering/SceneSnapshot.hh"
+#include "gz/rendering/SensorGBuffer.hh"
+#include "gz/rendering/ShadowConfig.hh"
 #include "gz/rendering/Storage.hh"
+#include "gz/rendering/VisualDescriptor.hh"
 #include "gz/rendering/Export.hh"
 
 namespace gz
@@ -418,6 +435,24 @@ namespace gz
       /// \return The desired node
       public: virtual VisualPtr VisualById(unsigned int _id) const = 0;
 
+      /// \brief Get the visual with the given compact id, see
+      /// Visual::CompactId. Unlike VisualById this is a plain array
+      /// lookup, meant for the per-object loops of render engines.
+      /// \param[in] _compactId Compact id of the desired visual
+      /// \return The desired visual, null if no visual has the compact id
+      public: virtual VisualPtr VisualByCompactId(uint32_t _compactId)
+                  const = 0;
+
+      /// \brief Get the world axis aligned bounding boxes of several
+      /// visuals at once, see Visual::BoundingBox. Render engines may cache
+      /// the boxes until the scene changes, which makes repeated queries
+      /// cheap.
+      /// \param[in] _visualIds Ids of the visuals
+      /// \return Bounding box of each visual in the order of _visualIds.
+      /// The box of an id that is not a visual of the scene is empty.
+      public: virtual std::vector<math::AxisAlignedBox> BoundingBoxes(
+                  const std::vector<unsigned int> &_visualIds) const = 0;
+
       /// \brief Get node with the given name. If no node exists with the given
       /// name, NULL will be returned.
       /// \param[in] _name Name of the desired node
@@ -463,6 +498,101 @@ namespace gz
       /// \brief Destroy all nodes manages by this scene.
       public: virtual void DestroyVisuals() = 0;
 
+      /// \brief Destroy many visuals at once. This is equivalent to calling
+      /// DestroyVisual on each visual, but visuals already destroyed as the
+      /// descendant of an earlier one are skipped.
+      /// \param[in] _visuals Visuals to destroy
+      /// \param[in] _recursive True to recursively destroy the visuals and
+      /// their children, false to destroy only the visuals and detach the
+      /// children
+      public: virtual void DestroyVisuals(
+                  const std::vector<VisualPtr> &_visuals,
+                  bool _recursive = false) = 0;
+
+      /// \brief Destroy a visual over the next frames, e.g. when streaming
+      /// out a world tile. The visual is hidden and detached from its
+      /// parent now, and PreRender destroys the queued nodes, children
+      /// first, until the destruction budget of the frame is used, see
+      /// SetDestructionBudget. The visual keeps its id and name until it
+      /// is destroyed.
+      /// \param[in] _visual Visual to destroy
+      /// \param[in] _recursive True to also destroy its descendants, false
+      /// to destroy only the visual and detach its children
+      public: virtual void DestroyVisualDeferred(VisualPtr _visual,
+                  bool _recursive = false) = 0;
+
+      /// \brief Set how long PreRender may spend destroying the nodes
+      /// queued by DestroyVisualDeferred each frame. At least one node is
+      /// destroyed per frame.
+      /// \param[in] _budget Time per frame, 2 ms by default
+      public: virtual void SetDestructionBudget(
+                  std::chrono::steady_clock::duration _budget) = 0;
+
+      /// \brief Get how long PreRender may spend destroying queued nodes
+      /// each frame
+      /// \return Time per frame
+      public: virtual std::chrono::steady_clock::duration
+                  DestructionBudget() const = 0;
+
+      /// \brief Get the number of nodes queued by DestroyVisualDeferred
+      /// that are not destroyed yet
+      /// \return Number of queued nodes
+      public: virtual unsigned int PendingDestructionCount() const = 0;
+
+      /// \brief Set the world poses of many visuals at once. This is
+      /// equivalent to calling Node::SetWorldPose on each visual, but
+      /// validates the input once and avoids recomputing the world pose of
+      /// shared parents. Unknown ids are skipped.
+      /// \param[in] _ids Ids of the visuals to move
+      /// \param[in] _poses New world poses, one per id
+      public: virtual void SetWorldPoses(const std::vector<unsigned int> &_ids,
+                  const std::vector<math::Pose3d> &_poses) = 0;
+
+      /// \brief Set the world poses of many visuals at once from flat
+      /// arrays, e.g. as written by a physics engine.
+      /// \param[in] _ids Ids of the visuals to move
+      /// \param[in] _positions World positions as x, y, z triplets, three
+      /// values per id
+      /// \param[in] _rotations World rotations as w, x, y, z quaternions,
+      /// four values per id
+      /// \sa SetWorldPoses(const std::vector<unsigned int> &,
+      /// const std::vector<math::Pose3d> &)
+      public: virtual void SetWorldPoses(const std::vector<unsigned int> &_ids,
+                  const std::vector<float> &_positions,
+                  const std::vector<float> &_rotations) = 0;
+
+      /// \brief Stage the world pose of a visual in the scene's back
+      /// buffer. Staged poses do not change the scene: they are published
+      /// as a whole by PublishState and applied by SwapState. This lets a
+      /// simulation thread write the poses of step N+1 while the render
+      /// thread is still rendering step N. Safe to call from any thread.
+      /// Staging the same visual again in a step keeps the latest pose.
+      /// \param[in] _id Id of the visual to move
+      /// \param[in] _pose New world pose
+      public: virtual void StageWorldPose(unsigned int _id,
+                  const math::Pose3d &_pose) = 0;
+
+      /// \brief Stage the world poses of many visuals, see StageWorldPose
+      /// \param[in] _ids Ids of the visuals to move
+      /// \param[in] _poses New world poses, one per id
+      public: virtual void StageWorldPoses(
+                  const std::vector<unsigned int> &_ids,
+                  const std::vector<math::Pose3d> &_poses) = 0;
+
+      /// \brief Publish the poses staged since the last call as a complete
+      /// state, e.g. at the end of a simulation step. Safe to call from
+      /// any thread. States published before the render thread called
+      /// SwapState are merged, later poses win.
+      public: virtual void PublishState() = 0;
+
+      /// \brief Apply the published state to the scene. Call on the render
+      /// thread before PreRender. Poses are applied with SetWorldPoses in
+      /// the order they were first staged, so stage parents before their
+      /// children. Poses staged but not published yet are not applied, so
+      /// every rendered frame sees the poses of whole simulation steps.
+      /// \return True if a new state was applied
+      public: virtual bool SwapState() = 0;
+
       /// \brief Determine if a material is registered under the given name
       /// \param[in] _name Name of the material in question
       /// \return True if a material is registered under the given name
@@ -759,6 +889,35 @@ namespace gz
       public: virtual WideAngleCameraPtr CreateWideAngleCamera(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create new camera array. A unique ID and name will
+      /// automatically be assigned to the camera array.
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray() = 0;
+
+      /// \brief Create new camera array with the given ID.
+      /// A unique name will automatically be assigned to the camera array.
+      /// If the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  unsigned int _id) = 0;
+
+      /// \brief Create new camera array with the given name.
+      /// A unique ID will automatically be assigned to the camera array.
+      /// If the given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new camera array with the given name and ID. If
+      /// either the given ID or name is already in use, will return NULL.
+      /// \param[in] _id ID of the new camera array
+      /// \param[in] _name Name of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  unsigned int _id, const std::string &_name) = 0;
+
       /// \brief Create new gpu rays caster. A unique ID and name will
       /// automatically be assigned to the gpu rays caster.
       /// \return The created gpu rays caster
@@ -816,6 +975,17 @@ namespace gz
       public: virtual VisualPtr CreateVisual(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create many visuals at once, e.g. when building a world.
+      /// This is equivalent to calling CreateVisual, CreateMesh,
+      /// Visual::AddGeometry, Visual::SetMaterial and Node::AddChild for
+      /// each descriptor, but generates names and looks up the root visual
+      /// once. Materials are shared rather than cloned.
+      /// \param[in] _descs Descriptors of the visuals
+      /// \return The created visuals, one per descriptor, null for the
+      /// visuals that could not be created, e.g. if their name is in use
+      public: virtual std::vector<VisualPtr> CreateVisuals(
+                  const std::vector<VisualDescriptor> &_descs) = 0;
+
       /// \brief Create new arrow visual. A unique ID and name will
       /// automatically be assigned to the visual.
       /// \return The created arrow visual
@@ -1067,6 +1237,38 @@ namespace gz
       /// \return The created mesh
       public: virtual MeshPtr CreateMesh(const MeshDescriptor &_desc) = 0;
 
+      /// \brief Convert meshes for rendering ahead of their creation, so
+      /// that the later CreateMesh calls with the same descriptors only
+      /// create the mesh objects. Render engines that support it prepare
+      /// the vertex and index data of the meshes on worker threads and
+      /// then upload them to the GPU, which lets world load time scale
+      /// with the number of cores rather than the number of meshes.
+      /// \remarks Render engines that do not support preloading convert
+      /// meshes in CreateMesh as usual. ogre2 does.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _descs Descriptors of the meshes to load
+      public: virtual void PreloadMeshes(
+                  const std::vector<MeshDescriptor> &_descs) = 0;
+
+      /// \brief Create a group of many copies of the same mesh. The
+      /// instances share their mesh and material so that they can be
+      /// batched into few draw calls. Add the group's Visual() to the scene
+      /// graph to show it.
+      /// \param[in] _desc Descriptor of the mesh every instance renders
+      /// \param[in] _material Material shared by all instances, a new
+      /// material is created if null
+      /// \return The created instanced visual group
+      public: virtual InstancedVisualGroupPtr CreateInstancedVisualGroup(
+                  const MeshDescriptor &_desc, MaterialPtr _material) = 0;
+
+      /// \brief Create co-located sensor outputs that are rendered together
+      /// with as few scene renders as possible, see SensorGBuffer. Add the
+      /// sensor's Visual() to the scene graph to place it.
+      /// \param[in] _outputs Outputs to render
+      /// \return The created sensor
+      public: virtual SensorGBufferPtr CreateSensorGBuffer(
+                  const std::set<GBufferOutput> &_outputs) = 0;
+
       /// \brief Create new grid geometry.
       /// \return The created grid
       public: virtual GridPtr CreateGrid() = 0;
@@ -1107,6 +1309,96 @@ namespace gz
       public: virtual LidarVisualPtr CreateLidarVisual(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create new point cloud visual. A unique ID and name will
+      /// automatically be assigned to the point cloud visual.
+      /// \return The created point cloud visual, null if the render engine
+      /// does not support point cloud visuals
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual() = 0;
+
+      /// \brief Create new point cloud visual with the given ID. A unique
+      /// name will automatically be assigned to the point cloud visual. If
+      /// the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new point cloud visual
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id) = 0;
+
+      /// \brief Create new point cloud visual with the given name. A unique
+      /// ID will automatically be assigned to the point cloud visual. If the
+      /// given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new point cloud visual
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new point cloud visual with the given name. If either
+      /// the given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the point cloud visual.
+      /// \param[in] _name Name of the new point cloud visual.
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id, const std::string &_name) = 0;
+
+      /// \brief Create new voxel grid visual. A unique ID and name will
+      /// automatically be assigned to the voxel grid visual.
+      /// \return The created voxel grid visual, null if the render engine
+      /// does not support voxel grid visuals
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual() = 0;
+
+      /// \brief Create new voxel grid visual with the given ID. A unique
+      /// name will automatically be assigned to the voxel grid visual. If
+      /// the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new voxel grid visual
+      /// \return The created voxel grid visual
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  unsigned int _id) = 0;
+
+      /// \brief Create new voxel grid visual with the given name. A unique
+      /// ID will automatically be assigned to the voxel grid visual. If the
+      /// given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new voxel grid visual
+      /// \return The created voxel grid visual
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new voxel grid visual with the given name. If either
+      /// the given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the voxel grid visual.
+      /// \param[in] _name Name of the new voxel grid visual.
+      /// \return The created voxel grid visual
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  unsigned int _id, const std::string &_name) = 0;
+
+      /// \brief Create new ocean visual. A unique ID and name will
+      /// automatically be assigned to the ocean visual.
+      /// \return The created ocean visual, null if the render engine
+      /// does not support ocean visuals
+      public: virtual OceanVisualPtr CreateOceanVisual() = 0;
+
+      /// \brief Create new ocean visual with the given ID. A unique
+      /// name will automatically be assigned to the ocean visual. If
+      /// the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new ocean visual
+      /// \return The created ocean visual
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  unsigned int _id) = 0;
+
+      /// \brief Create new ocean visual with the given name. A unique
+      /// ID will automatically be assigned to the ocean visual. If the
+      /// given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new ocean visual
+      /// \return The created ocean visual
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new ocean visual with the given name. If either
+      /// the given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the ocean visual.
+      /// \param[in] _name Name of the new ocean visual.
+      /// \return The created ocean visual
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  unsigned int _id, const std::string &_name) = 0;
+
       /// \brief Create new heightmap geomerty. The rendering::Heightmap will be
       /// created from the given HeightmapDescriptor.
       /// \param[in] _desc Data about the heightmap
@@ -1270,15 +1562,166 @@ namespace gz
       /// \return true to sky is enabled, false otherwise
       public: virtual bool SkyEnabled() const = 0;
 
+      /// \brief Enable streaming of textures loaded from file. When enabled,
+      /// setting a texture map on a material returns immediately and the
+      /// texture is decoded and uploaded in the background. Until then the
+      /// material is rendered with a blank texture, i.e. its flat colors.
+      /// Rendering does not wait for textures to finish loading, so frames
+      /// rendered while PendingTextureLoads() > 0 may differ from later
+      /// ones. Disabled by default.
+      /// \param[in] _enabled True to stream textures in the background
+      public: virtual void SetTextureStreamingEnabled(bool _enabled) = 0;
+
+      /// \brief Get whether textures are streamed in the background
+      /// \return True if texture streaming is enabled
+      /// \sa SetTextureStreamingEnabled
+      public: virtual bool TextureStreamingEnabled() const = 0;
+
+      /// \brief Get the number of material textures that are still being
+      /// streamed in the background.
+      /// \return Number of pending texture loads, 0 when all textures are
+      /// ready or texture streaming is disabled.
+      /// \sa SetTextureStreamingEnabled
+      public: virtual unsigned int PendingTextureLoads() const = 0;
+
+      /// \brief Enable or disable sharing of render engine material
+      /// resources. When enabled, materials with identical properties that
+      /// are assigned to meshes use the same underlying render engine
+      /// material, which reduces state changes and draw call overhead in
+      /// scenes with many copies of the same material. A material gets its
+      /// own copy again as soon as it is modified, so sharing does not
+      /// change how materials behave. Disabling sharing does not split
+      /// materials that are already shared. Disabled by default.
+      /// \param[in] _enabled True to share identical materials
+      public: virtual void SetMaterialSharingEnabled(bool _enabled) = 0;
+
+      /// \brief Get whether identical materials share render engine
+      /// resources
+      /// \return True if material sharing is enabled
+      /// \sa SetMaterialSharingEnabled
+      public: virtual bool MaterialSharingEnabled() const = 0;
+
+      /// \brief Enable or disable batching of text. When enabled, the texts
+      /// of the scene that use the same font and the same ShowOnTop setting
+      /// are drawn together with a single draw call from the glyph atlas of
+      /// the font, instead of one draw call per text. This reduces the
+      /// overhead of scenes with many labels. Disabled by default.
+      /// \param[in] _enabled True to batch texts
+      public: virtual void SetTextBatchingEnabled(bool _enabled) = 0;
+
+      /// \brief Get whether texts are batched
+      /// \return True if text batching is enabled
+      /// \sa SetTextBatchingEnabled
+      public: virtual bool TextBatchingEnabled() const = 0;
+
+      /// \brief Set the origin that the scene is rendered relative to.
+      /// Render engines store positions in single precision, so objects far
+      /// away from the world origin jitter and lose accuracy. The nodes
+      /// attached to the root visual are positioned relative to the render
+      /// origin in double precision before they are handed to the render
+      /// engine, while the poses reported by the nodes, cameras and ray
+      /// queries stay in world coordinates. Setting the render origin to the
+      /// position of the main camera every frame gives camera relative
+      /// rendering without rebasing the nodes in user code.
+      /// \param[in] _origin Render origin in world coordinates
+      public: virtual void SetRenderOrigin(const math::Vector3d &_origin) = 0;
+
+      /// \brief Get the origin that the scene is rendered relative to
+      /// \return Render origin in world coordinates
+      /// \sa SetRenderOrigin
+      public: virtual math::Vector3d RenderOrigin() const = 0;
+
+      /// \brief Get the params shared by the custom shaders of all the
+      /// materials of the scene, see Material::SetVertexShader. They are
+      /// bound once per frame instead of once per material, which suits
+      /// values such as the wind of thousands of wave tiles. A custom shader
+      /// uses a shared param by declaring a uniform with the same name.
+      /// Floats, ints and their buffers are supported; buffers whose size
+      /// is a multiple of 4 map to arrays of vec4 / ivec4.
+      ///
+      /// The following uniforms are provided by the render engine and must
+      /// not be set through the shared params:
+      /// * gz_sim_time: float, scene time in seconds, see SetTime
+      /// * gz_delta_time: float, scene time since the previous frame
+      /// * gz_view, gz_proj, gz_view_proj: mat4, matrices of the camera
+      ///   being rendered
+      /// * gz_camera_position: vec4, world position of that camera
+      /// \return Shared params, null if the render engine does not support
+      /// them
+      public: virtual ShaderParamsPtr SharedShaderParams() const = 0;
+
       /// \brief Sets the given GI as the current new active GI solution
       /// \param[in] _gi GI solution that should be active. Nullptr to disable
       public: virtual void SetActiveGlobalIllumination(
                 GlobalIlluminationBasePtr _gi) = 0;
 
       /// \brief Prepare scene for rendering. The scene will flushing any scene
-      /// changes by traversing scene-graph, calling PreRender on all objects
+      /// changes by traversing scene-graph, calling PreRender on all objects.
+      /// The commands of CommandQueue are applied first, then the expired
+      /// markers of MarkerPool are retired and the shapes of DebugDraw are
+      /// uploaded.
+      /// \sa SetPreRenderDirtyTracking
       public: virtual void PreRender() = 0;
 
+      /// \brief Enable or disable dirty tracking for PreRender. When
+      /// enabled, PreRender no longer traverses the whole scene graph.
+      /// Instead it calls PreRender on all sensors and on the objects that
+      /// were marked with SetPreRenderDirty since the last PreRender, e.g.
+      /// visuals that were added to the scene graph or changed material and
+      /// markers, text or grids that changed. The first PreRender after
+      /// enabling dirty tracking still performs a full traversal.
+      /// Disabled by default. Not all render engines support this.
+      /// \param[in] _enabled True to enable dirty tracking
+      public: virtual void SetPreRenderDirtyTracking(bool _enabled) = 0;
+
+      /// \brief Get whether dirty tracking for PreRender is enabled
+      /// \return True if dirty tracking is enabled
+      /// \sa SetPreRenderDirtyTracking
+      public: virtual bool PreRenderDirtyTracking() const = 0;
+
+      /// \brief Mark an object as needing PreRender on the next call to
+      /// PreRender. Only used when dirty tracking is enabled; objects mark
+      /// themselves when they change, so this is only needed for custom
+      /// objects that require an update.
+      /// \param[in] _object Object to pre-render
+      /// \sa SetPreRenderDirtyTracking
+      public: virtual void SetPreRenderDirty(ObjectPtr _object) = 0;
+
+      /// \brief Get the queue that other threads, e.g. physics, GUI or ROS
+      /// callbacks, use to change the scene without locking. The queued
+      /// commands are applied at the start of the next PreRender.
+      /// \return Command queue of the scene. It is safe to use from any
+      /// thread for as long as the scene exists.
+      public: virtual SceneCommandQueue &CommandQueue() = 0;
+
+      /// \brief Get the immediate mode drawing of transient debug
+      /// geometry. The shapes drawn since the previous frame are shown
+      /// from the next PreRender on, until the PreRender after it.
+      /// \return Debug draw of the scene. Must only be used on the render
+      /// thread.
+      public: virtual SceneDebugDraw &DebugDraw() = 0;
+
+      /// \brief Get the pool of markers that are retired when their
+      /// lifetime ends, measured in scene time.
+      /// \return Marker pool of the scene. Must only be used on the render
+      /// thread.
+      public: virtual SceneMarkerPool &MarkerPool() = 0;
+
+      /// \brief Get the rate limiter of the diagnostics that the scene and
+      /// its objects raise every frame, e.g. a lidar visual without data.
+      /// The counters of each diagnostic are reported by Stats and reset
+      /// by ResetStats, which keeps diagnostics that were logged rate
+      /// limited, see DiagnosticLog::Reset.
+      /// \return Diagnostic log of the scene, thread safe
+      public: virtual DiagnosticLog &Diagnostics() = 0;
+
+      /// \brief Get the record of where the scene changed, used by cameras
+      /// that skip unchanged frames. It is enabled by the first camera that
+      /// does, see Camera::SetSkipUnchangedFrames.
+      /// \return Change tracker of the scene. Must only be used on the
+      /// render thread.
+      public: virtual SceneChangeTracker &ChangeTracker() = 0;
+
       /// \brief Call this function after you're done updating ALL cameras
       /// \remark Each PreRender must have a correspondent PostRender
       /// \remark Particle FX simulation is moved forward after this call
@@ -1393,6 +1836,244 @@ namespace gz
       /// SetCameraPassCountPerGpuFlush
       public: virtual bool LegacyAutoGpuFlush() const = 0;
 
+      /// \brief Render a batch of sensors in a single frame. This is
+      /// equivalent to the ideal render loop described in
+      /// SetCameraPassCountPerGpuFlush, i.e. PreRender, Render on every
+      /// sensor, PostRender on every sensor, then PostRender, except that
+      /// render engines may submit the work of all sensors to the GPU at
+      /// once before any data is read back. Sensors that are not cameras,
+      /// do not belong to this scene or are idle (see
+      /// Sensor::SetDemandDriven) are skipped.
+      ///
+      /// This is the preferred way to render camera rigs, e.g. stereo pairs
+      /// or surround view arrays: the scene graph is traversed and updated
+      /// once for the whole rig and all readbacks happen after the GPU has
+      /// received the work of every camera. Culling and draw command
+      /// generation still run once per camera.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _sensors Sensors to render
+      public: virtual void RenderSensors(
+                  const std::vector<SensorPtr> &_sensors) = 0;
+
+      /// \brief Callback of RenderCameraAtlas
+      /// \param[in] _index Index of the camera in the list passed to
+      /// RenderCameraAtlas
+      /// \param[in] _view Image of the camera, only valid during the call
+      public: typedef std::function<void(unsigned int _index,
+                  const FrameView &_view)> CameraAtlasCallback;
+
+      /// \brief Render many small cameras and download all their images
+      /// in one transfer. The cameras are rendered like RenderSensors does,
+      /// then render engines that support it pack their images as tiles of
+      /// a single atlas texture on the GPU and read back the atlas at once,
+      /// which removes the fixed cost of one readback per camera that
+      /// dominates with hundreds of low resolution cameras, e.g. in swarm
+      /// simulations. Other render engines read back the cameras one by
+      /// one. The callback receives a view of each camera's tile, whose
+      /// rows are as long as those of the atlas, so always step between
+      /// rows with FrameView::rowPitch. The pixel format of the view is the
+      /// one of the render engine's texture, e.g. PF_R8G8B8A8, which can
+      /// differ from the camera's image format.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _cameras Cameras to render
+      /// \param[in] _callback Called for every camera that was rendered
+      public: virtual void RenderCameraAtlas(
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) = 0;
+
+      /// \brief Render many isolated copies of an environment held by one
+      /// scene, e.g. the parallel environments of reinforcement learning.
+      /// Each environment is the subtree of a visual, the copies can
+      /// overlap in space and share their meshes and materials. Camera i
+      /// sees environment i and every object that is not part of an
+      /// environment, such as lights, but no other environment. Hidden
+      /// environments stay hidden. The cameras are rendered and read back
+      /// like RenderCameraAtlas does, so render engines that support it
+      /// submit all cameras at once and download all images in one
+      /// transfer. The visibility of the environment visuals is restored
+      /// afterwards.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _environments Root visual of every environment
+      /// \param[in] _cameras Camera of every environment, as many as there
+      /// are environments
+      /// \param[in] _callback Called for every camera that was rendered,
+      /// with the index of its environment
+      public: virtual void RenderEnvironments(
+                  const std::vector<VisualPtr> &_environments,
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) = 0;
+
+      /// \brief Compile the shaders needed to render the current scene
+      /// ahead of time. Render engines that compile shader permutations on
+      /// first use, e.g. when a sensor switches to a special rendering mode
+      /// such as thermal or segmentation, stall the first frame in which
+      /// new permutations appear. Call this once the scene and its sensors
+      /// have been created, and again after adding many new objects, to
+      /// move that cost out of the render loop. Sensors do not read back
+      /// data or notify their listeners during the warm-up.
+      /// \remark Only objects visible to at least one sensor are warmed up
+      /// \remark Must not be called between PreRender and PostRender
+      public: virtual void WarmUpShaders() = 0;
+
+      /// \brief Set how long sensors may go without being rendered before
+      /// their render textures are released, see
+      /// Sensor::ReleaseRenderTextures. The idle time is measured in scene
+      /// time, see SetTime, and checked when PostRender ends a frame.
+      /// Scenes with many sensors that are rarely updated, e.g. demand
+      /// driven sensors, keep only the textures of the active ones.
+      /// \param[in] _time Idle time after which the textures are released,
+      /// zero to keep them until the sensors are destroyed (default)
+      public: virtual void SetSensorReleaseTime(
+                  std::chrono::steady_clock::duration _time) = 0;
+
+      /// \brief Get how long sensors may go without being rendered before
+      /// their render textures are released
+      /// \return Idle time, zero if textures are never released
+      public: virtual std::chrono::steady_clock::duration
+                  SensorReleaseTime() const = 0;
+
+      /// \brief Release the render textures of all sensors that were not
+      /// rendered for at least the given scene time. Meant to be called by
+      /// the application when the GPU runs low on memory, e.g. from the
+      /// memory pressure callback of its allocator or job scheduler. The
+      /// released sensors allocate their textures again when they are next
+      /// rendered.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _idleTime Minimum time since the sensors were last
+      /// rendered, zero to release all sensors
+      /// \return Number of sensors whose textures were released
+      public: virtual unsigned int ReleaseSensorRenderTextures(
+                  std::chrono::steady_clock::duration _idleTime =
+                  std::chrono::steady_clock::duration::zero()) = 0;
+
+      /// \brief Get the rendering statistics of the scene: CPU timings of
+      /// the PreRender, Render and PostRender calls of every sensor, the
+      /// duration of the GPU flush and the draw call, batch, instance,
+      /// triangle and vertex counters of the last frame. A frame ends when
+      /// PostRender is called.
+      /// \remarks Render engines that do not collect statistics return
+      /// default constructed values. ogre2 does.
+      /// \return Rendering statistics
+      public: virtual RenderStats Stats() const = 0;
+
+      /// \brief Reset the rendering statistics returned by Stats
+      public: virtual void ResetStats() = 0;
+
+      /// \brief Configure clustered forward lighting. Scenes with many
+      /// point and spot lights render faster with more tiles and slices
+      /// that tightly cover the range the lights are in, and a
+      /// lightsPerCell budget matching the number of lights overlapping
+      /// at any point. Changing the configuration recompiles the shaders.
+      /// \remarks Render engines that do not cluster lights ignore the
+      /// configuration. ogre2 does.
+      /// \param[in] _config Clustering configuration
+      /// \return True if the configuration is valid and was applied
+      public: virtual bool SetLightClustering(
+                  const LightClusterConfig &_config) = 0;
+
+      /// \brief Get the clustered forward lighting configuration
+      /// \return Clustering configuration
+      public: virtual LightClusterConfig LightClustering() const = 0;
+
+      /// \brief Configure the resolution and budget of shadow maps and how
+      /// often cameras re-render them. Shadow passes are a large part of
+      /// the frame cost of scenes with several shadow casting lights;
+      /// lowering the update rate or reusing shadows while the scene is
+      /// static saves most of it.
+      /// \remarks Render engines that do not render shadow maps ignore the
+      /// settings. ogre2 applies them to cameras; depth cameras and GPU
+      /// rays do not render shadows.
+      /// \param[in] _config Shadow settings
+      /// \return True if the settings are valid and were applied
+      public: virtual bool SetShadowSettings(const ShadowConfig &_config) = 0;
+
+      /// \brief Get the shadow settings
+      /// \return Shadow settings
+      public: virtual ShadowConfig ShadowSettings() const = 0;
+
+      /// \brief Enable occlusion culling. Before a camera renders, the
+      /// opaque box geometries in its view, e.g. walls and floors, are
+      /// rasterized into a coarse hierarchical depth buffer and the items
+      /// fully hidden behind them are not drawn. The test is conservative:
+      /// items partially in view are always drawn. Shadow maps still
+      /// include the culled items. Indoor scenes with many items behind
+      /// walls draw far fewer batches; open scenes only pay the cost of
+      /// the test. See RenderStats::occlusionCulled.
+      /// \remarks Render engines that do not support occlusion culling
+      /// ignore the flag. ogre2 culls for cameras and depth cameras.
+      /// \param[in] _enabled True to enable occlusion culling. Disabled
+      /// by default.
+      public: virtual void SetOcclusionCulling(bool _enabled) = 0;
+
+      /// \brief Get whether occlusion culling is enabled
+      /// \return True if occlusion culling is enabled
+      public: virtual bool OcclusionCulling() const = 0;
+
+      /// \brief Merge the meshes of static visuals that share a material
+      /// into combined meshes, so that static worlds with many small
+      /// meshes, e.g. furniture and clutter, are drawn with a few large
+      /// batches. Vertices are baked in world frame. The batched visuals
+      /// keep their ids: segmentation, bounding box, thermal and selection
+      /// sensors as well as ray queries still see the original visuals.
+      /// Calling this again rebakes the scene.
+      /// \remarks Only visible mesh geometries of visuals marked static
+      /// (see Node::SetStatic) are baked, skinned meshes are skipped.
+      /// Baked visuals must not be moved, hidden or given new materials
+      /// until UnbakeStaticVisuals is called. Render engines that do not
+      /// support batching do nothing. ogre2 does.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \return Number of batches created
+      public: virtual unsigned int BakeStaticVisuals() = 0;
+
+      /// \brief Remove the batches created by BakeStaticVisuals and draw
+      /// the static visuals individually again
+      public: virtual void UnbakeStaticVisuals() = 0;
+
+      /// \brief Capture the local pose and scale, user data and, for
+      /// visuals, the visibility and material of every node in the scene.
+      /// Together with Restore this resets a scene between episodes
+      /// without destroying and recreating it, which keeps GPU resources,
+      /// compositor workspaces and materials alive.
+      /// \return Snapshot of the scene's nodes
+      public: virtual SceneSnapshot Snapshot() const = 0;
+
+      /// \brief Restore the state captured by Snapshot. Only the
+      /// properties that changed since the snapshot are applied. Nodes
+      /// that were destroyed since are skipped and nodes created since are
+      /// left untouched. User data added since is kept.
+      /// \remark Materials referenced by the snapshot must not be
+      /// destroyed while the snapshot is in use.
+      /// \param[in] _snapshot Snapshot of this scene
+      public: virtual void Restore(const SceneSnapshot &_snapshot) = 0;
+
+      /// \brief Save the visuals of the scene to a binary file that
+      /// LoadSnapshot recreates them from, so that large worlds are built
+      /// once from their description and then reloaded in bulk. The file
+      /// holds the hierarchy of visuals below the root visual with their
+      /// local poses and scales, visibility, user data, mesh and capsule
+      /// geometries and the parameters of their materials. Meshes are
+      /// referenced by name, i.e. their file path, so they are loaded
+      /// from the render engine's mesh cache where it has one, see
+      /// Ogre2RenderEngine::MeshCachePath. The file consists of fixed
+      /// size records in native byte order and can be memory mapped.
+      /// \remarks Lights, sensors and the visuals attached to them are not
+      /// saved, nor are geometries other than meshes and capsules, e.g.
+      /// markers, text or heightmaps.
+      /// \param[in] _path Path of the file to write
+      /// \return True if the file was written
+      public: virtual bool SaveSnapshot(const std::string &_path) const = 0;
+
+      /// \brief Recreate the visuals saved by SaveSnapshot below the root
+      /// visual of this scene. Meshes are loaded together with
+      /// PreloadMeshes before the visuals are created.
+      /// \remarks Visuals whose name is already in use in this scene are
+      /// given a generated name. Materials are created anew.
+      /// \remark Must not be called between PreRender and PostRender
+      /// \param[in] _path Path of the file to read
+      /// \return True if the file is a valid snapshot and its visuals
+      /// were created
+      public: virtual bool LoadSnapshot(const std::string &_path) = 0;
+
       /// \brief Remove and destroy all objects from the scene graph. This does
       /// not completely destroy scene resources, so new objects can be created
       /// and added to the scene afterwards.
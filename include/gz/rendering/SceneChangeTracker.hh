@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SCENECHANGETRACKER_HH_
+#define GZ_RENDERING_SCENECHANGETRACKER_HH_
+
+#include <cstdint>
+#include <memory>
+
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Frustum.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class SceneChangeTrackerPrivate;
+
+    /// \class SceneChangeTracker SceneChangeTracker.hh
+    /// gz/rendering/SceneChangeTracker.hh
+    /// \brief Records where the scene changed, so cameras that look at a
+    /// static part of the scene can skip rendering frames that would not
+    /// differ from their last one, see Camera::SetSkipUnchangedFrames.
+    ///
+    /// Each change gets a sequence number, see ChangeCount, and the world
+    /// box it affects. Nodes record their own changes: a visual records its
+    /// bounding box before and after its pose, scale, visibility, material
+    /// or geometries change, or it is attached, detached or destroyed.
+    /// Changes of other nodes, e.g. lights, affect the whole scene. Changes
+    /// that nodes cannot see, e.g. material parameters edited in place,
+    /// animations, particles or light colors, must be recorded with
+    /// MarkChanged.
+    ///
+    /// Disabled by default, in which case nothing is recorded. Must be used
+    /// on the render thread. See Scene::ChangeTracker.
+    class GZ_RENDERING_VISIBLE SceneChangeTracker
+    {
+      /// \brief Constructor
+      public: SceneChangeTracker();
+
+      /// \brief Destructor
+      public: virtual ~SceneChangeTracker();
+
+      /// \brief Enable or disable recording changes. Enabling it records a
+      /// change of the whole scene, since earlier changes are unknown.
+      /// \param[in] _enabled True to record changes
+      public: void SetEnabled(bool _enabled);
+
+      /// \brief Get whether changes are recorded
+      /// \return True if changes are recorded, false by default
+      public: bool Enabled() const;
+
+      /// \brief Record a change of the whole scene
+      public: void MarkChanged();
+
+      /// \brief Record a change of a region of the scene
+      /// \param[in] _box World box of the region, a change of the whole
+      /// scene if it is empty
+      public: void MarkChanged(const math::AxisAlignedBox &_box);
+
+      /// \brief Record a change of a node that is about to be made. The
+      /// region of the node is recorded now and when Flush is called, so
+      /// both where it was and where it is afterwards count as changed.
+      /// Nodes call it themselves.
+      /// \param[in] _node Node that changes
+      public: void MarkNodeChanged(const NodePtr &_node);
+
+      /// \brief Record the regions of the nodes changed since the last
+      /// call. Cameras call it before checking for changes, after
+      /// Scene::PreRender.
+      public: void Flush();
+
+      /// \brief Get the sequence number of the last change
+      /// \return Number of changes recorded so far
+      public: uint64_t ChangeCount() const;
+
+      /// \brief Get whether the scene changed after a given change
+      /// \param[in] _count Sequence number of the change, see ChangeCount
+      /// \return True if a change was recorded after it
+      public: bool ChangedSince(uint64_t _count) const;
+
+      /// \brief Get whether a change after a given change affects a
+      /// frustum
+      /// \param[in] _count Sequence number of the change, see ChangeCount
+      /// \param[in] _frustum World frustum, e.g. of a camera
+      /// \return True if such a change intersects the frustum, affects the
+      /// whole scene or is too old to be known
+      public: bool ChangedSince(uint64_t _count,
+                  const math::Frustum &_frustum) const;
+
+      /// \brief Forget the nodes about to change and record a change of
+      /// the whole scene. Scenes call it before destroying their objects.
+      public: void Reset();
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneChangeTrackerPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
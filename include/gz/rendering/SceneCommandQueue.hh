@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SCENECOMMANDQUEUE_HH_
+#define GZ_RENDERING_SCENECOMMANDQUEUE_HH_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gz/math/Pose3.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class SceneCommandQueuePrivate;
+
+    /// \class SceneCommandQueue SceneCommandQueue.hh
+    /// gz/rendering/SceneCommandQueue.hh
+    /// \brief Queue of scene changes made by threads other than the render
+    /// thread, e.g. physics, GUI or ROS callbacks.
+    ///
+    /// Scenes and their objects must only be changed on the render thread.
+    /// Any thread may enqueue commands without locking: enqueuing is a
+    /// single atomic operation, so producers never wait for each other or
+    /// for the render thread. The commands are applied in the order they
+    /// were enqueued by Apply, which scenes call at the start of
+    /// Scene::PreRender. Consecutive world pose commands are applied
+    /// together with Scene::SetWorldPoses.
+    ///
+    /// Commands refer to objects by id, since the objects may be destroyed
+    /// before the commands are applied. Commands on unknown ids are
+    /// skipped. See Scene::CommandQueue.
+    class GZ_RENDERING_VISIBLE SceneCommandQueue
+    {
+      /// \brief Constructor
+      public: SceneCommandQueue();
+
+      /// \brief Destructor. Discards the pending commands.
+      public: virtual ~SceneCommandQueue();
+
+      /// \brief Enqueue a world pose change
+      /// \param[in] _visualId Id of the visual to move
+      /// \param[in] _pose New world pose
+      public: void SetWorldPose(unsigned int _visualId,
+                  const math::Pose3d &_pose);
+
+      /// \brief Enqueue a local pose change
+      /// \param[in] _nodeId Id of the node to move
+      /// \param[in] _pose New pose relative to the node's parent
+      public: void SetLocalPose(unsigned int _nodeId,
+                  const math::Pose3d &_pose);
+
+      /// \brief Enqueue a visibility change
+      /// \param[in] _visualId Id of the visual to show or hide
+      /// \param[in] _visible True to show the visual
+      public: void SetVisible(unsigned int _visualId, bool _visible);
+
+      /// \brief Enqueue a material change. The material is looked up by
+      /// name when the command is applied, see Scene::Material.
+      /// \param[in] _visualId Id of the visual
+      /// \param[in] _materialName Name of a material of the scene
+      /// \param[in] _unique True to give the visual its own copy of the
+      /// material, see Visual::SetMaterial
+      public: void SetMaterial(unsigned int _visualId,
+                  const std::string &_materialName, bool _unique = true);
+
+      /// \brief Enqueue an arbitrary change, e.g. updating the points of a
+      /// marker. The function is called on the render thread with the
+      /// scene the queue belongs to.
+      /// \param[in] _command Function applying the change
+      public: void Enqueue(std::function<void(Scene &)> _command);
+
+      /// \brief Get whether commands are pending. The result may be out of
+      /// date as soon as it is returned if other threads enqueue commands.
+      /// \return True if no command is pending
+      public: bool Empty() const;
+
+      /// \brief Apply the pending commands. Must be called on the render
+      /// thread. Commands enqueued while applying, e.g. by the commands
+      /// themselves, are applied by the next call.
+      /// \param[in] _scene Scene to apply the commands to
+      /// \return Number of commands applied
+      public: unsigned int Apply(Scene &_scene);
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneCommandQueuePrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
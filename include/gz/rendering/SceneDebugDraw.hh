@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SCENEDEBUGDRAW_HH_
+#define GZ_RENDERING_SCENEDEBUGDRAW_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gz/math/Color.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class SceneDebugDrawPrivate;
+
+    /// \class SceneDebugDraw SceneDebugDraw.hh
+    /// gz/rendering/SceneDebugDraw.hh
+    /// \brief Immediate mode drawing of transient debug geometry, e.g.
+    /// contact forces, link frames or bounding volumes.
+    ///
+    /// Shapes are drawn in world coordinates and only last one frame: the
+    /// shapes drawn since the previous frame are uploaded by Flush, which
+    /// scenes call at the start of Scene::PreRender, and are removed by the
+    /// next Flush. Instead of creating a visual per shape, all lines of
+    /// the same color are batched into a single line list marker, so
+    /// thousands of shapes take one draw call per color. Text labels are
+    /// not batched and are only drawn by render engines that support
+    /// Scene::CreateText.
+    ///
+    /// Must be used on the render thread. Other threads may draw through
+    /// SceneCommandQueue::Enqueue. See Scene::DebugDraw.
+    class GZ_RENDERING_VISIBLE SceneDebugDraw
+    {
+      /// \brief Constructor
+      public: SceneDebugDraw();
+
+      /// \brief Destructor
+      public: virtual ~SceneDebugDraw();
+
+      /// \brief Draw a line
+      /// \param[in] _start Start point
+      /// \param[in] _end End point
+      /// \param[in] _color Line color
+      public: void Line(const math::Vector3d &_start,
+                  const math::Vector3d &_end, const math::Color &_color);
+
+      /// \brief Draw an arrow
+      /// \param[in] _start Tail of the arrow
+      /// \param[in] _end Tip of the arrow
+      /// \param[in] _color Arrow color
+      /// \param[in] _headSize Length of the head as a fraction of the
+      /// length of the arrow
+      public: void Arrow(const math::Vector3d &_start,
+                  const math::Vector3d &_end, const math::Color &_color,
+                  double _headSize = 0.2);
+
+      /// \brief Draw the axes of a frame, X in red, Y in green and Z in
+      /// blue
+      /// \param[in] _pose Pose of the frame
+      /// \param[in] _length Length of the axes
+      public: void Axes(const math::Pose3d &_pose, double _length = 1.0);
+
+      /// \brief Draw the edges of a box
+      /// \param[in] _pose Pose of the center of the box
+      /// \param[in] _size Size of the box
+      /// \param[in] _color Line color
+      public: void Box(const math::Pose3d &_pose,
+                  const math::Vector3d &_size, const math::Color &_color);
+
+      /// \brief Draw a sphere as three great circles
+      /// \param[in] _center Center of the sphere
+      /// \param[in] _radius Radius of the sphere
+      /// \param[in] _color Line color
+      /// \param[in] _segments Number of line segments per circle
+      public: void Sphere(const math::Vector3d &_center, double _radius,
+                  const math::Color &_color, unsigned int _segments = 24u);
+
+      /// \brief Draw a text label facing the camera
+      /// \param[in] _position Position of the label
+      /// \param[in] _text Text of the label
+      /// \param[in] _color Text color
+      /// \param[in] _height Character height
+      public: void Text(const math::Vector3d &_position,
+                  const std::string &_text, const math::Color &_color,
+                  double _height = 0.2);
+
+      /// \brief Remove the shapes drawn since the last Flush
+      public: void Clear();
+
+      /// \brief Remove the shapes drawn since the last Flush and forget the
+      /// visuals, markers and materials showing the shapes, without
+      /// destroying them. Scenes call it before destroying their objects.
+      public: void Reset();
+
+      /// \brief Get the number of lines drawn since the last Flush
+      /// \return Number of lines
+      public: size_t LineCount() const;
+
+      /// \brief Set the visibility flags of the debug geometry, e.g. to
+      /// only show it in user cameras
+      /// \param[in] _flags Visibility flags
+      /// \sa Visual::SetVisibilityFlags
+      public: void SetVisibilityFlags(uint32_t _flags);
+
+      /// \brief Get the visibility flags of the debug geometry
+      /// \return Visibility flags, GZ_VISIBILITY_ALL by default
+      public: uint32_t VisibilityFlags() const;
+
+      /// \brief Upload the shapes drawn since the last Flush and remove the
+      /// shapes of the previous frame. Must be called on the render thread.
+      /// \param[in] _scene Scene the debug draw belongs to
+      public: void Flush(Scene &_scene);
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneDebugDrawPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SCENEMARKERPOOL_HH_
+#define GZ_RENDERING_SCENEMARKERPOOL_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/Marker.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class SceneMarkerPoolPrivate;
+
+    /// \class SceneMarkerPool SceneMarkerPool.hh
+    /// gz/rendering/SceneMarkerPool.hh
+    /// \brief Markers that are retired by the scene when their lifetime
+    /// ends, e.g. for visualization topics that publish many short lived
+    /// markers.
+    ///
+    /// Each marker is the only geometry of a visual owned by the pool, which
+    /// positions it, see Geometry::Parent. Lifetimes are measured in scene
+    /// time, see Scene::SetTime, and tracked by a timer wheel, so retiring
+    /// markers only costs work for the markers that expire. Retired markers
+    /// are cleared, detached and kept per MarkerType, and Acquire reuses
+    /// them with their render buffers instead of creating new ones. Markers
+    /// pooled beyond MaxPooledPerType are destroyed.
+    ///
+    /// Must be used on the render thread. See Scene::MarkerPool.
+    class GZ_RENDERING_VISIBLE SceneMarkerPool
+    {
+      /// \brief Constructor
+      public: SceneMarkerPool();
+
+      /// \brief Destructor
+      public: virtual ~SceneMarkerPool();
+
+      /// \brief Get a marker that is retired when its lifetime ends
+      /// \param[in] _scene Scene the pool belongs to
+      /// \param[in] _type Type of the marker
+      /// \param[in] _lifetime Lifetime from the current scene time. Zero
+      /// for a marker that is only retired by Release.
+      /// \param[in] _parent Visual to attach the visual of the marker to,
+      /// the root visual if null
+      /// \return Marker without points, null on failure
+      public: MarkerPtr Acquire(Scene &_scene, MarkerType _type,
+                  std::chrono::steady_clock::duration _lifetime,
+                  VisualPtr _parent = nullptr);
+
+      /// \brief Restart the lifetime of a marker, e.g. when it was
+      /// published again
+      /// \param[in] _scene Scene the pool belongs to
+      /// \param[in] _marker Marker given by Acquire
+      /// \param[in] _lifetime Lifetime from the current scene time, zero
+      /// for none
+      /// \return True if the marker was not retired yet
+      public: bool Renew(Scene &_scene, const MarkerPtr &_marker,
+                  std::chrono::steady_clock::duration _lifetime);
+
+      /// \brief Retire a marker before its lifetime ends
+      /// \param[in] _marker Marker given by Acquire
+      /// \return True if the marker was not retired yet
+      public: bool Release(const MarkerPtr &_marker);
+
+      /// \brief Get the number of markers that were acquired and are not
+      /// retired yet
+      /// \return Number of active markers
+      public: unsigned int ActiveCount() const;
+
+      /// \brief Get the number of retired markers kept for reuse
+      /// \return Number of pooled markers, of all types
+      public: unsigned int PooledCount() const;
+
+      /// \brief Set the maximum number of retired markers kept per type
+      /// \param[in] _count Maximum number of markers, 0 to destroy all
+      /// retired markers
+      public: void SetMaxPooledPerType(unsigned int _count);
+
+      /// \brief Get the maximum number of retired markers kept per type
+      /// \return Maximum number of markers, 256 by default
+      public: unsigned int MaxPooledPerType() const;
+
+      /// \brief Retire the markers whose lifetime ended at the current scene
+      /// time and destroy the retired markers that exceed the pool size.
+      /// Scenes call it at the start of Scene::PreRender.
+      /// \param[in] _scene Scene the pool belongs to
+      public: void Update(Scene &_scene);
+
+      /// \brief Forget all markers and their visuals without destroying
+      /// them. Scenes call it before destroying their objects.
+      public: void Reset();
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneMarkerPoolPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
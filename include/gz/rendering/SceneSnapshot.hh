@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SCENESNAPSHOT_HH_
+#define GZ_RENDERING_SCENESNAPSHOT_HH_
+
+#include <map>
+#include <string>
+
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/Node.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief State of a single node captured by Scene::Snapshot
+    class GZ_RENDERING_VISIBLE NodeSnapshot
+    {
+      /// \brief Pose of the node relative to its parent
+      public: math::Pose3d localPose;
+
+      /// \brief Scale of the node relative to its parent
+      public: math::Vector3d localScale = math::Vector3d::One;
+
+      /// \brief True if the node is a visual, in which case visible and
+      /// material are captured
+      public: bool isVisual = false;
+
+      /// \brief Visibility of the visual
+      public: bool visible = true;
+
+      /// \brief Material of the visual, null if it has none
+      public: MaterialPtr material;
+
+      /// \brief User data of the node, see Node::SetUserData
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<std::string, Variant> userData;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+
+    /// \brief State of the nodes of a scene, see Scene::Snapshot and
+    /// Scene::Restore
+    class GZ_RENDERING_VISIBLE SceneSnapshot
+    {
+      /// \brief Captured nodes, indexed by node id
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: std::map<unsigned int, NodeSnapshot> nodes;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
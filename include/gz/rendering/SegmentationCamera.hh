@@ -17,8 +17,11 @@
 #ifndef GZ_RENDERING_SEGMENTATIONCAMERA_HH_
 #define GZ_RENDERING_SEGMENTATIONCAMERA_HH_
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 #include <gz/math/Color.hh>
@@ -43,11 +46,61 @@ namespace gz
     };
 
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    /// \brief Consecutive pixels of a row that belong to the same segment
+    struct SegmentationRun
+    {
+      /// \brief Row of the pixels
+      uint32_t row;
+
+      /// \brief Column of the first pixel
+      uint32_t start;
+
+      /// \brief Number of pixels
+      uint32_t length;
+    };
+
+    /// \brief Sparse description of the pixels of a frame that have the
+    /// same value in the dense segmentation image, e.g. one label in
+    /// ST_SEMANTIC mode or one instance in ST_PANOPTIC mode.
+    struct SegmentationInstance
+    {
+      /// \brief The three channels of the pixels in the dense image, see
+      /// SegmentationCamera::SegmentationData, packed as
+      /// channel0 | channel1 << 8 | channel2 << 16. In ST_PANOPTIC mode
+      /// without colored map, id >> 16 is the label and id & 0xFFFF the
+      /// instance count. In ST_SEMANTIC mode without colored map, id & 0xFF
+      /// is the label.
+      uint32_t id;
+
+      /// \brief Number of pixels
+      uint64_t pixelCount;
+
+      /// \brief Column of the leftmost pixel
+      uint32_t minX;
+
+      /// \brief Row of the topmost pixel
+      uint32_t minY;
+
+      /// \brief Column of the rightmost pixel
+      uint32_t maxX;
+
+      /// \brief Row of the bottommost pixel
+      uint32_t maxY;
+
+      /// \brief Runs of the pixels, ordered by row and column. Only filled
+      /// if SegmentationCamera::EnableInstanceRuns is enabled.
+      std::vector<SegmentationRun> runs;
+    };
+
     /// \class SegmentationCamera SegmentationCamera.hh
     /// gz/rendering/SegmentationCamera.hh
     /// \brief Poseable Segmentation camera used for rendering the scene graph.
     /// This camera is designed to produce segmentation data, instead of a 2D
     /// image.
+    ///
+    /// In ST_PANOPTIC mode the label and the instance id of every pixel
+    /// come from a single scene render, so semantic and instance masks of
+    /// the same pose do not need two cameras.
     class GZ_RENDERING_VISIBLE SegmentationCamera :
       public virtual Camera
     {
@@ -63,6 +116,14 @@ namespace gz
       /// \return The labels-buffer as an array of unsigned ints
       public: virtual uint8_t *SegmentationData() const = 0;
 
+      /// \brief Get a lease of the latest segmentation image, so that it
+      /// can be processed on another thread while the next frames are
+      /// written into other buffers, see GpuRays::AcquireData
+      /// \return Lease of the image passed to the new segmentation frame
+      /// listeners, null if there is none
+      public: virtual std::shared_ptr<const uint8_t> AcquireSegmentationData()
+          const = 0;
+
       /// \brief Connect to the new Segmentation image event
       /// \param[in] _subscriber Subscriber callback function.
       /// The callback function arguments are:
@@ -115,6 +176,31 @@ namespace gz
       /// before calling
       public: virtual void LabelMapFromColoredBuffer(
         uint8_t *_labelBuffer) const = 0;
+
+      /// \brief Connect to the sparse segmentation of new frames: the pixel
+      /// count, bounding rectangle and optionally the runs of every id in
+      /// the frame, background included. It is computed from the
+      /// downloaded frame, so the dense image is only produced for frames
+      /// that ConnectNewSegmentationFrame listeners are also connected to.
+      /// \param[in] _subscriber Subscriber callback function.
+      /// The callback function arguments are:
+      /// <instances sorted by id, width, height>
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: virtual gz::common::ConnectionPtr
+        ConnectNewSegmentationInstances(
+          std::function<void(const std::vector<SegmentationInstance> &,
+          unsigned int, unsigned int)> _subscriber) = 0;
+
+      /// \brief Enable the runs of the sparse segmentation, e.g. for COCO
+      /// run-length encoded masks. Defaults to false, in which case only
+      /// the pixel counts and rectangles are computed.
+      /// \param[in] _enable True to compute the runs
+      public: virtual void EnableInstanceRuns(bool _enable) = 0;
+
+      /// \brief Get whether the runs of the sparse segmentation are
+      /// computed
+      /// \return True if the runs are computed
+      public: virtual bool IsInstanceRunsEnabled() const = 0;
     };
   }
   }
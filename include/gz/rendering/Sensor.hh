@@ -17,8 +17,11 @@
 #ifndef GZ_RENDERING_SENSOR_HH_
 #define GZ_RENDERING_SENSOR_HH_
 
+#include <cstddef>
+
 #include "gz/rendering/config.hh"
 #include "gz/rendering/Node.hh"
+#include "gz/rendering/SensorQualityProfile.hh"
 
 namespace gz
 {
@@ -42,6 +45,70 @@ namespace gz
       /// \brief Get visibility mask
       /// \return visibility mask
       public: virtual uint32_t VisibilityMask() const = 0;
+
+      /// \brief Set the rendering features the sensor may skip, e.g. to
+      /// render a geometry-only sensor without shadows or particles. The
+      /// profile is applied when the sensor's compositor workspace is
+      /// built; changing it afterwards rebuilds the workspace on the next
+      /// render. Render engines ignore the features they cannot disable.
+      /// \param[in] _profile Quality profile of the sensor
+      public: virtual void SetQualityProfile(
+                  const SensorQualityProfile &_profile) = 0;
+
+      /// \brief Get the rendering features the sensor may skip
+      /// \return Quality profile of the sensor
+      public: virtual SensorQualityProfile QualityProfile() const = 0;
+
+      /// \brief Set whether the sensor is only rendered on demand. A demand
+      /// driven sensor is idle while nothing is connected to its output
+      /// events and no capture was requested since it was last rendered.
+      /// Idle sensors are neither rendered nor read back by Camera::Update,
+      /// Scene::RenderSensors and SensorScheduler. Disabled by default.
+      /// \param[in] _enabled True to render the sensor on demand only
+      /// \sa IsIdle
+      public: virtual void SetDemandDriven(bool _enabled) = 0;
+
+      /// \brief Get whether the sensor is only rendered on demand
+      /// \return True if the sensor is demand driven
+      public: virtual bool DemandDriven() const = 0;
+
+      /// \brief Get whether anything is connected to the output events of
+      /// the sensor, e.g. new frame or point cloud listeners
+      /// \return True if the sensor has at least one connection
+      public: virtual bool HasConnections() const = 0;
+
+      /// \brief Request the sensor to be rendered on its next update even
+      /// if it has no connections. Capture requests itself, and copying the
+      /// data of a sensor, e.g. with Camera::Copy or DepthCamera::DepthData,
+      /// requests the next frame so polled sensors keep updating.
+      public: virtual void RequestCapture() = 0;
+
+      /// \brief Get whether the sensor can be skipped: it is demand driven,
+      /// has no connections and no capture was requested since it was last
+      /// rendered.
+      /// \return True if the sensor is idle
+      public: virtual bool IsIdle() const = 0;
+
+      /// \internal
+      /// \brief Clear the capture request once the sensor was rendered
+      public: virtual void ClearCaptureRequest() = 0;
+
+      /// \brief Release the GPU memory of the sensor's render textures.
+      /// The textures are allocated again the next time the sensor is
+      /// rendered, which costs about as much as creating the sensor. See
+      /// Scene::SetSensorReleaseTime to release the textures of sensors
+      /// that are not updated for a while.
+      /// \remark Must not be called between Scene::PreRender and
+      /// Scene::PostRender
+      /// \return True if textures were released, false if the sensor holds
+      /// none or the render engine cannot release them
+      public: virtual bool ReleaseRenderTextures() = 0;
+
+      /// \brief Get the GPU memory of the render targets owned by the
+      /// sensor, including intermediate targets of its post-processing
+      /// \return Memory in bytes, 0 if the sensor owns no render targets or
+      /// the render engine does not report it
+      public: virtual size_t MemoryUsage() const = 0;
     };
     }
   }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SENSORGBUFFER_HH_
+#define GZ_RENDERING_SENSORGBUFFER_HH_
+
+#include <memory>
+#include <set>
+
+#include <gz/math/Angle.hh>
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Outputs of a SensorGBuffer
+    enum class GBufferOutput
+    {
+      /// \brief Lit colour image
+      COLOR = 0,
+
+      /// \brief Depth image and point clouds
+      DEPTH = 1,
+
+      /// \brief Semantic label of every pixel
+      LABEL = 2,
+
+      /// \brief Instance id of every pixel
+      INSTANCE = 3,
+
+      /// \brief Temperature of every pixel
+      TEMPERATURE = 4
+    };
+
+    // forward declaration
+    class SensorGBufferPrivate;
+
+    /// \class SensorGBuffer SensorGBuffer.hh gz/rendering/SensorGBuffer.hh
+    /// \brief Co-located sensor outputs rendered with as few scene renders
+    /// as the render engine allows, e.g. for an RGB-D camera with semantic
+    /// and instance masks of the same pose.
+    ///
+    /// Outputs that one camera produces from a single render share that
+    /// camera: colour and depth come from a DepthCamera (see
+    /// DepthCamera::ConnectNewRgbFrame), label and instance id from a
+    /// SegmentationCamera in ST_PANOPTIC mode and temperature from a
+    /// ThermalCamera. All cameras are rendered in one Scene::RenderSensors
+    /// batch, so the scene graph is updated once and the GPU work of every
+    /// camera is submitted before any data is read back. Each output keeps
+    /// the signal, readback and render passes, e.g. noise, of its camera.
+    ///
+    /// The cameras are children of Visual(), add it to the scene graph and
+    /// pose it to move the sensor. Use Scene::CreateSensorGBuffer to create
+    /// a sensor.
+    class GZ_RENDERING_VISIBLE SensorGBuffer
+    {
+      /// \brief Constructor, see Scene::CreateSensorGBuffer
+      /// \param[in] _scene Scene to create the cameras in
+      /// \param[in] _outputs Outputs to render
+      protected: SensorGBuffer(ScenePtr _scene,
+                     const std::set<GBufferOutput> &_outputs);
+
+      /// \brief Destructor. The cameras stay in the scene until Destroy is
+      /// called or the scene is destroyed.
+      public: virtual ~SensorGBuffer();
+
+      /// \brief Get the parent visual of all cameras
+      /// \return Parent visual of the sensor
+      public: VisualPtr Visual() const;
+
+      /// \brief Get the outputs of the sensor
+      /// \return Outputs passed to the constructor that the render engine
+      /// supports
+      public: std::set<GBufferOutput> Outputs() const;
+
+      /// \brief Get the camera that renders an output, e.g. to connect to
+      /// its new frame signal or to add a noise pass. Cast it to the
+      /// camera type documented in the class description.
+      /// \param[in] _output Output of the sensor
+      /// \return Camera of the output, null if the sensor does not render
+      /// it
+      public: CameraPtr OutputCamera(GBufferOutput _output) const;
+
+      /// \brief Get the number of scene renders of one Update
+      /// \return Number of cameras of the sensor
+      public: unsigned int RenderCount() const;
+
+      /// \brief Set the image size of all outputs
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      public: void SetImageSize(unsigned int _width, unsigned int _height);
+
+      /// \brief Set the horizontal field of view of all outputs
+      /// \param[in] _hfov Horizontal field of view
+      public: void SetHFOV(const math::Angle &_hfov);
+
+      /// \brief Set the clip planes of all outputs
+      /// \param[in] _near Near clip plane distance
+      /// \param[in] _far Far clip plane distance
+      public: void SetClipPlanes(double _near, double _far);
+
+      /// \brief Render all outputs
+      /// \remark Must not be called between Scene::PreRender and
+      /// Scene::PostRender
+      public: void Update();
+
+      /// \brief Destroy all cameras and the parent visual
+      public: void Destroy();
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SensorGBufferPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Only the scene creates sensors
+      private: friend class BaseScene;
+    };
+    }
+  }
+}
+#endif
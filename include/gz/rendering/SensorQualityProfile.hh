@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SENSORQUALITYPROFILE_HH_
+#define GZ_RENDERING_SENSORQUALITYPROFILE_HH_
+
+#include <cstdint>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Rendering features a sensor may skip, see
+    /// Sensor::SetQualityProfile. Everything is enabled by default, which
+    /// renders the sensor like any other camera. Geometry-only sensors can
+    /// disable the features their output does not depend on.
+    class GZ_RENDERING_VISIBLE SensorQualityProfile
+    {
+      /// \brief True to render shadow maps for the sensor and sample them
+      /// when shading
+      public: bool shadows = true;
+
+      /// \brief True to apply the scene's global illumination
+      public: bool globalIllumination = true;
+
+      /// \brief True to render particle systems
+      public: bool particles = true;
+
+      /// \brief True to use the sensor's anti-aliasing (MSAA) level. False
+      /// renders without multisampling.
+      public: bool antiAliasing = true;
+
+      /// \brief Mask combined with the sensor's visibility mask. Visuals
+      /// whose visibility flags do not match both masks are not rendered.
+      public: uint32_t visibilityMask = GZ_VISIBILITY_ALL;
+    };
+    }
+  }
+}
+#endif
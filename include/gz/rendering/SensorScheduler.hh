@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SENSORSCHEDULER_HH_
+#define GZ_RENDERING_SENSORSCHEDULER_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <gz/utils/SuppressWarning.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class SensorSchedulerPrivate;
+
+    /// \class SensorScheduler SensorScheduler.hh
+    /// gz/rendering/SensorScheduler.hh
+    /// \brief Updates the sensors of a scene at their own rates while
+    /// keeping the GPU work of every simulation step in few, evenly sized
+    /// flushes.
+    ///
+    /// Call Update once per simulation step, after Scene::SetTime. The
+    /// sensors that are due are rendered with Scene::RenderSensors in
+    /// batches of at most PassBudget() camera passes. When
+    /// MaxPassesPerStep is set, sensors that do not fit in the step are
+    /// postponed to the next steps, with the most late sensors first, which
+    /// staggers expensive sensors such as wide-angle cameras and GPU rays
+    /// across frames. Sensors later than their deadline are always
+    /// rendered. Idle sensors, see Sensor::SetDemandDriven, are skipped
+    /// when they are due and do not count towards the budgets or their
+    /// UpdateCount.
+    ///
+    /// When a TimeBudget is set, e.g. to meet the wall-clock deadline of a
+    /// hardware-in-the-loop bench, each sensor's cost is estimated from its
+    /// last timings in Scene::Stats. Sensors that would not finish within
+    /// the budget are deferred to the next Update, see DeferCount. Sensors
+    /// past their deadline are rendered anyway, with the reduced level of
+    /// detail of SetReducedLodBias, see ReducedCount.
+    class GZ_RENDERING_VISIBLE SensorScheduler
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene whose sensors are scheduled
+      public: explicit SensorScheduler(ScenePtr _scene);
+
+      /// \brief Destructor
+      public: virtual ~SensorScheduler();
+
+      /// \brief Schedule a sensor. Sensors that are already scheduled get
+      /// the new rate and deadline. The sensor is first due on the next
+      /// Update.
+      /// \param[in] _sensor Sensor to schedule. Must be a camera of the
+      /// scene, e.g. a depth camera or GPU rays.
+      /// \param[in] _rate Update rate in Hz. Must be positive.
+      /// \param[in] _deadline Maximum time a sensor may be postponed past
+      /// its due time. Zero means the sensor may be postponed until
+      /// the step budget allows it.
+      /// \return True if the sensor was scheduled
+      public: bool AddSensor(const SensorPtr &_sensor, double _rate,
+                  std::chrono::steady_clock::duration _deadline =
+                  std::chrono::steady_clock::duration::zero());
+
+      /// \brief Stop scheduling a sensor
+      /// \param[in] _sensor Sensor to remove
+      public: void RemoveSensor(const SensorPtr &_sensor);
+
+      /// \brief Get the number of scheduled sensors
+      /// \return Number of scheduled sensors
+      public: unsigned int SensorCount() const;
+
+      /// \brief Set the number of camera passes a sensor costs when it is
+      /// batched. By default cameras cost 1 pass and wide-angle cameras and
+      /// GPU rays 6, one per cube map face.
+      /// \param[in] _sensor Scheduled sensor
+      /// \param[in] _passes Number of passes, at least 1
+      public: void SetSensorCost(const SensorPtr &_sensor,
+                  unsigned int _passes);
+
+      /// \brief Get the number of camera passes a sensor costs
+      /// \param[in] _sensor Scheduled sensor
+      /// \return Number of passes, 0 if the sensor is not scheduled
+      public: unsigned int SensorCost(const SensorPtr &_sensor) const;
+
+      /// \brief Set the maximum number of camera passes rendered in one GPU
+      /// flush. Defaults to the scene's SetCameraPassCountPerGpuFlush, or
+      /// 6 if the scene is in legacy mode.
+      /// \param[in] _passes Number of passes, at least 1
+      public: void SetPassBudget(unsigned int _passes);
+
+      /// \brief Get the maximum number of camera passes per GPU flush
+      /// \return Number of passes
+      public: unsigned int PassBudget() const;
+
+      /// \brief Set the maximum number of camera passes rendered in one
+      /// Update. At least one sensor is rendered per Update regardless.
+      /// \param[in] _passes Number of passes, 0 for no limit (default)
+      public: void SetMaxPassesPerStep(unsigned int _passes);
+
+      /// \brief Get the maximum number of camera passes per Update
+      /// \return Number of passes, 0 if there is no limit
+      public: unsigned int MaxPassesPerStep() const;
+
+      /// \brief Set the wall-clock time one Update may take. At least one
+      /// sensor is rendered per Update regardless.
+      /// \param[in] _budget Time budget, zero for no limit (default)
+      public: void SetTimeBudget(std::chrono::steady_clock::duration _budget);
+
+      /// \brief Get the wall-clock time one Update may take
+      /// \return Time budget, zero if there is no limit
+      public: std::chrono::steady_clock::duration TimeBudget() const;
+
+      /// \brief Set the factor applied to the level of detail bias of
+      /// cameras that are rendered past the time budget because they are
+      /// past their deadline, see Camera::SetLodBias. Their bias is
+      /// restored once they are rendered.
+      /// \param[in] _factor Factor in (0, 1], 1 to keep the full detail
+      /// (default)
+      public: void SetReducedLodBias(double _factor);
+
+      /// \brief Get the factor applied to the level of detail bias of
+      /// cameras rendered past the time budget
+      /// \return Level of detail bias factor
+      public: double ReducedLodBias() const;
+
+      /// \brief Render the sensors that are due at the scene's current
+      /// time
+      /// \remark Must not be called between Scene::PreRender and
+      /// Scene::PostRender
+      /// \return Number of GPU flush batches rendered
+      public: unsigned int Update();
+
+      /// \brief Get the number of times a sensor was rendered
+      /// \param[in] _sensor Scheduled sensor
+      /// \return Number of updates
+      public: uint64_t UpdateCount(const SensorPtr &_sensor) const;
+
+      /// \brief Get the rate a sensor was actually rendered at, measured in
+      /// scene time between its first and last update
+      /// \param[in] _sensor Scheduled sensor
+      /// \return Achieved rate in Hz, 0 until the sensor was rendered twice
+      public: double AchievedRate(const SensorPtr &_sensor) const;
+
+      /// \brief Get the number of times a due sensor was deferred to the
+      /// next Update because it did not fit in the time budget
+      /// \param[in] _sensor Scheduled sensor
+      /// \return Number of deferrals
+      public: uint64_t DeferCount(const SensorPtr &_sensor) const;
+
+      /// \brief Get the number of times a sensor was rendered past the time
+      /// budget, with reduced level of detail, because it was past its
+      /// deadline
+      /// \param[in] _sensor Scheduled sensor
+      /// \return Number of updates past the budget
+      public: uint64_t ReducedCount(const SensorPtr &_sensor) const;
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SensorSchedulerPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+    };
+    }
+  }
+}
+#endif
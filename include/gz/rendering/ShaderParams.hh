@@ -18,6 +18,7 @@
 #ifndef GZ_RENDERING_SHADERPARAMS_HH_
 #define GZ_RENDERING_SHADERPARAMS_HH_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -35,8 +36,20 @@ namespace gz
     class ShaderParamsPrivate;
 
     /// \brief a map that holds params to be passed to a shader
+    ///
+    /// Params that are updated every frame should be registered once with
+    /// Register and then accessed through the returned handle. Render
+    /// engines resolve the GPU constant of a handle once and only write the
+    /// constants whose handles were accessed, instead of looking up every
+    /// param by name whenever one of them changes.
     class GZ_RENDERING_VISIBLE ShaderParams
     {
+      /// \brief Handle of a registered param
+      public: using Handle = uint32_t;
+
+      /// \brief Value of an invalid handle
+      public: static constexpr Handle kInvalidHandle = UINT32_MAX;
+
       /// \brief forward declaration
       class IteratorPrivate;
 
@@ -105,6 +118,55 @@ namespace gz
       /// \returns const parameter reference
       public: const ShaderParam &operator[](const std::string &_name) const;
 
+      /// \brief Register a param for access through a handle. The param
+      /// is created if it does not exist yet.
+      /// \param[in] _name Identifier for the parameter
+      /// \param[in] _type Type of the values that will be set through the
+      /// handle
+      /// \return Handle of the param. Registering the same name again
+      /// returns the same handle.
+      public: Handle Register(const std::string &_name,
+                  ShaderParam::ParamType _type);
+
+      /// \brief Access a registered param. Only the accessed param needs
+      /// to be updated by the render engine.
+      /// \param[in] _handle Handle returned by Register
+      /// \returns parameter reference
+      public: ShaderParam &operator[](Handle _handle);
+
+      /// \brief Access a registered param
+      /// \param[in] _handle Handle returned by Register
+      /// \returns const parameter reference
+      public: const ShaderParam &operator[](Handle _handle) const;
+
+      /// \brief Get the number of registered params. Handles are numbered
+      /// from 0 to HandleCount() - 1.
+      /// \return Number of registered params
+      public: uint32_t HandleCount() const;
+
+      /// \brief Get the name of a registered param
+      /// \param[in] _handle Handle returned by Register
+      /// \return Name of the param, empty if the handle is invalid
+      public: const std::string &HandleName(Handle _handle) const;
+
+      /// \brief Get the type a param was registered with
+      /// \param[in] _handle Handle returned by Register
+      /// \return Registered type, PARAM_NONE if the handle is invalid
+      public: ShaderParam::ParamType HandleType(Handle _handle) const;
+
+      /// \brief Has a registered param been accessed since the dirty flags
+      /// were last cleared?
+      /// \internal
+      /// \param[in] _handle Handle returned by Register
+      /// \return True if the param may have changed
+      public: bool IsDirty(Handle _handle) const;
+
+      /// \brief Have params been accessed by name since the dirty flags
+      /// were last cleared? All params must be updated in that case.
+      /// \internal
+      /// \return True if a param was accessed by name
+      public: bool IsNameDirty() const;
+
       /// \brief Iterator to first parameter
       /// \remarks Necessary for range-base for loop support
       /// \return Iterator pointing to first parameter.
@@ -115,12 +177,12 @@ namespace gz
       /// \return Iterator pointing to one past last parameter.
       public: Iterator end() const;
 
-      /// \brief Have the params changed?
+      /// \brief Have the params changed, by name or through a handle?
       /// \internal
       /// \returns true if the parameters have changed
       public: bool IsDirty() const;
 
-      /// \brief Resets the dirty flag
+      /// \brief Resets the dirty flags, including those of the handles
       /// \internal
       public: void ClearDirty();
 
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_SHADOWCONFIG_HH_
+#define GZ_RENDERING_SHADOWCONFIG_HH_
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Shadow map budget and update policy, see
+    /// Scene::SetShadowSettings
+    class GZ_RENDERING_VISIBLE ShadowConfig
+    {
+      /// \brief Resolution of the first cascade of directional light
+      /// shadows. The two further cascades use half the resolution.
+      public: unsigned int directionalTextureSize = 2048u;
+
+      /// \brief Resolution of the shadow maps of spot and point lights
+      public: unsigned int textureSize = 2048u;
+
+      /// \brief Size of the atlas textures the spot and point light shadow
+      /// maps are packed into. Must be a multiple of textureSize.
+      public: unsigned int atlasSize = 8192u;
+
+      /// \brief Resolution of the cube map point light shadows are
+      /// rendered to before they are copied to the atlas
+      public: unsigned int pointLightCubemapSize = 1024u;
+
+      /// \brief Maximum number of shadow maps. Directional lights use three
+      /// each. Lights beyond the budget do not cast shadows.
+      public: unsigned int maxShadowMaps = 25u;
+
+      /// \brief Maximum rate in Hz, in scene time, at which a camera
+      /// re-renders its shadow maps. In between, the camera reuses its
+      /// previous shadow maps. 0 re-renders them every frame.
+      public: double updateRate = 0.0;
+
+      /// \brief True to reuse a camera's shadow maps as long as nothing in
+      /// the scene moved, appeared or changed visibility, including the
+      /// camera itself
+      public: bool reuseStaticShadows = false;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_THERMALCAMERA_HH_
 #define GZ_RENDERING_THERMALCAMERA_HH_
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include "gz/rendering/Camera.hh"
 
@@ -118,6 +120,17 @@ namespace gz
       public: virtual gz::common::ConnectionPtr ConnectNewThermalFrame(
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) = 0;
+
+      /// \brief Get a lease of the latest thermal image, so that it can be
+      /// processed on another thread while the next frames are written
+      /// into other buffers, see GpuRays::AcquireData. Images may be
+      /// passed to the new thermal frame listeners straight from the GPU
+      /// readback memory until this is first called, in which case the
+      /// first call returns null.
+      /// \return Lease of the image passed to the new thermal frame
+      /// listeners, null if there is none
+      public: virtual std::shared_ptr<const uint16_t> AcquireThermalData()
+          const = 0;
     };
   }
   }
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_USERDATAKEY_HH_
+#define GZ_RENDERING_USERDATAKEY_HH_
+
+#include <cstdint>
+#include <string>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class UserDataKey UserDataKey.hh gz/rendering/UserDataKey.hh
+    /// \brief Interned key of node user data, see Node::SetUserData.
+    ///
+    /// Resolving a key hashes its name once. Keys with the same name
+    /// resolve to the same id for the lifetime of the process, so hot
+    /// paths can resolve their keys once and look user data up by id
+    /// without hashing or comparing strings. Lookups that must not intern
+    /// names they have not seen, e.g. reads of user data, use Find.
+    class GZ_RENDERING_VISIBLE UserDataKey
+    {
+      /// \brief Default constructor. Creates an invalid key.
+      public: UserDataKey() = default;
+
+      /// \brief Resolve the key of a name. Thread safe.
+      /// \param[in] _name Name of the key
+      public: explicit UserDataKey(const std::string &_name);
+
+      /// \brief Get the key of a name without interning it. Thread safe.
+      /// \param[in] _name Name of the key
+      /// \return Key of the name, or an invalid key if no key was ever
+      /// resolved from the name, in which case no node holds user data
+      /// for it either
+      public: static UserDataKey Find(const std::string &_name);
+
+      /// \brief Get the id of the key
+      /// \return Id, 0 if the key is invalid
+      public: uint32_t Id() const;
+
+      /// \brief Get the name of the key
+      /// \return Name, empty if the key is invalid
+      public: const std::string &Name() const;
+
+      /// \brief Check if the key was resolved from a name
+      /// \return True if the key is valid
+      public: bool Valid() const;
+
+      /// \brief Equality operator
+      /// \param[in] _other Key to compare with
+      /// \return True if both keys have the same id
+      public: bool operator==(const UserDataKey &_other) const;
+
+      /// \brief Inequality operator
+      /// \param[in] _other Key to compare with
+      /// \return True if the keys have different ids
+      public: bool operator!=(const UserDataKey &_other) const;
+
+      /// \brief Id of the key
+      private: uint32_t id = 0u;
+
+      /// \brief Interned name of the key, null if the key is invalid
+      private: const std::string *name = nullptr;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_UTILS_HH_
 #define GZ_RENDERING_UTILS_HH_
 
+#include <cstddef>
 #include <vector>
 #include <memory>
 
@@ -72,6 +73,41 @@ namespace gz
         RayQueryResult &_rayResult,
         float _maxDistance = 10.0);
 
+    /// \brief Retrieve the first points on surfaces in the 3D scene hit by
+    /// rays cast from many 2D screen coordinates at once. This is much
+    /// faster than calling screenToScene once per position since the rays
+    /// are intersected with a single RayQuery::ClosestPoints call.
+    /// \param[in] _screenPos 2D coordinates on the screen, in pixels.
+    /// \param[in] _camera User camera
+    /// \param[in] _rayQuery Ray query for mouse clicks. Its origin and
+    /// direction are left at the ray of the last screen position.
+    /// \param[out] _rayResults Ray query result of every screen position
+    /// \param[in] _maxDistance maximum distance to check the collision
+    /// \return 3D coordinates of a point in the 3D scene for every screen
+    /// position, in the same order.
+    GZ_RENDERING_VISIBLE
+    std::vector<math::Vector3d> screenToScene(
+        const std::vector<math::Vector2i> &_screenPos,
+        const CameraPtr &_camera,
+        const RayQueryPtr &_rayQuery,
+        std::vector<RayQueryResult> &_rayResults,
+        float _maxDistance = 10.0);
+
+    /// \brief Retrieve the first points on surfaces in the 3D scene hit by
+    /// rays cast from many 2D screen coordinates at once.
+    /// \param[in] _screenPos 2D coordinates on the screen, in pixels.
+    /// \param[in] _camera User camera
+    /// \param[in] _rayQuery Ray query for mouse clicks
+    /// \param[in] _maxDistance maximum distance to check the collision
+    /// \return 3D coordinates of a point in the 3D scene for every screen
+    /// position, in the same order.
+    GZ_RENDERING_VISIBLE
+    std::vector<math::Vector3d> screenToScene(
+        const std::vector<math::Vector2i> &_screenPos,
+        const CameraPtr &_camera,
+        const RayQueryPtr &_rayQuery,
+        float _maxDistance = 10.0);
+
     /// \brief Retrieve the point on a plane at z = 0 in the 3D scene hit by a
     /// ray cast from the given 2D screen coordinates.
     /// \param[in] _screenPos 2D coordinates on the screen, in pixels.
@@ -115,6 +151,22 @@ namespace gz
         const gz::math::Matrix4d &_projectionMatrix,
         double _width, double _height);
 
+    /// \brief Project many points in 3d world space to 2d screen space
+    /// with the same view projection matrix, using SIMD instructions where
+    /// available. See Camera::ProjectPoints.
+    /// \param[in] _viewProjection Projection matrix times view matrix
+    /// \param[in] _width Image width in pixels
+    /// \param[in] _height Image height in pixels
+    /// \param[in] _pts Points in 3d world space
+    /// \param[out] _screenPts Points in 2d screen space, in pixels with
+    /// subpixel precision. Must hold _count points.
+    /// \param[in] _count Number of points
+    GZ_RENDERING_VISIBLE
+    void projectPoints(const math::Matrix4d &_viewProjection,
+        unsigned int _width, unsigned int _height,
+        const math::Vector3d *_pts, math::Vector2d *_screenPts,
+        size_t _count);
+
     /// \brief convert an RGB image data into bayer image data
     /// \param[in] _image Input RGB image
     /// \param[in] _bayerFormat Bayer format to convert to
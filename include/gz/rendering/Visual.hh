@@ -126,6 +126,10 @@ namespace gz
       /// \param[in] _visible True if this visual should be made visible
       public: virtual void SetVisible(bool _visible) = 0;
 
+      /// \brief Get whether this visual is visible, as set by SetVisible
+      /// \return True if this visual is visible
+      public: virtual bool Visible() const = 0;
+
       /// \brief Tells Render Engine this Visual will be static (i.e.
       /// won't move, rotate or scale)
       /// You can still move, rotate or scale the Visual; however doing so
@@ -193,6 +197,21 @@ namespace gz
       /// \param[in] _flags Visibility flags
       public: virtual void RemoveVisibilityFlags(uint32_t _flags) = 0;
 
+      /// \brief Get the compact id of the visual. Unlike Id, compact ids
+      /// are dense indices assigned by the scene: they start at 0 and the
+      /// ids of destroyed visuals are reused. Render engines tag their
+      /// objects with it to map them back to visuals with an array lookup,
+      /// see Scene::VisualByCompactId.
+      /// \return Compact id, or the largest uint32_t value if the visual
+      /// was not created by a scene
+      public: virtual uint32_t CompactId() const = 0;
+
+      /// \internal
+      /// \brief Set the compact id of the visual. Called by the scene when
+      /// the visual is created.
+      /// \param[in] _id Compact id
+      public: virtual void SetCompactId(uint32_t _id) = 0;
+
       /// \brief Get the bounding box in world frame coordinates.
       /// \return The axis aligned bounding box
       public: virtual gz::math::AxisAlignedBox BoundingBox() const = 0;
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_VISUALDESCRIPTOR_HH_
+#define GZ_RENDERING_VISUALDESCRIPTOR_HH_
+
+#include <string>
+
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector3.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Describes a visual created with Scene::CreateVisuals
+    class GZ_RENDERING_VISIBLE VisualDescriptor
+    {
+      /// \brief Name of the visual, a unique name is generated if empty
+      public: std::string name;
+
+      /// \brief Parent of the visual, the root visual of the scene if null
+      public: VisualPtr parent;
+
+      /// \brief Pose of the visual relative to its parent
+      public: math::Pose3d localPose;
+
+      /// \brief Scale of the visual relative to its parent
+      public: math::Vector3d localScale = math::Vector3d::One;
+
+      /// \brief Mesh added as geometry of the visual. No geometry is added
+      /// if neither its mesh nor its mesh name is set.
+      public: MeshDescriptor mesh;
+
+      /// \brief Material of the visual and its geometry. It is shared, not
+      /// cloned, so visuals created together can be batched. Keeps the
+      /// default material if null.
+      public: MaterialPtr material;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_VOXELGRIDVISUAL_HH_
+#define GZ_RENDERING_VOXELGRIDVISUAL_HH_
+
+#include <gz/math/Color.hh>
+#include <gz/math/Vector3.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Visual.hh"
+#include "gz/rendering/RenderTypes.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class VoxelGridVisual VoxelGridVisual.hh
+    /// gz/rendering/VoxelGridVisual.hh
+    /// \brief A sparse grid of colored cubes, e.g. the occupied cells of an
+    /// occupancy map.
+    ///
+    /// Cells are addressed by integer coordinates; cell (i, j, k) spans
+    /// [i, i + 1) * Resolution() along x, and so on, in the frame of the
+    /// visual. Only the faces between occupied and free cells are
+    /// rendered. The grid is split in blocks of 16^3 cells and only the
+    /// blocks with changed cells are rebuilt on the next PreRender, so
+    /// maps can be updated incrementally.
+    class GZ_RENDERING_VISIBLE VoxelGridVisual :
+      public virtual Visual
+    {
+      /// \brief Constructor
+      protected: VoxelGridVisual();
+
+      /// \brief Destructor
+      public: virtual ~VoxelGridVisual();
+
+      /// \brief Set the edge length of the cells. Existing voxels keep
+      /// their cell coordinates.
+      /// \param[in] _resolution Edge length in meters, 0.1 by default
+      public: virtual void SetResolution(double _resolution) = 0;
+
+      /// \brief Get the edge length of the cells
+      /// \return Edge length in meters
+      public: virtual double Resolution() const = 0;
+
+      /// \brief Set a voxel, replacing the voxel of the cell if there is
+      /// one
+      /// \param[in] _cell Cell coordinates, each in [-2^24, 2^24)
+      /// \param[in] _color Color of the voxel, its alpha is ignored
+      /// \param[in] _occupancy Occupancy probability of the cell. Voxels
+      /// below the occupancy threshold are kept but not rendered.
+      /// \sa SetOccupancyThreshold
+      public: virtual void SetVoxel(const math::Vector3i &_cell,
+                  const math::Color &_color, double _occupancy = 1.0) = 0;
+
+      /// \brief Remove the voxel of a cell
+      /// \param[in] _cell Cell coordinates
+      /// \return True if the cell had a voxel
+      public: virtual bool RemoveVoxel(const math::Vector3i &_cell) = 0;
+
+      /// \brief Get whether a cell has a voxel
+      /// \param[in] _cell Cell coordinates
+      /// \return True if the cell has a voxel, rendered or not
+      public: virtual bool HasVoxel(const math::Vector3i &_cell) const = 0;
+
+      /// \brief Remove all voxels
+      public: virtual void ClearVoxels() = 0;
+
+      /// \brief Get the number of voxels, rendered or not
+      /// \return Number of voxels
+      public: virtual unsigned int VoxelCount() const = 0;
+
+      /// \brief Set the occupancy below which voxels are not rendered
+      /// \param[in] _threshold Occupancy threshold, 0.5 by default
+      public: virtual void SetOccupancyThreshold(double _threshold) = 0;
+
+      /// \brief Get the occupancy below which voxels are not rendered
+      /// \return Occupancy threshold
+      public: virtual double OccupancyThreshold() const = 0;
+
+      /// \brief Get the cell a position falls in
+      /// \param[in] _position Position in the frame of the visual
+      /// \return Cell coordinates
+      public: virtual math::Vector3i Cell(const math::Vector3d &_position)
+                  const = 0;
+
+      /// \brief Get the center of a cell
+      /// \param[in] _cell Cell coordinates
+      /// \return Center of the cell in the frame of the visual
+      public: virtual math::Vector3d CellCenter(const math::Vector3i &_cell)
+                  const = 0;
+
+      /// \brief Get the number of cube faces rendered, i.e. the faces of
+      /// rendered voxels that are not shared with another rendered voxel.
+      /// Updated by PreRender.
+      /// \return Number of rendered faces
+      public: virtual unsigned int RenderedFaceCount() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -18,6 +18,7 @@
 #define GZ_RENDERING_WIDEANGLECAMERA_HH_
 
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 
@@ -55,6 +56,15 @@ namespace gz
       public: virtual math::Vector3d Project3d(const math::Vector3d &_pt) const
            = 0;
 
+      /// \brief Project many 3D world coordinates to screen coordinates,
+      /// e.g. to annotate an image. This is faster than projecting the
+      /// points one by one.
+      /// \param[in] _pts 3D world coodinates
+      /// \return Screen coordinates of each point, see
+      /// Project3d(const math::Vector3d &)
+      public: virtual std::vector<math::Vector3d> Project3d(
+           const std::vector<math::Vector3d> &_pts) const = 0;
+
       /// \brief Subscribes a new listener to this camera's new frame event
       /// \param[in] _subscriber New camera listener callback
       public: virtual common::ConnectionPtr ConnectNewWideAngleFrame(
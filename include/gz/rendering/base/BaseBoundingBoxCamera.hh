@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_BASE_BASEBOUNDINGBOXCAMERA_HH_
 #define GZ_RENDERING_BASE_BASEBOUNDINGBOXCAMERA_HH_
 
+#include <functional>
+#include <string>
 #include <vector>
 
 #include <gz/common/Event.hh>
@@ -60,6 +62,22 @@ namespace gz
       public: virtual void DrawBoundingBox(unsigned char *_data,
         const math::Color &_color, const BoundingBox &_box) const = 0;
 
+      // Documentation inherited
+      public: virtual gz::common::ConnectionPtr ConnectNewSegmentationFrame(
+          std::function<void(const uint8_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) override;
+
+      // Documentation inherited
+      public: virtual void SetSegmentationType(SegmentationType _type)
+                  override;
+
+      // Documentation inherited
+      public: virtual SegmentationType SegmentationMapType() const override;
+
+      /// \brief The type of the segmentation image
+      protected: SegmentationType segmentationType =
+          SegmentationType::ST_SEMANTIC;
+
       /// \brief The bounding box type
       protected: BoundingBoxType type = BoundingBoxType::BBT_FULLBOX2D;
 
@@ -100,6 +118,31 @@ namespace gz
     {
       return this->type;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    gz::common::ConnectionPtr
+    BaseBoundingBoxCamera<T>::ConnectNewSegmentationFrame(
+        std::function<void(const uint8_t *, unsigned int, unsigned int,
+        unsigned int, const std::string &)>)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseBoundingBoxCamera<T>::SetSegmentationType(
+        SegmentationType _type)
+    {
+      this->segmentationType = _type;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    SegmentationType BaseBoundingBoxCamera<T>::SegmentationMapType() const
+    {
+      return this->segmentationType;
+    }
     }
   }
 }
@@ -143,6 +143,7 @@ namespace gz
 
       this->mass = _mass;
       this->dirtyCOMVisual = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
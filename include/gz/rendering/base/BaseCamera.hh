@@ -17,8 +17,17 @@
 #ifndef GZ_RENDERING_BASE_BASECAMERA_HH_
 #define GZ_RENDERING_BASE_BASECAMERA_HH_
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <gz/math/Frustum.hh>
+#include <gz/math/Helpers.hh>
 #include <gz/math/Matrix3.hh>
 #include <gz/math/Pose3.hh>
 
@@ -27,9 +36,11 @@
 #include <gz/utils/SuppressWarning.hh>
 
 #include "gz/rendering/Camera.hh"
+#include "gz/rendering/FrameEncoder.hh"
 #include "gz/rendering/Image.hh"
 #include "gz/rendering/RenderEngine.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Utils.hh"
 #include "gz/rendering/base/BaseRenderTarget.hh"
 
 namespace gz
@@ -77,6 +88,14 @@ namespace gz
 
       public: virtual void SetAntiAliasing(const unsigned int _aa) override;
 
+      // Documentation inherited.
+      public: virtual void SetAntiAliasingMode(
+                  CameraAntiAliasingMode _mode) override;
+
+      // Documentation inherited.
+      public: virtual CameraAntiAliasingMode AntiAliasingMode() const
+                  override;
+
       public: virtual double FarClipPlane() const override;
 
       public: virtual void SetFarClipPlane(const double _far) override;
@@ -85,6 +104,12 @@ namespace gz
 
       public: virtual void SetNearClipPlane(const double _near) override;
 
+      // Documentation inherited.
+      public: virtual double LodBias() const override;
+
+      // Documentation inherited.
+      public: virtual void SetLodBias(double _bias) override;
+
       // Documentation inherited.
       public: virtual void PreRender() override;
 
@@ -97,19 +122,114 @@ namespace gz
 
       public: virtual void Capture(Image &_image) override;
 
+      // Documentation inherited.
+      public: virtual std::future<bool> CaptureAsync(Image &_image) override;
+
+      // Documentation inherited.
+      public: virtual void RenderViewpoints(
+                  const std::vector<math::Pose3d> &_poses,
+                  Camera::ViewpointListener _listener,
+                  unsigned int _framesInFlight = 3u) override;
+
       public: virtual void Copy(Image &_image) const override;
 
+      // Documentation inherited.
+      public: virtual void SetReadbackRegion(const math::Vector2i &_offset,
+                  const math::Vector2i &_size) override;
+
+      // Documentation inherited.
+      public: virtual math::Vector2i ReadbackRegionOffset() const override;
+
+      // Documentation inherited.
+      public: virtual math::Vector2i ReadbackRegionSize() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int AddImageOutput(unsigned int _width,
+                  unsigned int _height) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ImageOutputCount() const override;
+
+      // Documentation inherited.
+      public: virtual math::Vector2i ImageOutputSize(unsigned int _index)
+                  const override;
+
+      // Documentation inherited.
+      public: virtual void RemoveImageOutputs() override;
+
+      // Documentation inherited.
+      public: virtual void CopyImageOutput(unsigned int _index,
+                  Image &_image) const override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewImageOutputFrame(
+                  unsigned int _index,
+                  Camera::NewFrameListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual void SetDynamicResolution(
+                  std::chrono::steady_clock::duration _targetFrameTime,
+                  double _minScale = 0.5) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  DynamicResolutionTarget() const override;
+
+      // Documentation inherited.
+      public: virtual double DynamicResolutionScale() const override;
+
+      // Documentation inherited.
+      public: virtual void SetResizeDelay(
+                  std::chrono::steady_clock::duration _delay) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  ResizeDelay() const override;
+
       public: virtual bool SaveFrame(const std::string &_name) override;
 
       public: virtual common::ConnectionPtr ConnectNewImageFrame(
                   Camera::NewFrameListener _listener) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::NewFrameViewListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual FrameInfo LastFrameInfo() const override;
+
+      // Documentation inherited.
+      public: virtual void SetSkipUnchangedFrames(bool _skip) override;
+
+      // Documentation inherited.
+      public: virtual bool SkipUnchangedFrames() const override;
+
+      // Documentation inherited.
+      public: virtual bool CheckFrameUnchanged() override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectFrameUnchanged(
+                  Camera::FrameUnchangedListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       public: virtual RenderWindowPtr CreateRenderWindow() override;
 
       // Documentation inherited.
       public: virtual VisualPtr VisualAt(const gz::math::Vector2i
                   &_mousePos) override;
 
+      // Documentation inherited.
+      public: virtual std::vector<VisualPtr> VisualsInRegion(
+                  const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) override;
+
+      // Documentation inherited.
+      public: virtual std::future<std::vector<VisualPtr>>
+                  VisualsInRegionAsync(const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) override;
+
       // Documentation inherited.
       public: virtual math::Matrix4d ProjectionMatrix() const override;
 
@@ -131,6 +251,10 @@ namespace gz
       public: virtual math::Vector2i Project(const math::Vector3d &_pt) const
                   override;
 
+      // Documentation inherited.
+      public: virtual void ProjectPoints(const math::Vector3d *_pts,
+                  math::Vector2d *_screenPts, size_t _count) const override;
+
       // Documentation inherited.
       // \sa Camera::SetMaterial(const MaterialPtr &) override;
       public: virtual void SetMaterial(const MaterialPtr &_material)
@@ -185,6 +309,9 @@ namespace gz
       public: virtual void RenderTextureMetalId(void *_textureIdPtr)
           const override;
 
+      // Documentation inherited.
+      public: virtual void *RenderTextureCudaPointer() const override;
+
       // Documentation inherited.
       public: virtual void PrepareForExternalSampling() override;
 
@@ -216,10 +343,58 @@ namespace gz
 
       protected: virtual RenderTargetPtr RenderTarget() const = 0;
 
+      /// \brief Get the world frustum that bounds what the camera sees,
+      /// used to skip unchanged frames
+      /// \param[out] _frustum World frustum of the camera
+      /// \return False if the view is not bounded by a frustum, e.g. of
+      /// orthographic or wide angle cameras, in which case any change of
+      /// the scene changes the frame
+      protected: virtual bool ViewFrustum(math::Frustum &_frustum) const;
+
+      /// \brief Notify the new frame listeners of the camera and of its
+      /// extra outputs, called by PostRender
+      protected: virtual void NotifyNewFrames();
+
+      /// \brief Record the metadata of the frame about to be rendered in
+      /// renderFrameInfo. Render engines call it right before submitting
+      /// the render commands of a frame.
+      protected: void BeginFrameInfo();
+
+      /// \brief Make a rendered frame the latest delivered frame, stamping
+      /// its readback time. Render engines call it right before passing the
+      /// frame to the new frame events.
+      /// \param[in] _info Metadata recorded by BeginFrameInfo when the frame
+      /// was rendered
+      protected: void EndFrameInfo(const FrameInfo &_info);
+
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       protected: common::EventT<void(const void *, unsigned int, unsigned int,
                      unsigned int, const std::string &)> newFrameEvent;
 
+      /// \brief Event notified for skipped frames, see
+      /// SetSkipUnchangedFrames
+      protected: common::EventT<void()> frameUnchangedEvent;
+
+      /// \brief Extra output of a different resolution, see AddImageOutput
+      protected: struct ImageOutput
+      {
+        /// \brief Output width in pixels
+        unsigned int width = 0u;
+
+        /// \brief Output height in pixels
+        unsigned int height = 0u;
+
+        /// \brief Event notified for new frames of the output
+        std::shared_ptr<common::EventT<void(const void *, unsigned int,
+            unsigned int, unsigned int, const std::string &)>> event;
+
+        /// \brief Frame passed to the listeners
+        Image frame;
+      };
+
+      /// \brief Extra outputs, by index
+      protected: std::vector<ImageOutput> imageOutputs;
+
       protected: ImagePtr imageBuffer;
 
       /// \brief Near clipping plane distance
@@ -228,6 +403,9 @@ namespace gz
       /// \brief Far clipping plane distance
       protected: double farClip = 1000.0;
 
+      /// \brief Level of detail bias
+      protected: double lodBias = 1.0;
+
       /// \brief Aspect ratio
       protected: double aspect = 1.3333333;
 
@@ -237,6 +415,9 @@ namespace gz
       /// \brief Anti-aliasing
       protected: unsigned int antiAliasing = 0u;
 
+      /// \brief Anti-aliasing method
+      protected: CameraAntiAliasingMode antiAliasingMode = CAAM_MSAA;
+
       /// \brief Target node to track if camera tracking is on.
       protected: NodePtr trackNode;
 
@@ -271,6 +452,37 @@ namespace gz
       /// \brief Camera projection type
       protected: CameraProjectionType projectionType = CPT_PERSPECTIVE;
 
+      /// \brief Top left pixel of the readback region
+      protected: math::Vector2i readbackOffset = math::Vector2i::Zero;
+
+      /// \brief Size of the readback region, zero for the full image
+      protected: math::Vector2i readbackSize = math::Vector2i::Zero;
+
+      /// \brief True to skip unchanged frames
+      protected: bool skipUnchangedFrames = false;
+
+      /// \brief True if a frame was rendered since unchanged frames are
+      /// skipped
+      protected: bool frameRendered = false;
+
+      /// \brief Change count of the scene when the last frame was rendered
+      protected: uint64_t frameChangeCount = 0u;
+
+      /// \brief World pose of the camera when the last frame was rendered
+      protected: math::Pose3d framePose;
+
+      /// \brief Projection matrix when the last frame was rendered
+      protected: math::Matrix4d frameProjection;
+
+      /// \brief Image size when the last frame was rendered
+      protected: math::Vector2i frameSize;
+
+      /// \brief Metadata of the frame rendered last
+      protected: FrameInfo renderFrameInfo;
+
+      /// \brief Metadata of the frame delivered last
+      protected: FrameInfo frameInfo;
+
       friend class BaseDepthCamera<T>;
     };
 
@@ -414,6 +626,43 @@ namespace gz
     void BaseCamera<T>::PostRender()
     {
       this->RenderTarget()->PostRender();
+      this->EndFrameInfo(this->renderFrameInfo);
+      this->NotifyNewFrames();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::NotifyNewFrames()
+    {
+      const PixelFormat format = this->ImageFormat();
+      const unsigned int channelCount = PixelUtil::ChannelCount(format);
+      if (this->newFrameEvent.ConnectionCount() > 0u)
+      {
+        // listeners receive the full image, even with a readback region
+        if (!this->imageBuffer ||
+            this->imageBuffer->Width() != this->ImageWidth() ||
+            this->imageBuffer->Height() != this->ImageHeight() ||
+            this->imageBuffer->Format() != format)
+        {
+          this->imageBuffer = std::make_shared<Image>(this->ImageWidth(),
+              this->ImageHeight(), format);
+        }
+        this->RenderTarget()->Copy(*this->imageBuffer);
+        this->newFrameEvent(this->imageBuffer->Data(),
+            this->imageBuffer->Width(), this->imageBuffer->Height(),
+            channelCount, PixelUtil::Name(format));
+      }
+
+      for (ImageOutput &output : this->imageOutputs)
+      {
+        if (output.event->ConnectionCount() == 0u)
+          continue;
+        if (output.frame.Format() != format)
+          output.frame = Image(output.width, output.height, format);
+        this->RenderTarget()->CopyResized(output.frame);
+        (*output.event)(output.frame.Data(), output.width, output.height,
+            channelCount, PixelUtil::Name(format));
+      }
     }
 
     //////////////////////////////////////////////////
@@ -423,6 +672,11 @@ namespace gz
       PixelFormat format = this->ImageFormat();
       unsigned int width = this->ImageWidth();
       unsigned int height = this->ImageHeight();
+      if (this->readbackSize.X() > 0)
+      {
+        width = static_cast<unsigned int>(this->readbackSize.X());
+        height = static_cast<unsigned int>(this->readbackSize.Y());
+      }
       return Image(width, height, format);
     }
 
@@ -430,35 +684,283 @@ namespace gz
     template <class T>
     void BaseCamera<T>::Update()
     {
+      if (this->IsIdle())
+        return;
+
       this->Scene()->PreRender();
+      if (this->CheckFrameUnchanged())
+      {
+        if (!this->Scene()->LegacyAutoGpuFlush())
+          this->Scene()->PostRender();
+        this->ClearCaptureRequest();
+        return;
+      }
       this->Render();
       this->PostRender();
       if (!this->Scene()->LegacyAutoGpuFlush())
       {
         this->Scene()->PostRender();
       }
+      this->ClearCaptureRequest();
     }
 
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::Capture(Image &_image)
     {
+      this->RequestCapture();
       this->Update();
       this->Copy(_image);
+      // the frame was just captured, do not render another one for it
+      this->ClearCaptureRequest();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::future<bool> BaseCamera<T>::CaptureAsync(Image &_image)
+    {
+      std::promise<bool> result;
+      this->Capture(_image);
+      result.set_value(true);
+      return result.get_future();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::RenderViewpoints(
+        const std::vector<math::Pose3d> &_poses,
+        Camera::ViewpointListener _listener, unsigned int _framesInFlight)
+    {
+      if (!_listener || _poses.empty())
+        return;
+      _framesInFlight = std::max(1u, _framesInFlight);
+
+      // only the camera moves between viewpoints, so the rest of the scene
+      // is pre-rendered again only where it changes
+      ScenePtr scene = this->Scene();
+      const bool dirtyTracking = scene->PreRenderDirtyTracking();
+      scene->SetPreRenderDirtyTracking(true);
+      const math::Pose3d pose = this->WorldPose();
+
+      // a viewpoint's image is reused once its frame was delivered
+      std::vector<Image> images(_framesInFlight);
+      for (Image &image : images)
+        image = this->CreateImage();
+      std::deque<std::pair<std::size_t, std::future<bool>>> pending;
+      auto deliver = [&]()
+      {
+        std::pair<std::size_t, std::future<bool>> &front = pending.front();
+        if (front.second.get())
+          _listener(front.first, images[front.first % _framesInFlight]);
+        pending.pop_front();
+      };
+
+      for (std::size_t i = 0u; i < _poses.size(); ++i)
+      {
+        if (pending.size() >= _framesInFlight)
+          deliver();
+        this->SetWorldPose(_poses[i]);
+        pending.emplace_back(i,
+            this->CaptureAsync(images[i % _framesInFlight]));
+      }
+      while (!pending.empty())
+        deliver();
+
+      this->SetWorldPose(pose);
+      scene->SetPreRenderDirtyTracking(dirtyTracking);
     }
 
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::Copy(Image &_image) const
     {
+      this->captureRequested = true;
+      if (this->readbackSize.X() > 0)
+      {
+        this->RenderTarget()->CopyRegion(_image,
+            static_cast<unsigned int>(this->readbackOffset.X()),
+            static_cast<unsigned int>(this->readbackOffset.Y()));
+        return;
+      }
       this->RenderTarget()->Copy(_image);
     }
 
     //////////////////////////////////////////////////
     template <class T>
-    bool BaseCamera<T>::SaveFrame(const std::string &/*_name*/)
+    void BaseCamera<T>::SetReadbackRegion(const math::Vector2i &_offset,
+        const math::Vector2i &_size)
     {
-      return false;
+      if (_size.X() == 0 && _size.Y() == 0)
+      {
+        this->readbackOffset = math::Vector2i::Zero;
+        this->readbackSize = math::Vector2i::Zero;
+        return;
+      }
+      if (_offset.X() < 0 || _offset.Y() < 0 || _size.X() <= 0 ||
+          _size.Y() <= 0 ||
+          static_cast<unsigned int>(_offset.X() + _size.X()) >
+          this->ImageWidth() ||
+          static_cast<unsigned int>(_offset.Y() + _size.Y()) >
+          this->ImageHeight())
+      {
+        gzerr << "Readback region [" << _offset << "][" << _size
+              << "] does not fit in the image of camera [" << this->Name()
+              << "]" << std::endl;
+        return;
+      }
+      this->readbackOffset = _offset;
+      this->readbackSize = _size;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector2i BaseCamera<T>::ReadbackRegionOffset() const
+    {
+      return this->readbackOffset;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector2i BaseCamera<T>::ReadbackRegionSize() const
+    {
+      return this->readbackSize;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCamera<T>::AddImageOutput(unsigned int _width,
+        unsigned int _height)
+    {
+      if (_width == 0u || _height == 0u)
+      {
+        gzerr << "Invalid image output size [" << _width << "x" << _height
+              << "] for camera [" << this->Name() << "]" << std::endl;
+        return static_cast<unsigned int>(this->imageOutputs.size());
+      }
+
+      ImageOutput output;
+      output.width = _width;
+      output.height = _height;
+      output.event = std::make_shared<common::EventT<void(const void *,
+          unsigned int, unsigned int, unsigned int, const std::string &)>>();
+      this->imageOutputs.push_back(std::move(output));
+      return static_cast<unsigned int>(this->imageOutputs.size() - 1u);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCamera<T>::ImageOutputCount() const
+    {
+      return static_cast<unsigned int>(this->imageOutputs.size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector2i BaseCamera<T>::ImageOutputSize(unsigned int _index) const
+    {
+      if (_index >= this->imageOutputs.size())
+        return math::Vector2i::Zero;
+      const ImageOutput &output = this->imageOutputs[_index];
+      return math::Vector2i(static_cast<int>(output.width),
+          static_cast<int>(output.height));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::RemoveImageOutputs()
+    {
+      this->imageOutputs.clear();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::CopyImageOutput(unsigned int _index,
+        Image &_image) const
+    {
+      if (_index >= this->imageOutputs.size())
+      {
+        gzerr << "Invalid image output [" << _index << "] of camera ["
+              << this->Name() << "]" << std::endl;
+        return;
+      }
+      const ImageOutput &output = this->imageOutputs[_index];
+      if (_image.Width() != output.width || _image.Height() != output.height)
+      {
+        gzerr << "Invalid image dimensions" << std::endl;
+        return;
+      }
+      this->captureRequested = true;
+      this->RenderTarget()->CopyResized(_image);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseCamera<T>::ConnectNewImageOutputFrame(
+        unsigned int _index, Camera::NewFrameListener _listener)
+    {
+      if (_index >= this->imageOutputs.size())
+      {
+        gzerr << "Invalid image output [" << _index << "] of camera ["
+              << this->Name() << "]" << std::endl;
+        return nullptr;
+      }
+      return this->imageOutputs[_index].event->Connect(_listener);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetDynamicResolution(
+        std::chrono::steady_clock::duration _targetFrameTime,
+        double /*_minScale*/)
+    {
+      if (_targetFrameTime > std::chrono::steady_clock::duration::zero())
+      {
+        gzerr << "Dynamic resolution is not supported by this camera or "
+              << "render engine" << std::endl;
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::chrono::steady_clock::duration
+        BaseCamera<T>::DynamicResolutionTarget() const
+    {
+      return std::chrono::steady_clock::duration::zero();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseCamera<T>::DynamicResolutionScale() const
+    {
+      return 1.0;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetResizeDelay(
+        std::chrono::steady_clock::duration _delay)
+    {
+      if (_delay > std::chrono::steady_clock::duration::zero())
+      {
+        gzerr << "Resize delay is not supported by this camera or "
+              << "render engine" << std::endl;
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::chrono::steady_clock::duration BaseCamera<T>::ResizeDelay() const
+    {
+      return std::chrono::steady_clock::duration::zero();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::SaveFrame(const std::string &_name)
+    {
+      Image image = this->CreateImage();
+      this->Copy(image);
+      return FrameEncoder::SavePng(image, _name);
     }
 
     //////////////////////////////////////////////////
@@ -469,13 +971,147 @@ namespace gz
       return newFrameEvent.Connect(_listener);
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::HasConnections() const
+    {
+      if (this->newFrameEvent.ConnectionCount() > 0u)
+        return true;
+      for (const ImageOutput &output : this->imageOutputs)
+      {
+        if (output.event->ConnectionCount() > 0u)
+          return true;
+      }
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseCamera<T>::ConnectNewFrameView(
+        Camera::NewFrameViewListener /*_listener*/)
+    {
+      gzerr << "Frame views are not supported by this sensor or render"
+          << " engine" << std::endl;
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    FrameInfo BaseCamera<T>::LastFrameInfo() const
+    {
+      return this->frameInfo;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::BeginFrameInfo()
+    {
+      ++this->renderFrameInfo.sequence;
+      this->renderFrameInfo.time = this->Scene()->Time();
+      this->renderFrameInfo.pose = this->WorldPose();
+      this->renderFrameInfo.submitTime = std::chrono::steady_clock::now();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::EndFrameInfo(const FrameInfo &_info)
+    {
+      this->frameInfo = _info;
+      this->frameInfo.readbackTime = std::chrono::steady_clock::now();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetSkipUnchangedFrames(bool _skip)
+    {
+      this->skipUnchangedFrames = _skip;
+      this->frameRendered = false;
+      if (_skip)
+        this->Scene()->ChangeTracker().SetEnabled(true);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::SkipUnchangedFrames() const
+    {
+      return this->skipUnchangedFrames;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::CheckFrameUnchanged()
+    {
+      if (!this->skipUnchangedFrames)
+        return false;
+
+      // nothing is known about changes while the tracker is disabled
+      SceneChangeTracker &tracker = this->Scene()->ChangeTracker();
+      if (!tracker.Enabled())
+        return false;
+      tracker.Flush();
+
+      const math::Pose3d pose = this->WorldPose();
+      const math::Matrix4d projection = this->ProjectionMatrix();
+      const math::Vector2i size(static_cast<int>(this->ImageWidth()),
+          static_cast<int>(this->ImageHeight()));
+      bool unchanged = this->frameRendered && pose == this->framePose &&
+          projection == this->frameProjection && size == this->frameSize;
+      if (unchanged)
+      {
+        math::Frustum frustum;
+        if (this->ViewFrustum(frustum))
+          unchanged = !tracker.ChangedSince(this->frameChangeCount, frustum);
+        else
+          unchanged = !tracker.ChangedSince(this->frameChangeCount);
+      }
+
+      // changes outside of the frustum do not need to be checked again
+      this->frameChangeCount = tracker.ChangeCount();
+      if (unchanged)
+      {
+        this->frameUnchangedEvent();
+        return true;
+      }
+
+      this->frameRendered = true;
+      this->framePose = pose;
+      this->frameProjection = projection;
+      this->frameSize = size;
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseCamera<T>::ConnectFrameUnchanged(
+        Camera::FrameUnchangedListener _listener)
+    {
+      return this->frameUnchangedEvent.Connect(_listener);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::ViewFrustum(math::Frustum &_frustum) const
+    {
+      // the frustum is built from the field of view, it does not bound
+      // other projections and is degenerate for very wide views
+      if (this->ProjectionType() != CPT_PERSPECTIVE ||
+          this->HFOV().Radian() >= GZ_DTOR(179.0))
+      {
+        return false;
+      }
+
+      _frustum = math::Frustum(this->NearClipPlane(), this->FarClipPlane(),
+          this->HFOV(), this->AspectRatio(), this->WorldPose());
+      return true;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void *BaseCamera<T>::CreateImageBuffer() const
     {
       // TODO(anyone): determine proper type
       unsigned int size = this->ImageMemorySize();
-      return new unsigned char *[size];
+      return new unsigned char[size];
     }
 
     //////////////////////////////////////////////////
@@ -639,6 +1275,15 @@ namespace gz
       return screenPos;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::ProjectPoints(const math::Vector3d *_pts,
+        math::Vector2d *_screenPts, size_t _count) const
+    {
+      projectPoints(this->ProjectionMatrix() * this->ViewMatrix(),
+          this->ImageWidth(), this->ImageHeight(), _pts, _screenPts, _count);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     math::Angle BaseCamera<T>::HFOV() const
@@ -655,6 +1300,27 @@ namespace gz
       return VisualPtr();
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<VisualPtr> BaseCamera<T>::VisualsInRegion(
+        const gz::math::Vector2i &/*_min*/,
+        const gz::math::Vector2i &/*_max*/)
+    {
+      gzerr << "VisualsInRegion not implemented for the render engine"
+            << std::endl;
+      return std::vector<VisualPtr>();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::future<std::vector<VisualPtr>> BaseCamera<T>::VisualsInRegionAsync(
+        const gz::math::Vector2i &_min, const gz::math::Vector2i &_max)
+    {
+      std::promise<std::vector<VisualPtr>> result;
+      result.set_value(this->VisualsInRegion(_min, _max));
+      return result.get_future();
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::SetHFOV(const math::Angle &_hfov)
@@ -698,6 +1364,20 @@ namespace gz
       this->antiAliasing = _aa;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetAntiAliasingMode(CameraAntiAliasingMode _mode)
+    {
+      this->antiAliasingMode = _mode;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    CameraAntiAliasingMode BaseCamera<T>::AntiAliasingMode() const
+    {
+      return this->antiAliasingMode;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     double BaseCamera<T>::FarClipPlane() const
@@ -726,6 +1406,25 @@ namespace gz
       this->nearClip = _near;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseCamera<T>::LodBias() const
+    {
+      return this->lodBias;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetLodBias(double _bias)
+    {
+      if (_bias <= 0.0)
+      {
+        gzerr << "Level of detail bias must be greater than 0" << std::endl;
+        return;
+      }
+      this->lodBias = _bias;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::SetTrackTarget(const NodePtr &_target,
@@ -841,6 +1540,15 @@ namespace gz
           << " engine" << std::endl;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void *BaseCamera<T>::RenderTextureCudaPointer() const
+    {
+      gzerr << "RenderTextureCudaPointer is not supported by current render"
+          << " engine" << std::endl;
+      return nullptr;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::PrepareForExternalSampling()
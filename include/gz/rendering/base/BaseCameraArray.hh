@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASE_BASECAMERAARRAY_HH_
+#define GZ_RENDERING_BASE_BASECAMERAARRAY_HH_
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Frustum.hh>
+#include <gz/math/Helpers.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/CameraArray.hh"
+#include "gz/rendering/Geometry.hh"
+#include "gz/rendering/Light.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/ParticleEmitter.hh"
+#include "gz/rendering/Projector.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Base implementation of a camera array
+    template <class T>
+    class BaseCameraArray :
+      public virtual CameraArray,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseCameraArray();
+
+      /// \brief Destructor
+      public: virtual ~BaseCameraArray();
+
+      // Documentation inherited.
+      public: virtual CameraPtr AddView(const math::Pose3d &_pose) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ViewCount() const override;
+
+      // Documentation inherited.
+      public: virtual CameraPtr ViewByIndex(unsigned int _index) const
+                  override;
+
+      // Documentation inherited.
+      public: virtual void SetSharedCulling(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool SharedCulling() const override;
+
+      // Documentation inherited.
+      public: virtual void Update() override;
+
+      // Documentation inherited.
+      public: virtual unsigned int CulledVisualCount() const override;
+
+      // Documentation inherited.
+      public: virtual bool IsCulled(ConstVisualPtr _visual) const override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      /// \brief Hide a visual and its subtree while the views render, or
+      /// show it again. Render engines hide the visual without changing
+      /// Visual::Visible, so that the user's visibility and the scene
+      /// change tracker stay untouched.
+      /// \param[in] _visual Visual outside of every view
+      /// \param[in] _culled True to hide the visual, false to restore it
+      protected: virtual void SetVisualCulled(const VisualPtr &_visual,
+                     bool _culled) = 0;
+
+      /// \brief Hide the top level visuals that are outside of every view
+      protected: virtual void CullVisuals();
+
+      /// \brief Restore the visuals hidden by CullVisuals
+      protected: virtual void RestoreCulledVisuals();
+
+      /// \brief Check if a visual or its subtree may cast a shadow
+      /// \param[in] _visual Visual to check
+      /// \return True if a material of the subtree casts shadows or the
+      /// material is unknown
+      protected: bool CastsShadows(const VisualPtr &_visual) const;
+
+      /// \brief Check if a node or its subtree holds lights, projectors or
+      /// particle emitters, whose effect reaches beyond the bounding box
+      /// of the node
+      /// \param[in] _node Node to check
+      /// \return True if the subtree has such an object
+      protected: bool HasEmitters(const NodePtr &_node) const;
+
+      /// \brief Cameras of the views, in the order they were added
+      protected: std::vector<CameraPtr> views;
+
+      /// \brief True if the shared cull pass is enabled
+      protected: bool sharedCulling = true;
+
+      /// \brief True while Update waits for the scene's PreRender, which
+      /// applies the queued scene changes before the cull pass
+      protected: bool cullPending = false;
+
+      /// \brief Visuals hidden during the current Update
+      protected: std::vector<VisualPtr> culledVisuals;
+
+      /// \brief Ids of the visuals culled by the last Update
+      protected: std::set<unsigned int> culledIds;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseCameraArray<T>::BaseCameraArray()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseCameraArray<T>::~BaseCameraArray()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    CameraPtr BaseCameraArray<T>::AddView(const math::Pose3d &_pose)
+    {
+      CameraPtr view = this->Scene()->CreateCamera();
+      if (!view)
+        return nullptr;
+
+      view->SetLocalPose(_pose);
+      this->AddChild(view);
+      this->views.push_back(view);
+      return view;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::ViewCount() const
+    {
+      return static_cast<unsigned int>(this->views.size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    CameraPtr BaseCameraArray<T>::ViewByIndex(unsigned int _index) const
+    {
+      if (_index >= this->views.size())
+        return nullptr;
+      return this->views[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetSharedCulling(bool _enabled)
+    {
+      this->sharedCulling = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCameraArray<T>::SharedCulling() const
+    {
+      return this->sharedCulling;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::Update()
+    {
+      if (this->IsIdle())
+        return;
+
+      this->culledIds.clear();
+      this->cullPending = this->sharedCulling;
+
+      std::vector<SensorPtr> sensors(this->views.begin(), this->views.end());
+      this->Scene()->RenderSensors(sensors);
+
+      this->cullPending = false;
+      this->RestoreCulledVisuals();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::CulledVisualCount() const
+    {
+      return static_cast<unsigned int>(this->culledIds.size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCameraArray<T>::IsCulled(ConstVisualPtr _visual) const
+    {
+      return _visual && this->culledIds.count(_visual->Id()) > 0;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::PreRender()
+    {
+      T::PreRender();
+
+      // the scene's PreRender calls this once the queued commands have
+      // been applied, so the cull pass sees the poses that are rendered
+      if (this->cullPending)
+      {
+        this->cullPending = false;
+        this->CullVisuals();
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::Destroy()
+    {
+      this->RestoreCulledVisuals();
+
+      // views that the scene destroyed already are skipped, e.g. while
+      // the scene itself is destroyed
+      ScenePtr scene = this->Scene();
+      for (auto &view : this->views)
+      {
+        if (scene->HasSensor(view))
+          scene->DestroySensor(view);
+      }
+      this->views.clear();
+      T::Destroy();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::CullVisuals()
+    {
+      // the frustum is built from the field of view like
+      // BaseCamera::ViewFrustum does, a view that it does not bound could
+      // see anything
+      std::vector<math::Frustum> frustums;
+      for (const auto &view : this->views)
+      {
+        if (view->ProjectionType() != CPT_PERSPECTIVE ||
+            view->HFOV().Radian() >= GZ_DTOR(179.0))
+        {
+          return;
+        }
+        frustums.emplace_back(view->NearClipPlane(), view->FarClipPlane(),
+            view->HFOV(), view->AspectRatio(), view->WorldPose());
+      }
+      if (frustums.empty())
+        return;
+
+      ScenePtr scene = this->Scene();
+      bool shadows = false;
+      for (unsigned int i = 0; i < scene->LightCount() && !shadows; ++i)
+        shadows = scene->LightByIndex(i)->CastShadows();
+
+      VisualPtr root = scene->RootVisual();
+      for (unsigned int i = 0; i < root->ChildCount(); ++i)
+      {
+        VisualPtr visual =
+            std::dynamic_pointer_cast<Visual>(root->ChildByIndex(i));
+        if (!visual || !visual->Visible())
+          continue;
+
+        // a visual behind the views can still shadow or light what they
+        // see
+        if (shadows && this->CastsShadows(visual))
+          continue;
+        if (this->HasEmitters(visual))
+          continue;
+
+        // the bounds of visuals without geometry are unknown
+        math::AxisAlignedBox box = visual->BoundingBox();
+        if (box == math::AxisAlignedBox())
+          continue;
+
+        bool seen = false;
+        for (const auto &frustum : frustums)
+        {
+          if (frustum.Contains(box))
+          {
+            seen = true;
+            break;
+          }
+        }
+        if (seen)
+          continue;
+
+        this->SetVisualCulled(visual, true);
+        this->culledVisuals.push_back(visual);
+        this->culledIds.insert(visual->Id());
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::RestoreCulledVisuals()
+    {
+      for (auto &visual : this->culledVisuals)
+        this->SetVisualCulled(visual, false);
+      this->culledVisuals.clear();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCameraArray<T>::CastsShadows(const VisualPtr &_visual) const
+    {
+      MaterialPtr material = _visual->Material();
+      if (material && material->CastShadows())
+        return true;
+
+      for (unsigned int i = 0; i < _visual->GeometryCount(); ++i)
+      {
+        material = _visual->GeometryByIndex(i)->Material();
+        if (!material || material->CastShadows())
+          return true;
+      }
+
+      for (unsigned int i = 0; i < _visual->ChildCount(); ++i)
+      {
+        VisualPtr child =
+            std::dynamic_pointer_cast<Visual>(_visual->ChildByIndex(i));
+        if (child && this->CastsShadows(child))
+          return true;
+      }
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCameraArray<T>::HasEmitters(const NodePtr &_node) const
+    {
+      if (std::dynamic_pointer_cast<Light>(_node) ||
+          std::dynamic_pointer_cast<Projector>(_node) ||
+          std::dynamic_pointer_cast<ParticleEmitter>(_node))
+      {
+        return true;
+      }
+
+      for (unsigned int i = 0; i < _node->ChildCount(); ++i)
+      {
+        if (this->HasEmitters(_node->ChildByIndex(i)))
+          return true;
+      }
+      return false;
+    }
+    }
+  }
+}
+#endif
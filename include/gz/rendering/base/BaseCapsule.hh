@@ -86,6 +86,7 @@ namespace gz
     {
       this->radius = _radius;
       this->capsuleDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -101,6 +102,7 @@ namespace gz
     {
       this->length = _length;
       this->capsuleDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
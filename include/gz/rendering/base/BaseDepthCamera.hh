@@ -17,8 +17,11 @@
 #ifndef GZ_RENDERING_BASE_BASEDEPTHCAMERA_HH_
 #define GZ_RENDERING_BASE_BASEDEPTHCAMERA_HH_
 
+#include <chrono>
+#include <memory>
 #include <string>
 
+#include <gz/common/Console.hh>
 #include <gz/common/Event.hh>
 
 #include "gz/rendering/base/BaseCamera.hh"
@@ -43,6 +46,10 @@ namespace gz
 
       public: virtual const float *DepthData() const;
 
+      // Documentation inherited.
+      public: virtual std::shared_ptr<const float> AcquireDepthData() const
+          override;
+
       public: virtual gz::common::ConnectionPtr ConnectNewDepthFrame(
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber);
@@ -50,6 +57,62 @@ namespace gz
       public: virtual gz::common::ConnectionPtr ConnectNewRGBPointCloud(
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber);
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewPackedPointCloud(
+          NewPackedPointCloudListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual void SetPackedPointCloudFilterInvalid(bool _filter)
+          override;
+
+      // Documentation inherited.
+      public: virtual bool PackedPointCloudFilterInvalid() const override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewRgbFrame(
+          Camera::NewFrameListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual void SetRgbFrameFormat(PixelFormat _format) override;
+
+      // Documentation inherited.
+      public: virtual PixelFormat RgbFrameFormat() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReadbackBufferCount(unsigned int _count)
+          override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ReadbackBufferCount() const override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration DepthDataTime()
+          const override;
+
+      // Documentation inherited.
+      public: virtual void SetOutputFormat(DepthCameraOutputFormat _format)
+          override;
+
+      // Documentation inherited.
+      public: virtual DepthCameraOutputFormat OutputFormat() const override;
+
+      /// \brief Whether invalid points are removed from the packed point
+      /// cloud
+      protected: bool packedPointCloudFilterInvalid = false;
+
+      /// \brief Number of buffers used to read back depth data
+      protected: unsigned int readbackBufferCount = 1u;
+
+      /// \brief Scene time at which the latest delivered depth frame was
+      /// rendered
+      protected: std::chrono::steady_clock::duration depthDataTime{0};
+
+      /// \brief Layout of the depth image
+      protected: DepthCameraOutputFormat outputFormat = DCOF_DEPTH_FLOAT32;
+
+      /// \brief Pixel format of the rgb images
+      protected: PixelFormat rgbFrameFormat = PF_R8G8B8;
     };
 
     //////////////////////////////////////////////////
@@ -77,6 +140,13 @@ namespace gz
       return nullptr;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::shared_ptr<const float> BaseDepthCamera<T>::AcquireDepthData() const
+    {
+      return nullptr;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     gz::common::ConnectionPtr BaseDepthCamera<T>::ConnectNewDepthFrame(
@@ -94,6 +164,100 @@ namespace gz
     {
       return nullptr;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseDepthCamera<T>::ConnectNewPackedPointCloud(
+        NewPackedPointCloudListener)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthCamera<T>::SetPackedPointCloudFilterInvalid(bool _filter)
+    {
+      this->packedPointCloudFilterInvalid = _filter;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseDepthCamera<T>::PackedPointCloudFilterInvalid() const
+    {
+      return this->packedPointCloudFilterInvalid;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseDepthCamera<T>::ConnectNewRgbFrame(
+        Camera::NewFrameListener)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthCamera<T>::SetRgbFrameFormat(PixelFormat _format)
+    {
+      if (_format != PF_R8G8B8 && _format != PF_B8G8R8 &&
+          _format != PF_R8G8B8A8)
+      {
+        gzerr << "DepthCamera rgb frame format ["
+              << PixelUtil::Name(_format) << "] is not supported"
+              << std::endl;
+        return;
+      }
+      this->rgbFrameFormat = _format;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    PixelFormat BaseDepthCamera<T>::RgbFrameFormat() const
+    {
+      return this->rgbFrameFormat;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthCamera<T>::SetReadbackBufferCount(unsigned int _count)
+    {
+      this->readbackBufferCount = _count;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseDepthCamera<T>::ReadbackBufferCount() const
+    {
+      return this->readbackBufferCount;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::chrono::steady_clock::duration BaseDepthCamera<T>::DepthDataTime()
+        const
+    {
+      return this->depthDataTime;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseDepthCamera<T>::SetOutputFormat(DepthCameraOutputFormat _format)
+    {
+      if (_format != DCOF_DEPTH_FLOAT32)
+      {
+        gzerr << "DepthCamera output format [" << _format << "] is not "
+              << "supported by this render engine" << std::endl;
+        return;
+      }
+      this->outputFormat = _format;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    DepthCameraOutputFormat BaseDepthCamera<T>::OutputFormat() const
+    {
+      return this->outputFormat;
+    }
   }
   }
 }
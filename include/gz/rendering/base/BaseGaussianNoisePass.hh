@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_BASE_BASEGAUSSIANNOISEPASS_HH_
 #define GZ_RENDERING_BASE_BASEGAUSSIANNOISEPASS_HH_
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <gz/math/Rand.hh>
 
@@ -64,6 +66,12 @@ namespace gz
       // Documentation inherited.
       public: void SetBiasStdDev(double _biasStdDev);
 
+      // Documentation inherited.
+      public: void SetSeed(unsigned int _seed);
+
+      // Documentation inherited.
+      public: unsigned int Seed() const;
+
       // Sample the bias from bias mean and bias standard deviation
       protected: void SampleBias();
 
@@ -83,6 +91,13 @@ namespace gz
       /// \brief The standard deviation of the Gaussian distribution from
       /// which bias values are drawn.
       protected: double biasStdDev = 0;
+
+      /// \brief Seed of the noise
+      protected: unsigned int seed = 0u;
+
+      /// \brief Number of frames rendered since the seed was set. It is
+      /// the counter of the per pixel noise generator.
+      protected: uint32_t frame = 0u;
     };
 
     //////////////////////////////////////////////////
@@ -91,6 +106,8 @@ namespace gz
     template <class T>
     BaseGaussianNoisePass<T>::BaseGaussianNoisePass()
     {
+      this->seed = static_cast<unsigned int>(gz::math::Rand::IntUniform(0,
+          std::numeric_limits<int>::max()));
     }
 
     //////////////////////////////////////////////////
@@ -150,6 +167,21 @@ namespace gz
       this->SampleBias();
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseGaussianNoisePass<T>::SetSeed(unsigned int _seed)
+    {
+      this->seed = _seed;
+      this->frame = 0u;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseGaussianNoisePass<T>::Seed() const
+    {
+      return this->seed;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseGaussianNoisePass<T>::SampleBias()
@@ -321,6 +321,7 @@ namespace gz
       // clear active axis when mode changes
       this->axis = math::Vector3d::Zero;
       this->modeDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -339,6 +340,7 @@ namespace gz
 
       this->axis = _axis;
       this->modeDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -66,6 +66,9 @@ namespace gz
 
       // Documentation inherited.
       public: virtual const uint32_t* OctantCount() const override;
+
+      // Documentation inherited.
+      public: virtual bool BuildIfChanged() override;
     };
 
     //////////////////////////////////////////////////
@@ -160,6 +163,14 @@ namespace gz
       static const uint32_t tmp[3] = { 1u, 1u, 1u };
       return tmp;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseGlobalIlluminationVct<T>::BuildIfChanged()
+    {
+      this->Build();
+      return true;
+    }
     }
   }
 }
@@ -17,7 +17,10 @@
 #ifndef GZ_RENDERING_BASE_BASEGPURAYS_HH_
 #define GZ_RENDERING_BASE_BASEGPURAYS_HH_
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 #include <gz/common/Console.hh>
@@ -56,6 +59,10 @@ namespace gz
       // Documentation inherited.
       public: virtual void Copy(float *_data) override;
 
+      // Documentation inherited.
+      public: virtual std::shared_ptr<const float> AcquireData() const
+          override;
+
       // Documentation inherited.
       public: virtual void SetClamp(bool _enable) override;
 
@@ -151,6 +158,63 @@ namespace gz
       // Documentation inherited.
       public: virtual double VerticalResolution() const override;
 
+      // Documentation inherited.
+      public: virtual void SetOutputFormat(GpuRaysOutputFormat _format)
+              override;
+
+      // Documentation inherited.
+      public: virtual GpuRaysOutputFormat OutputFormat() const override;
+
+      // Documentation inherited.
+      public: virtual void SetReadbackBufferCount(unsigned int _count)
+              override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ReadbackBufferCount() const override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration DataTime()
+              const override;
+
+      // Documentation inherited.
+      public: virtual void SetRayDirections(
+              const std::vector<math::Vector2d> &_directions,
+              unsigned int _width) override;
+
+      // Documentation inherited.
+      public: virtual const std::vector<math::Vector2d> &RayDirections()
+              const override;
+
+      // Documentation inherited.
+      public: virtual void SetScanMotion(const math::Pose3d &_start,
+              const math::Pose3d &_end) override;
+
+      // Documentation inherited.
+      public: virtual void ClearScanMotion() override;
+
+      // Documentation inherited.
+      public: virtual bool HasScanMotion() const override;
+
+      // Documentation inherited.
+      public: virtual void SetBeamDivergence(double _divergence,
+              unsigned int _samples) override;
+
+      // Documentation inherited.
+      public: virtual double BeamDivergence() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int BeamSampleCount() const override;
+
+      // Documentation inherited.
+      public: virtual void SetPointCloudCompaction(bool _compact) override;
+
+      // Documentation inherited.
+      public: virtual bool PointCloudCompaction() const override;
+
+      // Documentation inherited.
+      protected: virtual bool ViewFrustum(math::Frustum &_frustum) const
+                     override;
+
       /// \brief maximum value used for data outside sensor range
       public: float dataMaxVal = gz::math::INF_D;
 
@@ -200,6 +264,30 @@ namespace gz
       /// \brief Number of channels used to store the data
       protected: unsigned int channels = 1u;
 
+      /// \brief Layout of the data produced by the sensor
+      protected: GpuRaysOutputFormat outputFormat = GROF_RANGE_RETRO_FLOAT32;
+
+      /// \brief Number of buffers used to read back data from the GPU
+      protected: unsigned int readbackBufferCount = 1u;
+
+      /// \brief Scene time at which the latest delivered frame was rendered
+      protected: std::chrono::steady_clock::duration dataTime{0};
+
+      /// \brief Directions of the scan pattern, empty for the regular grid
+      protected: std::vector<math::Vector2d> rayDirections;
+
+      /// \brief Number of rays per output row of the scan pattern
+      protected: unsigned int rayDirectionsWidth = 0u;
+
+      /// \brief Full angle of the beam cone in radians
+      protected: double beamDivergence = 0.0;
+
+      /// \brief Number of samples per beam
+      protected: unsigned int beamSamples = 1u;
+
+      /// \brief True to drop the rays without a return from point clouds
+      protected: bool pointCloudCompaction = false;
+
       private: friend class OgreScene;
     };
 
@@ -230,6 +318,13 @@ namespace gz
       (void)_dataDest;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::shared_ptr<const float> BaseGpuRays<T>::AcquireData() const
+    {
+      return nullptr;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseGpuRays<T>::SetClamp(bool _enable)
@@ -360,6 +455,8 @@ namespace gz
     //////////////////////////////////////////////////
     int BaseGpuRays<T>::RangeCount() const
     {
+      if (!this->rayDirections.empty())
+        return static_cast<int>(this->rayDirectionsWidth);
       return static_cast<int>(this->RayCount() * this->hResolution);
     }
 
@@ -381,6 +478,11 @@ namespace gz
     //////////////////////////////////////////////////
     int BaseGpuRays<T>::VerticalRangeCount() const
     {
+      if (!this->rayDirections.empty())
+      {
+        return static_cast<int>(
+            this->rayDirections.size() / this->rayDirectionsWidth);
+      }
       return static_cast<int>(this->VerticalRayCount() * this->vResolution);
     }
 
@@ -416,7 +518,20 @@ namespace gz
     //////////////////////////////////////////////////
     unsigned int BaseGpuRays<T>::Channels() const
     {
-      return this->channels;
+      switch (this->outputFormat)
+      {
+        case GROF_RANGE_FLOAT32:
+        case GROF_RANGE_UINT16_MM:
+          return 1u;
+        case GROF_RANGE_RETRO_FLOAT16:
+          return 2u;
+        case GROF_MULTI_RETURN_FLOAT32:
+        case GROF_POINT_XYZI_FLOAT32:
+          return 4u;
+        case GROF_RANGE_RETRO_FLOAT32:
+        default:
+          return this->channels;
+      }
     }
 
     template <class T>
@@ -446,6 +561,132 @@ namespace gz
     {
       return this->vResolution;
     }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetOutputFormat(GpuRaysOutputFormat _format)
+    {
+      if (_format != GROF_RANGE_RETRO_FLOAT32)
+      {
+        gzerr << "GpuRays output format [" << _format << "] is not "
+              << "supported by this render engine" << std::endl;
+        return;
+      }
+      this->outputFormat = _format;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    GpuRaysOutputFormat BaseGpuRays<T>::OutputFormat() const
+    {
+      return this->outputFormat;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetReadbackBufferCount(unsigned int _count)
+    {
+      this->readbackBufferCount = _count;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    unsigned int BaseGpuRays<T>::ReadbackBufferCount() const
+    {
+      return this->readbackBufferCount;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    std::chrono::steady_clock::duration BaseGpuRays<T>::DataTime() const
+    {
+      return this->dataTime;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetRayDirections(
+        const std::vector<math::Vector2d> &/*_directions*/,
+        unsigned int /*_width*/)
+    {
+      gzerr << "GpuRays scan patterns are not supported by this render "
+            << "engine" << std::endl;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    const std::vector<math::Vector2d> &BaseGpuRays<T>::RayDirections() const
+    {
+      return this->rayDirections;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetScanMotion(const math::Pose3d &/*_start*/,
+        const math::Pose3d &/*_end*/)
+    {
+      gzerr << "GpuRays scan motion is not supported by this render engine"
+            << std::endl;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::ClearScanMotion()
+    {
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::HasScanMotion() const
+    {
+      return false;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetBeamDivergence(double /*_divergence*/,
+        unsigned int /*_samples*/)
+    {
+      gzerr << "GpuRays beam divergence is not supported by this render "
+            << "engine" << std::endl;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    double BaseGpuRays<T>::BeamDivergence() const
+    {
+      return this->beamDivergence;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    unsigned int BaseGpuRays<T>::BeamSampleCount() const
+    {
+      return this->beamSamples;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    void BaseGpuRays<T>::SetPointCloudCompaction(bool _compact)
+    {
+      this->pointCloudCompaction = _compact;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::PointCloudCompaction() const
+    {
+      return this->pointCloudCompaction;
+    }
+
+    template <class T>
+    //////////////////////////////////////////////////
+    bool BaseGpuRays<T>::ViewFrustum(math::Frustum &/*_frustum*/) const
+    {
+      // the rays are rendered by cameras covering their angular range,
+      // which the single frustum of the field of view does not bound
+      return false;
+    }
     }
   }
 }
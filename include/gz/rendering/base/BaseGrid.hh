@@ -106,6 +106,7 @@ namespace gz
     {
       this->cellCount = _count;
       this->gridDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -121,6 +122,7 @@ namespace gz
     {
       this->cellLength = _len;
       this->gridDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -136,6 +138,7 @@ namespace gz
     {
       this->verticalCellCount = _count;
       this->gridDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
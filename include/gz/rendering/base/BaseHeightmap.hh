@@ -17,6 +17,12 @@
 #ifndef GZ_RENDERING_BASE_BASEHEIGHTMAP_HH_
 #define GZ_RENDERING_BASE_BASEHEIGHTMAP_HH_
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
 #include "gz/rendering/Heightmap.hh"
 
 namespace gz
@@ -44,8 +50,55 @@ namespace gz
       // Documentation inherited
       public: virtual const HeightmapDescriptor &Descriptor() override;
 
+      // Documentation inherited
+      public: virtual bool IsLoaded() const override;
+
+      // Documentation inherited
+      public: virtual void SetShadowUpdateThreshold(
+                  const math::Angle &_angle) override;
+
+      // Documentation inherited
+      public: virtual math::Angle ShadowUpdateThreshold() const override;
+
+      // Documentation inherited
+      public: virtual void SetShadowUpdateInterval(unsigned int _frames)
+                  override;
+
+      // Documentation inherited
+      public: virtual unsigned int ShadowUpdateInterval() const override;
+
+      // Documentation inherited
+      public: virtual void SetLodUpdateDistance(double _distance) override;
+
+      // Documentation inherited
+      public: virtual double LodUpdateDistance() const override;
+
+      // Documentation inherited
+      public: virtual void SetTextureUnloadFrames(unsigned int _frames)
+                  override;
+
+      // Documentation inherited
+      public: virtual unsigned int TextureUnloadFrames() const override;
+
+      // Documentation inherited
+      public: virtual std::vector<double> HeightsAt(
+                  const std::vector<math::Vector2d> &_positions) const
+                  override;
+
       /// \brief Descriptor containing heightmap information
       public: HeightmapDescriptor descriptor;
+
+      /// \brief Minimum light direction change that updates the shadows
+      protected: math::Angle shadowUpdateThreshold;
+
+      /// \brief Minimum number of frames between shadow updates
+      protected: unsigned int shadowUpdateInterval = 0u;
+
+      /// \brief Camera movement that selects the terrain cells again
+      protected: double lodUpdateDistance = 0.0;
+
+      /// \brief Frames without being seen that unload the layer textures
+      protected: unsigned int textureUnloadFrames = 0u;
     };
 
     //////////////////////////////////////////////////
@@ -75,6 +128,80 @@ namespace gz
     {
       return this->descriptor;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseHeightmap<T>::IsLoaded() const
+    {
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseHeightmap<T>::SetShadowUpdateThreshold(const math::Angle &_angle)
+    {
+      this->shadowUpdateThreshold = _angle;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseHeightmap<T>::ShadowUpdateThreshold() const
+    {
+      return this->shadowUpdateThreshold;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseHeightmap<T>::SetShadowUpdateInterval(unsigned int _frames)
+    {
+      this->shadowUpdateInterval = _frames;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseHeightmap<T>::ShadowUpdateInterval() const
+    {
+      return this->shadowUpdateInterval;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseHeightmap<T>::SetLodUpdateDistance(double _distance)
+    {
+      this->lodUpdateDistance = std::max(0.0, _distance);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseHeightmap<T>::LodUpdateDistance() const
+    {
+      return this->lodUpdateDistance;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseHeightmap<T>::SetTextureUnloadFrames(unsigned int _frames)
+    {
+      this->textureUnloadFrames = _frames;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseHeightmap<T>::TextureUnloadFrames() const
+    {
+      return this->textureUnloadFrames;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<double> BaseHeightmap<T>::HeightsAt(
+        const std::vector<math::Vector2d> &_positions) const
+    {
+      gzerr << "HeightsAt is not supported by current render engine"
+            << std::endl;
+      return std::vector<double>(_positions.size(),
+          std::numeric_limits<double>::quiet_NaN());
+    }
     }
   }
 }
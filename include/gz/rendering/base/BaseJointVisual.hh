@@ -276,6 +276,7 @@ namespace gz
       this->axis = _axis;
       this->useParentFrame = _useParentFrame;
       this->dirtyAxis = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -318,6 +319,7 @@ namespace gz
       this->parentAxisUseParentFrame = _useParentFrame;
       this->jointParentName = _parentName;
       this->dirtyParentAxis = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -487,6 +489,7 @@ namespace gz
     {
       this->jointVisualType = _type;
       this->dirtyJointType = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
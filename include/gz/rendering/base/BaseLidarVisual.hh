@@ -19,6 +19,8 @@
 
 #include <vector>
 
+#include <gz/common/Console.hh>
+
 #include "gz/rendering/LidarVisual.hh"
 #include "gz/rendering/base/BaseObject.hh"
 #include "gz/rendering/base/BaseRenderTypes.hh"
@@ -153,6 +155,12 @@ namespace gz
       // Documentation inherited
       public: virtual bool DisplayNonHitting() const override;
 
+      // Documentation inherited
+      public: virtual void SetGpuRays(const GpuRaysPtr &_gpuRays) override;
+
+      // Documentation inherited
+      public: virtual GpuRaysPtr GpuRays() const override;
+
       /// \brief Vertical minimal angle
       protected: double minVerticalAngle = 0;
 
@@ -469,6 +477,24 @@ namespace gz
       return this->displayNonHitting;
     }
 
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseLidarVisual<T>::SetGpuRays(const GpuRaysPtr &_gpuRays)
+    {
+      if (_gpuRays)
+      {
+        gzerr << "Binding a lidar visual to a GpuRays sensor is not "
+              << "supported by this render engine" << std::endl;
+      }
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    GpuRaysPtr BaseLidarVisual<T>::GpuRays() const
+    {
+      return nullptr;
+    }
+
     /////////////////////////////////////////////////
     template <class T>
     void BaseLidarVisual<T>::CreateMaterials()
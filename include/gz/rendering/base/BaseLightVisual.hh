@@ -114,6 +114,7 @@ namespace gz
     {
       this->type = _type;
       this->dirtyLightVisual = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -129,6 +130,7 @@ namespace gz
     {
       this->innerAngle = _innerAngle;
       this->dirtyLightVisual = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -144,6 +146,7 @@ namespace gz
     {
       this->outerAngle = _outerAngle;
       this->dirtyLightVisual = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
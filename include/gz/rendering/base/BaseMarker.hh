@@ -88,6 +88,14 @@ namespace gz
       public: virtual void SetPoint(unsigned int _index,
                   const gz::math::Vector3d &_value) override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) override;
+
+      // Documentation inherited
+      public: virtual void AppendPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) override;
+
       /// \brief Life time of a marker
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       protected: std::chrono::steady_clock::duration lifetime =
@@ -129,6 +137,7 @@ namespace gz
     {
       this->lifetime = _lifetime;
       this->markerDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -144,6 +153,7 @@ namespace gz
     {
       this->layer = _layer;
       this->markerDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -159,6 +169,7 @@ namespace gz
     {
       this->markerType = _markerType;
       this->markerDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -174,6 +185,7 @@ namespace gz
     {
       this->size = _size;
       this->markerDirty = true;
+      this->SetPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -227,6 +239,32 @@ namespace gz
     {
       // no op
     }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseMarker<T>::SetPoints(const float *_xyz, const float *_rgba,
+                  size_t _count)
+    {
+      this->ClearPoints();
+      this->AppendPoints(_xyz, _rgba, _count);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseMarker<T>::AppendPoints(const float *_xyz, const float *_rgba,
+                  size_t _count)
+    {
+      // engines without a bulk path add the points one by one
+      for (size_t i = 0u; i < _count; ++i)
+      {
+        math::Color color = math::Color::White;
+        if (_rgba)
+        {
+          color.Set(_rgba[i*4], _rgba[i*4+1], _rgba[i*4+2], _rgba[i*4+3]);
+        }
+        this->AddPoint(_xyz[i*3], _xyz[i*3+1], _xyz[i*3+2], color);
+      }
+    }
     }
   }
 }
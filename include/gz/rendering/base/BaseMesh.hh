@@ -20,6 +20,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "gz/rendering/Mesh.hh"
 #include "gz/rendering/RenderEngine.hh"
 #include "gz/rendering/Storage.hh"
@@ -62,6 +63,27 @@ namespace gz
                       const std::unordered_map<std::string, float> &_weights)
                       override;
 
+      // Documentation inherited.
+      public: virtual std::vector<std::string> SkeletonBoneNames() const
+                      override;
+
+      // Documentation inherited.
+      public: virtual void SkeletonBoneTransforms(
+                      std::vector<math::Matrix4d> &_tfs) const override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms(
+                      const math::Matrix4d *_tfs, unsigned int _count)
+                      override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms3x4(const float *_tfs,
+                      unsigned int _count) override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneWeights(const float *_weights,
+                      unsigned int _count) override;
+
       // Documentation inherited.
       public: virtual void SetSkeletonAnimationEnabled(const std::string &_name,
             bool _enabled, bool _loop = true, float _weight = 1.0) override;
@@ -74,6 +96,18 @@ namespace gz
       public: virtual void UpdateSkeletonAnimation(
             std::chrono::steady_clock::duration _time) override;
 
+      // Documentation inherited.
+      public: virtual void SetSkeletonAnimationInstanced(bool _instanced,
+            double _bakeRate = 30.0) override;
+
+      // Documentation inherited.
+      public: virtual bool SkeletonAnimationInstanced() const override;
+
+      // Documentation inherited.
+      public: virtual bool UpdateVertices(unsigned int _subMeshIndex,
+                  const float *_positions, const float *_normals,
+                  unsigned int _vertexCount) override;
+
       public: virtual unsigned int SubMeshCount() const override;
 
       public: virtual bool HasSubMesh(ConstSubMeshPtr _subMesh) const override;
@@ -217,6 +251,68 @@ namespace gz
              << this->Scene()->Engine()->Name() << std::endl;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<std::string> BaseMesh<T>::SkeletonBoneNames() const
+    {
+      // engines without an index based skeleton API use the name order
+      std::vector<std::string> names;
+      for (auto const &tf : this->SkeletonLocalTransforms())
+        names.push_back(tf.first);
+      return names;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SkeletonBoneTransforms(
+          std::vector<math::Matrix4d> &_tfs) const
+    {
+      _tfs.clear();
+      for (auto const &tf : this->SkeletonLocalTransforms())
+        _tfs.push_back(tf.second);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SetSkeletonBoneTransforms(
+          const math::Matrix4d *_tfs, unsigned int _count)
+    {
+      std::vector<std::string> names = this->SkeletonBoneNames();
+      std::map<std::string, math::Matrix4d> tfs;
+      for (unsigned int i = 0; i < _count && i < names.size(); ++i)
+        tfs[names[i]] = _tfs[i];
+      this->SetSkeletonLocalTransforms(tfs);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SetSkeletonBoneTransforms3x4(const float *_tfs,
+          unsigned int _count)
+    {
+      std::vector<math::Matrix4d> tfs(_count);
+      for (unsigned int i = 0; i < _count; ++i)
+      {
+        const float *m = &_tfs[i * 12u];
+        tfs[i].Set(m[0], m[1], m[2], m[3],
+                   m[4], m[5], m[6], m[7],
+                   m[8], m[9], m[10], m[11],
+                   0, 0, 0, 1);
+      }
+      this->SetSkeletonBoneTransforms(tfs.data(), _count);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SetSkeletonBoneWeights(const float *_weights,
+          unsigned int _count)
+    {
+      std::vector<std::string> names = this->SkeletonBoneNames();
+      std::unordered_map<std::string, float> weights;
+      for (unsigned int i = 0; i < _count && i < names.size(); ++i)
+        weights[names[i]] = _weights[i];
+      this->SetSkeletonWeights(weights);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseMesh<T>::SetSkeletonAnimationEnabled(const std::string &, bool,
@@ -238,6 +334,29 @@ namespace gz
     {
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SetSkeletonAnimationInstanced(bool, double)
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseMesh<T>::SkeletonAnimationInstanced() const
+    {
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseMesh<T>::UpdateVertices(unsigned int, const float *,
+        const float *, unsigned int)
+    {
+      gzerr << "Vertex updates are not supported by this render engine"
+            << std::endl;
+      return false;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     unsigned int BaseMesh<T>::SubMeshCount() const
@@ -443,6 +562,7 @@ namespace gz
 
       this->material = _material;
       this->ownsMaterial = _unique;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
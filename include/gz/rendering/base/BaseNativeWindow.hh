@@ -51,6 +51,34 @@ namespace gz
 
       // Documentation Inherited.
       public: virtual void Draw(CameraPtr /*_camera*/) override {}
+
+      // Documentation Inherited.
+      public: virtual void SetSwapInterval(
+            unsigned int /*_interval*/) override {}
+
+      // Documentation Inherited.
+      public: virtual unsigned int SwapInterval() const override
+            { return 1u; }
+
+      // Documentation Inherited.
+      public: virtual void SetMaxFramesInFlight(
+            unsigned int /*_frames*/) override {}
+
+      // Documentation Inherited.
+      public: virtual unsigned int MaxFramesInFlight() const override
+            { return 0u; }
+
+      // Documentation Inherited.
+      public: virtual void SetNonBlockingPresent(
+            bool /*_nonBlocking*/) override {}
+
+      // Documentation Inherited.
+      public: virtual bool NonBlockingPresent() const override
+            { return false; }
+
+      // Documentation Inherited.
+      public: virtual uint64_t SkippedFrameCount() const override
+            { return 0u; }
     };
     }
   }
@@ -17,8 +17,10 @@
 #ifndef GZ_RENDERING_BASE_BASENODE_HH_
 #define GZ_RENDERING_BASE_BASENODE_HH_
 
-#include <map>
+#include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "gz/rendering/Node.hh"
 #include "gz/rendering/Storage.hh"
@@ -183,8 +185,36 @@ namespace gz
       // Documentation inherited
       public: virtual bool HasUserData(const std::string &_key) const override;
 
+      // Documentation inherited
+      public: virtual std::vector<std::string> UserDataKeys() const override;
+
+      // Documentation inherited
+      public: virtual void SetUserData(const UserDataKey &_key,
+                  Variant _value) override;
+
+      // Documentation inherited
+      public: virtual const Variant *UserDataValue(
+                  const UserDataKey &_key) const override;
+
+      // Documentation inherited
+      public: virtual bool HasUserData(const UserDataKey &_key) const
+                  override;
+
       protected: virtual void PreRenderChildren();
 
+      /// \brief Get whether the scene records changes, see
+      /// Scene::ChangeTracker
+      /// \return True if changes of this node must be recorded
+      protected: bool TrackSceneChanges() const;
+
+      /// \brief Record a change of this node that is about to be made,
+      /// see SceneChangeTracker::MarkNodeChanged
+      protected: void MarkSceneChanged();
+
+      /// \brief Record that a child is about to be attached or detached
+      /// \param[in] _child Child node
+      protected: void MarkChildChanged(const NodePtr &_child);
+
       protected: virtual math::Pose3d RawLocalPose() const = 0;
 
       protected: virtual void SetRawLocalPose(const math::Pose3d &_pose) = 0;
@@ -210,8 +240,9 @@ namespace gz
       protected: gz::math::Pose3d initialLocalPose =
           gz::math::Pose3d::Zero;
 
-      /// \brief A map of custom key value data
-      protected: std::map<std::string, Variant> userData;
+      /// \brief Custom key value data. Nodes hold few entries, so a flat
+      /// vector searched by key id is faster than a map of names.
+      protected: std::vector<std::pair<UserDataKey, Variant>> userData;
     };
 
     //////////////////////////////////////////////////
@@ -254,6 +285,8 @@ namespace gz
       if (this->AttachChild(_child))
       {
         this->Children()->Add(_child);
+        this->Scene()->SetPreRenderDirty(_child);
+        this->MarkChildChanged(_child);
       }
     }
 
@@ -262,7 +295,11 @@ namespace gz
     NodePtr BaseNode<T>::RemoveChild(NodePtr _child)
     {
       NodePtr child = this->Children()->Remove(_child);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->MarkChildChanged(child);
+        this->DetachChild(child);
+      }
       return child;
     }
 
@@ -271,7 +308,11 @@ namespace gz
     NodePtr BaseNode<T>::RemoveChildById(unsigned int _id)
     {
       NodePtr child = this->Children()->RemoveById(_id);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->MarkChildChanged(child);
+        this->DetachChild(child);
+      }
       return child;
     }
 
@@ -280,7 +321,11 @@ namespace gz
     NodePtr BaseNode<T>::RemoveChildByName(const std::string &_name)
     {
       NodePtr child = this->Children()->RemoveByName(_name);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->MarkChildChanged(child);
+        this->DetachChild(child);
+      }
       return child;
     }
 
@@ -289,7 +334,11 @@ namespace gz
     NodePtr BaseNode<T>::RemoveChildByIndex(unsigned int _index)
     {
       NodePtr child = this->Children()->RemoveByIndex(_index);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->MarkChildChanged(child);
+        this->DetachChild(child);
+      }
       return child;
     }
 
@@ -323,6 +372,37 @@ namespace gz
       }
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseNode<T>::TrackSceneChanges() const
+    {
+      auto scene = this->Scene();
+      return scene && scene->ChangeTracker().Enabled();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::MarkSceneChanged()
+    {
+      if (!this->TrackSceneChanges())
+        return;
+
+      // nodes that are not owned by a pointer yet, e.g. while they are
+      // initialized, are not part of the scene graph
+      NodePtr node = std::dynamic_pointer_cast<Node>(
+          this->weak_from_this().lock());
+      if (node)
+        this->Scene()->ChangeTracker().MarkNodeChanged(node);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::MarkChildChanged(const NodePtr &_child)
+    {
+      if (this->TrackSceneChanges())
+        this->Scene()->ChangeTracker().MarkNodeChanged(_child);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     math::Pose3d BaseNode<T>::LocalPose() const
@@ -352,6 +432,11 @@ namespace gz
         this->initialLocalPoseSet = true;
       }
 
+      // poses set again without changing, e.g. of static models updated
+      // every simulation step, are no change for cameras
+      if (this->TrackSceneChanges() && pose != this->RawLocalPose())
+        this->MarkSceneChanged();
+
       this->SetRawLocalPose(pose);
     }
 
@@ -567,6 +652,8 @@ namespace gz
     void BaseNode<T>::SetLocalScale(const math::Vector3d &_scale)
     {
       math::Pose3d rawPose = this->LocalPose();
+      if (this->TrackSceneChanges() && _scale != this->LocalScale())
+        this->MarkSceneChanged();
       this->SetLocalScaleImpl(_scale);
       this->SetLocalPose(rawPose);
     }
@@ -693,25 +780,75 @@ namespace gz
     template <class T>
     void BaseNode<T>::SetUserData(const std::string &_key, Variant _value)
     {
-     this->userData[_key] = _value;
+      this->SetUserData(UserDataKey(_key), std::move(_value));
     }
 
     //////////////////////////////////////////////////
     template <class T>
     Variant BaseNode<T>::UserData(const std::string &_key) const
     {
-     Variant value;
-     auto it = this->userData.find(_key);
-     if (it != this->userData.end())
-       value = it->second;
-     return value;
+      Variant value;
+      const Variant *data = this->UserDataValue(UserDataKey::Find(_key));
+      if (data)
+        value = *data;
+      return value;
     }
 
     //////////////////////////////////////////////////
     template <class T>
     bool BaseNode<T>::HasUserData(const std::string &_key) const
     {
-      return this->userData.find(_key) != this->userData.end();
+      return this->UserDataValue(UserDataKey::Find(_key)) != nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<std::string> BaseNode<T>::UserDataKeys() const
+    {
+      std::vector<std::string> keys;
+      keys.reserve(this->userData.size());
+      for (const auto &data : this->userData)
+        keys.push_back(data.first.Name());
+      std::sort(keys.begin(), keys.end());
+      return keys;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::SetUserData(const UserDataKey &_key, Variant _value)
+    {
+      if (!_key.Valid())
+        return;
+      for (auto &data : this->userData)
+      {
+        if (data.first == _key)
+        {
+          data.second = std::move(_value);
+          return;
+        }
+      }
+      this->userData.emplace_back(_key, std::move(_value));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    const Variant *BaseNode<T>::UserDataValue(const UserDataKey &_key) const
+    {
+      if (!_key.Valid())
+        return nullptr;
+      for (const auto &data : this->userData)
+      {
+        if (data.first == _key)
+          return &data.second;
+      }
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseNode<T>::HasUserData(const UserDataKey &_key) const
+    {
+      return this->UserDataValue(_key) != nullptr;
     }
   }
 }
@@ -57,6 +57,11 @@ namespace gz
       // TODO(anyone): make pure virtual
       protected: virtual void Init();
 
+      /// \brief Notify the scene that this object changed and needs to be
+      /// pre-rendered. No-op unless the scene has dirty tracking enabled.
+      /// \sa Scene::SetPreRenderDirtyTracking
+      protected: void SetPreRenderDirty();
+
       protected: unsigned int id;
 
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
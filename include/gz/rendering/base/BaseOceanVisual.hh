@@ -0,0 +1,588 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASEOCEANVISUAL_HH_
+#define GZ_RENDERING_BASEOCEANVISUAL_HH_
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/math/Helpers.hh>
+
+#include "gz/rendering/OceanVisual.hh"
+#include "gz/rendering/base/BaseObject.hh"
+#include "gz/rendering/base/BaseRenderTypes.hh"
+#include "gz/rendering/Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    /// \brief Base implementation of an ocean visual. It evaluates the
+    /// waves and lays out the rings of cells; render engines upload the
+    /// vertices built by BuildRows on PreRender when surfaceDirty is set.
+    template <class T>
+    class BaseOceanVisual :
+      public virtual OceanVisual,
+      public virtual T
+    {
+      /// \brief A Gerstner wave
+      protected: struct Wave
+      {
+        /// \brief Amplitude in meters
+        double amplitude;
+
+        /// \brief Wavenumber, 2 * pi / wavelength
+        double k;
+
+        /// \brief Angular frequency
+        double omega;
+
+        /// \brief Unit direction of travel
+        double dirX;
+
+        /// \brief Unit direction of travel
+        double dirY;
+
+        /// \brief Horizontal displacement relative to the amplitude
+        double choppiness;
+
+        /// \brief Phase offset in radians
+        double phase;
+      };
+
+      /// \brief Number of floats per vertex: position and normal
+      protected: static constexpr unsigned int kVertexSize = 6u;
+
+      // Documentation inherited
+      protected: BaseOceanVisual();
+
+      // Documentation inherited
+      public: virtual ~BaseOceanVisual();
+
+      // Documentation inherited
+      public: virtual void PreRender() override;
+
+      // Documentation inherited
+      public: virtual void AddWave(double _amplitude, double _wavelength,
+                  double _direction, double _choppiness = 1.0,
+                  double _phase = 0.0) override;
+
+      // Documentation inherited
+      public: virtual void ClearWaves() override;
+
+      // Documentation inherited
+      public: virtual unsigned int WaveCount() const override;
+
+      // Documentation inherited
+      public: virtual void SetGrid(double _cellSize,
+                  unsigned int _cellsPerRing, unsigned int _ringCount)
+                  override;
+
+      // Documentation inherited
+      public: virtual double CellSize() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int CellsPerRing() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int RingCount() const override;
+
+      // Documentation inherited
+      public: virtual double Extent() const override;
+
+      // Documentation inherited
+      public: virtual void SetCenter(const math::Vector2d &_center)
+                  override;
+
+      // Documentation inherited
+      public: virtual math::Vector2d Center() const override;
+
+      // Documentation inherited
+      public: virtual double Height(const math::Vector2d &_position)
+                  const override;
+
+      // Documentation inherited
+      public: virtual unsigned int TriangleCount() const override;
+
+      /// \brief Get the number of vertices of the surface, including the
+      /// unused vertices inside the holes of the rings
+      /// \return Number of vertices
+      protected: unsigned int VertexCount() const;
+
+      /// \brief Get the number of vertex rows of the surface, all rings
+      /// one after another
+      /// \return Number of rows
+      protected: unsigned int RowCount() const;
+
+      /// \brief Build the triangles of all rings, counter clockwise seen
+      /// from above
+      /// \param[out] _indices Vertex indices, 3 per triangle
+      protected: void BuildIndices(std::vector<uint32_t> &_indices) const;
+
+      /// \brief Displace the vertices of a range of rows at the current
+      /// time. Rows can be built in parallel; call StitchRings once all
+      /// rows are built.
+      /// \param[in] _begin First row
+      /// \param[in] _end One past the last row
+      /// \param[out] _vertices Vertices of the whole surface, kVertexSize
+      /// floats each. Only the vertices of the given rows are written.
+      protected: void BuildRows(unsigned int _begin, unsigned int _end,
+                     float *_vertices) const;
+
+      /// \brief Move the vertices on the outer edge of each ring that have
+      /// no counterpart in the next ring onto the edges of that ring, so
+      /// the rings join without cracks
+      /// \param[in,out] _vertices Vertices built by BuildRows
+      protected: void StitchRings(float *_vertices) const;
+
+      /// \brief Get the bounds of the displaced surface
+      /// \param[out] _min Minimum corner in the frame of the visual
+      /// \param[out] _max Maximum corner in the frame of the visual
+      protected: void Bounds(math::Vector3d &_min,
+                     math::Vector3d &_max) const;
+
+      /// \brief Displace a point of the flat surface by the waves
+      /// \param[in] _x X coordinate of the point at rest
+      /// \param[in] _y Y coordinate of the point at rest
+      /// \param[out] _normal Normal of the surface at the point, not
+      /// normalized. Not computed if null.
+      /// \return Position of the point
+      protected: math::Vector3d Displace(double _x, double _y,
+                     math::Vector3d *_normal) const;
+
+      /// \brief Waves
+      protected: std::vector<Wave> waves;
+
+      /// \brief Edge length of the cells of the innermost ring
+      protected: double cellSize = 0.5;
+
+      /// \brief Number of cells along an edge of a ring
+      protected: unsigned int cellsPerRing = 64u;
+
+      /// \brief Number of rings
+      protected: unsigned int ringCount = 8u;
+
+      /// \brief Center as set by SetCenter
+      protected: math::Vector2d center;
+
+      /// \brief Center snapped to twice the cell size
+      protected: math::Vector2d snappedCenter;
+
+      /// \brief Scene time in seconds the surface is displaced at
+      protected: double time = 0.0;
+
+      /// \brief True if the layout of the rings changed and the triangles
+      /// need to be rebuilt
+      protected: bool gridDirty = true;
+
+      /// \brief True if the vertices need to be rebuilt
+      protected: bool surfaceDirty = true;
+    };
+
+    /// \brief Standard gravity used by the wave dispersion relation
+    static constexpr double kOceanGravity = 9.80665;
+
+    /////////////////////////////////////////////////
+    // BaseOceanVisual
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseOceanVisual<T>::BaseOceanVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseOceanVisual<T>::~BaseOceanVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::PreRender()
+    {
+      T::PreRender();
+
+      const double now = std::chrono::duration<double>(
+          this->Scene()->Time()).count();
+      if (!this->waves.empty() && now != this->time)
+        this->surfaceDirty = true;
+      this->time = now;
+
+      // the waves move with the scene time, so keep being pre-rendered
+      // when the scene only pre-renders dirty objects
+      if (!this->waves.empty())
+        this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::AddWave(double _amplitude, double _wavelength,
+        double _direction, double _choppiness, double _phase)
+    {
+      if (!(_wavelength > 0.0) || _amplitude < 0.0 || _choppiness < 0.0)
+      {
+        gzerr << "Ocean waves need a positive wavelength and non negative "
+              << "amplitude and choppiness" << std::endl;
+        return;
+      }
+
+      Wave wave;
+      wave.amplitude = _amplitude;
+      wave.k = 2.0 * GZ_PI / _wavelength;
+      wave.omega = std::sqrt(kOceanGravity * wave.k);
+      wave.dirX = std::cos(_direction);
+      wave.dirY = std::sin(_direction);
+      wave.choppiness = _choppiness;
+      wave.phase = _phase;
+      this->waves.push_back(wave);
+      this->surfaceDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::ClearWaves()
+    {
+      this->waves.clear();
+      this->surfaceDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::WaveCount() const
+    {
+      return static_cast<unsigned int>(this->waves.size());
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::SetGrid(double _cellSize,
+        unsigned int _cellsPerRing, unsigned int _ringCount)
+    {
+      if (!(_cellSize > 0.0) || _cellsPerRing < 4u ||
+          _cellsPerRing % 4u != 0u || _ringCount == 0u)
+      {
+        gzerr << "Ocean grids need a positive cell size, a multiple of 4 "
+              << "cells per ring and at least one ring" << std::endl;
+        return;
+      }
+
+      // vertex indices are 32 bits
+      const uint64_t vertexCount = static_cast<uint64_t>(_ringCount) *
+          (_cellsPerRing + 1u) * (_cellsPerRing + 1u);
+      if (vertexCount > UINT32_MAX)
+      {
+        gzerr << "Ocean grid has too many vertices" << std::endl;
+        return;
+      }
+
+      this->cellSize = _cellSize;
+      this->cellsPerRing = _cellsPerRing;
+      this->ringCount = _ringCount;
+      this->SetCenter(this->center);
+      this->gridDirty = true;
+      this->surfaceDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseOceanVisual<T>::CellSize() const
+    {
+      return this->cellSize;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::CellsPerRing() const
+    {
+      return this->cellsPerRing;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::RingCount() const
+    {
+      return this->ringCount;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseOceanVisual<T>::Extent() const
+    {
+      return this->cellsPerRing * this->cellSize *
+          std::ldexp(1.0, static_cast<int>(this->ringCount) - 1);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::SetCenter(const math::Vector2d &_center)
+    {
+      this->center = _center;
+
+      // the vertices of the innermost ring stay on the same points of the
+      // waves, coarser rings are far enough away for the sliding to go
+      // unnoticed
+      const double snap = 2.0 * this->cellSize;
+      const math::Vector2d snapped(
+          std::round(_center.X() / snap) * snap,
+          std::round(_center.Y() / snap) * snap);
+      if (snapped != this->snappedCenter)
+      {
+        this->surfaceDirty = true;
+        this->SetPreRenderDirty();
+      }
+      this->snappedCenter = snapped;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Vector2d BaseOceanVisual<T>::Center() const
+    {
+      return this->center;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseOceanVisual<T>::Height(const math::Vector2d &_position) const
+    {
+      // find the point at rest that the waves move above the position; the
+      // horizontal displacement is small compared to the wavelength, so a
+      // few fixed point iterations converge
+      double x = _position.X();
+      double y = _position.Y();
+      math::Vector3d p;
+      for (int i = 0; i < 4; ++i)
+      {
+        p = this->Displace(x, y, nullptr);
+        x -= p.X() - _position.X();
+        y -= p.Y() - _position.Y();
+      }
+      return this->Displace(x, y, nullptr).Z();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::TriangleCount() const
+    {
+      const unsigned int n = this->cellsPerRing;
+      return 2u * (n * n + (this->ringCount - 1u) * (n * n - n * n / 4u));
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::VertexCount() const
+    {
+      return this->RowCount() * (this->cellsPerRing + 1u);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseOceanVisual<T>::RowCount() const
+    {
+      return this->ringCount * (this->cellsPerRing + 1u);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::BuildIndices(
+        std::vector<uint32_t> &_indices) const
+    {
+      const unsigned int n = this->cellsPerRing;
+      const unsigned int side = n + 1u;
+      _indices.clear();
+      _indices.reserve(this->TriangleCount() * 3u);
+      for (unsigned int ring = 0u; ring < this->ringCount; ++ring)
+      {
+        const uint32_t first = ring * side * side;
+        for (unsigned int j = 0u; j < n; ++j)
+        {
+          for (unsigned int i = 0u; i < n; ++i)
+          {
+            // the hole is covered by the next ring inside
+            if (ring > 0u && i >= n / 4u && i < 3u * n / 4u &&
+                j >= n / 4u && j < 3u * n / 4u)
+            {
+              continue;
+            }
+            const uint32_t v00 = first + j * side + i;
+            const uint32_t v10 = v00 + 1u;
+            const uint32_t v01 = v00 + side;
+            const uint32_t v11 = v01 + 1u;
+            _indices.insert(_indices.end(), {v00, v10, v11, v00, v11, v01});
+          }
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::BuildRows(unsigned int _begin,
+        unsigned int _end, float *_vertices) const
+    {
+      const unsigned int n = this->cellsPerRing;
+      const unsigned int side = n + 1u;
+      for (unsigned int row = _begin; row < _end; ++row)
+      {
+        const unsigned int ring = row / side;
+        const unsigned int j = row % side;
+        const double cell = std::ldexp(this->cellSize,
+            static_cast<int>(ring));
+        const double half = 0.5 * n * cell;
+        const double y = this->snappedCenter.Y() - half + j * cell;
+        const bool holeRow = ring > 0u && j > n / 4u && j < 3u * n / 4u;
+
+        float *v = _vertices + static_cast<size_t>(row) * side * kVertexSize;
+        for (unsigned int i = 0u; i < side; ++i, v += kVertexSize)
+        {
+          const double x = this->snappedCenter.X() - half + i * cell;
+          math::Vector3d p(x, y, 0.0);
+          math::Vector3d normal = math::Vector3d::UnitZ;
+
+          // vertices strictly inside the hole are not drawn
+          if (!(holeRow && i > n / 4u && i < 3u * n / 4u))
+            p = this->Displace(x, y, &normal);
+          normal.Normalize();
+
+          v[0] = static_cast<float>(p.X());
+          v[1] = static_cast<float>(p.Y());
+          v[2] = static_cast<float>(p.Z());
+          v[3] = static_cast<float>(normal.X());
+          v[4] = static_cast<float>(normal.Y());
+          v[5] = static_cast<float>(normal.Z());
+        }
+      }
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::StitchRings(float *_vertices) const
+    {
+      const unsigned int n = this->cellsPerRing;
+      const unsigned int side = n + 1u;
+
+      // odd vertices on the outer edge of a ring lie in the middle of an
+      // edge of the next ring; move them onto that edge
+      auto stitch = [&](float *_v, size_t _stride)
+      {
+        for (unsigned int i = 1u; i < n; i += 2u)
+        {
+          float *mid = _v + i * _stride;
+          const float *prev = mid - _stride;
+          const float *next = mid + _stride;
+          float length = 0.0f;
+          for (unsigned int c = 0u; c < kVertexSize; ++c)
+          {
+            mid[c] = 0.5f * (prev[c] + next[c]);
+            if (c >= 3u)
+              length += mid[c] * mid[c];
+          }
+          length = std::sqrt(length);
+          if (length > 0.0f)
+          {
+            for (unsigned int c = 3u; c < kVertexSize; ++c)
+              mid[c] /= length;
+          }
+        }
+      };
+
+      // the outermost ring has no neighbour
+      for (unsigned int ring = 0u; ring + 1u < this->ringCount; ++ring)
+      {
+        float *first = _vertices +
+            static_cast<size_t>(ring) * side * side * kVertexSize;
+        const size_t rowStride = static_cast<size_t>(side) * kVertexSize;
+        stitch(first, kVertexSize);
+        stitch(first + n * rowStride, kVertexSize);
+        stitch(first, rowStride);
+        stitch(first + n * kVertexSize, rowStride);
+      }
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseOceanVisual<T>::Bounds(math::Vector3d &_min,
+        math::Vector3d &_max) const
+    {
+      double height = 0.0;
+      double shift = 0.0;
+      for (const Wave &wave : this->waves)
+      {
+        height += wave.amplitude;
+        shift += wave.choppiness * wave.amplitude;
+      }
+      const double half = 0.5 * this->Extent() + shift;
+      _min.Set(this->snappedCenter.X() - half,
+          this->snappedCenter.Y() - half, -height);
+      _max.Set(this->snappedCenter.X() + half,
+          this->snappedCenter.Y() + half, height);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseOceanVisual<T>::Displace(double _x, double _y,
+        math::Vector3d *_normal) const
+    {
+      math::Vector3d p(_x, _y, 0.0);
+
+      // derivatives of the position with respect to the point at rest
+      double dxdx = 1.0;
+      double dxdy = 0.0;
+      double dydy = 1.0;
+      double dzdx = 0.0;
+      double dzdy = 0.0;
+      for (const Wave &wave : this->waves)
+      {
+        const double theta = wave.k * (wave.dirX * _x + wave.dirY * _y) -
+            wave.omega * this->time + wave.phase;
+        const double s = std::sin(theta);
+        const double c = std::cos(theta);
+        const double horizontal = wave.choppiness * wave.amplitude;
+        p.X() -= horizontal * wave.dirX * s;
+        p.Y() -= horizontal * wave.dirY * s;
+        p.Z() += wave.amplitude * c;
+
+        if (_normal)
+        {
+          const double kh = wave.k * horizontal * c;
+          const double ka = wave.k * wave.amplitude * s;
+          dxdx -= kh * wave.dirX * wave.dirX;
+          dxdy -= kh * wave.dirX * wave.dirY;
+          dydy -= kh * wave.dirY * wave.dirY;
+          dzdx -= ka * wave.dirX;
+          dzdy -= ka * wave.dirY;
+        }
+      }
+
+      // cross product of the tangents along x and y
+      if (_normal)
+      {
+        _normal->Set(dxdy * dzdy - dzdx * dydy,
+            dzdx * dxdy - dxdx * dzdy,
+            dxdx * dydy - dxdy * dxdy);
+      }
+      return p;
+    }
+    }
+  }
+}
+#endif
@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASEPOINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_BASEPOINTCLOUDVISUAL_HH_
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/PointCloudVisual.hh"
+#include "gz/rendering/base/BaseObject.hh"
+#include "gz/rendering/base/BaseRenderTypes.hh"
+#include "gz/rendering/Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    /// \brief Base implementation of a point cloud visual. It keeps a copy
+    /// of the points and the rendering parameters; render engines upload
+    /// them when pointsDirty or materialDirty are set.
+    template <class T>
+    class BasePointCloudVisual :
+      public virtual PointCloudVisual,
+      public virtual T
+    {
+      // Documentation inherited
+      protected: BasePointCloudVisual();
+
+      // Documentation inherited
+      public: virtual ~BasePointCloudVisual();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void SetPoints(const void *_data, unsigned int _count,
+                  PointCloudFormat _format) override;
+
+      // Documentation inherited
+      public: virtual void ClearPoints() override;
+
+      // Documentation inherited
+      public: virtual unsigned int PointCount() const override;
+
+      // Documentation inherited
+      public: virtual PointCloudFormat Format() const override;
+
+      // Documentation inherited
+      public: virtual void SetPointSize(double _size) override;
+
+      // Documentation inherited
+      public: virtual double PointSize() const override;
+
+      // Documentation inherited
+      public: virtual void SetSizeAttenuation(bool _attenuation) override;
+
+      // Documentation inherited
+      public: virtual bool SizeAttenuation() const override;
+
+      // Documentation inherited
+      public: virtual void SetMaxPixelSize(double _size) override;
+
+      // Documentation inherited
+      public: virtual double MaxPixelSize() const override;
+
+      // Documentation inherited
+      public: virtual void SetIntensityRange(double _min, double _max)
+                  override;
+
+      // Documentation inherited
+      public: virtual double IntensityMin() const override;
+
+      // Documentation inherited
+      public: virtual double IntensityMax() const override;
+
+      // Documentation inherited
+      public: virtual void SetIntensityColors(const math::Color &_low,
+                  const math::Color &_high) override;
+
+      // Documentation inherited
+      public: virtual math::Color IntensityLowColor() const override;
+
+      // Documentation inherited
+      public: virtual math::Color IntensityHighColor() const override;
+
+      // Documentation inherited
+      public: virtual void SetMaxRenderedPointCount(unsigned int _count)
+                  override;
+
+      // Documentation inherited
+      public: virtual unsigned int MaxRenderedPointCount() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int RenderedPointCount() const override;
+
+      /// \brief Points in the layout they were given in, 4 floats each
+      protected: std::vector<float> points;
+
+      /// \brief Layout of the points
+      protected: PointCloudFormat format = PCF_PACKED_XYZRGBA;
+
+      /// \brief Point size, in pixels or meters
+      protected: double pointSize = 2.0;
+
+      /// \brief True if the point size is attenuated with distance
+      protected: bool sizeAttenuation = false;
+
+      /// \brief Maximum point size in pixels
+      protected: double maxPixelSize = 64.0;
+
+      /// \brief Intensity of the low intensity color
+      protected: double intensityMin = 0.0;
+
+      /// \brief Intensity of the high intensity color
+      protected: double intensityMax = 1.0;
+
+      /// \brief Color of the minimum intensity
+      protected: math::Color intensityLowColor = math::Color::Black;
+
+      /// \brief Color of the maximum intensity
+      protected: math::Color intensityHighColor = math::Color::White;
+
+      /// \brief Maximum number of rendered points, 0 for no limit
+      protected: unsigned int maxRenderedPointCount = 10000000u;
+
+      /// \brief True if the points changed since they were uploaded
+      protected: bool pointsDirty = false;
+
+      /// \brief True if the rendering parameters changed, including the
+      /// decimation
+      protected: bool materialDirty = true;
+    };
+
+    /////////////////////////////////////////////////
+    // BasePointCloudVisual
+    /////////////////////////////////////////////////
+    template <class T>
+    BasePointCloudVisual<T>::BasePointCloudVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    BasePointCloudVisual<T>::~BasePointCloudVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::Destroy()
+    {
+      T::Destroy();
+      this->points.clear();
+      this->points.shrink_to_fit();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetPoints(const void *_data,
+        unsigned int _count, PointCloudFormat _format)
+    {
+      if (!_data && _count > 0u)
+      {
+        gzerr << "Unable to set the points of point cloud visual ["
+              << this->Name() << "]: no data" << std::endl;
+        return;
+      }
+      this->points.resize(static_cast<size_t>(_count) * 4u);
+      if (_count > 0u)
+      {
+        std::memcpy(this->points.data(), _data,
+            this->points.size() * sizeof(float));
+      }
+      if (this->format != _format)
+        this->materialDirty = true;
+      this->format = _format;
+      this->pointsDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::ClearPoints()
+    {
+      this->points.clear();
+      this->pointsDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BasePointCloudVisual<T>::PointCount() const
+    {
+      return static_cast<unsigned int>(this->points.size() / 4u);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    PointCloudFormat BasePointCloudVisual<T>::Format() const
+    {
+      return this->format;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetPointSize(double _size)
+    {
+      this->pointSize = std::max(_size, 0.0);
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::PointSize() const
+    {
+      return this->pointSize;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetSizeAttenuation(bool _attenuation)
+    {
+      this->sizeAttenuation = _attenuation;
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    bool BasePointCloudVisual<T>::SizeAttenuation() const
+    {
+      return this->sizeAttenuation;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetMaxPixelSize(double _size)
+    {
+      this->maxPixelSize = std::max(_size, 1.0);
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::MaxPixelSize() const
+    {
+      return this->maxPixelSize;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetIntensityRange(double _min,
+        double _max)
+    {
+      this->intensityMin = _min;
+      this->intensityMax = _max;
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::IntensityMin() const
+    {
+      return this->intensityMin;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::IntensityMax() const
+    {
+      return this->intensityMax;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetIntensityColors(const math::Color &_low,
+        const math::Color &_high)
+    {
+      this->intensityLowColor = _low;
+      this->intensityHighColor = _high;
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Color BasePointCloudVisual<T>::IntensityLowColor() const
+    {
+      return this->intensityLowColor;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Color BasePointCloudVisual<T>::IntensityHighColor() const
+    {
+      return this->intensityHighColor;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetMaxRenderedPointCount(
+        unsigned int _count)
+    {
+      this->maxRenderedPointCount = _count;
+      this->materialDirty = true;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BasePointCloudVisual<T>::MaxRenderedPointCount() const
+    {
+      return this->maxRenderedPointCount;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BasePointCloudVisual<T>::RenderedPointCount() const
+    {
+      const unsigned int count = this->PointCount();
+      if (this->maxRenderedPointCount == 0u)
+        return count;
+      return std::min(count, this->maxRenderedPointCount);
+    }
+    }
+  }
+}
+#endif
@@ -17,6 +17,9 @@
 #ifndef GZ_RENDERING_BASE_BASERAYQUERY_HH_
 #define GZ_RENDERING_BASE_BASERAYQUERY_HH_
 
+#include <vector>
+
+#include <gz/common/Console.hh>
 #include <gz/math/Matrix4.hh>
 #include <gz/math/Vector3.hh>
 
@@ -69,6 +72,12 @@ namespace gz
       public: virtual RayQueryResult ClosestPoint(
             bool _forceSceneUpdate = true) override;
 
+      // Documentation inherited
+      public: virtual std::vector<RayQueryResult> ClosestPoints(
+            const std::vector<math::Vector3d> &_origins,
+            const std::vector<math::Vector3d> &_directions,
+            bool _forceSceneUpdate = true) override;
+
       /// \brief Ray origin
       protected: math::Vector3d origin;
 
@@ -170,6 +179,35 @@ namespace gz
       result.distance = -1;
       return result;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<RayQueryResult> BaseRayQuery<T>::ClosestPoints(
+        const std::vector<math::Vector3d> &_origins,
+        const std::vector<math::Vector3d> &_directions,
+        bool _forceSceneUpdate)
+    {
+      std::vector<RayQueryResult> results;
+      if (_origins.size() != _directions.size())
+      {
+        gzerr << "Number of ray origins and directions differ" << std::endl;
+        return results;
+      }
+
+      // engines without a batched path cast one CPU ray at a time
+      const math::Vector3d prevOrigin = this->origin;
+      const math::Vector3d prevDirection = this->direction;
+      results.reserve(_origins.size());
+      for (size_t i = 0u; i < _origins.size(); ++i)
+      {
+        this->origin = _origins[i];
+        this->direction = _directions[i];
+        results.push_back(this->ClosestPoint(_forceSceneUpdate && i == 0u));
+      }
+      this->origin = prevOrigin;
+      this->direction = prevDirection;
+      return results;
+    }
     }
   }
 }
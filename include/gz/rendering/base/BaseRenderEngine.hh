@@ -108,9 +108,40 @@ namespace gz
       // Documentation Inherited
       public: virtual bool Headless() const override;
 
+      // Documentation Inherited
+      public: virtual void SetTextureMaxSize(unsigned int _size) override;
+
+      // Documentation Inherited
+      public: virtual unsigned int TextureMaxSize() const override;
+
+      // Documentation Inherited
+      public: virtual size_t TextureMemoryUsage() const override;
+
+      // Documentation Inherited
+      public: virtual GpuMemoryStats MemoryStats() const override;
+
+      // Documentation Inherited
+      public: virtual void SetMemoryWarning(size_t _threshold,
+                  MemoryWarningCallback _callback = nullptr) override;
+
+      // Documentation Inherited
+      public: virtual size_t MemoryWarningThreshold() const override;
+
+      /// \internal
+      /// \brief Compare the GPU memory usage to the threshold of
+      /// SetMemoryWarning and warn when it is crossed. Called by the scenes
+      /// of the render engine when they end a frame.
+      public: void CheckMemoryWarning();
+
       // Documentation Inherited
       public: virtual RenderPassSystemPtr RenderPassSystem() const override;
 
+      // Documentation Inherited
+      public: virtual FrameBufferPool &BufferPool() override;
+
+      // Documentation Inherited
+      public: virtual LoadTrace &Trace() override;
+
       protected: virtual void PrepareScene(ScenePtr _scene);
 
       protected: virtual unsigned int NextSceneId();
@@ -133,6 +164,17 @@ namespace gz
 
       protected: bool isHeadless = false;
 
+      /// \brief Maximum size of textures loaded by materials, 0 if there
+      /// is no limit
+      protected: unsigned int textureMaxSize = 0u;
+
+      /// \brief Total GPU memory above which the memory warning is
+      /// issued, 0 if disabled
+      protected: size_t memoryWarningThreshold = 0u;
+
+      /// \brief True while the GPU memory is above the warning threshold
+      protected: bool memoryWarningActive = false;
+
       /// \brief ID from a external window
       protected: std::string winID = "";
 
@@ -145,6 +187,15 @@ namespace gz
 
       /// \brief Render pass system for this render engine.
       protected: RenderPassSystemPtr renderPassSystem;
+
+      /// \brief Pool of sensor frame buffers
+      protected: FrameBufferPool bufferPool;
+
+      /// \brief Startup and world load trace
+      protected: LoadTrace loadTrace;
+
+      /// \brief Function called when the memory warning is issued
+      protected: MemoryWarningCallback memoryWarningCallback;
       GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
     };
     }
@@ -17,9 +17,13 @@
 #ifndef GZ_RENDERING_BASE_BASERENDERTARGET_HH_
 #define GZ_RENDERING_BASE_BASERENDERTARGET_HH_
 
+#include <cstring>
 #include <string>
 #include <vector>
 
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/RenderPass.hh"
 #include "gz/rendering/RenderTarget.hh"
 #include "gz/rendering/Scene.hh"
@@ -73,6 +77,13 @@ namespace gz
       // Documentation inherited
       public: virtual bool Reinterpretable() const override;
 
+      // Documentation inherited
+      public: virtual void CopyRegion(Image &_image, unsigned int _x,
+                  unsigned int _y) const override;
+
+      // Documentation inherited
+      public: virtual void CopyResized(Image &_image) const override;
+
       // Documentation inherited
       public: virtual math::Color BackgroundColor() const override;
 
@@ -128,6 +139,9 @@ namespace gz
 
       // Documentation inherited.
       public: virtual void MetalId(void *_textureIdPtr) const override;
+
+      // Documentation inherited.
+      public: virtual void *CudaDevicePointer() const override;
     };
 
     template <class T>
@@ -260,6 +274,91 @@ namespace gz
       return this->reinterpretable;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRenderTarget<T>::CopyRegion(Image &_image, unsigned int _x,
+        unsigned int _y) const
+    {
+      const unsigned int targetWidth = this->Width();
+      const unsigned int targetHeight = this->Height();
+      if (_x + _image.Width() > targetWidth ||
+          _y + _image.Height() > targetHeight)
+      {
+        gzerr << "Invalid image region" << std::endl;
+        return;
+      }
+      const PixelFormat format = _image.Format();
+      if ((format == PF_BAYER_RGGB8 || format == PF_BAYER_BGGR8 ||
+          format == PF_BAYER_GBRG8 || format == PF_BAYER_GRBG8) &&
+          (_x % 2u != 0u || _y % 2u != 0u))
+      {
+        gzerr << "Bayer image regions must start at an even pixel"
+              << std::endl;
+        return;
+      }
+
+      // engines without partial downloads read back the full image and crop
+      Image full(targetWidth, targetHeight, format);
+      this->Copy(full);
+      const unsigned int bpp = PixelUtil::BytesPerPixel(format);
+      const unsigned int srcPitch = targetWidth * bpp;
+      const unsigned int dstPitch = _image.RowStride();
+      const unsigned int rowSize = _image.Width() * bpp;
+      const unsigned char *src = full.Data<unsigned char>() +
+          _y * srcPitch + _x * bpp;
+      unsigned char *dst = _image.Data<unsigned char>();
+      for (unsigned int row = 0u; row < _image.Height(); ++row)
+        std::memcpy(dst + row * dstPitch, src + row * srcPitch, rowSize);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRenderTarget<T>::CopyResized(Image &_image) const
+    {
+      const unsigned int targetWidth = this->Width();
+      const unsigned int targetHeight = this->Height();
+      if (_image.Width() == targetWidth && _image.Height() == targetHeight)
+      {
+        this->Copy(_image);
+        return;
+      }
+      if (_image.Width() == 0u || _image.Height() == 0u)
+      {
+        gzerr << "Invalid image dimensions" << std::endl;
+        return;
+      }
+
+      const PixelFormat format = _image.Format();
+      if (format == PF_BAYER_RGGB8 || format == PF_BAYER_BGGR8 ||
+          format == PF_BAYER_GBRG8 || format == PF_BAYER_GRBG8)
+      {
+        gzerr << "Bayer images cannot be resized" << std::endl;
+        return;
+      }
+
+      // engines without GPU resizing read back the full image and pick the
+      // nearest pixels
+      Image full(targetWidth, targetHeight, format);
+      this->Copy(full);
+      const unsigned int bpp = PixelUtil::BytesPerPixel(format);
+      const unsigned int srcPitch = targetWidth * bpp;
+      const unsigned int dstPitch = _image.RowStride();
+      const unsigned char *src = full.Data<unsigned char>();
+      unsigned char *dst = _image.Data<unsigned char>();
+      for (unsigned int row = 0u; row < _image.Height(); ++row)
+      {
+        const unsigned int srcRow = static_cast<unsigned int>(
+            (row + 0.5) * targetHeight / _image.Height());
+        for (unsigned int col = 0u; col < _image.Width(); ++col)
+        {
+          const unsigned int srcCol = static_cast<unsigned int>(
+              (col + 0.5) * targetWidth / _image.Width());
+          std::memcpy(dst + row * dstPitch + col * bpp,
+              src + srcRow * srcPitch + srcCol * bpp, bpp);
+        }
+      }
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     math::Color BaseRenderTarget<T>::BackgroundColor() const
@@ -351,6 +450,13 @@ namespace gz
     {
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void *BaseRenderTexture<T>::CudaDevicePointer() const
+    {
+      return nullptr;
+    }
+
     //////////////////////////////////////////////////
     // BaseRenderWindow
     //////////////////////////////////////////////////
@@ -18,8 +18,13 @@
 #define GZ_RENDERING_BASE_BASESCENE_HH_
 
 #include <array>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/utils/SuppressWarning.hh>
@@ -34,6 +39,9 @@ namespace gz
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
+    // forward declaration
+    class BaseSceneState;
+
     class GZ_RENDERING_VISIBLE BaseScene :
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       public std::enable_shared_from_this<BaseScene>,
@@ -196,6 +204,14 @@ namespace gz
 
       public: virtual VisualPtr VisualById(unsigned int _id) const override;
 
+      // Documentation inherited.
+      public: virtual VisualPtr VisualByCompactId(uint32_t _compactId)
+                  const override;
+
+      // Documentation inherited.
+      public: virtual std::vector<math::AxisAlignedBox> BoundingBoxes(
+                  const std::vector<unsigned int> &_visualIds) const override;
+
       public: virtual VisualPtr VisualByName(const std::string &_name) const
                       override;
 
@@ -219,6 +235,50 @@ namespace gz
 
       public: virtual void DestroyVisuals() override;
 
+      // Documentation inherited.
+      public: virtual void DestroyVisuals(
+                  const std::vector<VisualPtr> &_visuals,
+                  bool _recursive = false) override;
+
+      // Documentation inherited.
+      public: virtual void DestroyVisualDeferred(VisualPtr _visual,
+                  bool _recursive = false) override;
+
+      // Documentation inherited.
+      public: virtual void SetDestructionBudget(
+                  std::chrono::steady_clock::duration _budget) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  DestructionBudget() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int PendingDestructionCount() const override;
+
+      // Documentation inherited.
+      public: virtual void SetWorldPoses(const std::vector<unsigned int> &_ids,
+                  const std::vector<math::Pose3d> &_poses) override;
+
+      // Documentation inherited.
+      public: virtual void SetWorldPoses(const std::vector<unsigned int> &_ids,
+                  const std::vector<float> &_positions,
+                  const std::vector<float> &_rotations) override;
+
+      // Documentation inherited.
+      public: virtual void StageWorldPose(unsigned int _id,
+                  const math::Pose3d &_pose) override;
+
+      // Documentation inherited.
+      public: virtual void StageWorldPoses(
+                  const std::vector<unsigned int> &_ids,
+                  const std::vector<math::Pose3d> &_poses) override;
+
+      // Documentation inherited.
+      public: virtual void PublishState() override;
+
+      // Documentation inherited.
+      public: virtual bool SwapState() override;
+
       public: virtual bool MaterialRegistered(const std::string &_name) const
                       override;
 
@@ -378,6 +438,21 @@ namespace gz
       public: virtual WideAngleCameraPtr CreateWideAngleCamera(
         const unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray() override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(
+        const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(
+        const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(
+        const unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited.
       public: virtual GpuRaysPtr CreateGpuRays() override;
 
@@ -401,6 +476,10 @@ namespace gz
       public: virtual VisualPtr CreateVisual(unsigned int _id,
                   const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual std::vector<VisualPtr> CreateVisuals(
+                  const std::vector<VisualDescriptor> &_descs) override;
+
       public: virtual ArrowVisualPtr CreateArrowVisual() override;
 
       public: virtual ArrowVisualPtr CreateArrowVisual(unsigned int _id)
@@ -513,6 +592,18 @@ namespace gz
 
       public: virtual MeshPtr CreateMesh(const MeshDescriptor &_desc) override;
 
+      // Documentation inherited.
+      public: virtual void PreloadMeshes(
+                  const std::vector<MeshDescriptor> &_descs) override;
+
+      // Documentation inherited.
+      public: virtual InstancedVisualGroupPtr CreateInstancedVisualGroup(
+                  const MeshDescriptor &_desc, MaterialPtr _material) override;
+
+      // Documentation inherited.
+      public: virtual SensorGBufferPtr CreateSensorGBuffer(
+                  const std::set<GBufferOutput> &_outputs) override;
+
       // Documentation inherited.
       public: virtual CapsulePtr CreateCapsule() override;
 
@@ -537,6 +628,51 @@ namespace gz
       public: virtual LidarVisualPtr CreateLidarVisual(unsigned int _id,
                                             const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual() override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual() override;
+
+      // Documentation inherited.
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual VoxelGridVisualPtr CreateVoxelGridVisual(
+                  unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual OceanVisualPtr CreateOceanVisual() override;
+
+      // Documentation inherited.
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual OceanVisualPtr CreateOceanVisual(
+                  unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited.
       public: virtual HeightmapPtr CreateHeightmap(
           const HeightmapDescriptor &_desc) override;
@@ -628,12 +764,67 @@ namespace gz
       // Documentation inherited.
       public: virtual bool SkyEnabled() const override;
 
+      // Documentation inherited.
+      public: virtual void SetTextureStreamingEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool TextureStreamingEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int PendingTextureLoads() const override;
+
+      // Documentation inherited.
+      public: virtual void SetMaterialSharingEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool MaterialSharingEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual void SetTextBatchingEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool TextBatchingEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual void SetRenderOrigin(const math::Vector3d &_origin)
+          override;
+
+      // Documentation inherited.
+      public: virtual math::Vector3d RenderOrigin() const override;
+
+      // Documentation inherited.
+      public: virtual ShaderParamsPtr SharedShaderParams() const override;
+
       // Documentation inherited.
       public: virtual void SetActiveGlobalIllumination(
             GlobalIlluminationBasePtr _gi) override;
 
       public: virtual void PreRender() override;
 
+      // Documentation inherited.
+      public: virtual void SetPreRenderDirtyTracking(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool PreRenderDirtyTracking() const override;
+
+      // Documentation inherited.
+      public: virtual void SetPreRenderDirty(ObjectPtr _object) override;
+
+      // Documentation inherited.
+      public: virtual SceneCommandQueue &CommandQueue() override;
+
+      // Documentation inherited.
+      public: virtual SceneDebugDraw &DebugDraw() override;
+
+      // Documentation inherited.
+      public: virtual SceneMarkerPool &MarkerPool() override;
+
+      // Documentation inherited.
+      public: virtual DiagnosticLog &Diagnostics() override;
+
+      // Documentation inherited.
+      public: virtual SceneChangeTracker &ChangeTracker() override;
+
       public: virtual void Clear() override;
 
       public: virtual void Destroy() override;
@@ -651,6 +842,107 @@ namespace gz
       // Documentation inherited.
       public: virtual bool LegacyAutoGpuFlush() const override;
 
+      // Documentation inherited.
+      public: virtual void RenderSensors(
+                  const std::vector<SensorPtr> &_sensors) override;
+
+      // Documentation inherited.
+      public: virtual void RenderCameraAtlas(
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) override;
+
+      // Documentation inherited.
+      public: virtual void RenderEnvironments(
+                  const std::vector<VisualPtr> &_environments,
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) override;
+
+      // Documentation inherited.
+      public: virtual void WarmUpShaders() override;
+
+      // Documentation inherited.
+      public: virtual void SetSensorReleaseTime(
+                  std::chrono::steady_clock::duration _time) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  SensorReleaseTime() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ReleaseSensorRenderTextures(
+                  std::chrono::steady_clock::duration _idleTime =
+                  std::chrono::steady_clock::duration::zero()) override;
+
+      // Documentation inherited.
+      public: virtual RenderStats Stats() const override;
+
+      // Documentation inherited.
+      public: virtual void ResetStats() override;
+
+      // Documentation inherited.
+      public: virtual bool SetLightClustering(
+                  const LightClusterConfig &_config) override;
+
+      // Documentation inherited.
+      public: virtual LightClusterConfig LightClustering() const override;
+
+      // Documentation inherited.
+      public: virtual bool SetShadowSettings(
+                  const ShadowConfig &_config) override;
+
+      // Documentation inherited.
+      public: virtual ShadowConfig ShadowSettings() const override;
+
+      // Documentation inherited.
+      public: virtual void SetOcclusionCulling(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool OcclusionCulling() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int BakeStaticVisuals() override;
+
+      // Documentation inherited.
+      public: virtual void UnbakeStaticVisuals() override;
+
+      // Documentation inherited.
+      public: virtual SceneSnapshot Snapshot() const override;
+
+      // Documentation inherited.
+      public: virtual void Restore(const SceneSnapshot &_snapshot) override;
+
+      // Documentation inherited.
+      public: virtual bool SaveSnapshot(const std::string &_path) const
+                  override;
+
+      // Documentation inherited.
+      public: virtual bool LoadSnapshot(const std::string &_path) override;
+
+      /// \internal
+      /// \brief Record the duration of a phase of a sensor update, called
+      /// by render engine sensors
+      /// \param[in] _name Name of the sensor
+      /// \param[in] _phase Timed phase
+      /// \param[in] _duration Duration of the phase
+      public: void RecordSensorTime(const std::string &_name,
+                  SensorPhase _phase,
+                  std::chrono::steady_clock::duration _duration);
+
+      /// \brief Get the cameras of a sensor batch that can be rendered by
+      /// this scene
+      /// \param[in] _sensors Sensors to render
+      /// \return Cameras among _sensors that belong to this scene and
+      /// are not idle
+      protected: std::vector<CameraPtr> RenderableCameras(
+                  const std::vector<SensorPtr> &_sensors) const;
+
+      /// \brief Remove the cameras whose next frame would not differ from
+      /// their last one, see Camera::SetSkipUnchangedFrames. Must be called
+      /// after PreRender.
+      /// \param[in,out] _cameras Cameras to render
+      protected: void RemoveUnchangedCameras(
+                  std::vector<CameraPtr> &_cameras) const;
+
       protected: virtual unsigned int CreateObjectId();
 
       protected: virtual std::string CreateObjectName(unsigned int _id,
@@ -738,6 +1030,22 @@ namespace gz
                    return WideAngleCameraPtr();
                  }
 
+      /// \brief Implementation for creating a camera array.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of camera array
+      /// \return Pointer to camera array
+      protected: virtual CameraArrayPtr CreateCameraArrayImpl(
+                     unsigned int _id,
+                     const std::string &_name)
+                 {
+                   // The following two lines will avoid doxygen warnings
+                   (void)_id;
+                   (void)_name;
+                   gzerr << "Camera array not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return CameraArrayPtr();
+                 }
+
       /// \brief Implementation for creating GpuRays sensor.
       /// \param[in] _id Unique id
       /// \param[in] _name Name of GpuRays sensor
@@ -820,6 +1128,48 @@ namespace gz
       protected: virtual LidarVisualPtr CreateLidarVisualImpl(unsigned int _id,
                      const std::string &_name) = 0;
 
+      /// \brief Implementation for creating a point cloud visual
+      /// \param[in] _id unique object id.
+      /// \param[in] _name unique object name.
+      /// \return Pointer to a point cloud visual
+      protected: virtual PointCloudVisualPtr CreatePointCloudVisualImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   gzerr << "PointCloudVisual not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return PointCloudVisualPtr();
+                 }
+
+      /// \brief Implementation for creating a voxel grid visual
+      /// \param[in] _id unique object id.
+      /// \param[in] _name unique object name.
+      /// \return Pointer to a voxel grid visual
+      protected: virtual VoxelGridVisualPtr CreateVoxelGridVisualImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   gzerr << "VoxelGridVisual not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return VoxelGridVisualPtr();
+                 }
+
+      /// \brief Implementation for creating a ocean visual
+      /// \param[in] _id unique object id.
+      /// \param[in] _name unique object name.
+      /// \return Pointer to a ocean visual
+      protected: virtual OceanVisualPtr CreateOceanVisualImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   gzerr << "OceanVisual not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return OceanVisualPtr();
+                 }
+
       /// \brief Implementation for creating a heightmap geometry
       /// \param[in] _id Unique object id.
       /// \param[in] _name Unique object name.
@@ -973,11 +1323,102 @@ namespace gz
       /// \brief Scene background material.
       protected: MaterialPtr backgroundMaterial;
 
+      /// \brief Rendering statistics, see Stats. Render engines fill in
+      /// the frame counters.
+      protected: RenderStats stats;
+
+      /// \brief Clustered forward lighting configuration, see
+      /// SetLightClustering
+      protected: LightClusterConfig lightClustering;
+
+      /// \brief Shadow settings, see SetShadowSettings
+      protected: ShadowConfig shadowSettings;
+
+      /// \brief True if occlusion culling is enabled, see
+      /// SetOcclusionCulling
+      protected: bool occlusionCulling = false;
+
+      /// \brief Idle time after which sensors release their render
+      /// textures, see SetSensorReleaseTime
+      protected: std::chrono::steady_clock::duration sensorReleaseTime{0};
+
+      /// \brief Scene time each sensor was last rendered at, indexed by
+      /// sensor name
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      protected: std::map<std::string, std::chrono::steady_clock::duration>
+                  sensorRenderTimes;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Destroy the nodes queued by DestroyVisualDeferred until
+      /// the destruction budget is used, called by PreRender
+      private: void DestroyPendingNodes();
+
+      /// \brief Time per frame spent destroying queued nodes, see
+      /// SetDestructionBudget
+      private: std::chrono::steady_clock::duration destructionBudget =
+                  std::chrono::milliseconds(2);
+
+      /// \brief Nodes queued by DestroyVisualDeferred, children first
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::deque<NodePtr> pendingDestruction;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
       private: unsigned int nextObjectId;
 
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      /// \brief Visuals indexed by their compact id, see
+      /// Visual::CompactId
+      private: std::vector<std::weak_ptr<Visual>> compactVisuals;
+
+      /// \brief Compact ids of destroyed visuals, free for reuse
+      private: std::vector<uint32_t> freeCompactIds;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief True if PreRender only visits dirty objects
+      private: bool preRenderDirtyTracking = false;
+
+      /// \brief True if the next PreRender must traverse the whole scene
+      /// graph even if dirty tracking is enabled
+      private: bool preRenderFullTraversal = true;
+
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      /// \brief Objects to pre-render on the next PreRender, keyed by id
+      private: std::map<unsigned int, std::weak_ptr<Object>> preRenderDirty;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       private: NodeStorePtr nodes;
       GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Commands enqueued by other threads, see CommandQueue
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneCommandQueue> commandQueue;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Transient debug geometry, see DebugDraw
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneDebugDraw> debugDraw;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Markers retired when their lifetime ends, see MarkerPool
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneMarkerPool> markerPool;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Rate limited diagnostics, see Diagnostics
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<DiagnosticLog> diagnostics;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Where the scene changed, see ChangeTracker
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<SceneChangeTracker> changeTracker;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Staged and published poses, see StageWorldPose
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<BaseSceneState> state;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
     };
     }
   }
@@ -17,7 +17,9 @@
 #ifndef GZ_RENDERING_BASE_BASESEGMENTATIONCAMERA_HH_
 #define GZ_RENDERING_BASE_BASESEGMENTATIONCAMERA_HH_
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 
@@ -48,6 +50,10 @@ namespace gz
       // Documentation inherited
       public: virtual uint8_t *SegmentationData() const override;
 
+      // Documentation inherited
+      public: virtual std::shared_ptr<const uint8_t> AcquireSegmentationData()
+          const override;
+
       // Documentation inherited
       public: virtual gz::common::ConnectionPtr
         ConnectNewSegmentationFrame(
@@ -84,6 +90,18 @@ namespace gz
       public: void LabelMapFromColoredBuffer(
                   uint8_t *_labelBuffer) const override = 0;
 
+      // Documentation inherited
+      public: virtual gz::common::ConnectionPtr
+        ConnectNewSegmentationInstances(
+          std::function<void(const std::vector<SegmentationInstance> &,
+          unsigned int, unsigned int)> _subscriber) override;
+
+      // Documentation inherited
+      public: virtual void EnableInstanceRuns(bool _enable) override;
+
+      // Documentation inherited
+      public: virtual bool IsInstanceRunsEnabled() const override;
+
       /// \brief The buffer that contains segmentation data
       protected: uint8_t *segmentationData {nullptr};
 
@@ -100,6 +118,9 @@ namespace gz
 
       /// \brief The label of background objects
       protected: int backgroundLabel {0};
+
+      /// \brief Whether the runs of the sparse segmentation are computed
+      protected: bool instanceRunsEnabled {false};
     };
 
     //////////////////////////////////////////////////
@@ -126,6 +147,14 @@ namespace gz
       return this->segmentationData;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::shared_ptr<const uint8_t>
+        BaseSegmentationCamera<T>::AcquireSegmentationData() const
+    {
+      return nullptr;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     gz::common::ConnectionPtr BaseSegmentationCamera<T>::
@@ -192,6 +221,30 @@ namespace gz
     {
       return this->backgroundLabel;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    gz::common::ConnectionPtr BaseSegmentationCamera<T>::
+      ConnectNewSegmentationInstances(
+          std::function<void(const std::vector<SegmentationInstance> &,
+          unsigned int, unsigned int)>)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSegmentationCamera<T>::EnableInstanceRuns(bool _enable)
+    {
+      this->instanceRunsEnabled = _enable;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSegmentationCamera<T>::IsInstanceRunsEnabled() const
+    {
+      return this->instanceRunsEnabled;
+    }
   }
   }
 }
@@ -40,8 +40,50 @@ namespace gz
       // Documentation inherited.
       public: virtual uint32_t VisibilityMask() const override;
 
+      // Documentation inherited.
+      public: virtual void SetQualityProfile(
+                  const SensorQualityProfile &_profile) override;
+
+      // Documentation inherited.
+      public: virtual SensorQualityProfile QualityProfile() const override;
+
+      // Documentation inherited.
+      public: virtual void SetDemandDriven(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool DemandDriven() const override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
+      // Documentation inherited.
+      public: virtual void RequestCapture() override;
+
+      // Documentation inherited.
+      public: virtual bool IsIdle() const override;
+
+      // Documentation inherited.
+      public: virtual void ClearCaptureRequest() override;
+
+      // Documentation inherited.
+      public: virtual bool ReleaseRenderTextures() override;
+
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
       /// \brief Camera's visibility mask
       protected: uint32_t visibilityMask = GZ_VISIBILITY_ALL;
+
+      /// \brief Rendering features the sensor may skip
+      protected: SensorQualityProfile qualityProfile;
+
+      /// \brief Whether the sensor is only rendered on demand
+      protected: bool demandDriven = false;
+
+      /// \brief Whether a capture was requested since the sensor was last
+      /// rendered. Mutable so that const data accessors can request the
+      /// next frame.
+      protected: mutable bool captureRequested = false;
     };
 
     //////////////////////////////////////////////////
@@ -69,6 +111,78 @@ namespace gz
     {
       return this->visibilityMask;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSensor<T>::SetQualityProfile(
+        const SensorQualityProfile &_profile)
+    {
+      this->qualityProfile = _profile;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    SensorQualityProfile BaseSensor<T>::QualityProfile() const
+    {
+      return this->qualityProfile;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSensor<T>::SetDemandDriven(bool _enabled)
+    {
+      this->demandDriven = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSensor<T>::DemandDriven() const
+    {
+      return this->demandDriven;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSensor<T>::HasConnections() const
+    {
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSensor<T>::RequestCapture()
+    {
+      this->captureRequested = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSensor<T>::IsIdle() const
+    {
+      return this->demandDriven && !this->captureRequested &&
+          !this->HasConnections();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseSensor<T>::ClearCaptureRequest()
+    {
+      this->captureRequested = false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseSensor<T>::ReleaseRenderTextures()
+    {
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    size_t BaseSensor<T>::MemoryUsage() const
+    {
+      return 0u;
+    }
     }
   }
 }
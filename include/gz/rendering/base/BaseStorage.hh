@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gz/common/Console.hh>
@@ -80,7 +81,17 @@ namespace gz
 
       protected: virtual bool IsValidIter(ConstUIter _iter) const;
 
+      /// \brief Rebuild the index used by DerivedByIndex if the map changed
+      protected: void UpdateIndex() const;
+
       protected: UMap map;
+
+      /// \brief Map iterators in key order, for constant time access by
+      /// index. Rebuilt on the first indexed access after the map changed.
+      protected: mutable std::vector<ConstUIter> index;
+
+      /// \brief True if the index needs to be rebuilt
+      protected: mutable bool indexDirty = true;
     };
 
     //////////////////////////////////////////////////
@@ -94,7 +105,8 @@ namespace gz
 
       typedef std::shared_ptr<U> UPtr;
 
-      typedef std::map<std::string, int> UStoreMap;
+      typedef std::unordered_map<std::string, size_t> UStoreMap;
+      typedef std::unordered_map<unsigned int, size_t> UStoreIdMap;
       typedef std::vector<UPtr> UStore;
 
       typedef typename UStore::iterator UIter;
@@ -233,7 +245,12 @@ namespace gz
       protected: virtual UIter RemoveConstness(ConstUIter _iter);
 
       protected: UStore store;
+
+      /// \brief Index into store by object name
       protected: UStoreMap storeMap;
+
+      /// \brief Index into store by object id
+      protected: UStoreIdMap storeIdMap;
     };
 
     //////////////////////////////////////////////////
@@ -515,6 +532,7 @@ namespace gz
       }
 
       this->map[_key] = derived;
+      this->indexDirty = true;
       return true;
     }
 
@@ -527,6 +545,7 @@ namespace gz
       if (this->IsValidIter(iter))
       {
         this->map.erase(iter);
+        this->indexDirty = true;
       }
     }
 
@@ -540,7 +559,8 @@ namespace gz
       {
         if (iter->second == _value)
         {
-          this->map.erase(iter);
+          iter = this->map.erase(iter);
+          this->indexDirty = true;
           continue;
         }
 
@@ -553,6 +573,8 @@ namespace gz
     void BaseMap<T, U>::RemoveAll()
     {
       this->map.clear();
+      this->index.clear();
+      this->indexDirty = false;
     }
 
     //////////////////////////////////////////////////
@@ -575,9 +597,8 @@ namespace gz
         return nullptr;
       }
 
-      auto iter = this->map.begin();
-      std::advance(iter, _index);
-      return iter->second;
+      this->UpdateIndex();
+      return this->index[_index]->second;
     }
 
     //////////////////////////////////////////////////
@@ -587,6 +608,20 @@ namespace gz
       return _iter != this->map.end();
     }
 
+    //////////////////////////////////////////////////
+    template <class T, class U>
+    void BaseMap<T, U>::UpdateIndex() const
+    {
+      if (!this->indexDirty)
+        return;
+
+      this->index.clear();
+      this->index.reserve(this->map.size());
+      for (auto iter = this->map.cbegin(); iter != this->map.cend(); ++iter)
+        this->index.push_back(iter);
+      this->indexDirty = false;
+    }
+
     //////////////////////////////////////////////////
     template <class T, class U>
     BaseStore<T, U>::BaseStore()
@@ -732,6 +767,7 @@ namespace gz
     {
       this->store.clear();
       this->storeMap.clear();
+      this->storeIdMap.clear();
     }
 
     //////////////////////////////////////////////////
@@ -859,18 +895,18 @@ namespace gz
     typename BaseStore<T, U>::ConstUIter
     BaseStore<T, U>::ConstIter(ConstTPtr _object) const
     {
-      auto begin = this->store.begin();
-      auto end = this->store.end();
+      if (!_object)
+      {
+        return this->store.end();
+      }
 
-      for (auto iter = begin; iter != end; ++iter)
+      auto iter = this->ConstIterById(_object->Id());
+      if (this->IsValidIter(iter) && *iter == _object)
       {
-        if (*iter == _object)
-        {
-          return iter;
-        }
+        return iter;
       }
 
-      return end;
+      return this->store.end();
     }
 
     //////////////////////////////////////////////////
@@ -878,18 +914,12 @@ namespace gz
     typename BaseStore<T, U>::ConstUIter
     BaseStore<T, U>::ConstIterById(unsigned int _id) const
     {
-      auto begin = this->store.begin();
-      auto end = this->store.end();
-
-      for (auto iter = begin; iter != end; ++iter)
+      auto idx = this->storeIdMap.find(_id);
+      if (idx == this->storeIdMap.end())
       {
-        if ((*iter)->Id() == _id)
-        {
-          return iter;
-        }
+        return this->store.end();
       }
-
-      return end;
+      return this->store.begin() + idx->second;
     }
 
     //////////////////////////////////////////////////
@@ -902,7 +932,7 @@ namespace gz
       {
         return this->store.end();
       }
-      return ConstIterByIndex(idx->second);
+      return this->store.begin() + idx->second;
     }
 
     //////////////////////////////////////////////////
@@ -916,9 +946,7 @@ namespace gz
         return this->store.end();
       }
 
-      auto iter = this->store.begin();
-      std::advance(iter, _index);
-      return iter;
+      return this->store.begin() + _index;
     }
 
     //////////////////////////////////////////////////
@@ -978,6 +1006,7 @@ namespace gz
       }
 
       this->storeMap[name] = this->store.size();
+      this->storeIdMap[id] = this->store.size();
       this->store.emplace_back(_object);
       return true;
     }
@@ -993,20 +1022,18 @@ namespace gz
       }
 
 
-      auto idx = std::distance(this->store.begin(), _iter);
-      std::string nameToErase;
-      for (auto &[name, objIdx] : this->storeMap)
-      {
-        if (objIdx == idx)
-          nameToErase = name;
-
-        if (objIdx >= idx)
-          objIdx--;
-      }
-      this->storeMap.erase(nameToErase);
-
+      size_t idx = std::distance(this->store.begin(), _iter);
       UPtr result = *_iter;
+      this->storeMap.erase(result->Name());
+      this->storeIdMap.erase(result->Id());
       this->store.erase(_iter);
+
+      // keep insertion order, only the objects after the removed one move
+      for (size_t i = idx; i < this->store.size(); ++i)
+      {
+        this->storeMap[this->store[i]->Name()] = i;
+        this->storeIdMap[this->store[i]->Id()] = i;
+      }
       return result;
     }
 
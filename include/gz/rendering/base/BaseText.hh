@@ -160,6 +160,7 @@ namespace gz
     {
       this->fontName = _font;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -175,6 +176,7 @@ namespace gz
     {
       this->text = _text;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -190,6 +192,7 @@ namespace gz
     {
       this->color = _color;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -205,6 +208,7 @@ namespace gz
     {
       this->charHeight = _height;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -220,6 +224,7 @@ namespace gz
     {
       this->spaceWidth = _width;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -244,6 +249,7 @@ namespace gz
       this->horizontalAlign = _horzAlign;
       this->verticalAlign = _vertAlign;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -259,6 +265,7 @@ namespace gz
     {
       this->baseline = _baseline;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -274,6 +281,7 @@ namespace gz
     {
       this->onTop = _onTop;
       this->textDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_BASE_BASETHERMALCAMERA_HH_
 #define GZ_RENDERING_BASE_BASETHERMALCAMERA_HH_
 
+#include <memory>
 #include <string>
 
 #include "gz/rendering/base/BaseCamera.hh"
@@ -82,6 +83,10 @@ namespace gz
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual std::shared_ptr<const uint16_t> AcquireThermalData()
+          const override;
+
       /// \brief Ambient temperature of the environment
       protected: float ambient = 0.0f;
 
@@ -205,6 +210,14 @@ namespace gz
     {
       return nullptr;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::shared_ptr<const uint16_t> BaseThermalCamera<T>::AcquireThermalData()
+        const
+    {
+      return nullptr;
+    }
   }
   }
 }
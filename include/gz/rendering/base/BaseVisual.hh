@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_BASE_BASEVISUAL_HH_
 #define GZ_RENDERING_BASE_BASEVISUAL_HH_
 
+#include <limits>
 #include <map>
 #include <string>
 
@@ -88,6 +89,9 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetVisible(bool _visible) override;
 
+      // Documentation inherited.
+      public: virtual bool Visible() const override;
+
       // Documentation inherited.
       public: virtual bool Static() const override;
 
@@ -106,6 +110,12 @@ namespace gz
       // Documentation inherited.
       public: virtual void RemoveVisibilityFlags(uint32_t _flags) override;
 
+      // Documentation inherited.
+      public: virtual uint32_t CompactId() const override;
+
+      // Documentation inherited.
+      public: virtual void SetCompactId(uint32_t _id) override;
+
       // Documentation inherited.
       public: virtual void PreRender() override;
 
@@ -140,11 +150,18 @@ namespace gz
       /// \brief Visual's visibility flags
       protected: uint32_t visibilityFlags = GZ_VISIBILITY_ALL;
 
+      /// \brief Compact id assigned by the scene, see CompactId
+      protected: uint32_t compactId = std::numeric_limits<uint32_t>::max();
+
       /// \brief The bounding box of the visual
       protected: gz::math::AxisAlignedBox boundingBox;
 
       /// \brief True if wireframe mode is enabled else false
       protected: bool wireframe = false;
+
+      /// \brief Whether the visual is visible, set by render engines in
+      /// SetVisible
+      protected: bool visible = true;
     };
 
     //////////////////////////////////////////////////
@@ -184,6 +201,9 @@ namespace gz
         return;
       }
 
+      if (this->TrackSceneChanges() && rawPose != this->RawLocalPose())
+        this->MarkSceneChanged();
+
       this->SetRawLocalPose(rawPose);
     }
 
@@ -212,9 +232,11 @@ namespace gz
     template <class T>
     void BaseVisual<T>::AddGeometry(GeometryPtr _geometry)
     {
+      this->MarkSceneChanged();
       if (this->AttachGeometry(_geometry))
       {
         this->Geometries()->Add(_geometry);
+        this->Scene()->SetPreRenderDirty(_geometry);
       }
     }
 
@@ -222,6 +244,7 @@ namespace gz
     template <class T>
     GeometryPtr BaseVisual<T>::RemoveGeometry(GeometryPtr _geometry)
     {
+      this->MarkSceneChanged();
       if (this->DetachGeometry(_geometry))
       {
         this->Geometries()->Remove(_geometry);
@@ -258,10 +281,12 @@ namespace gz
     template <class T>
     void BaseVisual<T>::SetMaterial(MaterialPtr _material, bool _unique)
     {
+      this->MarkSceneChanged();
       _material = (_unique) ? _material->Clone() : _material;
       this->SetChildMaterial(_material, false);
       this->SetGeometryMaterial(_material, false);
       this->material = _material;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -320,6 +345,7 @@ namespace gz
     template <class T>
     void BaseVisual<T>::Destroy()
     {
+      this->MarkSceneChanged();
       this->Geometries()->DestroyAll();
       this->Children()->RemoveAll();
       this->material.reset();
@@ -373,6 +399,13 @@ namespace gz
              << std::endl;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseVisual<T>::Visible() const
+    {
+      return this->visible;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseVisual<T>::SetVisible(bool _visible)
@@ -468,6 +501,8 @@ namespace gz
     template <class T>
     void BaseVisual<T>::SetVisibilityFlags(uint32_t _flags)
     {
+      if (this->visibilityFlags != _flags)
+        this->MarkSceneChanged();
       this->visibilityFlags = _flags;
 
       // recursively set child visuals' visibility flags
@@ -494,6 +529,20 @@ namespace gz
       return this->visibilityFlags;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    uint32_t BaseVisual<T>::CompactId() const
+    {
+      return this->compactId;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVisual<T>::SetCompactId(uint32_t _id)
+    {
+      this->compactId = _id;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     VisualPtr BaseVisual<T>::Clone(const std::string &_name,
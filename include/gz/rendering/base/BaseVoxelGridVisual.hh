@@ -0,0 +1,511 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASEVOXELGRIDVISUAL_HH_
+#define GZ_RENDERING_BASEVOXELGRIDVISUAL_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/VoxelGridVisual.hh"
+#include "gz/rendering/base/BaseObject.hh"
+#include "gz/rendering/base/BaseRenderTypes.hh"
+#include "gz/rendering/Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    /// \brief Base implementation of a voxel grid visual. It stores the
+    /// voxels per block and builds the faces of a block; render engines
+    /// rebuild the blocks in dirtyBlocks on PreRender.
+    template <class T>
+    class BaseVoxelGridVisual :
+      public virtual VoxelGridVisual,
+      public virtual T
+    {
+      /// \brief Voxel of a cell
+      protected: struct Voxel
+      {
+        /// \brief Color, red in the lowest byte
+        uint32_t rgb;
+
+        /// \brief Occupancy probability
+        float occupancy;
+      };
+
+      /// \brief Voxels of a block, indexed by their index in the block
+      protected: struct Block
+      {
+        /// \brief Voxels of the block
+        std::unordered_map<uint16_t, Voxel> voxels;
+
+        /// \brief Number of faces built for the block
+        unsigned int faceCount = 0u;
+      };
+
+      /// \brief Number of bits of the cell coordinates within a block
+      protected: static constexpr int kBlockBits = 4;
+
+      /// \brief Number of cells of a block along each axis
+      protected: static constexpr int kBlockSize = 1 << kBlockBits;
+
+      // Documentation inherited
+      protected: BaseVoxelGridVisual();
+
+      // Documentation inherited
+      public: virtual ~BaseVoxelGridVisual();
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void SetResolution(double _resolution) override;
+
+      // Documentation inherited
+      public: virtual double Resolution() const override;
+
+      // Documentation inherited
+      public: virtual void SetVoxel(const math::Vector3i &_cell,
+                  const math::Color &_color, double _occupancy = 1.0)
+                  override;
+
+      // Documentation inherited
+      public: virtual bool RemoveVoxel(const math::Vector3i &_cell)
+                  override;
+
+      // Documentation inherited
+      public: virtual bool HasVoxel(const math::Vector3i &_cell) const
+                  override;
+
+      // Documentation inherited
+      public: virtual void ClearVoxels() override;
+
+      // Documentation inherited
+      public: virtual unsigned int VoxelCount() const override;
+
+      // Documentation inherited
+      public: virtual void SetOccupancyThreshold(double _threshold)
+                  override;
+
+      // Documentation inherited
+      public: virtual double OccupancyThreshold() const override;
+
+      // Documentation inherited
+      public: virtual math::Vector3i Cell(const math::Vector3d &_position)
+                  const override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d CellCenter(
+                  const math::Vector3i &_cell) const override;
+
+      // Documentation inherited
+      public: virtual unsigned int RenderedFaceCount() const override;
+
+      /// \brief Build the faces of a block. Updates RenderedFaceCount.
+      /// \param[in] _key Key of the block
+      /// \param[out] _vertices Vertices of the faces, 6 per face and 4
+      /// floats per vertex: the position in the frame of the visual and
+      /// the bits of the color, red in the lowest byte, with the index of
+      /// the face direction plus 64 in the highest byte. The direction
+      /// index is 0 to 5 for +x, -x, +y, -y, +z and -z.
+      /// \return Number of faces
+      protected: unsigned int BuildBlockFaces(uint64_t _key,
+                     std::vector<float> &_vertices);
+
+      /// \brief Get the key of the block of a cell
+      /// \param[in] _x Cell x coordinate
+      /// \param[in] _y Cell y coordinate
+      /// \param[in] _z Cell z coordinate
+      /// \param[out] _local Index of the cell in the block
+      /// \return Key of the block
+      protected: static uint64_t BlockKey(int _x, int _y, int _z,
+                     uint16_t &_local);
+
+      /// \brief Get whether a cell has a voxel that is rendered
+      /// \param[in] _x Cell x coordinate
+      /// \param[in] _y Cell y coordinate
+      /// \param[in] _z Cell z coordinate
+      /// \return True if the voxel is at or above the threshold
+      protected: bool Rendered(int _x, int _y, int _z) const;
+
+      /// \brief Mark the block of a cell as changed, and the neighbouring
+      /// blocks whose faces depend on the cell
+      /// \param[in] _cell Cell that changed
+      protected: void MarkDirty(const math::Vector3i &_cell);
+
+      /// \brief Mark all blocks as changed
+      protected: void MarkAllDirty();
+
+      /// \brief Voxels, per block
+      protected: std::unordered_map<uint64_t, Block> blocks;
+
+      /// \brief Keys of the blocks whose faces need to be rebuilt,
+      /// including blocks that were emptied
+      protected: std::unordered_set<uint64_t> dirtyBlocks;
+
+      /// \brief Edge length of the cells
+      protected: double resolution = 0.1;
+
+      /// \brief Occupancy below which voxels are not rendered
+      protected: double occupancyThreshold = 0.5;
+
+      /// \brief Number of voxels
+      protected: unsigned int voxelCount = 0u;
+
+      /// \brief Number of faces of all blocks
+      protected: unsigned int renderedFaceCount = 0u;
+    };
+
+    /// \brief Offset of the block coordinates in their 21 bit field
+    static constexpr int64_t kVoxelBlockOffset = 1 << 20;
+
+    /// \brief Floor division of a cell coordinate by the block size
+    /// \param[in] _v Cell coordinate
+    /// \param[in] _bits Number of bits of the block size
+    /// \return Block coordinate
+    inline int VoxelBlockCoord(int _v, int _bits)
+    {
+      const int size = 1 << _bits;
+      return _v >= 0 ? _v / size : -((-_v + size - 1) / size);
+    }
+
+    /////////////////////////////////////////////////
+    // BaseVoxelGridVisual
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseVoxelGridVisual<T>::BaseVoxelGridVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    BaseVoxelGridVisual<T>::~BaseVoxelGridVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::Destroy()
+    {
+      T::Destroy();
+      this->blocks.clear();
+      this->dirtyBlocks.clear();
+      this->voxelCount = 0u;
+      this->renderedFaceCount = 0u;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::SetResolution(double _resolution)
+    {
+      if (!(_resolution > 0.0))
+      {
+        gzerr << "Voxel grid resolution must be positive" << std::endl;
+        return;
+      }
+      this->resolution = _resolution;
+      this->MarkAllDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseVoxelGridVisual<T>::Resolution() const
+    {
+      return this->resolution;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::SetVoxel(const math::Vector3i &_cell,
+        const math::Color &_color, double _occupancy)
+    {
+      uint16_t local;
+      const uint64_t key =
+          BlockKey(_cell.X(), _cell.Y(), _cell.Z(), local);
+      math::Color color = _color;
+      color.Clamp();
+      Voxel voxel;
+      voxel.rgb = static_cast<uint32_t>(std::lround(color.R() * 255.0f)) |
+          static_cast<uint32_t>(std::lround(color.G() * 255.0f)) << 8 |
+          static_cast<uint32_t>(std::lround(color.B() * 255.0f)) << 16;
+      voxel.occupancy = static_cast<float>(_occupancy);
+
+      auto &voxels = this->blocks[key].voxels;
+      auto it = voxels.find(local);
+      if (it == voxels.end())
+      {
+        voxels.emplace(local, voxel);
+        ++this->voxelCount;
+      }
+      else
+      {
+        // only changes of the rendered state affect the neighbours
+        const bool wasRendered =
+            it->second.occupancy >= this->occupancyThreshold;
+        const bool changed = it->second.rgb != voxel.rgb ||
+            wasRendered != (voxel.occupancy >= this->occupancyThreshold);
+        it->second = voxel;
+        if (!changed)
+          return;
+      }
+      this->MarkDirty(_cell);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    bool BaseVoxelGridVisual<T>::RemoveVoxel(const math::Vector3i &_cell)
+    {
+      uint16_t local;
+      const uint64_t key =
+          BlockKey(_cell.X(), _cell.Y(), _cell.Z(), local);
+      auto blockIt = this->blocks.find(key);
+      if (blockIt == this->blocks.end() ||
+          blockIt->second.voxels.erase(local) == 0u)
+      {
+        return false;
+      }
+      --this->voxelCount;
+      this->MarkDirty(_cell);
+      return true;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    bool BaseVoxelGridVisual<T>::HasVoxel(const math::Vector3i &_cell) const
+    {
+      uint16_t local;
+      const uint64_t key =
+          BlockKey(_cell.X(), _cell.Y(), _cell.Z(), local);
+      auto blockIt = this->blocks.find(key);
+      return blockIt != this->blocks.end() &&
+          blockIt->second.voxels.count(local) > 0u;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::ClearVoxels()
+    {
+      // the emptied blocks are rebuilt to release their faces
+      for (auto &it : this->blocks)
+      {
+        it.second.voxels.clear();
+        this->dirtyBlocks.insert(it.first);
+      }
+      this->voxelCount = 0u;
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseVoxelGridVisual<T>::VoxelCount() const
+    {
+      return this->voxelCount;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::SetOccupancyThreshold(double _threshold)
+    {
+      this->occupancyThreshold = _threshold;
+      this->MarkAllDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BaseVoxelGridVisual<T>::OccupancyThreshold() const
+    {
+      return this->occupancyThreshold;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Vector3i BaseVoxelGridVisual<T>::Cell(
+        const math::Vector3d &_position) const
+    {
+      return math::Vector3i(
+          static_cast<int>(std::floor(_position.X() / this->resolution)),
+          static_cast<int>(std::floor(_position.Y() / this->resolution)),
+          static_cast<int>(std::floor(_position.Z() / this->resolution)));
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseVoxelGridVisual<T>::CellCenter(
+        const math::Vector3i &_cell) const
+    {
+      return math::Vector3d(
+          (_cell.X() + 0.5) * this->resolution,
+          (_cell.Y() + 0.5) * this->resolution,
+          (_cell.Z() + 0.5) * this->resolution);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseVoxelGridVisual<T>::RenderedFaceCount() const
+    {
+      return this->renderedFaceCount;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    uint64_t BaseVoxelGridVisual<T>::BlockKey(int _x, int _y, int _z,
+        uint16_t &_local)
+    {
+      const int bx = VoxelBlockCoord(_x, kBlockBits);
+      const int by = VoxelBlockCoord(_y, kBlockBits);
+      const int bz = VoxelBlockCoord(_z, kBlockBits);
+      _local = static_cast<uint16_t>(
+          (_x - bx * kBlockSize) |
+          (_y - by * kBlockSize) << kBlockBits |
+          (_z - bz * kBlockSize) << (2 * kBlockBits));
+      return static_cast<uint64_t>(bx + kVoxelBlockOffset) |
+          static_cast<uint64_t>(by + kVoxelBlockOffset) << 21 |
+          static_cast<uint64_t>(bz + kVoxelBlockOffset) << 42;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    bool BaseVoxelGridVisual<T>::Rendered(int _x, int _y, int _z) const
+    {
+      uint16_t local;
+      const uint64_t key = BlockKey(_x, _y, _z, local);
+      auto blockIt = this->blocks.find(key);
+      if (blockIt == this->blocks.end())
+        return false;
+      auto it = blockIt->second.voxels.find(local);
+      return it != blockIt->second.voxels.end() &&
+          it->second.occupancy >= this->occupancyThreshold;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::MarkDirty(const math::Vector3i &_cell)
+    {
+      uint16_t local;
+      this->dirtyBlocks.insert(
+          BlockKey(_cell.X(), _cell.Y(), _cell.Z(), local));
+
+      // the faces between the cell and its neighbours belong to both
+      static const int kOffsets[6][3] = {
+          {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1},
+          {0, 0, -1}};
+      for (const auto &offset : kOffsets)
+      {
+        this->dirtyBlocks.insert(BlockKey(_cell.X() + offset[0],
+            _cell.Y() + offset[1], _cell.Z() + offset[2], local));
+      }
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseVoxelGridVisual<T>::MarkAllDirty()
+    {
+      for (const auto &it : this->blocks)
+        this->dirtyBlocks.insert(it.first);
+      this->SetPreRenderDirty();
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseVoxelGridVisual<T>::BuildBlockFaces(uint64_t _key,
+        std::vector<float> &_vertices)
+    {
+      _vertices.clear();
+      auto blockIt = this->blocks.find(_key);
+      if (blockIt == this->blocks.end())
+        return 0u;
+      Block &block = blockIt->second;
+
+      // corners of the faces in the +x, -x, +y, -y, +z and -z directions,
+      // counter clockwise seen from outside the cube
+      static const int kCorners[6][4][3] = {
+          {{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}},
+          {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}},
+          {{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}},
+          {{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}},
+          {{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+          {{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}}};
+      static const int kNormals[6][3] = {
+          {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1},
+          {0, 0, -1}};
+      static const int kTriangles[6] = {0, 1, 2, 0, 2, 3};
+
+      const int mask = kBlockSize - 1;
+      const int bx = static_cast<int>(
+          static_cast<int64_t>(_key & 0x1FFFFFu) - kVoxelBlockOffset);
+      const int by = static_cast<int>(
+          static_cast<int64_t>((_key >> 21) & 0x1FFFFFu) - kVoxelBlockOffset);
+      const int bz = static_cast<int>(
+          static_cast<int64_t>((_key >> 42) & 0x1FFFFFu) - kVoxelBlockOffset);
+
+      unsigned int faceCount = 0u;
+      for (const auto &it : block.voxels)
+      {
+        const Voxel &voxel = it.second;
+        if (voxel.occupancy < this->occupancyThreshold)
+          continue;
+        const int x = bx * kBlockSize + (it.first & mask);
+        const int y = by * kBlockSize + ((it.first >> kBlockBits) & mask);
+        const int z = bz * kBlockSize + ((it.first >> (2 * kBlockBits)) & mask);
+        for (int f = 0; f < 6; ++f)
+        {
+          if (this->Rendered(x + kNormals[f][0], y + kNormals[f][1],
+              z + kNormals[f][2]))
+          {
+            continue;
+          }
+          // the direction keeps the float a normal number whatever the
+          // color is
+          const uint32_t bits = voxel.rgb |
+              static_cast<uint32_t>(64 + f) << 24;
+          float w;
+          std::memcpy(&w, &bits, sizeof(w));
+          for (int v : kTriangles)
+          {
+            const int *corner = kCorners[f][v];
+            _vertices.push_back(static_cast<float>(
+                (x + corner[0]) * this->resolution));
+            _vertices.push_back(static_cast<float>(
+                (y + corner[1]) * this->resolution));
+            _vertices.push_back(static_cast<float>(
+                (z + corner[2]) * this->resolution));
+            _vertices.push_back(w);
+          }
+          ++faceCount;
+        }
+      }
+
+      this->renderedFaceCount += faceCount;
+      this->renderedFaceCount -= block.faceCount;
+      block.faceCount = faceCount;
+      if (block.voxels.empty())
+        this->blocks.erase(blockIt);
+      return faceCount;
+    }
+    }
+  }
+}
+#endif
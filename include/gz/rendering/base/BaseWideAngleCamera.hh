@@ -18,6 +18,7 @@
 #define GZ_RENDERING_BASE_BASEWIDEANGLECAMERA_HH_
 
 #include <string>
+#include <vector>
 
 #include <gz/common/Event.hh>
 
@@ -55,11 +56,27 @@ namespace gz
       public: virtual math::Vector3d Project3d(const math::Vector3d &_pt) const
           override;
 
+      // Documentation inherited.
+      public: virtual std::vector<math::Vector3d> Project3d(
+          const std::vector<math::Vector3d> &_pts) const override;
+
+      /// \brief Project many points in 3d world space to 2d screen space
+      /// with the lens model, see Project3d
+      /// \param[in] _pts Points in 3d world space
+      /// \param[out] _screenPts Points in 2d screen space
+      /// \param[in] _count Number of points
+      public: virtual void ProjectPoints(const math::Vector3d *_pts,
+          math::Vector2d *_screenPts, size_t _count) const override;
+
       // Documentation inherited.
       public: virtual common::ConnectionPtr ConnectNewWideAngleFrame(
           std::function<void(const unsigned char*, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited.
+      protected: virtual bool ViewFrustum(math::Frustum &_frustum) const
+                     override;
+
       /// \brief Camera lens used by this wide angle camera
       protected: CameraLens lens;
     };
@@ -107,6 +124,29 @@ namespace gz
       return math::Vector3d();
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<math::Vector3d> BaseWideAngleCamera<T>::Project3d(
+        const std::vector<math::Vector3d> &_pts) const
+    {
+      std::vector<math::Vector3d> screenPts;
+      screenPts.reserve(_pts.size());
+      for (const auto &pt : _pts)
+        screenPts.push_back(this->Project3d(pt));
+      return screenPts;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseWideAngleCamera<T>::ProjectPoints(const math::Vector3d *_pts,
+        math::Vector2d *_screenPts, size_t _count) const
+    {
+      const std::vector<math::Vector3d> screenPts =
+          this->Project3d(std::vector<math::Vector3d>(_pts, _pts + _count));
+      for (size_t i = 0u; i < screenPts.size(); ++i)
+        _screenPts[i].Set(screenPts[i].X(), screenPts[i].Y());
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     common::ConnectionPtr BaseWideAngleCamera<T>::ConnectNewWideAngleFrame(
@@ -115,6 +155,15 @@ namespace gz
     {
       return nullptr;
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseWideAngleCamera<T>::ViewFrustum(math::Frustum &/*_frustum*/)
+        const
+    {
+      // the lens maps a cube map, which a frustum does not bound
+      return false;
+    }
   }
   }
 }
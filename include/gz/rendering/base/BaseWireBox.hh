@@ -91,6 +91,7 @@ namespace gz
     {
       this->box = _box;
       this->wireBoxDirty = true;
+      this->SetPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
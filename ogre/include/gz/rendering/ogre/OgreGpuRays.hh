@@ -78,6 +78,9 @@ namespace gz
       // Documentation inherited
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       // Documentation inherited
       public: virtual const float *Data() const override;
 
@@ -112,6 +112,14 @@ namespace gz
       /// \return a list of FSAA levels
       public: std::vector<unsigned int> FSAALevels() const;
 
+      /// \internal
+      /// \brief Get the directory where the RT shader system caches the
+      /// shaders it generates. Set by passing "shaderCachePath" = <dir> to
+      /// RenderEngine::Load, e.g. a persistent volume in containers.
+      /// \return Path to the shader cache directory, empty to use
+      /// ~/.gz/rendering/ogre-rtshader.
+      public: std::string ShaderCachePath() const;
+
       /// \brief Get a pointer to the render engine
       /// \return a pointer to the render engine
       public: static OgreRenderEngine *Instance();
@@ -126,6 +134,8 @@ namespace gz
       /// Current accepts the following parameters and values:
       /// "useCurrentGLContext" : "1" or "0". Use current OpenGL context for
       ///                                     rendering
+      /// "shaderCachePath" : <dir>. Directory where generated shaders are
+      ///                            cached between runs
       protected: virtual bool LoadImpl(
           const std::map<std::string, std::string> &_params) override;
 
@@ -29,6 +29,7 @@ namespace gz
     class OgreArrowVisual;
     class OgreAxisVisual;
     class OgreCamera;
+    class OgreCameraArray;
     class OgreCapsule;
     class OgreCOMVisual;
     class OgreDepthCamera;
@@ -82,6 +83,7 @@ namespace gz
     typedef shared_ptr<OgreArrowVisual>          OgreArrowVisualPtr;
     typedef shared_ptr<OgreAxisVisual>           OgreAxisVisualPtr;
     typedef shared_ptr<OgreCamera>               OgreCameraPtr;
+    typedef shared_ptr<OgreCameraArray>          OgreCameraArrayPtr;
     typedef shared_ptr<OgreCapsule>              OgreCapsulePtr;
     typedef shared_ptr<OgreCOMVisual>            OgreCOMVisualPtr;
     typedef shared_ptr<OgreDepthCamera>          OgreDepthCameraPtr;
@@ -18,6 +18,8 @@
 #define GZ_RENDERING_OGRE_OGRESCENE_HH_
 
 #include <array>
+#include <map>
+#include <memory>
 #include <string>
 #include "gz/rendering/base/BaseScene.hh"
 #include "gz/rendering/ogre/Export.hh"
@@ -36,6 +38,9 @@ namespace gz
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
+    // forward declaration
+    class OgreTextBatch;
+
     class GZ_RENDERING_OGRE_VISIBLE OgreScene :
       public BaseScene
     {
@@ -117,6 +122,11 @@ namespace gz
                      const unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual CameraArrayPtr CreateCameraArrayImpl(
+                     const unsigned int _id,
+                     const std::string &_name) override;
+
       protected: virtual GpuRaysPtr CreateGpuRaysImpl(
                      const unsigned int _id,
                      const std::string &_name) override;
@@ -227,6 +237,22 @@ namespace gz
       /// \param[in] _name Name of the template material to remove.
       public: void ClearMaterialsCache(const std::string &_name);
 
+      // Documentation inherited.
+      public: virtual void SetTextBatchingEnabled(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool TextBatchingEnabled() const override;
+
+      /// \internal
+      /// \brief Get the batch that draws the texts with the given font and
+      /// on top setting, creating it if needed
+      /// \param[in] _font Name of the font
+      /// \param[in] _onTop True for texts displayed on top of all other
+      /// objects
+      /// \return The batch, null if text batching is disabled or the font
+      /// does not exist
+      public: OgreTextBatch *TextBatch(const std::string &_font, bool _onTop);
+
       private: void CreateContext();
 
       private: void CreateRootVisual();
@@ -253,6 +279,13 @@ namespace gz
 
       protected: Ogre::SceneManager *ogreSceneManager;
 
+      /// \brief True if texts are batched
+      protected: bool textBatching = false;
+
+      /// \brief Text batches indexed by font name and on top setting
+      protected: std::map<std::string, std::shared_ptr<OgreTextBatch>>
+          textBatches;
+
       private: friend class OgreRenderEngine;
       private: friend class OgreSceneExt;
     };
@@ -84,6 +84,9 @@ namespace gz
       /// \brief Render the camera
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       /// \brief Connect to the new thermal image signal
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
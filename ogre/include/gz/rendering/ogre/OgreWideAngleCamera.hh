@@ -66,6 +66,9 @@ namespace gz
       /// \brief Render the camera
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       // Documentation inherited
       public: virtual void Destroy() override;
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <map>
+#include <vector>
+
+#include "gz/rendering/ogre/OgreCameraArray.hh"
+#include "gz/rendering/ogre/OgreIncludes.hh"
+#include "gz/rendering/ogre/OgreVisual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class gz::rendering::OgreCameraArrayPrivate
+{
+  /// \brief Hide the visible movable objects of a node and its subtree
+  /// that render geometry. Lights keep lighting what the views see and
+  /// cameras keep rendering.
+  /// \param[in] _node Ogre scene node
+  /// \param[out] _hidden Objects that were hidden
+  public: static void Hide(Ogre::SceneNode *_node,
+              std::vector<Ogre::MovableObject *> &_hidden);
+
+  /// \brief Movable objects hidden by the cull pass, by visual id. Only
+  /// the objects that were visible are shown again, so that visuals the
+  /// user hid stay hidden.
+  public: std::map<unsigned int, std::vector<Ogre::MovableObject *>> hidden;
+};
+
+//////////////////////////////////////////////////
+void OgreCameraArrayPrivate::Hide(Ogre::SceneNode *_node,
+    std::vector<Ogre::MovableObject *> &_hidden)
+{
+  for (unsigned int i = 0; i < _node->numAttachedObjects(); ++i)
+  {
+    Ogre::MovableObject *object = _node->getAttachedObject(i);
+    if (dynamic_cast<Ogre::Light *>(object) ||
+        dynamic_cast<Ogre::Camera *>(object))
+    {
+      continue;
+    }
+    if (object->getVisible())
+    {
+      object->setVisible(false);
+      _hidden.push_back(object);
+    }
+  }
+
+  for (unsigned int i = 0; i < _node->numChildren(); ++i)
+  {
+    Hide(static_cast<Ogre::SceneNode *>(_node->getChild(i)), _hidden);
+  }
+}
+
+//////////////////////////////////////////////////
+OgreCameraArray::OgreCameraArray()
+  : dataPtr(new OgreCameraArrayPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+OgreCameraArray::~OgreCameraArray()
+{
+}
+
+//////////////////////////////////////////////////
+void OgreCameraArray::SetVisualCulled(const VisualPtr &_visual,
+    bool _culled)
+{
+  OgreVisualPtr visual = std::dynamic_pointer_cast<OgreVisual>(_visual);
+  if (!visual || !visual->Node())
+    return;
+
+  if (_culled)
+  {
+    OgreCameraArrayPrivate::Hide(visual->Node(),
+        this->dataPtr->hidden[visual->Id()]);
+    return;
+  }
+
+  auto it = this->dataPtr->hidden.find(visual->Id());
+  if (it == this->dataPtr->hidden.end())
+    return;
+  for (Ogre::MovableObject *object : it->second)
+    object->setVisible(true);
+  this->dataPtr->hidden.erase(it);
+}
@@ -45,7 +45,13 @@ const Ogre::PixelFormat OgreConversions::ogrePixelFormats[PF_COUNT] =
       // PF_FLOAT32_RGB
       Ogre::PF_FLOAT32_RGB,
       // PF_L16
-      Ogre::PF_L16
+      Ogre::PF_L16,
+      // PF_R8G8B8A8
+      Ogre::PF_BYTE_RGBA,
+      // PF_FLOAT16_RG
+      Ogre::PF_FLOAT16_GR,
+      // PF_FLOAT16_R
+      Ogre::PF_FLOAT16_R
     };
 
 //////////////////////////////////////////////////
@@ -22,11 +22,16 @@
   #endif
   #include <windows.h>
 #endif
+#include <chrono>
+#include <cstring>
+
 #include <gz/math/Helpers.hh>
 #include "gz/rendering/InstallationDirectories.hh"
 #include "gz/rendering/ogre/OgreDepthCamera.hh"
 #include "gz/rendering/ogre/OgreMaterial.hh"
 
+#include "OgreTextureReadback.hh"
+
 /// \internal
 /// \brief Private data for the OgreDepthCamera class
 class gz::rendering::OgreDepthCameraPrivate
@@ -52,6 +57,13 @@ class gz::rendering::OgreDepthCameraPrivate
   /// \brief Point cloud color data buffer
   public: unsigned char *colorBuffer = nullptr;
 
+  /// \brief Asynchronous readback of the point cloud texture, used when
+  /// the readback buffer count is greater than 1
+  public: OgreTextureReadback pcdReadback;
+
+  /// \brief Asynchronous readback of the color texture
+  public: OgreTextureReadback colorReadback;
+
   /// \brief True to output point cloud xyz and rgb data
   public: bool outputPoints = false;
 
@@ -110,6 +122,9 @@ void OgreDepthCamera::Destroy()
     this->dataPtr->colorBuffer = nullptr;
   }
 
+  this->dataPtr->pcdReadback.Destroy();
+  this->dataPtr->colorReadback.Destroy();
+
   if (this->dataPtr->pcdTexture)
   {
     this->dataPtr->pcdTexture->Destroy();
@@ -257,6 +272,9 @@ void OgreDepthCamera::CreatePointCloudTexture()
 //////////////////////////////////////////////////
 void OgreDepthCamera::DestroyPointCloudTexture()
 {
+  this->dataPtr->pcdReadback.Destroy();
+  this->dataPtr->colorReadback.Destroy();
+
   if (this->dataPtr->pcdTexture)
   {
     dynamic_cast<OgreRenderTexture *>(this->dataPtr->pcdTexture.get())
@@ -424,6 +442,14 @@ void OgreDepthCamera::UpdateRenderTarget(OgreRenderTexturePtr _target,
   }
 }
 
+//////////////////////////////////////////////////
+bool OgreDepthCamera::HasConnections() const
+{
+  return this->dataPtr->newDepthFrame.ConnectionCount() > 0u ||
+      this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u ||
+      BaseDepthCamera::HasConnections();
+}
+
 //////////////////////////////////////////////////
 void OgreDepthCamera::PostRender()
 {
@@ -440,7 +466,6 @@ void OgreDepthCamera::PostRender()
   unsigned int channelCount = PixelUtil::ChannelCount(format);
   if (!this->dataPtr->pcdBuffer)
     this->dataPtr->pcdBuffer = new float[len * channelCount];
-  this->dataPtr->pcdTexture->Buffer(this->dataPtr->pcdBuffer);
 
   // color data
   unsigned int colorChannelCount = 3;
@@ -448,18 +473,67 @@ void OgreDepthCamera::PostRender()
   int bgColorG = static_cast<int>(this->scene->BackgroundColor().G() * 255);
   int bgColorB = static_cast<int>(this->scene->BackgroundColor().B() * 255);
   int bgColorA = static_cast<int>(this->scene->BackgroundColor().A() * 255);
+  PixelFormat colorFormat = PF_UNKNOWN;
   if (this->dataPtr->outputPoints)
   {
-    PixelFormat colorFormat = this->dataPtr->colorTexture->Format();
+    colorFormat = this->dataPtr->colorTexture->Format();
     colorChannelCount = PixelUtil::ChannelCount(colorFormat);
 
     if (!this->dataPtr->colorBuffer)
       this->dataPtr->colorBuffer = new unsigned char[len * colorChannelCount];
+  }
 
-    Ogre::PixelBox ogrePixelBox(width, height, 1,
-        OgreConversions::Convert(colorFormat), this->dataPtr->colorBuffer);
-    this->dataPtr->colorTexture->RenderTarget()->copyContentsToMemory(
-        ogrePixelBox);
+  const Ogre::PixelFormat ogreFormat = OgreConversions::Convert(format);
+  const Ogre::PixelFormat ogreColorFormat =
+      OgreConversions::Convert(colorFormat);
+  if (this->readbackBufferCount > 1u &&
+      OgreTextureReadback::IsSupported(ogreFormat) &&
+      (!this->dataPtr->outputPoints ||
+       OgreTextureReadback::IsSupported(ogreColorFormat)))
+  {
+    // queue the download of the frame that was just rendered and process
+    // the oldest frame in the ring
+    this->dataPtr->pcdTexture->RenderTarget()->swapBuffers();
+    this->dataPtr->pcdReadback.Download(this->dataPtr->pcdTexture->GLId(),
+        width, height, ogreFormat, this->readbackBufferCount,
+        this->scene->Time());
+    if (this->dataPtr->outputPoints)
+    {
+      this->dataPtr->colorReadback.Download(
+          this->dataPtr->colorTexture->GLId(), width, height,
+          ogreColorFormat, this->readbackBufferCount, this->scene->Time());
+    }
+
+    const void *data = nullptr;
+    std::chrono::steady_clock::duration time;
+    if (!this->dataPtr->pcdReadback.Map(data, time))
+      return;
+    memcpy(this->dataPtr->pcdBuffer, data,
+        Ogre::PixelUtil::getMemorySize(width, height, 1u, ogreFormat));
+    this->dataPtr->pcdReadback.Unmap();
+
+    if (this->dataPtr->outputPoints)
+    {
+      std::chrono::steady_clock::duration colorTime;
+      if (!this->dataPtr->colorReadback.Map(data, colorTime))
+        return;
+      memcpy(this->dataPtr->colorBuffer, data,
+          Ogre::PixelUtil::getMemorySize(width, height, 1u, ogreColorFormat));
+      this->dataPtr->colorReadback.Unmap();
+    }
+    this->depthDataTime = time;
+  }
+  else
+  {
+    this->dataPtr->pcdTexture->Buffer(this->dataPtr->pcdBuffer);
+    if (this->dataPtr->outputPoints)
+    {
+      Ogre::PixelBox ogrePixelBox(width, height, 1, ogreColorFormat,
+          this->dataPtr->colorBuffer);
+      this->dataPtr->colorTexture->RenderTarget()->copyContentsToMemory(
+          ogrePixelBox);
+    }
+    this->depthDataTime = this->scene->Time();
   }
 
   // fill depthBuffer and clamp values
@@ -583,6 +657,8 @@ void OgreDepthCamera::PostRender()
 //////////////////////////////////////////////////
 const float *OgreDepthCamera::DepthData() const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   return this->dataPtr->depthBuffer;
 }
 
@@ -15,6 +15,9 @@
  *
 */
 
+#include <chrono>
+#include <cstring>
+
 #include <gz/common/Mesh.hh>
 #include <gz/common/SubMesh.hh>
 
@@ -26,6 +29,8 @@
 #include "gz/rendering/ogre/OgreCamera.hh"
 #include "gz/rendering/ogre/OgreGpuRays.hh"
 
+#include "OgreTextureReadback.hh"
+
 /// \internal
 /// \brief Private data for the OgreGpuRays class
 class gz::rendering::OgreGpuRaysPrivate
@@ -61,6 +66,10 @@ class gz::rendering::OgreGpuRaysPrivate
   /// \brief Second pass texture.
   public: Ogre::Texture *secondPassTexture = nullptr;
 
+  /// \brief Asynchronous readback of the second pass texture, used when
+  /// the readback buffer count is greater than 1
+  public: OgreTextureReadback readback;
+
   /// \brief Temporary pointer to the current render target.
   public: Ogre::Texture *currentTexture = nullptr;
 
@@ -188,6 +197,7 @@ void OgreGpuRays::Destroy()
     }
   }
 
+  this->dataPtr->readback.Destroy();
   if (this->dataPtr->secondPassTexture)
   {
     Ogre::TextureManager::getSingleton().remove(
@@ -667,6 +677,13 @@ void OgreGpuRays::PreRender()
     this->CreateGpuRaysTextures();
 }
 
+//////////////////////////////////////////////////
+bool OgreGpuRays::HasConnections() const
+{
+  return this->dataPtr->newGpuRaysFrame.ConnectionCount() > 0u ||
+      BaseGpuRays::HasConnections();
+}
+
 //////////////////////////////////////////////////
 void OgreGpuRays::PostRender()
 {
@@ -687,23 +704,45 @@ void OgreGpuRays::PostRender()
     width, height, 1, Ogre::PF_FLOAT32_RGB);
   int len = width * height * this->Channels();
 
-  if (!this->dataPtr->gpuRaysBuffer)
+  if (!this->dataPtr->gpuRaysScan)
   {
-    this->dataPtr->gpuRaysBuffer = new float[len];
+    this->dataPtr->gpuRaysScan = new float[len];
   }
 
-  Ogre::PixelBox dstBox(width, height,
-        1, Ogre::PF_FLOAT32_RGB, this->dataPtr->gpuRaysBuffer);
-
-  auto pixelBuffer = this->dataPtr->secondPassTexture->getBuffer();
-  pixelBuffer->blitToMemory(dstBox);
-
-  if (!this->dataPtr->gpuRaysScan)
+  if (this->readbackBufferCount > 1u &&
+      OgreTextureReadback::IsSupported(Ogre::PF_FLOAT32_RGB))
   {
-    this->dataPtr->gpuRaysScan = new float[len];
+    // queue the download of the frame that was just rendered and deliver
+    // the oldest frame in the ring
+    unsigned int texId = 0u;
+    this->dataPtr->secondPassTexture->getCustomAttribute("GLID", &texId);
+    this->dataPtr->readback.Download(texId, width, height,
+        Ogre::PF_FLOAT32_RGB, this->readbackBufferCount, this->scene->Time());
+
+    const void *data = nullptr;
+    std::chrono::steady_clock::duration time;
+    if (!this->dataPtr->readback.Map(data, time))
+      return;
+    memcpy(this->dataPtr->gpuRaysScan, data, size);
+    this->dataPtr->readback.Unmap();
+    this->dataTime = time;
   }
+  else
+  {
+    if (!this->dataPtr->gpuRaysBuffer)
+    {
+      this->dataPtr->gpuRaysBuffer = new float[len];
+    }
+
+    Ogre::PixelBox dstBox(width, height,
+          1, Ogre::PF_FLOAT32_RGB, this->dataPtr->gpuRaysBuffer);
 
-  memcpy(this->dataPtr->gpuRaysScan, this->dataPtr->gpuRaysBuffer, size);
+    auto pixelBuffer = this->dataPtr->secondPassTexture->getBuffer();
+    pixelBuffer->blitToMemory(dstBox);
+
+    memcpy(this->dataPtr->gpuRaysScan, this->dataPtr->gpuRaysBuffer, size);
+    this->dataTime = this->scene->Time();
+  }
 
   this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
       width, height, this->Channels(), "PF_FLOAT32_RGB");
@@ -712,12 +751,16 @@ void OgreGpuRays::PostRender()
 //////////////////////////////////////////////////
 const float* OgreGpuRays::Data() const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   return this->dataPtr->gpuRaysScan;
 }
 
 //////////////////////////////////////////////////
 void OgreGpuRays::Copy(float *_dataDest)
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   auto rt = this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
   const Ogre::Viewport *secondPassViewport = rt->getViewport(0);
   unsigned int width = secondPassViewport->getActualWidth();
@@ -711,6 +711,9 @@ void OgreHeightmap::PreRender()
     return;
   }
 
+  // terrain loading and lod updates are processed every frame
+  this->SetPreRenderDirty();
+
   // Make sure the heightmap finishes loading by processing responses until all
   // derived data and terrains are loaded
   if (this->dataPtr->terrainGroup->isDerivedDataUpdateInProgress())
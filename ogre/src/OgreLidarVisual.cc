@@ -518,5 +518,6 @@ std::vector<double> OgreLidarVisual::Points() const
 void OgreLidarVisual::SetVisible(bool _visible)
 {
   this->dataPtr->visible = _visible;
+  this->visible = _visible;
   this->ogreNode->setVisible(this->dataPtr->visible);
 }
@@ -215,6 +215,7 @@ void OgreMarker::SetMaterial(MaterialPtr _material, bool _unique)
       gzerr << "Invalid Marker type " << this->markerType << "\n";
       break;
   }
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -228,6 +229,7 @@ void OgreMarker::SetPoint(unsigned int _index,
     const math::Vector3d &_value)
 {
   this->dataPtr->dynamicRenderable->SetPoint(_index, _value);
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -235,12 +237,14 @@ void OgreMarker::AddPoint(const math::Vector3d &_pt,
     const math::Color &_color)
 {
   this->dataPtr->dynamicRenderable->AddPoint(_pt, _color);
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
 void OgreMarker::ClearPoints()
 {
   this->dataPtr->dynamicRenderable->Clear();
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -283,6 +287,7 @@ void OgreMarker::SetType(MarkerType _markerType)
       gzerr << "Invalid Marker type\n";
       break;
   }
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -380,6 +380,11 @@ void OgreMaterial::SetShaderType(enum ShaderType _type)
 void OgreMaterial::PreRender()
 {
   this->UpdateShaderParams();
+
+  // shader params are modified through the returned pointers without
+  // notifying the material so check them again on the next frame
+  if (this->vertexShaderParams || this->fragmentShaderParams)
+    this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
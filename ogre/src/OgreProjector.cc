@@ -234,6 +234,10 @@ OgreProjector::~OgreProjector()
 /////////////////////////////////////////////////
 void OgreProjector::PreRender()
 {
+  // cameras that need the projector visibility listener can be added any
+  // time
+  this->SetPreRenderDirty();
+
   if (this->dataPtr->initialized)
   {
     this->UpdateCameraListener();
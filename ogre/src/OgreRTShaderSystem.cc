@@ -20,14 +20,19 @@
   #include <Winsock2.h>
 #endif
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
 
+#include "gz/rendering/config.hh"
 #include "gz/rendering/InstallationDirectories.hh"
 #include "gz/rendering/ogre/OgreRenderEngine.hh"
 #include "gz/rendering/ogre/OgreScene.hh"
@@ -37,6 +42,12 @@
 
 class gz::rendering::OgreRTShaderSystemPrivate
 {
+  /// \brief Get a key that changes whenever the cached shaders could be
+  /// stale, i.e. when gz-rendering, OGRE or the shader libs change
+  /// \param[in] _coreLibsPath Path to the shader libs
+  /// \return Hash of the versions and the contents of the shader libs
+  public: static std::string CacheKey(const std::string &_coreLibsPath);
+
   /// \brief The shader generator.
   public: Ogre::RTShader::ShaderGenerator *shaderGenerator = nullptr;
 
@@ -102,6 +113,32 @@ OgreRTShaderSystem::~OgreRTShaderSystem()
   }
 }
 
+//////////////////////////////////////////////////
+std::string OgreRTShaderSystemPrivate::CacheKey(
+    const std::string &_coreLibsPath)
+{
+  std::stringstream key;
+  key << GZ_RENDERING_VERSION_FULL << "::" << OGRE_VERSION << "::glsl";
+
+  // generated shaders call into the libs, so they only match the libs
+  // they were generated with
+  std::vector<std::filesystem::path> files;
+  std::error_code ec;
+  for (const auto &entry :
+      std::filesystem::directory_iterator(_coreLibsPath, ec))
+  {
+    if (entry.is_regular_file(ec))
+      files.push_back(entry.path());
+  }
+  std::sort(files.begin(), files.end());
+  for (const auto &file : files)
+  {
+    std::ifstream in(file, std::ios::binary);
+    key << "::" << file.filename().string() << "::" << in.rdbuf();
+  }
+  return common::sha1(key.str());
+}
+
 //////////////////////////////////////////////////
 bool OgreRTShaderSystem::Init()
 {
@@ -521,18 +558,27 @@ bool OgreRTShaderSystem::Paths(std::string &coreLibsPath,
     if (common::exists(p))
     {
       coreLibsPath = p;
-      // setup patch name for rt shader cache in tmp
-      const char *homeEnv = std::getenv(GZ_HOMEDIR);
-      std::string tmpDir = (homeEnv) ? std::string(homeEnv) : std::string(".");
-
-      tmpDir = common::joinPaths(tmpDir, ".gz", "rendering",
-          "ogre-rtshader");
-      // Get the user
-      std::string user = "nobody";
-      const char* userEnv = std::getenv("USER");
-      if (userEnv)
-        user = std::string(userEnv);
-      cachePath = common::joinPaths(tmpDir, user + "-rtshaderlibcache");
+      cachePath = OgreRenderEngine::Instance()->ShaderCachePath();
+      if (cachePath.empty())
+      {
+        // setup patch name for rt shader cache in tmp
+        const char *homeEnv = std::getenv(GZ_HOMEDIR);
+        std::string tmpDir =
+            (homeEnv) ? std::string(homeEnv) : std::string(".");
+
+        tmpDir = common::joinPaths(tmpDir, ".gz", "rendering",
+            "ogre-rtshader");
+        // Get the user
+        std::string user = "nobody";
+        const char* userEnv = std::getenv("USER");
+        if (userEnv)
+          user = std::string(userEnv);
+        cachePath = common::joinPaths(tmpDir, user + "-rtshaderlibcache");
+      }
+      // shaders generated by other versions are never read, so the cache
+      // can be kept across runs and upgrades without flushing it
+      cachePath = common::joinPaths(cachePath,
+          OgreRTShaderSystemPrivate::CacheKey(coreLibsPath));
       // Create the directory
       if (!common::createDirectories(cachePath))
       {
@@ -53,6 +53,10 @@ class gz::rendering::OgreRenderEnginePrivate
 
   /// \brief A list of supported fsaa levels
   public: std::vector<unsigned int> fsaaLevels;
+
+  /// \brief Directory where generated shaders are cached, empty to use
+  /// the default one
+  public: std::string shaderCachePath;
 };
 
 using namespace gz;
@@ -282,6 +286,10 @@ bool OgreRenderEngine::LoadImpl(
   if (it != _params.end())
     std::istringstream(it->second) >> this->useCurrentGLContext;
 
+  it = _params.find("shaderCachePath");
+  if (it != _params.end())
+    this->dataPtr->shaderCachePath = it->second;
+
   try
   {
     this->LoadAttempt();
@@ -828,6 +836,12 @@ std::vector<unsigned int> OgreRenderEngine::FSAALevels() const
   return this->dataPtr->fsaaLevels;
 }
 
+//////////////////////////////////////////////////
+std::string OgreRenderEngine::ShaderCachePath() const
+{
+  return this->dataPtr->shaderCachePath;
+}
+
 #if (OGRE_VERSION >= ((1 << 16) | (9 << 8) | 0))
 /////////////////////////////////////////////////
 Ogre::OverlaySystem *OgreRenderEngine::OverlaySystem() const
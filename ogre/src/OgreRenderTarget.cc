@@ -96,14 +96,26 @@ void OgreRenderTarget::Copy(Image &_image) const
         this->width, this->height, 1, imageFormat, data);
     this->RenderTarget()->copyContentsToMemory(ogrePixelBox);
     // convert color image to bayer image
-    _image = gz::rendering::convertRGBToBayer(colorImage, _image.Format());
+    _image.CopyFrom(
+        gz::rendering::convertRGBToBayer(colorImage, _image.Format()));
   }
   else
   {
     imageFormat = OgreConversions::Convert(_image.Format());
+    const unsigned int bpp = PixelUtil::BytesPerPixel(_image.Format());
+    if (_image.RowStride() % bpp != 0u)
+    {
+      // ogre pitches are in pixels, go through a packed image
+      Image packedImage(this->width, this->height, _image.Format());
+      this->Copy(packedImage);
+      _image.CopyFrom(packedImage);
+      return;
+    }
     void *data = _image.Data();
     Ogre::PixelBox ogrePixelBox(
         this->width, this->height, 1, imageFormat, data);
+    ogrePixelBox.rowPitch = _image.RowStride() / bpp;
+    ogrePixelBox.slicePitch = ogrePixelBox.rowPitch * this->height;
     this->RenderTarget()->copyContentsToMemory(ogrePixelBox);
   }
 }
@@ -22,6 +22,7 @@
 #include "gz/rendering/ogre/OgreArrowVisual.hh"
 #include "gz/rendering/ogre/OgreAxisVisual.hh"
 #include "gz/rendering/ogre/OgreCamera.hh"
+#include "gz/rendering/ogre/OgreCameraArray.hh"
 #include "gz/rendering/ogre/OgreCapsule.hh"
 #include "gz/rendering/ogre/OgreCOMVisual.hh"
 #include "gz/rendering/ogre/OgreConversions.hh"
@@ -53,6 +54,8 @@
 #include "gz/rendering/ogre/OgreWideAngleCamera.hh"
 #include "gz/rendering/ogre/OgreWireBox.hh"
 
+#include "OgreTextBatch.hh"
+
 namespace gz
 {
   namespace rendering
@@ -304,6 +307,8 @@ void OgreScene::Clear()
 //////////////////////////////////////////////////
 void OgreScene::Destroy()
 {
+  this->textBatches.clear();
+
   BaseScene::Destroy();
 
   // ogre scene manager is destroyed when ogre root is deleted
@@ -318,6 +323,49 @@ Ogre::SceneManager *OgreScene::OgreSceneManager() const
   return this->ogreSceneManager;
 }
 
+//////////////////////////////////////////////////
+void OgreScene::SetTextBatchingEnabled(bool _enabled)
+{
+  this->textBatching = _enabled;
+
+  // texts that are removed from their batch draw themselves again
+  if (!_enabled)
+    this->textBatches.clear();
+}
+
+//////////////////////////////////////////////////
+bool OgreScene::TextBatchingEnabled() const
+{
+  return this->textBatching;
+}
+
+//////////////////////////////////////////////////
+OgreTextBatch *OgreScene::TextBatch(const std::string &_font, bool _onTop)
+{
+  if (!this->textBatching || !this->ogreSceneManager)
+    return nullptr;
+
+  const std::string key = _font + (_onTop ? "::OnTop" : "");
+  auto it = this->textBatches.find(key);
+  if (it != this->textBatches.end())
+    return it->second.get();
+
+  auto font = static_cast<Ogre::Font *>(Ogre::FontManager::getSingleton()
+      .getByName(_font,
+      Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME).get());
+  if (!font)
+  {
+    gzerr << "Could not find font " << _font << std::endl;
+    return nullptr;
+  }
+
+  auto batch = std::make_shared<OgreTextBatch>(
+      this->Name() + "::TextBatch::" + key, font, _onTop);
+  this->ogreSceneManager->getRootSceneNode()->attachObject(batch.get());
+  this->textBatches[key] = batch;
+  return batch.get();
+}
+
 //////////////////////////////////////////////////
 bool OgreScene::LoadImpl()
 {
@@ -467,6 +515,15 @@ WideAngleCameraPtr OgreScene::CreateWideAngleCameraImpl(const unsigned int _id,
   return (result) ? camera : nullptr;
 }
 
+///////////////////////////////////////////////////
+CameraArrayPtr OgreScene::CreateCameraArrayImpl(const unsigned int _id,
+    const std::string &_name)
+{
+  OgreCameraArrayPtr array(new OgreCameraArray);
+  bool result = this->InitObject(array, _id, _name);
+  return (result) ? array : nullptr;
+}
+
 ///////////////////////////////////////////////////
 GpuRaysPtr OgreScene::CreateGpuRaysImpl(const unsigned int _id,
     const std::string &_name)
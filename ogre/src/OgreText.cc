@@ -20,6 +20,10 @@
   #include <windows.h>
 #endif
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include <gz/common/Util.hh>
 #include <gz/common/Console.hh>
 
@@ -27,6 +31,8 @@
 #include "gz/rendering/ogre/OgreScene.hh"
 #include "gz/rendering/ogre/OgreText.hh"
 
+#include "OgreTextBatch.hh"
+
 #define POS_TEX_BINDING    0
 #define COLOUR_BINDING     1
 
@@ -98,6 +104,12 @@ class gz::rendering::OgreMovableText
   /// \param-in] _font Name of font
   public: void SetFontNameImpl(const std::string &_font);
 
+  /// \brief Set the batch that draws the text. The text does not draw
+  /// itself while it is in a batch.
+  /// \param[in] _batch Batch to add the text to, null to draw the text
+  /// by itself
+  public: void SetBatch(OgreTextBatch *_batch);
+
   /// \internal
   /// \brief Method to allow a caller to abstractly iterate over the
   /// renderable instances.
@@ -144,6 +156,11 @@ class gz::rendering::OgreMovableText
   /// \internal
   private: void _updateRenderQueue(Ogre::RenderQueue *_queue) override;
 
+  /// \brief Get the transform that billboards the text towards a camera
+  /// \param[in] _cam Camera the text faces
+  /// \return Transform from text space to world space
+  private: Ogre::Matrix4 BillboardTransform(const Ogre::Camera *_cam) const;
+
   /// \brief Flag to indicate text properties have changed
   private: bool textDirty = false;
 
@@ -207,6 +224,16 @@ class gz::rendering::OgreMovableText
   /// \brief True for text to be displayed on top of other objects in the
   /// scene.
   private: bool onTop = false;
+
+  /// \brief Glyph vertices (x, y, z, u, v) in text space, kept on the CPU
+  /// so that batches can billboard them
+  private: std::vector<float> vertices;
+
+  /// \brief Batch that draws the text, null if the text draws itself
+  private: OgreTextBatch *batch = nullptr;
+
+  /// \brief The batch reads the glyphs of the text
+  private: friend class OgreTextBatch;
 };
 
 /// \brief Private data for the OgreText class.
@@ -232,6 +259,7 @@ OgreMovableText::OgreMovableText()
 //////////////////////////////////////////////////
 OgreMovableText::~OgreMovableText()
 {
+  this->SetBatch(nullptr);
   delete this->renderOp.vertexData;
   delete this->aabb;
 }
@@ -399,6 +427,19 @@ void OgreMovableText::SetFontNameImpl(const std::string &_newFontName)
   }
 }
 
+//////////////////////////////////////////////////
+void OgreMovableText::SetBatch(OgreTextBatch *_batch)
+{
+  if (this->batch == _batch)
+    return;
+
+  if (this->batch)
+    this->batch->Remove(this);
+  this->batch = _batch;
+  if (this->batch)
+    this->batch->Add(this);
+}
+
 //////////////////////////////////////////////////
 void OgreMovableText::SetupGeometry()
 {
@@ -486,7 +527,8 @@ void OgreMovableText::SetupGeometry()
 
   bind->setBinding(COLOUR_BINDING, cbuf);
 
-  pVert = static_cast<float*>(ptbuf->lock(Ogre::HardwareBuffer::HBL_DISCARD));
+  this->vertices.assign(vertexCount * 5u, 0.0f);
+  pVert = this->vertices.data();
 
   // Derive space width from a capital A
   if (math::equal(this->spaceWidth, 0.0f))
@@ -717,8 +759,14 @@ void OgreMovableText::SetupGeometry()
     }
   }
 
-  // Unlock vertex buffer
-  ptbuf->unlock();
+  // Upload the vertices, spaces and new lines have no glyph
+  this->vertices.resize(this->renderOp.vertexData->vertexCount * 5u);
+  if (!this->vertices.empty())
+  {
+    void *dest = ptbuf->lock(Ogre::HardwareBuffer::HBL_DISCARD);
+    memcpy(dest, this->vertices.data(), this->vertices.size() * sizeof(float));
+    ptbuf->unlock();
+  }
 
   // update AABB/Sphere radius
   this->aabb->setMinimum(min);
@@ -813,25 +861,31 @@ const Ogre::String &OgreMovableText::getMovableType() const
 void OgreMovableText::getWorldTransforms(Ogre::Matrix4 *_xform) const
 {
   if (this->isVisible() && this->camera)
-  {
-    Ogre::Matrix3 rot3x3, scale3x3 = Ogre::Matrix3::IDENTITY;
+    *_xform = this->BillboardTransform(this->camera);
+}
 
-    // store rotation in a matrix
-    this->camera->getDerivedOrientation().ToRotationMatrix(rot3x3);
+//////////////////////////////////////////////////
+Ogre::Matrix4 OgreMovableText::BillboardTransform(
+    const Ogre::Camera *_cam) const
+{
+  Ogre::Matrix3 rot3x3, scale3x3 = Ogre::Matrix3::IDENTITY;
 
-    // parent node position
-    Ogre::Vector3 ppos = mParentNode->_getDerivedPosition() +
-                         Ogre::Vector3::UNIT_Z * this->baseline;
+  // store rotation in a matrix
+  _cam->getDerivedOrientation().ToRotationMatrix(rot3x3);
 
-    // apply scale
-    scale3x3[0][0] = mParentNode->_getDerivedScale().x / 2;
-    scale3x3[1][1] = mParentNode->_getDerivedScale().y / 2;
-    scale3x3[2][2] = mParentNode->_getDerivedScale().z / 2;
+  // parent node position
+  Ogre::Vector3 ppos = mParentNode->_getDerivedPosition() +
+                       Ogre::Vector3::UNIT_Z * this->baseline;
 
-    // apply all transforms to xform
-    *_xform = (rot3x3 * scale3x3);
-    _xform->setTrans(ppos);
-  }
+  // apply scale
+  scale3x3[0][0] = mParentNode->_getDerivedScale().x / 2;
+  scale3x3[1][1] = mParentNode->_getDerivedScale().y / 2;
+  scale3x3[2][2] = mParentNode->_getDerivedScale().z / 2;
+
+  // apply all transforms to xform
+  Ogre::Matrix4 xform(rot3x3 * scale3x3);
+  xform.setTrans(ppos);
+  return xform;
 }
 
 //////////////////////////////////////////////////
@@ -882,7 +936,8 @@ void OgreMovableText::_notifyCurrentCamera(Ogre::Camera *_cam)
 //////////////////////////////////////////////////
 void OgreMovableText::_updateRenderQueue(Ogre::RenderQueue* _queue)
 {
-  if (this->isVisible())
+  // batched texts are drawn by their batch
+  if (this->isVisible() && !this->batch)
   {
     this->Update();
 
@@ -898,6 +953,226 @@ void OgreMovableText::visitRenderables(Ogre::Renderable::Visitor * /*_visitor*/,
   return;
 }
 
+//////////////////////////////////////////////////
+OgreTextBatch::OgreTextBatch(const std::string &_name, Ogre::Font *_font,
+    bool _onTop)
+  : Ogre::MovableObject(_name)
+{
+  this->aabb.setInfinite();
+  this->setCastShadows(false);
+
+  _font->load();
+  this->ogreMaterial = _font->getMaterial()->clone(_name + "Material");
+  if (!this->ogreMaterial->isLoaded())
+    this->ogreMaterial->load();
+
+  this->ogreMaterial->setDepthCheckEnabled(!_onTop);
+  this->ogreMaterial->setDepthBias(!_onTop, 0);
+  this->ogreMaterial->setDepthWriteEnabled(_onTop);
+  this->ogreMaterial->setLightingEnabled(false);
+
+  // positions, texture coordinates and colors are interleaved in a
+  // single buffer
+  this->vertexData = new Ogre::VertexData();
+  Ogre::VertexDeclaration *decl = this->vertexData->vertexDeclaration;
+  size_t offset = 0;
+  decl->addElement(0, offset, Ogre::VET_FLOAT3, Ogre::VES_POSITION);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
+  decl->addElement(0, offset, Ogre::VET_FLOAT2,
+                   Ogre::VES_TEXTURE_COORDINATES, 0);
+  offset += Ogre::VertexElement::getTypeSize(Ogre::VET_FLOAT2);
+  decl->addElement(0, offset, Ogre::VET_COLOUR, Ogre::VES_DIFFUSE);
+  this->vertexData->vertexStart = 0;
+  this->vertexData->vertexCount = 0;
+}
+
+//////////////////////////////////////////////////
+OgreTextBatch::~OgreTextBatch()
+{
+  for (auto *text : this->texts)
+    text->batch = nullptr;
+
+  if (this->getParentSceneNode())
+    this->getParentSceneNode()->detachObject(this);
+
+  Ogre::MaterialManager::getSingleton().remove(this->ogreMaterial->getName());
+  delete this->vertexData;
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::Add(OgreMovableText *_text)
+{
+  this->texts.push_back(_text);
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::Remove(OgreMovableText *_text)
+{
+  this->texts.erase(std::remove(this->texts.begin(), this->texts.end(),
+      _text), this->texts.end());
+}
+
+//////////////////////////////////////////////////
+unsigned int OgreTextBatch::TextCount() const
+{
+  return static_cast<unsigned int>(this->texts.size());
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::Rebuild(const Ogre::Camera *_cam)
+{
+  this->vertexData->vertexCount = 0;
+
+  size_t vertexCount = 0u;
+  for (auto *text : this->texts)
+  {
+    text->Update();
+    vertexCount += text->vertices.size() / 5u;
+  }
+  if (vertexCount == 0u)
+    return;
+
+  Ogre::VertexBufferBinding *bind = this->vertexData->vertexBufferBinding;
+  if (vertexCount > this->capacity)
+  {
+    // grow geometrically so that adding texts does not reallocate often
+    this->capacity = std::max(vertexCount, this->capacity * 2u);
+    Ogre::HardwareVertexBufferSharedPtr vbuf =
+        Ogre::HardwareBufferManager::getSingleton().createVertexBuffer(
+        this->vertexData->vertexDeclaration->getVertexSize(0),
+        this->capacity,
+        Ogre::HardwareBuffer::HBU_DYNAMIC_WRITE_ONLY_DISCARDABLE);
+    bind->setBinding(0, vbuf);
+  }
+
+  Ogre::HardwareVertexBufferSharedPtr vbuf = bind->getBuffer(0);
+  float *pVert = static_cast<float *>(
+      vbuf->lock(Ogre::HardwareBuffer::HBL_DISCARD));
+
+  size_t count = 0u;
+  for (auto *text : this->texts)
+  {
+    if (text->vertices.empty() || !text->isVisible() ||
+        !text->getParentNode())
+    {
+      continue;
+    }
+
+    Ogre::Matrix4 xform = text->BillboardTransform(_cam);
+
+    // skip texts outside of the view, the billboard halves the node scale
+    const Ogre::Vector3 &scale = text->getParentNode()->_getDerivedScale();
+    Ogre::Sphere sphere(xform.getTrans(),
+        text->radius * std::max({scale.x, scale.y, scale.z}) / 2);
+    if (!_cam->isVisible(sphere))
+      continue;
+
+    Ogre::RGBA clr;
+    Ogre::ColourValue cv(text->color.R(), text->color.G(),
+                         text->color.B(), text->color.A());
+    Ogre::Root::getSingleton().convertColourValue(cv, &clr);
+
+    for (size_t i = 0u; i + 4u < text->vertices.size(); i += 5u)
+    {
+      Ogre::Vector3 pos = xform * Ogre::Vector3(text->vertices[i],
+          text->vertices[i + 1u], text->vertices[i + 2u]);
+      *pVert++ = pos.x;
+      *pVert++ = pos.y;
+      *pVert++ = pos.z;
+      *pVert++ = text->vertices[i + 3u];
+      *pVert++ = text->vertices[i + 4u];
+      Ogre::RGBA *pColor = reinterpret_cast<Ogre::RGBA *>(pVert);
+      *pColor++ = clr;
+      pVert = reinterpret_cast<float *>(pColor);
+    }
+    count += text->vertices.size() / 5u;
+  }
+
+  vbuf->unlock();
+  this->vertexData->vertexCount = count;
+}
+
+//////////////////////////////////////////////////
+const Ogre::AxisAlignedBox &OgreTextBatch::getBoundingBox() const
+{
+  return this->aabb;
+}
+
+//////////////////////////////////////////////////
+const Ogre::String &OgreTextBatch::getMovableType() const
+{
+  static Ogre::String movType = "OgreTextBatch";
+  return movType;
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::getWorldTransforms(Ogre::Matrix4 *_xform) const
+{
+  // vertices are in world space
+  *_xform = Ogre::Matrix4::IDENTITY;
+}
+
+//////////////////////////////////////////////////
+float OgreTextBatch::getBoundingRadius() const
+{
+  return 0;
+}
+
+//////////////////////////////////////////////////
+float OgreTextBatch::getSquaredViewDepth(const Ogre::Camera * /*_cam*/) const
+{
+  return 0;
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::getRenderOperation(Ogre::RenderOperation &_op)
+{
+  _op.operationType = Ogre::RenderOperation::OT_TRIANGLE_LIST;
+  _op.useIndexes = false;
+  _op.indexData = nullptr;
+  _op.vertexData = this->vertexData;
+}
+
+//////////////////////////////////////////////////
+const Ogre::MaterialPtr &OgreTextBatch::getMaterial() const
+{
+  return this->ogreMaterial;
+}
+
+//////////////////////////////////////////////////
+const Ogre::LightList &OgreTextBatch::getLights() const
+{
+  return this->lightList;
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::_notifyCurrentCamera(Ogre::Camera *_cam)
+{
+  Ogre::MovableObject::_notifyCurrentCamera(_cam);
+  this->camera = _cam;
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::_updateRenderQueue(Ogre::RenderQueue *_queue)
+{
+  if (!this->camera)
+    return;
+
+  this->Rebuild(this->camera);
+  if (this->vertexData->vertexCount > 0u)
+  {
+    _queue->addRenderable(this, mRenderQueueID,
+                          OGRE_RENDERABLE_DEFAULT_PRIORITY);
+  }
+}
+
+//////////////////////////////////////////////////
+void OgreTextBatch::visitRenderables(Ogre::Renderable::Visitor * /*_visitor*/,
+                                     bool /*_debug*/)
+{
+  return;
+}
+
 //////////////////////////////////////////////////
 OgreText::OgreText()
     : dataPtr(new OgreTextPrivate)
@@ -926,6 +1201,11 @@ void OgreText::Init()
 //////////////////////////////////////////////////
 void OgreText::PreRender()
 {
+  OgreTextBatch *batch = nullptr;
+  if (this->scene->TextBatchingEnabled())
+    batch = this->scene->TextBatch(this->fontName, this->onTop);
+  this->dataPtr->ogreObj->SetBatch(batch);
+
   this->dataPtr->ogreObj->Update();
 }
 
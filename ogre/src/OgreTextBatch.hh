@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE_OGRETEXTBATCH_HH_
+#define GZ_RENDERING_OGRE_OGRETEXTBATCH_HH_
+
+#include <string>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre/Export.hh"
+#include "gz/rendering/ogre/OgreIncludes.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+//
+// forward declaration
+class OgreMovableText;
+
+/// \brief Draws the texts of a scene that use the same font and the same
+/// on top setting with a single draw call.
+///
+/// The glyphs of the texts all come from the texture atlas of the font, so
+/// the batch only needs one material. Every time a camera renders, the
+/// batch billboards the glyph quads of the visible texts towards the
+/// camera and streams them into one dynamic vertex buffer. The texts that
+/// are added to a batch stop drawing themselves.
+class GZ_RENDERING_OGRE_HIDDEN OgreTextBatch
+  : public Ogre::MovableObject, public Ogre::Renderable
+{
+  /// \brief Constructor
+  /// \param[in] _name Unique name of the batch
+  /// \param[in] _font Ogre font of the texts
+  /// \param[in] _onTop True if the texts are displayed on top of all other
+  /// objects
+  public: OgreTextBatch(const std::string &_name, Ogre::Font *_font,
+              bool _onTop);
+
+  /// \brief Destructor. The texts of the batch draw themselves again.
+  public: virtual ~OgreTextBatch();
+
+  /// \brief Add a text to the batch
+  /// \param[in] _text Text to add
+  public: void Add(OgreMovableText *_text);
+
+  /// \brief Remove a text from the batch
+  /// \param[in] _text Text to remove
+  public: void Remove(OgreMovableText *_text);
+
+  /// \brief Get the number of texts in the batch
+  /// \return Number of texts
+  public: unsigned int TextCount() const;
+
+  /// \internal
+  /// \brief Method to allow a caller to abstractly iterate over the
+  /// renderable instances.
+  /// \param[in] _visitor Renderable instances to visit
+  /// \param[in] _debug True if set to debug
+  public: virtual void visitRenderables(Ogre::Renderable::Visitor *_visitor,
+      bool _debug = false) override;
+
+  /// \internal
+  /// \brief Get the world transform (from Renderable)
+  protected: void getWorldTransforms(Ogre::Matrix4 *_xform) const override;
+
+  /// \internal
+  /// \brief Get the bounding radius (from MovableObject)
+  protected: float getBoundingRadius() const override;
+
+  /// \internal
+  /// \brief Get the squared view depth (from Renderable)
+  protected: float getSquaredViewDepth(const Ogre::Camera *_cam) const
+      override;
+
+  /// \internal
+  /// \brief Get the render operation
+  protected: void getRenderOperation(Ogre::RenderOperation &_op) override;
+
+  /// \internal
+  /// \brief Get the material
+  protected: const Ogre::MaterialPtr &getMaterial() const override;
+
+  /// \internal
+  /// \brief Get the lights
+  protected: const Ogre::LightList &getLights() const override;
+
+  /// \internal
+  private: const Ogre::AxisAlignedBox &getBoundingBox() const override;
+
+  /// \internal
+  private: const Ogre::String &getMovableType() const override;
+
+  /// \internal
+  private: void _notifyCurrentCamera(Ogre::Camera *_cam) override;
+
+  /// \internal
+  private: void _updateRenderQueue(Ogre::RenderQueue *_queue) override;
+
+  /// \brief Fill the vertex buffer with the glyphs of the texts that the
+  /// camera sees
+  /// \param[in] _cam Camera the glyphs face
+  private: void Rebuild(const Ogre::Camera *_cam);
+
+  /// \brief Texts of the batch
+  private: std::vector<OgreMovableText *> texts;
+
+  /// \brief Camera the vertex buffer was last filled for
+  private: Ogre::Camera *camera = nullptr;
+
+  /// \brief Material shared by all texts of the batch
+  private: Ogre::MaterialPtr ogreMaterial;
+
+  /// \brief Vertex data of all glyphs
+  private: Ogre::VertexData *vertexData = nullptr;
+
+  /// \brief Number of vertices the vertex buffer can hold
+  private: size_t capacity = 0u;
+
+  /// \brief Infinite bounding box so that the batch is never culled, the
+  /// texts are culled individually in Rebuild
+  private: Ogre::AxisAlignedBox aabb;
+
+  /// \brief Keep an empty list of lights.
+  private: Ogre::LightList lightList;
+};
+}
+}
+}
+#endif
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef __APPLE__
+  #define GL_SILENCE_DEPRECATION
+  #include <OpenGL/gl.h>
+  #include <OpenGL/glext.h>
+#else
+#ifndef _WIN32
+  #define GL_GLEXT_PROTOTYPES
+  #include <GL/gl.h>
+  #include <GL/glext.h>
+#endif
+#endif
+
+#include <cstdio>
+
+#include "OgreTextureReadback.hh"
+
+using namespace gz;
+using namespace rendering;
+
+#ifndef _WIN32
+//////////////////////////////////////////////////
+/// \brief Get the OpenGL format and type of a pixel format
+/// \param[in] _format Ogre pixel format
+/// \param[out] _glFormat OpenGL format
+/// \param[out] _glType OpenGL type
+/// \return False if the pixel format can not be read back
+static bool GLPixelFormat(Ogre::PixelFormat _format, GLenum &_glFormat,
+    GLenum &_glType)
+{
+  switch (_format)
+  {
+    case Ogre::PF_FLOAT32_R:
+      _glFormat = GL_RED;
+      _glType = GL_FLOAT;
+      return true;
+    case Ogre::PF_FLOAT32_RGB:
+      _glFormat = GL_RGB;
+      _glType = GL_FLOAT;
+      return true;
+    case Ogre::PF_FLOAT32_RGBA:
+      _glFormat = GL_RGBA;
+      _glType = GL_FLOAT;
+      return true;
+    case Ogre::PF_BYTE_RGB:
+      _glFormat = GL_RGB;
+      _glType = GL_UNSIGNED_BYTE;
+      return true;
+    case Ogre::PF_BYTE_BGR:
+      _glFormat = GL_BGR;
+      _glType = GL_UNSIGNED_BYTE;
+      return true;
+    case Ogre::PF_BYTE_RGBA:
+      _glFormat = GL_RGBA;
+      _glType = GL_UNSIGNED_BYTE;
+      return true;
+    case Ogre::PF_BYTE_BGRA:
+      _glFormat = GL_BGRA;
+      _glType = GL_UNSIGNED_BYTE;
+      return true;
+    default:
+      return false;
+  }
+}
+#endif
+
+//////////////////////////////////////////////////
+OgreTextureReadback::~OgreTextureReadback()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+bool OgreTextureReadback::IsSupported(Ogre::PixelFormat _format)
+{
+#ifndef _WIN32
+  GLenum glFormat;
+  GLenum glType;
+  if (!GLPixelFormat(_format, glFormat, glType))
+    return false;
+
+  // pixel buffer objects are core since OpenGL 2.1
+  const char *version =
+      reinterpret_cast<const char *>(glGetString(GL_VERSION));
+  int major = 0;
+  int minor = 0;
+  if (!version || sscanf(version, "%d.%d", &major, &minor) != 2)
+    return false;
+  return major > 2 || (major == 2 && minor >= 1);
+#else
+  (void)_format;
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool OgreTextureReadback::Download(unsigned int _glId, unsigned int _width,
+    unsigned int _height, Ogre::PixelFormat _format, unsigned int _count,
+    std::chrono::steady_clock::duration _time)
+{
+#ifndef _WIN32
+  GLenum glFormat;
+  GLenum glType;
+  if (_glId == 0u || _count < 2u || !GLPixelFormat(_format, glFormat, glType))
+    return false;
+
+  this->Unmap();
+  if (this->buffers.size() != _count || this->width != _width ||
+      this->height != _height || this->format != _format)
+  {
+    this->Destroy();
+    this->size = Ogre::PixelUtil::getMemorySize(_width, _height, 1u, _format);
+    this->width = _width;
+    this->height = _height;
+    this->format = _format;
+    this->buffers.resize(_count);
+    this->times.resize(_count);
+    glGenBuffers(static_cast<GLsizei>(_count), this->buffers.data());
+    for (unsigned int buffer : this->buffers)
+    {
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+      glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(this->size),
+          nullptr, GL_STREAM_READ);
+    }
+  }
+
+  // rows are packed, the copy into the bound buffer returns immediately
+  GLint packAlignment = 4;
+  glGetIntegerv(GL_PACK_ALIGNMENT, &packAlignment);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, this->buffers[this->next]);
+  glBindTexture(GL_TEXTURE_2D, _glId);
+  glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, nullptr);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  glPixelStorei(GL_PACK_ALIGNMENT, packAlignment);
+
+  this->times[this->next] = _time;
+  this->next = (this->next + 1u) % this->buffers.size();
+  ++this->queued;
+  return true;
+#else
+  (void)_glId;
+  (void)_width;
+  (void)_height;
+  (void)_format;
+  (void)_count;
+  (void)_time;
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+bool OgreTextureReadback::Map(const void *&_data,
+    std::chrono::steady_clock::duration &_time)
+{
+#ifndef _WIN32
+  if (this->buffers.empty() || this->queued < this->buffers.size())
+    return false;
+
+  this->Unmap();
+
+  // the buffer that is downloaded into next holds the oldest frame
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, this->buffers[this->next]);
+  _data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  if (!_data)
+    return false;
+
+  this->mapped = static_cast<int>(this->next);
+  _time = this->times[this->next];
+  return true;
+#else
+  (void)_data;
+  (void)_time;
+  return false;
+#endif
+}
+
+//////////////////////////////////////////////////
+void OgreTextureReadback::Unmap()
+{
+#ifndef _WIN32
+  if (this->mapped < 0)
+    return;
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, this->buffers[this->mapped]);
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  this->mapped = -1;
+#endif
+}
+
+//////////////////////////////////////////////////
+void OgreTextureReadback::Destroy()
+{
+#ifndef _WIN32
+  this->Unmap();
+  if (!this->buffers.empty())
+  {
+    glDeleteBuffers(static_cast<GLsizei>(this->buffers.size()),
+        this->buffers.data());
+  }
+#endif
+  this->buffers.clear();
+  this->times.clear();
+  this->next = 0u;
+  this->queued = 0u;
+  this->size = 0u;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE_OGRETEXTUREREADBACK_HH_
+#define GZ_RENDERING_OGRE_OGRETEXTUREREADBACK_HH_
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre/Export.hh"
+#include "gz/rendering/ogre/OgreIncludes.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+//
+/// \brief Reads textures back from the GPU asynchronously through a ring of
+/// OpenGL pixel buffer objects.
+///
+/// Every frame, Download queues the copy of a texture into the next pixel
+/// buffer of the ring without waiting for the GPU. Map then maps the oldest
+/// buffer, which was queued count - 1 frames ago and is normally complete,
+/// so the CPU no longer stalls on the frame that was just rendered. All the
+/// functions must be called from the render thread.
+class GZ_RENDERING_OGRE_HIDDEN OgreTextureReadback
+{
+  /// \brief Destructor. Destroys the pixel buffers.
+  public: ~OgreTextureReadback();
+
+  /// \brief Check if asynchronous readback is available with the current
+  /// OpenGL context and a pixel format
+  /// \param[in] _format Pixel format the texture is read back as
+  /// \return True if Download can be used
+  public: static bool IsSupported(Ogre::PixelFormat _format);
+
+  /// \brief Queue the download of the first mip of a 2D texture into the
+  /// next pixel buffer of the ring. The ring is recreated if the count, the
+  /// size or the format changed.
+  /// \param[in] _glId OpenGL id of the texture
+  /// \param[in] _width Width of the texture
+  /// \param[in] _height Height of the texture
+  /// \param[in] _format Pixel format to read the texture back as
+  /// \param[in] _count Number of pixel buffers in the ring, at least 2
+  /// \param[in] _time Scene time of the frame
+  /// \return False if the download could not be queued. Fall back to a
+  /// synchronous readback in that case.
+  public: bool Download(unsigned int _glId, unsigned int _width,
+              unsigned int _height, Ogre::PixelFormat _format,
+              unsigned int _count,
+              std::chrono::steady_clock::duration _time);
+
+  /// \brief Map the oldest download once count downloads were queued
+  /// \param[out] _data Packed pixels of the frame, valid until Unmap
+  /// \param[out] _time Scene time the frame was downloaded at
+  /// \return False while the ring is still filling up
+  public: bool Map(const void *&_data,
+              std::chrono::steady_clock::duration &_time);
+
+  /// \brief Unmap the buffer mapped by Map
+  public: void Unmap();
+
+  /// \brief Destroy the pixel buffers, e.g. when the texture is destroyed
+  public: void Destroy();
+
+  /// \brief OpenGL pixel buffer objects of the ring
+  private: std::vector<unsigned int> buffers;
+
+  /// \brief Scene time of the frame in each pixel buffer
+  private: std::vector<std::chrono::steady_clock::duration> times;
+
+  /// \brief Index of the next pixel buffer to download into
+  private: size_t next = 0u;
+
+  /// \brief Number of downloads queued since the ring was created
+  private: size_t queued = 0u;
+
+  /// \brief Pixel buffer currently mapped, -1 if none
+  private: int mapped = -1;
+
+  /// \brief Size of a pixel buffer in bytes
+  private: size_t size = 0u;
+
+  /// \brief Width of the downloaded texture
+  private: unsigned int width = 0u;
+
+  /// \brief Height of the downloaded texture
+  private: unsigned int height = 0u;
+
+  /// \brief Pixel format of the downloads
+  private: Ogre::PixelFormat format = Ogre::PF_UNKNOWN;
+};
+}
+}
+}
+#endif
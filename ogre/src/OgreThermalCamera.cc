@@ -543,6 +543,13 @@ void OgreThermalCamera::Render()
   rt->update(false);
 }
 
+//////////////////////////////////////////////////
+bool OgreThermalCamera::HasConnections() const
+{
+  return this->dataPtr->newThermalFrame.ConnectionCount() > 0u ||
+      BaseThermalCamera::HasConnections();
+}
+
 //////////////////////////////////////////////////
 void OgreThermalCamera::PostRender()
 {
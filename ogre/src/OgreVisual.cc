@@ -54,6 +54,7 @@ void OgreVisual::SetWireframe(bool _show)
   if (!this->ogreNode)
     return;
 
+  this->MarkSceneChanged();
   this->dataPtr->wireframe = _show;
   for (unsigned int i = 0; i < this->ogreNode->numAttachedObjects();
       i++)
@@ -103,6 +104,9 @@ bool OgreVisual::Wireframe() const
 //////////////////////////////////////////////////
 void OgreVisual::SetVisible(bool _visible)
 {
+  if (this->visible != _visible)
+    this->MarkSceneChanged();
+  this->visible = _visible;
   if (!this->ogreNode)
     return;
 
@@ -579,6 +579,8 @@ void OgreWideAngleCamera::Render()
 //////////////////////////////////////////////////
 void OgreWideAngleCamera::Copy(Image &_image) const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   const unsigned int width = this->ImageWidth();
   const unsigned int height = this->ImageHeight();
 
@@ -588,9 +590,21 @@ void OgreWideAngleCamera::Copy(Image &_image) const
     return;
   }
 
+  const unsigned int bpp = PixelUtil::BytesPerPixel(_image.Format());
+  if (_image.RowStride() % bpp != 0u)
+  {
+    // ogre pitches are in pixels, go through a packed image
+    Image packedImage(width, height, _image.Format());
+    this->Copy(packedImage);
+    _image.CopyFrom(packedImage);
+    return;
+  }
+
   void *data = _image.Data();
   Ogre::PixelFormat imageFormat = OgreConversions::Convert(_image.Format());
   Ogre::PixelBox ogrePixelBox(width, height, 1, imageFormat, data);
+  ogrePixelBox.rowPitch = _image.RowStride() / bpp;
+  ogrePixelBox.slicePitch = ogrePixelBox.rowPitch * height;
 
   Ogre::RenderTarget *rt =
     this->dataPtr->ogreRenderTexture->getBuffer()->getRenderTarget();
@@ -776,6 +790,13 @@ std::vector<Ogre::Camera *> OgreWideAngleCamera::OgreEnvCameras() const
     std::begin(this->dataPtr->envCameras), std::end(this->dataPtr->envCameras));
 }
 
+//////////////////////////////////////////////////
+bool OgreWideAngleCamera::HasConnections() const
+{
+  return this->dataPtr->newImageFrame.ConnectionCount() > 0u ||
+      BaseWideAngleCamera::HasConnections();
+}
+
 //////////////////////////////////////////////////
 void OgreWideAngleCamera::PostRender()
 {
@@ -67,6 +67,12 @@ namespace gz
       // Documentation inherited
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       // Documentation inherited
       public: virtual const std::vector<BoundingBox> &BoundingBoxData() const
               override;
@@ -76,6 +82,11 @@ namespace gz
         ConnectNewBoundingBoxes(
           std::function<void(const std::vector<BoundingBox> &)>) override;
 
+      // Documentation inherited
+      public: virtual gz::common::ConnectionPtr ConnectNewSegmentationFrame(
+          std::function<void(const uint8_t *, unsigned int, unsigned int,
+          unsigned int, const std::string &)> _subscriber) override;
+
       // Documentation inherited
       public: virtual void SetBoundingBoxType(BoundingBoxType _type) override;
 
@@ -17,7 +17,10 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2CAMERA_HH_
 #define GZ_RENDERING_OGRE2_OGRE2CAMERA_HH_
 
+#include <chrono>
+#include <future>
 #include <memory>
+#include <vector>
 
 #include "gz/rendering/base/BaseCamera.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
@@ -28,6 +31,7 @@
 namespace Ogre
 {
   class Camera;
+  class Item;
 }
 
 namespace gz
@@ -69,12 +73,19 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetAntiAliasing(const unsigned int _aa) override;
 
+      // Documentation inherited.
+      public: virtual void SetAntiAliasingMode(
+                  CameraAntiAliasingMode _mode) override;
+
       // Documentation inherited.
       public: virtual void SetFarClipPlane(const double _far) override;
 
       // Documentation inherited.
       public: virtual void SetNearClipPlane(const double _near) override;
 
+      // Documentation inherited.
+      public: virtual void SetLodBias(double _bias) override;
+
       public: virtual math::Color BackgroundColor() const;
 
       public: virtual void SetBackgroundColor(const math::Color &_color);
@@ -87,9 +98,41 @@ namespace gz
       /// \param[in] _material Material to set the background to
       public: virtual void SetBackgroundMaterial(MaterialPtr _material);
 
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
       // Documentation inherited.
       public: virtual void Render() override;
 
+      // Documentation inherited.
+      public: virtual void PostRender() override;
+
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
+      // Documentation inherited.
+      public: virtual std::future<bool> CaptureAsync(Image &_image) override;
+
+      // Documentation inherited.
+      public: virtual void SetDynamicResolution(
+                  std::chrono::steady_clock::duration _targetFrameTime,
+                  double _minScale = 0.5) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  DynamicResolutionTarget() const override;
+
+      // Documentation inherited.
+      public: virtual double DynamicResolutionScale() const override;
+
+      // Documentation inherited.
+      public: virtual void SetResizeDelay(
+                  std::chrono::steady_clock::duration _delay) override;
+
+      // Documentation inherited.
+      public: virtual std::chrono::steady_clock::duration
+                  ResizeDelay() const override;
+
       // Documentation inherited.
       public: virtual RenderWindowPtr CreateRenderWindow() override;
 
@@ -111,6 +154,16 @@ namespace gz
       public: virtual VisualPtr VisualAt(const gz::math::Vector2i
                   &_mousePos) override;
 
+      // Documentation inherited
+      public: virtual std::vector<VisualPtr> VisualsInRegion(
+                  const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) override;
+
+      // Documentation inherited
+      public: virtual std::future<std::vector<VisualPtr>>
+                  VisualsInRegionAsync(const gz::math::Vector2i &_min,
+                  const gz::math::Vector2i &_max) override;
+
       // Documentation Inherited.
       // \sa Camera::SetMaterial(const MaterialPtr &)
       public: virtual void SetMaterial(
@@ -135,6 +188,10 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetVisibilityMask(uint32_t _mask) override;
 
+      // Documentation inherited.
+      public: virtual void SetQualityProfile(
+                  const SensorQualityProfile &_profile) override;
+
       /// \brief Get the selection buffer object
       /// \return the selection buffer object
       public: Ogre2SelectionBuffer *SelectionBuffer() const;
@@ -159,6 +216,25 @@ namespace gz
       /// TODO(anyone) to be implemented
       protected: virtual void SetSelectionBuffer();
 
+      /// \brief Prepare the selection buffer for a region query
+      /// \param[in] _min Top left corner of the region in screen pixels
+      /// \param[in] _max Bottom right corner of the region in screen
+      /// pixels, exclusive
+      /// \param[out] _x Left edge of the region in image pixels
+      /// \param[out] _y Top edge of the region in image pixels
+      /// \param[out] _width Width of the region in image pixels
+      /// \param[out] _height Height of the region in image pixels
+      /// \return False if the region is empty after clipping to the image
+      private: bool SelectionRegion(const math::Vector2i &_min,
+                  const math::Vector2i &_max, int &_x, int &_y,
+                  unsigned int &_width, unsigned int &_height);
+
+      /// \brief Get the visuals that own a list of ogre items
+      /// \param[in] _items Ogre items
+      /// \return Visuals of the items, without duplicates
+      private: std::vector<VisualPtr> VisualsFromItems(
+                  const std::vector<Ogre::Item *> &_items) const;
+
       /// \brief Synchronizes every setting that depends on AspectRatio
       /// with Ogre's camera
       protected: void SyncOgreCameraAspectRatio();
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2CAMERAARRAY_HH_
+#define GZ_RENDERING_OGRE2_OGRE2CAMERAARRAY_HH_
+
+#include <memory>
+
+#include "gz/rendering/base/BaseCameraArray.hh"
+#include "gz/rendering/ogre2/Ogre2Sensor.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2CameraArrayPrivate;
+
+    /// \brief Ogre 2.x implementation of a camera array. Culled visuals are
+    /// hidden by turning off their Ogre movable objects.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2CameraArray :
+      public BaseCameraArray<Ogre2Sensor>
+    {
+      /// \brief Constructor
+      protected: Ogre2CameraArray();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2CameraArray();
+
+      // Documentation inherited.
+      protected: virtual void SetVisualCulled(const VisualPtr &_visual,
+                     bool _culled) override;
+
+      /// \brief Private data class
+      private: std::unique_ptr<Ogre2CameraArrayPrivate> dataPtr;
+
+      /// \brief Only the scene can create a camera array
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
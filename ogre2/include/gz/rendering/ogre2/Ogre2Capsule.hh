@@ -69,6 +69,10 @@ namespace gz
         /// \brief Update the capsule geometry in ogre
         private: void Update();
 
+        /// \brief Stop using the mesh of the current capsule size. The mesh
+        /// is unloaded when no other capsule uses it.
+        private: void ReleaseMesh();
+
         /// \brief Capsule should only be created by scene.
         private: friend class Ogre2Scene;
 
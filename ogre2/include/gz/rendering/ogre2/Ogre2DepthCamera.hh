@@ -79,16 +79,32 @@ namespace gz
       /// already and the depth texture have already been created
       private: void CreateWorkspaceInstance();
 
+      /// \brief Create the render targets that hold the packed range data
+      private: void CreateDepthTargets();
+
       // Documentation inherited
       public: virtual void PreRender() override;
 
       /// \brief Render the camera
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
+      // Documentation inherited.
+      public: virtual bool ReleaseRenderTextures() override;
+
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
       /// \brief All things needed to get back z buffer for depth data
       /// \return The z-buffer as a float array
       public: virtual const float *DepthData() const override;
 
+      // Documentation inherited
+      public: virtual std::shared_ptr<const float> AcquireDepthData() const
+          override;
+
       /// \brief Connect a to the new depth image signal
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
@@ -103,6 +119,18 @@ namespace gz
           std::function<void(const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewPackedPointCloud(
+                  NewPackedPointCloudListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewRgbFrame(
+                  Camera::NewFrameListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::NewFrameViewListener _listener) override;
+
       /// \brief Implementation of the render call
       public: virtual void Render() override;
 
@@ -114,6 +142,9 @@ namespace gz
       /// \param[in] _near Near clip distance
       public: virtual void SetNearClipPlane(const double _near) override;
 
+      // Documentation inherited.
+      public: virtual void SetLodBias(double _bias) override;
+
       /// \brief Get the near clip distance
       /// \return Near clip distance. A value of zero is returned if the
       /// ogre camera has not been created.
@@ -127,6 +158,14 @@ namespace gz
       // Documentation inherited.
       public: void SetShadowsDirty() override;
 
+      // Documentation inherited.
+      public: virtual void SetOutputFormat(DepthCameraOutputFormat _format)
+                  override;
+
+      // Documentation inherited.
+      public: virtual void SetQualityProfile(
+                  const SensorQualityProfile &_profile) override;
+
       // Documentation inherited.
       public: void AddRenderPass(const RenderPassPtr &_pass) override;
 
@@ -153,6 +192,51 @@ namespace gz
       /// \sa SetShadowsDirty
       private: void SetShadowsNodeDefDirty();
 
+      /// \brief Queue an asynchronous download of the depth texture and
+      /// deliver the oldest completed frame in the readback ring, if any.
+      /// \sa DepthCamera::SetReadbackBufferCount
+      private: void ReadDepthDataAsync();
+
+      /// \brief Copy downloaded depth data into the output buffers and
+      /// emit the new depth frame and rgb point cloud events
+      /// \param[in] _data Pointer to the downloaded texture data
+      /// \param[in] _bytesPerRow Row pitch of the downloaded texture data
+      private: void ProcessDepthData(const void *_data, size_t _bytesPerRow);
+
+      /// \brief Convert the point cloud in the depth buffer into packed
+      /// points and emit the new packed point cloud event
+      /// \param[in] _width Point cloud width
+      /// \param[in] _height Point cloud height
+      private: void EmitPackedPointCloud(unsigned int _width,
+                   unsigned int _height);
+
+      /// \brief Convert the color in the depth buffer into an image in
+      /// RgbFrameFormat() and emit the new rgb frame event
+      /// \param[in] _width Image width
+      /// \param[in] _height Image height
+      private: void EmitRgbFrame(unsigned int _width, unsigned int _height);
+
+      /// \brief Whether any listener needs the color target to be rendered
+      /// \return True if there are rgb frame, rgb point cloud or packed
+      /// point cloud listeners
+      private: bool HasColorListeners() const;
+
+      /// \brief Whether any listener needs the float32 depth texture to be
+      /// read back
+      /// \return True if there are depth frame or color listeners
+      private: bool HasFloatListeners() const;
+
+      /// \brief Create the pass that converts the final depth texture to
+      /// the compact output format, see SetOutputFormat
+      private: void CreateCompactPass();
+
+      /// \brief Destroy the compact output pass and its texture
+      private: void DestroyCompactPass();
+
+      /// \brief Download the compact depth texture and emit it as a frame
+      /// view, asynchronously if the readback buffer count is greater than 1
+      private: void ReadCompactData();
+
       /// \brief Pointer to the ogre camera
       protected: Ogre::Camera *ogreCamera;
 
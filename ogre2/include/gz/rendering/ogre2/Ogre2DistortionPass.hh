@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2DISTORTIONPASS_HH_
+#define GZ_RENDERING_OGRE2_OGRE2DISTORTIONPASS_HH_
+
+#include <memory>
+#include <string>
+
+#include <gz/math/Vector2.hh>
+
+#include "gz/rendering/base/BaseDistortionPass.hh"
+#include "gz/rendering/ogre2/Ogre2RenderPass.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2DistortionPassPrivate;
+
+    /* \class Ogre2DistortionPass Ogre2DistortionPass.hh \
+     * gz/rendering/ogre2/Ogre2DistortionPass.hh
+     */
+    /// \brief Ogre2 Implementation of a Distortion render pass.
+    ///
+    /// Unlike the ogre1 implementation, no distortion map is computed on the
+    /// CPU: the fragment shader inverts the Brown-Conrady model for every
+    /// output pixel. The material is shared by all passes with the same
+    /// distortion coefficients and center, and the focal length is taken
+    /// from the projection of the camera the pass is rendered with.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2DistortionPass :
+      public BaseDistortionPass<Ogre2RenderPass>
+    {
+      /// \brief Constructor
+      public: Ogre2DistortionPass();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2DistortionPass();
+
+      // Documentation inherited
+      public: void Destroy() override;
+
+      // Documentation inherited
+      public: void CreateRenderPass() override;
+
+      // Documentation inherited
+      public: std::string FusableMaterialName() const override;
+
+      // Documentation inherited
+      public: void WorkspaceAdded(
+            Ogre::CompositorWorkspace *_workspace) override;
+
+      // Documentation inherited
+      public: void WorkspaceRemoved(
+            Ogre::CompositorWorkspace *_workspace) override;
+
+      /// \brief Apply the distortion model to a normalized image location
+      /// \param[in] _in Undistorted location, in [0, 1] image coordinates
+      /// \param[in] _center Distortion center, in [0, 1] image coordinates
+      /// \param[in] _k1 Radial distortion coefficient k1
+      /// \param[in] _k2 Radial distortion coefficient k2
+      /// \param[in] _k3 Radial distortion coefficient k3
+      /// \param[in] _p1 Tangential distortion coefficient p1
+      /// \param[in] _p2 Tangential distortion coefficient p2
+      /// \param[in] _focal Focal length along each axis, in units of the
+      /// image size along that axis
+      /// \return Distorted location, in [0, 1] image coordinates
+      public: static math::Vector2d Distort(const math::Vector2d &_in,
+                  const math::Vector2d &_center, double _k1, double _k2,
+                  double _k3, double _p1, double _p2,
+                  const math::Vector2d &_focal);
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<Ogre2DistortionPassPrivate> dataPtr;
+
+      /// \brief Make the workspace listener a friend
+      private: friend class Ogre2DistortionPassWorkspaceListener;
+    };
+    }
+  }
+}
+#endif
@@ -116,6 +116,23 @@ namespace gz
       /// \brief Remove all points from the point list
       public: void Clear();
 
+      /// \brief Replace all points in the point list
+      /// \param[in] _xyz Point positions, 3 consecutive floats per point
+      /// \param[in] _rgba Point colors, 4 consecutive floats per point. If
+      /// null, all points are white.
+      /// \param[in] _count Number of points
+      public: void SetPoints(const float *_xyz, const float *_rgba,
+                  size_t _count);
+
+      /// \brief Add many points at once to the end of the point list. Only
+      /// the new points are uploaded on the next update.
+      /// \param[in] _xyz Point positions, 3 consecutive floats per point
+      /// \param[in] _rgba Point colors, 4 consecutive floats per point. If
+      /// null, all points are white.
+      /// \param[in] _count Number of points
+      public: void AppendPoints(const float *_xyz, const float *_rgba,
+                  size_t _count);
+
       /// \brief Destroy the dynamic renderable
       public: void Destroy();
 
@@ -142,8 +159,11 @@ namespace gz
       /// \param[in] _opType Ogre render operation type
       /// \param[in] _vertices a list of vertices
       /// \param[in,out] _vbuffer vertex buffer to be filled
+      /// \param[in] _begin First vertex to fill
+      /// \param[in] _end One past the last vertex to fill
       private: void GenerateColors(Ogre::OperationType _opType,
-          const std::vector<math::Vector3d> &_vertices, float *_vbuffer);
+          const std::vector<math::Vector3d> &_vertices, float *_vbuffer,
+          size_t _begin, size_t _end);
 
       /// \brief Destroy the vertex buffer
       private: void DestroyBuffer();
@@ -51,6 +51,9 @@ namespace gz
       // Documentation inherited
       public: void CreateRenderPass() override;
 
+      // Documentation inherited
+      public: std::string FusableMaterialName() const override;
+
       /// \brief Pointer to private data class
       private: std::unique_ptr<Ogre2GaussianNoisePassPrivate> dataPtr;
     };
@@ -173,6 +173,15 @@ namespace gz
       // Documentation inherited
       public: virtual void Bind(const CameraPtr &_camera) override;
 
+      // Documentation inherited
+      public: virtual void SetUpdateInterval(uint32_t _frames) override;
+
+      // Documentation inherited
+      public: virtual uint32_t UpdateInterval() const override;
+
+      // Documentation inherited
+      public: virtual void Converge() override;
+
       // Documentation inherited
       public: virtual bool Anisotropic() const override;
 
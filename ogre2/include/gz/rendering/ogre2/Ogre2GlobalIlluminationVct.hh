@@ -57,6 +57,9 @@ namespace gz
       // Documentation inherited
       public: virtual void Build() override;
 
+      // Documentation inherited
+      public: virtual bool BuildIfChanged() override;
+
       // Documentation inherited
       public: virtual void UpdateLighting() override;
 
@@ -18,8 +18,11 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2GPURAYS_HH_
 #define GZ_RENDERING_OGRE2_OGRE2GPURAYS_HH_
 
+#include <array>
+#include <set>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/base/BaseGpuRays.hh"
@@ -86,9 +89,22 @@ namespace gz
       // Documentation inherited
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
+      // Documentation inherited.
+      public: virtual bool ReleaseRenderTextures() override;
+
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
       // Documentation inherited
       public: virtual const float *Data() const override;
 
+      // Documentation inherited
+      public: virtual std::shared_ptr<const float> AcquireData() const
+          override;
+
       // Documentation inherited.
       public: virtual void Copy(float *_data) override;
 
@@ -98,9 +114,39 @@ namespace gz
                   unsigned int _height, unsigned int _channels,
                   const std::string &_format)> _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::NewFrameViewListener _listener) override;
+
       // Documentation inherited.
       public: virtual RenderTargetPtr RenderTarget() const override;
 
+      // Documentation inherited.
+      public: virtual void SetLodBias(double _bias) override;
+
+      // Documentation inherited.
+      public: virtual void SetOutputFormat(GpuRaysOutputFormat _format)
+              override;
+
+      // Documentation inherited.
+      public: virtual void SetRayDirections(
+                  const std::vector<math::Vector2d> &_directions,
+                  unsigned int _width) override;
+
+      // Documentation inherited.
+      public: virtual void SetScanMotion(const math::Pose3d &_start,
+                  const math::Pose3d &_end) override;
+
+      // Documentation inherited.
+      public: virtual void ClearScanMotion() override;
+
+      // Documentation inherited.
+      public: virtual bool HasScanMotion() const override;
+
+      // Documentation inherited.
+      public: virtual void SetBeamDivergence(double _divergence,
+                  unsigned int _samples) override;
+
       /// \brief Set the number of samples in the width and height for the
       /// first pass texture.
       /// \param[in] _w Number of samples in the horizontal sweep
@@ -127,6 +173,13 @@ namespace gz
       /// \brief Create the texture which is used to render gpu rays data.
       private: virtual void CreateGpuRaysTextures();
 
+      /// \brief Destroy the textures, cameras and compositors created by
+      /// CreateGpuRaysTextures
+      private: void DestroyGpuRaysTextures();
+
+      /// \brief Apply a new scan pattern, see SetRayDirections
+      private: void UpdateRayDirections();
+
       /// \brief Update the render targets in the 1st pass
       private: void UpdateRenderTarget1stPass();
 
@@ -137,12 +190,33 @@ namespace gz
       /// cubemap face index data
       private: void CreateSampleTexture();
 
+      /// \brief Compute the data of the cubemap sample texture
+      /// \param[out] _data RGBA texels, one per ray of the 2nd pass
+      /// \param[out] _faces Cubemap faces sampled by the rays
+      /// \param[out] _faceTimes Mean scan time of the rays of each face,
+      /// from 0 at the first column to 1 at the last column
+      private: void FillSampleTable(float *_data,
+          std::set<unsigned int> &_faces, std::array<double, 6> &_faceTimes);
+
+      /// \brief Upload data to the cubemap sample texture
+      /// \param[in] _data RGBA texels, one per ray of the 2nd pass
+      private: void UploadSampleTable(const float *_data);
+
       /// \brief Set up 1st pass material, texture, and compositor
       private: void Setup1stPass();
 
       /// \brief Set up 2nd pass material, texture, and compositor
       private: void Setup2ndPass();
 
+      /// \brief Destroy 2nd pass texture and compositor
+      private: void Destroy2ndPass();
+
+      /// \brief Copy downloaded 2nd pass data into the output buffer and
+      /// emit the new frame events
+      /// \param[in] _data Pointer to the downloaded texture data
+      /// \param[in] _bytesPerRow Row pitch of the downloaded texture data
+      private: void ProcessData(const void *_data, size_t _bytesPerRow);
+
       /// \brief Helper function to convert a direction vector to the
       /// index number of a cubemap face and texture uv coordinates on that face
       /// \param[in] _v Direction vector
@@ -55,6 +55,29 @@ namespace gz
         GORM_COUNT = 3,
         IORM_COUNT = 3,  // TODO(CH3): Deprecated. Remove on tock.
       };
+
+      /// \brief Custom parameters of Ogre renderables holding the per-item
+      /// attributes that the GzHlms implementations write to the per-object
+      /// buffer in GORM_SOLID_COLOR and GORM_SOLID_THERMAL_COLOR_TEXTURED.
+      ///
+      /// Each mode reads its own slot, so attributes that only change
+      /// when the scene changes can stay set on the items across renders
+      /// without being picked up by another mode.
+      enum GzOgreItemAttribute
+      {
+        /// \brief Colour set before and removed after every render. Used by
+        /// e.g. the selection buffer, GPU rays and the thermal camera
+        GOIA_SOLID_COLOR = 1,
+
+        /// \brief Multiply the solid colour against the raw diffuse
+        /// texture. See GORM_SOLID_THERMAL_COLOR_TEXTURED
+        GOIA_TEXTURED = 2,
+
+        /// \brief Segmentation label or instance colour. Persistent, kept
+        /// up to date by the segmentation camera when items change
+        GOIA_SEGMENTATION = 3,
+      };
+
       // TODO(CH3): Deprecated. Remove on tock.
       #ifdef _WIN32
         using IgnOgreRenderingMode = GzOgreRenderingMode;
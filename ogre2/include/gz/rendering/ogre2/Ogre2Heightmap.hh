@@ -18,7 +18,9 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2HEIGHTMAP_HH_
 #define GZ_RENDERING_OGRE2_OGRE2HEIGHTMAP_HH_
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "gz/rendering/base/BaseHeightmap.hh"
 #include "gz/rendering/ogre2/Ogre2Geometry.hh"
@@ -64,6 +66,14 @@ namespace gz
       // Documentation inherited.
       public: virtual void PreRender() override;
 
+      // Documentation inherited.
+      public: virtual bool IsLoaded() const override;
+
+      // Documentation inherited.
+      public: virtual std::vector<double> HeightsAt(
+                  const std::vector<math::Vector2d> &_positions) const
+                  override;
+
       /// \brief Returns the Terra pointer as it is a movable object that
       /// must be attached to a regular SceneNode
       /// \remarks This behavior is different from ogre1
@@ -98,6 +108,11 @@ namespace gz
       // Documentation inherited.
       public: virtual void Destroy() override;
 
+      /// \brief Load the terra object from the prepared heightmap data.
+      /// Must be called from the render thread.
+      /// \param[in] _heights Heights as 16 bit UNORM, dataSize x dataSize
+      private: void LoadTerra(std::vector<uint16_t> &&_heights);
+
       /// \brief Heightmap should only be created by scene.
       private: friend class OgreScene;
 
@@ -68,12 +68,22 @@ namespace gz
       // Documentation inherited
       public: virtual std::vector<double> Points() const override;
 
+      // Documentation inherited
+      public: virtual void SetGpuRays(const GpuRaysPtr &_gpuRays) override;
+
+      // Documentation inherited
+      public: virtual GpuRaysPtr GpuRays() const override;
+
       /// \brief Create the Lidar Visual in ogre
       private: void Create();
 
       /// \brief Clear data stored by dynamiclines
       private: void ClearVisualData();
 
+      /// \brief Recompute the cached ray directions if the angles, ray
+      /// counts or offset changed since the last update
+      private: void UpdateRayDirections();
+
       // Documentation inherited
       public: virtual void SetVisible(bool _visible) override;
 
@@ -71,6 +71,14 @@ namespace gz
       // Documentation inherited
       public: virtual void ClearPoints() override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) override;
+
+      // Documentation inherited
+      public: virtual void AppendPoints(const float *_xyz, const float *_rgba,
+                  size_t _count) override;
+
       // Documentation inherited
       public: virtual void SetType(const MarkerType _markerType) override;
 
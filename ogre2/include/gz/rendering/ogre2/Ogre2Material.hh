@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gz/rendering/base/BaseMaterial.hh"
 #include "gz/rendering/ogre2/Ogre2Object.hh"
@@ -37,6 +38,7 @@ namespace Ogre
 {
   class HlmsPbsDatablock;
   class HlmsUnlitDatablock;
+  class SubItem;
 }  // namespace Ogre
 
 namespace gz
@@ -61,6 +63,14 @@ namespace gz
       // Documentation inherited
       public: virtual void Destroy() override;
 
+      /// \brief Clone the material. The clone shares the datablock of
+      /// identical materials until it is modified, so unique materials
+      /// that are never changed do not need their own datablock.
+      /// \param[in] _name Name of the cloned material
+      /// \return The cloned material
+      public: virtual MaterialPtr Clone(const std::string &_name = "") const
+              override;
+
       // Documentation inherited
       public: virtual math::Color Diffuse() const override;
 
@@ -242,10 +252,29 @@ namespace gz
       /// \return Ogre material pointer
       public: virtual Ogre::MaterialPtr Material();
 
-      /// \brief Return ogre Hlms material pbs datablock
+      /// \brief Return ogre Hlms material pbs datablock. If the datablock
+      /// is shared with other materials, the material gets its own copy
+      /// first so that the returned datablock can be modified.
       /// \return Ogre Hlms pbs datablock
+      /// \sa Scene::SetMaterialSharingEnabled
       public: virtual Ogre::HlmsPbsDatablock *Datablock() const;
 
+      /// \internal
+      /// \brief Get the datablock to assign to a submesh that uses this
+      /// material. If material sharing is enabled in the scene, this is a
+      /// datablock shared with all other materials that have identical
+      /// properties.
+      /// \param[in] _subMesh Submesh the datablock is assigned to
+      /// \return Ogre Hlms pbs datablock
+      /// \sa Scene::SetMaterialSharingEnabled
+      public: Ogre::HlmsPbsDatablock *SubMeshDatablock(
+          const Ogre2SubMeshPtr &_subMesh);
+
+      /// \internal
+      /// \brief Give the material its own datablock if it currently uses a
+      /// shared one. Must be called before modifying the datablock.
+      public: void DetachDatablock();
+
       /// \brief Return ogre Hlms material unlit datablock
       /// \return Ogre Hlms unlit datablock
       public: virtual Ogre::HlmsUnlitDatablock *UnlitDatablock();
@@ -317,6 +346,17 @@ namespace gz
           const std::shared_ptr<const common::Image> &_img,
           Ogre::PbsTextureTypes _type);
 
+      /// \brief Finish setting a texture map loaded from file once the
+      /// texture's metadata is available, e.g. disable alpha from texture if
+      /// the diffuse map has no alpha channel. Called right away by
+      /// SetTextureMapImpl, or once the texture is ready if textures are
+      /// streamed. \sa Scene::SetTextureStreamingEnabled
+      /// \param[in] _texture Texture assigned to the map
+      /// \param[in] _type Type of texture, i.e. diffuse, normal, roughness,
+      /// metalness
+      protected: void UpdateTextureMap(Ogre::TextureGpu *_texture,
+          Ogre::PbsTextureTypes _type);
+
       /// \brief Get a pointer to the ogre texture by name
       /// \return Ogre texture
       protected: virtual Ogre::TextureGpu *Texture(const std::string &_name);
@@ -331,12 +371,27 @@ namespace gz
       /// \brief bind shader parameters that have changed
       protected: void UpdateShaderParams();
 
-      /// \brief Transfer params from gz-rendering type to ogre type
+      /// \brief Transfer params from gz-rendering type to ogre type. If the
+      /// params were only changed through their handles, only the changed
+      /// params are written.
       /// \param[in] _params Gazebo Rendering params
       /// \param[out] _ogreParams ogre type for holding params
       protected: void UpdateShaderParams(ConstShaderParamsPtr _params,
           Ogre::GpuProgramParametersSharedPtr _ogreParams);
 
+      /// \brief Get whether the datablock can be replaced by a shared one,
+      /// i.e. it is not shared yet and nothing but its properties, like
+      /// custom shaders or textures still loading, makes it unique
+      /// \return True if the datablock can be shared
+      private: bool CanShareDatablock() const;
+
+      /// \brief Replace the datablock by the shared datablock with the
+      /// same content
+      /// \param[in] _subItems Renderables to switch to the shared
+      /// datablock, they must be the only users of the datablock
+      private: void ShareDatablock(
+          const std::vector<Ogre::SubItem *> &_subItems);
+
       /// \brief  Ogre material. Mainly used for render targets.
       protected: Ogre::MaterialPtr ogreMaterial;
 
@@ -75,6 +75,26 @@ namespace gz
       public: virtual void SetSkeletonWeights(
             const std::unordered_map<std::string, float> &_weights) override;
 
+      // Documentation inherited.
+      public: virtual std::vector<std::string> SkeletonBoneNames() const
+            override;
+
+      // Documentation inherited.
+      public: virtual void SkeletonBoneTransforms(
+            std::vector<math::Matrix4d> &_tfs) const override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms(
+            const math::Matrix4d *_tfs, unsigned int _count) override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms3x4(const float *_tfs,
+            unsigned int _count) override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneWeights(const float *_weights,
+            unsigned int _count) override;
+
       // Documentation inherited.
       public: virtual void SetSkeletonAnimationEnabled(const std::string &_name,
             bool _enabled, bool _loop = true, float _weight = 1.0) override;
@@ -87,6 +107,18 @@ namespace gz
       public: virtual void UpdateSkeletonAnimation(
             std::chrono::steady_clock::duration _time) override;
 
+      // Documentation inherited.
+      public: virtual void SetSkeletonAnimationInstanced(bool _instanced,
+            double _bakeRate = 30.0) override;
+
+      // Documentation inherited.
+      public: virtual bool SkeletonAnimationInstanced() const override;
+
+      // Documentation inherited.
+      public: virtual bool UpdateVertices(unsigned int _subMeshIndex,
+                  const float *_positions, const float *_normals,
+                  unsigned int _vertexCount) override;
+
       // Documentation inherited
       public: virtual Ogre::MovableObject *OgreObject() const override;
 
@@ -61,6 +61,13 @@ namespace gz
       /// factory
       public: virtual void Clear();
 
+      /// \brief Load meshes ahead of their creation. The vertex and index
+      /// data of the meshes is prepared on the scene's worker threads, then
+      /// the buffers are created and imported to v2 meshes on the calling
+      /// thread. Meshes that are already loaded are skipped.
+      /// \param[in] _descs Descriptors of the meshes to load
+      public: void Preload(const std::vector<MeshDescriptor> &_descs);
+
       /// \brief Get the ogre item based on the mesh descriptor
       /// \param[in] _desc Descriptor describing the target mesh
       protected: virtual Ogre::Item *OgreItem(
@@ -97,6 +104,11 @@ namespace gz
       /// \brief Remove internal material cache for a specific material
       public: void ClearMaterialsCache(const std::string &_name);
 
+      /// \brief Remove the ogre meshes of a mesh descriptor. Must only be
+      /// called once no mesh created from the descriptor is left.
+      /// \param[in] _desc Descriptor of the meshes to remove
+      public: void Unload(const MeshDescriptor &_desc);
+
       /// \brief Pointer to private data class
       private: std::unique_ptr<Ogre2MeshFactoryPrivate> dataPtr;
     };
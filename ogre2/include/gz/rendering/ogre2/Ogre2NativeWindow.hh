@@ -61,6 +61,28 @@ namespace gz
       // Documentation Inherited.
       public: virtual void Draw(CameraPtr _camera) override;
 
+      // Documentation Inherited.
+      public: virtual void SetSwapInterval(unsigned int _interval) override;
+
+      // Documentation Inherited.
+      public: virtual unsigned int SwapInterval() const override;
+
+      // Documentation Inherited.
+      public: virtual void SetMaxFramesInFlight(unsigned int _frames)
+            override;
+
+      // Documentation Inherited.
+      public: virtual unsigned int MaxFramesInFlight() const override;
+
+      // Documentation Inherited.
+      public: virtual void SetNonBlockingPresent(bool _nonBlocking) override;
+
+      // Documentation Inherited.
+      public: virtual bool NonBlockingPresent() const override;
+
+      // Documentation Inherited.
+      public: virtual uint64_t SkippedFrameCount() const override;
+
       /// \brief Pointer to private data
       private: std::unique_ptr<Ogre2NativeWindowPrivate> dataPtr;
 
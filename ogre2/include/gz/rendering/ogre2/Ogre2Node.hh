@@ -64,6 +64,12 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetInheritScale(bool _inherit) override;
 
+      /// \internal
+      /// \brief Update the position of the Ogre node from the local
+      /// position, applying the scene's render origin if the node is
+      /// attached to the root visual. See Scene::SetRenderOrigin.
+      public: void UpdateRenderPosition();
+
       // Documentation inherited.
       protected: virtual void SetLocalScaleImpl(
                      const math::Vector3d &_scale) override;
@@ -124,6 +130,11 @@ namespace gz
       /// \brief A list of child nodes
       protected: Ogre2NodeStorePtr children;
 
+      /// \brief Local position in double precision. The Ogre node stores it
+      /// in single precision and, for nodes attached to the root visual,
+      /// relative to the render origin.
+      protected: math::Vector3d position;
+
       // TODO(anyone): remove the need for a visual friend class
       private: friend class Ogre2Visual;
     };
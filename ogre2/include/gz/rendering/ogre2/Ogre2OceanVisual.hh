@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2OCEANVISUAL_HH_
+#define GZ_RENDERING_OGRE2_OGRE2OCEANVISUAL_HH_
+
+#include <memory>
+
+#include "gz/rendering/base/BaseOceanVisual.hh"
+#include "gz/rendering/ogre2/Ogre2Visual.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2OceanVisualPrivate;
+
+    /// \brief Ogre 2.x implementation of an ocean visual.
+    ///
+    /// The rings share one item with a static index buffer. The vertices
+    /// are displaced on the scene manager's worker threads and uploaded
+    /// when the scene time, the waves or the center change, and are drawn
+    /// with the regular PBS material of the visual.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2OceanVisual
+      : public BaseOceanVisual<Ogre2Visual>
+    {
+      /// \brief Constructor
+      protected: Ogre2OceanVisual();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2OceanVisual();
+
+      // Documentation inherited.
+      public: virtual void Init() override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      /// \brief Create the mesh and item of the current grid layout
+      private: void CreateSurface();
+
+      /// \brief Destroy the mesh and item
+      private: void DestroySurface();
+
+      /// \brief Displace and upload the vertices
+      private: void UpdateSurface();
+
+      /// \brief Ocean visual should only be created by scene.
+      private: friend class Ogre2Scene;
+
+      /// \brief Private data class
+      private: std::unique_ptr<Ogre2OceanVisualPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
@@ -98,6 +98,11 @@ namespace gz
       /// \brief Create the particle system
       private: void CreateParticleSystem();
 
+      /// \brief Size the particle pool for the current rate and lifetime.
+      /// Large pools skip per-particle sorting and culling, which dominate
+      /// the CPU cost of dense effects like fog, dust or rain.
+      private: void UpdateParticleQuota();
+
       /// \brief Only the ogre scene can instanstiate this class
       private: friend class Ogre2Scene;
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2POINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_OGRE2_OGRE2POINTCLOUDVISUAL_HH_
+
+#include <memory>
+
+#include "gz/rendering/base/BasePointCloudVisual.hh"
+#include "gz/rendering/ogre2/Ogre2Visual.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2PointCloudVisualPrivate;
+
+    /// \brief Ogre 2.x implementation of a point cloud visual.
+    ///
+    /// The points are split in chunks of up to 2^20 points, each with its
+    /// own persistently mapped vertex buffer and bounds, so chunks outside
+    /// the view are culled and only the chunks whose size changed are
+    /// reallocated. Within a chunk the points are stored in bit reversed
+    /// order, so that any prefix of the chunk is an evenly spread subset
+    /// of its points; decimation only shortens the range drawn.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2PointCloudVisual
+      : public BasePointCloudVisual<Ogre2Visual>
+    {
+      /// \brief Constructor
+      protected: Ogre2PointCloudVisual();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2PointCloudVisual();
+
+      // Documentation inherited.
+      public: virtual void Init() override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual unsigned int RenderedPointCount() const override;
+
+      /// \brief Copy the points to the vertex buffers of the chunks
+      private: void UploadPoints();
+
+      /// \brief Set the uniforms of the material and the range drawn of
+      /// every chunk
+      private: void UpdateMaterial();
+
+      /// \brief Destroy the chunks from the given one on
+      /// \param[in] _first Index of the first chunk to destroy
+      private: void DestroyChunks(size_t _first);
+
+      /// \brief Destroy the buffers and item of a chunk, keeping it empty
+      /// \param[in] _index Index of the chunk
+      private: void DestroyChunk(size_t _index);
+
+      /// \brief Point cloud visual should only be created by scene.
+      private: friend class Ogre2Scene;
+
+      /// \brief Private data class
+      private: std::unique_ptr<Ogre2PointCloudVisualPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
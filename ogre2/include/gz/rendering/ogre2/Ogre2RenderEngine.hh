@@ -17,9 +17,12 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2RENDERENGINE_HH_
 #define GZ_RENDERING_OGRE2_OGRE2RENDERENGINE_HH_
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/SingletonT.hh>
@@ -34,8 +37,10 @@
 
 namespace Ogre
 {
+  class CompositorWorkspace;
   class LogManager;
   class Root;
+  class TextureGpu;
   class Window;
   namespace v1
   {
@@ -100,6 +105,45 @@ namespace gz
       /// \param[in] _uri Resource path in the form of an uri
       public: void AddResourcePath(const std::string &_uri) override;
 
+      /// \brief Start a batch of resource path registrations. Paths added
+      /// with AddResourcePath while a batch is open are still deduplicated
+      /// and added to ogre2's resource manager, but the "General" resource
+      /// group is only initialised once, when the outermost batch ends.
+      /// Use this when loading many meshes or textures at once, e.g. when
+      /// loading a world. Batches can be nested.
+      /// \sa EndResourceBatch
+      public: void BeginResourceBatch();
+
+      /// \brief End a batch of resource path registrations started with
+      /// BeginResourceBatch. Ending the outermost batch initialises the
+      /// resource group and parses material scripts of any new paths.
+      /// \sa BeginResourceBatch
+      public: void EndResourceBatch();
+
+      // Documentation Inherited
+      public: virtual size_t TextureMemoryUsage() const override;
+
+      // Documentation Inherited
+      public: virtual GpuMemoryStats MemoryStats() const override;
+
+      /// \internal
+      /// \brief Get the GPU memory of a texture, used by sensors to report
+      /// the memory of their render targets. See Sensor::MemoryUsage.
+      /// \param[in] _texture Texture, may be null
+      /// \return Size of all mip levels and slices in bytes, 0 if the
+      /// texture is null or not resident on the GPU
+      public: static size_t TextureSizeBytes(
+                  const Ogre::TextureGpu *_texture);
+
+      /// \internal
+      /// \brief Get the GPU memory of the textures a compositor workspace
+      /// creates for its nodes. Textures passed to the workspace and the
+      /// textures of its shadow nodes are not included.
+      /// \param[in] _workspace Workspace, may be null
+      /// \return Size of the local textures in bytes
+      public: static size_t WorkspaceSizeBytes(
+                  const Ogre::CompositorWorkspace *_workspace);
+
       /// \brief return the ogre window
       public: Ogre::Window * OgreWindow() const;
 
@@ -201,6 +245,15 @@ namespace gz
       /// and see Ogre::GzHlmsPbs
       /// \param[in] renderingMode
       public: void SetGzOgreRenderingMode(GzOgreRenderingMode renderingMode);
+
+      /// \internal
+      /// \brief Sets the current rendering mode and the custom parameter
+      /// the solid colour modes read from every item.
+      /// See GzOgreItemAttribute
+      /// \param[in] _renderingMode Rendering mode
+      /// \param[in] _attribute Custom parameter holding the item colours
+      public: void SetGzOgreRenderingMode(GzOgreRenderingMode _renderingMode,
+                  GzOgreItemAttribute _attribute);
       // TODO(CH3): Deprecated. Remove on tock.
       public:
         inline void GZ_DEPRECATED(7) SetIgnOgreRenderingMode(
@@ -228,6 +281,126 @@ namespace gz
       public: Ogre::CompositorWorkspaceListener
           *TerraWorkspaceListener() const;
 
+      /// \internal
+      /// \brief Get the directory where converted meshes are cached. Mesh
+      /// caching is enabled by passing "meshCache" = "1" (to use
+      /// ~/.gz/rendering/ogre2-mesh-cache) or "meshCachePath" = <dir> to
+      /// RenderEngine::Load.
+      /// \return Path to the mesh cache directory, empty if disabled.
+      public: std::string MeshCachePath() const;
+
+      /// \internal
+      /// \brief Get whether converted meshes stay loaded once no visual
+      /// uses them. Meshes are Ogre resources shared by all scenes of the
+      /// engine and are keyed by their MeshDescriptor, so retaining them
+      /// lets scenes created after a reset or in another scene reuse the
+      /// converted mesh instead of rebuilding it. Enabled by passing
+      /// "retainMeshes" = "1" to RenderEngine::Load. The meshes are
+      /// released when the engine is unloaded.
+      /// \return True if meshes are retained
+      public: bool RetainMeshes() const;
+
+      /// \internal
+      /// \brief Get whether textures loaded from files are compressed to
+      /// GPU block formats, BC7 for color textures and BC5 for normal
+      /// maps, with their mip levels generated on the CPU. Enabled by
+      /// passing "textureCompression" = "1" to RenderEngine::Load. GPUs
+      /// without block compression load the textures as usual.
+      /// \return True if textures are compressed
+      public: bool TextureCompression() const;
+
+      /// \internal
+      /// \brief Get the directory where compressed textures are cached,
+      /// keyed by the hash of their file contents. Texture caching is
+      /// enabled by passing "textureCache" = "1" (to use
+      /// ~/.gz/rendering/ogre2-texture-cache) or "textureCachePath" = <dir>
+      /// to RenderEngine::Load.
+      /// \return Path to the texture cache directory, empty if disabled.
+      public: std::string TextureCachePath() const;
+
+      /// \internal
+      /// \brief Get the directory where compiled shaders (Hlms disk cache
+      /// and render system microcode) are persisted between runs. Shader
+      /// caching is enabled by passing "shaderCache" = "1" (to use
+      /// ~/.gz/rendering/ogre2-shader-cache) or "shaderCachePath" = <dir>
+      /// to RenderEngine::Load. Caches are stored in a subdirectory per
+      /// gz-rendering version and GPU driver.
+      /// \return Path to the shader cache directory, empty if disabled.
+      public: std::string ShaderCachePath() const;
+
+      /// \internal
+      /// \brief Get the number of worker threads each scene manager is
+      /// created with. The workers are shared by Ogre's scene graph update
+      /// and the CPU post-processing of sensor data, see
+      /// Ogre2Scene::ParallelForRows. Set by passing "workerThreads" = <n>
+      /// to RenderEngine::Load, defaults to the number of logical cores.
+      /// \return Number of worker threads, at least 1.
+      public: unsigned int WorkerThreadCount() const;
+
+      /// \internal
+      /// \brief Get whether the engine renders reproducibly, for comparing
+      /// sensor output across runs and builds. Enabled by passing
+      /// "deterministic" = "1" to RenderEngine::Load, optionally with
+      /// "seed" = <n> (0 by default). In this mode gz::math::Rand is seeded
+      /// with the seed, so the noise passes get the same seeds in every
+      /// run, scene managers use a single worker thread and textures are
+      /// always fully loaded before rendering. Use FrameView::Hash to
+      /// detect unchanged frames cheaply.
+      /// \return True if the engine runs in deterministic mode
+      public: bool Deterministic() const;
+
+      /// \internal
+      /// \brief Get whether scenes may be rendered from different threads,
+      /// e.g. one thread per simulated environment. Enabled by passing
+      /// "sceneThreading" = "1" to RenderEngine::Load, for the Vulkan and
+      /// Metal render systems only. Meshes, textures and shaders are shared
+      /// by all scenes.
+      ///
+      /// Rendering is thread-safe but serialized: it does not render
+      /// scenes concurrently. Each scene holds RenderMutex from
+      /// Scene::PreRender to Scene::PostRender, so only the CPU work the
+      /// other threads do outside of that span, e.g. simulation or reading
+      /// sensor data, overlaps with rendering. PreRender and PostRender of
+      /// a scene must be called from the same thread, and a scene that
+      /// skips PostRender blocks the other threads until it is destroyed.
+      /// Scenes must not render in legacy mode, see
+      /// Scene::SetCameraPassCountPerGpuFlush.
+      /// \return True if scene threading is enabled
+      public: bool SceneThreading() const;
+
+      /// \internal
+      /// \brief Get the lock held by a scene while it renders when scene
+      /// threading is enabled. Threads that create or destroy objects while
+      /// other threads render must hold it too, since loading meshes and
+      /// textures modifies resources shared by all scenes.
+      /// \return Recursive render mutex
+      public: std::recursive_mutex &RenderMutex();
+
+      /// \internal
+      /// \brief Get the name of the GPU the engine renders with. The GPU is
+      /// selected by passing "device" = <index or part of the name> to
+      /// RenderEngine::Load, for render systems that list their devices,
+      /// i.e. Vulkan and headless EGL. Headless EGL devices can also be
+      /// selected with "device" = "pci:<bus id>" (e.g. pci:0000:65:00.0)
+      /// or "uuid:<uuid>" (as reported by nvidia-smi). The available
+      /// devices are listed if the device is not found. Only one GPU can
+      /// be used per process: Ogre supports a single root, so run one
+      /// process per GPU and share the "meshCachePath" and
+      /// "shaderCachePath" directories between them to load assets once.
+      /// \return Name of the selected GPU, empty if the render system chose
+      /// the device.
+      public: std::string DeviceName() const;
+
+      /// \brief Get the duration of each phase of the last Load and Init,
+      /// e.g. "CreateContext", "LoadPlugins", "CreateRenderWindow" (which
+      /// registers the Hlms) and "InitialiseResources". "Prefetch" is the
+      /// time spent waiting for the startup files that are read from disk
+      /// in the background while the context and render system are
+      /// created. The breakdown is also printed to the debug log.
+      /// \return Name and duration of each phase, in order of execution
+      public: std::vector<std::pair<std::string,
+          std::chrono::steady_clock::duration>> StartupTimes() const;
+
       /// \brief Get a pointer to the render engine
       /// \return a pointer to the render engine
       public: static Ogre2RenderEngine *Instance();
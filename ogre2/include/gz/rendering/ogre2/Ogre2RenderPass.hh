@@ -83,6 +83,15 @@ namespace gz
       /// \brief Create the render pass using ogre compositor
       public: virtual void CreateRenderPass();
 
+      /// \internal
+      /// \brief Get the name of a material that applies this pass in a
+      /// single quad pass, reading the previous result from texture unit 0.
+      /// When this is the last enabled pass of a render target, the final
+      /// compositor pass renders with this material instead of copying the
+      /// result, which saves a full resolution read and write.
+      /// \return Material name, empty if the pass can not be fused
+      public: virtual std::string FusableMaterialName() const;
+
       /// \brief Name of the ogre compositor node definition
       protected: std::string ogreCompositorNodeDefName;
 
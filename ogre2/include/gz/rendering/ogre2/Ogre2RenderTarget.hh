@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2RENDERTARGET_HH_
 #define GZ_RENDERING_OGRE2_OGRE2RENDERTARGET_HH_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +25,8 @@
 
 #include "gz/rendering/base/BaseRenderTypes.hh"
 #include "gz/rendering/base/BaseRenderTarget.hh"
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/SensorQualityProfile.hh"
 #include "gz/rendering/ogre2/Ogre2Object.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTargetMaterial.hh"
 
@@ -68,10 +71,33 @@ namespace gz
       /// \param[in] _aa Anti-aliasing level
       public: virtual void SetAntiAliasing(unsigned int _aa);
 
+      /// \brief Set the anti-aliasing method. The compositor workspace is
+      /// rebuilt on the next render.
+      /// \param[in] _mode Anti-aliasing method
+      public: void SetAntiAliasingMode(CameraAntiAliasingMode _mode);
+
+      /// \brief Get the anti-aliasing method
+      /// \return Anti-aliasing method
+      public: CameraAntiAliasingMode AntiAliasingMode() const;
+
       /// \brief Copy the render target buffer data to an image
       /// \param[in] _image Image to copy the data to
       public: virtual void Copy(Image &_image) const override;
 
+      /// \brief Copy a region of the render target buffer data to an
+      /// image. Only the region is downloaded from the GPU.
+      /// \param[in] _image Image to copy the data to
+      /// \param[in] _x Left column of the region
+      /// \param[in] _y Top row of the region
+      public: virtual void CopyRegion(Image &_image, unsigned int _x,
+                  unsigned int _y) const override;
+
+      /// \brief Copy the render target buffer data, resized on the GPU to
+      /// the size of the image, to an image. Only the resized image is
+      /// downloaded.
+      /// \param[in] _image Image to copy the data to
+      public: virtual void CopyResized(Image &_image) const override;
+
       /// \brief Get a pointer to the internal ogre camera
       /// \return Pointer to ogre camera
       public: virtual Ogre::Camera *Camera() const;
@@ -148,6 +174,12 @@ namespace gz
       /// \brief See Camera::PrepareForExternalSampling
       public: void PrepareForExternalSampling();
 
+      /// \brief Get the GPU memory of the textures owned by the render
+      /// target: the ping pong textures, the local textures of its
+      /// compositor workspace and the Bayer and resize targets
+      /// \return Memory in bytes
+      public: size_t MemoryUsage() const;
+
       /// \brief Destroy the render texture
       protected: void DestroyTargetImpl();
 
@@ -164,6 +196,50 @@ namespace gz
       /// \param[in] _mask Visibility mask
       public: virtual void SetVisibilityMask(uint32_t _mask);
 
+      /// \internal
+      /// \brief Get the rendering features skipped by this render target
+      /// \return Quality profile of the sensor rendering to this target
+      public: const SensorQualityProfile &QualityProfile() const;
+
+      /// \internal
+      /// \brief Set the rendering features skipped by this render target.
+      /// The compositor workspace is rebuilt on the next render.
+      /// \param[in] _profile Quality profile of the sensor rendering to
+      /// this target, see Sensor::SetQualityProfile
+      public: void SetQualityProfile(const SensorQualityProfile &_profile);
+
+      /// \internal
+      /// \brief Set the fraction of the target resolution the scene is
+      /// rendered at. The scene is upscaled to the target resolution before
+      /// post-processing. The compositor workspace is rebuilt on the next
+      /// render.
+      /// \param[in] _scale Resolution scale, in (0, 1]
+      public: void SetRenderScale(double _scale);
+
+      /// \internal
+      /// \brief Get the fraction of the target resolution the scene is
+      /// rendered at
+      /// \return Resolution scale
+      public: double RenderScale() const;
+
+      // Documentation inherited
+      public: virtual void SetWidth(const unsigned int _width) override;
+
+      // Documentation inherited
+      public: virtual void SetHeight(const unsigned int _height) override;
+
+      /// \internal
+      /// \brief Set how long size changes wait before the target is
+      /// rebuilt, see Camera::SetResizeDelay
+      /// \param[in] _delay Time the size must stay unchanged, zero rebuilds
+      /// on the next render
+      public: void SetResizeDelay(std::chrono::steady_clock::duration _delay);
+
+      /// \internal
+      /// \brief Get how long size changes wait before the target is rebuilt
+      /// \return Resize delay, zero by default
+      public: std::chrono::steady_clock::duration ResizeDelay() const;
+
       /// \brief Update the render pass chain
       public: static void UpdateRenderPassChain(
           Ogre::CompositorWorkspace *_workspace,
@@ -239,6 +315,15 @@ namespace gz
       /// \brief visibility mask associated with this render target
       protected: uint32_t visibilityMask = GZ_VISIBILITY_ALL;
 
+      /// \brief Rendering features skipped by this render target
+      protected: SensorQualityProfile qualityProfile;
+
+      /// \brief Convert the render target to a Bayer image on the GPU and
+      /// copy the single channel result to an image
+      /// \param[in] _image Bayer image to copy the data to
+      /// \return True on success, false if the conversion is not available
+      private: bool CopyBayer(Image &_image) const;
+
       /// \brief Pointer to private data
       private: std::unique_ptr<Ogre2RenderTargetPrivate> dataPtr;
     };
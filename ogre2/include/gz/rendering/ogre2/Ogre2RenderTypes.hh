@@ -32,6 +32,7 @@ namespace gz
     class Ogre2AxisVisual;
     class Ogre2BoundingBoxCamera;
     class Ogre2Camera;
+    class Ogre2CameraArray;
     class Ogre2Capsule;
     class Ogre2COMVisual;
     class Ogre2DepthCamera;
@@ -55,8 +56,10 @@ namespace gz
     class Ogre2Node;
     class Ogre2Object;
     class Ogre2ObjectInterface;
+    class Ogre2OceanVisual;
     class Ogre2ParticleEmitter;
     class Ogre2Projector;
+    class Ogre2PointCloudVisual;
     class Ogre2PointLight;
     class Ogre2RayQuery;
     class Ogre2RenderEngine;
@@ -71,6 +74,7 @@ namespace gz
     class Ogre2SubMesh;
     class Ogre2ThermalCamera;
     class Ogre2Visual;
+    class Ogre2VoxelGridVisual;
     class Ogre2WideAngleCamera;
     class Ogre2WireBox;
 
@@ -88,6 +92,7 @@ namespace gz
     typedef shared_ptr<Ogre2AxisVisual>           Ogre2AxisVisualPtr;
     typedef shared_ptr<Ogre2BoundingBoxCamera>    Ogre2BoundingBoxCameraPtr;
     typedef shared_ptr<Ogre2Camera>               Ogre2CameraPtr;
+    typedef shared_ptr<Ogre2CameraArray>          Ogre2CameraArrayPtr;
     typedef shared_ptr<Ogre2Capsule>              Ogre2CapsulePtr;
     typedef shared_ptr<Ogre2COMVisual>            Ogre2COMVisualPtr;
     typedef shared_ptr<Ogre2DepthCamera>          Ogre2DepthCameraPtr;
@@ -109,11 +114,13 @@ namespace gz
     typedef shared_ptr<Ogre2Node>                 Ogre2NodePtr;
     typedef shared_ptr<Ogre2Object>               Ogre2ObjectPtr;
     typedef shared_ptr<Ogre2ObjectInterface>      Ogre2ObjectInterfacePtr;
+    typedef shared_ptr<Ogre2OceanVisual>          Ogre2OceanVisualPtr;
     typedef shared_ptr<Ogre2ParticleEmitter>      Ogre2ParticleEmitterPtr;
     typedef shared_ptr<Ogre2GlobalIlluminationCiVct>
       Ogre2GlobalIlluminationCiVctPtr;
     typedef shared_ptr<Ogre2GlobalIlluminationVct>
       Ogre2GlobalIlluminationVctPtr;
+    typedef shared_ptr<Ogre2PointCloudVisual>     Ogre2PointCloudVisualPtr;
     typedef shared_ptr<Ogre2PointLight>           Ogre2PointLightPtr;
     typedef shared_ptr<Ogre2Projector>            Ogre2ProjectorPtr;
     typedef shared_ptr<Ogre2RayQuery>             Ogre2RayQueryPtr;
@@ -129,6 +136,7 @@ namespace gz
     typedef shared_ptr<Ogre2SubMesh>              Ogre2SubMeshPtr;
     typedef shared_ptr<Ogre2ThermalCamera>        Ogre2ThermalCameraPtr;
     typedef shared_ptr<Ogre2Visual>               Ogre2VisualPtr;
+    typedef shared_ptr<Ogre2VoxelGridVisual>      Ogre2VoxelGridVisualPtr;
     typedef shared_ptr<Ogre2WideAngleCamera>      Ogre2WideAngleCameraPtr;
     typedef shared_ptr<Ogre2WireBox>              Ogre2WireBoxPtr;
 
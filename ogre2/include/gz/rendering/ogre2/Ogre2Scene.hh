@@ -17,6 +17,7 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2SCENE_HH_
 #define GZ_RENDERING_OGRE2_OGRE2SCENE_HH_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,8 +41,11 @@
 
 namespace Ogre
 {
+  class GpuProgramParameters;
+  class HlmsPbsDatablock;
   class Root;
   class SceneManager;
+  class SkeletonInstance;
 }
 
 namespace gz
@@ -52,6 +56,8 @@ namespace gz
     //
     // forward declaration
     class Ogre2ScenePrivate;
+    class Ogre2BakedSkeletonAnimation;
+    class Ogre2ParticleNoise;
     //
     /// \brief Ogre2.x implementation of the scene class
     class GZ_RENDERING_OGRE2_VISIBLE Ogre2Scene :
@@ -102,6 +108,33 @@ namespace gz
       // Documentation inherited
       public: virtual bool SkyEnabled() const override;
 
+      // Documentation inherited
+      public: virtual void SetTextureStreamingEnabled(bool _enabled)
+          override;
+
+      // Documentation inherited
+      public: virtual bool TextureStreamingEnabled() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int PendingTextureLoads() const override;
+
+      // Documentation inherited
+      public: virtual void SetMaterialSharingEnabled(bool _enabled)
+          override;
+
+      // Documentation inherited
+      public: virtual bool MaterialSharingEnabled() const override;
+
+      // Documentation inherited
+      public: virtual void SetRenderOrigin(const math::Vector3d &_origin)
+          override;
+
+      // Documentation inherited
+      public: virtual math::Vector3d RenderOrigin() const override;
+
+      // Documentation inherited
+      public: virtual ShaderParamsPtr SharedShaderParams() const override;
+
       // Documentation inherited
       public: virtual void SetActiveGlobalIllumination(
             GlobalIlluminationBasePtr _gi) override;
@@ -111,6 +144,131 @@ namespace gz
       /// GI solution may want to update before rendering
       public: void SetLightsGiDirty();
 
+      /// \internal
+      /// \brief Informs a light was created or destroyed, which may change
+      /// the primary directional light
+      /// \sa PrimaryDirectionalLight
+      public: void SetLightListDirty();
+
+      /// \internal
+      /// \brief Get the first directional light of the scene, e.g. to cast
+      /// the terrain shadows. It is looked up again after lights were
+      /// created or destroyed.
+      /// \return The first directional light, null if there is none
+      public: Ogre2DirectionalLightPtr PrimaryDirectionalLight();
+
+      /// \internal
+      /// \brief Informs a change that requires the Ogre scene graph to be
+      /// updated, e.g. a node moved or a visual was hidden. Sensors rendering
+      /// the same sim time share a single scene graph update as long as
+      /// nothing is marked dirty in between.
+      public: void SetSceneGraphDirty();
+
+      /// \internal
+      /// \brief Get a counter incremented by every SetSceneGraphDirty call.
+      /// Results derived from the scene graph, e.g. bounding boxes, stay
+      /// valid as long as the counter does not change.
+      /// \return Scene graph generation
+      public: uint64_t SceneGraphGeneration() const;
+
+      /// \internal
+      /// \brief Count the items a camera tested for occlusion, reported in
+      /// RenderStats at the end of the frame
+      /// \param[in] _tested Number of items tested
+      /// \param[in] _culled Number of items found occluded
+      public: void RecordOcclusionCulling(uint64_t _tested, uint64_t _culled);
+
+      /// \internal
+      /// \brief Draw the original static visuals instead of the batches
+      /// created by BakeStaticVisuals. Sensors that identify items, e.g.
+      /// segmentation cameras, bypass the batches while they render. Calls
+      /// may be nested, each true must be matched by a false.
+      /// \param[in] _bypassed True to draw the original visuals
+      public: void SetStaticBatchesBypassed(bool _bypassed);
+
+      /// \internal
+      /// \brief Called by materials when they start waiting for a streamed
+      /// texture. See SetTextureStreamingEnabled.
+      public: void TextureLoadStarted();
+
+      /// \internal
+      /// \brief Called by materials when a streamed texture they were
+      /// waiting for is ready or no longer needed.
+      public: void TextureLoadFinished();
+
+      /// \internal
+      /// \brief Called by particle emitters when they create their Ogre
+      /// particle system
+      public: void ParticleSystemCreated();
+
+      /// \internal
+      /// \brief Called by particle emitters when they destroy their Ogre
+      /// particle system
+      public: void ParticleSystemDestroyed();
+
+      /// \internal
+      /// \brief Get whether the scene has particle systems. Sensors use it
+      /// to skip their particle passes without iterating the scene manager.
+      /// \return True if at least one particle emitter exists
+      public: bool HasParticleSystems() const;
+
+      /// \internal
+      /// \brief Get the particle noise parameters shared by the sensors of
+      /// this scene. They are gathered once per frame, on first use.
+      /// \return Particle noise parameters
+      public: Ogre2ParticleNoise *ParticleNoise();
+
+      /// \internal
+      /// \brief Get the shared datablock with the given content key. If
+      /// there is none yet, a copy of _source is added to the pool. The
+      /// reference count of the returned datablock is incremented.
+      /// See SetMaterialSharingEnabled.
+      /// \param[in] _key Key describing the datablock content
+      /// \param[in] _source Datablock to copy if the key is not pooled yet
+      /// \return Shared datablock
+      public: Ogre::HlmsPbsDatablock *AcquireSharedDatablock(
+          const std::string &_key, const Ogre::HlmsPbsDatablock *_source);
+
+      /// \internal
+      /// \brief Release a datablock returned by AcquireSharedDatablock. The
+      /// datablock is destroyed once no material uses it anymore.
+      /// \param[in] _datablock Shared datablock to release
+      public: void ReleaseSharedDatablock(Ogre::HlmsPbsDatablock *_datablock);
+
+      /// \internal
+      /// \brief Bind the built-in uniforms and the shared params of the
+      /// scene to the params of a custom shader. See SharedShaderParams.
+      /// \param[in] _params Params of the custom shader's program
+      public: void BindSharedShaderParams(
+          Ogre::GpuProgramParameters *_params);
+
+      /// \internal
+      /// \brief Get the baked poses of a skeleton animation, shared by all
+      /// the meshes of the scene with the same skeleton definition that
+      /// play the animation instanced. The animation is baked on _skel if
+      /// no mesh holds it yet. See Mesh::SetSkeletonAnimationInstanced.
+      /// \param[in] _skel Skeleton instance of the mesh
+      /// \param[in] _name Name of the animation
+      /// \param[in] _rate Sampling rate in Hz
+      /// \return Baked animation
+      public: std::shared_ptr<Ogre2BakedSkeletonAnimation>
+          AcquireBakedSkeletonAnimation(Ogre::SkeletonInstance *_skel,
+          const std::string &_name, double _rate);
+
+      /// \internal
+      /// \brief Split a per-row CPU loop across the scene manager's worker
+      /// threads and wait for it to finish. Small jobs run inline on the
+      /// calling thread. Must be called from the render thread outside of
+      /// Ogre's scene graph update, e.g. in a sensor's PostRender.
+      /// \param[in] _rows Number of rows to process
+      /// \param[in] _func Function processing rows [_begin, _end)
+      /// \param[in] _minRowsPerThread Minimum number of rows handed to a
+      /// worker thread
+      public: void ParallelForRows(unsigned int _rows,
+          const std::function<void(unsigned int _begin,
+                                   unsigned int _end)> &_func,
+          unsigned int _minRowsPerThread = 16u);
+
       // Documentation inherited.
       public: virtual void SetCameraPassCountPerGpuFlush(
             uint8_t _numPass) override;
@@ -121,6 +279,64 @@ namespace gz
       // Documentation inherited.
       public: virtual bool LegacyAutoGpuFlush() const override;
 
+      // Documentation inherited.
+      // The work of all sensors is submitted to the GPU with a single flush
+      // before any of them reads back its data, regardless of
+      // SetCameraPassCountPerGpuFlush.
+      public: virtual void RenderSensors(
+                  const std::vector<SensorPtr> &_sensors) override;
+
+      // Documentation inherited.
+      // Color cameras are packed into an atlas. Lists that contain other
+      // cameras, e.g. depth cameras, are read back one by one.
+      public: virtual void RenderCameraAtlas(
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) override;
+
+      // Documentation inherited.
+      // The environment of each camera is shown while the camera culls the
+      // scene, so all cameras are still rendered in one batch.
+      public: virtual void RenderEnvironments(
+                  const std::vector<VisualPtr> &_environments,
+                  const std::vector<CameraPtr> &_cameras,
+                  const CameraAtlasCallback &_callback) override;
+
+      // Documentation inherited.
+      // Executes the compositor workspace of every sensor once, which makes
+      // Hlms compile the permutations of all visible datablocks in the
+      // rendering modes (e.g. GORM_SOLID_COLOR) used by each sensor.
+      public: virtual void WarmUpShaders() override;
+
+      // Documentation inherited.
+      // Depth cameras, GPU rays and wide-angle cameras release their
+      // render targets.
+      public: virtual unsigned int ReleaseSensorRenderTextures(
+                  std::chrono::steady_clock::duration _idleTime =
+                  std::chrono::steady_clock::duration::zero()) override;
+
+      // Documentation inherited.
+      // The vertex packing and level of detail generation of the meshes
+      // runs on the scene manager's worker threads, the buffers are then
+      // created and imported to v2 meshes on the calling thread.
+      public: virtual void PreloadMeshes(
+                  const std::vector<MeshDescriptor> &_descs) override;
+
+      // Documentation inherited.
+      public: virtual bool SetLightClustering(
+                  const LightClusterConfig &_config) override;
+
+      // Documentation inherited.
+      public: virtual bool SetShadowSettings(
+                  const ShadowConfig &_config) override;
+
+      // Documentation inherited.
+      // The batches are mesh geometries created from CPU copies of the
+      // baked vertices, one per material and at most 65536 vertices each.
+      public: virtual unsigned int BakeStaticVisuals() override;
+
+      // Documentation inherited.
+      public: virtual void UnbakeStaticVisuals() override;
+
       /// \brief Get a pointer to the ogre scene manager
       /// \return Pointer to the ogre scene manager
       public: virtual Ogre::SceneManager *OgreSceneManager() const;
@@ -191,6 +407,16 @@ namespace gz
       /// call when in LegacyAutoGpuFlush == false
       protected: void EndFrame();
 
+      /// \internal
+      /// \brief Call Ogre::SceneManager::updateSceneGraph unless the scene
+      /// graph was already updated at the current sim time and nothing
+      /// changed since. See SetSceneGraphDirty
+      protected: void UpdateSceneGraph();
+
+      /// \brief Apply the light clustering configuration to the scene
+      /// manager
+      private: void ApplyLightClustering();
+
       /// \internal
       /// \brief Mark shadows dirty to rebuild compostior shadow node
       /// This is set when the number of shadow casting lighst changes
@@ -255,6 +481,10 @@ namespace gz
       protected: virtual WideAngleCameraPtr CreateWideAngleCameraImpl(
                      unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual CameraArrayPtr CreateCameraArrayImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual BoundingBoxCameraPtr CreateBoundingBoxCameraImpl(
                      unsigned int _id, const std::string &_name) override;
@@ -335,6 +565,18 @@ namespace gz
       protected: virtual LidarVisualPtr CreateLidarVisualImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual PointCloudVisualPtr CreatePointCloudVisualImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual OceanVisualPtr CreateOceanVisualImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited
+      protected: virtual VoxelGridVisualPtr CreateVoxelGridVisualImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual WireBoxPtr CreateWireBoxImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -479,6 +721,9 @@ namespace gz
       /// \brief Make the render engine our friend
       private: friend class Ogre2RenderEngine;
 
+      /// \brief Capsules unload the meshes of sizes no longer in use
+      private: friend class Ogre2Capsule;
+
       private: friend class Ogre2SceneExt;
     };
 
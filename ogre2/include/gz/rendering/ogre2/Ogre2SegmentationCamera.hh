@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Event.hh>
@@ -68,12 +69,32 @@ namespace gz
       // Documentation inherited
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       // Documentation inherited
       public: virtual gz::common::ConnectionPtr
         ConnectNewSegmentationFrame(
         std::function<void(const uint8_t *, unsigned int, unsigned int,
         unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited
+      public: virtual std::shared_ptr<const uint8_t> AcquireSegmentationData()
+          const override;
+
+      // Documentation inherited
+      public: virtual gz::common::ConnectionPtr
+        ConnectNewSegmentationInstances(
+          std::function<void(const std::vector<SegmentationInstance> &,
+          unsigned int, unsigned int)> _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::NewFrameViewListener _listener) override;
+
       // Documentation inherited
       public: virtual void Render() override;
 
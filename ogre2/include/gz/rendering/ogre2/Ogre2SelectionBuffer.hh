@@ -17,17 +17,21 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2SELECTIONBUFFER_HH_
 #define GZ_RENDERING_OGRE2_OGRE2SELECTIONBUFFER_HH_
 
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gz/rendering/config.hh"
 #include "gz/rendering/ogre2/Export.hh"
 
 namespace Ogre
 {
+  class CompositorWorkspace;
   class Item;
   class RenderTarget;
   class SceneManager;
+  struct TextureBox;
 }
 
 namespace gz
@@ -75,6 +79,31 @@ namespace gz
       public: bool ExecuteQuery(const int _x, const int _y, Ogre::Item *&_item,
           math::Vector3d &_point);
 
+      /// \brief Get all ogre items visible in a rectangle of the selection
+      /// buffer. The rectangle is rendered once at full resolution.
+      /// \param[in] _x Left edge of the rectangle in pixels
+      /// \param[in] _y Top edge of the rectangle in pixels
+      /// \param[in] _width Width of the rectangle in pixels
+      /// \param[in] _height Height of the rectangle in pixels
+      /// \return Ogre items in the rectangle, without duplicates. Empty if
+      /// the rectangle is not within the selection buffer dimensions.
+      public: std::vector<Ogre::Item *> ExecuteRegionQuery(int _x, int _y,
+          unsigned int _width, unsigned int _height);
+
+      /// \brief Asynchronous version of ExecuteRegionQuery. The rectangle is
+      /// rendered and its download is scheduled right away. The download is
+      /// mapped and decoded when the future is accessed, which only waits
+      /// if the GPU has not finished yet. The future must be accessed from
+      /// the rendering thread and before this selection buffer is
+      /// destroyed.
+      /// \param[in] _x Left edge of the rectangle in pixels
+      /// \param[in] _y Top edge of the rectangle in pixels
+      /// \param[in] _width Width of the rectangle in pixels
+      /// \param[in] _height Height of the rectangle in pixels
+      /// \return Future holding the ogre items in the rectangle
+      public: std::future<std::vector<Ogre::Item *>> ExecuteRegionQueryAsync(
+          int _x, int _y, unsigned int _width, unsigned int _height);
+
       /// \brief Set dimension of the selection buffer
       /// \param[in] _width X dimension in pixels.
       /// \param[in] _height Y dimension in pixels.
@@ -83,6 +112,36 @@ namespace gz
       /// \brief Call this to update the selection buffer contents
       public: void Update();
 
+      /// \brief Point the selection camera at a rectangle of the reference
+      /// camera's image
+      /// \param[in] _x Left edge of the rectangle in pixels
+      /// \param[in] _y Top edge of the rectangle in pixels
+      /// \param[in] _width Width of the rectangle in pixels
+      /// \param[in] _height Height of the rectangle in pixels
+      /// \return False if the rectangle or the camera projection is invalid
+      private: bool SetRegionProjection(int _x, int _y, unsigned int _width,
+          unsigned int _height);
+
+      /// \brief Render a rectangle into the region render texture
+      /// \param[in] _x Left edge of the rectangle in pixels
+      /// \param[in] _y Top edge of the rectangle in pixels
+      /// \param[in] _width Width of the rectangle in pixels
+      /// \param[in] _height Height of the rectangle in pixels
+      /// \return True if the rectangle was rendered
+      private: bool RenderRegion(int _x, int _y, unsigned int _width,
+          unsigned int _height);
+
+      /// \brief Render a selection compositor workspace
+      /// \param[in] _workspace Workspace to render
+      private: void UpdateWorkspace(Ogre::CompositorWorkspace *_workspace);
+
+      /// \brief Get the ogre items of all entity colors in rendered
+      /// selection data
+      /// \param[in] _box Rendered selection data
+      /// \return Ogre items, without duplicates
+      private: std::vector<Ogre::Item *> ItemsInBox(
+          const Ogre::TextureBox &_box) const;
+
       /// \brief Delete the render texture
       private: void DeleteRTTBuffer();
 
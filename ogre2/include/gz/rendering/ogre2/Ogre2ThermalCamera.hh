@@ -52,7 +52,12 @@ namespace gz
     // Forward declaration
     class Ogre2ThermalCameraPrivate;
 
-    /// \brief Thermal camera used to render thermal data into an image buffer
+    /// \brief Thermal camera used to render thermal data into an image buffer.
+    /// The shader writes the final L8 or L16 temperatures, so L16 frames
+    /// are passed to the listeners straight from the downloaded texture.
+    /// Setting the image format to PF_R8G8B8A8 renders a false color
+    /// visualization spanning the min and max temperatures instead, which
+    /// is only delivered through ConnectNewFrameView.
     class GZ_RENDERING_OGRE2_VISIBLE Ogre2ThermalCamera :
       public virtual BaseThermalCamera<Ogre2Sensor>,
       public virtual Ogre2ObjectInterface
@@ -75,6 +80,12 @@ namespace gz
       /// \brief Render the camera
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
       /// \brief Connect to the new thermal image event
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
@@ -82,6 +93,14 @@ namespace gz
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      // Documentation inherited
+      public: virtual std::shared_ptr<const uint16_t> AcquireThermalData()
+          const override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::NewFrameViewListener _listener) override;
+
       /// \brief Implementation of the render call
       public: virtual void Render() override;
 
@@ -61,6 +61,11 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetVisibilityFlags(uint32_t _flags) override;
 
+      // Documentation inherited.
+      // The Ogre objects of the visual carry its compact id in their user
+      // any, see Scene::VisualByCompactId.
+      public: virtual void SetCompactId(uint32_t _id) override;
+
       // Documentation inherited.
       public: virtual gz::math::AxisAlignedBox BoundingBox()
                   const override;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2VOXELGRIDVISUAL_HH_
+#define GZ_RENDERING_OGRE2_OGRE2VOXELGRIDVISUAL_HH_
+
+#include <cstdint>
+#include <memory>
+
+#include "gz/rendering/base/BaseVoxelGridVisual.hh"
+#include "gz/rendering/ogre2/Ogre2Visual.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2VoxelGridVisualPrivate;
+
+    /// \brief Ogre 2.x implementation of a voxel grid visual.
+    ///
+    /// Every block of cells has its own mesh holding the faces between
+    /// rendered and free cells, so blocks outside the view are culled and a
+    /// change only rebuilds the blocks around the changed cells.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2VoxelGridVisual
+      : public BaseVoxelGridVisual<Ogre2Visual>
+    {
+      /// \brief Constructor
+      protected: Ogre2VoxelGridVisual();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2VoxelGridVisual();
+
+      // Documentation inherited.
+      public: virtual void Init() override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      /// \brief Rebuild the meshes of the changed blocks
+      private: void UpdateBlocks();
+
+      /// \brief Destroy the mesh and item of a block
+      /// \param[in] _key Key of the block
+      private: void DestroyBlockMesh(uint64_t _key);
+
+      /// \brief Voxel grid visual should only be created by scene.
+      private: friend class Ogre2Scene;
+
+      /// \brief Private data class
+      private: std::unique_ptr<Ogre2VoxelGridVisualPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
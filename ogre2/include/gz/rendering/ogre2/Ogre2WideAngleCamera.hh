@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/utils/ImplPtr.hh>
 
@@ -56,6 +57,15 @@ namespace gz
       /// \brief Render the camera
       public: virtual void PostRender() override;
 
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
+      // Documentation inherited.
+      public: virtual bool ReleaseRenderTextures() override;
+
+      // Documentation inherited.
+      public: virtual size_t MemoryUsage() const override;
+
       // Documentation inherited
       public: virtual void Destroy() override;
 
@@ -87,6 +97,10 @@ namespace gz
       public: math::Vector3d Project3d(const math::Vector3d &_pt) const
           override;
 
+      // Documentation inherited.
+      public: std::vector<math::Vector3d> Project3d(
+          const std::vector<math::Vector3d> &_pts) const override;
+
       /// \brief It's the same as calling ogreCamera->getCameraToViewportRay
       /// but for the specific _faceIdx.
       /// \param _screenPos Screen space position
@@ -149,11 +163,35 @@ namespace gz
       /// RenderPass::WideAngleCameraAfterStitching == true is odd or even
       protected: uint32_t TempStitchTextureChannel() const;
 
+      /// \brief Returns the MSAA level of the cubemap faces
+      /// \return Value in range [1; 256). 1 means no multisampling, which
+      /// is the case unless the anti-aliasing mode is CAAM_MSAA.
+      protected: uint8_t TargetFSAA() const;
+
       /// \brief Returns the workspace name. It's unique for each camera.
       /// \param[in] _faceIdx Face index in range [0; 6)
       /// \return Workspace definition's name
       protected: std::string WorkspaceDefinitionName(uint32_t _faceIdx) const;
 
+      /// \brief Whether the cubemap faces are rendered directly into the
+      /// cubemap, which is the case when there are no render passes and no
+      /// MSAA. Otherwise each face is rendered into a temp 2D texture and
+      /// copied into the cubemap.
+      /// \return True if the faces are rendered directly
+      protected: bool RendersFacesDirectly() const;
+
+      /// \brief Get the name of the compositor node that renders a face into
+      /// the temp 2D texture
+      /// \param[in] _withMsaa Whether the camera is using MSAA
+      /// \return Node definition's name
+      protected: std::string CubemapPassNodeName(bool _withMsaa) const;
+
+      /// \brief Get the name of the compositor node that renders a face
+      /// directly into the cubemap
+      /// \param[in] _faceIdx Face index in range [0; 6)
+      /// \return Node definition's name
+      protected: std::string CubemapDirectNodeName(uint32_t _faceIdx) const;
+
       /// \brief Creates the workspace definition, including effects.
       /// \param[in] _withMsaa Whether the camera is using MSAA
       protected: void CreateWorkspaceDefinition(bool _withMsaa);
@@ -172,6 +210,10 @@ namespace gz
       /// \brief Set the camera's render target
       protected: void CreateWideAngleTexture() override;
 
+      /// \brief Create the temp 2D textures the faces are rendered into
+      /// when they are not rendered directly into the cubemap
+      protected: void CreateTmpTextures();
+
       /// \brief Create the camera.
       protected: void CreateCamera();
 
@@ -206,6 +248,10 @@ namespace gz
       /// \param[in] _pass Material Pass to setup
       private: void PrepareForFinalPass(Ogre::Pass *_pass);
 
+      /// \brief Get the lens map of the lens and image size, creating it
+      /// if no camera with the same lens holds it yet
+      private: void UpdateLensMap();
+
       /// \cond warning
       /// \brief Private data pointer
       GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Ogre2BakedSkeletonAnimation.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Animation/OgreSkeletonAnimation.h>
+#include <Animation/OgreSkeletonInstance.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2BakedSkeletonAnimation::Ogre2BakedSkeletonAnimation(
+    Ogre::SkeletonInstance *_skel, const std::string &_name, double _rate)
+  : rate(_rate)
+{
+  Ogre::SkeletonAnimation *anim = _skel->getAnimation(_name);
+  this->length = std::max(static_cast<double>(anim->getDuration()), 0.0);
+  this->boneCount = _skel->getNumBones();
+  this->frameCount =
+      static_cast<size_t>(std::ceil(this->length * this->rate)) + 1u;
+
+  // evaluate the animation alone, with animated rather than manual bones
+  auto &animations = _skel->getAnimations();
+  for (auto &other : animations)
+    _skel->getAnimation(other.getName())->setEnabled(false);
+  for (size_t i = 0u; i < this->boneCount; ++i)
+    _skel->setManualBone(_skel->getBone(i), false);
+  anim->setEnabled(true);
+  anim->setLoop(false);
+  anim->mWeight = 1.0f;
+
+  this->positions.reserve(this->frameCount * this->boneCount);
+  this->orientations.reserve(this->frameCount * this->boneCount);
+  this->scales.reserve(this->frameCount * this->boneCount);
+  for (size_t f = 0u; f < this->frameCount; ++f)
+  {
+    anim->setTime(static_cast<Ogre::Real>(
+        std::min(static_cast<double>(f) / this->rate, this->length)));
+    _skel->update();
+    for (size_t i = 0u; i < this->boneCount; ++i)
+    {
+      Ogre::Bone *bone = _skel->getBone(i);
+      this->positions.push_back(bone->getPosition());
+      this->orientations.push_back(bone->getOrientation());
+      this->scales.push_back(bone->getScale());
+    }
+  }
+  anim->setEnabled(false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2BakedSkeletonAnimation::Apply(Ogre::SkeletonInstance *_skel,
+    double _time, bool _loop) const
+{
+  if (this->frameCount == 0u)
+    return;
+
+  double time = _time;
+  if (_loop && this->length > 0.0)
+  {
+    time = std::fmod(time, this->length);
+    if (time < 0.0)
+      time += this->length;
+  }
+  time = std::clamp(time, 0.0, this->length);
+
+  // interpolate between the two samples around the time
+  const double frame = time * this->rate;
+  const size_t first = std::min(static_cast<size_t>(frame),
+      this->frameCount - 1u);
+  const size_t second = std::min(first + 1u, this->frameCount - 1u);
+  const Ogre::Real weight = static_cast<Ogre::Real>(
+      std::clamp(frame - static_cast<double>(first), 0.0, 1.0));
+
+  const size_t count = std::min(this->boneCount,
+      static_cast<size_t>(_skel->getNumBones()));
+  const size_t a = first * this->boneCount;
+  const size_t b = second * this->boneCount;
+  for (size_t i = 0u; i < count; ++i)
+  {
+    Ogre::Bone *bone = _skel->getBone(i);
+    _skel->setManualBone(bone, true);
+    bone->setPosition(this->positions[a + i] +
+        (this->positions[b + i] - this->positions[a + i]) * weight);
+    bone->setOrientation(Ogre::Quaternion::nlerp(weight,
+        this->orientations[a + i], this->orientations[b + i], true));
+    bone->setScale(this->scales[a + i] +
+        (this->scales[b + i] - this->scales[a + i]) * weight);
+  }
+}
+
+//////////////////////////////////////////////////
+double Ogre2BakedSkeletonAnimation::Length() const
+{
+  return this->length;
+}
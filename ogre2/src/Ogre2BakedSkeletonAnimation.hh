@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2BAKEDSKELETONANIMATION_HH_
+#define GZ_RENDERING_OGRE2_OGRE2BAKEDSKELETONANIMATION_HH_
+
+#include <string>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Local bone transforms of a skeleton animation sampled at a fixed
+/// rate. Meshes that play the animation instanced copy the sampled poses
+/// into their bones instead of evaluating the animation tracks, so that
+/// the animation is evaluated once per scene rather than once per mesh.
+/// See Mesh::SetSkeletonAnimationInstanced.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2BakedSkeletonAnimation
+{
+  /// \brief Constructor. Samples the animation on the given skeleton. The
+  /// animations of the skeleton are disabled when the constructor returns.
+  /// \param[in] _skel Skeleton instance to evaluate the animation on
+  /// \param[in] _name Name of the animation
+  /// \param[in] _rate Sampling rate in Hz
+  public: Ogre2BakedSkeletonAnimation(Ogre::SkeletonInstance *_skel,
+              const std::string &_name, double _rate);
+
+  /// \brief Pose a skeleton of the same definition at the given time,
+  /// interpolating between the two nearest samples. The bones are set to
+  /// manual so that they keep the pose.
+  /// \param[in] _skel Skeleton instance to pose
+  /// \param[in] _time Playback time in seconds
+  /// \param[in] _loop True to wrap the time around the animation length,
+  /// false to clamp it
+  public: void Apply(Ogre::SkeletonInstance *_skel, double _time,
+              bool _loop) const;
+
+  /// \brief Get the length of the animation
+  /// \return Length in seconds
+  public: double Length() const;
+
+  /// \brief Sampling rate in Hz
+  private: double rate = 30.0;
+
+  /// \brief Length of the animation in seconds
+  private: double length = 0.0;
+
+  /// \brief Number of bones of the skeleton
+  private: size_t boneCount = 0u;
+
+  /// \brief Number of samples
+  private: size_t frameCount = 0u;
+
+  /// \brief Bone positions, boneCount per sample
+  private: std::vector<Ogre::Vector3> positions;
+
+  /// \brief Bone orientations, boneCount per sample
+  private: std::vector<Ogre::Quaternion> orientations;
+
+  /// \brief Bone scales, boneCount per sample
+  private: std::vector<Ogre::Vector3> scales;
+};
+}
+}
+}
+#endif
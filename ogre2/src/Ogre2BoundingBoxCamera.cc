@@ -14,8 +14,15 @@
  * limitations under the License.
  *
  */
-
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -29,11 +36,13 @@
 #include <gz/common/Console.hh>
 
 #include <gz/math/Color.hh>
+#include <gz/math/Vector2.hh>
 #include <gz/math/Vector4.hh>
 #include <gz/math/eigen3/Util.hh>
 #include <gz/math/Matrix4.hh>
 #include <gz/math/OrientedBox.hh>
 
+#include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/Utils.hh"
 #include "gz/rendering/ogre2/Ogre2BoundingBoxCamera.hh"
@@ -47,6 +56,8 @@
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 
 #include "Ogre2BoundingBoxMaterialSwitcher.hh"
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2StaticBatchBypass.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -66,6 +77,25 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   public: void MeshVertices(const std::vector<uint32_t> &_ogreIds,
               std::vector<math::Vector3d> &_vertices);
 
+  /// \brief Get the local space vertex positions of all submeshes of a
+  /// mesh. Vertices are read back from the GPU the first time a mesh is
+  /// seen and then reused across items and frames. Meshes backed by
+  /// dynamic vertex buffers are read back on every call.
+  /// \param[in] _mesh Mesh to get the vertices of
+  /// \return Vertex positions in the mesh local frame
+  public: const std::vector<Ogre::Vector3> &LocalMeshVertices(
+              const Ogre::MeshPtr &_mesh);
+
+  /// \brief Compute the area covered by the convex hull of projected
+  /// vertices, as an estimate of the unoccluded area of an object.
+  /// \param[in] _points Vertices in screen coordinates, in pixels
+  /// \param[in] _width Image width in pixels
+  /// \param[in] _height Image height in pixels
+  /// \return Area of the hull and area of the hull inside the image
+  public: std::pair<double, double> ProjectedAreas(
+              std::vector<math::Vector2d> _points, uint32_t _width,
+              uint32_t _height) const;
+
   /// \brief Add a line to the viewport. If the line's endpoints are not inside
   /// the viewport, the added line will be a clipped line that fits in the
   /// viewport. If the line to be added doesn't intersect the viewport at all,
@@ -107,6 +137,65 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   private: int LocationRelativeToViewPort(const math::Vector4d &_bounds,
                double _x, double _y) const;
 
+  /// \brief Scan the ogre ids map once and collect the screen space
+  /// extents of every non background ogre id into pixelBoxes.
+  /// Runs of identical pixels are merged so each run costs a single lookup.
+  /// \param[in] _data Raw RGBA8 ogre ids map downloaded from the GPU
+  /// \param[in] _bytesPerRow Number of bytes between two consecutive rows
+  /// \param[in] _width Image width in pixels
+  /// \param[in] _height Image height in pixels
+  /// \param[in] _backgroundLabel Label of pixels that belong to no item
+  public: void ScanOgreIds(const uint8_t *_data, size_t _bytesPerRow,
+              uint32_t _width, uint32_t _height, uint32_t _backgroundLabel);
+
+  /// \brief Convert the ogre ids map into a segmentation image and send
+  /// it to the listeners. Must be called after ScanOgreIds, before the
+  /// ogre id names of the material switcher are cleared.
+  /// \param[in] _data Raw RGBA8 ogre ids map downloaded from the GPU
+  /// \param[in] _bytesPerRow Number of bytes between two consecutive rows
+  /// \param[in] _width Image width in pixels
+  /// \param[in] _height Image height in pixels
+  /// \param[in] _backgroundLabel Label of pixels that belong to no item
+  /// \param[in] _type Segmentation type of the image
+  /// \param[in] _scene Scene whose worker threads convert the rows
+  public: void SegmentationFrame(const uint8_t *_data, size_t _bytesPerRow,
+              uint32_t _width, uint32_t _height, uint32_t _backgroundLabel,
+              SegmentationType _type, Ogre2Scene &_scene);
+
+  /// \brief Screen space extents of one ogre id in the ogre ids map
+  public: struct PixelBox
+  {
+    /// \brief 16 bit ogre id encoded in the map
+    uint32_t ogreId;
+
+    /// \brief Label of the first pixel found for this ogre id
+    uint32_t label;
+
+    /// \brief Minimum x coordinate in pixels
+    uint32_t minX;
+
+    /// \brief Minimum y coordinate in pixels
+    uint32_t minY;
+
+    /// \brief Maximum x coordinate in pixels
+    uint32_t maxX;
+
+    /// \brief Maximum y coordinate in pixels
+    uint32_t maxY;
+
+    /// \brief Number of pixels of this ogre id
+    uint32_t pixelCount;
+  };
+
+  /// \brief Boxes found by the last ScanOgreIds call, in the order their
+  /// first pixel appeared
+  public: std::vector<PixelBox> pixelBoxes;
+
+  /// \brief Index into pixelBoxes for every 16 bit ogre id. Only the entries
+  /// used by the previous frame are reset, so the table is never cleared
+  /// as a whole.
+  public: std::vector<uint32_t> pixelBoxSlots;
+
   /// \brief Material Switcher to switch item's material with ogre Ids
   /// For bounding boxes visibility checking & finding boundaires
   public: std::unique_ptr<Ogre2BoundingBoxMaterialSwitcher> materialSwitcher;
@@ -123,9 +212,6 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   /// \brief Texture to create the render texture from.
   public: Ogre::TextureGpu *ogreRenderTexture {nullptr};
 
-  /// \brief Buffer to store render texture data & to be sent to listeners
-  public: uint8_t *buffer = nullptr;
-
   /// \brief Dummy render texture to set image dims
   public: Ogre2RenderTexturePtr dummyTexture {nullptr};
 
@@ -133,6 +219,21 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   public: common::EventT<void(const std::vector<BoundingBox> &)>
         newBoundingBoxes;
 
+  /// \brief New segmentation frame event, see
+  /// BoundingBoxCamera::ConnectNewSegmentationFrame
+  public: common::EventT<void(const uint8_t *, unsigned int, unsigned int,
+        unsigned int, const std::string &)> newSegmentationFrame;
+
+  /// \brief Segmentation image sent to listeners
+  public: uint8_t *segmentationBuffer {nullptr};
+
+  /// \brief Lease of the segmentation image from the engine buffer pool
+  public: std::shared_ptr<unsigned char> segmentationBufferLease;
+
+  /// \brief Panoptic instance count of every ogre id, indexed like
+  /// pixelBoxSlots
+  public: std::vector<uint16_t> ogreIdInstances;
+
   /// \brief Image / Render Texture Format
   public: Ogre::PixelFormatGpu format = Ogre::PFG_RGBA8_UNORM;
 
@@ -154,6 +255,17 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   /// Key: parent name, value: vector of ogre ids of it's childern
   public: std::map<std::string, std::vector<uint32_t>> parentNameToOgreIds;
 
+  /// \brief Local space vertices of the static meshes seen so far
+  /// Key: ogre mesh resource handle, value: vertex positions
+  public: std::unordered_map<Ogre::ResourceHandle,
+      std::vector<Ogre::Vector3>> meshVertexCache;
+
+  /// \brief Cache size above which entries of unloaded meshes are pruned
+  public: size_t meshVertexCachePruneSize{64u};
+
+  /// \brief Vertices of the last mesh read with dynamic vertex buffers
+  public: std::vector<Ogre::Vector3> dynamicMeshVertices;
+
   /// \brief The ogre item's 3d vertices from the vao(used in multi-link models)
   /// Key: ogre id, value: vector of it's 3d vertices(pointcloud or mesh points)
   public: std::map<uint32_t, std::vector<math::Vector3d>> itemVertices;
@@ -162,6 +274,14 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   /// Key: ogre id, value: ogre item pointer
   public: std::map<uint32_t, Ogre::Item *> ogreIdToItem;
 
+  /// \brief Screen coordinates of the vertices in front of the camera
+  /// projected by the last MeshMinimalBox call
+  public: std::vector<math::Vector2d> projectedVertices;
+
+  /// \brief Projected areas of the full boxes, see ProjectedAreas
+  /// Key: ogre id, value: area of the hull and area inside the image
+  public: std::map<uint32_t, std::pair<double, double>> ogreIdAreas;
+
   /// \brief Output bounding boxes to notify listeners
   public: std::vector<BoundingBox> outputBoxes;
 
@@ -406,12 +526,6 @@ void Ogre2BoundingBoxCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
 
-  if (this->dataPtr->buffer)
-  {
-    delete [] this->dataPtr->buffer;
-    this->dataPtr->buffer = nullptr;
-  }
-
   if (!this->dataPtr->ogreCamera)
     return;
 
@@ -462,9 +576,31 @@ void Ogre2BoundingBoxCamera::Destroy()
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::PreRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
   if (!this->dataPtr->ogreRenderTexture)
     this->CreateBoundingBoxTexture();
 
+  // lens changes, e.g. zooming, only update the frustum, the render
+  // targets are kept
+  const Ogre::Real aspectRatio =
+      static_cast<Ogre::Real>(this->AspectRatio());
+  const Ogre::Radian vfov(static_cast<Ogre::Real>(
+      2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspectRatio)));
+  if (this->dataPtr->ogreCamera->getFOVy() != vfov ||
+      this->dataPtr->ogreCamera->getAspectRatio() != aspectRatio)
+  {
+    this->dataPtr->ogreCamera->setFOVy(vfov);
+    this->dataPtr->ogreCamera->setAspectRatio(aspectRatio);
+  }
+  if (this->dataPtr->ogreCamera->getNearClipDistance() !=
+      static_cast<Ogre::Real>(this->NearClipPlane()) ||
+      this->dataPtr->ogreCamera->getFarClipDistance() !=
+      static_cast<Ogre::Real>(this->FarClipPlane()))
+  {
+    this->dataPtr->ogreCamera->setNearClipDistance(this->NearClipPlane());
+    this->dataPtr->ogreCamera->setFarClipDistance(this->FarClipPlane());
+  }
+
   // todo(iche033) Override BaseCamera::SetProjectionMatrix() function in
   // main / gz-rendering9 instead of checking and setting the custom
   // projection matrix here
@@ -560,6 +696,8 @@ void Ogre2BoundingBoxCamera::CreateBoundingBoxTexture()
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  Ogre2StaticBatchBypass bypass(this->scene);
   if (!this->scene)
   {
     gzerr << "Null scene." << std::endl;
@@ -586,11 +724,31 @@ void Ogre2BoundingBoxCamera::Render()
   this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 }
 
+//////////////////////////////////////////////////
+bool Ogre2BoundingBoxCamera::HasConnections() const
+{
+  return this->dataPtr->newBoundingBoxes.ConnectionCount() > 0u ||
+      this->dataPtr->newSegmentationFrame.ConnectionCount() > 0u ||
+      BaseBoundingBoxCamera::HasConnections();
+}
+
+/////////////////////////////////////////////////
+size_t Ogre2BoundingBoxCamera::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorWorkspace);
+  bytes += Ogre2RenderEngine::TextureSizeBytes(
+      this->dataPtr->ogreRenderTexture);
+  return bytes;
+}
+
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::PostRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
   // return if no one is listening to the new frame
-  if (this->dataPtr->newBoundingBoxes.ConnectionCount() == 0)
+  if (this->dataPtr->newBoundingBoxes.ConnectionCount() == 0 &&
+      this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
     return;
 
   if (!this->dataPtr->ogreRenderTexture)
@@ -602,53 +760,41 @@ void Ogre2BoundingBoxCamera::PostRender()
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
 
-  PixelFormat format = PF_R8G8B8;
-  unsigned int channelCount = PixelUtil::ChannelCount(format);
-  unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
-  // raw gpu texture format is RGBA8
-  unsigned int rawChannelCount = 4u;
-
   Ogre::Image2 image;
   image.convertFromTexture(this->dataPtr->ogreRenderTexture, 0u, 0u);
   Ogre::TextureBox box = image.getData(0);
-  uint8_t *imgBufferTmp = static_cast<uint8_t *>(box.data);
-  if (!this->dataPtr->buffer)
+
+  // extract the box extents straight from the downloaded ids map
+  this->dataPtr->ScanOgreIds(static_cast<const uint8_t *>(box.data),
+      box.bytesPerRow, width, height,
+      this->dataPtr->materialSwitcher->backgroundLabel);
+
+  // the segmentation image comes from the same ids map as the boxes
+  if (this->dataPtr->newSegmentationFrame.ConnectionCount() > 0u)
   {
-    auto bufferSize = PixelUtil::MemorySize(format, width, height);
-    this->dataPtr->buffer = new uint8_t[bufferSize];
+    this->dataPtr->SegmentationFrame(static_cast<const uint8_t *>(box.data),
+        box.bytesPerRow, width, height,
+        this->dataPtr->materialSwitcher->backgroundLabel,
+        this->segmentationType, *this->scene);
   }
 
-  for (unsigned int row = 0; row < height; ++row)
+  if (this->dataPtr->newBoundingBoxes.ConnectionCount() > 0u)
   {
-    // the texture box step size could be larger than our image buffer step
-    // size
-    unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
-    for (unsigned int column = 0; column < width; ++column)
-    {
-      unsigned int idx = (row * width * channelCount) +
-          column * channelCount;
-      unsigned int rawIdx = rawDataRowIdx +
-          column * rawChannelCount;
-
-      this->dataPtr->buffer[idx] = imgBufferTmp[rawIdx];
-      this->dataPtr->buffer[idx + 1] = imgBufferTmp[rawIdx + 1];
-      this->dataPtr->buffer[idx + 2] = imgBufferTmp[rawIdx + 2];
-    }
+    if (this->dataPtr->type == BoundingBoxType::BBT_VISIBLEBOX2D)
+      this->VisibleBoundingBoxes();
+    else if (this->dataPtr->type == BoundingBoxType::BBT_FULLBOX2D)
+      this->FullBoundingBoxes();
+    else if (this->dataPtr->type == BoundingBoxType::BBT_BOX3D)
+      this->BoundingBoxes3D();
   }
 
-  if (this->dataPtr->type == BoundingBoxType::BBT_VISIBLEBOX2D)
-    this->VisibleBoundingBoxes();
-  else if (this->dataPtr->type == BoundingBoxType::BBT_FULLBOX2D)
-    this->FullBoundingBoxes();
-  else if (this->dataPtr->type == BoundingBoxType::BBT_BOX3D)
-    this->BoundingBoxes3D();
-
   this->dataPtr->boundingboxes.clear();
   this->dataPtr->visibleBoxesLabel.clear();
   this->dataPtr->parentNameToBoxes.clear();
   this->dataPtr->parentNameToOgreIds.clear();
   this->dataPtr->itemVertices.clear();
   this->dataPtr->ogreIdToItem.clear();
+  this->dataPtr->ogreIdAreas.clear();
   this->dataPtr->materialSwitcher->ogreIdName.clear();
 
   this->dataPtr->newBoundingBoxes(this->dataPtr->outputBoxes);
@@ -657,36 +803,136 @@ void Ogre2BoundingBoxCamera::PostRender()
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::MarkVisibleBoxes()
 {
-  if (!this->dataPtr->buffer)
+  // mark the ogreIds found in the ogre ids map as visible so their
+  // bboxes are not filtered
+  for (const auto &pixelBox : this->dataPtr->pixelBoxes)
+    this->dataPtr->visibleBoxesLabel[pixelBox.ogreId] = pixelBox.label;
+}
+
+/////////////////////////////////////////////////
+void Ogre2BoundingBoxCameraPrivate::SegmentationFrame(const uint8_t *_data,
+    size_t _bytesPerRow, uint32_t _width, uint32_t _height,
+    uint32_t _backgroundLabel, SegmentationType _type, Ogre2Scene &_scene)
+{
+  const bool panoptic = _type == SegmentationType::ST_PANOPTIC;
+  if (panoptic)
   {
-    gzerr << "Null buffer" << std::endl;
-    return;
+    // pixelBoxes are in the order their first pixel appears, count the top
+    // level models of every label in that order
+    if (this->ogreIdInstances.empty())
+      this->ogreIdInstances.resize(1u << 16u, 0u);
+    std::map<uint32_t, uint16_t> labelInstances;
+    std::map<std::string, uint16_t> modelInstances;
+    for (const auto &pixelBox : this->pixelBoxes)
+    {
+      const std::string &modelName =
+          this->materialSwitcher->ogreIdName[pixelBox.ogreId];
+      auto it = modelInstances.find(modelName);
+      if (it == modelInstances.end())
+      {
+        it = modelInstances.emplace(modelName,
+            ++labelInstances[pixelBox.label]).first;
+      }
+      this->ogreIdInstances[pixelBox.ogreId] = it->second;
+    }
   }
 
-  uint32_t width = this->ImageWidth();
-  uint32_t height = this->ImageHeight();
-  uint32_t channelCount = 3;
+  const uint32_t channelCount = 3u;
+  this->segmentationBuffer = _scene.Engine()->BufferPool().Reserve(
+      this->segmentationBufferLease,
+      static_cast<size_t>(_width) * _height * channelCount);
+
+  uint8_t *buffer = this->segmentationBuffer;
+  const uint16_t *instances = this->ogreIdInstances.data();
+  const uint8_t background = static_cast<uint8_t>(_backgroundLabel);
+  _scene.ParallelForRows(_height,
+      [&](unsigned int _begin, unsigned int _end)
+  {
+    for (unsigned int y = _begin; y < _end; ++y)
+    {
+      const uint8_t *pixel = _data + y * _bytesPerRow;
+      uint8_t *out = buffer + static_cast<size_t>(y) * _width * channelCount;
+      for (uint32_t x = 0; x < _width; ++x, pixel += 4, out += channelCount)
+      {
+        const uint8_t label = pixel[2];
+        if (label == background || !panoptic)
+        {
+          out[0] = label;
+          out[1] = label;
+          out[2] = label;
+          continue;
+        }
+        const uint16_t instance = instances[pixel[1] * 256u + pixel[0]];
+        out[0] = static_cast<uint8_t>(instance % 256u);
+        out[1] = static_cast<uint8_t>(instance / 256u);
+        out[2] = label;
+      }
+    }
+  });
 
-  // Filter bounding boxes by looping over all pixels in ogre ids map
-  for (uint32_t y = 0; y < height; ++y)
+  this->newSegmentationFrame(this->segmentationBuffer, _width, _height,
+      channelCount, PixelUtil::Name(PF_R8G8B8));
+}
+
+/////////////////////////////////////////////////
+void Ogre2BoundingBoxCameraPrivate::ScanOgreIds(const uint8_t *_data,
+    size_t _bytesPerRow, uint32_t _width, uint32_t _height,
+    uint32_t _backgroundLabel)
+{
+  const uint32_t noSlot = std::numeric_limits<uint32_t>::max();
+
+  // the ogre id is encoded in 16 bits so a flat table covers all of them
+  if (this->pixelBoxSlots.empty())
+    this->pixelBoxSlots.resize(1u << 16u, noSlot);
+
+  for (const auto &pixelBox : this->pixelBoxes)
+    this->pixelBoxSlots[pixelBox.ogreId] = noSlot;
+  this->pixelBoxes.clear();
+
+  // raw gpu texture format is RGBA8
+  const uint32_t rawChannelCount = 4u;
+
+  for (uint32_t y = 0; y < _height; ++y)
   {
-    for (uint32_t x = 0; x < width; ++x)
+    // the texture box step size could be larger than the image width
+    const uint8_t *row = _data + y * _bytesPerRow;
+    uint32_t x = 0;
+    while (x < _width)
     {
-      auto index = (y * width + x) * channelCount;
+      const uint8_t *pixel = row + x * rawChannelCount;
+      const uint32_t runStart = x;
 
-      uint32_t label = this->dataPtr->buffer[index + 2];
+      // skip over the pixels that carry the same id and label
+      for (++x; x < _width; ++x)
+      {
+        const uint8_t *next = row + x * rawChannelCount;
+        if (next[0] != pixel[0] || next[1] != pixel[1] || next[2] != pixel[2])
+          break;
+      }
 
-      if (label == this->dataPtr->materialSwitcher->backgroundLabel)
+      uint32_t label = pixel[2];
+      if (label == _backgroundLabel)
         continue;
 
       // get the ogre id encoded in 16 bit value
-      uint32_t ogreId1 = this->dataPtr->buffer[index + 1];
-      uint32_t ogreId2 = this->dataPtr->buffer[index + 0];
-      uint32_t ogreId = ogreId1 * 256 + ogreId2;
+      uint32_t ogreId = pixel[1] * 256u + pixel[0];
+      const uint32_t runEnd = x - 1;
 
-      // mark the ogreId as visible not to filter its bbox
-      if (!this->dataPtr->visibleBoxesLabel.count(ogreId))
-        this->dataPtr->visibleBoxesLabel[ogreId] = label;
+      uint32_t &slot = this->pixelBoxSlots[ogreId];
+      if (slot == noSlot)
+      {
+        // create new boxes when its first pixel appears
+        slot = static_cast<uint32_t>(this->pixelBoxes.size());
+        this->pixelBoxes.push_back(
+            {ogreId, label, runStart, y, runEnd, y, runEnd - runStart + 1});
+        continue;
+      }
+
+      PixelBox &pixelBox = this->pixelBoxes[slot];
+      pixelBox.pixelCount += runEnd - runStart + 1;
+      pixelBox.minX = std::min(pixelBox.minX, runStart);
+      pixelBox.maxX = std::max(pixelBox.maxX, runEnd);
+      pixelBox.maxY = y;
     }
   }
 }
@@ -708,70 +954,204 @@ void Ogre2BoundingBoxCameraPrivate::MeshVertices(
     Ogre::Quaternion oreintation = node->_getDerivedOrientation();
     Ogre::Vector3 scale = node->_getDerivedScale();
 
-    auto subMeshes = mesh->getSubMeshes();
+    for (Ogre::Vector3 vec : this->LocalMeshVertices(mesh))
+    {
+      // Convert to world coordinates
+      vec = (oreintation * (vec * scale)) + position;
+
+      // Convert to camera view coordiantes
+      Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
+      vec4 = viewMatrix * vec4;
+
+      vec.x = vec4.x;
+      vec.y = vec4.y;
+      vec.z = vec4.z;
+
+      // Add the vertex to the vertices of all items that
+      // belongs to the same parent
+      _vertices.push_back(Ogre2Conversions::Convert(vec));
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+std::pair<double, double> Ogre2BoundingBoxCameraPrivate::ProjectedAreas(
+    std::vector<math::Vector2d> _points, uint32_t _width,
+    uint32_t _height) const
+{
+  if (_points.size() < 3u)
+    return {0.0, 0.0};
+
+  // convex hull, using Andrew's monotone chain
+  std::sort(_points.begin(), _points.end(),
+      [](const math::Vector2d &_a, const math::Vector2d &_b)
+      {
+        return _a.X() < _b.X() || (_a.X() == _b.X() && _a.Y() < _b.Y());
+      });
+  auto cross = [](const math::Vector2d &_o, const math::Vector2d &_a,
+      const math::Vector2d &_b)
+  {
+    return (_a.X() - _o.X()) * (_b.Y() - _o.Y()) -
+        (_a.Y() - _o.Y()) * (_b.X() - _o.X());
+  };
+  std::vector<math::Vector2d> hull(_points.size() * 2u);
+  size_t k = 0u;
+  for (size_t i = 0u; i < _points.size(); ++i)
+  {
+    while (k >= 2u && cross(hull[k - 2u], hull[k - 1u], _points[i]) <= 0.0)
+      --k;
+    hull[k++] = _points[i];
+  }
+  for (size_t i = _points.size() - 1u, lower = k + 1u; i > 0u; --i)
+  {
+    while (k >= lower &&
+        cross(hull[k - 2u], hull[k - 1u], _points[i - 1u]) <= 0.0)
+      --k;
+    hull[k++] = _points[i - 1u];
+  }
+  hull.resize(k > 0u ? k - 1u : 0u);
+
+  auto area = [](const std::vector<math::Vector2d> &_polygon)
+  {
+    double sum = 0.0;
+    for (size_t i = 0u; i < _polygon.size(); ++i)
+    {
+      const math::Vector2d &a = _polygon[i];
+      const math::Vector2d &b = _polygon[(i + 1u) % _polygon.size()];
+      sum += a.X() * b.Y() - b.X() * a.Y();
+    }
+    return std::abs(sum) * 0.5;
+  };
+  const double fullArea = area(hull);
+
+  // clip the hull to the image, using Sutherland-Hodgman
+  const math::Vector4d bounds(0.0, 0.0, _width, _height);
+  std::vector<math::Vector2d> clipped;
+  for (int edge = 0; edge < 4 && !hull.empty(); ++edge)
+  {
+    const int axis = edge % 2;
+    const bool isMin = edge < 2;
+    const double limit = bounds[edge];
+    auto inside = [&](const math::Vector2d &_p)
+    {
+      return isMin ? _p[axis] >= limit : _p[axis] <= limit;
+    };
+    clipped.clear();
+    for (size_t i = 0u; i < hull.size(); ++i)
+    {
+      const math::Vector2d &a = hull[i];
+      const math::Vector2d &b = hull[(i + 1u) % hull.size()];
+      if (inside(a))
+        clipped.push_back(a);
+      if (inside(a) != inside(b))
+      {
+        const double t = (limit - a[axis]) / (b[axis] - a[axis]);
+        clipped.push_back(a + (b - a) * t);
+      }
+    }
+    hull.swap(clipped);
+  }
+
+  return {fullArea, area(hull)};
+}
 
-    for (const auto &subMesh : subMeshes)
+/////////////////////////////////////////////////
+const std::vector<Ogre::Vector3> &
+    Ogre2BoundingBoxCameraPrivate::LocalMeshVertices(
+    const Ogre::MeshPtr &_mesh)
+{
+  auto it = this->meshVertexCache.find(_mesh->getHandle());
+  if (it != this->meshVertexCache.end())
+    return it->second;
+
+  std::vector<Ogre::Vector3> vertices;
+  bool dynamic = false;
+
+  for (const auto &subMesh : _mesh->getSubMeshes())
+  {
+    Ogre::VertexArrayObjectArray vaos = subMesh->mVao[0];
+
+    if (vaos.empty())
+      continue;
+
+    // Get the first LOD level
+    Ogre::VertexArrayObject *vao = vaos[0];
+
+    // request async read from buffer
+    Ogre::VertexArrayObject::ReadRequestsArray requests;
+    requests.push_back(Ogre::VertexArrayObject::ReadRequests(
+      Ogre::VES_POSITION));
+    vao->readRequests(requests);
+
+    // contents of dynamic buffers may change between frames, and so may
+    // default buffers with a CPU copy, which Mesh::UpdateVertices rewrites
+    // in place, see MeshDescriptor::dynamic
+    Ogre::VertexBufferPacked *vertexBuffer = requests[0].vertexBuffer;
+    if (vertexBuffer->getBufferType() >= Ogre::BT_DYNAMIC_DEFAULT ||
+        (vertexBuffer->getBufferType() == Ogre::BT_DEFAULT &&
+         vertexBuffer->getShadowCopy()))
     {
-      Ogre::VertexArrayObjectArray vaos = subMesh->mVao[0];
+      dynamic = true;
+    }
+
+    vao->mapAsyncTickets(requests);
 
-      if (!vaos.empty())
+    unsigned int subMeshVerticiesNum =
+      requests[0].vertexBuffer->getNumElements();
+    vertices.reserve(vertices.size() + subMeshVerticiesNum);
+    for (size_t i = 0; i < subMeshVerticiesNum; ++i)
+    {
+      Ogre::Vector3 vec;
+      if (requests[0].type == Ogre::VET_HALF4)
       {
-        // Get the first LOD level
-        Ogre::VertexArrayObject *vao = vaos[0];
-
-        // request async read from buffer
-        Ogre::VertexArrayObject::ReadRequestsArray requests;
-        requests.push_back(Ogre::VertexArrayObject::ReadRequests(
-          Ogre::VES_POSITION));
-        vao->readRequests(requests);
-        vao->mapAsyncTickets(requests);
-
-        unsigned int subMeshVerticiesNum =
-          requests[0].vertexBuffer->getNumElements();
-        for (size_t i = 0; i < subMeshVerticiesNum; ++i)
-        {
-          Ogre::Vector3 vec;
-          if (requests[0].type == Ogre::VET_HALF4)
-          {
-            const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
-              (requests[0].data);
-            vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
-            vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
-            vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
-          }
-          else if (requests[0].type == Ogre::VET_FLOAT3)
-          {
-            const float* vertex =
-              reinterpret_cast<const float*>(requests[0].data);
-            vec.x = *vertex++;
-            vec.y = *vertex++;
-            vec.z = *vertex++;
-          }
-          else
-            gzerr << "Vertex Buffer type error" << std::endl;
-
-          // Convert to world coordinates
-          vec = (oreintation * (vec * scale)) + position;
-
-          // Convert to camera view coordiantes
-          Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
-          vec4 = viewMatrix * vec4;
-
-          vec.x = vec4.x;
-          vec.y = vec4.y;
-          vec.z = vec4.z;
-
-          // Add the vertex to the vertices of all items that
-          // belongs to the same parent
-          _vertices.push_back(Ogre2Conversions::Convert(vec));
-
-          // get the next element
-          requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
-        }
-        vao->unmapAsyncTickets(requests);
+        const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
+          (requests[0].data);
+        vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
+        vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
+        vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
       }
+      else if (requests[0].type == Ogre::VET_FLOAT3)
+      {
+        const float* vertex =
+          reinterpret_cast<const float*>(requests[0].data);
+        vec.x = *vertex++;
+        vec.y = *vertex++;
+        vec.z = *vertex++;
+      }
+      else
+        gzerr << "Vertex Buffer type error" << std::endl;
+
+      vertices.push_back(vec);
+
+      // get the next element
+      requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
+    }
+    vao->unmapAsyncTickets(requests);
+  }
+
+  if (dynamic)
+  {
+    this->dynamicMeshVertices = std::move(vertices);
+    return this->dynamicMeshVertices;
+  }
+
+  // drop the entries of meshes that have been unloaded since
+  if (this->meshVertexCache.size() >= this->meshVertexCachePruneSize)
+  {
+    auto &meshManager = Ogre::MeshManager::getSingleton();
+    for (auto cached = this->meshVertexCache.begin();
+         cached != this->meshVertexCache.end();)
+    {
+      if (!meshManager.getByHandle(cached->first))
+        cached = this->meshVertexCache.erase(cached);
+      else
+        ++cached;
     }
+    this->meshVertexCachePruneSize =
+        std::max<size_t>(64u, this->meshVertexCache.size() * 2u);
   }
+
+  return this->meshVertexCache[_mesh->getHandle()] = std::move(vertices);
 }
 
 /////////////////////////////////////////////////
@@ -814,6 +1194,10 @@ void Ogre2BoundingBoxCamera::MergeMultiLinksModels3D()
       box.SetOrientation(pose.Rot());
       box.SetSize(mergedBox.Size());
       box.SetLabel(this->dataPtr->visibleBoxesLabel[ogreIds[0]]);
+      uint32_t pixelCount = 0u;
+      for (auto ogreId : ogreIds)
+        pixelCount += this->dataPtr->boundingboxes[ogreId]->VisiblePixelCount();
+      box.SetVisiblePixelCount(pixelCount);
 
       this->dataPtr->outputBoxes.push_back(box);
     }
@@ -835,11 +1219,35 @@ void Ogre2BoundingBoxCamera::MergeMultiLinksModels2D()
     this->dataPtr->parentNameToBoxes[parentName].push_back(box.second);
   }
 
+  // Sum the projected areas of the boxes that have one
+  std::map<std::string, std::pair<double, double>> parentNameToAreas;
+  for (const auto &areas : this->dataPtr->ogreIdAreas)
+  {
+    auto &parentAreas = parentNameToAreas[
+        this->dataPtr->materialSwitcher->ogreIdName[areas.first]];
+    parentAreas.first += areas.second.first;
+    parentAreas.second += areas.second.second;
+  }
+
   // Merge the boxes that is related to the same parent
   for (const auto &nameToBoxes : this->dataPtr->parentNameToBoxes)
   {
     auto mergedBox = this->dataPtr->MergeBoxes2D(nameToBoxes.second);
 
+    auto areas = parentNameToAreas.find(nameToBoxes.first);
+    if (areas != parentNameToAreas.end() && areas->second.second > 0.0)
+    {
+      // overlapping links are counted more than once, so the ratios are
+      // clamped
+      const double fullArea = areas->second.first;
+      const double imageArea = areas->second.second;
+      mergedBox.SetProjectedArea(imageArea);
+      mergedBox.SetTruncation(
+          std::clamp(1.0 - imageArea / fullArea, 0.0, 1.0));
+      mergedBox.SetOcclusion(std::clamp(
+          1.0 - mergedBox.VisiblePixelCount() / imageArea, 0.0, 1.0));
+    }
+
     // Store boxes in the output vector
     this->dataPtr->outputBoxes.push_back(mergedBox);
   }
@@ -881,6 +1289,11 @@ BoundingBox Ogre2BoundingBoxCameraPrivate::MergeBoxes2D(
   mergedBox.SetCenter({minX + width * 0.5, minY + height * 0.5, 0});
   mergedBox.SetLabel(_boxes[0]->Label());
 
+  uint32_t pixelCount = 0u;
+  for (const auto &box : _boxes)
+    pixelCount += box->VisiblePixelCount();
+  mergedBox.SetVisiblePixelCount(pixelCount);
+
   return mergedBox;
 }
 
@@ -951,6 +1364,8 @@ void Ogre2BoundingBoxCamera::BoundingBoxes3D()
     // Body to camera rotation = body_world * world_camera
     auto bodyCameraRotation = worldCameraRotation * bodyWorldRotation;
     box->SetOrientation(bodyCameraRotation);
+    box->SetVisiblePixelCount(this->dataPtr->pixelBoxes[
+        this->dataPtr->pixelBoxSlots[ogreId]].pixelCount);
 
     this->dataPtr->boundingboxes[ogreId] = box;
     itor.moveNext();
@@ -972,85 +1387,21 @@ void Ogre2BoundingBoxCamera::BoundingBoxes3D()
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::VisibleBoundingBoxes()
 {
-  if (!this->dataPtr->buffer)
+  for (const auto &pixelBox : this->dataPtr->pixelBoxes)
   {
-    gzerr << "Null buffer" << std::endl;
-    return;
-  }
-
-  uint32_t width = this->ImageWidth();
-  uint32_t height = this->ImageHeight();
-  uint32_t channelCount = 3;
-
-  struct BoxBoundary
-  {
-    uint32_t minX;
-    uint32_t minY;
-    uint32_t maxX;
-    uint32_t maxY;
-  };
-
-  std::unordered_map<uint32_t, std::shared_ptr<BoxBoundary>> boxesBoundary;
-
-  // find item's boundaries from panoptic BoundingBox
-  for (uint32_t y = 0; y < height; y++)
-  {
-    for (uint32_t x = 0; x < width; x++)
-    {
-      auto index = (y * width + x) * channelCount;
-
-      uint32_t label = this->dataPtr->buffer[index + 2];
-      uint32_t ogreId1 = this->dataPtr->buffer[index + 1];
-      uint32_t ogreId2 = this->dataPtr->buffer[index + 0];
-
-      if (label != this->dataPtr->materialSwitcher->backgroundLabel)
-      {
-        // get the OGRE id of 16 bit value
-        uint32_t ogreId = ogreId1 * 256 + ogreId2;
-
-        std::shared_ptr<BoundingBox> box;
-        std::shared_ptr<BoxBoundary> boundary;
-
-        // create new boxes when its first pixel appears
-        if (!this->dataPtr->boundingboxes.count(ogreId))
-        {
-          box = std::make_shared<BoundingBox>();
-          box->SetLabel(label);
-
-          boundary = std::make_shared<BoxBoundary>();
-          boundary->minX = width;
-          boundary->minY = height;
-          boundary->maxX = 0;
-          boundary->maxY = 0;
-
-          boxesBoundary[ogreId] = boundary;
-          this->dataPtr->boundingboxes[ogreId] = box;
-        }
-        else
-        {
-          boundary = boxesBoundary[ogreId];
-        }
-
-        boundary->minX = std::min<uint32_t>(boundary->minX, x);
-        boundary->minY = std::min<uint32_t>(boundary->minY, y);
-        boundary->maxX = std::max<uint32_t>(boundary->maxX, x);
-        boundary->maxY = std::max<uint32_t>(boundary->maxY, y);
-      }
-    }
-  }
+    auto box = std::make_shared<BoundingBox>();
+    box->SetLabel(pixelBox.label);
+    box->SetVisiblePixelCount(pixelBox.pixelCount);
 
-  for (const auto &box : this->dataPtr->boundingboxes)
-  {
-    // Get the box's boundary
-    auto ogreId = box.first;
-    auto boundary = boxesBoundary[ogreId];
-    auto boxWidth = boundary->maxX - boundary->minX;
-    auto boxHeight = boundary->maxY - boundary->minY;
+    auto boxWidth = pixelBox.maxX - pixelBox.minX;
+    auto boxHeight = pixelBox.maxY - pixelBox.minY;
 
-    box.second->SetCenter({boundary->minX + boxWidth * 0.5,
-        boundary->minY + boxHeight * 0.5, 0});
-    box.second->SetSize(
+    box->SetCenter({pixelBox.minX + boxWidth * 0.5,
+        pixelBox.minY + boxHeight * 0.5, 0});
+    box->SetSize(
         {static_cast<double>(boxWidth), static_cast<double>(boxHeight), 0.0});
+
+    this->dataPtr->boundingboxes[pixelBox.ogreId] = box;
   }
 
   // Combine boxes of multi-links model if exists
@@ -1125,12 +1476,18 @@ void Ogre2BoundingBoxCamera::FullBoundingBoxes()
 
     this->ConvertToScreenCoord(minVertex, maxVertex);
 
+    this->dataPtr->ogreIdAreas[ogreId] = this->dataPtr->ProjectedAreas(
+        std::move(this->dataPtr->projectedVertices), this->ImageWidth(),
+        this->ImageHeight());
+
     auto box = std::make_shared<BoundingBox>();
     auto boxWidth = maxVertex.x - minVertex.x;
     auto boxHeight = minVertex.y - maxVertex.y;
     box->SetCenter(
         {minVertex.x + boxWidth / 2, maxVertex.y + boxHeight / 2, 0});
     box->SetSize({boxWidth, boxHeight, 0});
+    box->SetVisiblePixelCount(this->dataPtr->pixelBoxes[
+        this->dataPtr->pixelBoxSlots[ogreId]].pixelCount);
 
     this->dataPtr->boundingboxes[ogreId] = box;
 
@@ -1169,71 +1526,37 @@ void Ogre2BoundingBoxCamera::MeshMinimalBox(
   _maxVertex.y = -std::numeric_limits<float>::max();
   _maxVertex.z = -std::numeric_limits<float>::max();
 
-  auto subMeshes = _mesh->getSubMeshes();
+  const double width = this->ImageWidth();
+  const double height = this->ImageHeight();
+  this->dataPtr->projectedVertices.clear();
 
-  for (auto subMesh : subMeshes)
+  for (Ogre::Vector3 vec : this->dataPtr->LocalMeshVertices(_mesh))
   {
-    Ogre::VertexArrayObjectArray vaos = subMesh->mVao[0];
-
-    if (!vaos.empty())
-    {
-      // Get the first LOD level
-      Ogre::VertexArrayObject *vao = vaos[0];
-
-      // request async read from buffer
-      Ogre::VertexArrayObject::ReadRequestsArray requests;
-      requests.push_back(Ogre::VertexArrayObject::ReadRequests(
-        Ogre::VES_POSITION));
-      vao->readRequests(requests);
-      vao->mapAsyncTickets(requests);
-
-      unsigned int subMeshVerticiesNum =
-        requests[0].vertexBuffer->getNumElements();
-      for (size_t i = 0; i < subMeshVerticiesNum; ++i)
-      {
-        Ogre::Vector3 vec;
-        if (requests[0].type == Ogre::VET_HALF4)
-        {
-          const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
-            (requests[0].data);
-          vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
-          vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
-          vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
-        }
-        else if (requests[0].type == Ogre::VET_FLOAT3)
-        {
-          const float* vertex =
-            reinterpret_cast<const float*>(requests[0].data);
-          vec.x = *vertex++;
-          vec.y = *vertex++;
-          vec.z = *vertex++;
-        }
-        else
-          gzerr << "Vertex Buffer type error" << std::endl;
+    vec = (_orientation * (vec * _scale)) + _position;
 
-        vec = (_orientation * (vec * _scale)) + _position;
+    Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
+    vec4 =  _projMatrix * _viewMatrix * vec4;
 
-        Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
-        vec4 =  _projMatrix * _viewMatrix * vec4;
-
-        // homogenous
-        vec.x = vec4.x / vec4.w;
-        vec.y = vec4.y / vec4.w;
-        vec.z = vec4.z;
+    // screen coordinates are only meaningful in front of the camera
+    if (vec4.w > 0)
+    {
+      this->dataPtr->projectedVertices.emplace_back(
+          (vec4.x / vec4.w + 1.0) * 0.5 * width,
+          (1.0 - vec4.y / vec4.w) * 0.5 * height);
+    }
 
-        _minVertex.x = std::min(_minVertex.x, vec.x);
-        _minVertex.y = std::min(_minVertex.y, vec.y);
-        _minVertex.z = std::min(_minVertex.z, vec.z);
+    // homogenous
+    vec.x = vec4.x / vec4.w;
+    vec.y = vec4.y / vec4.w;
+    vec.z = vec4.z;
 
-        _maxVertex.x = std::max(_maxVertex.x, vec.x);
-        _maxVertex.y = std::max(_maxVertex.y, vec.y);
-        _maxVertex.z = std::max(_maxVertex.z, vec.z);
+    _minVertex.x = std::min(_minVertex.x, vec.x);
+    _minVertex.y = std::min(_minVertex.y, vec.y);
+    _minVertex.z = std::min(_minVertex.z, vec.z);
 
-        // get the next element
-        requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
-      }
-      vao->unmapAsyncTickets(requests);
-    }
+    _maxVertex.x = std::max(_maxVertex.x, vec.x);
+    _maxVertex.y = std::max(_maxVertex.y, vec.y);
+    _maxVertex.z = std::max(_maxVertex.z, vec.z);
   }
 }
 
@@ -1511,6 +1834,8 @@ void Ogre2BoundingBoxCamera::ConvertToScreenCoord(
 /////////////////////////////////////////////////
 const std::vector<BoundingBox> &Ogre2BoundingBoxCamera::BoundingBoxData() const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   return this->dataPtr->outputBoxes;
 }
 
@@ -1522,6 +1847,15 @@ common::ConnectionPtr
   return this->dataPtr->newBoundingBoxes.Connect(_subscriber);
 }
 
+/////////////////////////////////////////////////
+gz::common::ConnectionPtr
+  Ogre2BoundingBoxCamera::ConnectNewSegmentationFrame(
+  std::function<void(const uint8_t *, unsigned int, unsigned int,
+  unsigned int, const std::string &)> _subscriber)
+{
+  return this->dataPtr->newSegmentationFrame.Connect(_subscriber);
+}
+
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::CreateRenderTexture()
 {
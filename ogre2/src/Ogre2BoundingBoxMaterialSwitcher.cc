@@ -104,7 +104,8 @@ void Ogre2BoundingBoxMaterialSwitcher::cameraPreRenderScene(
       VisualPtr visual;
       try
       {
-        visual = this->scene->VisualById(Ogre::any_cast<unsigned int>(userAny));
+        visual = this->scene->VisualByCompactId(
+            Ogre::any_cast<unsigned int>(userAny));
       }
       catch(Ogre::Exception &e)
       {
@@ -114,18 +115,10 @@ void Ogre2BoundingBoxMaterialSwitcher::cameraPreRenderScene(
         visual);
 
       // get class user data
-      Variant labelAny = ogreVisual->UserData(this->labelKey);
-
-      int label = this->backgroundLabel;
-      try
-      {
-        label = std::get<int>(labelAny);
-      }
-      catch(std::bad_variant_access &e)
-      {
-        // items with no class are considered background
-        label = this->backgroundLabel;
-      }
+      // items with no class are considered background
+      const int *labelValue = ogreVisual->UserDataAs<int>(this->labelKey);
+      int label = labelValue ? *labelValue :
+          static_cast<int>(this->backgroundLabel);
 
       // for full bbox, each pixel contains 1 channel for label
       // and 2 channels stores ogreId
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "gz/rendering/config.hh"
+#include "gz/rendering/UserDataKey.hh"
 #include "gz/rendering/ogre2/Export.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "gz/rendering/ogre2/Ogre2BoundingBoxCamera.hh"
@@ -73,7 +74,7 @@ class Ogre2BoundingBoxMaterialSwitcher : public Ogre::Camera::Listener
   private: Ogre::MaterialPtr plainOverlayMaterial;
 
   /// \brief User Data Key to set the label
-  private: const std::string labelKey = "label";
+  private: const UserDataKey labelKey{"label"};
 
   /// \brief Label for background pixels in the ogre Ids map
   private: uint32_t backgroundLabel {255};
@@ -86,6 +87,7 @@ class Ogre2BoundingBoxMaterialSwitcher : public Ogre::Camera::Listener
   private: Ogre2ScenePtr scene;
 
   friend class Ogre2BoundingBoxCamera;
+  friend class Ogre2BoundingBoxCameraPrivate;
 };
 }
 }  // namespace rendering
@@ -104,6 +104,7 @@ void Ogre2COMVisual::CreateVisual()
     this->dataPtr->crossLines.reset(
         new Ogre2DynamicRenderable(this->Scene()));
     this->ogreNode->attachObject(this->dataPtr->crossLines->OgreObject());
+    this->scene->SetSceneGraphDirty();
   }
 
   if (!this->dataPtr->sphereVis)
@@ -171,6 +172,7 @@ void Ogre2COMVisual::CreateVisual()
 
   this->dataPtr->crossLines->Update();
   this->ogreNode->setVisible(true);
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
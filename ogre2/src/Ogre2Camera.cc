@@ -15,6 +15,12 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <set>
+#include <vector>
+
 #include "gz/rendering/ogre2/Ogre2Camera.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTarget.hh"
@@ -22,19 +28,110 @@
 #include "gz/rendering/ogre2/Ogre2SelectionBuffer.hh"
 #include "gz/rendering/Utils.hh"
 
+#include "Ogre2SensorTimer.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
+#include <OgreAsyncTextureTicket.h>
 #include <OgreCamera.h>
 #include <OgreItem.h>
+#include <OgrePixelFormatGpuUtils.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <OgreTextureGpuManager.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
 
+/// \brief Staging buffer a frame is downloaded into by CaptureAsync
+struct Ogre2CaptureTicket
+{
+  /// \brief Ticket the frame is downloaded into, null once the camera
+  /// destroyed it
+  Ogre::AsyncTextureTicket *ticket = nullptr;
+};
+
 /// \brief Private data for the Ogre2Camera class
 class gz::rendering::Ogre2CameraPrivate
 {
+  /// \brief Destroy all capture tickets. Pending captures then report
+  /// failure.
+  public: void DestroyCaptureTickets()
+  {
+    if (this->captureTickets.empty())
+      return;
+
+    Ogre::TextureGpuManager *textureMgr =
+        Ogre::Root::getSingleton().getRenderSystem()->getTextureGpuManager();
+    for (auto &entry : this->captureTickets)
+    {
+      textureMgr->destroyAsyncTextureTicket(entry->ticket);
+      entry->ticket = nullptr;
+    }
+    this->captureTickets.clear();
+  }
+
+  /// \brief Adjust the dynamic resolution scale from the duration of the
+  /// last frame. The CPU time of Render is used as a measure of the GPU
+  /// frame time since it includes waiting for the GPU once the frames in
+  /// flight are used up.
+  /// \param[in] _frameTime Duration of the last Render call
+  /// \param[in] _target Render target the scene is rendered to
+  public: void UpdateDynamicResolution(
+      std::chrono::steady_clock::duration _frameTime,
+      Ogre2RenderTarget *_target)
+  {
+    const double frameTime =
+        std::chrono::duration<double>(_frameTime).count();
+    if (this->frameSamples == 0u)
+      this->smoothedFrameTime = frameTime;
+    else
+      this->smoothedFrameTime = 0.9 * this->smoothedFrameTime +
+          0.1 * frameTime;
+    if (++this->frameSamples < 30u || this->smoothedFrameTime <= 0.0)
+      return;
+
+    // only react outside of a dead band to avoid oscillating
+    const double target =
+        std::chrono::duration<double>(this->dynamicTarget).count();
+    const double ratio = target / this->smoothedFrameTime;
+    if (ratio > 0.95 && ratio < 1.25)
+      return;
+
+    // the frame time is proportional to the pixel count, i.e. to the
+    // square of the scale. Use coarse, bounded steps since every change
+    // rebuilds the render target.
+    double scale = this->dynamicScale *
+        std::clamp(std::sqrt(ratio), 0.75, 1.25);
+    scale = std::clamp(std::round(scale * 16.0) / 16.0,
+        this->dynamicMinScale, 1.0);
+    if (std::abs(scale - this->dynamicScale) < 1e-6)
+      return;
+    this->dynamicScale = scale;
+    _target->SetRenderScale(scale);
+    // measurements taken at the old scale no longer apply
+    this->frameSamples = 0u;
+  }
+
+  /// \brief Ring of staging buffers used by CaptureAsync. A ticket is in
+  /// flight while a pending future holds a reference to it.
+  public: std::vector<std::shared_ptr<Ogre2CaptureTicket>> captureTickets;
+
+  /// \brief Frame time dynamic resolution aims for, zero if disabled
+  public: std::chrono::steady_clock::duration dynamicTarget{0};
+
+  /// \brief Smallest dynamic resolution scale
+  public: double dynamicMinScale = 0.5;
+
+  /// \brief Current dynamic resolution scale
+  public: double dynamicScale = 1.0;
+
+  /// \brief Exponential moving average of the frame time in seconds
+  public: double smoothedFrameTime = 0.0;
+
+  /// \brief Number of frames measured at the current scale
+  public: unsigned int frameSamples = 0u;
 };
 
 using namespace gz;
@@ -59,6 +156,7 @@ void Ogre2Camera::Destroy()
     return;
 
   this->RemoveAllRenderPasses();
+  this->dataPtr->DestroyCaptureTickets();
   this->DestroyRenderTexture();
 
   Ogre::SceneManager *ogreSceneManager;
@@ -121,6 +219,13 @@ void Ogre2Camera::SetAntiAliasing(const unsigned int _aa)
   this->renderTexture->SetAntiAliasing(_aa);
 }
 
+//////////////////////////////////////////////////
+void Ogre2Camera::SetAntiAliasingMode(CameraAntiAliasingMode _mode)
+{
+  BaseCamera::SetAntiAliasingMode(_mode);
+  this->renderTexture->SetAntiAliasingMode(_mode);
+}
+
 //////////////////////////////////////////////////
 math::Color Ogre2Camera::BackgroundColor() const
 {
@@ -151,10 +256,199 @@ void Ogre2Camera::SetMaterial(const MaterialPtr &_material)
   this->renderTexture->SetMaterial(_material);
 }
 
+//////////////////////////////////////////////////
+void Ogre2Camera::PreRender()
+{
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
+  BaseCamera::PreRender();
+}
+
 //////////////////////////////////////////////////
 void Ogre2Camera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
+  const auto start = std::chrono::steady_clock::now();
   this->renderTexture->Render();
+  if (this->dataPtr->dynamicTarget >
+      std::chrono::steady_clock::duration::zero())
+  {
+    this->dataPtr->UpdateDynamicResolution(
+        std::chrono::steady_clock::now() - start, this->renderTexture.get());
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Camera::SetDynamicResolution(
+    std::chrono::steady_clock::duration _targetFrameTime, double _minScale)
+{
+  if (!(_minScale > 0.0 && _minScale <= 1.0))
+  {
+    gzerr << "Invalid minimum dynamic resolution scale [" << _minScale
+          << "], must be in (0, 1]" << std::endl;
+    return;
+  }
+  this->dataPtr->dynamicTarget =
+      std::max(_targetFrameTime, std::chrono::steady_clock::duration::zero());
+  this->dataPtr->dynamicMinScale = _minScale;
+  this->dataPtr->frameSamples = 0u;
+
+  double scale = this->dataPtr->dynamicScale;
+  if (this->dataPtr->dynamicTarget ==
+      std::chrono::steady_clock::duration::zero())
+  {
+    scale = 1.0;
+  }
+  scale = std::max(scale, _minScale);
+  if (std::abs(scale - this->dataPtr->dynamicScale) > 1e-6)
+  {
+    this->dataPtr->dynamicScale = scale;
+    this->renderTexture->SetRenderScale(scale);
+  }
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration Ogre2Camera::DynamicResolutionTarget()
+    const
+{
+  return this->dataPtr->dynamicTarget;
+}
+
+//////////////////////////////////////////////////
+double Ogre2Camera::DynamicResolutionScale() const
+{
+  return this->dataPtr->dynamicScale;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Camera::SetResizeDelay(std::chrono::steady_clock::duration _delay)
+{
+  this->renderTexture->SetResizeDelay(_delay);
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration Ogre2Camera::ResizeDelay() const
+{
+  return this->renderTexture->ResizeDelay();
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2Camera::MemoryUsage() const
+{
+  return this->renderTexture ? this->renderTexture->MemoryUsage() : 0u;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Camera::PostRender()
+{
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
+  BaseCamera::PostRender();
+}
+
+//////////////////////////////////////////////////
+std::future<bool> Ogre2Camera::CaptureAsync(Image &_image)
+{
+  this->RequestCapture();
+  this->Update();
+
+  // only download the readback region if there is one
+  Ogre::TextureGpu *texture = this->renderTexture->RenderTarget();
+  Ogre::TextureBox srcBox = texture->getEmptyBox(0u);
+  if (this->readbackSize.X() > 0)
+  {
+    srcBox.x = static_cast<uint32_t>(this->readbackOffset.X());
+    srcBox.y = static_cast<uint32_t>(this->readbackOffset.Y());
+    srcBox.width = static_cast<uint32_t>(this->readbackSize.X());
+    srcBox.height = static_cast<uint32_t>(this->readbackSize.Y());
+  }
+
+  // Bayer conversions and render windows are not staged, copy them right
+  // away
+  PixelFormat format = _image.Format();
+  if (this->renderTexture->IsRenderWindow() ||
+      _image.Width() != srcBox.width || _image.Height() != srcBox.height ||
+      srcBox.x + srcBox.width > texture->getWidth() ||
+      srcBox.y + srcBox.height > texture->getHeight() ||
+      format == PF_BAYER_RGGB8 || format == PF_BAYER_BGGR8 ||
+      format == PF_BAYER_GBRG8 || format == PF_BAYER_GRBG8)
+  {
+    std::promise<bool> result;
+    this->Copy(_image);
+    this->ClearCaptureRequest();
+    result.set_value(true);
+    return result.get_future();
+  }
+
+  // reuse a ticket that is not in flight, dropping the ones that no longer
+  // match the readback region, or add a new one to the ring
+  std::shared_ptr<Ogre2CaptureTicket> entry;
+  Ogre::TextureGpuManager *textureMgr =
+      Ogre::Root::getSingleton().getRenderSystem()->getTextureGpuManager();
+  auto &tickets = this->dataPtr->captureTickets;
+  for (auto it = tickets.begin(); it != tickets.end();)
+  {
+    if (it->use_count() > 1)
+    {
+      ++it;
+      continue;
+    }
+    Ogre::AsyncTextureTicket *ticket = (*it)->ticket;
+    if (ticket->getWidth() != srcBox.width ||
+        ticket->getHeight() != srcBox.height ||
+        ticket->getPixelFormatFamily() !=
+        Ogre::PixelFormatGpuUtils::getFamily(texture->getPixelFormat()))
+    {
+      textureMgr->destroyAsyncTextureTicket(ticket);
+      it = tickets.erase(it);
+      continue;
+    }
+    if (!entry)
+      entry = *it;
+    ++it;
+  }
+  if (!entry)
+  {
+    entry = std::make_shared<Ogre2CaptureTicket>();
+    entry->ticket = textureMgr->createAsyncTextureTicket(
+        srcBox.width, srcBox.height,
+        texture->getDepthOrSlices(), texture->getTextureType(),
+        texture->getPixelFormat());
+    tickets.push_back(entry);
+  }
+  entry->ticket->download(texture, 0u, false, &srcBox);
+
+  // Formats are identical except for sRGB-ness, force a raw copy like
+  // Ogre2RenderTarget::Copy
+  Ogre::PixelFormatGpu srcOgrePf = texture->getPixelFormat();
+  Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
+  if (Ogre::PixelFormatGpuUtils::isSRgb(srcOgrePf))
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentSRGB(dstOgrePf);
+  else
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentLinear(dstOgrePf);
+
+  Image *image = &_image;
+  return std::async(std::launch::deferred,
+      [entry, image, srcOgrePf, dstOgrePf]()
+      {
+        Ogre::AsyncTextureTicket *ticket = entry->ticket;
+        if (!ticket)
+          return false;
+
+        const uint32_t width = ticket->getWidth();
+        const uint32_t height = ticket->getHeight();
+        Ogre::TextureBox dstBox(width, height, 1u, 1u,
+          static_cast<uint32_t>(
+            Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+          image->RowStride(), image->RowStride() * height);
+        dstBox.data = image->Data();
+
+        // mapping waits for the download if it did not finish yet
+        Ogre::TextureBox srcBox = ticket->map(0u);
+        Ogre::PixelFormatGpuUtils::bulkPixelConversion(
+            srcBox, srcOgrePf, dstBox, dstOgrePf);
+        ticket->unmap();
+        return true;
+      });
 }
 
 //////////////////////////////////////////////////
@@ -215,6 +509,8 @@ void Ogre2Camera::CreateRenderTexture()
   this->renderTexture->SetHeight(this->ImageHeight());
   this->renderTexture->SetBackgroundColor(this->scene->BackgroundColor());
   this->renderTexture->SetVisibilityMask(this->visibilityMask);
+  this->renderTexture->SetQualityProfile(this->qualityProfile);
+  this->renderTexture->SetAntiAliasingMode(this->antiAliasingMode);
 }
 
 //////////////////////////////////////////////////
@@ -332,7 +628,8 @@ VisualPtr Ogre2Camera::VisualAt(const math::Vector2i &_mousePos)
     {
       try
       {
-        result = this->scene->VisualById(Ogre::any_cast<unsigned int>(
+        result = this->scene->VisualByCompactId(
+            Ogre::any_cast<unsigned int>(
               ogreItem->getUserObjectBindings().getUserAny()));
       }
       catch(Ogre::Exception &e)
@@ -345,6 +642,110 @@ VisualPtr Ogre2Camera::VisualAt(const math::Vector2i &_mousePos)
   return result;
 }
 
+//////////////////////////////////////////////////
+bool Ogre2Camera::SelectionRegion(const math::Vector2i &_min,
+    const math::Vector2i &_max, int &_x, int &_y,
+    unsigned int &_width, unsigned int &_height)
+{
+  if (!this->selectionBuffer)
+  {
+    this->SetSelectionBuffer();
+
+    if (!this->selectionBuffer)
+      return false;
+  }
+  else
+  {
+    this->selectionBuffer->SetDimensions(
+      this->ImageWidth(), this->ImageHeight());
+  }
+
+  // convert to image pixels and clip to the image
+  float ratio = screenScalingFactor();
+  int x0 = std::max(static_cast<int>(std::rint(ratio * _min.X())), 0);
+  int y0 = std::max(static_cast<int>(std::rint(ratio * _min.Y())), 0);
+  int x1 = std::min(static_cast<int>(std::rint(ratio * _max.X())),
+      static_cast<int>(this->ImageWidth()));
+  int y1 = std::min(static_cast<int>(std::rint(ratio * _max.Y())),
+      static_cast<int>(this->ImageHeight()));
+  if (x1 <= x0 || y1 <= y0)
+    return false;
+
+  _x = x0;
+  _y = y0;
+  _width = static_cast<unsigned int>(x1 - x0);
+  _height = static_cast<unsigned int>(y1 - y0);
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::vector<VisualPtr> Ogre2Camera::VisualsFromItems(
+    const std::vector<Ogre::Item *> &_items) const
+{
+  std::vector<VisualPtr> result;
+  std::set<unsigned int> ids;
+  for (Ogre::Item *ogreItem : _items)
+  {
+    auto userAny = ogreItem->getUserObjectBindings().getUserAny();
+    if (userAny.isEmpty() || userAny.getType() != typeid(unsigned int))
+      continue;
+
+    unsigned int id = Ogre::any_cast<unsigned int>(userAny);
+    if (!ids.insert(id).second)
+      continue;
+
+    VisualPtr visual = this->scene->VisualByCompactId(id);
+    if (visual)
+      result.push_back(visual);
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::vector<VisualPtr> Ogre2Camera::VisualsInRegion(
+    const math::Vector2i &_min, const math::Vector2i &_max)
+{
+  int x = 0;
+  int y = 0;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  if (!this->SelectionRegion(_min, _max, x, y, width, height))
+    return std::vector<VisualPtr>();
+
+  return this->VisualsFromItems(
+      this->selectionBuffer->ExecuteRegionQuery(x, y, width, height));
+}
+
+//////////////////////////////////////////////////
+std::future<std::vector<VisualPtr>> Ogre2Camera::VisualsInRegionAsync(
+    const math::Vector2i &_min, const math::Vector2i &_max)
+{
+  int x = 0;
+  int y = 0;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  if (!this->SelectionRegion(_min, _max, x, y, width, height))
+  {
+    std::promise<std::vector<VisualPtr>> empty;
+    empty.set_value(std::vector<VisualPtr>());
+    return empty.get_future();
+  }
+
+  // hold a weak reference so the selection buffer is not accessed if the
+  // camera was destroyed before the result is requested
+  std::weak_ptr<Ogre2Camera> weakThis =
+      std::dynamic_pointer_cast<Ogre2Camera>(this->shared_from_this());
+  auto items = std::make_shared<std::future<std::vector<Ogre::Item *>>>(
+      this->selectionBuffer->ExecuteRegionQueryAsync(x, y, width, height));
+  return std::async(std::launch::deferred, [weakThis, items]()
+      {
+        auto camera = weakThis.lock();
+        if (!camera || !camera->selectionBuffer)
+          return std::vector<VisualPtr>();
+        return camera->VisualsFromItems(items->get());
+      });
+}
+
 //////////////////////////////////////////////////
 RenderWindowPtr Ogre2Camera::CreateRenderWindow()
 {
@@ -413,6 +814,13 @@ void Ogre2Camera::SetFarClipPlane(const double _far)
   this->ogreCamera->setFarClipDistance(_far);
 }
 
+//////////////////////////////////////////////////
+void Ogre2Camera::SetLodBias(double _bias)
+{
+  BaseCamera::SetLodBias(_bias);
+  this->ogreCamera->setLodBias(this->lodBias);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Camera::SetVisibilityMask(uint32_t _mask)
 {
@@ -429,6 +837,14 @@ void Ogre2Camera::SetVisibilityMask(uint32_t _mask)
     this->renderTexture->SetVisibilityMask(_mask);
 }
 
+//////////////////////////////////////////////////
+void Ogre2Camera::SetQualityProfile(const SensorQualityProfile &_profile)
+{
+  BaseSensor::SetQualityProfile(_profile);
+  if (this->renderTexture)
+    this->renderTexture->SetQualityProfile(_profile);
+}
+
 //////////////////////////////////////////////////
 Ogre::Camera *Ogre2Camera::OgreCamera() const
 {
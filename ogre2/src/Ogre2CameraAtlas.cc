@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+
+#include "Ogre2CameraAtlas.hh"
+
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreAsyncTextureTicket.h>
+#include <OgreRenderSystem.h>
+#include <OgreRoot.h>
+#include <OgreTextureGpuManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Position of a texture in an atlas page
+struct Ogre2CameraAtlasTile
+{
+  /// \brief Index of the texture
+  unsigned int index = 0u;
+
+  /// \brief Left column of the tile
+  uint32_t x = 0u;
+
+  /// \brief Top row of the tile
+  uint32_t y = 0u;
+};
+
+//////////////////////////////////////////////////
+Ogre2CameraAtlas::~Ogre2CameraAtlas()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraAtlas::Download(
+    const std::vector<Ogre::TextureGpu *> &_textures, PixelFormat _format,
+    const std::function<void(unsigned int, const FrameView &)> &_callback)
+{
+  if (_textures.empty())
+    return;
+
+  // shelf packing of the tallest textures first, so that shelves waste
+  // little space, into an atlas about as wide as it is tall
+  std::vector<unsigned int> order(_textures.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(),
+      [&_textures](unsigned int _a, unsigned int _b)
+      {
+        return _textures[_a]->getHeight() > _textures[_b]->getHeight();
+      });
+
+  double area = 0.0;
+  uint32_t maxWidth = 0u;
+  for (Ogre::TextureGpu *tex : _textures)
+  {
+    area += static_cast<double>(tex->getWidth()) * tex->getHeight();
+    maxWidth = std::max(maxWidth, tex->getWidth());
+  }
+  const uint32_t atlasWidth = std::max(maxWidth, std::min(kMaxSize,
+      static_cast<uint32_t>(std::ceil(std::sqrt(area)))));
+
+  std::vector<Ogre2CameraAtlasTile> page;
+  size_t next = 0u;
+  while (next < order.size())
+  {
+    // fill a page
+    page.clear();
+    uint32_t x = 0u;
+    uint32_t y = 0u;
+    uint32_t shelfHeight = 0u;
+    uint32_t pageWidth = 0u;
+    for (; next < order.size(); ++next)
+    {
+      Ogre::TextureGpu *tex = _textures[order[next]];
+      if (x > 0u && x + tex->getWidth() > atlasWidth)
+      {
+        y += shelfHeight;
+        x = 0u;
+        shelfHeight = 0u;
+      }
+      if (!page.empty() && y + tex->getHeight() > kMaxSize)
+        break;
+
+      Ogre2CameraAtlasTile tile;
+      tile.index = order[next];
+      tile.x = x;
+      tile.y = y;
+      page.push_back(tile);
+
+      x += tex->getWidth();
+      shelfHeight = std::max(shelfHeight, tex->getHeight());
+      pageWidth = std::max(pageWidth, x);
+    }
+
+    this->Resize(pageWidth, y + shelfHeight,
+        _textures[page.front().index]->getPixelFormat());
+
+    // copy the tiles on the GPU, then download them all at once
+    for (const Ogre2CameraAtlasTile &tile : page)
+    {
+      Ogre::TextureGpu *src = _textures[tile.index];
+      Ogre::TextureBox dstBox = this->texture->getEmptyBox(0u);
+      dstBox.x = tile.x;
+      dstBox.y = tile.y;
+      dstBox.width = src->getWidth();
+      dstBox.height = src->getHeight();
+      src->copyTo(this->texture, dstBox, 0u, src->getEmptyBox(0u), 0u);
+    }
+    this->ticket->download(this->texture, 0u, true);
+
+    const Ogre::TextureBox box = this->ticket->map(0u);
+    for (const Ogre2CameraAtlasTile &tile : page)
+    {
+      Ogre::TextureGpu *src = _textures[tile.index];
+      FrameView view;
+      view.data = box.at(tile.x, tile.y, 0u);
+      view.width = src->getWidth();
+      view.height = src->getHeight();
+      view.rowPitch = box.bytesPerRow;
+      view.format = _format;
+      _callback(tile.index, view);
+    }
+    this->ticket->unmap();
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraAtlas::Resize(uint32_t _width, uint32_t _height,
+    Ogre::PixelFormatGpu _format)
+{
+  if (this->texture && this->texture->getWidth() == _width &&
+      this->texture->getHeight() == _height &&
+      this->texture->getPixelFormat() == _format)
+  {
+    return;
+  }
+  this->Destroy();
+
+  static unsigned int atlasCount = 0u;
+  Ogre::TextureGpuManager *textureMgr =
+      Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+      getTextureGpuManager();
+  this->texture = textureMgr->createTexture(
+      "Ogre2CameraAtlas_" + std::to_string(atlasCount++),
+      Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture,
+      Ogre::TextureTypes::Type2D);
+  this->texture->setResolution(_width, _height);
+  this->texture->setNumMipmaps(1u);
+  this->texture->setPixelFormat(_format);
+  this->texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+
+  this->ticket = textureMgr->createAsyncTextureTicket(_width, _height, 1u,
+      Ogre::TextureTypes::Type2D, _format);
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraAtlas::Destroy()
+{
+  if (!this->texture)
+    return;
+
+  auto root = Ogre2RenderEngine::Instance()->OgreRoot();
+  if (root && root->getRenderSystem())
+  {
+    Ogre::TextureGpuManager *textureMgr =
+        root->getRenderSystem()->getTextureGpuManager();
+    textureMgr->destroyAsyncTextureTicket(this->ticket);
+    textureMgr->destroyTexture(this->texture);
+  }
+  this->ticket = nullptr;
+  this->texture = nullptr;
+}
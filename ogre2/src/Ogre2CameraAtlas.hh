@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2CAMERAATLAS_HH_
+#define GZ_RENDERING_OGRE2_OGRE2CAMERAATLAS_HH_
+
+#include <functional>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/FrameView.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Packs the render textures of many small cameras as tiles of one
+/// atlas texture on the GPU and downloads the atlas with a single async
+/// texture ticket, so that the cameras share one readback and one wait
+/// for the GPU instead of paying for one each. Used by
+/// Scene::RenderCameraAtlas.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2CameraAtlas
+{
+  /// \brief Destructor. Destroys the atlas.
+  public: ~Ogre2CameraAtlas();
+
+  /// \brief Copy textures into the atlas, download it and pass a view of
+  /// every tile to a callback. Textures that do not fit in one atlas are
+  /// downloaded in several pages.
+  /// \param[in] _textures Textures to download, all with the same pixel
+  /// format
+  /// \param[in] _format Pixel format of the views
+  /// \param[in] _callback Called with the index of every texture in
+  /// _textures and a view of its tile
+  public: void Download(const std::vector<Ogre::TextureGpu *> &_textures,
+              PixelFormat _format,
+              const std::function<void(unsigned int, const FrameView &)>
+              &_callback);
+
+  /// \brief Destroy the atlas texture and its ticket
+  public: void Destroy();
+
+  /// \brief Make sure the atlas texture and ticket have the given size
+  /// and pixel format
+  /// \param[in] _width Atlas width
+  /// \param[in] _height Atlas height
+  /// \param[in] _format Atlas pixel format
+  private: void Resize(uint32_t _width, uint32_t _height,
+               Ogre::PixelFormatGpu _format);
+
+  /// \brief Largest side of an atlas page, in pixels
+  private: static constexpr uint32_t kMaxSize = 8192u;
+
+  /// \brief Atlas texture
+  private: Ogre::TextureGpu *texture = nullptr;
+
+  /// \brief Ticket the atlas is downloaded with
+  private: Ogre::AsyncTextureTicket *ticket = nullptr;
+};
+}
+}
+}
+#endif
@@ -16,6 +16,8 @@
  */
 
 #include <cmath>
+#include <map>
+#include <string>
 
 #include <gz/common/Mesh.hh>
 #include <gz/common/MeshManager.hh>
@@ -24,6 +26,8 @@
 #include "gz/rendering/ogre2/Ogre2Material.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Mesh.hh"
+#include "gz/rendering/ogre2/Ogre2MeshFactory.hh"
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 
 class gz::rendering::Ogre2CapsulePrivate
@@ -33,11 +37,25 @@ class gz::rendering::Ogre2CapsulePrivate
 
   /// \brief Mesh Object for capsule shape
   public: Ogre2MeshPtr ogreMesh{nullptr};
+
+  /// \brief Name of the mesh of the current capsule size
+  public: std::string meshName;
 };
 
 using namespace gz;
 using namespace rendering;
 
+namespace
+{
+  /// \brief Get the number of capsules using each capsule mesh
+  /// \return Capsule count, keyed by mesh name
+  std::map<std::string, unsigned int> &MeshUsers()
+  {
+    static std::map<std::string, unsigned int> users;
+    return users;
+  }
+}
+
 //////////////////////////////////////////////////
 Ogre2Capsule::Ogre2Capsule()
   : dataPtr(new Ogre2CapsulePrivate)
@@ -80,6 +98,7 @@ void Ogre2Capsule::Destroy()
     this->dataPtr->ogreMesh->Destroy();
     this->dataPtr->ogreMesh.reset();
   }
+  this->ReleaseMesh();
 
   if (this->dataPtr->material && this->Scene())
   {
@@ -96,6 +115,10 @@ void Ogre2Capsule::Update()
   capsuleMeshName += "_" + std::to_string(this->radius)
       + "_" + std::to_string(this->length);
 
+  // sizes that round to the same mesh keep the current one
+  if (this->dataPtr->ogreMesh && capsuleMeshName == this->dataPtr->meshName)
+    return;
+
   // Create new mesh if needed
   if (!meshMgr->HasMesh(capsuleMeshName))
   {
@@ -122,8 +145,13 @@ void Ogre2Capsule::Update()
     }
     this->dataPtr->ogreMesh->Destroy();
   }
+  // the mesh of the previous size is unloaded if no other capsule uses it
+  this->ReleaseMesh();
+
   this->dataPtr->ogreMesh = std::dynamic_pointer_cast<Ogre2Mesh>(
       this->Scene()->CreateMesh(meshDescriptor));
+  this->dataPtr->meshName = capsuleMeshName;
+  ++MeshUsers()[capsuleMeshName];
   if (this->dataPtr->material != nullptr)
   {
     this->dataPtr->ogreMesh->SetMaterial(this->dataPtr->material, false);
@@ -135,6 +163,32 @@ void Ogre2Capsule::Update()
   }
 }
 
+//////////////////////////////////////////////////
+void Ogre2Capsule::ReleaseMesh()
+{
+  if (this->dataPtr->meshName.empty())
+    return;
+
+  const std::string meshName = this->dataPtr->meshName;
+  this->dataPtr->meshName.clear();
+
+  auto it = MeshUsers().find(meshName);
+  if (it == MeshUsers().end() || --it->second > 0u)
+    return;
+  MeshUsers().erase(it);
+
+  // retained meshes are left to the next scene that loads them
+  if (Ogre2RenderEngine::Instance()->RetainMeshes())
+    return;
+
+  common::MeshManager *meshMgr = common::MeshManager::Instance();
+  MeshDescriptor meshDescriptor;
+  meshDescriptor.mesh = meshMgr->MeshByName(meshName);
+  if (meshDescriptor.mesh && this->scene)
+    this->scene->meshFactory->Unload(meshDescriptor);
+  meshMgr->RemoveMesh(meshName);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Capsule::SetMaterial(MaterialPtr _material, bool _unique)
 {
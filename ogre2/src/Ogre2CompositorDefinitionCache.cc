@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <map>
+#include <string>
+
+#include "Ogre2CompositorDefinitionCache.hh"
+
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <OgreMaterialManager.h>
+#include <OgreRoot.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Definitions of a configuration and their users
+  struct CacheEntry
+  {
+    /// \brief Name of the workspace definition
+    std::string workspace;
+
+    /// \brief Node definitions and materials
+    Ogre2CompositorDefinitions definitions;
+
+    /// \brief Number of sensors using the definitions
+    unsigned int users = 0u;
+  };
+
+  /// \brief Get the definitions in use, keyed by configuration
+  /// \return Definitions in use
+  std::map<std::string, CacheEntry> &Entries()
+  {
+    static std::map<std::string, CacheEntry> entries;
+    return entries;
+  }
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2CompositorDefinitionCache::Acquire(
+    const std::string &_baseName, const std::string &_key,
+    const CreateFunction &_create)
+{
+  CacheEntry &entry = Entries()[_baseName + "|" + _key];
+  if (entry.users++ == 0u)
+  {
+    static unsigned int definitionCount = 0u;
+    entry.workspace = _baseName + "_" + std::to_string(definitionCount++);
+    entry.definitions = Ogre2CompositorDefinitions();
+    _create(entry.workspace, entry.definitions);
+  }
+  return entry.workspace;
+}
+
+//////////////////////////////////////////////////
+void Ogre2CompositorDefinitionCache::Release(const std::string &_workspace)
+{
+  auto &entries = Entries();
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    CacheEntry &entry = it->second;
+    if (entry.workspace != _workspace)
+      continue;
+    if (--entry.users > 0u)
+      return;
+
+    // the workspace definition goes first as it uses the node definitions
+    auto engine = Ogre2RenderEngine::Instance();
+    Ogre::Root *ogreRoot = engine->OgreRoot();
+    if (ogreRoot && ogreRoot->getCompositorManager2())
+    {
+      Ogre::CompositorManager2 *ogreCompMgr =
+          ogreRoot->getCompositorManager2();
+      if (ogreCompMgr->hasWorkspaceDefinition(entry.workspace))
+        ogreCompMgr->removeWorkspaceDefinition(entry.workspace);
+      for (const auto &node : entry.definitions.nodes)
+      {
+        if (ogreCompMgr->hasNodeDefinition(node))
+          ogreCompMgr->removeNodeDefinition(node);
+      }
+      for (const auto &material : entry.definitions.materials)
+        Ogre::MaterialManager::getSingleton().remove(material);
+    }
+    entries.erase(it);
+    return;
+  }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2COMPOSITORDEFINITIONCACHE_HH_
+#define GZ_RENDERING_OGRE2_OGRE2COMPOSITORDEFINITIONCACHE_HH_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Compositor definitions and materials created for one sensor
+/// configuration
+struct GZ_RENDERING_OGRE2_HIDDEN Ogre2CompositorDefinitions
+{
+  /// \brief Names of the node definitions used by the workspace
+  public: std::vector<std::string> nodes;
+
+  /// \brief Names of the materials used by the node definitions
+  public: std::vector<std::string> materials;
+};
+
+/// \brief Shares compositor workspace definitions, with their node
+/// definitions and materials, between sensors whose configurations would
+/// produce identical definitions. Sensors only instantiate workspaces from
+/// the shared definitions, which saves building and parsing the same
+/// definitions for every sensor.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2CompositorDefinitionCache
+{
+  /// \brief Function creating the definitions of a configuration
+  /// \param[in] _name Name of the workspace definition to create. Node
+  /// definitions and materials should be prefixed with it.
+  /// \param[out] _definitions Node definitions and materials created
+  public: using CreateFunction = std::function<void(const std::string &_name,
+              Ogre2CompositorDefinitions &_definitions)>;
+
+  /// \brief Get the workspace definition of a configuration, creating it
+  /// if no sensor uses it. Every call must be matched by a Release call.
+  /// \param[in] _baseName Prefix of the workspace definition name
+  /// \param[in] _key Configuration, i.e. every setting that is baked into
+  /// the definitions and materials
+  /// \param[in] _create Function creating the definitions
+  /// \return Name of the workspace definition
+  public: static std::string Acquire(const std::string &_baseName,
+              const std::string &_key, const CreateFunction &_create);
+
+  /// \brief Stop using a workspace definition. The definitions and
+  /// materials are destroyed when they are no longer used.
+  /// \param[in] _workspace Name returned by Acquire
+  public: static void Release(const std::string &_workspace);
+};
+}
+}
+}
+#endif
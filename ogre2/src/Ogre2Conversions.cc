@@ -56,6 +56,10 @@ const Ogre::PixelFormatGpu Ogre2Conversions::ogrePixelFormats[PF_COUNT] =
       Ogre::PFG_R16_UNORM,
       // PF_R8G8B8A8
       Ogre::PFG_RGBA8_UNORM,
+      // PF_FLOAT16_RG
+      Ogre::PFG_RG16_FLOAT,
+      // PF_FLOAT16_R
+      Ogre::PFG_R16_FLOAT,
     };
 
 //////////////////////////////////////////////////
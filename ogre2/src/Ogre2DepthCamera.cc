@@ -23,10 +23,15 @@
   #include <windows.h>
 #endif
 
+#include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <math.h>
+#include <memory>
+#include <vector>
 #include <gz/math/Helpers.hh>
 #include <gz/math/Matrix4.hh>
+#include <gz/math/Vector2.hh>
 
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
@@ -39,7 +44,11 @@
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Sensor.hh"
 
+#include "Ogre2OcclusionCuller.hh"
 #include "Ogre2ParticleNoiseListener.hh"
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2SkyBoxMaterial.hh"
+#include "Ogre2TextureReadback.hh"
 
 #ifdef _MSC_VER
   #pragma warning(push, 0)
@@ -52,6 +61,7 @@
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreTechnique.h>
+#include <OgreTextureGpuManager.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
@@ -101,6 +111,15 @@ class gz::rendering::Ogre2DepthCameraPrivate
   /// \brief Outgoing point cloud data, used by newRgbPointCloud event.
   public: float *pointCloudImage = nullptr;
 
+  /// \brief Lease of depthBuffer from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> depthBufferLease;
+
+  /// \brief Lease of depthImage from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> depthImageLease;
+
+  /// \brief Lease of pointCloudImage from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> pointCloudImageLease;
+
   /// \brief maximum value used for data outside sensor range
   public: float dataMaxVal = gz::math::INF_D;
 
@@ -131,6 +150,18 @@ class gz::rendering::Ogre2DepthCameraPrivate
   /// \brief The depth material in final pass
   public: Ogre::MaterialPtr depthFinalMaterial;
 
+  /// \brief Set the clip distances of the camera and the uniforms of the
+  /// depth materials that depend on them. Render targets and workspace are
+  /// not affected.
+  /// \param[in] _camera Ogre camera of the depth camera
+  /// \param[in] _near Near clip plane distance
+  /// \param[in] _far Far clip plane distance
+  public: void SetClipPlanes(Ogre::Camera *_camera, double _near,
+              double _far);
+
+  /// \brief Near and far clip plane distances last set with SetClipPlanes
+  public: math::Vector2d clipPlanes;
+
   /// \brief A chain of render passes applied to the render target
   public: std::vector<RenderPassPtr> renderPasses;
 
@@ -147,6 +178,24 @@ class gz::rendering::Ogre2DepthCameraPrivate
               unsigned int, unsigned int, unsigned int,
               const std::string &)> newDepthFrame;
 
+  /// \brief Event used to signal packed point cloud data
+  public: gz::common::EventT<void(const PackedPoint *, unsigned int,
+              unsigned int, unsigned int)> newPackedPointCloud;
+
+  /// \brief Outgoing packed point cloud data, used by newPackedPointCloud
+  public: std::vector<PackedPoint> packedPoints;
+
+  /// \brief Event used to signal rgb images
+  public: gz::common::EventT<void(const void *, unsigned int, unsigned int,
+              unsigned int, const std::string &)> newRgbFrame;
+
+  /// \brief Lease of the outgoing rgb image from the engine frame buffer
+  /// pool, used by newRgbFrame
+  public: std::shared_ptr<unsigned char> rgbImageLease;
+
+  /// \brief Event used to signal a view of the downloaded depth data
+  public: gz::common::EventT<void(const FrameView &)> newFrameView;
+
   /// \brief standard deviation of particle noise
   public: double particleStddev = 0.01;
 
@@ -154,13 +203,13 @@ class gz::rendering::Ogre2DepthCameraPrivate
   /// emitter region
   public: std::unique_ptr<Ogre2ParticleNoiseListener> particleNoiseListener;
 
+  /// \brief Occlusion culling of the camera's scene passes
+  public: std::unique_ptr<Ogre2OcclusionCuller> occlusionCuller;
+
   /// \brief Particle scatter ratio. This is used to determine the ratio of
   /// particles that will detected by the depth camera
   public: double particleScatterRatio = 0.1;
 
-  /// \brief Name of sky box material
-  public: const std::string kSkyboxMaterialName = "SkyBox";
-
   /// \brief Name of shadow compositor node
   public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
 
@@ -176,6 +225,45 @@ class gz::rendering::Ogre2DepthCameraPrivate
 
   /// \brief Pointer to the particle target definition in the workspace
   public: Ogre::CompositorTargetDef *particleTargetDef{nullptr};
+
+  /// \brief Pointer to the scene pass definition of the depth target
+  public: Ogre::CompositorPassSceneDef *depthPassDef{nullptr};
+
+  /// \brief Apply a quality profile to the pass definitions. The
+  /// workspace must be recreated for the shadow node to change.
+  /// \param[in] _profile Quality profile of the camera
+  public: void ApplyQualityProfile(const SensorQualityProfile &_profile);
+
+  /// \brief Whether the particle target passes are enabled, -1 if they
+  /// were not configured since the target was created
+  public: int particlePassesEnabled{-1};
+
+  /// \brief Ring of tickets used to download depth data, one ticket
+  /// unless the readback buffer count is greater than 1
+  public: Ogre2TextureReadback readback;
+
+  /// \brief Output format the compact pass was created for,
+  /// DCOF_DEPTH_FLOAT32 if there is no compact pass
+  public: DepthCameraOutputFormat compactFormat = DCOF_DEPTH_FLOAT32;
+
+  /// \brief Single channel texture holding the depth in the compact
+  /// output format
+  public: Ogre::TextureGpu *compactTexture = nullptr;
+
+  /// \brief Final depth texture the compact pass reads from
+  public: Ogre::TextureGpu *compactInputTexture = nullptr;
+
+  /// \brief Workspace of the compact pass
+  public: Ogre::CompositorWorkspace *compactWorkspace = nullptr;
+
+  /// \brief Workspace definition of the compact pass
+  public: std::string compactWorkspaceDef;
+
+  /// \brief Material of the compact pass
+  public: Ogre::MaterialPtr compactMaterial;
+
+  /// \brief Ring of tickets used to download the compact depth texture
+  public: Ogre2TextureReadback compactReadback;
 };
 
 using namespace gz;
@@ -193,14 +281,11 @@ void Ogre2DepthGaussianNoisePass::PreRender()
   if (!this->enabled)
     return;
 
-  Ogre::Vector3 offsets(math::Rand::DblUniform(0.0, 1.0),
-                        math::Rand::DblUniform(0.0, 1.0),
-                        math::Rand::DblUniform(0.0, 1.0));
-
   Ogre::Pass *pass = this->gaussianNoiseMat->getTechnique(0)->getPass(0);
   Ogre::GpuProgramParametersSharedPtr psParams =
       pass->getFragmentProgramParameters();
-  psParams->setNamedConstant("offsets", offsets);
+  psParams->setNamedConstant("seed", static_cast<int>(this->seed));
+  psParams->setNamedConstant("frame", static_cast<int>(this->frame++));
   psParams->setNamedConstant("mean", static_cast<Ogre::Real>(this->mean));
   psParams->setNamedConstant("stddev",
       static_cast<Ogre::Real>(this->stdDev));
@@ -304,27 +389,21 @@ void Ogre2DepthCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
 
-  if (this->dataPtr->depthBuffer)
-  {
-    delete [] this->dataPtr->depthBuffer;
-    this->dataPtr->depthBuffer = nullptr;
-  }
-
-  if (this->dataPtr->depthImage)
-  {
-    delete [] this->dataPtr->depthImage;
-    this->dataPtr->depthImage = nullptr;
-  }
-
-  if (this->dataPtr->pointCloudImage)
-  {
-    delete [] this->dataPtr->pointCloudImage;
-    this->dataPtr->pointCloudImage = nullptr;
-  }
+  // return the buffers to the pool
+  this->dataPtr->depthBufferLease.reset();
+  this->dataPtr->depthBuffer = nullptr;
+  this->dataPtr->depthImageLease.reset();
+  this->dataPtr->depthImage = nullptr;
+  this->dataPtr->pointCloudImageLease.reset();
+  this->dataPtr->pointCloudImage = nullptr;
+  this->dataPtr->rgbImageLease.reset();
 
   if (!this->ogreCamera)
     return;
 
+  this->dataPtr->readback.Destroy();
+  this->DestroyCompactPass();
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -345,6 +424,8 @@ void Ogre2DepthCamera::Destroy()
         this->dataPtr->ogreCompositorWorkspace);
     this->dataPtr->colorTargetDef = nullptr;
     this->dataPtr->particleTargetDef = nullptr;
+    this->dataPtr->depthPassDef = nullptr;
+    this->dataPtr->particlePassesEnabled = -1;
   }
 
   if (this->dataPtr->depthMaterial)
@@ -376,6 +457,11 @@ void Ogre2DepthCamera::Destroy()
         this->dataPtr->particleNoiseListener.get());
     this->dataPtr->particleNoiseListener.reset();
   }
+  if (this->dataPtr->occlusionCuller)
+  {
+    this->ogreCamera->removeListener(this->dataPtr->occlusionCuller.get());
+    this->dataPtr->occlusionCuller.reset();
+  }
 
   Ogre::SceneManager *ogreSceneManager;
   ogreSceneManager = this->scene->OgreSceneManager();
@@ -463,29 +549,8 @@ void Ogre2DepthCamera::CreateDepthTexture()
   Ogre::GpuProgramParametersSharedPtr psParams =
       pass->getFragmentProgramParameters();
 
-  // Configure camera behaviour.
-  // Make the clipping plane dist large and handle near clamping in shaders
-  double nearPlane = this->NearClipPlane() * 0.9;
-  double farPlane = this->FarClipPlane() * 1.1;
-  this->ogreCamera->setNearClipDistance(nearPlane);
-  this->ogreCamera->setFarClipDistance(farPlane);
-
   // Set the uniform variables (depth_camera_fs.glsl).
-  // The projectParams is used to linearize depth buffer data
-  // The other params are used to clamp the range output
-  // Use the 'real' clip distance here so depth can be
-  // linearized correctly
-  Ogre::Vector2 projectionAB = this->ogreCamera->getProjectionParamsAB();
-  double projectionA = projectionAB.x;
-  double projectionB = projectionAB.y;
-  projectionB /= farPlane;
-
-  psParams->setNamedConstant("projectionParams",
-      Ogre::Vector2(projectionA, projectionB));
-  psParams->setNamedConstant("near",
-      static_cast<float>(this->NearClipPlane()));
-  psParams->setNamedConstant("far",
-      static_cast<float>(this->FarClipPlane()));
+  // The params are used to clamp the range output
   psParams->setNamedConstant("max",
       static_cast<float>(this->dataPtr->dataMaxVal));
   psParams->setNamedConstant("min",
@@ -507,47 +572,28 @@ void Ogre2DepthCamera::CreateDepthTexture()
       this->dataPtr->depthFinalMaterial->getTechnique(0)->getPass(0);
   Ogre::GpuProgramParametersSharedPtr psParamsFinal =
       passFinal->getFragmentProgramParameters();
-  psParamsFinal->setNamedConstant("near",
-      static_cast<float>(this->NearClipPlane()));
-  psParamsFinal->setNamedConstant("far",
-      static_cast<float>(this->FarClipPlane()));
   psParamsFinal->setNamedConstant("max",
       static_cast<float>(this->dataPtr->dataMaxVal));
   psParamsFinal->setNamedConstant("min",
       static_cast<float>(this->dataPtr->dataMinVal));
 
+  this->dataPtr->SetClipPlanes(this->ogreCamera, this->NearClipPlane(),
+      this->FarClipPlane());
+
   // create background material is specified
   MaterialPtr backgroundMaterial = this->Scene()->BackgroundMaterial();
-  bool validBackground = backgroundMaterial &&
-      !backgroundMaterial->EnvironmentMap().empty();
+  // the sky material is shared by all cameras rendering the same sky
+  const std::string skyMatName = backgroundMaterial &&
+      !backgroundMaterial->EnvironmentMap().empty() ?
+      Ogre2SkyBoxMaterial::Acquire(backgroundMaterial->EnvironmentMap()) :
+      std::string();
+  const bool validBackground = !skyMatName.empty();
 
   // let depth camera shader know if there is background material
   // This is needed for manual clipping of color pixel values.
   psParams->setNamedConstant("hasBackground",
       static_cast<int>(validBackground));
 
-  if (validBackground)
-  {
-    Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
-    std::string skyMatName = this->dataPtr->kSkyboxMaterialName + "_"
-        + this->Name();
-    auto mat = matManager.getByName(skyMatName);
-    if (!mat)
-    {
-      auto skyboxMat = matManager.getByName(this->dataPtr->kSkyboxMaterialName);
-      if (!skyboxMat)
-      {
-        gzerr << "Unable to find skybox material" << std::endl;
-        return;
-      }
-      mat = skyboxMat->clone(skyMatName);
-    }
-    Ogre::TextureUnitState *texUnit =
-        mat->getTechnique(0u)->getPass(0u)->getTextureUnitState(0u);
-    texUnit->setTextureName(backgroundMaterial->EnvironmentMap(),
-        Ogre::TextureTypes::TypeCube);
-  }
-
   // Create depth camera compositor
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
@@ -778,8 +824,7 @@ void Ogre2DepthCamera::CreateDepthTexture()
         Ogre::CompositorPassQuadDef *passQuad =
             static_cast<Ogre::CompositorPassQuadDef *>(
             this->dataPtr->colorTargetDef->addPass(Ogre::PASS_QUAD));
-        passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-            + this->Name();
+        passQuad->mMaterialName = skyMatName;
         passQuad->mFrustumCorners =
             Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
         passQuad->mExecutionMask = ~this->dataPtr->kDepthExecutionMask;
@@ -817,11 +862,13 @@ void Ogre2DepthCamera::CreateDepthTexture()
         GZ_VISIBILITY_ALL & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
       passScene->mEnableForwardPlus = false;
       passScene->setLightVisibilityMask(0x0);
+      this->dataPtr->depthPassDef = passScene;
     }
 
     // Ogre::CompositorTargetDef *particleTargetDef =
     this->dataPtr->particleTargetDef =
         baseNodeDef->addTargetPass("particleTexture");
+    this->dataPtr->particlePassesEnabled = -1;
     this->dataPtr->particleTargetDef->setNumPasses(2);
     {
       // clear pass
@@ -949,8 +996,17 @@ void Ogre2DepthCamera::CreateDepthTexture()
            << " for " << this->Name();
   }
 
-  Ogre::TextureGpuManager *textureMgr =
-    ogreRoot->getRenderSystem()->getTextureGpuManager();
+  this->CreateDepthTargets();
+
+  this->dataPtr->ApplyQualityProfile(this->qualityProfile);
+  this->CreateWorkspaceInstance();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::CreateDepthTargets()
+{
+  Ogre::TextureGpuManager *textureMgr = Ogre2RenderEngine::Instance()->
+      OgreRoot()->getRenderSystem()->getTextureGpuManager();
   // create render texture - these textures pack the range data
   for (size_t i = 0u; i < 2u; ++i)
   {
@@ -970,8 +1026,6 @@ void Ogre2DepthCamera::CreateDepthTexture()
       this->dataPtr->ogreDepthTexture[i]->scheduleTransitionTo(
         Ogre::GpuResidency::Resident);
   }
-
-  this->CreateWorkspaceInstance();
 }
 
 //////////////////////////////////////////////////
@@ -999,6 +1053,13 @@ void Ogre2DepthCamera::CreateWorkspaceInstance()
   this->dataPtr->ogreCompositorWorkspace->addListener(
     engine->TerraWorkspaceListener());
 
+  if (!this->dataPtr->occlusionCuller)
+  {
+    this->dataPtr->occlusionCuller =
+        std::make_unique<Ogre2OcclusionCuller>(this->scene.get());
+  }
+  this->ogreCamera->addListener(this->dataPtr->occlusionCuller.get());
+
   // add the listener
   Ogre::CompositorNode *node =
       this->dataPtr->ogreCompositorWorkspace->getNodeSequence()[0];
@@ -1023,6 +1084,8 @@ void Ogre2DepthCamera::CreateWorkspaceInstance()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
   // Our shaders rely on clamped values so enable it for this sensor
   //
   // TODO(anyone): Matias N. Goldberg (dark_sylinc) insists this is a hack
@@ -1043,6 +1106,15 @@ void Ogre2DepthCamera::Render()
   swappedTargets.reserve(2u);
   this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
 
+  // convert the depth to the compact output format
+  if (this->dataPtr->compactWorkspace)
+  {
+    this->dataPtr->compactWorkspace->_validateFinalTarget();
+    this->dataPtr->compactWorkspace->_beginUpdate(false);
+    this->dataPtr->compactWorkspace->_update();
+    this->dataPtr->compactWorkspace->_endUpdate(false);
+  }
+
   this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 
   this->ogreCamera->_setNeedsDepthClamp(bOldDepthClamp);
@@ -1051,12 +1123,34 @@ void Ogre2DepthCamera::Render()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::PreRender()
 {
-  if (!this->dataPtr->ogreDepthTexture[0])
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
+  if (!this->dataPtr->depthMaterial)
     this->CreateDepthTexture();
+  else if (!this->dataPtr->ogreDepthTexture[0])
+    this->CreateDepthTargets();
 
   if (!this->dataPtr->ogreCompositorWorkspace)
     this->CreateWorkspaceInstance();
 
+  // lens changes, e.g. zooming, only update the frustum and the uniforms,
+  // the render targets and the workspace are kept
+  const double aspectRatio = this->AspectRatio();
+  const Ogre::Radian vfov(static_cast<Ogre::Real>(this->LimitFOV(
+      2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspectRatio))));
+  if (this->ogreCamera->getFOVy() != vfov ||
+      this->ogreCamera->getAspectRatio() !=
+      static_cast<Ogre::Real>(aspectRatio))
+  {
+    this->ogreCamera->setFOVy(vfov);
+    this->ogreCamera->setAspectRatio(static_cast<Ogre::Real>(aspectRatio));
+  }
+  if (this->dataPtr->clipPlanes !=
+      math::Vector2d(this->NearClipPlane(), this->FarClipPlane()))
+  {
+    this->dataPtr->SetClipPlanes(this->ogreCamera, this->NearClipPlane(),
+        this->FarClipPlane());
+  }
+
   // todo(iche033) Override BaseCamera::SetProjectionMatrix() function in
   // main / gz-rendering9 instead of checking and setting the custom
   // projection matrix here
@@ -1082,12 +1176,12 @@ void Ogre2DepthCamera::PreRender()
     GZ_ASSERT(colorPasses[0]->getType() == Ogre::PASS_CLEAR,
         "Ogre2DepthCamera color target should start with a clear pass");
     colorPasses[0]->mExecutionMask =
-      (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u) ?
+      this->HasColorListeners() ?
       ~this->dataPtr->kDepthExecutionMask :this->dataPtr->kDepthExecutionMask;
     for (unsigned int i = 1; i < colorPasses.size(); ++i)
     {
       colorPasses[i]->mExecutionMask =
-          (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u) ?
+          this->HasColorListeners() ?
           this->dataPtr->kDepthExecutionMask :
           ~this->dataPtr->kDepthExecutionMask;
     }
@@ -1096,23 +1190,28 @@ void Ogre2DepthCamera::PreRender()
   // Disable particle target (set to clear pass) if there are no particles
   if (this->dataPtr->particleTargetDef)
   {
-    bool hasParticles =
-        this->scene->OgreSceneManager()->getMovableObjectIterator(
-        Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME).hasMoreElements();
-    Ogre::CompositorPassDefVec &particlePasses =
-        this->dataPtr->particleTargetDef->getCompositorPassesNonConst();
-    GZ_ASSERT(particlePasses.size() == 2u,
-        "Ogre2DepthCamera particle target should 2 passes");
-    GZ_ASSERT(particlePasses[0]->getType() == Ogre::PASS_CLEAR,
-        "Ogre2DepthCamera particle target should start with a clear pass");
-    GZ_ASSERT(particlePasses[1]->getType() == Ogre::PASS_SCENE,
-        "Ogre2DepthCamera particle target should end with a scene pass");
-    particlePasses[0]->mExecutionMask =
-      (hasParticles) ? ~this->dataPtr->kDepthExecutionMask :
-                       this->dataPtr->kDepthExecutionMask;
-    particlePasses[1]->mExecutionMask =
-      (hasParticles) ? this->dataPtr->kDepthExecutionMask :
-                       ~this->dataPtr->kDepthExecutionMask;
+    // the scene counts its particle systems, so we only need to touch the
+    // passes when particles appear or disappear
+    const int hasParticles = (this->qualityProfile.particles &&
+        this->scene->HasParticleSystems()) ? 1 : 0;
+    if (hasParticles != this->dataPtr->particlePassesEnabled)
+    {
+      Ogre::CompositorPassDefVec &particlePasses =
+          this->dataPtr->particleTargetDef->getCompositorPassesNonConst();
+      GZ_ASSERT(particlePasses.size() == 2u,
+          "Ogre2DepthCamera particle target should 2 passes");
+      GZ_ASSERT(particlePasses[0]->getType() == Ogre::PASS_CLEAR,
+          "Ogre2DepthCamera particle target should start with a clear pass");
+      GZ_ASSERT(particlePasses[1]->getType() == Ogre::PASS_SCENE,
+          "Ogre2DepthCamera particle target should end with a scene pass");
+      particlePasses[0]->mExecutionMask =
+        (hasParticles) ? ~this->dataPtr->kDepthExecutionMask :
+                         this->dataPtr->kDepthExecutionMask;
+      particlePasses[1]->mExecutionMask =
+        (hasParticles) ? this->dataPtr->kDepthExecutionMask :
+                         ~this->dataPtr->kDepthExecutionMask;
+      this->dataPtr->particlePassesEnabled = hasParticles;
+    }
   }
 
   // update depth camera render passes
@@ -1158,10 +1257,120 @@ void Ogre2DepthCamera::PreRender()
   }
 
   this->dataPtr->renderPassDirty = false;
+
+  // (re)create the compact pass if the output format changed or if the
+  // render pass chain swapped the final depth texture
+  if (this->dataPtr->compactFormat != this->outputFormat ||
+      (this->dataPtr->compactWorkspace &&
+      this->dataPtr->compactInputTexture !=
+      this->dataPtr->ogreDepthTexture[1]))
+  {
+    this->DestroyCompactPass();
+    if (this->outputFormat != DCOF_DEPTH_FLOAT32)
+      this->CreateCompactPass();
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::HasConnections() const
+{
+  return this->HasFloatListeners() ||
+      this->dataPtr->newFrameView.ConnectionCount() > 0u ||
+      BaseDepthCamera::HasConnections();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::ReleaseRenderTextures()
+{
+  if (!this->dataPtr->ogreDepthTexture[0])
+    return false;
+
+  // the workspace, compact pass and readback tickets reference the
+  // targets, they are recreated in PreRender
+  this->SetShadowsNodeDefDirty();
+  this->DestroyCompactPass();
+  this->dataPtr->readback.Destroy();
+
+  Ogre::TextureGpuManager *textureMgr = Ogre2RenderEngine::Instance()->
+      OgreRoot()->getRenderSystem()->getTextureGpuManager();
+  for (size_t i = 0u; i < 2u; ++i)
+  {
+    if (this->dataPtr->ogreDepthTexture[i])
+    {
+      textureMgr->destroyTexture(this->dataPtr->ogreDepthTexture[i]);
+      this->dataPtr->ogreDepthTexture[i] = nullptr;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2DepthCamera::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorWorkspace);
+  bytes += Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->compactWorkspace);
+  for (const Ogre::TextureGpu *texture : this->dataPtr->ogreDepthTexture)
+    bytes += Ogre2RenderEngine::TextureSizeBytes(texture);
+  bytes += Ogre2RenderEngine::TextureSizeBytes(
+      this->dataPtr->compactTexture);
+  return bytes;
 }
 
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::PostRender()
+{
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
+  if (this->dataPtr->compactWorkspace)
+  {
+    this->ReadCompactData();
+
+    // depth only pipeline, the float32 texture is not needed
+    if (!this->HasFloatListeners())
+    {
+      this->dataPtr->readback.Destroy();
+      return;
+    }
+  }
+
+  if (this->readbackBufferCount > 1u)
+  {
+    this->ReadDepthDataAsync();
+    return;
+  }
+
+  Ogre::TextureBox box;
+  if (!this->dataPtr->readback.Read(this->dataPtr->ogreDepthTexture[1], box))
+    return;
+  this->EndFrameInfo(this->renderFrameInfo);
+  this->depthDataTime = this->frameInfo.time;
+  this->ProcessDepthData(box.data, box.bytesPerRow);
+  this->dataPtr->readback.Unmap();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::ReadDepthDataAsync()
+{
+  // queue the download of the frame that was just rendered and deliver
+  // the oldest frame in the ring
+  this->dataPtr->readback.Download(this->dataPtr->ogreDepthTexture[1],
+      this->readbackBufferCount, this->renderFrameInfo);
+
+  Ogre::TextureBox box;
+  FrameInfo info;
+  if (!this->dataPtr->readback.Map(box, info))
+    return;
+
+  this->EndFrameInfo(info);
+  this->depthDataTime = info.time;
+  this->ProcessDepthData(box.data, box.bytesPerRow);
+  this->dataPtr->readback.Unmap();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::ProcessDepthData(const void *_data,
+    size_t _bytesPerRow)
 {
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
@@ -1172,50 +1381,65 @@ void Ogre2DepthCamera::PostRender()
   unsigned int channelCount = PixelUtil::ChannelCount(format);
   unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreDepthTexture[1], 0u, 0u);
-  Ogre::TextureBox box = image.getData(0);
-  float *depthBufferTmp = static_cast<float *>(box.data);
-  if (!this->dataPtr->depthBuffer)
+  // frame view listeners read the downloaded data directly, unless they
+  // get the compact depth image instead
+  if (this->dataPtr->newFrameView.ConnectionCount() > 0u &&
+      !this->dataPtr->compactWorkspace)
   {
-    this->dataPtr->depthBuffer = new float[len * channelCount];
+    FrameView view;
+    view.data = _data;
+    view.width = width;
+    view.height = height;
+    view.rowPitch = _bytesPerRow;
+    view.format = format;
+    view.info = this->frameInfo;
+    this->dataPtr->newFrameView(view);
+
+    // skip copying into the output buffers if no one else needs them
+    if (!this->HasFloatListeners())
+      return;
   }
 
-  // copy data row by row. The texture box may not be a contiguous region of
-  // a texture
-  for (unsigned int i = 0; i < height; ++i)
-  {
-    unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-    unsigned int rowIdx = i * width * channelCount;
-    memcpy(&this->dataPtr->depthBuffer[rowIdx], &depthBufferTmp[rawDataRowIdx],
-        width * channelCount * bytesPerChannel);
-  }
+  const float *depthBufferTmp = static_cast<const float *>(_data);
 
-  if (!this->dataPtr->depthImage)
-  {
-    this->dataPtr->depthImage = new float[len];
-  }
-  if (!this->dataPtr->pointCloudImage)
-  {
-    this->dataPtr->pointCloudImage = new float[len * channelCount];
-  }
+  // lease the output buffers from the engine pool, which also resizes them
+  // if the image size changed
+  FrameBufferPool &pool = this->scene->Engine()->BufferPool();
+  this->dataPtr->depthBuffer = reinterpret_cast<float *>(pool.Reserve(
+      this->dataPtr->depthBufferLease, len * channelCount * sizeof(float)));
+  this->dataPtr->depthImage = reinterpret_cast<float *>(pool.Reserve(
+      this->dataPtr->depthImageLease, len * sizeof(float)));
 
-  // fill depth data
-  for (unsigned int i = 0; i < height; ++i)
+  float *depthBuffer = this->dataPtr->depthBuffer;
+  float *depthImage = this->dataPtr->depthImage;
+  this->scene->ParallelForRows(height,
+      [&](unsigned int _begin, unsigned int _end)
   {
-    unsigned int step = i*width*channelCount;
-    for (unsigned int j = 0; j < width; ++j)
+    for (unsigned int i = _begin; i < _end; ++i)
     {
-      float x = this->dataPtr->depthBuffer[step + j*channelCount];
-      this->dataPtr->depthImage[i*width + j] = x;
+      // copy data row by row. The texture box may not be a contiguous region
+      // of a texture
+      unsigned int rawDataRowIdx = i * _bytesPerRow / bytesPerChannel;
+      unsigned int rowIdx = i * width * channelCount;
+      memcpy(&depthBuffer[rowIdx], &depthBufferTmp[rawDataRowIdx],
+          width * channelCount * bytesPerChannel);
+
+      // fill depth data
+      PixelUtil::PackFloat4ToFloat1(&depthBuffer[rowIdx],
+          &depthImage[i * width], width);
     }
-  }
+  });
+
   this->dataPtr->newDepthFrame(
         this->dataPtr->depthImage, width, height, 1, "FLOAT32");
 
   // point cloud data
   if (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u)
   {
+    // only lease the point cloud buffer while someone listens
+    this->dataPtr->pointCloudImage = reinterpret_cast<float *>(pool.Reserve(
+        this->dataPtr->pointCloudImageLease,
+        len * channelCount * sizeof(float)));
     memcpy(this->dataPtr->pointCloudImage,
       this->dataPtr->depthBuffer, len * channelCount * sizeof(float));
     this->dataPtr->newRgbPointCloud(
@@ -1254,6 +1478,12 @@ void Ogre2DepthCamera::PostRender()
     // }
   }
 
+  if (this->dataPtr->newPackedPointCloud.ConnectionCount() > 0u)
+    this->EmitPackedPointCloud(width, height);
+
+  if (this->dataPtr->newRgbFrame.ConnectionCount() > 0u)
+    this->EmitRgbFrame(width, height);
+
   // Uncomment to debug depth output
   // gzdbg << "wxh: " << width << " x " << height << std::endl;
   // for (unsigned int i = 0; i < height; ++i)
@@ -1266,12 +1496,120 @@ void Ogre2DepthCamera::PostRender()
   // }
 }
 
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::EmitPackedPointCloud(unsigned int _width,
+    unsigned int _height)
+{
+  const unsigned int len = _width * _height;
+  const float *src = this->dataPtr->depthBuffer;
+  auto &points = this->dataPtr->packedPoints;
+  points.resize(len);
+
+  // unpack the color stored in the bits of the 4th float, see
+  // ConnectNewRgbPointCloud
+  auto toPacked = [](const float *_p, PackedPoint &_out)
+  {
+    uint32_t rgba;
+    memcpy(&rgba, &_p[3], sizeof(rgba));
+    _out.x = _p[0];
+    _out.y = _p[1];
+    _out.z = _p[2];
+    _out.r = static_cast<uint8_t>(rgba >> 24 & 0xFF);
+    _out.g = static_cast<uint8_t>(rgba >> 16 & 0xFF);
+    _out.b = static_cast<uint8_t>(rgba >> 8 & 0xFF);
+    _out.a = static_cast<uint8_t>(rgba & 0xFF);
+  };
+
+  if (!this->packedPointCloudFilterInvalid)
+  {
+    this->scene->ParallelForRows(_height,
+        [&](unsigned int _begin, unsigned int _end)
+    {
+      for (unsigned int i = _begin * _width; i < _end * _width; ++i)
+        toPacked(&src[i * 4u], points[i]);
+    });
+    this->dataPtr->newPackedPointCloud(points.data(), len, _width, _height);
+    return;
+  }
+
+  unsigned int count = 0u;
+  for (unsigned int i = 0u; i < len; ++i)
+  {
+    const float *p = &src[i * 4u];
+    if (!std::isfinite(p[0]) || !std::isfinite(p[1]) || !std::isfinite(p[2]))
+      continue;
+    toPacked(p, points[count++]);
+  }
+  this->dataPtr->newPackedPointCloud(points.data(), count, count, 1u);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::EmitRgbFrame(unsigned int _width,
+    unsigned int _height)
+{
+  const PixelFormat format = this->rgbFrameFormat;
+  const unsigned int channelCount = PixelUtil::ChannelCount(format);
+  const bool bgr = format == PF_B8G8R8;
+  FrameBufferPool &pool = this->scene->Engine()->BufferPool();
+  unsigned char *image = pool.Reserve(this->dataPtr->rgbImageLease,
+      static_cast<size_t>(_width) * _height * channelCount);
+
+  // unpack the color stored in the bits of the 4th float, see
+  // ConnectNewRgbPointCloud
+  const float *src = this->dataPtr->depthBuffer;
+  this->scene->ParallelForRows(_height,
+      [&](unsigned int _begin, unsigned int _end)
+  {
+    for (unsigned int i = _begin * _width; i < _end * _width; ++i)
+    {
+      uint32_t rgba;
+      memcpy(&rgba, &src[i * 4u + 3u], sizeof(rgba));
+      unsigned char *dst = image + i * channelCount;
+      dst[bgr ? 2u : 0u] = static_cast<unsigned char>(rgba >> 24 & 0xFF);
+      dst[1] = static_cast<unsigned char>(rgba >> 16 & 0xFF);
+      dst[bgr ? 0u : 2u] = static_cast<unsigned char>(rgba >> 8 & 0xFF);
+      if (channelCount > 3u)
+        dst[3] = static_cast<unsigned char>(rgba & 0xFF);
+    }
+  });
+  this->dataPtr->newRgbFrame(image, _width, _height, channelCount,
+      PixelUtil::Name(format));
+}
+
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::HasColorListeners() const
+{
+  return this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u ||
+      this->dataPtr->newPackedPointCloud.ConnectionCount() > 0u ||
+      this->dataPtr->newRgbFrame.ConnectionCount() > 0u;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::HasFloatListeners() const
+{
+  return this->dataPtr->newDepthFrame.ConnectionCount() > 0u ||
+      this->HasColorListeners();
+}
+
 //////////////////////////////////////////////////
 const float *Ogre2DepthCamera::DepthData() const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   return this->dataPtr->depthBuffer;
 }
 
+//////////////////////////////////////////////////
+std::shared_ptr<const float> Ogre2DepthCamera::AcquireDepthData() const
+{
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
+  if (!this->dataPtr->depthBufferLease)
+    return nullptr;
+  return std::shared_ptr<const float>(this->dataPtr->depthBufferLease,
+      this->dataPtr->depthBuffer);
+}
+
 //////////////////////////////////////////////////
 common::ConnectionPtr Ogre2DepthCamera::ConnectNewDepthFrame(
     std::function<void(const float *, unsigned int, unsigned int,
@@ -1288,6 +1626,27 @@ common::ConnectionPtr Ogre2DepthCamera::ConnectNewRgbPointCloud(
   return this->dataPtr->newRgbPointCloud.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2DepthCamera::ConnectNewPackedPointCloud(
+    NewPackedPointCloudListener _listener)
+{
+  return this->dataPtr->newPackedPointCloud.Connect(_listener);
+}
+
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2DepthCamera::ConnectNewRgbFrame(
+    Camera::NewFrameListener _listener)
+{
+  return this->dataPtr->newRgbFrame.Connect(_listener);
+}
+
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2DepthCamera::ConnectNewFrameView(
+    Camera::NewFrameViewListener _listener)
+{
+  return this->dataPtr->newFrameView.Connect(_listener);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2DepthCamera::RenderTarget() const
 {
@@ -1300,18 +1659,64 @@ double Ogre2DepthCamera::LimitFOV(const double _fov)
   return std::min(std::max(0.001, _fov), GZ_PI * 0.999);
 }
 
+//////////////////////////////////////////////////
+void Ogre2DepthCameraPrivate::SetClipPlanes(Ogre::Camera *_camera,
+    double _near, double _far)
+{
+  this->clipPlanes.Set(_near, _far);
+
+  // Configure camera behaviour.
+  // Make the clipping plane dist large and handle near clamping in shaders
+  double nearPlane = _near * 0.9;
+  double farPlane = _far * 1.1;
+  _camera->setNearClipDistance(nearPlane);
+  _camera->setFarClipDistance(farPlane);
+
+  // Set the uniform variables (depth_camera_fs.glsl).
+  // The projectParams is used to linearize depth buffer data
+  // The other params are used to clamp the range output
+  // Use the 'real' clip distance here so depth can be
+  // linearized correctly
+  Ogre::Vector2 projectionAB = _camera->getProjectionParamsAB();
+  double projectionA = projectionAB.x;
+  double projectionB = projectionAB.y;
+  projectionB /= farPlane;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      this->depthMaterial->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParams->setNamedConstant("projectionParams",
+      Ogre::Vector2(projectionA, projectionB));
+  psParams->setNamedConstant("near", static_cast<float>(_near));
+  psParams->setNamedConstant("far", static_cast<float>(_far));
+
+  Ogre::GpuProgramParametersSharedPtr psParamsFinal =
+      this->depthFinalMaterial->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParamsFinal->setNamedConstant("near", static_cast<float>(_near));
+  psParamsFinal->setNamedConstant("far", static_cast<float>(_far));
+}
+
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::SetNearClipPlane(const double _near)
 {
   BaseDepthCamera::SetNearClipPlane(_near);
-  // near plane clipping is handled in shaders
+  // near plane clipping is handled in shaders, applied in PreRender
 }
 
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::SetFarClipPlane(const double _far)
 {
   BaseDepthCamera::SetFarClipPlane(_far);
-  // far plane clipping is handled in shaders
+  // far plane clipping is handled in shaders, applied in PreRender
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::SetLodBias(double _bias)
+{
+  BaseDepthCamera::SetLodBias(_bias);
+  if (this->ogreCamera)
+    this->ogreCamera->setLodBias(this->lodBias);
 }
 
 //////////////////////////////////////////////////
@@ -1349,6 +1754,262 @@ void Ogre2DepthCamera::SetShadowsNodeDefDirty()
     this->ogreCamera->removeListener(
         this->dataPtr->particleNoiseListener.get());
   }
+  if (this->dataPtr->occlusionCuller)
+    this->ogreCamera->removeListener(this->dataPtr->occlusionCuller.get());
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::SetOutputFormat(DepthCameraOutputFormat _format)
+{
+  // the compact pass is recreated in PreRender if needed
+  this->outputFormat = _format;
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::CreateCompactPass()
+{
+  if (!this->dataPtr->ogreDepthTexture[1])
+    return;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  // uint16 depth is stored in millimetres in a unorm texture
+  Ogre::PixelFormatGpu pixelFormat = Ogre::PFG_R16_FLOAT;
+  float depthScale = 1.0f;
+  float normalized = 0.0f;
+  if (this->outputFormat == DCOF_DEPTH_UINT16_MM)
+  {
+    pixelFormat = Ogre::PFG_R16_UNORM;
+    depthScale = 1000.0f / 65535.0f;
+    normalized = 1.0f;
+  }
+
+  std::string matName = "DepthCameraCompact";
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!mat)
+  {
+    gzerr << "Depth camera compact material not found: '" << matName << "'"
+          << std::endl;
+    return;
+  }
+  this->dataPtr->compactMaterial = mat->clone(this->Name() + "_" + matName);
+  this->dataPtr->compactMaterial->load();
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      this->dataPtr->compactMaterial->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParams->setNamedConstant("depthScale", depthScale);
+  psParams->setNamedConstant("normalized", normalized);
+
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+  this->dataPtr->compactTexture = textureMgr->createTexture(
+      this->Name() + "_depth_compact",
+      Ogre::GpuPageOutStrategy::SaveToSystemRam,
+      Ogre::TextureFlags::RenderToTexture,
+      Ogre::TextureTypes::Type2D);
+  this->dataPtr->compactTexture->setResolution(
+      this->ImageWidth(), this->ImageHeight());
+  this->dataPtr->compactTexture->setNumMipmaps(1u);
+  this->dataPtr->compactTexture->setPixelFormat(pixelFormat);
+  this->dataPtr->compactTexture->_setDepthBufferDefaults(
+      Ogre::DepthBuffer::POOL_NO_DEPTH, false, Ogre::PFG_UNKNOWN);
+  this->dataPtr->compactTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+  // The compositor node definition is equivalent to the following:
+  //
+  // compositor_node DepthCameraCompact
+  // {
+  //   in 0 rt_input
+  //   in 1 rt_output
+  //
+  //   target rt_output
+  //   {
+  //     pass render_quad
+  //     {
+  //       material DepthCameraCompact // Use copy instead of original
+  //       input 0 rt_input
+  //     }
+  //   }
+  // }
+  const std::string wsDefName = this->Name() + "_DepthCameraCompact";
+  this->dataPtr->compactWorkspaceDef = wsDefName;
+  const std::string nodeDefName = wsDefName + "/Node";
+  if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+  {
+    Ogre::CompositorNodeDef *nodeDef =
+        ogreCompMgr->addNodeDefinition(nodeDefName);
+    nodeDef->addTextureSourceName("rt_input", 0,
+        Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+    nodeDef->addTextureSourceName("rt_output", 1,
+        Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+    nodeDef->setNumTargetPass(1);
+    Ogre::CompositorTargetDef *targetDef =
+        nodeDef->addTargetPass("rt_output");
+    targetDef->setNumPasses(1);
+    {
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          targetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+      passQuad->mMaterialName = this->dataPtr->compactMaterial->getName();
+      passQuad->addQuadTextureSource(0, "rt_input");
+    }
+
+    Ogre::CompositorWorkspaceDef *workDef =
+        ogreCompMgr->addWorkspaceDefinition(wsDefName);
+    workDef->connectExternal(0, nodeDefName, 0);
+    workDef->connectExternal(1, nodeDefName, 1);
+  }
+
+  Ogre::CompositorChannelVec externalTargets(2u);
+  externalTargets[0] = this->dataPtr->ogreDepthTexture[1];
+  externalTargets[1] = this->dataPtr->compactTexture;
+  this->dataPtr->compactWorkspace = ogreCompMgr->addWorkspace(
+      this->scene->OgreSceneManager(), externalTargets, this->ogreCamera,
+      wsDefName, false);
+
+  this->dataPtr->compactInputTexture = this->dataPtr->ogreDepthTexture[1];
+  this->dataPtr->compactFormat = this->outputFormat;
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::DestroyCompactPass()
+{
+  // the tickets hold frames in the format of the texture
+  this->dataPtr->compactReadback.Destroy();
+  this->dataPtr->compactFormat = DCOF_DEPTH_FLOAT32;
+  this->dataPtr->compactInputTexture = nullptr;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  if (!ogreRoot)
+    return;
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  if (this->dataPtr->compactWorkspace)
+  {
+    ogreCompMgr->removeWorkspace(this->dataPtr->compactWorkspace);
+    this->dataPtr->compactWorkspace = nullptr;
+  }
+  if (!this->dataPtr->compactWorkspaceDef.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(
+        this->dataPtr->compactWorkspaceDef);
+    ogreCompMgr->removeNodeDefinition(
+        this->dataPtr->compactWorkspaceDef + "/Node");
+    this->dataPtr->compactWorkspaceDef.clear();
+  }
+  if (this->dataPtr->compactTexture)
+  {
+    ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+        this->dataPtr->compactTexture);
+    this->dataPtr->compactTexture = nullptr;
+  }
+  if (this->dataPtr->compactMaterial)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->compactMaterial->getName());
+    this->dataPtr->compactMaterial.setNull();
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::ReadCompactData()
+{
+  const PixelFormat format =
+      this->dataPtr->compactFormat == DCOF_DEPTH_UINT16_MM ?
+      PF_L16 : PF_FLOAT16_R;
+
+  auto emit = [&](const Ogre::TextureBox &_box)
+  {
+    if (this->dataPtr->newFrameView.ConnectionCount() == 0u)
+      return;
+    FrameView view;
+    view.data = _box.data;
+    view.width = this->ImageWidth();
+    view.height = this->ImageHeight();
+    view.rowPitch = _box.bytesPerRow;
+    view.format = format;
+    view.info = this->frameInfo;
+    this->dataPtr->newFrameView(view);
+  };
+
+  if (this->readbackBufferCount > 1u)
+  {
+    this->dataPtr->compactReadback.Download(this->dataPtr->compactTexture,
+        this->readbackBufferCount, this->renderFrameInfo);
+
+    Ogre::TextureBox box;
+    FrameInfo info;
+    if (!this->dataPtr->compactReadback.Map(box, info))
+      return;
+    this->EndFrameInfo(info);
+    this->depthDataTime = info.time;
+    emit(box);
+    this->dataPtr->compactReadback.Unmap();
+    return;
+  }
+
+  Ogre::TextureBox box;
+  if (!this->dataPtr->compactReadback.Read(
+      this->dataPtr->compactTexture, box))
+  {
+    return;
+  }
+  this->EndFrameInfo(this->renderFrameInfo);
+  this->depthDataTime = this->frameInfo.time;
+  emit(box);
+  this->dataPtr->compactReadback.Unmap();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::SetQualityProfile(
+    const SensorQualityProfile &_profile)
+{
+  BaseDepthCamera::SetQualityProfile(_profile);
+  this->dataPtr->ApplyQualityProfile(_profile);
+  this->SetShadowsNodeDefDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCameraPrivate::ApplyQualityProfile(
+    const SensorQualityProfile &_profile)
+{
+  uint32_t particleMask = _profile.particles ?
+      GZ_VISIBILITY_ALL : ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
+
+  if (this->colorTargetDef)
+  {
+    for (Ogre::CompositorPassDef *passDef :
+        this->colorTargetDef->getCompositorPassesNonConst())
+    {
+      if (passDef->getType() != Ogre::PASS_SCENE)
+        continue;
+      Ogre::CompositorPassSceneDef *passScene =
+          static_cast<Ogre::CompositorPassSceneDef *>(passDef);
+      if (_profile.shadows)
+        passScene->mShadowNode = this->kShadowNodeName;
+      else
+        passScene->mShadowNode = Ogre::IdString();
+      passScene->setVisibilityMask(
+          GZ_VISIBILITY_ALL & _profile.visibilityMask & particleMask);
+    }
+  }
+
+  // depth texture never contains particles
+  if (this->depthPassDef)
+  {
+    this->depthPassDef->setVisibilityMask(GZ_VISIBILITY_ALL &
+        _profile.visibilityMask &
+        ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
+  }
+
+  // let PreRender reconfigure the particle target
+  this->particlePassesEnabled = -1;
 }
 
 //////////////////////////////////////////////////
@@ -1375,6 +2036,7 @@ void Ogre2DepthCamera::AddRenderPass(const RenderPassPtr &_pass)
     std::make_shared<Ogre2DepthGaussianNoisePass>();
   depthNoisePass->SetMean(pass->Mean());
   depthNoisePass->SetStdDev(pass->StdDev());
+  depthNoisePass->SetSeed(pass->Seed());
 
   this->dataPtr->renderPasses.push_back(depthNoisePass);
   this->dataPtr->renderPassDirty = true;
@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <array>
+#include <map>
+
+#include <gz/common/Console.hh>
+#include <gz/math/Helpers.hh>
+
+#include "gz/rendering/RenderPassSystem.hh"
+#include "gz/rendering/ogre2/Ogre2DistortionPass.hh"
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/OgreCompositorWorkspace.h>
+#include <Compositor/OgreCompositorWorkspaceListener.h>
+#include <Compositor/Pass/OgreCompositorPass.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuad.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreCamera.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#include <OgreVector2.h>
+#include <OgreVector3.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+/// \brief Sets the camera dependent shader parameters of the distortion
+/// pass right before its quad pass is executed.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2DistortionPassWorkspaceListener
+    final : public Ogre::CompositorWorkspaceListener
+{
+  /// \brief Constructor
+  /// \param[in] _owner Pass the listener belongs to
+  public: explicit Ogre2DistortionPassWorkspaceListener(
+        Ogre2DistortionPass &_owner) : owner(_owner)
+  {
+  }
+
+  /// \brief Called when each pass is about to be executed.
+  /// \param[in] _pass Ogre pass which is about to execute
+  public: void passPreExecute(Ogre::CompositorPass *_pass) override;
+
+  /// \brief Pass the listener belongs to
+  private: Ogre2DistortionPass &owner;
+};
+}
+}
+}
+
+namespace
+{
+/// \brief Material and compositor node definition shared by all distortion
+/// passes with the same coefficients and center
+struct DistortionDefinition
+{
+  /// \brief Name of the distortion material
+  std::string materialName;
+
+  /// \brief Name of the compositor node definition
+  std::string nodeDefName;
+};
+
+/// \brief Distortion definitions indexed by k1, k2, k3, p1, p2 and the
+/// center. Like the materials of other passes, the definitions are kept
+/// until the engine is shut down, since workspaces that were instantiated
+/// from them may outlive the passes.
+std::map<std::array<double, 7>, DistortionDefinition> &Definitions()
+{
+  static std::map<std::array<double, 7>, DistortionDefinition> definitions;
+  return definitions;
+}
+}
+
+/// \brief Private data for the Ogre2DistortionPass class
+class gz::rendering::Ogre2DistortionPassPrivate
+{
+  /// \brief Constructor
+  /// \param[in] _owner Pass the private data belongs to
+  public: explicit Ogre2DistortionPassPrivate(Ogre2DistortionPass &_owner)
+    : workspaceListener(_owner)
+  {
+  }
+
+  /// \brief Name of the shared distortion material, empty if the pass
+  /// does not distort
+  public: std::string materialName;
+
+  /// \brief Focal length the crop scale was computed for, in units of the
+  /// image size
+  public: math::Vector2d focal;
+
+  /// \brief Scale applied to the distorted image to crop the black pixels
+  /// at the corners of the image
+  public: math::Vector2d distortionScale = {1.0, 1.0};
+
+  /// \brief True if the distorted image will be cropped to remove the
+  /// black pixels at the corners of the image.
+  public: bool distortionCrop = true;
+
+  /// \brief See Ogre2DistortionPassWorkspaceListener
+  public: Ogre2DistortionPassWorkspaceListener workspaceListener;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2DistortionPass::Ogre2DistortionPass()
+  : dataPtr(std::make_unique<Ogre2DistortionPassPrivate>(*this))
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2DistortionPass::~Ogre2DistortionPass()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DistortionPass::Destroy()
+{
+  this->dataPtr->materialName.clear();
+  this->ogreCompositorNodeDefName.clear();
+  Ogre2RenderPass::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DistortionPass::CreateRenderPass()
+{
+  if (!this->ogreCompositorNodeDefName.empty())
+    return;
+
+  // If no distortion is required, the pass does not add a node
+  if (math::equal(this->k1, 0.0) &&
+      math::equal(this->k2, 0.0) &&
+      math::equal(this->k3, 0.0) &&
+      math::equal(this->p1, 0.0) &&
+      math::equal(this->p2, 0.0))
+  {
+    return;
+  }
+
+  const std::array<double, 7> key = {this->k1, this->k2, this->k3,
+      this->p1, this->p2, this->lensCenter.X(), this->lensCenter.Y()};
+  auto &definitions = Definitions();
+  auto it = definitions.find(key);
+  if (it != definitions.end())
+  {
+    this->dataPtr->materialName = it->second.materialName;
+    this->ogreCompositorNodeDefName = it->second.nodeDefName;
+    return;
+  }
+
+  // The Distortion material is defined in script (distortion.material).
+  // clone the material
+  std::string matName = "Distortion";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    gzerr << "Distortion material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+
+  const std::string suffix = std::to_string(definitions.size());
+  DistortionDefinition definition;
+  definition.materialName = matName + "_" + suffix;
+  definition.nodeDefName = "DistortionNode_" + suffix;
+
+  // the coefficients never change, the focal length and crop scale depend
+  // on the camera and are set before every execution, see
+  // Ogre2DistortionPassWorkspaceListener
+  Ogre::MaterialPtr distortionMat = ogreMat->clone(definition.materialName);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      distortionMat->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  psParams->setNamedConstant("k", Ogre::Vector3(
+      static_cast<Ogre::Real>(this->k1),
+      static_cast<Ogre::Real>(this->k2),
+      static_cast<Ogre::Real>(this->k3)));
+  psParams->setNamedConstant("p", Ogre::Vector2(
+      static_cast<Ogre::Real>(this->p1),
+      static_cast<Ogre::Real>(this->p2)));
+  psParams->setNamedConstant("center", Ogre::Vector2(
+      static_cast<Ogre::Real>(this->lensCenter.X()),
+      static_cast<Ogre::Real>(this->lensCenter.Y())));
+
+  // create the compositor node definition. It is equivalent to the
+  // GaussianNoiseNode, see Ogre2GaussianNoisePass::CreateRenderPass
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(definition.nodeDefName);
+
+  // Input texture
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  // rt_input target
+  nodeDef->setNumTargetPass(1);
+  Ogre::CompositorTargetDef *inputTargetDef =
+      nodeDef->addTargetPass("rt_output");
+  inputTargetDef->setNumPasses(1);
+  {
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        inputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = definition.materialName;
+    passQuad->addQuadTextureSource(0, "rt_input");
+  }
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+
+  this->dataPtr->materialName = definition.materialName;
+  this->ogreCompositorNodeDefName = definition.nodeDefName;
+  definitions[key] = definition;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2DistortionPass::FusableMaterialName() const
+{
+  return this->dataPtr->materialName;
+}
+
+//////////////////////////////////////////////////
+void Ogre2DistortionPass::WorkspaceAdded(
+    Ogre::CompositorWorkspace *_workspace)
+{
+  _workspace->addListener(&this->dataPtr->workspaceListener);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DistortionPass::WorkspaceRemoved(
+    Ogre::CompositorWorkspace *_workspace)
+{
+  _workspace->removeListener(&this->dataPtr->workspaceListener);
+}
+
+//////////////////////////////////////////////////
+math::Vector2d Ogre2DistortionPass::Distort(const math::Vector2d &_in,
+    const math::Vector2d &_center, double _k1, double _k2, double _k3,
+    double _p1, double _p2, const math::Vector2d &_focal)
+{
+  // apply Brown's distortion model, see
+  // http://en.wikipedia.org/wiki/Distortion_%28optics%29#Software_correction
+  // The shader in distortion_fs.glsl inverts the same model.
+  const math::Vector2d normalized(
+      (_in.X() - _center.X()) / _focal.X(),
+      (_in.Y() - _center.Y()) / _focal.Y());
+  const double rSq = normalized.X() * normalized.X() +
+      normalized.Y() * normalized.Y();
+
+  // radial
+  math::Vector2d dist = normalized * (1.0 +
+      _k1 * rSq +
+      _k2 * rSq * rSq +
+      _k3 * rSq * rSq * rSq);
+
+  // tangential
+  dist.X() += _p2 * (rSq + 2 * (normalized.X() * normalized.X())) +
+      2 * _p1 * normalized.X() * normalized.Y();
+  dist.Y() += _p1 * (rSq + 2 * (normalized.Y() * normalized.Y())) +
+      2 * _p2 * normalized.X() * normalized.Y();
+
+  return math::Vector2d(_center.X() + dist.X() * _focal.X(),
+      _center.Y() + dist.Y() * _focal.Y());
+}
+
+//////////////////////////////////////////////////
+void Ogre2DistortionPassWorkspaceListener::passPreExecute(
+    Ogre::CompositorPass *_pass)
+{
+  if (!this->owner.enabled || this->owner.dataPtr->materialName.empty())
+    return;
+
+  // the quad pass is either in the node of the pass or, when the pass is
+  // fused, the final pass of the render target
+  const Ogre::CompositorPassDef *passDef = _pass->getDefinition();
+  if (passDef->getType() != Ogre::PASS_QUAD ||
+      static_cast<const Ogre::CompositorPassQuadDef *>(
+      passDef)->mMaterialName != this->owner.dataPtr->materialName)
+  {
+    return;
+  }
+
+  Ogre::CompositorPassQuad *passQuad =
+      static_cast<Ogre::CompositorPassQuad *>(_pass);
+  Ogre::Camera *camera = passQuad->getCamera();
+  if (!camera)
+    return;
+
+  // focal length in units of the image size, which also holds for custom
+  // projection matrices
+  const Ogre::Matrix4 &proj = camera->getProjectionMatrix();
+  const math::Vector2d focal(0.5 * proj[0][0], 0.5 * proj[1][1]);
+
+  Ogre2DistortionPassPrivate *data = this->owner.dataPtr.get();
+  if (focal != data->focal)
+  {
+    data->focal = focal;
+    data->distortionScale = {1.0, 1.0};
+
+    // Scale up image if cropping enabled and valid
+    if (data->distortionCrop && this->owner.k1 < 0)
+    {
+      math::Vector2d boundA = Ogre2DistortionPass::Distort(
+          math::Vector2d(0, 0), this->owner.lensCenter,
+          this->owner.k1, this->owner.k2, this->owner.k3,
+          this->owner.p1, this->owner.p2, focal);
+      math::Vector2d boundB = Ogre2DistortionPass::Distort(
+          math::Vector2d(1, 1), this->owner.lensCenter,
+          this->owner.k1, this->owner.k2, this->owner.k3,
+          this->owner.p1, this->owner.p2, focal);
+      math::Vector2d newScale = boundB - boundA;
+      // If distortionScale is extremely small, don't crop
+      if (newScale.X() < 1e-7 || newScale.Y() < 1e-7)
+      {
+        gzerr << "Distortion model attempted to apply a scale parameter of ("
+              << newScale.X() << ", " << newScale.Y()
+              << "), which is invalid.\n";
+      }
+      else
+      {
+        data->distortionScale = newScale;
+      }
+    }
+  }
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      passQuad->getPass()->getFragmentProgramParameters();
+  psParams->setNamedConstant("focal", Ogre::Vector2(
+      static_cast<Ogre::Real>(focal.X()),
+      static_cast<Ogre::Real>(focal.Y())));
+  psParams->setNamedConstant("scale", Ogre::Vector2(
+      static_cast<Ogre::Real>(data->distortionScale.X()),
+      static_cast<Ogre::Real>(data->distortionScale.Y())));
+}
+
+GZ_RENDERING_REGISTER_RENDER_PASS(Ogre2DistortionPass, DistortionPass)
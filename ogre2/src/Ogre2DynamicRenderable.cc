@@ -26,6 +26,9 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <limits>
+
 #include "gz/common/Console.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2DynamicRenderable.hh"
@@ -55,9 +58,33 @@ class gz::rendering::Ogre2DynamicRenderablePrivate
   /// \brief List of vertices for the mesh
   public: std::vector<gz::math::Vector3d> vertices;
 
+  /// \brief Mark a range of vertices as changed
+  /// \param[in] _begin First changed vertex
+  /// \param[in] _end One past the last changed vertex
+  public: void MarkDirty(size_t _begin, size_t _end)
+  {
+    this->dirtyBegin = std::min(this->dirtyBegin, _begin);
+    this->dirtyEnd = std::max(this->dirtyEnd, _end);
+    this->dirty = true;
+  }
+
   /// \brief Used to indicate if the lines require an update
   public: bool dirty = false;
 
+  /// \brief True if all vertices need to be uploaded, e.g. after the
+  /// vertex buffer was recreated or points were removed
+  public: bool fullUpdate = true;
+
+  /// \brief First vertex that changed since the last update
+  public: size_t dirtyBegin = std::numeric_limits<size_t>::max();
+
+  /// \brief One past the last vertex that changed since the last update
+  public: size_t dirtyEnd = 0u;
+
+  /// \brief Bounding box of the vertices uploaded so far. It only grows
+  /// between full updates so it may be larger than the geometry.
+  public: Ogre::Aabb bbox;
+
   /// \brief Render operation type
   public: Ogre::OperationType operationType;
 
@@ -73,7 +100,8 @@ class gz::rendering::Ogre2DynamicRenderablePrivate
   /// \brief Ogre item created from the dynamic geometry
   public: Ogre::Item *ogreItem = nullptr;
 
-  /// \brief raw vertex buffer
+  /// \brief CPU copy of the vertex buffer. Changed vertices are written
+  /// here first and then uploaded.
   public: float *vbuffer = nullptr;
 
   /// \brief Maximum capacity of the currently allocated vertex buffer.
@@ -252,8 +280,11 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     }
   }
 
-  // recreate vao if needed
-  if (newVertCapacity != this->dataPtr->vertexBufferCapacity)
+  // reallocate the cpu copy if needed, the gpu buffer is created below
+  // once it has been filled
+  const bool recreate =
+      newVertCapacity != this->dataPtr->vertexBufferCapacity;
+  if (recreate)
   {
     this->dataPtr->vertexBufferCapacity = newVertCapacity;
 
@@ -262,7 +293,56 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     unsigned int size = this->dataPtr->vertexBufferCapacity * 6;
     this->dataPtr->vbuffer = new float[size];
     memset(this->dataPtr->vbuffer, 0, size * sizeof(float));
+    this->dataPtr->fullUpdate = true;
+  }
+
+  // range of vertices to fill in. Normals of triangles depend on their
+  // neighbours so triangle types are always regenerated as a whole.
+  const bool triangles =
+      this->dataPtr->operationType != Ogre::OperationType::OT_POINT_LIST &&
+      this->dataPtr->operationType != Ogre::OperationType::OT_LINE_LIST &&
+      this->dataPtr->operationType != Ogre::OperationType::OT_LINE_STRIP;
+  size_t begin = this->dataPtr->dirtyBegin;
+  size_t end = std::min<size_t>(this->dataPtr->dirtyEnd, vertexCount);
+  if (this->dataPtr->fullUpdate || triangles)
+  {
+    begin = 0u;
+    end = vertexCount;
+    this->dataPtr->bbox = Ogre::Aabb();
+  }
+
+  // fill vertices
+  float *vertices = this->dataPtr->vbuffer;
+  for (size_t i = begin; i < end; ++i)
+  {
+    size_t idx = i*6;
+    Ogre::Vector3 v = Ogre2Conversions::Convert(this->dataPtr->vertices[i]);
+    vertices[idx] = v.x;
+    vertices[idx+1] = v.y;
+    vertices[idx+2] = v.z;
 
+    this->dataPtr->bbox.merge(v);
+  }
+
+  // fill normals, nothing to do for points and lines
+  if (triangles)
+  {
+    for (size_t i = 0u; i < vertexCount; ++i)
+    {
+      vertices[i*6+3] = 0.0f;
+      vertices[i*6+4] = 0.0f;
+      vertices[i*6+5] = 0.0f;
+    }
+    this->GenerateNormals(this->dataPtr->operationType,
+        this->dataPtr->vertices, vertices);
+  }
+
+  // fill colors for points
+  this->GenerateColors(this->dataPtr->operationType, this->dataPtr->vertices,
+      vertices, begin, end);
+
+  if (recreate)
+  {
     this->dataPtr->subMesh->mVao[Ogre::VpNormal].clear();
     this->dataPtr->subMesh->mVao[Ogre::VpShadow].clear();
 
@@ -273,10 +353,12 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     vertexElements.push_back(
         Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_NORMAL));
 
-    // create vertex buffer
+    // create vertex buffer. A default buffer keeps its contents on the gpu
+    // so later updates only upload the vertices that changed through
+    // Ogre's staging ring buffers instead of mapping the whole buffer.
     this->dataPtr->vertexBuffer = vaoManager->createVertexBuffer(
         vertexElements, this->dataPtr->vertexBufferCapacity,
-        Ogre::BT_DYNAMIC_PERSISTENT, this->dataPtr->vbuffer, false);
+        Ogre::BT_DEFAULT, this->dataPtr->vbuffer, false);
 
     Ogre::VertexBufferPackedVec vertexBuffers;
     vertexBuffers.push_back(this->dataPtr->vertexBuffer);
@@ -291,61 +373,22 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     // Use the same geometry for shadow casting.
     this->dataPtr->subMesh->mVao[Ogre::VpShadow].push_back(this->dataPtr->vao);
   }
-
-  // map buffer and update the geometry
-  Ogre::Aabb bbox;
-  float * RESTRICT_ALIAS vertices = reinterpret_cast<float * RESTRICT_ALIAS>(
-      this->dataPtr->vertexBuffer->map(
-      0, this->dataPtr->vertexBuffer->getNumElements()));
-
-  // fill vertices
-  for (unsigned int i = 0; i < vertexCount; ++i)
+  else if (end > begin)
   {
-    unsigned int idx = i*6;
-    Ogre::Vector3 v = Ogre2Conversions::Convert(this->dataPtr->vertices[i]);
-    vertices[idx] = v.x;
-    vertices[idx+1] = v.y;
-    vertices[idx+2] = v.z;
-
-    bbox.merge(v);
+    this->dataPtr->vertexBuffer->upload(vertices + begin * 6, begin,
+        end - begin);
   }
 
-  // fill the rest of the buffer with the position of the last vertex to avoid
-  // the geometry connecting back to 0, 0, 0
-  if (vertexCount > 0 && vertexCount < this->dataPtr->vertexBufferCapacity)
-  {
-    math::Vector3d lastVertex = this->dataPtr->vertices[vertexCount-1];
-    for (unsigned int i = vertexCount; i < this->dataPtr->vertexBufferCapacity;
-        ++i)
-    {
-      unsigned int idx = i * 6;
-      vertices[idx] = lastVertex.X();
-      vertices[idx+1] = lastVertex.Y();
-      vertices[idx+2] = lastVertex.Z();
-
-      vertices[idx+3] = 0;
-      vertices[idx+4] = 0;
-      vertices[idx+5] = 1;
-    }
-  }
-
-  // fill normals
-  this->GenerateNormals(this->dataPtr->operationType, this->dataPtr->vertices,
-      vertices);
-
-  // fill colors for points
-  this->GenerateColors(this->dataPtr->operationType, this->dataPtr->vertices,
-      vertices);
-
-  // unmap buffer
-  this->dataPtr->vertexBuffer->unmap(Ogre::UO_KEEP_PERSISTENT);
+  // only draw the vertices in use, the rest of the buffer is spare capacity
+  this->dataPtr->vao->setPrimitiveRange(0u,
+      static_cast<uint32_t>(vertexCount));
 
   // Set the bounds to get frustum culling and LOD to work correctly.
   Ogre::Mesh *mesh = this->dataPtr->subMesh->mParent;
-  mesh->_setBounds(bbox, true);
+  mesh->_setBounds(this->dataPtr->bbox, true);
 
-  // update item aabb
-  if (this->dataPtr->ogreItem)
+  // update item
+  if (this->dataPtr->ogreItem && recreate)
   {
     bool castShadows = this->dataPtr->ogreItem->getCastShadows();
     auto lowLevelMat = this->dataPtr->ogreItem->getSubItem(0)->getMaterial();
@@ -372,8 +415,21 @@ void Ogre2DynamicRenderable::UpdateBuffer()
       this->dataPtr->ogreItem->setCastShadows(castShadows);
     }
   }
+  else if (this->dataPtr->ogreItem)
+  {
+    // the vao is still valid, only the bounds changed
+    this->dataPtr->ogreItem->setLocalAabb(this->dataPtr->bbox);
+  }
+
+  // vertices and bounds changed
+  Ogre2ScenePtr s = std::dynamic_pointer_cast<Ogre2Scene>(this->dataPtr->scene);
+  if (s)
+    s->SetSceneGraphDirty();
 
   this->dataPtr->dirty = false;
+  this->dataPtr->fullUpdate = false;
+  this->dataPtr->dirtyBegin = std::numeric_limits<size_t>::max();
+  this->dataPtr->dirtyEnd = 0u;
 }
 
 //////////////////////////////////////////////////
@@ -458,7 +514,8 @@ void Ogre2DynamicRenderable::AddPoint(const math::Vector3d &_pt,
   // https://forums.ogre3d.org/viewtopic.php?t=93627#p539276
   this->dataPtr->colors.push_back(_color);
 
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkDirty(this->dataPtr->vertices.size() - 1u,
+      this->dataPtr->vertices.size());
 }
 
 /////////////////////////////////////////////////
@@ -481,7 +538,7 @@ void Ogre2DynamicRenderable::SetPoint(unsigned int _index,
 
   this->dataPtr->vertices[_index] = _value;
 
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkDirty(_index, _index + 1u);
 }
 
 /////////////////////////////////////////////////
@@ -502,7 +559,7 @@ void Ogre2DynamicRenderable::SetColor(unsigned int _index,
   // https://forums.ogre3d.org/viewtopic.php?t=93627#p539276
   this->dataPtr->colors[_index] = _color;
 
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkDirty(_index, _index + 1u);
 }
 
 /////////////////////////////////////////////////
@@ -537,6 +594,43 @@ void Ogre2DynamicRenderable::Clear()
   this->dataPtr->vertices.clear();
   this->dataPtr->colors.clear();
   this->dataPtr->dirty = true;
+  this->dataPtr->fullUpdate = true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2DynamicRenderable::SetPoints(const float *_xyz, const float *_rgba,
+    size_t _count)
+{
+  this->Clear();
+  this->AppendPoints(_xyz, _rgba, _count);
+}
+
+/////////////////////////////////////////////////
+void Ogre2DynamicRenderable::AppendPoints(const float *_xyz,
+    const float *_rgba, size_t _count)
+{
+  if (_count == 0u)
+    return;
+
+  const size_t begin = this->dataPtr->vertices.size();
+  this->dataPtr->vertices.resize(begin + _count);
+  this->dataPtr->colors.resize(begin + _count, math::Color::White);
+  for (size_t i = 0u; i < _count; ++i)
+  {
+    this->dataPtr->vertices[begin + i].Set(
+        _xyz[i*3], _xyz[i*3+1], _xyz[i*3+2]);
+  }
+  if (_rgba)
+  {
+    for (size_t i = 0u; i < _count; ++i)
+    {
+      this->dataPtr->colors[begin + i].Set(
+          _rgba[i*4], _rgba[i*4+1], _rgba[i*4+2], _rgba[i*4+3]);
+    }
+  }
+
+  // a single dirty range for all new points
+  this->dataPtr->MarkDirty(begin, begin + _count);
 }
 
 //////////////////////////////////////////////////
@@ -721,7 +815,8 @@ void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
 
 //////////////////////////////////////////////////
 void Ogre2DynamicRenderable::GenerateColors(Ogre::OperationType _opType,
-  const std::vector<math::Vector3d> &_vertices, float *_vbuffer)
+  const std::vector<math::Vector3d> &_vertices, float *_vbuffer,
+  size_t _begin, size_t _end)
 {
   // Skip if colors haven't been setup per-vertex correctly.
   if (_vertices.size() != this->dataPtr->colors.size())
@@ -740,12 +835,11 @@ void Ogre2DynamicRenderable::GenerateColors(Ogre::OperationType _opType,
   {
     case Ogre::OperationType::OT_POINT_LIST:
     {
-      for (unsigned int i = 0; i < this->dataPtr->vertexBufferCapacity; ++i)
+      for (size_t i = _begin; i < _end; ++i)
       {
-        math::Color color = i < this->dataPtr->colors.size() ?
-            this->dataPtr->colors[i] : this->dataPtr->colors.back();
+        const math::Color &color = this->dataPtr->colors[i];
 
-        unsigned int idx = i * 6;
+        size_t idx = i * 6;
         _vbuffer[idx+3] = color.R();
         _vbuffer[idx+4] = color.G();
         _vbuffer[idx+5] = color.B();
@@ -71,12 +71,8 @@ void Ogre2GaussianNoisePass::PreRender()
   // modify material here (wont alter the base material!), called for
   // every drawn geometry instance (i.e. compositor render_quad)
 
-  // Sample three values within the range [0,1.0] and set them for use in
-  // the fragment shader, which will interpret them as offsets from (0,0)
-  // to use when computing pseudo-random values.
-  Ogre::Vector3 offsets(math::Rand::DblUniform(0.0, 1.0),
-                        math::Rand::DblUniform(0.0, 1.0),
-                        math::Rand::DblUniform(0.0, 1.0));
+  // The fragment shader hashes the pixel, the frame and the seed into its
+  // random numbers, so no random values are drawn on the CPU.
   // These calls are setting parameters that are declared in two places:
   // 1. media/materials/scripts/gaussian_noise.material, in
   //    fragment_program GaussianNoiseFS
@@ -85,7 +81,8 @@ void Ogre2GaussianNoisePass::PreRender()
       this->dataPtr->gaussianNoiseMat->getTechnique(0)->getPass(0);
   Ogre::GpuProgramParametersSharedPtr psParams =
       pass->getFragmentProgramParameters();
-  psParams->setNamedConstant("offsets", offsets);
+  psParams->setNamedConstant("seed", static_cast<int>(this->seed));
+  psParams->setNamedConstant("frame", static_cast<int>(this->frame++));
   psParams->setNamedConstant("mean", static_cast<Ogre::Real>(this->mean));
   psParams->setNamedConstant("stddev",
       static_cast<Ogre::Real>(this->stdDev));
@@ -184,4 +181,12 @@ void Ogre2GaussianNoisePass::CreateRenderPass()
   nodeDef->mapOutputChannel(1, "rt_input");
 }
 
+//////////////////////////////////////////////////
+std::string Ogre2GaussianNoisePass::FusableMaterialName() const
+{
+  if (!this->dataPtr->gaussianNoiseMat)
+    return std::string();
+  return this->dataPtr->gaussianNoiseMat->getName();
+}
+
 GZ_RENDERING_REGISTER_RENDER_PASS(Ogre2GaussianNoisePass, GaussianNoisePass)
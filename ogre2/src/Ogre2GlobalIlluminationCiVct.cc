@@ -78,6 +78,12 @@ class GZ_RENDERING_OGRE2_HIDDEN
 
   /// \brief Tracks if GlobalIlluminationCiVct::Start has been called
   public: bool started = false;
+
+  /// \brief See GlobalIlluminationCiVct::SetUpdateInterval
+  public: uint32_t updateInterval = 1u;
+
+  /// \brief Number of frames since the cascades were last updated
+  public: uint32_t framesSinceUpdate = 0u;
   // clang-format on
 };
 
@@ -362,6 +368,18 @@ void Ogre2GlobalIlluminationCiVct::Bind(const CameraPtr &_camera)
   this->dataPtr->bindCamera = _camera;
 }
 
+//////////////////////////////////////////////////
+void Ogre2GlobalIlluminationCiVct::SetUpdateInterval(uint32_t _frames)
+{
+  this->dataPtr->updateInterval = _frames;
+}
+
+//////////////////////////////////////////////////
+uint32_t Ogre2GlobalIlluminationCiVct::UpdateInterval() const
+{
+  return this->dataPtr->updateInterval;
+}
+
 //////////////////////////////////////////////////
 bool Ogre2GlobalIlluminationCiVct::Anisotropic() const
 {
@@ -420,6 +438,17 @@ void Ogre2GlobalIlluminationCiVct::UpdateLighting()
 //////////////////////////////////////////////////
 void Ogre2GlobalIlluminationCiVct::UpdateCamera()
 {
+  ++this->dataPtr->framesSinceUpdate;
+  if (this->dataPtr->framesSinceUpdate < this->dataPtr->updateInterval)
+    return;
+
+  this->Converge();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GlobalIlluminationCiVct::Converge()
+{
+  this->dataPtr->framesSinceUpdate = 0u;
   Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
   this->dataPtr->cascadedVoxelizer->setCameraPosition(
     Ogre2Conversions::Convert(this->dataPtr->bindCamera->WorldPosition()));
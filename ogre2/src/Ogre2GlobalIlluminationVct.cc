@@ -17,6 +17,8 @@
 
 #include "gz/rendering/ogre2/Ogre2GlobalIlluminationVct.hh"
 
+#include <vector>
+
 #include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 
@@ -29,6 +31,7 @@
 #include <OgreHlmsManager.h>
 #include <OgreItem.h>
 #include <OgreRoot.h>
+#include <OgreSubItem.h>
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #endif
@@ -36,9 +39,41 @@
 using namespace gz;
 using namespace rendering;
 
+/// \brief State of a voxelized item, used to detect changes between builds
+struct VctItemState
+{
+  /// \brief Voxelized item
+  Ogre::Item *item = nullptr;
+
+  /// \brief Id of the item, in case its memory got reused by a new one
+  Ogre::IdType id = 0u;
+
+  /// \brief World transform of the item
+  Ogre::Matrix4 transform;
+
+  /// \brief Datablocks of the item's subitems
+  std::vector<Ogre::HlmsDatablock *> datablocks;
+
+  /// \brief Equality operator
+  /// \param[in] _other State to compare with
+  /// \return True if both states are the same
+  bool operator==(const VctItemState &_other) const
+  {
+    return this->item == _other.item && this->id == _other.id &&
+        this->transform == _other.transform &&
+        this->datablocks == _other.datablocks;
+  }
+};
+
 /// \brief Private data for the Ogre2GlobalIlluminationVct class
 class gz::rendering::Ogre2GlobalIlluminationVctPrivate
 {
+  /// \brief Gather the visible items that participate in GI
+  /// \param[in] _sceneManager Scene manager to get the items from
+  /// \param[out] _items Participating items and their state
+  public: void CollectItems(Ogre::SceneManager *_sceneManager,
+              std::vector<VctItemState> &_items) const;
+
   // clang-format off
   /// \brief Ogre's Voxelizer. In charge of voxelizing the scene
   /// at voxelizing phase time
@@ -77,9 +112,67 @@ class gz::rendering::Ogre2GlobalIlluminationVctPrivate
 
   /// \brief See GlobalIlluminationVct::SetAnisotropic
   public: bool anisotropic = true;
+
+  /// \brief Items voxelized by the last build
+  public: std::vector<VctItemState> builtItems;
+
+  /// \brief True if a setting that requires voxelizing the scene again
+  /// changed since the last build
+  public: bool settingsDirty = true;
   // clang-format on
 };
 
+//////////////////////////////////////////////////
+void Ogre2GlobalIlluminationVctPrivate::CollectItems(
+    Ogre::SceneManager *_sceneManager,
+    std::vector<VctItemState> &_items) const
+{
+  _items.clear();
+  for (size_t type = 0; type < 2u; ++type)
+  {
+    if (((1u << type) & this->participatingVisuals) == 0u)
+      continue;
+
+    // Add all dynamic/static Item from Ogre
+    Ogre::ObjectMemoryManager &objMemoryManager =
+      _sceneManager->_getEntityMemoryManager(
+        static_cast<Ogre::SceneMemoryMgrTypes>(type));
+
+    const size_t numRenderQueues = objMemoryManager.getNumRenderQueues();
+
+    for (size_t i = 0u; i < numRenderQueues; ++i)
+    {
+      Ogre::ObjectData objData;
+      const size_t totalObjs = objMemoryManager.getFirstObjectData(objData, i);
+
+      for (size_t j = 0; j < totalObjs; j += ARRAY_PACKED_REALS)
+      {
+        for (size_t k = 0; k < ARRAY_PACKED_REALS; ++k)
+        {
+          // objData.mOwner is guaranteed by Ogre to not be a nullptr
+          if (objData.mOwner[k]->getVisible())
+          {
+            auto item = dynamic_cast<Ogre::Item *>(objData.mOwner[k]);
+            if (item)
+            {
+              VctItemState state;
+              state.item = item;
+              state.id = item->getId();
+              state.transform = item->_getParentNodeFullTransform();
+              state.datablocks.reserve(item->getNumSubItems());
+              for (size_t s = 0; s < item->getNumSubItems(); ++s)
+                state.datablocks.push_back(item->getSubItem(s)->getDatablock());
+              _items.push_back(std::move(state));
+            }
+          }
+        }
+
+        objData.advancePack();
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 Ogre2GlobalIlluminationVct::Ogre2GlobalIlluminationVct() :
   dataPtr(new Ogre2GlobalIlluminationVctPrivate)
@@ -136,6 +229,7 @@ void Ogre2GlobalIlluminationVct::SetResolution(const uint32_t _resolution[3])
   }
   this->dataPtr->voxelizer->setResolution(_resolution[0], _resolution[1],
                                           _resolution[2]);
+  this->dataPtr->settingsDirty = true;
 }
 
 //////////////////////////////////////////////////
@@ -151,6 +245,7 @@ void Ogre2GlobalIlluminationVct::SetOctantCount(const uint32_t _octants[3])
   {
     this->dataPtr->octants[i] = _octants[i];
   }
+  this->dataPtr->settingsDirty = true;
 }
 
 //////////////////////////////////////////////////
@@ -177,6 +272,7 @@ uint32_t Ogre2GlobalIlluminationVct::BounceCount() const
 void Ogre2GlobalIlluminationVct::SetParticipatingVisuals(uint32_t _mask)
 {
   this->dataPtr->participatingVisuals = _mask;
+  this->dataPtr->settingsDirty = true;
 }
 
 //////////////////////////////////////////////////
@@ -252,42 +348,10 @@ void Ogre2GlobalIlluminationVct::Build()
 
   voxelizer->removeAllItems();
 
-  for (size_t type = 0; type < 2u; ++type)
-  {
-    if (((1u << type) & this->dataPtr->participatingVisuals) == 0u)
-      continue;
-
-    // Add all dynamic/static Item from Ogre
-    Ogre::ObjectMemoryManager &objMemoryManager =
-      sceneManager->_getEntityMemoryManager(
-        static_cast<Ogre::SceneMemoryMgrTypes>(type));
-
-    const size_t numRenderQueues = objMemoryManager.getNumRenderQueues();
-
-    for (size_t i = 0u; i < numRenderQueues; ++i)
-    {
-      Ogre::ObjectData objData;
-      const size_t totalObjs = objMemoryManager.getFirstObjectData(objData, i);
-
-      for (size_t j = 0; j < totalObjs; j += ARRAY_PACKED_REALS)
-      {
-        for (size_t k = 0; k < ARRAY_PACKED_REALS; ++k)
-        {
-          // objData.mOwner is guaranteed by Ogre to not be a nullptr
-          if (objData.mOwner[k]->getVisible())
-          {
-            auto item = dynamic_cast<Ogre::Item *>(objData.mOwner[k]);
-            if (item)
-            {
-              voxelizer->addItem(item, false);
-            }
-          }
-        }
-
-        objData.advancePack();
-      }
-    }
-  }
+  this->dataPtr->CollectItems(sceneManager, this->dataPtr->builtItems);
+  for (const VctItemState &state : this->dataPtr->builtItems)
+    voxelizer->addItem(state.item, false);
+  this->dataPtr->settingsDirty = false;
 
   voxelizer->autoCalculateRegion();
   voxelizer->dividideOctants(this->dataPtr->octants[0],
@@ -311,6 +375,24 @@ void Ogre2GlobalIlluminationVct::Build()
   this->SyncModeVisualizationMode();
 }
 
+//////////////////////////////////////////////////
+bool Ogre2GlobalIlluminationVct::BuildIfChanged()
+{
+  if (!this->dataPtr->settingsDirty && this->dataPtr->vctLighting)
+  {
+    Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+    sceneManager->updateSceneGraph();
+
+    std::vector<VctItemState> items;
+    this->dataPtr->CollectItems(sceneManager, items);
+    if (items == this->dataPtr->builtItems)
+      return false;
+  }
+
+  this->Build();
+  return true;
+}
+
 //////////////////////////////////////////////////
 void Ogre2GlobalIlluminationVct::UpdateLighting()
 {
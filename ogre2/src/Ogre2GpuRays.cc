@@ -15,6 +15,16 @@
  *
 */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include <gz/math/Pose3.hh>
 #include <gz/math/Vector2.hh>
 #include <gz/math/Vector3.hh>
 
@@ -36,6 +46,9 @@
 
 #include "Ogre2GzHlmsSphericalClipMinDistance.hh"
 #include "Ogre2ParticleNoiseListener.hh"
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2StaticBatchBypass.hh"
+#include "Ogre2TextureReadback.hh"
 #include "Terra/Hlms/PbsListener/OgreHlmsPbsTerraShadows.h"
 
 #include "Terra/Terra.h"
@@ -50,6 +63,10 @@
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
 #include <OgreDepthBuffer.h>
 #include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRenderSystem.h>
+#include <OgreRenderSystemCapabilities.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreTechnique.h>
@@ -108,6 +125,77 @@ class GZ_RENDERING_OGRE2_HIDDEN
   private:
     std::vector<std::pair<Ogre::SubItem *, Ogre::MaterialPtr>> materialMap;
 };
+
+/// \brief Texture telling the 2nd pass shader where to sample the cubemap
+/// for each ray, see Ogre2GpuRays::CreateSampleTexture. The texture only
+/// depends on the angles and sample counts, so GpuRays with the same
+/// configuration share it.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2GpuRaysSampleTexture
+{
+  /// \brief Angles and sample counts: horizontal min, max, vertical min,
+  /// max, horizontal and vertical samples
+  public: using Key = std::tuple<double, double, double, double,
+      unsigned int, unsigned int>;
+
+  /// \brief Destructor. Destroys the texture.
+  public: ~Ogre2GpuRaysSampleTexture()
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    if (!this->texture || !engine->OgreRoot())
+      return;
+    engine->OgreRoot()->getRenderSystem()->getTextureGpuManager()->
+        destroyTexture(this->texture);
+  }
+
+  /// \brief Get the texture of a configuration if a GpuRays holds it
+  /// \param[in] _key Configuration
+  /// \return Shared texture, null if it needs to be created
+  public: static std::shared_ptr<Ogre2GpuRaysSampleTexture> Find(
+      const Key &_key)
+  {
+    auto &textures = Textures();
+    for (auto it = textures.begin(); it != textures.end();)
+    {
+      if (it->second.expired())
+        it = textures.erase(it);
+      else
+        ++it;
+    }
+    auto it = textures.find(_key);
+    return it != textures.end() ? it->second.lock() : nullptr;
+  }
+
+  /// \brief Share a texture with the GpuRays of the same configuration
+  /// \param[in] _key Configuration
+  /// \param[in] _texture Texture to share
+  public: static void Add(const Key &_key,
+      const std::shared_ptr<Ogre2GpuRaysSampleTexture> &_texture)
+  {
+    Textures()[_key] = _texture;
+    _texture->shared = true;
+  }
+
+  /// \brief Get the textures in use, keyed by configuration
+  /// \return Textures in use
+  private: static std::map<Key, std::weak_ptr<Ogre2GpuRaysSampleTexture>>
+      &Textures()
+  {
+    static std::map<Key, std::weak_ptr<Ogre2GpuRaysSampleTexture>> textures;
+    return textures;
+  }
+
+  /// \brief Texture packed with cubemap face and uv data
+  public: Ogre::TextureGpu *texture = nullptr;
+
+  /// \brief Cubemap faces sampled by the rays
+  public: std::set<unsigned int> faces;
+
+  /// \brief Mean scan time of the rays of each face
+  public: std::array<double, 6> faceTimes{};
+
+  /// \brief True if GpuRays of the same configuration may use the texture
+  public: bool shared = false;
+};
 }
 }
 }
@@ -127,18 +215,26 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
                unsigned int, unsigned int, unsigned int,
                const std::string &)> newGpuRaysFrame;
 
-  /// \brief Raw buffer of gpu rays data.
-  public: float *gpuRaysBuffer = nullptr;
+  /// \brief Event used to signal a view of the downloaded gpu rays data
+  public: gz::common::EventT<void(const FrameView &)> newFrameView;
 
   /// \brief Outgoing gpu rays data, used by newGpuRaysFrame event.
   public: float *gpuRaysScan = nullptr;
 
+  /// \brief Lease of gpuRaysScan from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> gpuRaysScanLease;
+
   /// \brief Cubemap camera
   public: Ogre::Camera *cubeCam{nullptr};
 
-  /// \brief Texture packed with cubemap face and uv data
+  /// \brief Texture packed with cubemap face and uv data, owned by
+  /// sampleTexture
   public: Ogre::TextureGpu *cubeUVTexture = nullptr;
 
+  /// \brief Cubemap lookup texture shared with the GpuRays of the same
+  /// configuration
+  public: std::shared_ptr<Ogre2GpuRaysSampleTexture> sampleTexture;
+
   /// \brief Temporary texture where to render a side of the cubemap
   /// during GpuRays1stPass. Shared across all active faces to save memory
   public: Ogre::TextureGpu *colorTexture = nullptr;
@@ -159,6 +255,23 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
   /// range data
   public: std::set<unsigned int> cubeFaceIdx;
 
+  /// \brief True if the scan pattern changed since the textures were
+  /// created
+  public: bool rayDirectionsDirty = false;
+
+  /// \brief Mean scan time of the rays of each cubemap face, see
+  /// SetScanMotion
+  public: std::array<double, 6> faceScanTimes{};
+
+  /// \brief True if the rays are cast from a moving pose
+  public: bool scanMotion = false;
+
+  /// \brief World pose of the sensor at the start of the scan
+  public: math::Pose3d scanStart;
+
+  /// \brief World pose of the sensor at the end of the scan
+  public: math::Pose3d scanEnd;
+
   /// \brief Main pass definition (used for visibility mask manipuluation).
   public: Ogre::CompositorPassSceneDef *mainPassSceneDef = nullptr;
 
@@ -174,6 +287,18 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
   /// \brief Second pass texture.
   public: Ogre::TextureGpu * secondPassTexture = nullptr;
 
+  /// \brief Ring of tickets used to download the second pass texture, one
+  /// ticket unless the readback buffer count is greater than 1
+  public: Ogre2TextureReadback readback;
+
+  /// \brief Output format the second pass texture was created with
+  public: GpuRaysOutputFormat secondPassFormat = GROF_RANGE_RETRO_FLOAT32;
+
+  /// \brief True if the range and retro of each ray are written to one
+  /// RGBA texel and repacked on the CPU, because the packed single channel
+  /// texture would be wider than the render system allows
+  public: bool rgbaFallback = false;
+
   /// \brief Pointer to the ogre camera
   public: Ogre::Camera *ogreCamera = nullptr;
 
@@ -215,6 +340,10 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
 
   /// \brief Pointer to the particle target definition in the workspace
   public: Ogre::CompositorTargetDef *particleTargetDef{nullptr};
+
+  /// \brief Whether the particle target passes are enabled, -1 if they
+  /// were not configured since the target was created
+  public: int particlePassesEnabled{-1};
 };
 
 using namespace gz;
@@ -227,6 +356,27 @@ static const uint32_t kLaserRetro1stPassQuad = 9526u;
 /// \brief standard deviation of particle noise
 static const double kParticleStddev = 0.01;
 
+//////////////////////////////////////////////////
+/// \brief Get the laser retro value stored in the user data of a node
+/// \param[in] _node Node to get the value of
+/// \param[in] _key User data key of the laser retro value
+/// \return Laser retro value, 0 if it is not set or not a number
+static float UserDataLaserRetro(const Node &_node, const UserDataKey &_key)
+{
+  const Variant *value = _node.UserDataValue(_key);
+  if (!value)
+    return 0.0f;
+  if (auto f = std::get_if<float>(value))
+    return *f;
+  if (auto d = std::get_if<double>(value))
+    return static_cast<float>(*d);
+  if (auto i = std::get_if<int>(value))
+    return static_cast<float>(*i);
+  gzerr << "Error casting user data: laser_retro of [" << _node.Name()
+        << "] must be a float, double or int" << std::endl;
+  return 0.0f;
+}
+
 //////////////////////////////////////////////////
 Ogre2LaserRetroMaterialSwitcher::Ogre2LaserRetroMaterialSwitcher(
   Ogre2ScenePtr _scene, Ogre2GpuRays *_gpuRays, Ogre::Camera *_ogreCamera)
@@ -298,7 +448,7 @@ void Ogre2LaserRetroMaterialSwitcher::passPreExecute(
   const Ogre::HlmsBlendblock *noBlend =
     hlmsManager->getBlendblock(Ogre::HlmsBlendblock());
 
-  const std::string laserRetroKey = "laser_retro";
+  static const UserDataKey laserRetroKey("laser_retro");
 
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
@@ -316,7 +466,8 @@ void Ogre2LaserRetroMaterialSwitcher::passPreExecute(
       VisualPtr result;
       try
       {
-        result = this->scene->VisualById(Ogre::any_cast<unsigned int>(userAny));
+        result = this->scene->VisualByCompactId(
+            Ogre::any_cast<unsigned int>(userAny));
       }
       catch(Ogre::Exception &e)
       {
@@ -325,34 +476,8 @@ void Ogre2LaserRetroMaterialSwitcher::passPreExecute(
       Ogre2VisualPtr ogreVisual =
           std::dynamic_pointer_cast<Ogre2Visual>(result);
 
-      if (ogreVisual->HasUserData(laserRetroKey))
-      {
-        // get laser_retro
-        Variant tempLaserRetro = ogreVisual->UserData(laserRetroKey);
-
-        try
-        {
-          retroValue = std::get<float>(tempLaserRetro);
-        }
-        catch(...)
-        {
-          try
-          {
-            retroValue = static_cast<float>(std::get<double>(tempLaserRetro));
-          }
-          catch(...)
-          {
-            try
-            {
-              retroValue = static_cast<float>(std::get<int>(tempLaserRetro));
-            }
-            catch(std::bad_variant_access &e)
-            {
-              gzerr << "Error casting user data: " << e.what() << "\n";
-            }
-          }
-        }
-      }
+      // get laser_retro
+      retroValue = UserDataLaserRetro(*ogreVisual, laserRetroKey);
 
       // only accept positive laser retro value
       retroValue = std::max(retroValue, 0.0f);
@@ -446,34 +571,8 @@ void Ogre2LaserRetroMaterialSwitcher::passPreExecute(
       // get visual
       VisualPtr visual = heightmap->Parent();
 
-      if (visual->HasUserData(laserRetroKey))
-      {
-        // get laser_retro
-        Variant tempLaserRetro = visual->UserData(laserRetroKey);
-
-        try
-        {
-          retroValue = std::get<float>(tempLaserRetro);
-        }
-        catch (...)
-        {
-          try
-          {
-            retroValue = static_cast<float>(std::get<double>(tempLaserRetro));
-          }
-          catch (...)
-          {
-            try
-            {
-              retroValue = static_cast<float>(std::get<int>(tempLaserRetro));
-            }
-            catch (std::bad_variant_access &e)
-            {
-              gzerr << "Error casting user data: " << e.what() << "\n";
-            }
-          }
-        }
-      }
+      // get laser_retro
+      retroValue = UserDataLaserRetro(*visual, laserRetroKey);
 
       // only accept positive laser retro value
       retroValue = std::max(retroValue, 0.0f);
@@ -597,18 +696,29 @@ void Ogre2GpuRays::Destroy()
   if (!this->dataPtr->ogreCamera)
     return;
 
-  if (this->dataPtr->gpuRaysBuffer)
-  {
-    delete [] this->dataPtr->gpuRaysBuffer;
-    this->dataPtr->gpuRaysBuffer = nullptr;
-  }
+  this->DestroyGpuRaysTextures();
 
-  if (this->dataPtr->gpuRaysScan)
+  if (this->scene)
   {
-    delete [] this->dataPtr->gpuRaysScan;
-    this->dataPtr->gpuRaysScan = nullptr;
+    Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+    if (ogreSceneManager)
+    {
+      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
+      this->dataPtr->ogreCamera = nullptr;
+    }
   }
 
+  // call base node destroy to remove parent
+  Ogre2Node::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::DestroyGpuRaysTextures()
+{
+  // return the scan buffer to the pool
+  this->dataPtr->gpuRaysScanLease.reset();
+  this->dataPtr->gpuRaysScan = nullptr;
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   auto textureGpuManager = ogreRoot->getRenderSystem()->getTextureGpuManager();
@@ -629,27 +739,17 @@ void Ogre2GpuRays::Destroy()
       textureGpuManager->destroyTexture(this->dataPtr->firstPassTextures[i]);
       this->dataPtr->firstPassTextures[i] = nullptr;
     }
+    this->dataPtr->laserRetroMaterialSwitcher[i].reset();
   }
+  this->dataPtr->cubeFaceIdx.clear();
   this->dataPtr->particleTargetDef = nullptr;
+  this->dataPtr->particlePassesEnabled = -1;
 
   // remove 2nd pass texture, material, compositor
-  if (this->dataPtr->secondPassTexture)
-  {
-    textureGpuManager->destroyTexture(this->dataPtr->secondPassTexture);
-    this->dataPtr->secondPassTexture = nullptr;
-  }
-
-  if (this->dataPtr->ogreCompositorWorkspace2nd)
-  {
-    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
-    this->dataPtr->ogreCompositorWorkspace2nd = nullptr;
-  }
+  this->Destroy2ndPass();
 
-  if (this->dataPtr->cubeUVTexture)
-  {
-    textureGpuManager->destroyTexture(this->dataPtr->cubeUVTexture);
-    this->dataPtr->cubeUVTexture = nullptr;
-  }
+  this->dataPtr->sampleTexture.reset();
+  this->dataPtr->cubeUVTexture = nullptr;
   if (this->dataPtr->colorTexture)
   {
     textureGpuManager->destroyTexture(this->dataPtr->colorTexture);
@@ -671,24 +771,12 @@ void Ogre2GpuRays::Destroy()
     this->dataPtr->particleDepthTexture = nullptr;
   }
 
-  if (this->scene)
+  if (this->dataPtr->cubeCam && this->scene &&
+      this->scene->OgreSceneManager())
   {
-    Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
-    if (ogreSceneManager)
-    {
-      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
-      this->dataPtr->ogreCamera = nullptr;
-
-      if (this->dataPtr->cubeCam)
-      {
-        ogreSceneManager->destroyCamera(this->dataPtr->cubeCam);
-        this->dataPtr->cubeCam = nullptr;
-      }
-    }
+    this->scene->OgreSceneManager()->destroyCamera(this->dataPtr->cubeCam);
+    this->dataPtr->cubeCam = nullptr;
   }
-
-  // call base node destroy to remove parent
-  Ogre2Node::Destroy();
 }
 
 /////////////////////////////////////////////////
@@ -727,6 +815,15 @@ void Ogre2GpuRays::CreateCamera()
   this->dataPtr->ogreCamera->yaw(Ogre::Degree(-90));
   this->dataPtr->ogreCamera->roll(Ogre::Degree(-90));
   this->dataPtr->ogreCamera->setAutoAspectRatio(true);
+  this->dataPtr->ogreCamera->setLodBias(this->lodBias);
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::SetLodBias(double _bias)
+{
+  BaseGpuRays::SetLodBias(_bias);
+  if (this->dataPtr->ogreCamera)
+    this->dataPtr->ogreCamera->setLodBias(this->lodBias);
 }
 
 /////////////////////////////////////////////////
@@ -734,16 +831,31 @@ void Ogre2GpuRays::ConfigureCamera()
 {
   // horizontal gpu rays setup
   auto hfovAngle = this->AngleMax() - this->AngleMin();
+  auto vSpan = this->VerticalAngleMax() - this->VerticalAngleMin();
+
+  // scan patterns span the extents of their directions
+  if (!this->rayDirections.empty())
+  {
+    math::Vector2d dirMin = this->rayDirections.front();
+    math::Vector2d dirMax = dirMin;
+    for (const auto &dir : this->rayDirections)
+    {
+      dirMin.Min(dir);
+      dirMax.Max(dir);
+    }
+    hfovAngle = dirMax.X() - dirMin.X();
+    vSpan = dirMax.Y() - dirMin.Y();
+  }
   hfovAngle = std::max(this->dataPtr->kMinAllowedAngle, hfovAngle);
   this->SetHFOV(hfovAngle);
 
   // vertical laser setup
   double vfovAngle;
 
-  if (this->VerticalRangeCount() > 1)
+  if (this->VerticalRangeCount() > 1 || !this->rayDirections.empty())
   {
     vfovAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
-        (this->VerticalAngleMax() - this->VerticalAngleMin()).Radian());
+        vSpan.Radian());
   }
   else
   {
@@ -769,18 +881,6 @@ void Ogre2GpuRays::ConfigureCamera()
     static_cast<unsigned int>(
     GZ_PI_2 / vfovAngle * this->VerticalRangeCount());
 
-  // get the max number from the two
-  unsigned int v = std::max(hs, vs);
-  // round to next highest power of 2
-  // https://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
-  v--;
-  v |= v >> 1;
-  v |= v >> 2;
-  v |= v >> 4;
-  v |= v >> 8;
-  v |= v >> 16;
-  v++;
-
   // This is needed for large fov with low sample count,
   // e.g. 360 degrees and only 4 samples. Otherwise the depth data returned are
   // inaccurate.
@@ -788,14 +888,32 @@ void Ogre2GpuRays::ConfigureCamera()
   // requirement, e.g. a single ray lidar only needs 1x1 texture. However,
   // using lower res textures also give inaccurate results. Look for ways
   // to compute the optimal min texture size
-  unsigned int min1stPassSamples = 128u;
+  const unsigned int min1stPassSamples = 128u;
 
   // limit max texture size to 1024
-  unsigned int max1stPassSamples = 1024u;
-  unsigned int samples1stPass =
-      std::clamp(v, min1stPassSamples, max1stPassSamples);
+  const unsigned int max1stPassSamples = 1024u;
 
-  this->Set1stTextureSize(samples1stPass, samples1stPass);
+  auto textureSize = [&](unsigned int _samples)
+  {
+    // round to next highest power of 2
+    // https://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
+    unsigned int v = _samples;
+    v--;
+    v |= v >> 1;
+    v |= v >> 2;
+    v |= v >> 4;
+    v |= v >> 8;
+    v |= v >> 16;
+    v++;
+    return std::clamp(v, min1stPassSamples, max1stPassSamples);
+  };
+
+  // The side faces of the cubemap map horizontal rays to texture columns and
+  // vertical rays to texture rows, so each axis only needs the sample
+  // density of its own direction. This keeps e.g. 16 beam lidars from
+  // rendering as many rows as columns. See CreateGpuRaysTextures for the
+  // top and bottom faces.
+  this->Set1stTextureSize(textureSize(hs), textureSize(vs));
 
   // Configure second pass texture size
   this->SetRangeCount(this->RangeCount(), this->VerticalRangeCount());
@@ -836,20 +954,25 @@ math::Vector2d Ogre2GpuRays::SampleCubemap(const math::Vector3d &_v,
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::CreateSampleTexture()
 {
-  double min = this->AngleMin().Radian();
-  double max = this->AngleMax().Radian();
-  double vmin = this->VerticalAngleMin().Radian();
-  double vmax = this->VerticalAngleMax().Radian();
-
-  double hAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(), max - min);
-  double vAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
-      vmax - vmin);
-
-  double hStep = hAngle / static_cast<double>(this->dataPtr->w2nd-1);
-  double vStep = 1.0;
-  // non-planar case
-  if (this->dataPtr->h2nd > 1)
-    vStep = vAngle / static_cast<double>(this->dataPtr->h2nd-1);
+  const unsigned int w2nd = this->dataPtr->w2nd;
+  const unsigned int h2nd = this->dataPtr->h2nd;
+
+  // GpuRays of identical sensors share the texture, scan patterns are
+  // per sensor and may change every frame
+  const Ogre2GpuRaysSampleTexture::Key key{this->AngleMin().Radian(),
+      this->AngleMax().Radian(), this->VerticalAngleMin().Radian(),
+      this->VerticalAngleMax().Radian(), w2nd, h2nd};
+  if (this->rayDirections.empty())
+  {
+    this->dataPtr->sampleTexture = Ogre2GpuRaysSampleTexture::Find(key);
+    if (this->dataPtr->sampleTexture)
+    {
+      this->dataPtr->cubeUVTexture = this->dataPtr->sampleTexture->texture;
+      this->dataPtr->cubeFaceIdx = this->dataPtr->sampleTexture->faces;
+      this->dataPtr->faceScanTimes = this->dataPtr->sampleTexture->faceTimes;
+      return;
+    }
+  }
 
   // create an RGB texture (cubeUVTex) to pack info that tells the shaders how
   // to sample from the cubemap textures.
@@ -863,8 +986,11 @@ void Ogre2GpuRays::CreateSampleTexture()
   auto ogreRoot = engine->OgreRoot();
   Ogre::TextureGpuManager *textureMgr =
     ogreRoot->getRenderSystem()->getTextureGpuManager();
-  std::string texName = this->Name() + "_samplerTex";
-  this->dataPtr->cubeUVTexture =
+  static unsigned int sampleTextureCount = 0u;
+  std::string texName = "GpuRaysSamplerTex_" +
+      std::to_string(sampleTextureCount++);
+  auto sampleTexture = std::make_shared<Ogre2GpuRaysSampleTexture>();
+  sampleTexture->texture =
     textureMgr->createOrRetrieveTexture(
       texName,
       Ogre::GpuPageOutStrategy::SaveToSystemRam,
@@ -872,10 +998,11 @@ void Ogre2GpuRays::CreateSampleTexture()
       Ogre::TextureTypes::Type2D,
       Ogre::BLANKSTRING,
       0u);
+  this->dataPtr->sampleTexture = sampleTexture;
+  this->dataPtr->cubeUVTexture = sampleTexture->texture;
 
   this->dataPtr->cubeUVTexture->setTextureType(Ogre::TextureTypes::Type2D);
-  this->dataPtr->cubeUVTexture->setResolution(
-    this->dataPtr->w2nd, this->dataPtr->h2nd);
+  this->dataPtr->cubeUVTexture->setResolution(w2nd, h2nd);
   this->dataPtr->cubeUVTexture->setNumMipmaps(1u);
   this->dataPtr->cubeUVTexture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
 
@@ -888,44 +1015,111 @@ void Ogre2GpuRays::CreateSampleTexture()
     this->dataPtr->cubeUVTexture->getPixelFormat(),
     rowAlignment);
 
-  const size_t bytesPerRow =
-    this->dataPtr->cubeUVTexture->_getSysRamCopyBytesPerRow( 0 );
   float *pDest = reinterpret_cast<float*>(
     OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
+  this->FillSampleTable(pDest, sampleTexture->faces,
+      sampleTexture->faceTimes);
+  this->dataPtr->cubeFaceIdx = sampleTexture->faces;
+  this->dataPtr->faceScanTimes = sampleTexture->faceTimes;
+  if (this->rayDirections.empty())
+    Ogre2GpuRaysSampleTexture::Add(key, sampleTexture);
+
+  this->dataPtr->cubeUVTexture->_transitionTo(
+    Ogre::GpuResidency::Resident,
+    reinterpret_cast<Ogre::uint8*>(pDest) );
+  this->UploadSampleTable(pDest);
+  // Do not free the pointer if texture's paging strategy is
+  // GpuPageOutStrategy::AlwaysKeepSystemRamCopy
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::FillSampleTable(float *_data,
+    std::set<unsigned int> &_faces, std::array<double, 6> &_faceTimes)
+{
+  double min = this->AngleMin().Radian();
+  double max = this->AngleMax().Radian();
+  double vmin = this->VerticalAngleMin().Radian();
+  double vmax = this->VerticalAngleMax().Radian();
+  const unsigned int w2nd = this->dataPtr->w2nd;
+  const unsigned int h2nd = this->dataPtr->h2nd;
+  const std::vector<math::Vector2d> &pattern = this->rayDirections;
+
+  double hAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(), max - min);
+  double vAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
+      vmax - vmin);
+
+  double hStep = hAngle / static_cast<double>(w2nd-1);
+  double vStep = 1.0;
+  // non-planar case
+  if (h2nd > 1)
+    vStep = vAngle / static_cast<double>(h2nd-1);
 
-  double v = vmin;
-  int index = 0;
-  for (unsigned int i = 0; i < this->dataPtr->h2nd; ++i)
+  // rows are independent so fill them on the worker threads
+  this->scene->ParallelForRows(h2nd,
+      [&](unsigned int _begin, unsigned int _end)
   {
-    double h = min;
-    for (unsigned int j = 0; j < this->dataPtr->w2nd; ++j)
+    for (unsigned int i = _begin; i < _end; ++i)
     {
-      // set up dir vector to sample from a standard Y up cubemap
-      math::Vector3d ray(0, 0, 1);
-      ray.Normalize();
-      math::Quaterniond pitch(math::Vector3d(1, 0, 0), -v);
-      math::Quaterniond yaw(math::Vector3d(0, 1, 0), -h);
-      math::Vector3d dir = yaw * pitch * ray;
-      unsigned int faceIdx;
-      math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
-      this->dataPtr->cubeFaceIdx.insert(faceIdx);
-      // gzdbg << "p(" << pitch << ") y(" << yaw << "): " << dir << " | "
-      //       << uv << " | " << faceIdx << std::endl;
-      // u
-      pDest[index++] = uv.X();
-      // v
-      pDest[index++] = uv.Y();
-      // face
-      pDest[index++] = static_cast<float>(faceIdx);
-      // unused
-      pDest[index++] = 1.0;
-      h += hStep;
+      const double rowV = vmin + i * vStep;
+      const double rowCosV = std::cos(rowV);
+      const double rowSinV = std::sin(rowV);
+      int index = i * w2nd * 4;
+      for (unsigned int j = 0; j < w2nd; ++j)
+      {
+        double h = min + j * hStep;
+        double cosV = rowCosV;
+        double sinV = rowSinV;
+        if (!pattern.empty())
+        {
+          const math::Vector2d &ray = pattern[i * w2nd + j];
+          h = ray.X();
+          cosV = std::cos(ray.Y());
+          sinV = std::sin(ray.Y());
+        }
+        // dir vector to sample from a standard Y up cubemap, i.e. the
+        // +Z axis pitched by -v about X then yawed by -h about Y
+        math::Vector3d dir(-cosV * std::sin(h), sinV, cosV * std::cos(h));
+        unsigned int faceIdx;
+        math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
+        // u
+        _data[index++] = uv.X();
+        // v
+        _data[index++] = uv.Y();
+        // face
+        _data[index++] = static_cast<float>(faceIdx);
+        // unused
+        _data[index++] = 1.0;
+      }
     }
-    v += vStep;
+  });
+
+  // columns are scanned in order, see SetScanMotion
+  std::array<double, 6> timeSums{};
+  std::array<unsigned int, 6> rayCounts{};
+  _faces.clear();
+  for (size_t i = 0u; i < static_cast<size_t>(w2nd) * h2nd; ++i)
+  {
+    const unsigned int face = static_cast<unsigned int>(_data[i * 4u + 2u]);
+    _faces.insert(face);
+    timeSums[face] += w2nd > 1u ?
+        static_cast<double>(i % w2nd) / static_cast<double>(w2nd - 1u) : 0.5;
+    ++rayCounts[face];
   }
-  this->dataPtr->cubeUVTexture->_transitionTo(
-    Ogre::GpuResidency::Resident,
-    reinterpret_cast<Ogre::uint8*>(pDest) );
+  for (unsigned int i = 0u; i < _faceTimes.size(); ++i)
+    _faceTimes[i] = rayCounts[i] > 0u ? timeSums[i] / rayCounts[i] : 0.5;
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::UploadSampleTable(const float *_data)
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
+  const size_t bytesPerRow =
+    this->dataPtr->cubeUVTexture->_getSysRamCopyBytesPerRow( 0 );
+
   // We have to upload the data via a StagingTexture, which acts as an
   // intermediate stash memory that is both visible to CPU and GPU.
   Ogre::StagingTexture *stagingTexture = textureMgr->getStagingTexture(
@@ -945,7 +1139,7 @@ void Ogre2GpuRays::CreateSampleTexture()
     this->dataPtr->cubeUVTexture->getPixelFormat());
 
   texBox.copyFrom(
-    pDest,
+    _data,
     this->dataPtr->cubeUVTexture->getWidth(),
     this->dataPtr->cubeUVTexture->getHeight(),
     bytesPerRow);
@@ -954,9 +1148,6 @@ void Ogre2GpuRays::CreateSampleTexture()
   // Tell the TextureGpuManager we're done with this StagingTexture.
   // Otherwise it will leak.
   textureMgr->removeStagingTexture(stagingTexture);
-  stagingTexture = 0;
-  // Do not free the pointer if texture's paging strategy is
-  // GpuPageOutStrategy::AlwaysKeepSystemRamCopy
 }
 
 /////////////////////////////////////////////////////////
@@ -1045,6 +1236,7 @@ void Ogre2GpuRays::Setup1stPass()
 
   Ogre::CompositorTargetDef *target1 = nodeDef->getTargetPass(1);
   this->dataPtr->particleTargetDef = target1;
+  this->dataPtr->particlePassesEnabled = -1;
   GZ_ASSERT(this->dataPtr->particleTargetDef != nullptr,
             "Unable to get particle target in Ogre2GpuRays");
 
@@ -1134,11 +1326,54 @@ void Ogre2GpuRays::Setup2ndPass()
       Ogre::TextureFlags::RenderToTexture,
       Ogre::TextureTypes::Type2D);
 
+  // Metal does not support RGB32_FLOAT so instead of rendering to an RGBA
+  // texture and repacking on the CPU, the 2nd pass shader writes the
+  // range, retro and unused channels of each ray to 3 consecutive texels of
+  // a single channel texture that is 3 times as wide
+  // (see gpu_rays_2nd_pass_fs.glsl). The downloaded data is then already in
+  // the RGB layout of the output buffer. The compact formats are written
+  // directly as one texel per ray, and so are the ranges of scans too wide
+  // for the packed texture, which are repacked on the CPU in ProcessData.
+  this->dataPtr->secondPassFormat = this->outputFormat;
+  this->dataPtr->rgbaFallback = false;
+  unsigned int texelsPerRay = 1u;
+  Ogre::PixelFormatGpu pixelFormat = Ogre::PFG_R32_FLOAT;
+  switch (this->outputFormat)
+  {
+    case GROF_RANGE_RETRO_FLOAT16:
+      pixelFormat = Ogre::PFG_RG16_FLOAT;
+      break;
+    case GROF_RANGE_UINT16_MM:
+      pixelFormat = Ogre::PFG_R16_UNORM;
+      break;
+    case GROF_MULTI_RETURN_FLOAT32:
+    case GROF_POINT_XYZI_FLOAT32:
+      pixelFormat = Ogre::PFG_RGBA32_FLOAT;
+      break;
+    case GROF_RANGE_FLOAT32:
+      break;
+    case GROF_RANGE_RETRO_FLOAT32:
+    default:
+    {
+      // fall back to one RGBA texel per ray for wide scans
+      const uint32_t maxWidth = ogreRoot->getRenderSystem()->
+          getCapabilities()->getMaximumResolution2D();
+      if (maxWidth > 0u && this->dataPtr->w2nd * this->Channels() > maxWidth)
+      {
+        this->dataPtr->rgbaFallback = true;
+        pixelFormat = Ogre::PFG_RGBA32_FLOAT;
+      }
+      else
+      {
+        texelsPerRay = this->Channels();
+      }
+      break;
+    }
+  }
   this->dataPtr->secondPassTexture->setResolution(
-    this->dataPtr->w2nd, this->dataPtr->h2nd);
+    this->dataPtr->w2nd * texelsPerRay, this->dataPtr->h2nd);
   this->dataPtr->secondPassTexture->setNumMipmaps(1u);
-  this->dataPtr->secondPassTexture->setPixelFormat(
-    Ogre::PFG_RGBA32_FLOAT);
+  this->dataPtr->secondPassTexture->setPixelFormat(pixelFormat);
   this->dataPtr->secondPassTexture->_setDepthBufferDefaults(
     Ogre::DepthBuffer::POOL_NO_DEPTH, false, Ogre::PFG_UNKNOWN);
 
@@ -1190,6 +1425,31 @@ void Ogre2GpuRays::Setup2ndPass()
         false);
 }
 
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::Destroy2ndPass()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+
+  // the tickets hold frames in the format of the texture
+  this->dataPtr->readback.Destroy();
+
+  if (this->dataPtr->secondPassTexture)
+  {
+    auto textureGpuManager =
+        ogreRoot->getRenderSystem()->getTextureGpuManager();
+    textureGpuManager->destroyTexture(this->dataPtr->secondPassTexture);
+    this->dataPtr->secondPassTexture = nullptr;
+  }
+
+  if (this->dataPtr->ogreCompositorWorkspace2nd)
+  {
+    Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
+    this->dataPtr->ogreCompositorWorkspace2nd = nullptr;
+  }
+}
+
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::CreateGpuRaysTextures()
 {
@@ -1202,8 +1462,18 @@ void Ogre2GpuRays::CreateGpuRaysTextures()
   double boxSize = this->NearClipPlane() * 2 / std::sqrt(3.0);
   this->dataPtr->nearClipCube = boxSize * 0.5;
 
+  this->dataPtr->rayDirectionsDirty = false;
   this->ConfigureCamera();
   this->CreateSampleTexture();
+
+  // The top and bottom faces mix horizontal and vertical rays along both
+  // texture axes so they need the same resolution on both
+  if (this->dataPtr->cubeFaceIdx.count(2u) ||
+      this->dataPtr->cubeFaceIdx.count(3u))
+  {
+    unsigned int size = std::max(this->dataPtr->w1st, this->dataPtr->h1st);
+    this->Set1stTextureSize(size, size);
+  }
   this->Setup1stPass();
   this->Setup2ndPass();
 }
@@ -1217,10 +1487,29 @@ void Ogre2GpuRays::UpdateRenderTarget1stPass()
   this->dataPtr->mainPassSceneDef->setVisibilityMask(
     this->VisibilityMask() & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
 
+  const math::Pose3d worldPose = this->WorldPose();
+
   // update the compositors
   for (auto i : this->dataPtr->cubeFaceIdx)
   {
-    this->dataPtr->cubeCam->setOrientation(Ogre::Quaternion::IDENTITY);
+    Ogre::Vector3 facePos = Ogre::Vector3::ZERO;
+    Ogre::Quaternion faceRot = Ogre::Quaternion::IDENTITY;
+    if (this->dataPtr->scanMotion)
+    {
+      // render the face from the pose the sensor had when it cast the
+      // rays of the face, relative to the sensor node
+      const double t = this->dataPtr->faceScanTimes[i];
+      const math::Pose3d &start = this->dataPtr->scanStart;
+      const math::Pose3d &end = this->dataPtr->scanEnd;
+      const math::Vector3d pos = start.Pos() + (end.Pos() - start.Pos()) * t;
+      const math::Quaterniond rot =
+          math::Quaterniond::Slerp(t, start.Rot(), end.Rot(), true);
+      facePos = Ogre2Conversions::Convert(
+          worldPose.Rot().RotateVectorReverse(pos - worldPose.Pos()));
+      faceRot = Ogre2Conversions::Convert(worldPose.Rot().Inverse() * rot);
+    }
+    this->dataPtr->cubeCam->setPosition(facePos);
+    this->dataPtr->cubeCam->setOrientation(faceRot);
     this->dataPtr->cubeCam->yaw(Ogre::Degree(-90));
     this->dataPtr->cubeCam->roll(Ogre::Degree(-90));
     // orient camera to its corresponding cubemap face
@@ -1255,6 +1544,40 @@ void Ogre2GpuRays::UpdateRenderTarget1stPass()
 /////////////////////////////////////////////////
 void Ogre2GpuRays::UpdateRenderTarget2ndPass()
 {
+  // The 2nd pass material is shared by all gpu rays sensors so set the
+  // output layout before each update (see gpu_rays_2nd_pass_fs.glsl)
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName("GpuRaysScan2nd");
+  if (mat)
+  {
+    float texelsPerRay = 1.0f;
+    float rangeScale = 1.0f;
+    if (this->dataPtr->secondPassFormat == GROF_RANGE_RETRO_FLOAT32 &&
+        !this->dataPtr->rgbaFallback)
+    {
+      texelsPerRay = static_cast<float>(this->Channels());
+    }
+    else if (this->dataPtr->secondPassFormat == GROF_RANGE_UINT16_MM)
+      rangeScale = 1000.0f / 65535.0f;
+
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        mat->getTechnique(0u)->getPass(0u)->getFragmentProgramParameters();
+    psParams->setNamedConstant("texelsPerRay", texelsPerRay);
+    psParams->setNamedConstant("rangeScale", rangeScale);
+    psParams->setNamedConstant("multiReturn",
+        this->dataPtr->secondPassFormat == GROF_MULTI_RETURN_FLOAT32 ?
+        1.0f : 0.0f);
+    psParams->setNamedConstant("pointCloud",
+        this->dataPtr->secondPassFormat == GROF_POINT_XYZI_FLOAT32 ?
+        1.0f : 0.0f);
+    psParams->setNamedConstant("beamSamples",
+        static_cast<float>(this->beamSamples));
+    psParams->setNamedConstant("beamRadius",
+        static_cast<float>(this->beamDivergence * 0.5));
+    psParams->setNamedConstant("farRange",
+        static_cast<float>(this->FarClipPlane()));
+  }
+
   this->dataPtr->ogreCompositorWorkspace2nd->_validateFinalTarget();
   this->dataPtr->ogreCompositorWorkspace2nd->_beginUpdate(false);
   this->dataPtr->ogreCompositorWorkspace2nd->_update();
@@ -1268,6 +1591,9 @@ void Ogre2GpuRays::UpdateRenderTarget2ndPass()
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
+  Ogre2StaticBatchBypass bypass(this->scene);
   this->scene->StartRendering(this->dataPtr->ogreCamera);
 
   auto engine = Ogre2RenderEngine::Instance();
@@ -1286,104 +1612,246 @@ void Ogre2GpuRays::Render()
   this->UpdateRenderTarget2ndPass();
   hlmsCustomizations.minDistanceClip = -1;
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(6u, false);
+  // only the cubemap faces hit by rays were rendered (see
+  // CreateSampleTexture)
+  this->scene->FlushGpuCommandsAndStartNewFrame(
+      static_cast<uint8_t>(this->dataPtr->cubeFaceIdx.size()), false);
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::PreRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
   if (!this->dataPtr->cubeUVTexture)
     this->CreateGpuRaysTextures();
+  else if (this->dataPtr->rayDirectionsDirty)
+    this->UpdateRayDirections();
+
+  if (this->dataPtr->secondPassFormat != this->outputFormat)
+  {
+    // output format changed, recreate the 2nd pass target and output buffer
+    this->Destroy2ndPass();
+    this->dataPtr->gpuRaysScanLease.reset();
+    this->dataPtr->gpuRaysScan = nullptr;
+    this->Setup2ndPass();
+  }
 
   if (this->dataPtr->particleTargetDef)
   {
-    bool hasParticles =
-        this->scene->OgreSceneManager()->getMovableObjectIterator(
-        Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME).hasMoreElements();
-    Ogre::CompositorPassDefVec &particlePasses =
-        this->dataPtr->particleTargetDef->getCompositorPassesNonConst();
-    GZ_ASSERT(particlePasses.size() == 2u,
-        "Ogre2DepthCamera particle target should 2 passes");
-    GZ_ASSERT(particlePasses[0]->getType() == Ogre::PASS_CLEAR,
-        "Ogre2DepthCamera particle target should start with a clear pass");
-    GZ_ASSERT(particlePasses[1]->getType() == Ogre::PASS_SCENE,
-        "Ogre2DepthCamera particle target should end with a scene pass");
-    particlePasses[0]->mExecutionMask =
-      (hasParticles) ? ~this->dataPtr->kGpuRaysExecutionMask :
-                       this->dataPtr->kGpuRaysExecutionMask;
-    particlePasses[1]->mExecutionMask =
-      (hasParticles) ? this->dataPtr->kGpuRaysExecutionMask :
-                       ~this->dataPtr->kGpuRaysExecutionMask;
+    // the scene counts its particle systems, so we only need to touch the
+    // passes when particles appear or disappear
+    const int hasParticles = this->scene->HasParticleSystems() ? 1 : 0;
+    if (hasParticles != this->dataPtr->particlePassesEnabled)
+    {
+      Ogre::CompositorPassDefVec &particlePasses =
+          this->dataPtr->particleTargetDef->getCompositorPassesNonConst();
+      GZ_ASSERT(particlePasses.size() == 2u,
+          "Ogre2DepthCamera particle target should 2 passes");
+      GZ_ASSERT(particlePasses[0]->getType() == Ogre::PASS_CLEAR,
+          "Ogre2DepthCamera particle target should start with a clear pass");
+      GZ_ASSERT(particlePasses[1]->getType() == Ogre::PASS_SCENE,
+          "Ogre2DepthCamera particle target should end with a scene pass");
+      particlePasses[0]->mExecutionMask =
+        (hasParticles) ? ~this->dataPtr->kGpuRaysExecutionMask :
+                         this->dataPtr->kGpuRaysExecutionMask;
+      particlePasses[1]->mExecutionMask =
+        (hasParticles) ? this->dataPtr->kGpuRaysExecutionMask :
+                         ~this->dataPtr->kGpuRaysExecutionMask;
+      this->dataPtr->particlePassesEnabled = hasParticles;
+    }
   }
 }
 
 //////////////////////////////////////////////////
-void Ogre2GpuRays::PostRender()
+bool Ogre2GpuRays::HasConnections() const
 {
-  unsigned int width = this->dataPtr->w2nd;
-  unsigned int height = this->dataPtr->h2nd;
+  return this->dataPtr->newGpuRaysFrame.ConnectionCount() > 0u ||
+      this->dataPtr->newFrameView.ConnectionCount() > 0u ||
+      BaseGpuRays::HasConnections();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2GpuRays::ReleaseRenderTextures()
+{
+  if (!this->dataPtr->cubeUVTexture)
+    return false;
 
-  PixelFormat format = PF_FLOAT32_RGBA;
-  unsigned int rawChannelCount = PixelUtil::ChannelCount(format);
-  unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
-  int rawLen = width * height * rawChannelCount;
+  // everything is recreated in PreRender, like after a new scan pattern
+  this->DestroyGpuRaysTextures();
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2GpuRays::MemoryUsage() const
+{
+  // the sample texture is shared with other sensors of the same scan
+  // pattern and not included
+  size_t bytes = 0u;
+  for (auto i : this->dataPtr->cubeFaceIdx)
+  {
+    bytes += Ogre2RenderEngine::WorkspaceSizeBytes(
+        this->dataPtr->ogreCompositorWorkspace1st[i]);
+    bytes += Ogre2RenderEngine::TextureSizeBytes(
+        this->dataPtr->firstPassTextures[i]);
+  }
+  bytes += Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorWorkspace2nd);
+  for (const Ogre::TextureGpu *texture :
+       {this->dataPtr->secondPassTexture, this->dataPtr->colorTexture,
+        this->dataPtr->depthTexture, this->dataPtr->particleTexture,
+        this->dataPtr->particleDepthTexture})
+  {
+    bytes += Ogre2RenderEngine::TextureSizeBytes(texture);
+  }
+  return bytes;
+}
 
-  if (!this->dataPtr->gpuRaysBuffer)
+//////////////////////////////////////////////////
+void Ogre2GpuRays::PostRender()
+{
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
+  if (this->readbackBufferCount > 1u)
   {
-    this->dataPtr->gpuRaysBuffer = new float[rawLen];
+    // queue the download of the frame that was just rendered and deliver
+    // the oldest frame in the ring
+    this->dataPtr->readback.Download(this->dataPtr->secondPassTexture,
+        this->readbackBufferCount, this->renderFrameInfo);
+
+    Ogre::TextureBox box;
+    FrameInfo info;
+    if (!this->dataPtr->readback.Map(box, info))
+      return;
+
+    this->EndFrameInfo(info);
+    this->dataTime = info.time;
+    this->ProcessData(box.data, box.bytesPerRow);
+    this->dataPtr->readback.Unmap();
+    return;
   }
 
   // blit data from gpu to cpu
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->secondPassTexture, 0u, 0u);
-  Ogre::TextureBox box = image.getData(0u);
-  float *bufferTmp = static_cast<float *>(box.data);
+  Ogre::TextureBox box;
+  if (!this->dataPtr->readback.Read(this->dataPtr->secondPassTexture, box))
+    return;
+  this->EndFrameInfo(this->renderFrameInfo);
+  this->dataTime = this->frameInfo.time;
+  this->ProcessData(box.data, box.bytesPerRow);
+  this->dataPtr->readback.Unmap();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::ProcessData(const void *_data, size_t _bytesPerRow)
+{
+  unsigned int width = this->dataPtr->w2nd;
+  unsigned int height = this->dataPtr->h2nd;
 
-  // TODO(anyone): It seems wasteful to have gpuRaysBuffer at all
-  // We should be able to convert directly from bufferTmp to gpuRaysScan
+  // the 2nd pass texture already holds the data in the output layout,
+  // see Setup2ndPass
+  PixelFormat format = PF_FLOAT32_RGB;
+  switch (this->dataPtr->secondPassFormat)
+  {
+    case GROF_RANGE_FLOAT32:
+      format = PF_FLOAT32_R;
+      break;
+    case GROF_RANGE_RETRO_FLOAT16:
+      format = PF_FLOAT16_RG;
+      break;
+    case GROF_RANGE_UINT16_MM:
+      format = PF_L16;
+      break;
+    case GROF_MULTI_RETURN_FLOAT32:
+    case GROF_POINT_XYZI_FLOAT32:
+      format = PF_FLOAT32_RGBA;
+      break;
+    case GROF_RANGE_RETRO_FLOAT32:
+    default:
+      if (this->dataPtr->rgbaFallback)
+        format = PF_FLOAT32_RGBA;
+      break;
+  }
+  unsigned int bytesPerRow = PixelUtil::BytesPerPixel(format) * width;
 
-  // copy data row by row. The texture box may not be a contiguous region of
-  // a texture
-  for (unsigned int i = 0; i < height; ++i)
+  const uint8_t *bufferTmp = static_cast<const uint8_t *>(_data);
+
+  // frame view listeners read the downloaded data directly
+  if (this->dataPtr->newFrameView.ConnectionCount() > 0u)
   {
-    unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-    unsigned int rowIdx = i * width * rawChannelCount;
-    memcpy(&this->dataPtr->gpuRaysBuffer[rowIdx], &bufferTmp[rawDataRowIdx],
-        width * rawChannelCount * bytesPerChannel);
+    FrameView view;
+    view.data = _data;
+    view.width = width;
+    view.height = height;
+    view.rowPitch = _bytesPerRow;
+    view.format = format;
+    view.info = this->frameInfo;
+    this->dataPtr->newFrameView(view);
+
+    // skip filling gpuRaysScan if no one else needs it
+    if (this->dataPtr->newGpuRaysFrame.ConnectionCount() == 0u)
+      return;
   }
 
-  // Metal does not support RGB32_FLOAT so the internal texture format is
-  // RGBA32_FLOAT. For backward compatibility, output data is kept in RGB
-  // format instead of RGBA
+  // gpuRaysScan only holds float32 data, the compact formats are only
+  // available through frame views
+  if (format == PF_FLOAT16_RG || format == PF_L16)
+    return;
+
   int outputLen = width * height * this->Channels();
-  if (!this->dataPtr->gpuRaysScan)
+  this->dataPtr->gpuRaysScan = reinterpret_cast<float *>(
+      this->scene->Engine()->BufferPool().Reserve(
+      this->dataPtr->gpuRaysScanLease, outputLen * sizeof(float)));
+
+  // copy data in one go unless the texture box rows are padded
+  uint8_t *scan = reinterpret_cast<uint8_t *>(this->dataPtr->gpuRaysScan);
+  if (this->dataPtr->rgbaFallback)
+  {
+    // drop the 4th channel of the RGBA texels, the output is RGB
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      const float *src = reinterpret_cast<const float *>(
+          &bufferTmp[row * _bytesPerRow]);
+      float *dst = &this->dataPtr->gpuRaysScan[row * width * 3u];
+      for (unsigned int column = 0; column < width; ++column)
+        memcpy(&dst[column * 3u], &src[column * 4u], 3u * sizeof(float));
+    }
+    format = PF_FLOAT32_RGB;
+  }
+  else if (_bytesPerRow == bytesPerRow)
+  {
+    memcpy(scan, bufferTmp, bytesPerRow * height);
+  }
+  else
   {
-    this->dataPtr->gpuRaysScan = new float[outputLen];
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      memcpy(&scan[row * bytesPerRow], &bufferTmp[row * _bytesPerRow],
+          bytesPerRow);
+    }
   }
 
-  // copy data from RGBA buffer to RGB buffer
-  for (unsigned int row = 0; row < height; ++row)
+  if (this->dataPtr->secondPassFormat == GROF_POINT_XYZI_FLOAT32 &&
+      this->pointCloudCompaction)
   {
-    // the texture box step size could be larger than our image buffer step
-    // size
-    for (unsigned int column = 0; column < width; ++column)
+    // drop the rays without a return, they lie at the no-hit range
+    const float farClip = static_cast<float>(this->FarClipPlane());
+    const size_t rayCount = static_cast<size_t>(width) * height;
+    float *points = this->dataPtr->gpuRaysScan;
+    size_t pointCount = 0u;
+    for (size_t i = 0u; i < rayCount; ++i)
     {
-      unsigned int idx = (row * width * this->Channels()) +
-          column * this->Channels();
-      unsigned int rawIdx = (row * width * rawChannelCount) +
-          column * rawChannelCount;
-
-      this->dataPtr->gpuRaysScan[idx] =
-          this->dataPtr->gpuRaysBuffer[rawIdx];
-      this->dataPtr->gpuRaysScan[idx + 1] =
-          this->dataPtr->gpuRaysBuffer[rawIdx + 1];
-      this->dataPtr->gpuRaysScan[idx + 2] =
-          this->dataPtr->gpuRaysBuffer[rawIdx + 2];
+      const float *p = &points[i * 4u];
+      if (p[0] * p[0] + p[1] * p[1] + p[2] * p[2] < farClip * farClip)
+      {
+        if (pointCount != i)
+          memcpy(&points[pointCount * 4u], p, 4u * sizeof(float));
+        ++pointCount;
+      }
     }
+    width = static_cast<unsigned int>(pointCount);
+    height = 1u;
   }
 
   this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
-      width, height, this->Channels(), "PF_FLOAT32_RGB");
+      width, height, this->Channels(), "PF_" + PixelUtil::Name(format));
 
   // Uncomment to debug output
   // std::cerr << "wxh: " << width << " x " << height << std::endl;
@@ -1404,20 +1872,145 @@ void Ogre2GpuRays::PostRender()
   // }
 }
 
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2GpuRays::ConnectNewFrameView(
+    Camera::NewFrameViewListener _listener)
+{
+  return this->dataPtr->newFrameView.Connect(_listener);
+}
+
 //////////////////////////////////////////////////
 const float* Ogre2GpuRays::Data() const
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   return this->dataPtr->gpuRaysScan;
 }
 
+//////////////////////////////////////////////////
+std::shared_ptr<const float> Ogre2GpuRays::AcquireData() const
+{
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
+  if (!this->dataPtr->gpuRaysScanLease)
+    return nullptr;
+  // the lease keeps the pool from handing the buffer out again, the next
+  // frames are written into other buffers until it is released
+  return std::shared_ptr<const float>(this->dataPtr->gpuRaysScanLease,
+      this->dataPtr->gpuRaysScan);
+}
+
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Copy(float *_dataDest)
 {
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
   unsigned int width = this->dataPtr->w2nd;
   unsigned int height = this->dataPtr->h2nd;
 
+  if (!this->dataPtr->gpuRaysScan)
+    return;
+
   memcpy(_dataDest, this->dataPtr->gpuRaysScan,
-    width * height * 3 * sizeof(float));
+    width * height * this->Channels() * sizeof(float));
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::SetOutputFormat(GpuRaysOutputFormat _format)
+{
+  // the 2nd pass target is recreated in PreRender if needed
+  this->outputFormat = _format;
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::SetRayDirections(
+    const std::vector<math::Vector2d> &_directions, unsigned int _width)
+{
+  if (!_directions.empty() &&
+      (_width == 0u || _directions.size() % _width != 0u))
+  {
+    gzerr << "The number of ray directions [" << _directions.size()
+          << "] is not a multiple of the number of rays per row ["
+          << _width << "]" << std::endl;
+    return;
+  }
+
+  // the textures are updated in PreRender
+  this->rayDirections = _directions;
+  this->rayDirectionsWidth = _directions.empty() ? 0u : _width;
+  this->dataPtr->rayDirectionsDirty = true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::SetScanMotion(const math::Pose3d &_start,
+    const math::Pose3d &_end)
+{
+  this->dataPtr->scanStart = _start;
+  this->dataPtr->scanEnd = _end;
+  this->dataPtr->scanMotion = true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::ClearScanMotion()
+{
+  this->dataPtr->scanMotion = false;
+}
+
+/////////////////////////////////////////////////
+bool Ogre2GpuRays::HasScanMotion() const
+{
+  return this->dataPtr->scanMotion;
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::SetBeamDivergence(double _divergence,
+    unsigned int _samples)
+{
+  if (!(_divergence >= 0.0) || _samples < 1u || _samples > 16u)
+  {
+    gzerr << "Invalid beam divergence [" << _divergence << "] or number of "
+          << "samples per beam [" << _samples << "]" << std::endl;
+    return;
+  }
+  this->beamDivergence = _divergence;
+  this->beamSamples = _samples;
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::UpdateRayDirections()
+{
+  this->dataPtr->rayDirectionsDirty = false;
+
+  // a pattern of the same size only needs a new sample texture, as long as
+  // its rays stay on the cubemap faces that are rendered
+  if (!this->rayDirections.empty() && !this->dataPtr->sampleTexture->shared &&
+      this->dataPtr->w2nd == static_cast<unsigned int>(this->RangeCount()) &&
+      this->dataPtr->h2nd ==
+      static_cast<unsigned int>(this->VerticalRangeCount()))
+  {
+    const size_t dataSize = Ogre::PixelFormatGpuUtils::getSizeBytes(
+        this->dataPtr->w2nd, this->dataPtr->h2nd, 1u, 1u,
+        this->dataPtr->cubeUVTexture->getPixelFormat(), 1u);
+    float *data = reinterpret_cast<float *>(
+        OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
+    std::set<unsigned int> faces;
+    std::array<double, 6> faceTimes;
+    this->FillSampleTable(data, faces, faceTimes);
+    const bool rendered = std::includes(
+        this->dataPtr->cubeFaceIdx.begin(), this->dataPtr->cubeFaceIdx.end(),
+        faces.begin(), faces.end());
+    if (rendered)
+    {
+      this->UploadSampleTable(data);
+      this->dataPtr->faceScanTimes = faceTimes;
+    }
+    OGRE_FREE_SIMD(data, Ogre::MEMCATEGORY_RESOURCE);
+    if (rendered)
+      return;
+  }
+
+  this->DestroyGpuRaysTextures();
+  this->CreateGpuRaysTextures();
 }
 
 /////////////////////////////////////////////////
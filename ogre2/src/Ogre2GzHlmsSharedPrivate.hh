@@ -39,6 +39,7 @@ namespace gz
     inline namespace GZ_RENDERING_VERSION_NAMESPACE
     {
     typedef gz::rendering::GzOgreRenderingMode GzOgreRenderingMode;
+    typedef gz::rendering::GzOgreItemAttribute GzOgreItemAttribute;
     typedef Ogre::vector<Ogre::ConstBufferPacked*>::type ConstBufferPackedVec;
 
     /// \brief Implements code shared across all or most of our Hlms
@@ -116,6 +117,10 @@ namespace gz
       /// \brief See GzOgreRenderingMode. Public variable.
       /// Modifying it takes change on the next render
       public: GzOgreRenderingMode gzOgreRenderingMode = GORM_NORMAL;
+
+      /// \brief Custom parameter read in the solid colour modes.
+      /// See GzOgreItemAttribute. Public variable.
+      public: GzOgreItemAttribute gzItemAttribute = GOIA_SOLID_COLOR;
     };
     }
   }
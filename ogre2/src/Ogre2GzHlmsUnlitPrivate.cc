@@ -212,13 +212,14 @@ namespace Ogre
       Vector4 customParam;
       try
       {
-        customParam = _queuedRenderable.renderable->getCustomParameter(1u);
+        customParam = _queuedRenderable.renderable->getCustomParameter(
+          this->gzItemAttribute);
       }
       catch (ItemIdentityException &)
       {
         // This error can trigger for two reasons:
         //
-        //  1. We forgot to call setCustomParameter(1u, ...)
+        //  1. We forgot to call setCustomParameter(gzItemAttribute, ...)
         //  2. This object should not be rendered and we should've called
         //     movableObject->setVisible(false) or use RenderQueue IDs
         //     or visibility flags to prevent rendering it
@@ -251,7 +252,8 @@ namespace Ogre
     if (this->gzOgreRenderingMode == GORM_SOLID_COLOR && !_casterPass)
     {
       Vector4 customParam =
-        _queuedRenderable.renderable->getCustomParameter(1u);
+        _queuedRenderable.renderable->getCustomParameter(
+          this->gzItemAttribute);
       float *dataPtr = this->MapObjectDataBufferFor(
         instanceIdx, _commandBuffer, this->mVaoManager, this->mConstBuffers,
         this->mCurrentConstBuffer, this->mStartMappedConstBuffer,
@@ -15,7 +15,16 @@
  *
 */
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -37,12 +46,92 @@
 #include <OgreImage2.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <OgreTextureGpu.h>
+#include <Threading/OgreUniformScalableTask.h>
 #include "Terra/Hlms/OgreHlmsTerra.h"
 #include "Terra/Hlms/OgreHlmsTerraDatablock.h"
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
 
+// Define this macro to force the single threaded version of HeightsAt
+// #define SINGLE_THREADED
+
+/// \brief Terrain cells selected for a camera
+struct TerraCameraCells
+{
+  /// \brief World position of the camera when the cells were selected
+  Ogre::Vector3 position;
+
+  /// \brief World orientation of the camera when the cells were selected
+  Ogre::Quaternion orientation;
+
+  /// \brief Projection of the camera when the cells were selected
+  Ogre::Matrix4 projection;
+
+  /// \brief The selected cells
+  Ogre::Terra::CellSelection selection;
+};
+
+/// \brief Maximum number of cameras the cells are kept for, the cells of
+/// all cameras are forgotten beyond
+static const size_t kMaxTerraCameras = 64u;
+
+/// \brief Number of heightmaps using each resident layer texture, textures
+/// are only unloaded once no heightmap needs them. Only used on the render
+/// thread.
+static std::unordered_map<Ogre::TextureGpu *, unsigned int>
+    residentLayerTextures;
+
+/// \brief Minimum number of positions HeightsAt spreads across the worker
+/// threads, smaller batches are faster on the calling thread
+static const size_t kMinThreadedHeights = 4096u;
+
+/// \brief This class samples the terrain heights of a batch of positions,
+/// spreading the positions across multiple threads. Terra only reads its
+/// height data, so the threads share it.
+class GZ_RENDERING_OGRE2_HIDDEN ThreadedTerraHeights final
+  : public Ogre::UniformScalableTask
+{
+  /// \brief Terra object to sample
+  private: const Ogre::Terra &terra;
+
+  /// \brief Positions to sample
+  private: const std::vector<gz::math::Vector2d> &positions;
+
+  /// \brief Height of every position
+  public: std::vector<double> heights;
+
+  /// \brief Constructor
+  /// \param[in] _terra Terra object to sample
+  /// \param[in] _positions Positions to sample
+  public: ThreadedTerraHeights(const Ogre::Terra &_terra,
+              const std::vector<gz::math::Vector2d> &_positions)
+      : terra(_terra), positions(_positions)
+  {
+    this->heights.resize(_positions.size());
+  }
+
+  // Documentation inherited
+  public: void execute(size_t _threadId, size_t _numThreads) override
+  {
+    const size_t count = this->positions.size();
+    const size_t countPerThread = (count + (_numThreads - 1u)) / _numThreads;
+    const size_t start = std::min(countPerThread * _threadId, count);
+    const size_t end = std::min(countPerThread * (_threadId + 1u), count);
+
+    for (size_t i = start; i < end; ++i)
+    {
+      Ogre::Vector3 pos(static_cast<Ogre::Real>(this->positions[i].X()),
+                        static_cast<Ogre::Real>(this->positions[i].Y()),
+                        0.0f);
+      this->heights[i] = this->terra.getHeightAt(pos) ?
+          static_cast<double>(pos.z) :
+          std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+};
+
 //////////////////////////////////////////////////
 class gz::rendering::Ogre2HeightmapPrivate
 {
@@ -54,19 +143,119 @@ class gz::rendering::Ogre2HeightmapPrivate
   /// so we can use it if skirtMinHeight becomes -1 again
   public: float autoSkirtValue;
 
-  /// \brief The raw height values.
-  public: std::vector<float> heights;
-
   /// \brief Size of the heightmap data.
   public: unsigned int dataSize{0u};
 
   /// \brief Pointer to ogre terra object
   public: std::unique_ptr<Ogre::Terra> terra{nullptr};
+
+  /// \brief Heights being prepared on a worker thread, only valid while
+  /// loading asynchronously
+  public: std::future<std::vector<uint16_t>> pendingHeights;
+
+  /// \brief True once the terra object is loaded
+  public: bool loaded{false};
+
+  /// \brief Light direction the terrain shadows were last computed for
+  public: Ogre::Vector3 shadowLightDir{Ogre::Vector3::ZERO};
+
+  /// \brief Number of frames since the terrain shadows were last computed
+  public: unsigned int framesSinceShadowUpdate{0u};
+
+  /// \brief Cells selected for each camera, so cameras that did not move
+  /// reuse them. Cameras are compared by pose and projection, so cells of
+  /// a destroyed camera are never used for a new one.
+  public: std::unordered_map<const Ogre::Camera *, TerraCameraCells>
+      cameraCells;
+
+  /// \brief Time loading started, for logging
+  public: std::chrono::steady_clock::time_point loadStart;
+
+  /// \brief Make the layer textures resident, setting them on the first
+  /// call
+  public: void LoadLayers();
+
+  /// \brief Stop needing the layer textures
+  /// \param[in] _unload True to unload the textures no other heightmap
+  /// needs from the GPU
+  public: void ReleaseLayers(bool _unload);
+
+  /// \brief Terra datablock of the terrain
+  public: Ogre::HlmsTerraDatablock *datablock{nullptr};
+
+  /// \brief Sampler of the layer textures
+  public: Ogre::HlmsSamplerblock layerSamplerblock;
+
+  /// \brief Layer textures not set on the datablock yet, by texture unit
+  public: std::vector<std::pair<Ogre::TerraTextureTypes, std::string>>
+      pendingLayers;
+
+  /// \brief Layer textures set on the datablock
+  public: std::vector<Ogre::TextureGpu *> layerTextures;
+
+  /// \brief True while the layer textures are needed
+  public: bool layersResident{false};
+
+  /// \brief Number of frames since a camera last saw the terrain
+  public: unsigned int framesSinceVisible{0u};
 };
 
 using namespace gz;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+void Ogre2HeightmapPrivate::LoadLayers()
+{
+  if (this->layersResident || !this->datablock)
+    return;
+
+  // loading the textures only once a camera sees the terrain saves the
+  // memory of the terrains that are never seen
+  for (const auto &layer : this->pendingLayers)
+  {
+    this->datablock->setTexture(layer.first, layer.second,
+                                &this->layerSamplerblock);
+    Ogre::TextureGpu *texture =
+        this->datablock->getTexture(static_cast<uint8_t>(layer.first));
+    if (texture)
+      this->layerTextures.push_back(texture);
+  }
+  this->pendingLayers.clear();
+
+  for (Ogre::TextureGpu *texture : this->layerTextures)
+  {
+    if (residentLayerTextures[texture]++ == 0u &&
+        texture->getNextResidencyStatus() != Ogre::GpuResidency::Resident)
+    {
+      texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    }
+  }
+  this->layersResident = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2HeightmapPrivate::ReleaseLayers(bool _unload)
+{
+  if (!this->layersResident)
+    return;
+
+  for (Ogre::TextureGpu *texture : this->layerTextures)
+  {
+    auto it = residentLayerTextures.find(texture);
+    if (it == residentLayerTextures.end() || --it->second > 0u)
+      continue;
+    residentLayerTextures.erase(it);
+
+    // the textures are loaded again from their files when needed
+    if (_unload &&
+        texture->getNextResidencyStatus() == Ogre::GpuResidency::Resident)
+    {
+      texture->scheduleTransitionTo(Ogre::GpuResidency::OnStorage);
+    }
+  }
+  this->layersResident = false;
+}
+
 //////////////////////////////////////////////////
 Ogre2Heightmap::Ogre2Heightmap(const HeightmapDescriptor &_desc)
     : BaseHeightmap(_desc), dataPtr(std::make_unique<Ogre2HeightmapPrivate>())
@@ -82,9 +271,85 @@ Ogre2Heightmap::~Ogre2Heightmap()
 //////////////////////////////////////////////////
 void Ogre2Heightmap::Destroy()
 {
+  // Wait for the worker so it does not outlive the heightmap data
+  if (this->dataPtr->pendingHeights.valid())
+    this->dataPtr->pendingHeights.wait();
+  this->dataPtr->pendingHeights = std::future<std::vector<uint16_t>>();
+  this->dataPtr->loaded = false;
+  this->dataPtr->cameraCells.clear();
+  this->dataPtr->ReleaseLayers(false);
+  this->dataPtr->pendingLayers.clear();
+  this->dataPtr->layerTextures.clear();
+  this->dataPtr->datablock = nullptr;
   this->dataPtr->terra.reset();
 }
 
+//////////////////////////////////////////////////
+/// \brief Build the normalized heightmap lookup table of a descriptor.
+/// Does not use Ogre so it can run on a worker thread.
+/// \param[in] _desc Heightmap descriptor
+/// \param[in] _srcWidth Sampled width of the heightmap
+/// \param[in] _newWidth Width of the heightmap after cropping
+/// \param[in] _scale Scale of the heightmap
+/// \param[in] _flipY True to flip the heightmap along Y
+/// \return Heights in range [0; 1], _newWidth x _newWidth
+static std::vector<uint16_t> PrepareHeights(HeightmapDescriptor _desc,
+    unsigned int _srcWidth, unsigned int _newWidth, math::Vector3d _scale,
+    bool _flipY)
+{
+  // Construct the heightmap lookup table
+  std::vector<float> heights;
+  _desc.Data()->FillHeightMap(_desc.Sampling(), _srcWidth, _desc.Size(),
+      _scale, _flipY, heights);
+  if (heights.empty())
+    return std::vector<uint16_t>();
+
+  // Terra is optimized to work with UNORM heightmaps, therefore it assumes
+  // lowest height is 0.
+  // So we move the heightmap so that its min elevation = 0 before feeding to
+  // ogre. It is later translated back by the setOrigin call.
+  //
+  // Obtain min and max elevation and bring everything to range [0; 1]
+  // Terra should support non-normalized ranges but there are a couple
+  // bugs preventing that, so it's just easier to normalize the data.
+  // The heights are stored as 16 bit UNORM, which takes half the memory of
+  // floats on the CPU and the GPU.
+  const float minElevation = static_cast<float>(_desc.Data()->MinElevation());
+  const float maxElevation = static_cast<float>(_desc.Data()->MaxElevation());
+  const float heightDiff = maxElevation - minElevation;
+  const float invHeightDiff =
+      fabsf( heightDiff ) < 1e-6f ? 1.0f : (1.0f / heightDiff);
+
+  // Normalize and crop in a single branch-free pass per row the compiler
+  // can vectorize, out of bounds heights are only counted and reported
+  // once.
+  std::vector<uint16_t> unormHeights(
+      static_cast<size_t>(_newWidth) * _newWidth);
+  size_t outOfBounds = 0u;
+  for (unsigned int y = 0; y < _newWidth; ++y)
+  {
+    const float *src = &heights[static_cast<size_t>(y) * _srcWidth];
+    uint16_t *dst = &unormHeights[static_cast<size_t>(y) * _newWidth];
+    for (unsigned int x = 0; x < _newWidth; ++x)
+    {
+      // Sanity check in case we get NaNs from gz-common, this prevents a
+      // crash in Ogre
+      const float heightVal = std::isfinite(src[x]) ? src[x] : minElevation;
+      outOfBounds += (heightVal < minElevation) | (heightVal > maxElevation);
+      const float normalized = std::clamp(
+          (heightVal - minElevation) * invHeightDiff, 0.0f, 1.0f);
+      dst[x] = static_cast<uint16_t>(normalized * 65535.0f + 0.5f);
+    }
+  }
+  if (outOfBounds > 0u)
+  {
+    gzerr << "Internal error: " << outOfBounds << " heights are out of "
+          << "bounds [" << minElevation << " / " << maxElevation << "]"
+          << std::endl;
+  }
+  return unormHeights;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Heightmap::Init()
 {
@@ -99,13 +364,18 @@ void Ogre2Heightmap::Init()
   if (this->descriptor.Name().empty())
     this->descriptor.SetName(this->Name());
 
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2Heightmap::Init", "heightmap", this->descriptor.Name());
+
   // Add paths
+  Ogre2RenderEngine::Instance()->BeginResourceBatch();
   for (auto i = 0u; i < this->descriptor.TextureCount(); ++i)
   {
     auto texture = this->descriptor.TextureByIndex(i);
     Ogre2RenderEngine::Instance()->AddResourcePath(texture->Diffuse());
     Ogre2RenderEngine::Instance()->AddResourcePath(texture->Normal());
   }
+  Ogre2RenderEngine::Instance()->EndResourceBatch();
 
   // \todo These parameters shouldn't be hardcoded, and instead parametrized so
   // that they can be made consistent across different libraries (like
@@ -151,63 +421,55 @@ void Ogre2Heightmap::Init()
   scale.Y(this->descriptor.Size().Y() / newWidth);
   scale.Z(1.0);
 
-  // Construct the heightmap lookup table
-  std::vector<float> lookup;
-  this->descriptor.Data()->FillHeightMap(this->descriptor.Sampling(),
-      srcWidth, this->descriptor.Size(), scale, flipY, lookup);
-  this->dataPtr->heights.reserve(newWidth * newWidth);
+  this->dataPtr->dataSize = newWidth;
 
-  // Terra is optimized to work with UNORM heightmaps, therefore it assumes
-  // lowest height is 0.
-  // So we move the heightmap so that its min elevation = 0 before feeding to
-  // ogre. It is later translated back by the setOrigin call.
-  //
-  // Obtain min and max elevation and bring everything to range [0; 1]
-  // Terra should support non-normalized ranges but there are a couple
-  // bugs preventing that, so it's just easier to normalize the data
-  double minElevation = this->descriptor.Data()->MinElevation();
-  double maxElevation = this->descriptor.Data()->MaxElevation();
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  Ogre::Root *ogreRoot = Ogre2RenderEngine::Instance()->OgreRoot();
+  Ogre::SceneManager *ogreSceneManager = ogreScene->OgreSceneManager();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
-  for (unsigned int y = 0; y < newWidth; ++y)
-  {
-    for (unsigned int x = 0; x < newWidth; ++x)
-    {
-      const size_t index = y * srcWidth + x;
-      float heightVal = lookup[index];
+  // The terra object is created right away so it can be attached to its
+  // parent visual, it is loaded once the heightmap data is ready.
+  // TODO(anyone): Gazebo doesn't support SCENE_STATIC scene nodes
+  this->dataPtr->terra =
+      std::make_unique<Ogre::Terra>(
+        Ogre::Id::generateNewId<Ogre::MovableObject>(),
+        &ogreSceneManager->_getEntityMemoryManager(
+          Ogre::/*SCENE_STATIC*/SCENE_DYNAMIC),
+        ogreSceneManager, 11u, ogreCompMgr, nullptr, true );
 
-      // Sanity check in case we get NaNs from gz-common, this prevents a crash
-      // in Ogre
-      if (!std::isfinite(heightVal))
-        heightVal = minElevation;
+  // Does not cast shadows because it uses a raymarching implementation
+  // instead of shadow maps. It does receive shadows from shadow maps though
+  this->dataPtr->terra->setCastShadows(false);
 
-      if (heightVal < minElevation || heightVal > maxElevation)
-      {
-        gzerr << "Internal error: height [" << heightVal
-               << "] is out of bounds [" << minElevation << " / "
-               << maxElevation << "]" << std::endl;
-      }
-      this->dataPtr->heights.push_back(heightVal);
-    }
-  }
+  gzmsg << "Loading heightmap: " << this->descriptor.Name() << std::endl;
+  this->dataPtr->loadStart = std::chrono::steady_clock::now();
 
-  // min and max elevations collected. Now normalize
-  const float heightDiff = maxElevation - minElevation;
-  const float invHeightDiff =
-      fabsf( heightDiff ) < 1e-6f ? 1.0f : (1.0f / heightDiff);
-  for (float &heightVal : this->dataPtr->heights)
+  if (this->descriptor.AsyncLoading())
   {
-    heightVal = (heightVal - minElevation) * invHeightDiff;
-    assert( heightVal >= 0 );
+    // The worker only reads its own copy of the descriptor, the heightmap
+    // data is shared but not modified
+    this->dataPtr->pendingHeights = std::async(std::launch::async,
+        PrepareHeights, this->descriptor, srcWidth, newWidth, scale, flipY);
+    return;
   }
 
-  this->dataPtr->dataSize = newWidth;
+  this->LoadTerra(
+      PrepareHeights(this->descriptor, srcWidth, newWidth, scale, flipY));
+}
 
-  if (this->dataPtr->heights.empty())
+//////////////////////////////////////////////////
+void Ogre2Heightmap::LoadTerra(std::vector<uint16_t> &&_heights)
+{
+  if (_heights.empty())
   {
     gzerr << "Failed to load terrain. Heightmap data is empty" << std::endl;
     return;
   }
 
+  const unsigned int newWidth = this->dataPtr->dataSize;
+  const double minElevation = this->descriptor.Data()->MinElevation();
+
   // Create terrain group, which holds all the individual terrain instances.
   // Param 1: Pointer to the scene manager
   // Param 2: Alignment plane
@@ -215,12 +477,10 @@ void Ogre2Heightmap::Init()
   //          Terrains must be square, with each side a power of 2 in size
   // Param 4: World size of each terrain instance, in meters.
 
-  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
-
   Ogre::Image2 image;
-  image.loadDynamicImage(this->dataPtr->heights.data(), newWidth, newWidth,
+  image.loadDynamicImage(_heights.data(), newWidth, newWidth,
                          1u, Ogre::TextureTypes::Type2D,
-                         Ogre::PFG_R32_FLOAT, false);
+                         Ogre::PFG_R16_UNORM, false);
 
   const math::Vector3d size = this->descriptor.Size();
 
@@ -231,20 +491,7 @@ void Ogre2Heightmap::Init()
       this->descriptor.Position().Z() + size.Z() * 0.5 + minElevation);
 
   Ogre::Root *ogreRoot = Ogre2RenderEngine::Instance()->OgreRoot();
-  Ogre::SceneManager *ogreSceneManager = ogreScene->OgreSceneManager();
-  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
-  // TODO(anyone): Gazebo doesn't support SCENE_STATIC scene nodes
-  this->dataPtr->terra =
-      std::make_unique<Ogre::Terra>(
-        Ogre::Id::generateNewId<Ogre::MovableObject>(),
-        &ogreSceneManager->_getEntityMemoryManager(
-          Ogre::/*SCENE_STATIC*/SCENE_DYNAMIC),
-        ogreSceneManager, 11u, ogreCompMgr, nullptr, true );
-
-  // Does not cast shadows because it uses a raymarching implementation
-  // instead of shadow maps. It does receive shadows from shadow maps though
-  this->dataPtr->terra->setCastShadows(false);
   this->dataPtr->terra->load(
         image,
         Ogre2Conversions::Convert(center),
@@ -254,6 +501,12 @@ void Ogre2Heightmap::Init()
         this->descriptor.Name());
   this->dataPtr->autoSkirtValue =
       this->dataPtr->terra->getCustomSkirtMinHeight();
+
+  // Terra keeps the heights as floats on the CPU, they are only needed
+  // for height queries once the GPU has them
+  _heights = std::vector<uint16_t>();
+  if (!this->descriptor.HeightQueries())
+    this->dataPtr->terra->releaseHeightMapData();
   this->dataPtr->terra->setDatablock(
         ogreRoot->getHlmsManager()->
         getHlms(Ogre::HLMS_USER3)->getDefaultDatablock());
@@ -277,11 +530,20 @@ void Ogre2Heightmap::Init()
   Ogre::HlmsTerraDatablock *datablock =
           static_cast<Ogre::HlmsTerraDatablock *>(datablockBase);
 
-  Ogre::HlmsSamplerblock samplerblock;
+  Ogre::HlmsSamplerblock &samplerblock = this->dataPtr->layerSamplerblock;
   samplerblock.setAddressingMode(Ogre::TAM_WRAP);
   samplerblock.setFiltering(Ogre::TFO_ANISOTROPIC);
   samplerblock.mMaxAnisotropy = 8u;
 
+  // the layer textures are set once a camera sees the terrain
+  auto &pendingLayers = this->dataPtr->pendingLayers;
+  auto addLayer = [&pendingLayers](Ogre::TerraTextureTypes _unit,
+                                   const std::string &_name)
+  {
+    if (!_name.empty())
+      pendingLayers.emplace_back(_unit, _name);
+  };
+
   size_t numTextures = static_cast<size_t>(this->descriptor.TextureCount());
 
   if (numTextures >= 1u)
@@ -310,16 +572,16 @@ void Ogre2Heightmap::Init()
 
     if (bCanUseFirstAsBase)
     {
-      datablock->setTexture(static_cast<TerraTextureTypes>(TERRA_DIFFUSE),
-                            texture0->Diffuse(), &samplerblock);
+      addLayer(static_cast<TerraTextureTypes>(TERRA_DIFFUSE),
+               texture0->Diffuse());
     }
     else
     {
-      datablock->setTexture(static_cast<TerraTextureTypes>(TERRA_DETAIL0),
-                            texture0->Diffuse(), &samplerblock);
+      addLayer(static_cast<TerraTextureTypes>(TERRA_DETAIL0),
+               texture0->Diffuse());
 
-      datablock->setTexture(static_cast<TerraTextureTypes>(TERRA_DETAIL0_NM),
-                            texture0->Normal(), &samplerblock);
+      addLayer(static_cast<TerraTextureTypes>(TERRA_DETAIL0_NM),
+               texture0->Normal());
 
       const float sizeX =
               static_cast<float>(size.X() / texture0->Size());
@@ -334,13 +596,11 @@ void Ogre2Heightmap::Init()
       const size_t idxOffset = bCanUseFirstAsBase ? 1 : 0;
       const HeightmapTexture *texture = this->descriptor.TextureByIndex(i);
 
-      datablock->setTexture(static_cast<TerraTextureTypes>(
-                            TERRA_DETAIL0 + i - idxOffset),
-                            texture->Diffuse(), &samplerblock);
+      addLayer(static_cast<TerraTextureTypes>(
+               TERRA_DETAIL0 + i - idxOffset), texture->Diffuse());
 
-      datablock->setTexture(static_cast<TerraTextureTypes>(
-                            TERRA_DETAIL0_NM + i - idxOffset),
-                            texture->Normal(), &samplerblock);
+      addLayer(static_cast<TerraTextureTypes>(
+               TERRA_DETAIL0_NM + i - idxOffset), texture->Normal());
 
       const float sizeX =
               static_cast<float>(size.X() / texture->Size());
@@ -383,24 +643,95 @@ void Ogre2Heightmap::Init()
   }
 
   this->dataPtr->terra->setDatablock(datablock);
-
-  gzmsg << "Loading heightmap: " << this->descriptor.Name() << std::endl;
-  auto time = std::chrono::steady_clock::now();
+  this->dataPtr->datablock = datablock;
+  this->dataPtr->cameraCells.clear();
+  this->dataPtr->loaded = true;
 
   gzmsg << "Heightmap loaded. Process took "
         <<  std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now() - time).count()
+            std::chrono::steady_clock::now() -
+            this->dataPtr->loadStart).count()
         << " ms." << std::endl;
 }
 
 //////////////////////////////////////////////////
 void Ogre2Heightmap::PreRender()
 {
+  if (this->dataPtr->framesSinceShadowUpdate <
+      std::numeric_limits<unsigned int>::max())
+  {
+    ++this->dataPtr->framesSinceShadowUpdate;
+  }
+
+  if (this->dataPtr->framesSinceVisible <
+      std::numeric_limits<unsigned int>::max())
+  {
+    ++this->dataPtr->framesSinceVisible;
+  }
+  if (this->textureUnloadFrames > 0u &&
+      this->dataPtr->framesSinceVisible > this->textureUnloadFrames)
+  {
+    this->dataPtr->ReleaseLayers(true);
+  }
+
+  // Finish loading on the render thread once the worker is done
+  if (this->dataPtr->pendingHeights.valid() &&
+      this->dataPtr->pendingHeights.wait_for(std::chrono::seconds(0)) ==
+      std::future_status::ready)
+  {
+    this->LoadTerra(this->dataPtr->pendingHeights.get());
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Heightmap::IsLoaded() const
+{
+  return this->dataPtr->loaded;
+}
+
+//////////////////////////////////////////////////
+std::vector<double> Ogre2Heightmap::HeightsAt(
+    const std::vector<math::Vector2d> &_positions) const
+{
+  if (!this->dataPtr->loaded || _positions.empty())
+  {
+    return std::vector<double>(_positions.size(),
+        std::numeric_limits<double>::quiet_NaN());
+  }
+
+  if (!this->dataPtr->terra->hasHeightMapData())
+  {
+    gzerr << "Heightmap [" << this->descriptor.Name() << "] does not keep "
+          << "its heights, enable HeightmapDescriptor::SetHeightQueries"
+          << std::endl;
+    return std::vector<double>(_positions.size(),
+        std::numeric_limits<double>::quiet_NaN());
+  }
+
+  ThreadedTerraHeights heightTask(*this->dataPtr->terra, _positions);
+#ifndef SINGLE_THREADED
+  Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+  if (_positions.size() >= kMinThreadedHeights &&
+      ogreSceneManager->getNumWorkerThreads() > 1u)
+  {
+    ogreSceneManager->executeUserScalableTask(&heightTask, true);
+  }
+  else
+  {
+    heightTask.execute(0u, 1u);
+  }
+#else
+  heightTask.execute(0u, 1u);
+#endif
+  return std::move(heightTask.heights);
 }
 
 ///////////////////////////////////////////////////
 void Ogre2Heightmap::UpdateForRender(Ogre::Camera *_activeCamera)
 {
+  if (!this->dataPtr->loaded)
+    return;
+
   if (this->dataPtr->skirtMinHeight >= 0)
   {
     this->dataPtr->terra->setCustomSkirtMinHeight(
@@ -412,28 +743,68 @@ void Ogre2Heightmap::UpdateForRender(Ogre::Camera *_activeCamera)
           this->dataPtr->autoSkirtValue);
   }
 
-  // Get the first directional light
-  Ogre2DirectionalLightPtr directionalLight;
-  for (unsigned int i = 0; i < this->Scene()->LightCount(); ++i)
+  Ogre2DirectionalLightPtr directionalLight =
+      this->scene->PrimaryDirectionalLight();
+  Ogre::Vector3 lightDir = Ogre::Vector3::NEGATIVE_UNIT_Y;
+  if (directionalLight)
   {
-     auto light = std::dynamic_pointer_cast<Ogre2DirectionalLight>(
-         this->Scene()->LightByIndex(i));
-    if (nullptr != light)
-    {
-      directionalLight = light;
-      break;
-    }
+    lightDir = Ogre2Conversions::Convert(directionalLight->Direction());
+    lightDir.normalise();
   }
 
-  this->dataPtr->terra->setCamera(_activeCamera);
-  if (directionalLight)
+  // Only recompute the shadows when the light moved enough and not more
+  // often than requested. Otherwise keep passing the direction the shadows
+  // were computed for, so Terra only updates its visible cells.
+  const bool firstUpdate =
+      this->dataPtr->shadowLightDir == Ogre::Vector3::ZERO;
+  const double angle = std::acos(std::clamp(static_cast<double>(
+      lightDir.dotProduct(this->dataPtr->shadowLightDir)), -1.0, 1.0));
+  if (firstUpdate ||
+      (angle > this->shadowUpdateThreshold.Radian() &&
+       this->dataPtr->framesSinceShadowUpdate >= this->shadowUpdateInterval))
+  {
+    this->dataPtr->shadowLightDir = lightDir;
+    this->dataPtr->framesSinceShadowUpdate = 0u;
+  }
+
+  Ogre::Terra *terra = this->dataPtr->terra.get();
+  terra->setCamera(_activeCamera);
+
+  // the cells depend on the camera frustum, they are only reused while
+  // the camera keeps its orientation and projection
+  const Ogre::Vector3 position = _activeCamera->getDerivedPosition();
+  const Ogre::Quaternion orientation = _activeCamera->getDerivedOrientation();
+  const Ogre::Matrix4 &projection = _activeCamera->getProjectionMatrix();
+  auto it = this->dataPtr->cameraCells.find(_activeCamera);
+  if (it != this->dataPtr->cameraCells.end() &&
+      it->second.orientation == orientation &&
+      it->second.projection == projection &&
+      it->second.position.distance(position) <= this->lodUpdateDistance)
   {
-    this->dataPtr->terra->update(
-          Ogre2Conversions::Convert(directionalLight->Direction()));
+    terra->updateShadowMap(this->dataPtr->shadowLightDir);
+    terra->restoreCellSelection(it->second.selection);
   }
   else
   {
-    this->dataPtr->terra->update(Ogre::Vector3::NEGATIVE_UNIT_Y);
+    terra->update(this->dataPtr->shadowLightDir);
+
+    if (it == this->dataPtr->cameraCells.end())
+    {
+      if (this->dataPtr->cameraCells.size() >= kMaxTerraCameras)
+        this->dataPtr->cameraCells.clear();
+      it = this->dataPtr->cameraCells.emplace(
+          _activeCamera, TerraCameraCells()).first;
+    }
+    it->second.position = position;
+    it->second.orientation = orientation;
+    it->second.projection = projection;
+    terra->saveCellSelection(it->second.selection);
+  }
+
+  if (terra->getVisible() && terra->hasVisibleCells())
+  {
+    this->dataPtr->framesSinceVisible = 0u;
+    this->dataPtr->LoadLayers();
   }
 }
 
@@ -94,6 +94,7 @@ void Ogre2InertiaVisual::Load(const gz::math::Pose3d &_pose,
     this->dataPtr->crossLines.reset(
       new Ogre2DynamicRenderable(this->Scene()));
     this->ogreNode->attachObject(this->dataPtr->crossLines->OgreObject());
+    this->scene->SetSceneGraphDirty();
   }
 
   if (!this->dataPtr->boxVis)
@@ -16,6 +16,8 @@
  */
 #include "gz/rendering/ogre2/Ogre2LensFlarePass.hh"
 
+#include <vector>
+
 #include <gz/common/Util.hh>
 
 #include "gz/rendering/RayQuery.hh"
@@ -99,6 +101,13 @@ class gz::rendering::Ogre2LensFlarePass::Implementation
   /// \brief RayQuery to perform occlusion tests
   public: RayQueryPtr rayQuery;
 
+  /// \brief Origins of the occlusion test rays, kept to avoid reallocating
+  /// them every frame
+  public: std::vector<math::Vector3d> rayOrigins;
+
+  /// \brief Directions of the occlusion test rays
+  public: std::vector<math::Vector3d> rayDirections;
+
   /// \brief See Ogre2LensFlarePassWorkspaceListenerPrivate
   public: Ogre2LensFlarePassWorkspaceListenerPrivate workspaceListener;
 
@@ -248,33 +257,32 @@ double Ogre2LensFlarePass::OcclusionScale(const math::Vector3d &_imgPos,
   Ogre2WideAngleCameraPtr wideAngleCamera =
     std::dynamic_pointer_cast<Ogre2WideAngleCamera>(
       this->dataPtr->currentCamera);
-  if (wideAngleCamera)
-  {
-    this->dataPtr->rayQuery->SetFromCamera(
-      wideAngleCamera, _faceIdx, math::Vector2d(_imgPos.X(), _imgPos.Y()));
-  }
-  else
-  {
-    this->dataPtr->rayQuery->SetFromCamera(
-      this->dataPtr->currentCamera, math::Vector2d(_imgPos.X(), _imgPos.Y()));
-  }
-
-  const math::Vector3d lightWorldPos = this->dataPtr->lightWorldPos;
 
+  // gather the center ray followed by a sparse grid of rays around it and
+  // cast them all in one batch so the scene is walked once and the rays are
+  // spread across worker threads
+  std::vector<math::Vector3d> &origins = this->dataPtr->rayOrigins;
+  std::vector<math::Vector3d> &directions = this->dataPtr->rayDirections;
+  origins.clear();
+  directions.clear();
+  auto addRay = [&](double _x, double _y)
   {
-    // check center point
-    // if occluded than set scale to 0
-    RayQueryResult result = this->dataPtr->rayQuery->ClosestPoint(false);
-    bool intersect = result.distance >= 0.0;
-    if (intersect &&
-        (result.point.SquaredLength() < lightWorldPos.SquaredLength()))
+    if (wideAngleCamera)
     {
-      return 0;
+      this->dataPtr->rayQuery->SetFromCamera(wideAngleCamera, _faceIdx,
+                                             math::Vector2d(_x, _y));
     }
-  }
+    else
+    {
+      this->dataPtr->rayQuery->SetFromCamera(this->dataPtr->currentCamera,
+                                             math::Vector2d(_x, _y));
+    }
+    origins.push_back(this->dataPtr->rayQuery->Origin());
+    directions.push_back(this->dataPtr->rayQuery->Direction());
+  };
+
+  addRay(_imgPos.X(), _imgPos.Y());
 
-  unsigned int rays = 0;
-  unsigned int occluded = 0u;
   // work in normalized device coordinates
   // lens flare's halfSize is just an approximated value
   const double halfSize = 0.05 * this->dataPtr->scale;
@@ -286,32 +294,40 @@ double Ogre2LensFlarePass::OcclusionScale(const math::Vector3d &_imgPos,
   const double starty = cy - halfSize;
   const double endx = cx + halfSize;
   const double endy = cy + halfSize;
-  // do sparse ray cast occlusion check
   for (double i = starty; i < endy; i += stepSize)
   {
     for (double j = startx; j < endx; j += stepSize)
-    {
-      if (wideAngleCamera)
-      {
-        this->dataPtr->rayQuery->SetFromCamera(wideAngleCamera, _faceIdx,
-                                               math::Vector2d(j, i));
-      }
-      else
-      {
-        this->dataPtr->rayQuery->SetFromCamera(this->dataPtr->currentCamera,
-                                               math::Vector2d(j, i));
-      }
-      RayQueryResult result = this->dataPtr->rayQuery->ClosestPoint(false);
-      bool intersect = result.distance >= 0.0;
-      if (intersect &&
-          (result.point.SquaredLength() < lightWorldPos.SquaredLength()))
-      {
-        occluded++;
-      }
-
-      rays++;
-    }
+      addRay(j, i);
   }
+
+  const std::vector<RayQueryResult> results =
+    this->dataPtr->rayQuery->ClosestPoints(origins, directions, false);
+  if (results.size() != origins.size())
+    return this->dataPtr->scale;
+
+  const math::Vector3d lightWorldPos = this->dataPtr->lightWorldPos;
+  auto isOccluded = [&lightWorldPos](const RayQueryResult &_result)
+  {
+    return _result.distance >= 0.0 &&
+        _result.point.SquaredLength() < lightWorldPos.SquaredLength();
+  };
+
+  // check center point
+  // if occluded than set scale to 0
+  if (isOccluded(results[0]))
+    return 0;
+
+  const unsigned int rays = static_cast<unsigned int>(results.size() - 1u);
+  if (rays == 0u)
+    return this->dataPtr->scale;
+
+  unsigned int occluded = 0u;
+  for (size_t i = 1u; i < results.size(); ++i)
+  {
+    if (isOccluded(results[i]))
+      occluded++;
+  }
+
   double s = static_cast<double>(rays - occluded) / static_cast<double>(rays);
   return s * this->dataPtr->scale;
 }
@@ -27,6 +27,7 @@
 
 #include <gz/common/Console.hh>
 
+#include "gz/rendering/GpuRays.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2DynamicRenderable.hh"
 #include "gz/rendering/ogre2/Ogre2LidarVisual.hh"
@@ -77,9 +78,40 @@ class gz::rendering::Ogre2LidarVisualPrivate
   /// \brief True if new points data is received
   public: bool receivedData = false;
 
+  /// \brief Sensor whose output is visualized instead of lidarPoints
+  public: GpuRaysPtr gpuRays;
+
+  /// \brief Sequence number of the sensor frame visualized last
+  public: uint64_t gpuRaysSequence = 0u;
+
   /// \brief The visibility of the visual
   public: bool visible = true;
 
+  /// \brief Cached unit direction of every ray, including the offset
+  /// rotation, indexed by vertical * horizontalCount + horizontal
+  public: std::vector<gz::math::Vector3d> rayDirections;
+
+  /// \brief Sensor parameters rayDirections was computed for
+  public: std::vector<double> rayDirectionsKey;
+
+  /// \brief Scratch xyz array of the ray lines of all rings
+  public: std::vector<float> lineXyz;
+
+  /// \brief Scratch xyz array of the points of all rings
+  public: std::vector<float> pointXyz;
+
+  /// \brief Scratch rgba array of the points of all rings
+  public: std::vector<float> pointRgba;
+
+  /// \brief Scratch xyz array of the hit strip of one ring
+  public: std::vector<float> stripXyz;
+
+  /// \brief Scratch xyz array of the no-hit strip of one ring
+  public: std::vector<float> noHitStripXyz;
+
+  /// \brief Scratch xyz array of the dead zone fan of one ring
+  public: std::vector<float> fanXyz;
+
   /// \brief Pointer to point cloud material.
   /// Used when LidarVisualType = LVT_POINTS.
   public: Ogre::MaterialPtr pointsMat;
@@ -88,6 +120,28 @@ class gz::rendering::Ogre2LidarVisualPrivate
 using namespace gz;
 using namespace rendering;
 
+/// \brief Append a point to a packed xyz array
+/// \param[in, out] _xyz Array to append to
+/// \param[in] _pt Point to append
+static void AppendPoint(std::vector<float> &_xyz,
+    const gz::math::Vector3d &_pt)
+{
+  _xyz.push_back(static_cast<float>(_pt.X()));
+  _xyz.push_back(static_cast<float>(_pt.Y()));
+  _xyz.push_back(static_cast<float>(_pt.Z()));
+}
+
+/// \brief Replace the points of a renderable and update it
+/// \param[in] _renderable Renderable to update
+/// \param[in] _xyz Packed xyz array of the new points
+static void SetRenderablePoints(
+    const std::shared_ptr<Ogre2DynamicRenderable> &_renderable,
+    const std::vector<float> &_xyz)
+{
+  _renderable->SetPoints(_xyz.data(), nullptr, _xyz.size() / 3u);
+  _renderable->Update();
+}
+
 //////////////////////////////////////////////////
 Ogre2LidarVisual::Ogre2LidarVisual()
   : dataPtr(new Ogre2LidarVisualPrivate)
@@ -141,6 +195,7 @@ void Ogre2LidarVisual::Destroy()
   }
 
   this->dataPtr->lidarPoints.clear();
+  this->dataPtr->gpuRays.reset();
   this->dataPtr->pointsMat.setNull();
 }
 
@@ -179,6 +234,7 @@ void Ogre2LidarVisual::Create()
 //////////////////////////////////////////////////
 void Ogre2LidarVisual::ClearPoints()
 {
+  this->dataPtr->gpuRays.reset();
   this->dataPtr->lidarPoints.clear();
   this->ClearVisualData();
   this->dataPtr->receivedData = false;
@@ -197,6 +253,7 @@ void Ogre2LidarVisual::ClearVisualData()
 //////////////////////////////////////////////////
 void Ogre2LidarVisual::SetPoints(const std::vector<double> &_points)
 {
+  this->dataPtr->gpuRays.reset();
   this->dataPtr->lidarPoints = _points;
   this->dataPtr->receivedData = true;
 }
@@ -210,12 +267,61 @@ void Ogre2LidarVisual::Update()
     return;
   }
 
-  if (!this->dataPtr->receivedData || this->dataPtr->lidarPoints.size() == 0)
+  // the ranges of a bound sensor are read in place from its latest frame
+  const GpuRaysPtr &gpuRays = this->dataPtr->gpuRays;
+  std::shared_ptr<const float> frame;
+  unsigned int stride = 1u;
+  if (gpuRays)
   {
-    gzwarn << "New lidar data not received. Exiting update function"
-            << std::endl;
+    const GpuRaysOutputFormat format = gpuRays->OutputFormat();
+    if (format != GROF_RANGE_RETRO_FLOAT32 && format != GROF_RANGE_FLOAT32 &&
+        format != GROF_MULTI_RETURN_FLOAT32)
+    {
+      if (this->scene->Diagnostics().Raise(
+          "LidarVisual/gpuRaysFormat/" + this->Name()))
+      {
+        gzwarn << "Lidar visual [" << this->Name() << "] only supports "
+               << "GpuRays output formats with float32 ranges in the first "
+               << "channel. Exiting update function" << std::endl;
+      }
+      return;
+    }
+
+    // skip frames that were already visualized
+    const uint64_t sequence = gpuRays->LastFrameInfo().sequence;
+    if (sequence == this->dataPtr->gpuRaysSequence &&
+        this->lidarVisualType == this->dataPtr->lidarVisType &&
+        this->displayNonHitting == this->dataPtr->currentDisplayNonHitting)
+    {
+      return;
+    }
+    frame = gpuRays->AcquireData();
+    if (!frame)
+      return;
+    this->dataPtr->gpuRaysSequence = sequence;
+
+    stride = gpuRays->Channels();
+    this->minHorizontalAngle = gpuRays->AngleMin().Radian();
+    this->maxHorizontalAngle = gpuRays->AngleMax().Radian();
+    this->minVerticalAngle = gpuRays->VerticalAngleMin().Radian();
+    this->maxVerticalAngle = gpuRays->VerticalAngleMax().Radian();
+    this->horizontalCount = static_cast<unsigned int>(gpuRays->RangeCount());
+    this->verticalCount =
+        static_cast<unsigned int>(gpuRays->VerticalRangeCount());
+    this->minRange = gpuRays->NearClipPlane();
+    this->maxRange = gpuRays->FarClipPlane();
+  }
+  else if (!this->dataPtr->receivedData ||
+      this->dataPtr->lidarPoints.size() == 0)
+  {
+    if (this->scene->Diagnostics().Raise("LidarVisual/noData/" + this->Name()))
+    {
+      gzwarn << "New lidar data not received. Exiting update function"
+              << std::endl;
+    }
     return;
   }
+  const float *ranges = frame.get();
 
   bool clearVisuals = false;
 
@@ -239,8 +345,6 @@ void Ogre2LidarVisual::Update()
   this->dataPtr->lidarVisType = this->lidarVisualType;
 
   this->dataPtr->receivedData = false;
-  double horizontalAngle = this->minHorizontalAngle;
-  double verticalAngle = this->minVerticalAngle;
 
   if (this->horizontalCount > 1)
   {
@@ -256,7 +360,7 @@ void Ogre2LidarVisual::Update()
               (this->verticalCount - 1);
   }
 
-  if (this->dataPtr->lidarPoints.size() !=
+  if (!ranges && this->dataPtr->lidarPoints.size() !=
                   this->verticalCount * this->horizontalCount)
   {
     gzwarn << "Size of lidar data inconsistent with rays."
@@ -265,226 +369,186 @@ void Ogre2LidarVisual::Update()
     return;
   }
 
-  // Process each point from received data
-  // Every line segment, and every triangle is saved separately,
-  // as a pointer to a DynamicLine
-  // This initializes and updates only the selected DynamicLine variables
-  for (unsigned int j = 0; j < this->verticalCount; ++j)
-  {
-    horizontalAngle = this->minHorizontalAngle;
+  this->UpdateRayDirections();
 
-    if (this->dataPtr->lidarVisType == LidarVisualType::LVT_RAY_LINES ||
-        this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS)
-    {
-      if (j+1 > this->dataPtr->rayLines.size())
-      {
-        std::shared_ptr<Ogre2DynamicRenderable> renderable =
-                        std::shared_ptr<Ogre2DynamicRenderable>(
-                                    new Ogre2DynamicRenderable(this->Scene()));
+  const bool rays =
+      this->dataPtr->lidarVisType == LidarVisualType::LVT_RAY_LINES ||
+      this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS;
+  const bool strips =
+      this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS;
+  const bool points =
+      this->dataPtr->lidarVisType == LidarVisualType::LVT_POINTS;
 
-        renderable->SetOperationType(MT_LINE_LIST);
-        MaterialPtr mat = this->Scene()->Material("Lidar/BlueRay");
-        renderable->SetMaterial(mat, false);
+  // Rays and points of all vertical rings share a single renderable.
+  // Strips and fans need one renderable per ring to keep their topology.
+  if (rays && this->dataPtr->rayLines.empty())
+  {
+    std::shared_ptr<Ogre2DynamicRenderable> renderable =
+                    std::shared_ptr<Ogre2DynamicRenderable>(
+                                new Ogre2DynamicRenderable(this->Scene()));
 
-        this->ogreNode->attachObject(renderable->OgreObject());
-        this->dataPtr->rayLines.push_back(renderable);
+    renderable->SetOperationType(MT_LINE_LIST);
+    MaterialPtr mat = this->Scene()->Material("Lidar/BlueRay");
+    renderable->SetMaterial(mat, false);
 
-        if (this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS)
-        {
-          renderable = std::shared_ptr<Ogre2DynamicRenderable>(
-                                  new Ogre2DynamicRenderable(this->Scene()));
+    this->ogreNode->attachObject(renderable->OgreObject());
+    this->scene->SetSceneGraphDirty();
+    this->dataPtr->rayLines.push_back(renderable);
+  }
 
-          renderable->SetOperationType(MT_TRIANGLE_STRIP);
-          mat = this->Scene()->Material("Lidar/LightBlueStrips");
+  while (strips && this->dataPtr->rayStrips.size() < this->verticalCount)
+  {
+    std::shared_ptr<Ogre2DynamicRenderable> renderable =
+                            std::shared_ptr<Ogre2DynamicRenderable>(
+                                new Ogre2DynamicRenderable(this->Scene()));
 
-          renderable->SetMaterial(mat, false);
+    renderable->SetOperationType(MT_TRIANGLE_STRIP);
+    MaterialPtr mat = this->Scene()->Material("Lidar/LightBlueStrips");
 
-          this->ogreNode->attachObject(renderable->OgreObject());
-          this->dataPtr->noHitRayStrips.push_back(renderable);
+    renderable->SetMaterial(mat, false);
 
-          renderable = std::shared_ptr<Ogre2DynamicRenderable>(
-                                  new Ogre2DynamicRenderable(this->Scene()));
+    this->ogreNode->attachObject(renderable->OgreObject());
+    this->scene->SetSceneGraphDirty();
+    this->dataPtr->noHitRayStrips.push_back(renderable);
 
-          renderable->SetOperationType(MT_TRIANGLE_FAN);
-          mat = this->Scene()->Material("Lidar/TransBlack");
+    renderable = std::shared_ptr<Ogre2DynamicRenderable>(
+                            new Ogre2DynamicRenderable(this->Scene()));
 
-          renderable->SetMaterial(mat, false);
+    renderable->SetOperationType(MT_TRIANGLE_FAN);
+    mat = this->Scene()->Material("Lidar/TransBlack");
 
-          this->ogreNode->attachObject(renderable->OgreObject());
-          this->dataPtr->deadZoneRayFans.push_back(renderable);
-          this->dataPtr->deadZoneRayFans[j]->AddPoint(
-                      gz::math::Vector3d::Zero);
+    renderable->SetMaterial(mat, false);
 
-          renderable = std::shared_ptr<Ogre2DynamicRenderable>(
-                                  new Ogre2DynamicRenderable(this->Scene()));
+    this->ogreNode->attachObject(renderable->OgreObject());
+    this->scene->SetSceneGraphDirty();
+    this->dataPtr->deadZoneRayFans.push_back(renderable);
 
-          renderable->SetOperationType(MT_TRIANGLE_STRIP);
-          mat = this->Scene()->Material("Lidar/BlueStrips");
+    renderable = std::shared_ptr<Ogre2DynamicRenderable>(
+                            new Ogre2DynamicRenderable(this->Scene()));
 
-          renderable->SetMaterial(mat, false);
+    renderable->SetOperationType(MT_TRIANGLE_STRIP);
+    mat = this->Scene()->Material("Lidar/BlueStrips");
 
-          this->ogreNode->attachObject(renderable->OgreObject());
-          this->dataPtr->rayStrips.push_back(renderable);
-        }
-      }
-    }
+    renderable->SetMaterial(mat, false);
 
-    else if (this->dataPtr->lidarVisType ==
-                  LidarVisualType::LVT_POINTS)
-    {
-      if (j+1 > this->dataPtr->points.size())
-      {
-        std::shared_ptr<Ogre2DynamicRenderable> renderable =
-                        std::shared_ptr<Ogre2DynamicRenderable>(
-                                    new Ogre2DynamicRenderable(this->Scene()));
+    this->ogreNode->attachObject(renderable->OgreObject());
+    this->scene->SetSceneGraphDirty();
+    this->dataPtr->rayStrips.push_back(renderable);
+  }
 
-        renderable->SetOperationType(MT_POINTS);
+  if (points && this->dataPtr->points.empty())
+  {
+    std::shared_ptr<Ogre2DynamicRenderable> renderable =
+                    std::shared_ptr<Ogre2DynamicRenderable>(
+                                new Ogre2DynamicRenderable(this->Scene()));
 
-        // use low level programmable material so we can customize point size
-        Ogre::Item *item = dynamic_cast<Ogre::Item *>(renderable->OgreObject());
-        item->setCastShadows(false);
-        item->getSubItem(0)->setMaterial(this->dataPtr->pointsMat);
+    renderable->SetOperationType(MT_POINTS);
 
-        this->ogreNode->attachObject(renderable->OgreObject());
-        this->dataPtr->points.push_back(renderable);
-      }
-    }
+    // use low level programmable material so we can customize point size
+    Ogre::Item *item = dynamic_cast<Ogre::Item *>(renderable->OgreObject());
+    item->setCastShadows(false);
+    item->getSubItem(0)->setMaterial(this->dataPtr->pointsMat);
 
-    if (this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS)
-    {
-      this->dataPtr->deadZoneRayFans[j]->SetPoint(0, this->offset.Pos());
-    }
+    this->ogreNode->attachObject(renderable->OgreObject());
+    this->scene->SetSceneGraphDirty();
+    this->dataPtr->points.push_back(renderable);
+  }
 
-    auto pointMat = this->Scene()->Material("Lidar/BlueRay");
+  // Process each point from received data. Vertices are gathered into
+  // scratch arrays and handed to the renderables in one call each.
+  const gz::math::Vector3d origin = this->offset.Pos();
+  this->dataPtr->lineXyz.clear();
+  this->dataPtr->pointXyz.clear();
+  for (unsigned int j = 0; j < this->verticalCount; ++j)
+  {
+    this->dataPtr->stripXyz.clear();
+    this->dataPtr->noHitStripXyz.clear();
+    this->dataPtr->fanXyz.clear();
+    if (strips)
+      AppendPoint(this->dataPtr->fanXyz, origin);
 
-    unsigned count = this->horizontalCount;
     // Process each ray in current scan
-    for (unsigned int i = 0; i < count; ++i)
+    for (unsigned int i = 0; i < this->horizontalCount; ++i)
     {
+      const unsigned int index = j * this->horizontalCount + i;
+
       // calculate range of the ray
-      double r = this->dataPtr->lidarPoints[ j * this->horizontalCount + i];
+      double r = ranges ? static_cast<double>(ranges[index * stride]) :
+          this->dataPtr->lidarPoints[index];
 
       bool inf = (std::isinf(r) || r >= this->maxRange);
-      gz::math::Quaterniond ray(
-        gz::math::Vector3d(0.0, -verticalAngle, horizontalAngle));
-
-      gz::math::Vector3d axis = this->offset.Rot() * ray *
-        gz::math::Vector3d(1.0, 0.0, 0.0);
+      const gz::math::Vector3d &axis = this->dataPtr->rayDirections[index];
 
       // Check for infinite range, which indicates the ray did not
       // intersect an object.
       double hitRange = inf ? 0 : r;
 
       // Compute the start point of the ray
-      gz::math::Vector3d startPt =
-                  (axis * this->minRange) + this->offset.Pos();
+      gz::math::Vector3d startPt = (axis * this->minRange) + origin;
 
       // Compute the end point of the ray
-      gz::math::Vector3d pt =
-                  (axis * hitRange) + this->offset.Pos();
+      gz::math::Vector3d pt = (axis * hitRange) + origin;
 
       double noHitRange = inf ? this->maxRange : hitRange;
 
       // Compute the end point of the no-hit ray
-      gz::math::Vector3d noHitPt =
-                  (axis * noHitRange) + this->offset.Pos();
+      gz::math::Vector3d noHitPt = (axis * noHitRange) + origin;
 
       // Update the lines and strips that represent each simulated ray.
-
-      // For TRIANGLE_STRIPS Lidar Visual to be displayed
-      if (this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS
-        || this->dataPtr->lidarVisType == LidarVisualType::LVT_RAY_LINES)
+      if (rays && (this->displayNonHitting || !inf))
       {
-        if (i >= this->dataPtr->rayLines[j]->PointCount()/2)
-        {
-          if (this->displayNonHitting || !inf)
-          {
-            this->dataPtr->rayLines[j]->AddPoint(startPt);
-            this->dataPtr->rayLines[j]->AddPoint(inf ? noHitPt: pt);
-          }
-
-          if (this->dataPtr->lidarVisType ==
-                LidarVisualType::LVT_TRIANGLE_STRIPS)
-          {
-            this->dataPtr->rayStrips[j]->AddPoint(startPt);
-            this->dataPtr->rayStrips[j]->AddPoint(inf ? startPt : pt);
-
-            this->dataPtr->noHitRayStrips[j]->AddPoint(startPt);
-            this->dataPtr->noHitRayStrips[j]->AddPoint(
-                inf ? (this->displayNonHitting? noHitPt: startPt) : pt);
-          }
-        }
-        else
-        {
-          if (this->displayNonHitting || !inf)
-          {
-            this->dataPtr->rayLines[j]->SetPoint(i*2, startPt);
-            this->dataPtr->rayLines[j]->SetPoint(i*2+1, inf ? noHitPt: pt);
-          }
-
-          if (this->dataPtr->lidarVisType ==
-                LidarVisualType::LVT_TRIANGLE_STRIPS)
-          {
-            this->dataPtr->rayStrips[j]->SetPoint(i*2, startPt);
-            this->dataPtr->rayStrips[j]->SetPoint(i*2+1, inf? startPt : pt);
-
-            this->dataPtr->noHitRayStrips[j]->SetPoint(i*2, startPt);
-            this->dataPtr->noHitRayStrips[j]->SetPoint(i*2+1,
-                inf ? (this->displayNonHitting? noHitPt: startPt) : pt);
-          }
-        }
-        if (this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS)
-        {
-          // Draw the triangle fan that indicates the dead zone.
-          if (i+1 >= this->dataPtr->deadZoneRayFans[j]->PointCount())
-            this->dataPtr->deadZoneRayFans[j]->AddPoint(startPt);
-          else
-            this->dataPtr->deadZoneRayFans[j]->SetPoint(i+1, startPt);
-        }
+        AppendPoint(this->dataPtr->lineXyz, startPt);
+        AppendPoint(this->dataPtr->lineXyz, inf ? noHitPt : pt);
       }
 
-      // For POINTS Lidar Visual to be displayed
-      else if (this->dataPtr->lidarVisType ==
-                LidarVisualType::LVT_POINTS)
+      if (strips)
       {
-        if (i >= this->dataPtr->points[j]->PointCount())
-        {
-          if (this->displayNonHitting || !inf)
-          {
-            this->dataPtr->points[j]->AddPoint(inf ? noHitPt : pt,
-                pointMat->Diffuse());
-          }
-        }
-        else
-        {
-          if (this->displayNonHitting || !inf)
-          {
-            this->dataPtr->points[j]->SetPoint(i, inf ? noHitPt : pt);
-            this->dataPtr->points[j]->SetColor(i, pointMat->Diffuse());
-          }
-        }
+        AppendPoint(this->dataPtr->stripXyz, startPt);
+        AppendPoint(this->dataPtr->stripXyz, inf ? startPt : pt);
+
+        AppendPoint(this->dataPtr->noHitStripXyz, startPt);
+        AppendPoint(this->dataPtr->noHitStripXyz,
+            inf ? (this->displayNonHitting ? noHitPt : startPt) : pt);
+
+        // Draw the triangle fan that indicates the dead zone.
+        AppendPoint(this->dataPtr->fanXyz, startPt);
       }
-      horizontalAngle += this->horizontalAngleStep;
+
+      if (points && (this->displayNonHitting || !inf))
+        AppendPoint(this->dataPtr->pointXyz, inf ? noHitPt : pt);
     }
 
-    // Update the DynamicLines pointers after adding points based on type
-    if (this->dataPtr->lidarVisType == LidarVisualType::LVT_TRIANGLE_STRIPS
-      || this->dataPtr->lidarVisType == LidarVisualType::LVT_RAY_LINES)
+    if (strips)
     {
-      this->dataPtr->rayLines[j]->Update();
-      if (this->dataPtr->lidarVisType ==
-                      LidarVisualType::LVT_TRIANGLE_STRIPS)
-      {
-        this->dataPtr->rayStrips[j]->Update();
-        this->dataPtr->noHitRayStrips[j]->Update();
-        this->dataPtr->deadZoneRayFans[j]->Update();
-      }
+      SetRenderablePoints(this->dataPtr->rayStrips[j],
+          this->dataPtr->stripXyz);
+      SetRenderablePoints(this->dataPtr->noHitRayStrips[j],
+          this->dataPtr->noHitStripXyz);
+      SetRenderablePoints(this->dataPtr->deadZoneRayFans[j],
+          this->dataPtr->fanXyz);
     }
-    else if (this->dataPtr->lidarVisType == LidarVisualType::LVT_POINTS)
+  }
+
+  if (rays)
+    SetRenderablePoints(this->dataPtr->rayLines[0], this->dataPtr->lineXyz);
+
+  if (points)
+  {
+    // all points share the ray color
+    const gz::math::Color color =
+        this->Scene()->Material("Lidar/BlueRay")->Diffuse();
+    const size_t count = this->dataPtr->pointXyz.size() / 3u;
+    this->dataPtr->pointRgba.resize(count * 4u);
+    for (size_t i = 0u; i < count; ++i)
     {
-      this->dataPtr->points[j]->Update();
+      this->dataPtr->pointRgba[i*4] = color.R();
+      this->dataPtr->pointRgba[i*4+1] = color.G();
+      this->dataPtr->pointRgba[i*4+2] = color.B();
+      this->dataPtr->pointRgba[i*4+3] = color.A();
     }
-    verticalAngle += this->verticalAngleStep;
+    this->dataPtr->points[0]->SetPoints(this->dataPtr->pointXyz.data(),
+        this->dataPtr->pointRgba.data(), count);
+    this->dataPtr->points[0]->Update();
   }
 
   if (this->dataPtr->lidarVisType == LidarVisualType::LVT_POINTS &&
@@ -503,21 +567,112 @@ void Ogre2LidarVisual::Update()
   this->SetVisible(this->dataPtr->visible);
 }
 
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::UpdateRayDirections()
+{
+  // the scan pattern of a bound sensor may change every frame
+  if (this->dataPtr->gpuRays &&
+      !this->dataPtr->gpuRays->RayDirections().empty())
+  {
+    const std::vector<gz::math::Vector2d> &pattern =
+        this->dataPtr->gpuRays->RayDirections();
+    this->dataPtr->rayDirectionsKey.clear();
+    this->dataPtr->rayDirections.resize(pattern.size());
+    for (size_t i = 0u; i < pattern.size(); ++i)
+    {
+      gz::math::Quaterniond ray(
+        gz::math::Vector3d(0.0, -pattern[i].Y(), pattern[i].X()));
+      this->dataPtr->rayDirections[i] =
+          this->offset.Rot() * ray * gz::math::Vector3d(1.0, 0.0, 0.0);
+    }
+    return;
+  }
+
+  const std::vector<double> key = {
+      this->minHorizontalAngle, this->maxHorizontalAngle,
+      this->minVerticalAngle, this->maxVerticalAngle,
+      static_cast<double>(this->horizontalCount),
+      static_cast<double>(this->verticalCount),
+      this->offset.Rot().W(), this->offset.Rot().X(),
+      this->offset.Rot().Y(), this->offset.Rot().Z()};
+  if (key == this->dataPtr->rayDirectionsKey)
+    return;
+  this->dataPtr->rayDirectionsKey = key;
+
+  // The ray angles only change with the sensor configuration so the
+  // directions are computed once instead of once per ray per update
+  this->dataPtr->rayDirections.resize(
+      this->verticalCount * this->horizontalCount);
+  for (unsigned int j = 0; j < this->verticalCount; ++j)
+  {
+    double verticalAngle = this->minVerticalAngle +
+        j * this->verticalAngleStep;
+    for (unsigned int i = 0; i < this->horizontalCount; ++i)
+    {
+      double horizontalAngle = this->minHorizontalAngle +
+          i * this->horizontalAngleStep;
+      gz::math::Quaterniond ray(
+        gz::math::Vector3d(0.0, -verticalAngle, horizontalAngle));
+      this->dataPtr->rayDirections[j * this->horizontalCount + i] =
+          this->offset.Rot() * ray * gz::math::Vector3d(1.0, 0.0, 0.0);
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 unsigned int Ogre2LidarVisual::PointCount() const
 {
+  if (this->dataPtr->gpuRays)
+  {
+    return static_cast<unsigned int>(this->dataPtr->gpuRays->RangeCount() *
+        this->dataPtr->gpuRays->VerticalRangeCount());
+  }
   return this->dataPtr->lidarPoints.size();
 }
 
 //////////////////////////////////////////////////
 std::vector<double> Ogre2LidarVisual::Points() const
 {
-  return this->dataPtr->lidarPoints;
+  if (!this->dataPtr->gpuRays)
+    return this->dataPtr->lidarPoints;
+
+  std::vector<double> points;
+  std::shared_ptr<const float> frame = this->dataPtr->gpuRays->AcquireData();
+  if (!frame)
+    return points;
+  const unsigned int stride = this->dataPtr->gpuRays->Channels();
+  points.resize(this->PointCount());
+  for (size_t i = 0u; i < points.size(); ++i)
+    points[i] = frame.get()[i * stride];
+  return points;
+}
+
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::SetGpuRays(const GpuRaysPtr &_gpuRays)
+{
+  if (_gpuRays && _gpuRays->Scene() != this->Scene())
+  {
+    gzerr << "Unable to bind lidar visual [" << this->Name() << "] to "
+          << "GpuRays [" << _gpuRays->Name() << "] of another scene"
+          << std::endl;
+    return;
+  }
+  this->dataPtr->gpuRays = _gpuRays;
+  this->dataPtr->gpuRaysSequence = 0u;
+  this->dataPtr->receivedData = false;
+}
+
+//////////////////////////////////////////////////
+GpuRaysPtr Ogre2LidarVisual::GpuRays() const
+{
+  return this->dataPtr->gpuRays;
 }
 
 //////////////////////////////////////////////////
 void Ogre2LidarVisual::SetVisible(bool _visible)
 {
   this->dataPtr->visible = _visible;
+  this->visible = _visible;
   this->ogreNode->setVisible(this->dataPtr->visible);
+  this->scene->SetSceneGraphDirty();
 }
@@ -178,6 +178,7 @@ void Ogre2Light::Destroy()
   ogreSceneManager->destroySceneNode(this->ogreLight->getParentSceneNode());
   ogreSceneManager->destroyLight(this->ogreLight);
   this->scene->SetLightsGiDirty();
+  this->scene->SetLightListDirty();
 }
 
 //////////////////////////////////////////////////
@@ -186,6 +187,7 @@ void Ogre2Light::Init()
   Ogre2Node::Init();
   this->CreateLight();
   this->Reset();
+  this->scene->SetLightListDirty();
 }
 
 //////////////////////////////////////////////////
@@ -235,6 +237,7 @@ void Ogre2DirectionalLight::SetDirection(const math::Vector3d &_dir)
 {
   this->ogreLight->setDirection(Ogre2Conversions::Convert(_dir));
   this->scene->SetLightsGiDirty();
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -274,6 +277,7 @@ void Ogre2SpotLight::SetDirection(const math::Vector3d &_dir)
 {
   this->ogreLight->setDirection(Ogre2Conversions::Convert(_dir));
   this->scene->SetLightsGiDirty();
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
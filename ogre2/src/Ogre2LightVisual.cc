@@ -80,6 +80,7 @@ void Ogre2LightVisual::CreateVisual()
     this->dataPtr->lightVisual.reset(
       new Ogre2DynamicRenderable(this->Scene()));
     this->ogreNode->attachObject(this->dataPtr->lightVisual->OgreObject());
+    this->scene->SetSceneGraphDirty();
   }
 
   // Clear any previous data from the grid and update
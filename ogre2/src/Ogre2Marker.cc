@@ -278,6 +278,7 @@ void Ogre2Marker::SetMaterial(MaterialPtr _material, bool _unique)
 
   this->dataPtr->material = derived;
   this->dataPtr->ownsMaterial = _unique;
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -292,6 +293,7 @@ void Ogre2Marker::SetPoint(unsigned int _index,
 {
   BaseMarker::SetPoint(_index, _value);
   this->dataPtr->dynamicRenderable->SetPoint(_index, _value);
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -300,6 +302,7 @@ void Ogre2Marker::AddPoint(const math::Vector3d &_pt,
 {
   BaseMarker::AddPoint(_pt, _color);
   this->dataPtr->dynamicRenderable->AddPoint(_pt, _color);
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -307,6 +310,23 @@ void Ogre2Marker::ClearPoints()
 {
   BaseMarker::ClearPoints();
   this->dataPtr->dynamicRenderable->Clear();
+  this->SetPreRenderDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Marker::SetPoints(const float *_xyz, const float *_rgba,
+    size_t _count)
+{
+  this->dataPtr->dynamicRenderable->SetPoints(_xyz, _rgba, _count);
+  this->SetPreRenderDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Marker::AppendPoints(const float *_xyz, const float *_rgba,
+    size_t _count)
+{
+  this->dataPtr->dynamicRenderable->AppendPoints(_xyz, _rgba, _count);
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -316,6 +336,7 @@ void Ogre2Marker::SetType(MarkerType _markerType)
     return;
 
   this->markerType = _markerType;
+  this->SetPreRenderDirty();
 
   auto visual = std::dynamic_pointer_cast<Ogre2Visual>(this->Parent());
 
@@ -27,6 +27,7 @@
 #include <OgreHighLevelGpuProgram.h>
 #include <OgreHighLevelGpuProgramManager.h>
 #include <OgreHlmsManager.h>
+#include <OgreImage2.h>
 #include <OgreItem.h>
 #include <OgreMaterialManager.h>
 #include <OgrePixelFormatGpuUtils.h>
@@ -37,6 +38,13 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Image.hh>
@@ -46,13 +54,172 @@
 #include "gz/rendering/ShaderType.hh"
 #include "gz/rendering/ogre2/Ogre2Material.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
+#include "gz/rendering/ogre2/Ogre2Mesh.hh"
 #include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 
+#include "Ogre2TextureCompressor.hh"
+
 
 /// \brief Private data for the Ogre2Material class
-class gz::rendering::Ogre2MaterialPrivate
-{
+class gz::rendering::Ogre2MaterialPrivate : public Ogre::TextureGpuListener
+{
+  /// \brief Wait for a texture that is being streamed in the background
+  /// and call textureReady once it can be rendered
+  /// \param[in] _texture Texture being streamed
+  /// \param[in] _type Texture map slot the texture is assigned to
+  public: void TrackTextureLoad(Ogre::TextureGpu *_texture,
+              Ogre::PbsTextureTypes _type)
+  {
+    this->CancelTextureLoad(_type);
+    if (!this->IsPendingTexture(_texture))
+      _texture->addListener(this);
+    this->pendingTextures[_type] = _texture;
+    this->scene->TextureLoadStarted();
+  }
+
+  /// \brief Stop waiting for the streamed texture of a texture map slot,
+  /// e.g. because the map was cleared or replaced
+  /// \param[in] _type Texture map slot
+  public: void CancelTextureLoad(Ogre::PbsTextureTypes _type)
+  {
+    auto it = this->pendingTextures.find(_type);
+    if (it == this->pendingTextures.end())
+      return;
+    Ogre::TextureGpu *texture = it->second;
+    this->pendingTextures.erase(it);
+    if (!this->IsPendingTexture(texture))
+      texture->removeListener(this);
+    this->scene->TextureLoadFinished();
+  }
+
+  /// \brief Stop waiting for all streamed textures
+  public: void CancelTextureLoads()
+  {
+    while (!this->pendingTextures.empty())
+      this->CancelTextureLoad(this->pendingTextures.begin()->first);
+  }
+
+  /// \brief Check if any texture map slot is waiting for a texture
+  /// \param[in] _texture Texture to check
+  /// \return True if _texture is pending
+  public: bool IsPendingTexture(const Ogre::TextureGpu *_texture) const
+  {
+    for (const auto &it : this->pendingTextures)
+    {
+      if (it.second == _texture)
+        return true;
+    }
+    return false;
+  }
+
+  // Documentation inherited
+  public: void notifyTextureChanged(Ogre::TextureGpu *_texture,
+              Ogre::TextureGpuListener::Reason _reason,
+              void */*_extraData*/) override
+  {
+    if (_reason != Ogre::TextureGpuListener::ReadyForRendering &&
+        _reason != Ogre::TextureGpuListener::Deleted)
+    {
+      return;
+    }
+
+    // Ogre iterates over a copy of the listeners, so it is safe to remove
+    // ourselves here
+    if (_reason == Ogre::TextureGpuListener::ReadyForRendering)
+      _texture->removeListener(this);
+
+    for (auto it = this->pendingTextures.begin();
+         it != this->pendingTextures.end();)
+    {
+      if (it->second != _texture)
+      {
+        ++it;
+        continue;
+      }
+      Ogre::PbsTextureTypes type = it->first;
+      it = this->pendingTextures.erase(it);
+      this->scene->TextureLoadFinished();
+      if (_reason == Ogre::TextureGpuListener::ReadyForRendering &&
+          this->textureReady)
+      {
+        this->textureReady(_texture, type);
+      }
+    }
+  }
+
+  /// \brief Scene the material belongs to, used to report pending
+  /// texture loads
+  public: Ogre2Scene *scene = nullptr;
+
+  /// \brief Streamed textures the material is waiting for, indexed by
+  /// texture map slot
+  public: std::map<Ogre::PbsTextureTypes, Ogre::TextureGpu *>
+      pendingTextures;
+
+  /// \brief Called when a streamed texture is ready to be rendered
+  public: std::function<void(Ogre::TextureGpu *, Ogre::PbsTextureTypes)>
+      textureReady;
+
+  /// \brief True if ogreDatablock is shared with other materials through
+  /// the scene's datablock pool
+  public: bool sharedDatablock = false;
+
+  /// \brief Submeshes the material was assigned to. Used to point them to
+  /// a different datablock when the material starts or stops sharing it.
+  public: std::vector<std::weak_ptr<Ogre2SubMesh>> subMeshes;
+
+  /// \brief Append the raw bytes of a value to a datablock key
+  /// \param[in,out] _key Key to append to
+  /// \param[in] _value Value to append
+  public: template<typename T>
+          static void AppendKey(std::string &_key, const T &_value)
+  {
+    _key.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+
+  /// \brief Build a key describing all properties of a datablock that
+  /// gz-rendering can set. Datablocks with the same key render the same.
+  /// Macroblocks, blendblocks and samplerblocks are compared by pointer
+  /// since the Hlms manager already deduplicates them.
+  /// \param[in] _datablock Datablock to describe
+  /// \return Datablock key
+  public: static std::string DatablockKey(
+              const Ogre::HlmsPbsDatablock *_datablock)
+  {
+    std::string key;
+    AppendKey(key, _datablock->getDiffuse());
+    AppendKey(key, _datablock->getSpecular());
+    AppendKey(key, _datablock->getEmissive());
+    AppendKey(key, _datablock->getFresnel());
+    AppendKey(key, _datablock->getRoughness());
+    AppendKey(key, _datablock->getMetalness());
+    AppendKey(key, _datablock->getTransparency());
+    AppendKey(key, _datablock->getTransparencyMode());
+    AppendKey(key, _datablock->getUseAlphaFromTextures());
+    AppendKey(key, _datablock->getAlphaTest());
+    AppendKey(key, _datablock->getAlphaTestThreshold());
+    AppendKey(key, _datablock->getMacroblock());
+    AppendKey(key, _datablock->getBlendblock());
+    AppendKey(key, _datablock->getReceiveShadows());
+    AppendKey(key, _datablock->getTwoSidedLighting());
+    AppendKey(key, _datablock->getWorkflow());
+    AppendKey(key, _datablock->getBrdf());
+    AppendKey(key, _datablock->getUseEmissiveAsLightmap());
+    AppendKey(key, _datablock->getUseDiffuseMapAsGrayscale());
+    AppendKey(key, _datablock->getNormalMapWeight());
+    for (Ogre::uint8 i = 0u; i < 4u; ++i)
+      AppendKey(key, _datablock->getDetailMapBlendMode(i));
+    for (Ogre::uint8 i = 0u; i < Ogre::NUM_PBSM_TEXTURE_TYPES; ++i)
+    {
+      auto type = static_cast<Ogre::PbsTextureTypes>(i);
+      AppendKey(key, _datablock->getTexture(i));
+      AppendKey(key, _datablock->getSamplerblock(i));
+      AppendKey(key, _datablock->getTextureUvSource(type));
+    }
+    return key;
+  }
+
   /// \brief Ogre stores the name using hashes. This variable will
   /// store the material hash name
   public: std::string hashName;
@@ -113,6 +280,79 @@ class gz::rendering::Ogre2MaterialPrivate
   /// Used in ogreSolidColorMat
   public: Ogre::HighLevelGpuProgramPtr ogreSolidColorShader;
 
+  /// \brief Load a texture from file and downscale it so that neither
+  /// side is larger than _maxSize before uploading it to the GPU
+  /// \param[in] _name Name of the texture resource
+  /// \param[in] _maxSize Maximum texture width and height
+  /// \param[in] _srgb True to upload the texture in sRGB format
+  /// \return Loaded texture or an existing texture with the same name,
+  /// nullptr if the texture can not be loaded this way and should be left
+  /// to Ogre, e.g. because it uses a compressed format.
+  public: static Ogre::TextureGpu *LoadTexture(const std::string &_name,
+              unsigned int _maxSize, bool _srgb)
+  {
+    Ogre::TextureGpuManager *textureMgr =
+        Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+        getTextureGpuManager();
+    Ogre::TextureGpu *texture = textureMgr->findTextureNoThrow(_name);
+    if (texture)
+      return texture;
+
+    Ogre::Image2 image;
+    try
+    {
+      image.load(_name,
+          Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME);
+    }
+    catch(Ogre::Exception &)
+    {
+      return nullptr;
+    }
+
+    // compressed textures can't be resized on the CPU
+    if (Ogre::PixelFormatGpuUtils::isCompressed(image.getPixelFormat()))
+      return nullptr;
+
+    const uint32_t width = image.getWidth();
+    const uint32_t height = image.getHeight();
+    if (std::max(width, height) > _maxSize)
+    {
+      // halve the size until it fits, the same as dropping mip levels
+      uint32_t w = width;
+      uint32_t h = height;
+      while (std::max(w, h) > _maxSize)
+      {
+        w = std::max(w / 2u, 1u);
+        h = std::max(h / 2u, 1u);
+      }
+      image.resize(w, h);
+      gzdbg << "Downscaled texture [" << _name << "] from " << width << "x"
+            << height << " to " << w << "x" << h << std::endl;
+    }
+    image.generateMipmaps(_srgb);
+
+    Ogre::PixelFormatGpu format = image.getPixelFormat();
+    if (_srgb)
+      format = Ogre::PixelFormatGpuUtils::getEquivalentSRGB(format);
+
+    texture = textureMgr->createOrRetrieveTexture(
+        _name,
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::AutomaticBatching |
+        Ogre::TextureFlags::ManualTexture,
+        Ogre::TextureTypes::Type2D,
+        Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME,
+        0u);
+    texture->setPixelFormat(format);
+    texture->setTextureType(Ogre::TextureTypes::Type2D);
+    texture->setNumMipmaps(image.getNumMipmaps());
+    texture->setResolution(image.getWidth(), image.getHeight());
+    texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    texture->waitForData();
+    image.uploadTo(texture, 0u, texture->getNumMipmaps() - 1u);
+    return texture;
+  }
+
   /// \brief Returns the shader language code.
   /// \param[in] _graphicsAPI The graphic API.
   /// \return The shader language code string.
@@ -130,6 +370,127 @@ class gz::rendering::Ogre2MaterialPrivate
         return "invalid";
     }
   }
+
+  /// \brief GPU constant of a registered shader param
+  public: struct ShaderParamConstant
+  {
+    /// \brief True if the param can be written straight to the constant
+    bool valid = false;
+
+    /// \brief True if the constant holds floats, false for ints
+    bool isFloat = true;
+
+    /// \brief Physical index of the constant
+    size_t physicalIndex = 0u;
+
+    /// \brief Number of values of the constant
+    size_t size = 0u;
+  };
+
+  /// \brief Write the registered params that changed straight to their GPU
+  /// constants. The constants are resolved by name once per handle.
+  /// \param[in] _params Params whose handles are written
+  /// \param[in] _ogreParams Ogre params to write to
+  /// \return False if a changed param must be updated by name, e.g.
+  /// textures and auto constants
+  public: bool UpdateShaderParamHandles(const ShaderParams &_params,
+      const Ogre::GpuProgramParametersSharedPtr &_ogreParams)
+  {
+    std::vector<ShaderParamConstant> *constants = nullptr;
+    for (auto &entry : this->shaderParamConstants)
+    {
+      if (entry.first == _ogreParams)
+      {
+        constants = &entry.second;
+        break;
+      }
+    }
+    if (!constants)
+    {
+      this->shaderParamConstants.emplace_back(_ogreParams,
+          std::vector<ShaderParamConstant>());
+      constants = &this->shaderParamConstants.back().second;
+    }
+
+    const uint32_t count = _params.HandleCount();
+    while (constants->size() < count)
+    {
+      const auto handle = static_cast<ShaderParams::Handle>(constants->size());
+      const std::string &name = _params.HandleName(handle);
+      const ShaderParam::ParamType type = _params.HandleType(handle);
+      ShaderParamConstant constant;
+      if ((type == ShaderParam::PARAM_FLOAT ||
+           type == ShaderParam::PARAM_INT ||
+           type == ShaderParam::PARAM_FLOAT_BUFFER ||
+           type == ShaderParam::PARAM_INT_BUFFER) &&
+          !Ogre::GpuProgramParameters::getAutoConstantDefinition(name))
+      {
+        const Ogre::GpuConstantDefinition *def =
+            _ogreParams->_findNamedConstantDefinition(name, false);
+        if (def)
+        {
+          constant.valid = true;
+          constant.isFloat =
+              Ogre::GpuConstantDefinition::isFloat(def->constType);
+          constant.physicalIndex = def->physicalIndex;
+          constant.size = def->elementSize * def->arraySize;
+        }
+      }
+      constants->push_back(constant);
+    }
+
+    for (ShaderParams::Handle handle = 0u; handle < count; ++handle)
+    {
+      if (!_params.IsDirty(handle))
+        continue;
+
+      const ShaderParamConstant &constant = (*constants)[handle];
+      const ShaderParam &param = _params[handle];
+      if (!constant.valid)
+        return false;
+
+      if (ShaderParam::PARAM_FLOAT == param.Type() && constant.isFloat)
+      {
+        float value;
+        param.Value(&value);
+        _ogreParams->_writeRawConstants(constant.physicalIndex, &value, 1u);
+      }
+      else if (ShaderParam::PARAM_INT == param.Type() && !constant.isFloat)
+      {
+        int value;
+        param.Value(&value);
+        _ogreParams->_writeRawConstants(constant.physicalIndex, &value, 1u);
+      }
+      else if (ShaderParam::PARAM_FLOAT_BUFFER == param.Type() &&
+          constant.isFloat)
+      {
+        std::shared_ptr<void> buffer;
+        param.Buffer(buffer);
+        _ogreParams->_writeRawConstants(constant.physicalIndex,
+            reinterpret_cast<const float *>(buffer.get()),
+            std::min<size_t>(param.Count(), constant.size));
+      }
+      else if (ShaderParam::PARAM_INT_BUFFER == param.Type() &&
+          !constant.isFloat)
+      {
+        std::shared_ptr<void> buffer;
+        param.Buffer(buffer);
+        _ogreParams->_writeRawConstants(constant.physicalIndex,
+            reinterpret_cast<const int *>(buffer.get()),
+            std::min<size_t>(param.Count(), constant.size));
+      }
+      else
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief GPU constants of the registered shader params, indexed by
+  /// handle, for every Ogre params object they were written to
+  public: std::vector<std::pair<Ogre::GpuProgramParametersSharedPtr,
+      std::vector<ShaderParamConstant>>> shaderParamConstants;
 };
 
 using namespace gz;
@@ -155,14 +516,26 @@ void Ogre2Material::Destroy()
     // just reset the ogre pointers and return.
     this->dataPtr->ogreSolidColorMat.reset();
     this->dataPtr->ogreSolidColorShader.reset();
+    this->dataPtr->pendingTextures.clear();
     return;
   }
 
   if (!this->ogreDatablock)
     return;
 
-  this->ogreHlmsPbs->destroyDatablock(this->ogreDatablockId);
+  this->dataPtr->CancelTextureLoads();
+
+  if (this->dataPtr->sharedDatablock)
+  {
+    this->dataPtr->scene->ReleaseSharedDatablock(this->ogreDatablock);
+    this->dataPtr->sharedDatablock = false;
+  }
+  else
+  {
+    this->ogreHlmsPbs->destroyDatablock(this->ogreDatablockId);
+  }
   this->ogreDatablock = nullptr;
+  this->dataPtr->subMeshes.clear();
 
   if (this->ogreUnlitDatablock)
   {
@@ -289,6 +662,8 @@ math::Color Ogre2Material::Diffuse() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetDiffuse(const math::Color &_color)
 {
+  this->DetachDatablock();
+
   BaseMaterial::SetDiffuse(_color);
   this->ogreDatablock->setDiffuse(
       Ogre::Vector3(_color.R(), _color.G(), _color.B()));
@@ -306,6 +681,8 @@ math::Color Ogre2Material::Specular() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetSpecular(const math::Color &_color)
 {
+  this->DetachDatablock();
+
   this->ogreDatablock->setSpecular(
       Ogre::Vector3(_color.R(), _color.G(), _color.B()));
 }
@@ -321,6 +698,8 @@ math::Color Ogre2Material::Emissive() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetEmissive(const math::Color &_color)
 {
+  this->DetachDatablock();
+
   this->ogreDatablock->setEmissive(
       Ogre::Vector3(_color.R(), _color.G(), _color.B()));
 }
@@ -335,6 +714,8 @@ void Ogre2Material::SetTransparency(const double _transparency)
 //////////////////////////////////////////////////
 void Ogre2Material::UpdateTransparency()
 {
+  this->DetachDatablock();
+
   Ogre::HlmsPbsDatablock::TransparencyModes mode;
   double opacity = (1.0 - this->transparency) * this->diffuse.A();
   if (math::equal(opacity, 1.0))
@@ -374,6 +755,8 @@ void Ogre2Material::UpdateTransparency()
 void Ogre2Material::SetAlphaFromTexture(bool _enabled,
     double _alpha, bool _twoSided)
 {
+  this->DetachDatablock();
+
   BaseMaterial::SetAlphaFromTexture(_enabled, _alpha, _twoSided);
   if (_enabled)
   {
@@ -401,6 +784,8 @@ float Ogre2Material::RenderOrder() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetRenderOrder(const float _renderOrder)
 {
+  this->DetachDatablock();
+
   this->renderOrder = _renderOrder;
   Ogre::HlmsMacroblock macroblock(
       *this->ogreDatablock->getMacroblock());
@@ -432,6 +817,8 @@ bool Ogre2Material::ReceiveShadows() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetReceiveShadows(const bool _receiveShadows)
 {
+  this->DetachDatablock();
+
   this->ogreDatablock->setReceiveShadows(_receiveShadows);
 }
 
@@ -473,8 +860,11 @@ std::shared_ptr<const common::Image> Ogre2Material::TextureData() const
 //////////////////////////////////////////////////
 void Ogre2Material::ClearTexture()
 {
+  this->DetachDatablock();
+
   this->textureName = "";
   this->dataPtr->textureData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_DIFFUSE);
   this->ogreDatablock->setTexture(Ogre::PBSM_DIFFUSE, this->textureName);
 }
 
@@ -517,8 +907,11 @@ void Ogre2Material::SetNormalMap(const std::string &_name,
 //////////////////////////////////////////////////
 void Ogre2Material::ClearNormalMap()
 {
+  this->DetachDatablock();
+
   this->normalMapName = "";
   this->dataPtr->normalMapData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_NORMAL);
   this->ogreDatablock->setTexture(Ogre::PBSM_NORMAL, this->normalMapName);
 }
 
@@ -566,8 +959,11 @@ void Ogre2Material::SetRoughnessMap(const std::string &_name,
 //////////////////////////////////////////////////
 void Ogre2Material::ClearRoughnessMap()
 {
+  this->DetachDatablock();
+
   this->roughnessMapName = "";
   this->dataPtr->roughnessMapData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_ROUGHNESS);
   this->ogreDatablock->setTexture(Ogre::PBSM_ROUGHNESS, this->roughnessMapName);
 }
 
@@ -615,8 +1011,11 @@ void Ogre2Material::SetMetalnessMap(const std::string &_name,
 //////////////////////////////////////////////////
 void Ogre2Material::ClearMetalnessMap()
 {
+  this->DetachDatablock();
+
   this->metalnessMapName = "";
   this->dataPtr->metalnessMapData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_METALLIC);
   this->ogreDatablock->setTexture(Ogre::PBSM_METALLIC, this->metalnessMapName);
 }
 
@@ -665,8 +1064,11 @@ void Ogre2Material::SetEnvironmentMap(const std::string &_name,
 //////////////////////////////////////////////////
 void Ogre2Material::ClearEnvironmentMap()
 {
+  this->DetachDatablock();
+
   this->environmentMapName = "";
   this->dataPtr->environmentMapData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_REFLECTION);
   this->ogreDatablock->setTexture(
     Ogre::PBSM_REFLECTION, this->environmentMapName);
 }
@@ -715,8 +1117,11 @@ void Ogre2Material::SetEmissiveMap(const std::string &_name,
 //////////////////////////////////////////////////
 void Ogre2Material::ClearEmissiveMap()
 {
+  this->DetachDatablock();
+
   this->emissiveMapName = "";
   this->dataPtr->emissiveMapData = nullptr;
+  this->dataPtr->CancelTextureLoad(Ogre::PBSM_EMISSIVE);
   this->ogreDatablock->setTexture(Ogre::PBSM_EMISSIVE, this->emissiveMapName);
 }
 
@@ -743,6 +1148,8 @@ void Ogre2Material::SetLightMap(const std::string &_name,
   const std::shared_ptr<const common::Image> &_img,
   unsigned int _uvSet)
 {
+  this->DetachDatablock();
+
   if (_name.empty())
   {
     this->ClearLightMap();
@@ -780,19 +1187,26 @@ std::shared_ptr<const common::Image> Ogre2Material::LightMapData() const
 //////////////////////////////////////////////////
 void Ogre2Material::ClearLightMap()
 {
+  this->DetachDatablock();
+
   this->lightMapName = "";
   this->dataPtr->lightMapData = nullptr;
   this->lightMapUvSet = 0u;
 
   // in ogre 2.2, we swtiched to use the emissive map slot for light map
   if (this->ogreDatablock->getUseEmissiveAsLightmap())
+  {
+    this->dataPtr->CancelTextureLoad(Ogre::PBSM_EMISSIVE);
     this->ogreDatablock->setTexture(Ogre::PBSM_EMISSIVE, this->lightMapName);
+  }
   this->ogreDatablock->setUseEmissiveAsLightmap(false);
 }
 
 //////////////////////////////////////////////////
 void Ogre2Material::SetRoughness(const float _roughness)
 {
+  this->DetachDatablock();
+
   this->ogreDatablock->setRoughness(_roughness);
 }
 
@@ -805,6 +1219,8 @@ float Ogre2Material::Roughness() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetMetalness(const float _metalness)
 {
+  this->DetachDatablock();
+
   this->ogreDatablock->setMetalness(_metalness);
 }
 
@@ -818,6 +1234,12 @@ float Ogre2Material::Metalness() const
 void Ogre2Material::PreRender()
 {
   this->UpdateShaderParams();
+
+  // shader params are modified through the returned pointers without
+  // notifying the material so check them again on the next frame
+  if (this->dataPtr->vertexShaderParams ||
+      this->dataPtr->fragmentShaderParams)
+    this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -849,10 +1271,19 @@ void Ogre2Material::UpdateShaderParams()
   }
 }
 
+
 //////////////////////////////////////////////////
 void Ogre2Material::UpdateShaderParams(ConstShaderParamsPtr _params,
     Ogre::GpuProgramParametersSharedPtr _ogreParams)
 {
+  // params only changed through their handles are written straight to
+  // their resolved constants
+  if (!_params->IsNameDirty() &&
+      this->dataPtr->UpdateShaderParamHandles(*_params, _ogreParams))
+  {
+    return;
+  }
+
   for (const auto &name_param : *_params)
   {
     auto *constantDef =
@@ -1051,13 +1482,139 @@ Ogre::MaterialPtr Ogre2Material::Material()
 //////////////////////////////////////////////////
 Ogre::HlmsPbsDatablock *Ogre2Material::Datablock() const
 {
+  // the caller may modify the datablock or assign it to renderables the
+  // material does not know about, so it can not stay shared
+  const_cast<Ogre2Material *>(this)->DetachDatablock();
   return this->ogreDatablock;
 }
 
+//////////////////////////////////////////////////
+Ogre::HlmsPbsDatablock *Ogre2Material::SubMeshDatablock(
+    const Ogre2SubMeshPtr &_subMesh)
+{
+  // forget submeshes that were destroyed or use a different material now
+  auto &subMeshes = this->dataPtr->subMeshes;
+  subMeshes.erase(std::remove_if(subMeshes.begin(), subMeshes.end(),
+      [this, &_subMesh](const std::weak_ptr<Ogre2SubMesh> &_weak)
+      {
+        Ogre2SubMeshPtr subMesh = _weak.lock();
+        return !subMesh || subMesh == _subMesh ||
+            subMesh->Material().get() != this;
+      }), subMeshes.end());
+  // _subMesh is assigned this material once this function returns
+  subMeshes.push_back(_subMesh);
+
+  if (!this->CanShareDatablock() ||
+      !this->dataPtr->scene->MaterialSharingEnabled())
+  {
+    return this->ogreDatablock;
+  }
+
+  // the datablock can only be replaced if all renderables using it belong
+  // to submeshes of this material
+  std::vector<Ogre::SubItem *> subItems;
+  for (const auto &weak : subMeshes)
+  {
+    Ogre2SubMeshPtr subMesh = weak.lock();
+    if (subMesh && subMesh->Ogre2SubItem() &&
+        subMesh->Ogre2SubItem()->getDatablock() == this->ogreDatablock)
+    {
+      subItems.push_back(subMesh->Ogre2SubItem());
+    }
+  }
+  for (Ogre::Renderable *renderable :
+      this->ogreDatablock->getLinkedRenderables())
+  {
+    if (std::find(subItems.begin(), subItems.end(), renderable) ==
+        subItems.end())
+    {
+      return this->ogreDatablock;
+    }
+  }
+
+  this->ShareDatablock(subItems);
+  return this->ogreDatablock;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Material::CanShareDatablock() const
+{
+  return this->ogreDatablock && !this->dataPtr->sharedDatablock &&
+      this->dataPtr->scene &&
+      this->dataPtr->vertexShaderPath.empty() &&
+      this->dataPtr->fragmentShaderPath.empty() &&
+      this->dataPtr->pendingTextures.empty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Material::ShareDatablock(
+    const std::vector<Ogre::SubItem *> &_subItems)
+{
+  Ogre::HlmsPbsDatablock *shared =
+      this->dataPtr->scene->AcquireSharedDatablock(
+      Ogre2MaterialPrivate::DatablockKey(this->ogreDatablock),
+      this->ogreDatablock);
+  for (Ogre::SubItem *subItem : _subItems)
+    subItem->setDatablock(shared);
+  this->ogreHlmsPbs->destroyDatablock(this->ogreDatablockId);
+  this->ogreDatablock = shared;
+  this->dataPtr->sharedDatablock = true;
+}
+
+//////////////////////////////////////////////////
+MaterialPtr Ogre2Material::Clone(const std::string &_name) const
+{
+  MaterialPtr material = BaseMaterial::Clone(_name);
+
+  // the clone is identical to this material, so it can use the shared
+  // datablock until one of its setters detaches it again. A fresh clone
+  // is not assigned to any renderable yet.
+  auto clone = std::dynamic_pointer_cast<Ogre2Material>(material);
+  if (clone && clone->CanShareDatablock() &&
+      clone->ogreDatablock->getLinkedRenderables().empty())
+  {
+    clone->ShareDatablock({});
+  }
+  return material;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Material::DetachDatablock()
+{
+  if (!this->dataPtr->sharedDatablock)
+    return;
+
+  Ogre::HlmsPbsDatablock *shared = this->ogreDatablock;
+  this->ogreDatablock = static_cast<Ogre::HlmsPbsDatablock *>(
+      shared->clone(this->ogreDatablockId));
+  this->dataPtr->sharedDatablock = false;
+
+  for (const auto &weak : this->dataPtr->subMeshes)
+  {
+    Ogre2SubMeshPtr subMesh = weak.lock();
+    if (subMesh && subMesh->Material().get() == this &&
+        subMesh->Ogre2SubItem() &&
+        subMesh->Ogre2SubItem()->getDatablock() == shared)
+    {
+      subMesh->Ogre2SubItem()->setDatablock(this->ogreDatablock);
+    }
+  }
+
+  this->dataPtr->scene->ReleaseSharedDatablock(shared);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Material::SetTextureMapImpl(const std::string &_texture,
   Ogre::PbsTextureTypes _type)
 {
+  // textures are streamed, this times the request and any synchronous
+  // decoding but not the upload
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2Material::SetTextureMap", "texture", _texture);
+
+  this->DetachDatablock();
+  this->dataPtr->CancelTextureLoad(_type);
+
   // FIXME(anyone) need to keep baseName = _texture for all meshes. Refer to
   // https://github.com/gazebosim/gz-rendering/issues/139
   // for more details
@@ -1169,42 +1726,82 @@ void Ogre2Material::SetTextureMapImpl(const std::string &_texture,
   samplerBlockRef.mV = Ogre::TAM_WRAP;
   samplerBlockRef.mW = Ogre::TAM_WRAP;
 
-  this->ogreDatablock->setTexture(_type, baseName, &samplerBlockRef);
-  auto tex = textureMgr->findTextureNoThrow(baseName);
+  // Normal maps are converted to a different format by Ogre and
+  // environment maps are cube maps, always let Ogre load those unless they
+  // are compressed
+  Ogre::TextureGpu *tex = nullptr;
+  const unsigned int maxSize =
+      Ogre2RenderEngine::Instance()->TextureMaxSize();
+  if (Ogre2RenderEngine::Instance()->TextureCompression() &&
+      _type != Ogre::PBSM_REFLECTION)
+  {
+    tex = Ogre2TextureCompressor::Load(baseName, _texture, maxSize,
+        this->ogreDatablock->suggestUsingSRGB(_type),
+        _type == Ogre::PBSM_NORMAL, this->scene);
+  }
+  if (!tex && maxSize > 0u && _type != Ogre::PBSM_NORMAL &&
+      _type != Ogre::PBSM_REFLECTION)
+  {
+    tex = Ogre2MaterialPrivate::LoadTexture(baseName, maxSize,
+        this->ogreDatablock->suggestUsingSRGB(_type));
+  }
 
   if (tex)
   {
-    tex->waitForMetadata();
-    this->dataPtr->hashName = tex->getName().getFriendlyText();
+    this->ogreDatablock->setTexture(_type, tex, &samplerBlockRef);
+  }
+  else
+  {
+    this->ogreDatablock->setTexture(_type, baseName, &samplerBlockRef);
+    tex = textureMgr->findTextureNoThrow(baseName);
+  }
+  if (!tex)
+    return;
+
+  // Ogre already loads the texture in the background, don't wait for it
+  // if the user opted in to texture streaming
+  if (this->scene->TextureStreamingEnabled() && !tex->isDataReady())
+  {
+    this->dataPtr->TrackTextureLoad(tex, _type);
+    return;
   }
 
+  this->UpdateTextureMap(tex, _type);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Material::UpdateTextureMap(Ogre::TextureGpu *_texture,
+  Ogre::PbsTextureTypes _type)
+{
+  this->DetachDatablock();
+
+  _texture->waitForMetadata();
+  this->dataPtr->hashName = _texture->getName().getFriendlyText();
+
   // disable alpha from texture if texture does not have an alpha channel
   // otherwise this becomes a transparent material
   if (_type == Ogre::PBSM_DIFFUSE)
   {
     bool isGrayscale = (Ogre::PixelFormatGpuUtils::getNumberOfComponents(
-            tex->getPixelFormat()) == 1u);
+            _texture->getPixelFormat()) == 1u);
 
     if (this->TextureAlphaEnabled() || isGrayscale)
     {
-      if (tex)
-      {
-        tex->scheduleTransitionTo(Ogre::GpuResidency::Resident);
-        tex->waitForData();
+      _texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+      _texture->waitForData();
 
-        // only enable alpha from texture if texture has alpha component
-        if (this->TextureAlphaEnabled() &&
-            !Ogre::PixelFormatGpuUtils::hasAlpha(tex->getPixelFormat()))
-        {
-          this->SetAlphaFromTexture(false, this->AlphaThreshold(),
-              this->TwoSidedEnabled());
-        }
+      // only enable alpha from texture if texture has alpha component
+      if (this->TextureAlphaEnabled() &&
+          !Ogre::PixelFormatGpuUtils::hasAlpha(_texture->getPixelFormat()))
+      {
+        this->SetAlphaFromTexture(false, this->AlphaThreshold(),
+            this->TwoSidedEnabled());
+      }
 
-        // treat grayscale texture as RGB
-        if (isGrayscale)
-        {
-          this->ogreDatablock->setUseDiffuseMapAsGrayscale(true);
-        }
+      // treat grayscale texture as RGB
+      if (isGrayscale)
+      {
+        this->ogreDatablock->setUseDiffuseMapAsGrayscale(true);
       }
     }
   }
@@ -1215,6 +1812,9 @@ void Ogre2Material::SetTextureMapDataImpl(const std::string& _name,
   const std::shared_ptr<const common::Image> &_img,
   Ogre::PbsTextureTypes _type)
 {
+  this->DetachDatablock();
+  this->dataPtr->CancelTextureLoad(_type);
+
   Ogre::Root *root = Ogre2RenderEngine::Instance()->OgreRoot();
   Ogre::TextureGpuManager *textureMgr =
       root->getRenderSystem()->getTextureGpuManager();
@@ -1303,6 +1903,13 @@ void Ogre2Material::Init()
   // use metal workflow as default
   this->ogreDatablock->setWorkflow(Ogre::HlmsPbsDatablock::MetallicWorkflow);
 
+  this->dataPtr->scene = this->scene.get();
+  this->dataPtr->textureReady =
+      [this](Ogre::TextureGpu *_texture, Ogre::PbsTextureTypes _type)
+      {
+        this->UpdateTextureMap(_texture, _type);
+      };
+
   this->Reset();
 }
 
@@ -1322,6 +1929,8 @@ bool Ogre2Material::DepthCheckEnabled() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetDepthCheckEnabled(bool _enabled)
 {
+  this->DetachDatablock();
+
   Ogre::HlmsMacroblock macroblock(
       *this->ogreDatablock->getMacroblock());
   macroblock.mDepthCheck = _enabled;
@@ -1338,6 +1947,8 @@ bool Ogre2Material::DepthWriteEnabled() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetDepthWriteEnabled(bool _enabled)
 {
+  this->DetachDatablock();
+
   Ogre::HlmsMacroblock macroblock(
       *this->ogreDatablock->getMacroblock());
   macroblock.mDepthWrite = _enabled;
@@ -1464,6 +2075,11 @@ void Ogre2Material::SetVertexShader(const std::string &_path)
     pass->setVertexProgram(vertexShader->getName());
     mat[i]->compile();
     mat[i]->load();
+    if (pass->hasVertexProgram())
+    {
+      this->dataPtr->scene->BindSharedShaderParams(
+          pass->getVertexProgramParameters().get());
+    }
   }
 
   if(this->dataPtr->ogreSolidColorMat->getNumSupportedTechniques() == 0u)
@@ -1482,6 +2098,7 @@ void Ogre2Material::SetVertexShader(const std::string &_path)
 
   this->dataPtr->vertexShaderPath = _path;
   this->dataPtr->vertexShaderParams.reset(new ShaderParams);
+  this->dataPtr->shaderParamConstants.clear();
 }
 
 //////////////////////////////////////////////////
@@ -1548,8 +2165,14 @@ void Ogre2Material::SetFragmentShader(const std::string &_path)
   pass->setFragmentProgram(fragmentShader->getName());
   mat->compile();
   mat->load();
+  if (pass->hasFragmentProgram())
+  {
+    this->dataPtr->scene->BindSharedShaderParams(
+        pass->getFragmentProgramParameters().get());
+  }
   this->dataPtr->fragmentShaderPath = _path;
   this->dataPtr->fragmentShaderParams.reset(new ShaderParams);
+  this->dataPtr->shaderParamConstants.clear();
 }
 
 //////////////////////////////////////////////////
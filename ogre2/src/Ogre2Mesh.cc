@@ -15,6 +15,11 @@
  *
  */
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
 // Note this include is placed in the src file because
 // otherwise ogre produces compile errors
 #if defined(_MSC_VER)
@@ -22,6 +27,7 @@
 #pragma warning(disable: 4005)  // Macro redefinition
 #pragma warning(disable: 5033)  // 'register' is no longer supported
 #endif
+#include <Animation/OgreSkeletonAnimationDef.h>
 #include <Animation/OgreSkeletonInstance.h>
 #include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
 #include <OgreItem.h>
@@ -29,6 +35,11 @@
 #include <OgreMeshManager.h>
 #include <OgreMeshManager2.h>
 #include <OgreMaterialManager.h>
+#include <OgreMesh2.h>
+#include <OgreSubMesh2.h>
+#include <Vao/OgreIndexBufferPacked.h>
+#include <Vao/OgreVertexArrayObject.h>
+#include <Vao/OgreVertexBufferPacked.h>
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -38,11 +49,39 @@
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2Mesh.hh"
 #include "gz/rendering/ogre2/Ogre2Material.hh"
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Storage.hh"
 
+#include "Ogre2BakedSkeletonAnimation.hh"
+
 /// brief Private implementation of the Ogre2Mesh class
 class gz::rendering::Ogre2MeshPrivate
 {
+  /// \brief Hashed names of the skeleton bones in bone index order, used
+  /// to set bone weights by index. Filled on first use.
+  public: std::vector<Ogre::IdString> boneNames;
+
+  /// \brief True if the skeleton animation is played instanced
+  public: bool instanced = false;
+
+  /// \brief Rate the instanced animation is baked at
+  public: double bakeRate = 30.0;
+
+  /// \brief Name of the animation played instanced, empty if none
+  public: std::string instancedAnimation;
+
+  /// \brief True to loop the instanced animation
+  public: bool instancedLoop = true;
+
+  /// \brief Baked poses of the instanced animation, shared with the other
+  /// meshes of the scene. Acquired on the first update.
+  public: std::shared_ptr<Ogre2BakedSkeletonAnimation> bakedAnimation;
+
+  /// \brief Bounds of each submesh of a dynamic mesh, so an update only
+  /// recomputes the bounds of the submesh it changes. Filled on the first
+  /// update.
+  public: std::vector<Ogre::Aabb> subMeshBounds;
 };
 
 /// brief Private implementation of the Ogre2SubMesh class
@@ -143,6 +182,7 @@ void Ogre2Mesh::SetSkeletonLocalTransforms(
       bone->setOrientation(Ogre2Conversions::Convert(tf.Rotation()));
     }
   }
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -194,6 +234,113 @@ void Ogre2Mesh::SetSkeletonWeights(
       }
     }
   }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> Ogre2Mesh::SkeletonBoneNames() const
+{
+  std::vector<std::string> names;
+  if (!this->ogreItem->hasSkeleton())
+    return names;
+
+  auto skel = this->ogreItem->getSkeletonInstance();
+  names.reserve(skel->getNumBones());
+  for (unsigned int i = 0; i < skel->getNumBones(); ++i)
+    names.push_back(skel->getBone(i)->getName());
+  return names;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::SkeletonBoneTransforms(std::vector<math::Matrix4d> &_tfs) const
+{
+  _tfs.clear();
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
+  auto skel = this->ogreItem->getSkeletonInstance();
+  _tfs.resize(skel->getNumBones());
+  for (unsigned int i = 0; i < skel->getNumBones(); ++i)
+  {
+    auto bone = skel->getBone(i);
+    _tfs[i] = math::Matrix4d(
+        Ogre2Conversions::Convert(bone->getOrientation()));
+    _tfs[i].SetTranslation(Ogre2Conversions::Convert(bone->getPosition()));
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::SetSkeletonBoneTransforms(const math::Matrix4d *_tfs,
+    unsigned int _count)
+{
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
+  auto skel = this->ogreItem->getSkeletonInstance();
+  const unsigned int count =
+      std::min(_count, static_cast<unsigned int>(skel->getNumBones()));
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    auto bone = skel->getBone(i);
+    skel->setManualBone(bone, true);
+    bone->setPosition(Ogre2Conversions::Convert(_tfs[i].Translation()));
+    bone->setOrientation(Ogre2Conversions::Convert(_tfs[i].Rotation()));
+  }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::SetSkeletonBoneTransforms3x4(const float *_tfs,
+    unsigned int _count)
+{
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
+  auto skel = this->ogreItem->getSkeletonInstance();
+  const unsigned int count =
+      std::min(_count, static_cast<unsigned int>(skel->getNumBones()));
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    const float *m = &_tfs[i * 12u];
+    auto bone = skel->getBone(i);
+    skel->setManualBone(bone, true);
+    bone->setPosition(Ogre::Vector3(m[3], m[7], m[11]));
+    bone->setOrientation(Ogre::Quaternion(Ogre::Matrix3(
+        m[0], m[1], m[2],
+        m[4], m[5], m[6],
+        m[8], m[9], m[10])));
+  }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::SetSkeletonBoneWeights(const float *_weights,
+    unsigned int _count)
+{
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
+  auto skel = this->ogreItem->getSkeletonInstance();
+  auto &boneNames = this->dataPtr->boneNames;
+  if (boneNames.size() != skel->getNumBones())
+  {
+    boneNames.clear();
+    for (unsigned int i = 0; i < skel->getNumBones(); ++i)
+      boneNames.emplace_back(skel->getBone(i)->getName());
+  }
+
+  const unsigned int count =
+      std::min(_count, static_cast<unsigned int>(boneNames.size()));
+  auto &animations = skel->getAnimations();
+  for (auto &anim : animations)
+  {
+    Ogre::SkeletonAnimation *animPtr = skel->getAnimation(anim.getName());
+    if (!animPtr)
+      continue;
+    for (unsigned int i = 0; i < count; ++i)
+      animPtr->setBoneWeight(boneNames[i], _weights[i]);
+  }
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -213,6 +360,23 @@ void Ogre2Mesh::SetSkeletonAnimationEnabled(const std::string &_name,
     return;
   }
 
+  // instanced animations are not evaluated by the skeleton instance
+  if (this->dataPtr->instanced)
+  {
+    if (_enabled)
+    {
+      this->dataPtr->instancedAnimation = _name;
+      this->dataPtr->instancedLoop = _loop;
+      this->dataPtr->bakedAnimation.reset();
+    }
+    else if (this->dataPtr->instancedAnimation == _name)
+    {
+      this->dataPtr->instancedAnimation.clear();
+      this->dataPtr->bakedAnimation.reset();
+    }
+    return;
+  }
+
   if (_enabled)
   {
     for (unsigned int i = 0; i < skel->getNumBones(); ++i)
@@ -226,6 +390,7 @@ void Ogre2Mesh::SetSkeletonAnimationEnabled(const std::string &_name,
   anim->setEnabled(_enabled);
   anim->setLoop(_loop);
   anim->mWeight = _weight;
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -238,6 +403,24 @@ void Ogre2Mesh::UpdateSkeletonAnimation(
   }
 
   Ogre::SkeletonInstance *skel = this->ogreItem->getSkeletonInstance();
+  if (this->dataPtr->instanced)
+  {
+    if (this->dataPtr->instancedAnimation.empty())
+      return;
+
+    if (!this->dataPtr->bakedAnimation)
+    {
+      this->dataPtr->bakedAnimation =
+          this->scene->AcquireBakedSkeletonAnimation(skel,
+          this->dataPtr->instancedAnimation, this->dataPtr->bakeRate);
+    }
+    this->dataPtr->bakedAnimation->Apply(skel,
+        std::chrono::duration<double>(_time).count(),
+        this->dataPtr->instancedLoop);
+    this->scene->SetSceneGraphDirty();
+    return;
+  }
+
   auto animations = skel->getAnimations();
   for (auto &anim : animations)
   {
@@ -250,6 +433,7 @@ void Ogre2Mesh::UpdateSkeletonAnimation(
       sa->setTime(seconds);
     }
   }
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -267,10 +451,195 @@ bool Ogre2Mesh::SkeletonAnimationEnabled(const std::string &_name) const
     return false;
   }
 
+  if (this->dataPtr->instanced)
+    return this->dataPtr->instancedAnimation == _name;
+
   Ogre::SkeletonAnimation *anim = skel->getAnimation(_name);
   return anim->getEnabled();
 }
 
+//////////////////////////////////////////////////
+void Ogre2Mesh::SetSkeletonAnimationInstanced(bool _instanced,
+    double _bakeRate)
+{
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
+  if (!(_bakeRate > 0.0))
+  {
+    gzerr << "Invalid skeleton animation bake rate: " << _bakeRate
+          << std::endl;
+    return;
+  }
+
+  Ogre::SkeletonInstance *skel = this->ogreItem->getSkeletonInstance();
+  if (_instanced)
+  {
+    if (!this->dataPtr->instanced)
+    {
+      // the first enabled animation keeps playing, instanced
+      auto &animations = skel->getAnimations();
+      for (auto &anim : animations)
+      {
+        Ogre::SkeletonAnimation *sa = skel->getAnimation(anim.getName());
+        if (!sa->getEnabled())
+          continue;
+        if (this->dataPtr->instancedAnimation.empty())
+        {
+          this->dataPtr->instancedAnimation =
+              sa->getDefinition()->getNameStr();
+          this->dataPtr->instancedLoop = sa->getLoop();
+        }
+        sa->setEnabled(false);
+      }
+      this->dataPtr->instanced = true;
+    }
+    if (this->dataPtr->bakeRate != _bakeRate)
+      this->dataPtr->bakedAnimation.reset();
+    this->dataPtr->bakeRate = _bakeRate;
+    return;
+  }
+
+  if (!this->dataPtr->instanced)
+    return;
+
+  this->dataPtr->instanced = false;
+  this->dataPtr->bakedAnimation.reset();
+  std::string name = this->dataPtr->instancedAnimation;
+  this->dataPtr->instancedAnimation.clear();
+  if (!name.empty())
+    this->SetSkeletonAnimationEnabled(name, true, this->dataPtr->instancedLoop);
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Mesh::SkeletonAnimationInstanced() const
+{
+  return this->dataPtr->instanced;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Mesh::UpdateVertices(unsigned int _subMeshIndex,
+    const float *_positions, const float *_normals,
+    unsigned int _vertexCount)
+{
+  if (!this->ogreItem || !_positions)
+    return false;
+
+  Ogre::Mesh *mesh = this->ogreItem->getMesh().get();
+  if (_subMeshIndex >= mesh->getNumSubMeshes())
+  {
+    gzerr << "Invalid submesh index [" << _subMeshIndex << "] of mesh ["
+          << this->Name() << "]" << std::endl;
+    return false;
+  }
+
+  // only dynamic meshes have default buffers with a CPU copy
+  Ogre::SubMesh *subMesh = mesh->getSubMesh(_subMeshIndex);
+  Ogre::VertexArrayObject *vao = subMesh->mVao[Ogre::VpNormal].empty() ?
+      nullptr : subMesh->mVao[Ogre::VpNormal][0];
+  Ogre::VertexBufferPacked *vertexBuffer =
+      (vao && !vao->getVertexBuffers().empty()) ?
+      vao->getVertexBuffers()[0] : nullptr;
+  if (!vertexBuffer || vertexBuffer->getBufferType() != Ogre::BT_DEFAULT ||
+      !vertexBuffer->getShadowCopy())
+  {
+    gzerr << "Mesh [" << this->Name() << "] is not dynamic, see "
+          << "MeshDescriptor::dynamic" << std::endl;
+    return false;
+  }
+  if (_vertexCount != vertexBuffer->getNumElements())
+  {
+    gzerr << "Vertex count [" << _vertexCount << "] does not match the "
+          << "submesh [" << vertexBuffer->getNumElements() << "]"
+          << std::endl;
+    return false;
+  }
+
+  // positions and normals come first, see Ogre2MeshFactory
+  const size_t stride = vertexBuffer->getBytesPerElement() / sizeof(float);
+  const float *shadow =
+      static_cast<const float *>(vertexBuffer->getShadowCopy());
+  std::vector<float> vertices(shadow, shadow + stride * _vertexCount);
+
+  Ogre::Aabb bounds = Ogre::Aabb::BOX_NULL;
+  for (unsigned int i = 0u; i < _vertexCount; ++i)
+  {
+    float *v = vertices.data() + i * stride;
+    v[0] = _positions[i * 3u];
+    v[1] = _positions[i * 3u + 1u];
+    v[2] = _positions[i * 3u + 2u];
+    bounds.merge(Ogre::Vector3(v[0], v[1], v[2]));
+    if (_normals)
+    {
+      v[3] = _normals[i * 3u];
+      v[4] = _normals[i * 3u + 1u];
+      v[5] = _normals[i * 3u + 2u];
+    }
+  }
+
+  // recompute area weighted normals of triangle lists
+  Ogre::IndexBufferPacked *indexBuffer = vao->getIndexBuffer();
+  if (!_normals && vao->getOperationType() == Ogre::OT_TRIANGLE_LIST &&
+      indexBuffer && indexBuffer->getShadowCopy() &&
+      indexBuffer->getIndexType() == Ogre::IndexBufferPacked::IT_32BIT)
+  {
+    for (unsigned int i = 0u; i < _vertexCount; ++i)
+      std::fill_n(vertices.data() + i * stride + 3u, 3u, 0.0f);
+
+    const uint32_t *indices =
+        static_cast<const uint32_t *>(indexBuffer->getShadowCopy());
+    const size_t indexCount = indexBuffer->getNumElements();
+    for (size_t i = 0u; i + 2u < indexCount; i += 3u)
+    {
+      if (indices[i] >= _vertexCount || indices[i + 1u] >= _vertexCount ||
+          indices[i + 2u] >= _vertexCount)
+      {
+        continue;
+      }
+      float *a = vertices.data() + indices[i] * stride;
+      float *b = vertices.data() + indices[i + 1u] * stride;
+      float *c = vertices.data() + indices[i + 2u] * stride;
+      const Ogre::Vector3 pa(a[0], a[1], a[2]);
+      const Ogre::Vector3 n = (Ogre::Vector3(b[0], b[1], b[2]) - pa).
+          crossProduct(Ogre::Vector3(c[0], c[1], c[2]) - pa);
+      for (float *p : {a, b, c})
+      {
+        p[3] += n.x;
+        p[4] += n.y;
+        p[5] += n.z;
+      }
+    }
+
+    for (unsigned int i = 0u; i < _vertexCount; ++i)
+    {
+      float *v = vertices.data() + i * stride;
+      Ogre::Vector3 n(v[3], v[4], v[5]);
+      n.normalise();
+      v[3] = n.x;
+      v[4] = n.y;
+      v[5] = n.z;
+    }
+  }
+
+  vertexBuffer->upload(vertices.data(), 0u, _vertexCount);
+
+  // the bounds of the other submeshes are unknown until they are updated,
+  // so start from the bounds of the whole mesh
+  std::vector<Ogre::Aabb> &subMeshBounds = this->dataPtr->subMeshBounds;
+  if (subMeshBounds.size() != mesh->getNumSubMeshes())
+    subMeshBounds.assign(mesh->getNumSubMeshes(), mesh->getAabb());
+  subMeshBounds[_subMeshIndex] = bounds;
+  Ogre::Aabb meshBounds = Ogre::Aabb::BOX_NULL;
+  for (const Ogre::Aabb &box : subMeshBounds)
+    meshBounds.merge(box);
+  mesh->_setBounds(meshBounds, false);
+  mesh->_setBoundingSphereRadius(meshBounds.getRadius());
+  this->ogreItem->setLocalAabb(meshBounds);
+
+  this->scene->SetSceneGraphDirty();
+  return true;
+}
+
 //////////////////////////////////////////////////
 Ogre::MovableObject *Ogre2Mesh::OgreObject() const
 {
@@ -305,7 +674,7 @@ void Ogre2SubMesh::SetMeshName(const std::string &_name)
 void Ogre2SubMesh::Destroy()
 {
   auto meshManager = Ogre::MeshManager::getSingletonPtr();
-  if (meshManager)
+  if (meshManager && !Ogre2RenderEngine::Instance()->RetainMeshes())
   {
     auto iend = meshManager->getResourceIterator().end();
     for (auto i = meshManager->getResourceIterator().begin(); i != iend;)
@@ -357,8 +726,8 @@ void Ogre2SubMesh::SetMaterialImpl(MaterialPtr _material)
   // Pbs Hlms material
   else
   {
-    auto datablock =
-        static_cast<Ogre::HlmsPbsDatablock *>(derived->Datablock());
+    auto datablock = derived->SubMeshDatablock(
+        std::dynamic_pointer_cast<Ogre2SubMesh>(this->shared_from_this()));
     if (datablock)
     {
       this->ogreSubItem->setDatablock(datablock);
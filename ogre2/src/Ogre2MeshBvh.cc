@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "Ogre2MeshBvh.hh"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+
+#include "gz/rendering/ogre2/Ogre2Conversions.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMath.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Maximum number of triangles in a leaf
+static const uint32_t kMaxLeafTriangles = 4u;
+
+/// \brief Maximum depth of the hierarchy. Must be lower than the size of
+/// the traversal stack in Ogre2MeshBvh::Intersect.
+static const unsigned int kMaxDepth = 48u;
+
+/// \brief Cache entry of a submesh hierarchy
+struct BvhCacheEntry
+{
+  /// \brief Submesh the hierarchy was built for
+  std::weak_ptr<common::SubMesh> subMesh;
+
+  /// \brief Vertex data the hierarchy was built from
+  const math::Vector3d *vertices = nullptr;
+
+  /// \brief Index data the hierarchy was built from
+  const unsigned int *indices = nullptr;
+
+  /// \brief Number of vertices the hierarchy was built from
+  unsigned int vertexCount = 0u;
+
+  /// \brief Number of indices the hierarchy was built from
+  unsigned int indexCount = 0u;
+
+  /// \brief The hierarchy
+  std::shared_ptr<const Ogre2MeshBvh> bvh;
+};
+
+//////////////////////////////////////////////////
+Ogre2MeshBvh::Ogre2MeshBvh(const common::SubMesh &_subMesh)
+{
+  const unsigned int vertexCount = _subMesh.VertexCount();
+  const unsigned int indexCount = _subMesh.IndexCount();
+  const math::Vector3d *vertices = _subMesh.VertexPtr();
+  const unsigned int *indices = _subMesh.IndexPtr();
+
+  // gather the corners of all valid triangles, in triangle id order
+  std::vector<Ogre::Vector3> centroids;
+  centroids.reserve(indexCount / 3u);
+  this->corners.reserve(indexCount / 3u * 3u);
+  for (unsigned int k = 0u; k + 2u < indexCount; k += 3u)
+  {
+    if (indices[k] >= vertexCount || indices[k + 1u] >= vertexCount ||
+        indices[k + 2u] >= vertexCount)
+    {
+      continue;
+    }
+    const Ogre::Vector3 a = Ogre2Conversions::Convert(vertices[indices[k]]);
+    const Ogre::Vector3 b =
+        Ogre2Conversions::Convert(vertices[indices[k + 1u]]);
+    const Ogre::Vector3 c =
+        Ogre2Conversions::Convert(vertices[indices[k + 2u]]);
+    this->corners.push_back(a);
+    this->corners.push_back(b);
+    this->corners.push_back(c);
+    centroids.push_back((a + b + c) / 3.0f);
+  }
+
+  const uint32_t triangleCount = static_cast<uint32_t>(centroids.size());
+  if (triangleCount == 0u)
+    return;
+
+  this->triangles.resize(triangleCount);
+  for (uint32_t i = 0u; i < triangleCount; ++i)
+    this->triangles[i] = i;
+
+  this->nodes.reserve(2u * triangleCount / kMaxLeafTriangles + 1u);
+  this->Build(0u, triangleCount, centroids, 0u);
+
+  // store the corners in leaf order so leaves read contiguous memory
+  std::vector<Ogre::Vector3> sorted(this->corners.size());
+  for (uint32_t i = 0u; i < triangleCount; ++i)
+  {
+    const uint32_t id = this->triangles[i];
+    sorted[i * 3u] = this->corners[id * 3u];
+    sorted[i * 3u + 1u] = this->corners[id * 3u + 1u];
+    sorted[i * 3u + 2u] = this->corners[id * 3u + 2u];
+  }
+  this->corners.swap(sorted);
+}
+
+//////////////////////////////////////////////////
+uint32_t Ogre2MeshBvh::Build(uint32_t _start, uint32_t _end,
+    const std::vector<Ogre::Vector3> &_centroids, unsigned int _depth)
+{
+  const uint32_t nodeIndex = static_cast<uint32_t>(this->nodes.size());
+  this->nodes.emplace_back();
+
+  // bounds of the triangles and of their centroids. The corners are still
+  // in triangle id order while building.
+  Ogre::Vector3 min(std::numeric_limits<Ogre::Real>::max());
+  Ogre::Vector3 max(-std::numeric_limits<Ogre::Real>::max());
+  Ogre::Vector3 centroidMin = min;
+  Ogre::Vector3 centroidMax = max;
+  for (uint32_t i = _start; i < _end; ++i)
+  {
+    const uint32_t id = this->triangles[i];
+    for (uint32_t c = 0u; c < 3u; ++c)
+    {
+      min.makeFloor(this->corners[id * 3u + c]);
+      max.makeCeil(this->corners[id * 3u + c]);
+    }
+    centroidMin.makeFloor(_centroids[id]);
+    centroidMax.makeCeil(_centroids[id]);
+  }
+  this->nodes[nodeIndex].min = min;
+  this->nodes[nodeIndex].max = max;
+
+  // split along the longest axis of the centroid bounds
+  const Ogre::Vector3 extent = centroidMax - centroidMin;
+  int axis = 0;
+  if (extent.y > extent[axis])
+    axis = 1;
+  if (extent.z > extent[axis])
+    axis = 2;
+
+  if (_end - _start <= kMaxLeafTriangles || _depth >= kMaxDepth ||
+      extent[axis] <= 0.0f)
+  {
+    this->nodes[nodeIndex].start = _start;
+    this->nodes[nodeIndex].count = _end - _start;
+    return nodeIndex;
+  }
+
+  const uint32_t mid = _start + (_end - _start) / 2u;
+  std::nth_element(this->triangles.begin() + _start,
+      this->triangles.begin() + mid, this->triangles.begin() + _end,
+      [&](uint32_t _a, uint32_t _b)
+      {
+        return _centroids[_a][axis] < _centroids[_b][axis];
+      });
+
+  this->Build(_start, mid, _centroids, _depth + 1u);
+  const uint32_t right = this->Build(mid, _end, _centroids, _depth + 1u);
+  this->nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+//////////////////////////////////////////////////
+std::pair<bool, Ogre::Real> Ogre2MeshBvh::Intersect(
+    const Ogre::Ray &_ray) const
+{
+  std::pair<bool, Ogre::Real> bestHit = {
+    false, std::numeric_limits<Ogre::Real>::max()
+  };
+  if (this->nodes.empty())
+    return bestHit;
+
+  const Ogre::Vector3 &origin = _ray.getOrigin();
+  const Ogre::Vector3 &dir = _ray.getDirection();
+  const Ogre::Vector3 invDir(1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z);
+
+  uint32_t stack[kMaxDepth + 2u];
+  unsigned int stackSize = 0u;
+  stack[stackSize++] = 0u;
+  while (stackSize > 0u)
+  {
+    const uint32_t nodeIndex = stack[--stackSize];
+    const Node &node = this->nodes[nodeIndex];
+
+    // slab test against the node bounds, skipping nodes farther away than
+    // the closest hit so far
+    Ogre::Real tMin = 0.0f;
+    Ogre::Real tMax = bestHit.second;
+    bool overlap = true;
+    for (int i = 0; i < 3 && overlap; ++i)
+    {
+      Ogre::Real t0 = (node.min[i] - origin[i]) * invDir[i];
+      Ogre::Real t1 = (node.max[i] - origin[i]) * invDir[i];
+      if (t0 > t1)
+        std::swap(t0, t1);
+      // NaN (ray on a slab plane) leaves tMin and tMax unchanged
+      if (t0 > tMin)
+        tMin = t0;
+      if (t1 < tMax)
+        tMax = t1;
+      overlap = tMin <= tMax;
+    }
+    if (!overlap)
+      continue;
+
+    if (node.count > 0u)
+    {
+      for (uint32_t t = node.start; t < node.start + node.count; ++t)
+      {
+        std::pair<bool, Ogre::Real> hit = Ogre::Math::intersects(_ray,
+            this->corners[t * 3u], this->corners[t * 3u + 1u],
+            this->corners[t * 3u + 2u], true, false);
+        if (hit.first && hit.second < bestHit.second)
+          bestHit = hit;
+      }
+    }
+    else
+    {
+      stack[stackSize++] = node.right;
+      stack[stackSize++] = nodeIndex + 1u;
+    }
+  }
+  return bestHit;
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<const Ogre2MeshBvh> Ogre2MeshBvh::Acquire(
+    const std::shared_ptr<common::SubMesh> &_subMesh)
+{
+  static std::mutex mutex;
+  static std::map<const common::SubMesh *, BvhCacheEntry> cache;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = cache.find(_subMesh.get());
+  if (it != cache.end() &&
+      it->second.subMesh.lock() == _subMesh &&
+      it->second.vertices == _subMesh->VertexPtr() &&
+      it->second.indices == _subMesh->IndexPtr() &&
+      it->second.vertexCount == _subMesh->VertexCount() &&
+      it->second.indexCount == _subMesh->IndexCount())
+  {
+    return it->second.bvh;
+  }
+
+  // drop hierarchies of submeshes that no longer exist
+  for (auto entry = cache.begin(); entry != cache.end();)
+  {
+    if (entry->second.subMesh.expired())
+      entry = cache.erase(entry);
+    else
+      ++entry;
+  }
+
+  BvhCacheEntry entry;
+  entry.subMesh = _subMesh;
+  entry.vertices = _subMesh->VertexPtr();
+  entry.indices = _subMesh->IndexPtr();
+  entry.vertexCount = _subMesh->VertexCount();
+  entry.indexCount = _subMesh->IndexCount();
+  entry.bvh = std::make_shared<Ogre2MeshBvh>(*_subMesh);
+  cache[_subMesh.get()] = entry;
+  return entry.bvh;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2MESHBVH_HH_
+#define GZ_RENDERING_OGRE2_OGRE2MESHBVH_HH_
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gz/common/SubMesh.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreRay.h>
+#include <OgreVector3.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Bounding volume hierarchy over the triangles of a submesh, in
+/// mesh-local space. Used by CPU ray queries to avoid testing every
+/// triangle of a mesh. BVHs are cached per submesh and shared by all
+/// visuals that use the same mesh.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2MeshBvh
+{
+  /// \brief Constructor. Builds the hierarchy.
+  /// \param[in] _subMesh Submesh to build the hierarchy for
+  public: explicit Ogre2MeshBvh(const common::SubMesh &_subMesh);
+
+  /// \brief Get the cached hierarchy of a submesh, building it if it does
+  /// not exist yet or if the submesh vertex or index data changed since it
+  /// was built. Thread safe.
+  /// \param[in] _subMesh Submesh to get the hierarchy of
+  /// \return Hierarchy of the submesh
+  public: static std::shared_ptr<const Ogre2MeshBvh> Acquire(
+              const std::shared_ptr<common::SubMesh> &_subMesh);
+
+  /// \brief Find the closest front facing triangle hit by a ray
+  /// \param[in] _ray Ray in mesh-local space
+  /// \return Whether a triangle was hit and the distance along the ray,
+  /// like Ogre::Math::intersects
+  public: std::pair<bool, Ogre::Real> Intersect(const Ogre::Ray &_ray) const;
+
+  /// \brief Recursively build the hierarchy of a range of triangles
+  /// \param[in] _start First triangle in the range
+  /// \param[in] _end One past the last triangle in the range
+  /// \param[in] _centroids Centroid of every triangle
+  /// \param[in] _depth Depth of the node to build
+  /// \return Index of the node built for the range
+  private: uint32_t Build(uint32_t _start, uint32_t _end,
+               const std::vector<Ogre::Vector3> &_centroids,
+               unsigned int _depth);
+
+  /// \brief A node of the hierarchy
+  private: struct Node
+  {
+    /// \brief Minimum corner of the node bounds
+    Ogre::Vector3 min;
+
+    /// \brief Maximum corner of the node bounds
+    Ogre::Vector3 max;
+
+    /// \brief First triangle of a leaf
+    uint32_t start = 0u;
+
+    /// \brief Number of triangles of a leaf, 0 for inner nodes
+    uint32_t count = 0u;
+
+    /// \brief Index of the second child of an inner node. The first child
+    /// directly follows its parent.
+    uint32_t right = 0u;
+  };
+
+  /// \brief Nodes of the hierarchy, the root is the first node
+  private: std::vector<Node> nodes;
+
+  /// \brief Triangle ids, reordered so that every leaf references a
+  /// contiguous range
+  private: std::vector<uint32_t> triangles;
+
+  /// \brief Triangle corners, 3 per triangle in the order of the leaves
+  private: std::vector<Ogre::Vector3> corners;
+};
+}
+}
+}
+#endif
@@ -16,13 +16,27 @@
  */
 
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/Material.hh>
 #include <gz/common/Skeleton.hh>
 #include <gz/common/SkeletonAnimation.hh>
 #include <gz/common/SubMesh.hh>
+#include <gz/common/Util.hh>
+#include <gz/common/Uuid.hh>
 
 #include <gz/math/Matrix4.hh>
 
@@ -34,32 +48,166 @@
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Storage.hh"
 
+#include "Ogre2MeshOptimizer.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
 #include <OgreHardwareBufferManager.h>
+#include <OgreBitwise.h>
+#include <OgreDataStream.h>
 #include <OgreItem.h>
 #include <OgreKeyFrame.h>
+#include <OgreLodStrategyManager.h>
+#include <OgreMatrix3.h>
 #include <OgreMesh2.h>
+#include <OgreMesh2Serializer.h>
 #include <OgreMeshManager.h>
 #include <OgreMeshManager2.h>
 #include <OgreOldBone.h>
 #include <OgreOldSkeletonManager.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreSkeleton.h>
 #include <OgreSubItem.h>
 #include <OgreSubMesh.h>
 #include <OgreSubMesh2.h>
+#include <Vao/OgreVaoManager.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
 
+/// \brief Vertex and index data of a submesh, prepared on the CPU before
+/// the ogre buffers are created
+struct Ogre2PreparedSubMesh
+{
+  /// \brief Copy of the submesh, recentered if the descriptor asks for it
+  common::SubMesh subMesh;
+
+  /// \brief Interleaved positions, normals and texture coordinates, in the
+  /// layout of the v1 vertex declaration. Empty for meshes built directly
+  /// as v2 meshes, see Ogre2MeshFactoryPrivate::DirectV2Mesh.
+  std::vector<float> vertices;
+
+  /// \brief Layout of the v2 vertex buffer of meshes built directly as v2
+  /// meshes
+  Ogre::VertexElement2Vec vertexElements;
+
+  /// \brief Vertices of meshes built directly as v2 meshes, in the layout
+  /// of vertexElements
+  std::vector<uint8_t> packedVertices;
+
+  /// \brief Indices of the full detail level
+  std::vector<uint32_t> indices;
+
+  /// \brief Indices of the coarser levels of detail. Empty for levels that
+  /// keep the previous level.
+  std::vector<std::vector<uint32_t>> lodIndices;
+};
+
 /// \brief Private data for the Ogre2MeshFactory class
 class gz::rendering::Ogre2MeshFactoryPrivate
 {
+  /// \brief Prepare the vertex and index data of the submeshes of a
+  /// mesh. Only reads the common::Mesh, so it can run on several meshes
+  /// concurrently.
+  /// \param[in] _desc Mesh descriptor
+  /// \return Prepared submeshes
+  public: static std::vector<Ogre2PreparedSubMesh> PrepareMesh(
+      const MeshDescriptor &_desc);
+
+  /// \brief Import a v1 mesh to a v2 mesh unless it is already imported.
+  /// The v1 mesh is released once imported.
+  /// \param[in] _name Name of the mesh
+  /// \param[in,out] _ogreMeshes Meshes created by the factory, the new
+  /// mesh is appended
+  /// \return The v2 mesh, null if there is no v1 mesh to import
+  public: static Ogre::MeshPtr ImportV1Mesh(const std::string &_name,
+      std::vector<std::string> &_ogreMeshes);
+
+  /// \brief Get whether a mesh is built directly as a v2 mesh. Meshes
+  /// with a skeleton or levels of detail go through a v1 mesh, which
+  /// Ogre::Mesh::importV1 converts.
+  /// \param[in] _desc Mesh descriptor
+  /// \return True if the mesh skips the v1 mesh
+  public: static bool DirectV2Mesh(const MeshDescriptor &_desc);
+
+  /// \brief Pack the vertices of a submesh in the layout of its v2 vertex
+  /// buffer. Static meshes get the layout of Ogre::Mesh::importV1, i.e.
+  /// QTangents and half float texture coordinates, and optionally half
+  /// float positions. Dynamic meshes get full precision positions,
+  /// normals and texture coordinates.
+  /// \param[in] _desc Mesh descriptor
+  /// \param[in,out] _data Submesh to pack the vertices of
+  public: static void PackV2Vertices(const MeshDescriptor &_desc,
+      Ogre2PreparedSubMesh &_data);
+
+  /// \brief Create a v2 mesh straight from the packed vertices, see
+  /// PackV2Vertices. Dynamic meshes, see MeshDescriptor::dynamic, keep a
+  /// CPU copy of their vertices and indices, which
+  /// Ogre2Mesh::UpdateVertices reads.
+  /// \param[in] _desc Mesh descriptor
+  /// \param[in] _name Name of the ogre mesh to create
+  /// \param[in] _prepared Submeshes to load, see PrepareMesh
+  /// \param[in] _scene Scene to create the submesh materials in
+  /// \return True if the mesh was created
+  public: bool LoadV2Mesh(const MeshDescriptor &_desc,
+      const std::string &_name,
+      const std::vector<Ogre2PreparedSubMesh> &_prepared,
+      Ogre2ScenePtr _scene);
+
+  /// \brief Create the material of a submesh
+  /// \param[in] _scene Scene to create the material in
+  /// \param[in] _mesh Mesh the submesh belongs to
+  /// \param[in] _subMesh Submesh to create the material for
+  /// \return Name of the new material
+  public: std::string CreateSubMeshMaterial(Ogre2ScenePtr _scene,
+      const common::Mesh *_mesh, const common::SubMesh &_subMesh);
+
+  /// \brief Get the path of the cached v2 mesh for a descriptor. The key
+  /// covers the mesh file, its size and modification time and the
+  /// descriptor options.
+  /// \param[in] _desc Mesh descriptor
+  /// \param[in] _cachePath Mesh cache directory
+  /// \return Path to the cached mesh, empty if the mesh can not be cached
+  public: static std::string CachedMeshPath(const MeshDescriptor &_desc,
+      const std::string &_cachePath);
+
+  /// \brief Load a v2 mesh from the mesh cache
+  /// \param[in] _desc Mesh descriptor
+  /// \param[in] _name Name of the ogre mesh to create
+  /// \param[in] _path Path to the cached mesh
+  /// \param[in] _scene Scene to create the submesh materials in
+  /// \return True if the mesh was loaded
+  public: bool LoadCachedMesh(const MeshDescriptor &_desc,
+      const std::string &_name, const std::string &_path,
+      Ogre2ScenePtr _scene);
+
+  /// \brief Save a v2 mesh to the mesh cache
+  /// \param[in] _mesh Mesh to save
+  /// \param[in] _path Path to the cached mesh
+  public: static void SaveCachedMesh(const Ogre::MeshPtr &_mesh,
+      const std::string &_path);
+
+  /// \brief Simplify a triangle list by clustering its vertices on a
+  /// regular grid and dropping the triangles that collapse. The remaining
+  /// triangles reference the original vertices, so all levels of detail
+  /// share the vertex buffer.
+  /// \param[in] _subMesh Submesh to simplify
+  /// \param[in] _ratio Approximate fraction of vertices to keep
+  /// \return Indices of the simplified triangle list, empty if the
+  /// submesh collapses entirely
+  public: static std::vector<uint32_t> SimplifyTriangles(
+      const common::SubMesh &_subMesh, double _ratio);
+
   /// \brief Vector with the template materials, we keep the pointer to be
   /// able to remove it when nobody is using it.
   public: std::vector<MaterialPtr> materialCache;
+
+  /// \brief Submeshes prepared by Preload, indexed by mesh name. Consumed
+  /// by LoadImpl.
+  public: std::unordered_map<std::string,
+      std::vector<Ogre2PreparedSubMesh>> preparedMeshes;
 };
 
 /// \brief Private data for the Ogre2SubMeshStoreFactory class
@@ -70,6 +218,689 @@ class gz::rendering::Ogre2SubMeshStoreFactoryPrivate
 using namespace gz;
 using namespace rendering;
 
+/// \brief Bump when the conversion from common::Mesh changes so stale
+/// cache entries are ignored
+static const char kMeshCacheVersion[] = "2";
+
+/// \brief Get the ogre operation type of a submesh primitive type
+/// \param[in] _type Primitive type of a submesh
+/// \return Operation type, triangle list for unknown types
+static Ogre::OperationType OperationType(
+    common::SubMesh::PrimitiveType _type)
+{
+  switch (_type)
+  {
+    case common::SubMesh::TRIANGLES:
+      return Ogre::OT_TRIANGLE_LIST;
+    case common::SubMesh::LINES:
+      return Ogre::OT_LINE_LIST;
+    case common::SubMesh::LINESTRIPS:
+      return Ogre::OT_LINE_STRIP;
+    case common::SubMesh::TRIFANS:
+      return Ogre::OT_TRIANGLE_FAN;
+    case common::SubMesh::TRISTRIPS:
+      return Ogre::OT_TRIANGLE_STRIP;
+    case common::SubMesh::POINTS:
+      return Ogre::OT_POINT_LIST;
+    default:
+      gzerr << "Unknown primitive type[" << _type << "]\n";
+      return Ogre::OT_TRIANGLE_LIST;
+  }
+}
+
+//////////////////////////////////////////////////
+/// \brief Encode a tangent frame as a QTangent, as Ogre::Mesh::importV1
+/// does. Hlms shaders decode the normal and tangent from the rotation and
+/// flip the binormal if w is negative.
+/// \param[in] _normal Vertex normal
+/// \param[in] _tangent Tangent along the u texture coordinate, need not be
+/// orthogonal to the normal
+/// \param[in] _binormal Tangent along the v texture coordinate
+/// \return QTangent, normalized
+static Ogre::Quaternion QTangent(const math::Vector3d &_normal,
+    const math::Vector3d &_tangent, const math::Vector3d &_binormal)
+{
+  math::Vector3d normal = _normal;
+  if (normal.Length() < 1e-9)
+    normal = math::Vector3d::UnitZ;
+  normal.Normalize();
+  math::Vector3d tangent = _tangent - normal * normal.Dot(_tangent);
+  if (tangent.Length() < 1e-9)
+    tangent = normal.Perpendicular();
+  tangent.Normalize();
+  const math::Vector3d binormal = normal.Cross(tangent);
+
+  Ogre::Matrix3 tbn;
+  tbn.FromAxes(Ogre2Conversions::Convert(normal),
+      Ogre2Conversions::Convert(tangent),
+      Ogre2Conversions::Convert(binormal));
+  Ogre::Quaternion q(tbn);
+  q.normalise();
+  if (q.w < 0.0f)
+    q = -q;
+
+  // the sign of a zero w is lost in 16 bit integers, so keep w above the
+  // smallest snorm value while keeping the quaternion normalized
+  const Ogre::Real bias = 1.0f / 32767.0f;
+  if (q.w < bias)
+  {
+    const Ogre::Real normFactor = std::sqrt(1.0f - bias * bias);
+    q.w = bias;
+    q.x *= normFactor;
+    q.y *= normFactor;
+    q.z *= normFactor;
+  }
+
+  if (binormal.Dot(_binormal) < 0.0)
+    q = -q;
+  return q;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2MeshFactoryPrivate::CreateSubMeshMaterial(
+    Ogre2ScenePtr _scene, const common::Mesh *_mesh,
+    const common::SubMesh &_subMesh)
+{
+  common::MaterialPtr material;
+  if (const auto subMeshIdx = _subMesh.GetMaterialIndex())
+  {
+    material = _mesh->MaterialByIndex(subMeshIdx.value());
+  }
+
+  MaterialPtr mat;
+  if (material)
+  {
+    mat = _scene->CreateMaterial();
+    mat->CopyFrom(*material);
+    this->materialCache.push_back(mat);
+  }
+  else
+  {
+    // clones share the datablock of the default material until modified
+    MaterialPtr defaultMat = _scene->Material("Default/White");
+    mat = (defaultMat != nullptr) ? defaultMat->Clone() :
+        _scene->CreateMaterial();
+  }
+  return mat->Name();
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2MeshFactoryPrivate::CachedMeshPath(
+    const MeshDescriptor &_desc, const std::string &_cachePath)
+{
+  // only meshes loaded from files without skeletons are cached. Skeletal
+  // meshes also need their v1 skeleton and animations.
+  if (_cachePath.empty() || _desc.mesh->HasSkeleton() ||
+      !common::isFile(_desc.meshName))
+  {
+    return std::string();
+  }
+
+  std::error_code ec;
+  auto size = std::filesystem::file_size(_desc.meshName, ec);
+  if (ec)
+    return std::string();
+  auto mtime = std::filesystem::last_write_time(_desc.meshName, ec);
+  if (ec)
+    return std::string();
+
+  std::stringstream key;
+  key << kMeshCacheVersion << "::" << OGRE_VERSION << "::"
+      << _desc.meshName << "::" << size << "::"
+      << mtime.time_since_epoch().count() << "::"
+      << _desc.subMeshName << "::" << _desc.centerSubMesh << "::"
+      << _desc.halfPositions << "::" << _desc.optimize;
+  if (!_desc.lodDistances.empty())
+  {
+    key << "::" << _desc.lodReduction;
+    for (double distance : _desc.lodDistances)
+      key << "::" << distance;
+  }
+  return common::joinPaths(_cachePath, common::sha1(key.str()) + ".mesh");
+}
+
+//////////////////////////////////////////////////
+std::vector<uint32_t> Ogre2MeshFactoryPrivate::SimplifyTriangles(
+    const common::SubMesh &_subMesh, double _ratio)
+{
+  std::vector<uint32_t> indices;
+  const unsigned int vertexCount = _subMesh.VertexCount();
+  if (vertexCount == 0u || _subMesh.IndexCount() < 3u)
+    return indices;
+
+  // meshes are surfaces, so the number of occupied cells grows with the
+  // square of the grid resolution
+  const math::Vector3d min = _subMesh.Min();
+  const math::Vector3d size = _subMesh.Max() - min;
+  const double maxSize = std::max({size.X(), size.Y(), size.Z()});
+  const double resolution =
+      std::max(1.0, std::sqrt(vertexCount * _ratio));
+  const double cellSize = maxSize / resolution;
+  if (cellSize <= 0.0)
+    return indices;
+
+  // use the first vertex of each cell to represent all vertices in it
+  std::unordered_map<uint64_t, uint32_t> cells;
+  std::vector<uint32_t> remap(vertexCount);
+  for (unsigned int i = 0u; i < vertexCount; ++i)
+  {
+    const math::Vector3d p = (_subMesh.Vertex(i) - min) / cellSize;
+    const uint64_t key =
+        (static_cast<uint64_t>(p.X()) & 0x1FFFFFu) |
+        ((static_cast<uint64_t>(p.Y()) & 0x1FFFFFu) << 21u) |
+        ((static_cast<uint64_t>(p.Z()) & 0x1FFFFFu) << 42u);
+    remap[i] = cells.emplace(key, i).first->second;
+  }
+
+  for (unsigned int i = 0u; i + 2u < _subMesh.IndexCount(); i += 3u)
+  {
+    const uint32_t a = remap[_subMesh.Index(i)];
+    const uint32_t b = remap[_subMesh.Index(i + 1u)];
+    const uint32_t c = remap[_subMesh.Index(i + 2u)];
+    if (a == b || b == c || a == c)
+      continue;
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+  }
+  return indices;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshFactoryPrivate::DirectV2Mesh(const MeshDescriptor &_desc)
+{
+  // dynamic meshes have no levels of detail, see LoadImpl
+  return !_desc.mesh->HasSkeleton() &&
+      (_desc.dynamic || _desc.lodDistances.empty());
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshFactoryPrivate::PackV2Vertices(const MeshDescriptor &_desc,
+    Ogre2PreparedSubMesh &_data)
+{
+  common::SubMesh &subMesh = _data.subMesh;
+  const unsigned int vertexCount = subMesh.VertexCount();
+
+  // dynamic meshes always have normals so that they can be updated, and
+  // keep full precision floats that Ogre2Mesh::UpdateVertices can write
+  const bool dynamic = _desc.dynamic;
+  if (dynamic && subMesh.NormalCount() != vertexCount)
+    subMesh.RecalculateNormals();
+  const bool halfPositions = !dynamic && _desc.halfPositions;
+  const bool hasNormals = dynamic || subMesh.NormalCount() > 0u;
+
+  // the same texture coordinate sets as the v1 vertex declaration, see
+  // LoadImpl
+  std::vector<unsigned int> texCoordSets;
+  for (unsigned int k = 0u; k < subMesh.TexCoordSetCount(); ++k)
+  {
+    if (subMesh.TexCoordCountBySet(k) > 0u)
+      texCoordSets.push_back(k);
+  }
+  if (subMesh.TexCoordSetCount() == 0u)
+    texCoordSets.push_back(0u);
+  auto texCoord = [&subMesh](unsigned int _vertex, unsigned int _set)
+  {
+    if (_set < subMesh.TexCoordSetCount() &&
+        _vertex < subMesh.TexCoordCountBySet(_set))
+    {
+      return subMesh.TexCoordBySet(_vertex, _set);
+    }
+    return math::Vector2d::Zero;
+  };
+
+  Ogre::VertexElement2Vec &elements = _data.vertexElements;
+  elements.push_back(Ogre::VertexElement2(
+      halfPositions ? Ogre::VET_HALF4 : Ogre::VET_FLOAT3,
+      Ogre::VES_POSITION));
+  if (hasNormals)
+  {
+    elements.push_back(Ogre::VertexElement2(
+        dynamic ? Ogre::VET_FLOAT3 : Ogre::VET_SHORT4_SNORM,
+        Ogre::VES_NORMAL));
+  }
+  for (size_t k = 0u; k < texCoordSets.size(); ++k)
+  {
+    elements.push_back(Ogre::VertexElement2(
+        dynamic ? Ogre::VET_FLOAT2 : Ogre::VET_HALF2,
+        Ogre::VES_TEXTURE_COORDINATES));
+  }
+
+  // QTangents need the tangents along the first texture coordinate set
+  std::vector<math::Vector3d> tangents;
+  std::vector<math::Vector3d> binormals;
+  if (!dynamic && hasNormals)
+  {
+    tangents.resize(vertexCount);
+    binormals.resize(vertexCount);
+    if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIANGLES)
+    {
+      const unsigned int set = texCoordSets.front();
+      for (unsigned int i = 0u; i + 2u < subMesh.IndexCount(); i += 3u)
+      {
+        const unsigned int a = subMesh.Index(i);
+        const unsigned int b = subMesh.Index(i + 1u);
+        const unsigned int c = subMesh.Index(i + 2u);
+        if (a >= vertexCount || b >= vertexCount || c >= vertexCount)
+          continue;
+
+        const math::Vector3d e1 = subMesh.Vertex(b) - subMesh.Vertex(a);
+        const math::Vector3d e2 = subMesh.Vertex(c) - subMesh.Vertex(a);
+        const math::Vector2d d1 = texCoord(b, set) - texCoord(a, set);
+        const math::Vector2d d2 = texCoord(c, set) - texCoord(a, set);
+        const double det = d1.X() * d2.Y() - d2.X() * d1.Y();
+        if (std::abs(det) < 1e-12)
+          continue;
+
+        const math::Vector3d t = (e1 * d2.Y() - e2 * d1.Y()) / det;
+        const math::Vector3d bt = (e2 * d1.X() - e1 * d2.X()) / det;
+        for (unsigned int v : {a, b, c})
+        {
+          tangents[v] += t;
+          binormals[v] += bt;
+        }
+      }
+    }
+  }
+
+  size_t vertexSize = 0u;
+  for (const Ogre::VertexElement2 &element : elements)
+    vertexSize += Ogre::v1::VertexElement::getTypeSize(element.mType);
+  _data.packedVertices.resize(vertexSize * vertexCount);
+
+  uint8_t *dst = _data.packedVertices.data();
+  auto write = [&dst](const auto &_value)
+  {
+    std::memcpy(dst, &_value, sizeof(_value));
+    dst += sizeof(_value);
+  };
+  auto snorm16 = [](float _value)
+  {
+    return static_cast<int16_t>(
+        std::lround(std::clamp(_value, -1.0f, 1.0f) * 32767.0f));
+  };
+  for (unsigned int j = 0u; j < vertexCount; ++j)
+  {
+    const math::Vector3d &vertex = subMesh.Vertex(j);
+    if (halfPositions)
+    {
+      write(Ogre::Bitwise::floatToHalf(static_cast<float>(vertex.X())));
+      write(Ogre::Bitwise::floatToHalf(static_cast<float>(vertex.Y())));
+      write(Ogre::Bitwise::floatToHalf(static_cast<float>(vertex.Z())));
+      write(Ogre::Bitwise::floatToHalf(1.0f));
+    }
+    else
+    {
+      write(static_cast<float>(vertex.X()));
+      write(static_cast<float>(vertex.Y()));
+      write(static_cast<float>(vertex.Z()));
+    }
+
+    if (hasNormals)
+    {
+      const math::Vector3d normal = j < subMesh.NormalCount() ?
+          subMesh.Normal(j) : math::Vector3d::UnitZ;
+      if (dynamic)
+      {
+        write(static_cast<float>(normal.X()));
+        write(static_cast<float>(normal.Y()));
+        write(static_cast<float>(normal.Z()));
+      }
+      else
+      {
+        const Ogre::Quaternion q = QTangent(normal, tangents[j], binormals[j]);
+        write(snorm16(q.x));
+        write(snorm16(q.y));
+        write(snorm16(q.z));
+        write(snorm16(q.w));
+      }
+    }
+
+    for (unsigned int set : texCoordSets)
+    {
+      const math::Vector2d uv = texCoord(j, set);
+      if (dynamic)
+      {
+        write(static_cast<float>(uv.X()));
+        write(static_cast<float>(uv.Y()));
+      }
+      else
+      {
+        write(Ogre::Bitwise::floatToHalf(static_cast<float>(uv.X())));
+        write(Ogre::Bitwise::floatToHalf(static_cast<float>(uv.Y())));
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshFactoryPrivate::LoadV2Mesh(const MeshDescriptor &_desc,
+    const std::string &_name,
+    const std::vector<Ogre2PreparedSubMesh> &_prepared, Ogre2ScenePtr _scene)
+{
+  Ogre::VaoManager *vaoManager =
+      Ogre::Root::getSingleton().getRenderSystem()->getVaoManager();
+  Ogre::MeshPtr mesh;
+  try
+  {
+    mesh = Ogre::MeshManager::getSingleton().createManual(
+        _name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+    Ogre::Aabb bounds = Ogre::Aabb::BOX_NULL;
+    bool empty = true;
+    for (const Ogre2PreparedSubMesh &data : _prepared)
+    {
+      const common::SubMesh &subMesh = data.subMesh;
+      const unsigned int vertexCount = subMesh.VertexCount();
+      for (unsigned int j = 0u; j < vertexCount; ++j)
+      {
+        bounds.merge(Ogre2Conversions::Convert(subMesh.Vertex(j)));
+        empty = false;
+      }
+
+      // a default buffer keeps its contents on the GPU, updates are
+      // uploaded through Ogre's staging buffers. Buffers that keep a CPU
+      // copy take ownership of their initial data.
+      Ogre::VertexBufferPacked *vertexBuffer = nullptr;
+      if (_desc.dynamic)
+      {
+        void *vertices = OGRE_MALLOC_SIMD(
+            std::max<size_t>(1u, data.packedVertices.size()),
+            Ogre::MEMCATEGORY_GEOMETRY);
+        if (!data.packedVertices.empty())
+        {
+          std::memcpy(vertices, data.packedVertices.data(),
+              data.packedVertices.size());
+        }
+        vertexBuffer = vaoManager->createVertexBuffer(data.vertexElements,
+            vertexCount, Ogre::BT_DEFAULT, vertices, true);
+      }
+      else
+      {
+        vertexBuffer = vaoManager->createVertexBuffer(data.vertexElements,
+            vertexCount, Ogre::BT_IMMUTABLE,
+            const_cast<uint8_t *>(data.packedVertices.data()), false);
+      }
+      Ogre::VertexBufferPackedVec vertexBuffers;
+      vertexBuffers.push_back(vertexBuffer);
+
+      // static meshes use 16 bit indices when they fit
+      Ogre::IndexBufferPacked *indexBuffer = nullptr;
+      if (!data.indices.empty() && _desc.dynamic)
+      {
+        uint32_t *indices = reinterpret_cast<uint32_t *>(OGRE_MALLOC_SIMD(
+            sizeof(uint32_t) * data.indices.size(),
+            Ogre::MEMCATEGORY_GEOMETRY));
+        std::copy(data.indices.begin(), data.indices.end(), indices);
+        indexBuffer = vaoManager->createIndexBuffer(
+            Ogre::IndexBufferPacked::IT_32BIT, data.indices.size(),
+            Ogre::BT_IMMUTABLE, indices, true);
+      }
+      else if (!data.indices.empty() && vertexCount <= 0xFFFFu)
+      {
+        std::vector<uint16_t> indices(data.indices.begin(),
+            data.indices.end());
+        indexBuffer = vaoManager->createIndexBuffer(
+            Ogre::IndexBufferPacked::IT_16BIT, indices.size(),
+            Ogre::BT_IMMUTABLE, indices.data(), false);
+      }
+      else if (!data.indices.empty())
+      {
+        indexBuffer = vaoManager->createIndexBuffer(
+            Ogre::IndexBufferPacked::IT_32BIT, data.indices.size(),
+            Ogre::BT_IMMUTABLE,
+            const_cast<uint32_t *>(data.indices.data()), false);
+      }
+
+      Ogre::VertexArrayObject *vao = vaoManager->createVertexArrayObject(
+          vertexBuffers, indexBuffer,
+          OperationType(subMesh.SubMeshPrimitiveType()));
+
+      Ogre::SubMesh *ogreSubMesh = mesh->createSubMesh();
+      ogreSubMesh->mVao[Ogre::VpNormal].push_back(vao);
+      ogreSubMesh->mVao[Ogre::VpShadow].push_back(vao);
+      ogreSubMesh->setMaterialName(
+          this->CreateSubMeshMaterial(_scene, _desc.mesh, subMesh));
+    }
+
+    if (!empty)
+    {
+      mesh->_setBounds(bounds, false);
+      mesh->_setBoundingSphereRadius(bounds.getRadius());
+    }
+  }
+  catch(Ogre::Exception &e)
+  {
+    gzerr << "Unable to create mesh [" << _desc.meshName << "]: "
+          << e.getDescription() << std::endl;
+    if (mesh)
+      Ogre::MeshManager::getSingleton().remove(mesh);
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshFactoryPrivate::LoadCachedMesh(const MeshDescriptor &_desc,
+    const std::string &_name, const std::string &_path, Ogre2ScenePtr _scene)
+{
+  if (!common::isFile(_path))
+    return false;
+
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2MeshFactory::LoadCachedMesh", "mesh", _desc.meshName);
+
+  Ogre::MeshPtr mesh;
+  try
+  {
+    mesh = Ogre::MeshManager::getSingleton().createManual(
+        _name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+    std::ifstream ifs(_path, std::ios::binary);
+    Ogre::DataStreamPtr stream(
+        OGRE_NEW Ogre::FileStreamDataStream(&ifs, false));
+    Ogre::MeshSerializer serializer(
+        Ogre::Root::getSingleton().getRenderSystem()->getVaoManager());
+    serializer.importMesh(stream, mesh.get());
+  }
+  catch(Ogre::Exception &e)
+  {
+    gzwarn << "Unable to load cached mesh [" << _path << "] for ["
+           << _desc.meshName << "]: " << e.getDescription()
+           << ". The mesh will be converted again." << std::endl;
+    if (mesh)
+      Ogre::MeshManager::getSingleton().remove(mesh);
+    return false;
+  }
+
+  // material names are not stable across runs, so create the submesh
+  // materials again in the same order as the cached submeshes
+  unsigned int subMeshIdx = 0u;
+  for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); ++i)
+  {
+    auto s = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!s || (!_desc.subMeshName.empty() && s->Name() != _desc.subMeshName))
+      continue;
+
+    if (subMeshIdx >= mesh->getNumSubMeshes())
+      break;
+
+    mesh->getSubMesh(subMeshIdx++)->setMaterialName(
+        this->CreateSubMeshMaterial(_scene, _desc.mesh, *s));
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshFactoryPrivate::SaveCachedMesh(const Ogre::MeshPtr &_mesh,
+    const std::string &_path)
+{
+  std::string dir = common::parentPath(_path);
+  if (!common::exists(dir) && !common::createDirectories(dir))
+  {
+    gzwarn << "Unable to create mesh cache directory [" << dir << "]"
+           << std::endl;
+    return;
+  }
+
+  // write to a temporary file first so concurrent processes never read a
+  // partially written mesh
+  std::string tmpPath = _path + "." + common::Uuid().String() + ".tmp";
+  try
+  {
+    Ogre::MeshSerializer serializer(
+        Ogre::Root::getSingleton().getRenderSystem()->getVaoManager());
+    serializer.exportMesh(_mesh.get(), tmpPath);
+  }
+  catch(Ogre::Exception &e)
+  {
+    gzwarn << "Unable to cache mesh [" << _mesh->getName() << "]: "
+           << e.getDescription() << std::endl;
+    common::removeFile(tmpPath);
+    return;
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmpPath, _path, ec);
+  if (ec)
+    common::removeFile(tmpPath);
+}
+
+//////////////////////////////////////////////////
+std::vector<Ogre2PreparedSubMesh> Ogre2MeshFactoryPrivate::PrepareMesh(
+    const MeshDescriptor &_desc)
+{
+  std::vector<Ogre2PreparedSubMesh> prepared;
+  for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); i++)
+  {
+    // if submesh is specified then load only that particular submesh
+    auto s = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!s || (!_desc.subMeshName.empty() && s->Name() != _desc.subMeshName))
+      continue;
+
+    // Copy the original submesh. We may need to modify the vertices, and
+    // we don't want to change the original.
+    prepared.emplace_back();
+    Ogre2PreparedSubMesh &data = prepared.back();
+    data.subMesh = *s;
+    common::SubMesh &subMesh = data.subMesh;
+
+    // Recenter the vertices if requested.
+    if (_desc.centerSubMesh)
+      subMesh.Center(math::Vector3d::Zero);
+
+    // the vertices of dynamic meshes are updated in their original order
+    if (_desc.optimize && !_desc.dynamic)
+      Ogre2MeshOptimizer::Optimize(subMesh);
+
+    // meshes without a v1 mesh get the layout of their v2 vertex buffer
+    if (DirectV2Mesh(_desc))
+    {
+      PackV2Vertices(_desc, data);
+    }
+    else
+    {
+      // positions, normals and texture coordinates. A default texture
+      // coordinate set is added to submeshes without one, see LoadImpl.
+      unsigned int texCoordSets = 0u;
+      for (unsigned int k = 0u; k < subMesh.TexCoordSetCount(); ++k)
+      {
+        if (subMesh.TexCoordCountBySet(k) > 0u)
+          ++texCoordSets;
+      }
+      if (subMesh.TexCoordSetCount() == 0u)
+        texCoordSets = 1u;
+      const bool hasNormals = subMesh.NormalCount() > 0;
+      const size_t vertexSize = 3u + (hasNormals ? 3u : 0u) + 2u * texCoordSets;
+      data.vertices.resize(vertexSize * subMesh.VertexCount());
+
+      float *vertices = data.vertices.data();
+      for (unsigned int j = 0; j < subMesh.VertexCount(); ++j)
+      {
+        const math::Vector3d &vertex = subMesh.Vertex(j);
+        *vertices++ = vertex.X();
+        *vertices++ = vertex.Y();
+        *vertices++ = vertex.Z();
+
+        if (hasNormals)
+        {
+          const math::Vector3d &normal = subMesh.Normal(j);
+          *vertices++ = normal.X();
+          *vertices++ = normal.Y();
+          *vertices++ = normal.Z();
+        }
+
+        if (subMesh.TexCoordSetCount() == 0u)
+        {
+          *vertices++ = 0;
+          *vertices++ = 0;
+        }
+        else
+        {
+          for (unsigned int k = 0u; k < subMesh.TexCoordSetCount(); ++k)
+          {
+            if (subMesh.TexCoordCountBySet(k) > 0u)
+            {
+              *vertices++ = subMesh.TexCoordBySet(j, k).X();
+              *vertices++ = subMesh.TexCoordBySet(j, k).Y();
+            }
+          }
+        }
+      }
+    }
+
+    data.indices.resize(subMesh.IndexCount());
+    for (unsigned int j = 0; j < subMesh.IndexCount(); ++j)
+      data.indices[j] = static_cast<uint32_t>(subMesh.Index(j));
+
+    // generate the coarser levels of detail
+    double ratio = 1.0;
+    data.lodIndices.resize(_desc.lodDistances.size());
+    for (size_t lod = 0u; lod < _desc.lodDistances.size(); ++lod)
+    {
+      ratio *= _desc.lodReduction;
+      if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIANGLES)
+        data.lodIndices[lod] = SimplifyTriangles(subMesh, ratio);
+      if (_desc.optimize && !_desc.dynamic)
+      {
+        data.lodIndices[lod] = Ogre2MeshOptimizer::OptimizeVertexCache(
+            data.lodIndices[lod], subMesh.VertexCount());
+      }
+    }
+  }
+  return prepared;
+}
+
+//////////////////////////////////////////////////
+Ogre::MeshPtr Ogre2MeshFactoryPrivate::ImportV1Mesh(const std::string &_name,
+    std::vector<std::string> &_ogreMeshes)
+{
+  // check if a v2 mesh already exists
+  Ogre::MeshPtr mesh =
+      Ogre::MeshManager::getSingleton().getByName(_name);
+
+  // if not, it probably has not been imported from v1 yet
+  if (!mesh)
+  {
+    Ogre::v1::MeshPtr v1Mesh =
+        Ogre::v1::MeshManager::getSingleton().getByName(_name);
+    if (!v1Mesh)
+      return Ogre::MeshPtr();
+
+    // create v2 mesh from v1
+    mesh = Ogre::MeshManager::getSingleton().createManual(
+        _name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+    mesh->importV1(v1Mesh.get(), false, true, true);
+    _ogreMeshes.push_back(_name);
+
+    // the v2 mesh holds everything the v1 mesh had, including the skeleton
+    // and the levels of detail, so the v1 copy is no longer needed
+    Ogre::v1::MeshManager::getSingleton().remove(v1Mesh);
+  }
+  return mesh;
+}
+
 //////////////////////////////////////////////////
 Ogre2MeshFactory::Ogre2MeshFactory(Ogre2ScenePtr _scene) :
   scene(_scene), dataPtr(std::make_unique<Ogre2MeshFactoryPrivate>())
@@ -84,12 +915,77 @@ Ogre2MeshFactory::~Ogre2MeshFactory()
 //////////////////////////////////////////////////
 void Ogre2MeshFactory::Clear()
 {
-  for (auto &m : this->ogreMeshes)
-    Ogre::MeshManager::getSingleton().remove(m);
+  // retained meshes are left to the next scene that loads them
+  if (!Ogre2RenderEngine::Instance()->RetainMeshes())
+  {
+    for (auto &m : this->ogreMeshes)
+      Ogre::MeshManager::getSingleton().remove(m);
+  }
 
   this->ogreMeshes.clear();
 }
 
+//////////////////////////////////////////////////
+void Ogre2MeshFactory::Preload(const std::vector<MeshDescriptor> &_descs)
+{
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2MeshFactory::Preload", "mesh");
+
+  // find the meshes that need converting
+  std::vector<MeshDescriptor> toLoad;
+  std::vector<size_t> toPrepare;
+  std::unordered_set<std::string> names;
+  const std::string cachePath = Ogre2RenderEngine::Instance()->MeshCachePath();
+  for (const auto &desc : _descs)
+  {
+    MeshDescriptor normDesc = desc;
+    normDesc.Load();
+    if (!this->Validate(normDesc) || this->IsLoaded(normDesc) ||
+        !names.insert(this->MeshName(normDesc)).second)
+    {
+      continue;
+    }
+
+    // meshes in the disk cache do not need preparing
+    const std::string cachedPath =
+        Ogre2MeshFactoryPrivate::CachedMeshPath(normDesc, cachePath);
+    if (cachedPath.empty() || !common::isFile(cachedPath))
+      toPrepare.push_back(toLoad.size());
+    toLoad.push_back(normDesc);
+  }
+
+  // pack the vertices and generate the levels of detail of every mesh on
+  // the worker threads
+  std::vector<std::vector<Ogre2PreparedSubMesh>> prepared(toPrepare.size());
+  this->scene->ParallelForRows(static_cast<unsigned int>(toPrepare.size()),
+      [&](unsigned int _begin, unsigned int _end)
+      {
+        for (unsigned int i = _begin; i < _end; ++i)
+        {
+          prepared[i] =
+              Ogre2MeshFactoryPrivate::PrepareMesh(toLoad[toPrepare[i]]);
+        }
+      }, 1u);
+  for (size_t i = 0u; i < toPrepare.size(); ++i)
+  {
+    this->dataPtr->preparedMeshes[this->MeshName(toLoad[toPrepare[i]])] =
+        std::move(prepared[i]);
+  }
+
+  // create the buffers and import them to v2 meshes
+  for (const auto &desc : toLoad)
+  {
+    if (this->Load(desc))
+    {
+      Ogre2MeshFactoryPrivate::ImportV1Mesh(this->MeshName(desc),
+          this->ogreMeshes);
+    }
+  }
+
+  // drop the data of meshes that failed to load
+  this->dataPtr->preparedMeshes.clear();
+}
+
 //////////////////////////////////////////////////
 void Ogre2MeshFactory::ClearMaterialsCache(const std::string &_name)
 {
@@ -109,6 +1005,22 @@ void Ogre2MeshFactory::ClearMaterialsCache(const std::string &_name)
     this->dataPtr->materialCache.erase(it);
 }
 
+//////////////////////////////////////////////////
+void Ogre2MeshFactory::Unload(const MeshDescriptor &_desc)
+{
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+  const std::string name = this->MeshName(normDesc);
+
+  this->ogreMeshes.erase(std::remove(this->ogreMeshes.begin(),
+      this->ogreMeshes.end(), name), this->ogreMeshes.end());
+
+  if (Ogre::MeshManager::getSingleton().resourceExists(name))
+    Ogre::MeshManager::getSingleton().remove(name);
+  if (Ogre::v1::MeshManager::getSingleton().resourceExists(name))
+    Ogre::v1::MeshManager::getSingleton().remove(name);
+}
+
 //////////////////////////////////////////////////
 Ogre2MeshPtr Ogre2MeshFactory::Create(const MeshDescriptor &_desc)
 {
@@ -149,24 +1061,10 @@ Ogre::Item *Ogre2MeshFactory::OgreItem(const MeshDescriptor &_desc)
   std::string name = this->MeshName(_desc);
   Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
 
-  // check if a v2 mesh already exists
   Ogre::MeshPtr mesh =
-      Ogre::MeshManager::getSingleton().getByName(name);
-
-  // if not, it probably has not been imported from v1 yet
+      Ogre2MeshFactoryPrivate::ImportV1Mesh(name, this->ogreMeshes);
   if (!mesh)
-  {
-    Ogre::v1::MeshPtr v1Mesh =
-        Ogre::v1::MeshManager::getSingleton().getByName(name);
-    if (!v1Mesh)
-      return nullptr;
-
-    // create v2 mesh from v1
-    mesh = Ogre::MeshManager::getSingleton().createManual(
-        name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
-    mesh->importV1(v1Mesh.get(), false, true, true);
-    this->ogreMeshes.push_back(name);
-  }
+    return nullptr;
 
   return sceneManager->createItem(mesh, Ogre::SCENE_DYNAMIC);
 }
@@ -184,6 +1082,8 @@ bool Ogre2MeshFactory::Load(const MeshDescriptor &_desc)
     return true;
   }
 
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2MeshFactory::Load", "mesh", _desc.meshName);
   return this->LoadImpl(_desc);
 }
 
@@ -203,9 +1103,69 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
 
   Ogre2RenderEngine::Instance()->AddResourcePath(_desc.mesh->Path());
 
+  // load the converted v2 mesh from the disk cache if possible. Dynamic
+  // meshes are rebuilt every time since their vertices change anyway.
+  const bool dynamic = _desc.dynamic && !_desc.mesh->HasSkeleton();
+  if (_desc.dynamic && !dynamic)
+  {
+    gzwarn << "Mesh [" << _desc.meshName << "] has a skeleton and can not "
+           << "be dynamic" << std::endl;
+  }
+  const std::string cachedPath = dynamic ? std::string() :
+      Ogre2MeshFactoryPrivate::CachedMeshPath(_desc,
+      Ogre2RenderEngine::Instance()->MeshCachePath());
+  if (!cachedPath.empty() && this->dataPtr->LoadCachedMesh(_desc,
+      this->MeshName(_desc), cachedPath, this->scene))
+  {
+    this->ogreMeshes.push_back(this->MeshName(_desc));
+    return true;
+  }
+
+  // use the submeshes prepared by Preload if there are any
+  name = this->MeshName(_desc);
+  std::vector<Ogre2PreparedSubMesh> prepared;
+  auto preparedIt = this->dataPtr->preparedMeshes.find(name);
+  if (preparedIt != this->dataPtr->preparedMeshes.end())
+  {
+    prepared = std::move(preparedIt->second);
+    this->dataPtr->preparedMeshes.erase(preparedIt);
+  }
+  else
+  {
+    prepared = Ogre2MeshFactoryPrivate::PrepareMesh(_desc);
+  }
+
+  if (prepared.empty())
+  {
+    std::string msg = "Unable to load mesh: '" + _desc.meshName + "'";
+    if (!_desc.subMeshName.empty())
+      msg += ", submesh: '" + _desc.subMeshName + "'";
+    msg += ". Mesh will be empty.";
+    gzwarn << msg << std::endl;
+  }
+
+  // build the v2 mesh straight away unless the skeleton or the levels of
+  // detail need the v1 mesh
+  if (Ogre2MeshFactoryPrivate::DirectV2Mesh(_desc))
+  {
+    if (dynamic && !_desc.lodDistances.empty())
+    {
+      gzwarn << "Dynamic mesh [" << _desc.meshName << "] has no levels of "
+             << "detail" << std::endl;
+    }
+    if (!this->dataPtr->LoadV2Mesh(_desc, name, prepared, this->scene))
+      return false;
+    this->ogreMeshes.push_back(name);
+    if (!cachedPath.empty() && !prepared.empty())
+    {
+      Ogre2MeshFactoryPrivate::SaveCachedMesh(
+          Ogre::MeshManager::getSingleton().getByName(name), cachedPath);
+    }
+    return true;
+  }
+
   try
   {
-    name = this->MeshName(_desc);
     group = Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME;
     ogreMesh = Ogre::v1::MeshManager::getSingleton().createManual(name, group);
 
@@ -292,67 +1252,22 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
       ogreMesh->setSkeletonName(_desc.mesh->Name() + "_skeleton");
     }
 
-    for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); i++)
+    for (Ogre2PreparedSubMesh &data : prepared)
     {
-      // if submesh is specified then load only that particular submesh
-      auto s = _desc.mesh->SubMeshByIndex(i).lock();
-      if (!_desc.subMeshName.empty() && s &&
-          s->Name() != _desc.subMeshName)
-      {
-        continue;
-      }
-
       Ogre::v1::SubMesh *ogreSubMesh;
       Ogre::v1::VertexData *vertexData;
       Ogre::v1::VertexDeclaration* vertexDecl;
       Ogre::v1::HardwareVertexBufferSharedPtr vBuf;
       Ogre::v1::HardwareIndexBufferSharedPtr iBuf;
-      float *vertices;
-      uint32_t *indices;
 
       size_t currOffset = 0;
 
-      // Copy the original submesh. We may need to modify the vertices, and
-      // we don't want to change the original.
-      common::SubMesh subMesh(*s.get());
-
-      // Recenter the vertices if requested.
-      if (_desc.centerSubMesh)
-        subMesh.Center(math::Vector3d::Zero);
+      const common::SubMesh &subMesh = data.subMesh;
 
       ogreSubMesh = ogreMesh->createSubMesh(subMesh.Name());
       ogreSubMesh->useSharedVertices = false;
-      if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIANGLES)
-      {
-        ogreSubMesh->operationType =
-            Ogre::OT_TRIANGLE_LIST;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::LINES)
-      {
-        ogreSubMesh->operationType = Ogre::OT_LINE_LIST;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::LINESTRIPS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_LINE_STRIP;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIFANS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_TRIANGLE_FAN;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRISTRIPS)
-      {
-        ogreSubMesh->operationType =
-            Ogre::OT_TRIANGLE_STRIP;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::POINTS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_POINT_LIST;
-      }
-      else
-      {
-        gzerr << "Unknown primitive type["
-              << subMesh.SubMeshPrimitiveType() << "]\n";
-      }
+      ogreSubMesh->operationType =
+          OperationType(subMesh.SubMeshPrimitiveType());
 
       ogreSubMesh->vertexData[Ogre::VpNormal] =
         new Ogre::v1::VertexData(ogreMesh->getHardwareBufferManager());
@@ -361,6 +1276,7 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
 
       // The vertexDecl should contain positions, blending weights, normals,
       // diffiuse colors, specular colors, tex coords. In that order.
+      // It must match the layout of the vertices packed by PrepareMesh.
       vertexDecl->addElement(0, currOffset, Ogre::VET_FLOAT3,
                              Ogre::VES_POSITION);
       currOffset += Ogre::v1::VertexElement::getTypeSize(Ogre::VET_FLOAT3);
@@ -416,8 +1332,6 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
                  true);
 
       vertexData->vertexBufferBinding->setBinding(0, vBuf);
-      vertices = static_cast<float*>(vBuf->lock(
-                      Ogre::v1::HardwareBuffer::HBL_DISCARD));
 
       if (_desc.mesh->HasSkeleton())
       {
@@ -435,44 +1349,15 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
       }
 
       // Add all the vertices
-      for (unsigned int j = 0; j < subMesh.VertexCount(); ++j)
+      if (!data.vertices.empty())
       {
-        *vertices++ = subMesh.Vertex(j).X();
-        *vertices++ = subMesh.Vertex(j).Y();
-        *vertices++ = subMesh.Vertex(j).Z();
-
-        // Add all normals
-        if (subMesh.NormalCount() > 0)
-        {
-          *vertices++ = subMesh.Normal(j).X();
-          *vertices++ = subMesh.Normal(j).Y();
-          *vertices++ = subMesh.Normal(j).Z();
-        }
-
-        // Add all texture coordinate sets
-        if (subMesh.TexCoordSetCount() == 0u)
-        {
-          *vertices++ = 0;
-          *vertices++ = 0;
-        }
-        else
-        {
-          for (unsigned int k = 0u; k < subMesh.TexCoordSetCount(); ++k)
-          {
-            if (subMesh.TexCoordCountBySet(k) > 0u)
-            {
-              *vertices++ = subMesh.TexCoordBySet(j, k).X();
-              *vertices++ = subMesh.TexCoordBySet(j, k).Y();
-            }
-          }
-        }
+        vBuf->writeData(0u, vBuf->getSizeInBytes(), data.vertices.data(),
+            true);
       }
 
-      vBuf->unlock();
-
       // Add all the indices
       // allocate index buffer
-      ogreSubMesh->indexData[Ogre::VpNormal]->indexCount = subMesh.IndexCount();
+      ogreSubMesh->indexData[Ogre::VpNormal]->indexCount = data.indices.size();
 
       ogreSubMesh->indexData[Ogre::VpNormal]->indexBuffer =
         Ogre::v1::HardwareBufferManager::getSingleton().createIndexBuffer(
@@ -482,34 +1367,60 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
             true);
 
       iBuf = ogreSubMesh->indexData[Ogre::VpNormal]->indexBuffer;
-      indices = static_cast<uint32_t*>(
-          iBuf->lock(Ogre::v1::HardwareBuffer::HBL_DISCARD));
-
-
-      for (unsigned int j = 0; j < subMesh.IndexCount(); ++j)
-        *indices++ = static_cast<uint32_t>(subMesh.Index(j));
-
-      iBuf->unlock();
-
-      common::MaterialPtr material;
-      if (const auto subMeshIdx = subMesh.GetMaterialIndex())
+      if (!data.indices.empty())
       {
-        material = _desc.mesh->MaterialByIndex(subMeshIdx.value());
+        iBuf->writeData(0u, iBuf->getSizeInBytes(), data.indices.data(),
+            true);
       }
 
-      MaterialPtr mat = this->scene->CreateMaterial();
-      if (material)
+      // create the coarser levels of detail. The first entry of the lod
+      // face list is the full detail index data.
+      Ogre::v1::IndexData *prevLod = ogreSubMesh->indexData[Ogre::VpNormal];
+      for (const std::vector<uint32_t> &lodIndices : data.lodIndices)
       {
-        mat->CopyFrom(*material);
-        this->dataPtr->materialCache.push_back(mat);
+        // keep the previous level if the submesh can not be simplified
+        // any further
+        Ogre::v1::IndexData *lodData = nullptr;
+        if (lodIndices.empty())
+        {
+          lodData = prevLod->clone(true);
+        }
+        else
+        {
+          lodData = OGRE_NEW Ogre::v1::IndexData();
+          lodData->indexStart = 0u;
+          lodData->indexCount = lodIndices.size();
+          lodData->indexBuffer =
+              Ogre::v1::HardwareBufferManager::getSingleton().
+              createIndexBuffer(Ogre::v1::HardwareIndexBuffer::IT_32BIT,
+              lodData->indexCount, Ogre::v1::HardwareBuffer::HBU_STATIC,
+              true);
+          lodData->indexBuffer->writeData(0u,
+              lodData->indexBuffer->getSizeInBytes(), lodIndices.data(),
+              true);
+        }
+        ogreSubMesh->mLodFaceList[Ogre::VpNormal].push_back(lodData);
+        prevLod = lodData;
       }
-      else
+
+      ogreSubMesh->setMaterialName(this->dataPtr->CreateSubMeshMaterial(
+          this->scene, _desc.mesh, subMesh));
+    }
+
+    if (!_desc.lodDistances.empty())
+    {
+      const Ogre::LodStrategy *strategy =
+          Ogre::LodStrategyManager::getSingleton().getDefaultStrategy();
+      ogreMesh->_setLodInfo(
+          static_cast<unsigned short>(_desc.lodDistances.size() + 1u));
+      for (size_t lod = 0u; lod < _desc.lodDistances.size(); ++lod)
       {
-        MaterialPtr defaultMat = this->scene->Material("Default/White");
-        if (defaultMat != nullptr)
-          mat->CopyFrom(defaultMat);
+        Ogre::v1::MeshLodUsage usage;
+        usage.userValue = static_cast<Ogre::Real>(_desc.lodDistances[lod]);
+        usage.value = strategy->transformUserValue(usage.userValue);
+        usage.edgeData = nullptr;
+        ogreMesh->_setLodUsage(static_cast<unsigned short>(lod + 1u), usage);
       }
-      ogreSubMesh->setMaterialName(mat->Name());
     }
 
     math::Vector3d max = _desc.mesh->Max();
@@ -553,13 +1464,29 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
     return false;
   }
 
-  if (ogreMesh->getNumSubMeshes() == 0u)
+  // convert to v2 now and store the result in the disk cache
+  if (!cachedPath.empty() && ogreMesh->getNumSubMeshes() > 0u)
   {
-    std::string msg = "Unable to load mesh: '" + _desc.meshName + "'";
-    if (!_desc.subMeshName.empty())
-      msg += ", submesh: '" + _desc.subMeshName + "'";
-    msg += ". Mesh will be empty.";
-    gzwarn << msg << std::endl;
+    Ogre::MeshPtr mesh;
+    try
+    {
+      mesh = Ogre::MeshManager::getSingleton().createManual(
+          name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+      mesh->importV1(ogreMesh.get(), false, true, true);
+      this->ogreMeshes.push_back(name);
+      Ogre2MeshFactoryPrivate::SaveCachedMesh(mesh, cachedPath);
+
+      // the v2 mesh holds the levels of detail of the v1 mesh
+      Ogre::v1::MeshManager::getSingleton().remove(ogreMesh);
+    }
+    catch(Ogre::Exception &e)
+    {
+      gzwarn << "Unable to convert mesh [" << name << "] for caching: "
+             << e.getDescription() << std::endl;
+      // let OgreItem import the v1 mesh as usual
+      if (mesh)
+        Ogre::MeshManager::getSingleton().remove(mesh);
+    }
   }
 
   return true;
@@ -572,6 +1499,19 @@ std::string Ogre2MeshFactory::MeshName(const MeshDescriptor &_desc)
   ss << _desc.meshName << "::";
   ss << _desc.subMeshName << "::";
   ss << ((_desc.centerSubMesh) ? "CENTERED" : "ORIGINAL");
+  if (!_desc.lodDistances.empty())
+  {
+    ss << "::LOD";
+    for (double distance : _desc.lodDistances)
+      ss << "::" << distance;
+    ss << "::" << _desc.lodReduction;
+  }
+  if (_desc.dynamic)
+    ss << "::DYNAMIC";
+  else if (_desc.halfPositions)
+    ss << "::HALF";
+  if (_desc.optimize && !_desc.dynamic)
+    ss << "::OPTIMIZED";
   return ss.str();
 }
 
@@ -596,6 +1536,23 @@ bool Ogre2MeshFactory::Validate(const MeshDescriptor &_desc)
     return false;
   }
 
+  if (!_desc.lodDistances.empty())
+  {
+    if (_desc.lodReduction <= 0.0 || _desc.lodReduction >= 1.0)
+    {
+      gzerr << "Invalid mesh-descriptor, lod reduction must be in (0, 1)"
+            << std::endl;
+      return false;
+    }
+    if (!std::is_sorted(_desc.lodDistances.begin(),
+        _desc.lodDistances.end()) || _desc.lodDistances.front() <= 0.0)
+    {
+      gzerr << "Invalid mesh-descriptor, lod distances must be positive and "
+            << "in increasing order" << std::endl;
+      return false;
+    }
+  }
+
   return true;
 }
 
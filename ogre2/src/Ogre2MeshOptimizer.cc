@@ -0,0 +1,452 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "Ogre2MeshOptimizer.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Size of the vertex cache modelled by the vertex cache
+/// optimization
+static const unsigned int kModelCacheSize = 32u;
+
+/// \brief Size of the FIFO cache used to split the triangles into
+/// clusters for the overdraw optimization
+static const unsigned int kClusterCacheSize = 16u;
+
+/// \brief Smallest number of triangles of a cluster split off where the
+/// cache is still warm
+static const size_t kMinClusterTriangles = 64u;
+
+/// \brief How much worse than the whole cluster the cache miss ratio of a
+/// split off cluster may be
+static const double kOverdrawThreshold = 1.05;
+
+/// \brief Score of a vertex in the vertex cache optimization. Vertices
+/// recently used and vertices with few triangles left score higher.
+/// \param[in] _cachePos Position in the modelled cache, -1 if not cached
+/// \param[in] _liveTriangles Number of triangles of the vertex not yet
+/// emitted
+/// \return Score of the vertex
+static double VertexScore(int _cachePos, uint32_t _liveTriangles)
+{
+  if (_liveTriangles == 0u)
+    return -1.0;
+
+  double score = 0.0;
+  if (_cachePos >= 0)
+  {
+    // the vertices of the last triangle score the same so that the next
+    // triangle does not depend on their order
+    if (_cachePos < 3)
+    {
+      score = 0.75;
+    }
+    else
+    {
+      const double scale = 1.0 / (kModelCacheSize - 3u);
+      score = std::pow(1.0 - (_cachePos - 3) * scale, 1.5);
+    }
+  }
+  return score + 2.0 / std::sqrt(static_cast<double>(_liveTriangles));
+}
+
+/// \brief Simulate a FIFO vertex cache over a triangle list
+/// \param[in] _indices Triangle list indices
+/// \param[in] _cacheSize Number of vertices in the cache
+/// \return Number of cache misses of every triangle
+static std::vector<uint8_t> CacheMisses(const std::vector<uint32_t> &_indices,
+    unsigned int _cacheSize)
+{
+  std::vector<uint8_t> misses(_indices.size() / 3u, 0u);
+  if (_indices.empty())
+    return misses;
+
+  // a vertex is cached if fewer than _cacheSize vertices were added to
+  // the cache after it
+  const uint32_t vertexCount =
+      *std::max_element(_indices.begin(), _indices.end()) + 1u;
+  std::vector<uint64_t> added(vertexCount, 0u);
+  uint64_t time = _cacheSize + 1u;
+  for (size_t t = 0u; t < misses.size(); ++t)
+  {
+    for (size_t k = 0u; k < 3u; ++k)
+    {
+      const uint32_t v = _indices[t * 3u + k];
+      if (time - added[v] > _cacheSize)
+      {
+        added[v] = time++;
+        ++misses[t];
+      }
+    }
+  }
+  return misses;
+}
+
+/// \brief Reorder clusters of triangles so that the outer, forward facing
+/// ones are drawn first and hide more of the others, as meshoptimizer
+/// does. Clusters start where the FIFO cache is cold, so the vertex cache
+/// order within them is kept.
+/// \param[in,out] _indices Triangle list indices, in vertex cache order
+/// \param[in] _positions Vertex positions
+static void OptimizeOverdraw(std::vector<uint32_t> &_indices,
+    const std::vector<math::Vector3d> &_positions)
+{
+  const size_t triangleCount = _indices.size() / 3u;
+  if (triangleCount < 2u)
+    return;
+
+  // hard boundaries where every vertex of a triangle misses
+  const std::vector<uint8_t> misses =
+      CacheMisses(_indices, kClusterCacheSize);
+  std::vector<size_t> hard;
+  for (size_t t = 0u; t < triangleCount; ++t)
+  {
+    if (t == 0u || misses[t] == 3u)
+      hard.push_back(t);
+  }
+  hard.push_back(triangleCount);
+
+  // soft boundaries where the cache misses so far are about as low as
+  // those of the whole hard cluster
+  std::vector<size_t> clusters;
+  for (size_t c = 0u; c + 1u < hard.size(); ++c)
+  {
+    const size_t start = hard[c];
+    const size_t end = hard[c + 1u];
+    const double total = std::accumulate(misses.begin() + start,
+        misses.begin() + end, 0.0);
+    const double ratio = total / static_cast<double>(end - start);
+
+    clusters.push_back(start);
+    double clusterMisses = 0.0;
+    size_t clusterStart = start;
+    for (size_t t = start; t + 1u < end; ++t)
+    {
+      clusterMisses += misses[t];
+      const size_t size = t + 1u - clusterStart;
+      if (size >= kMinClusterTriangles &&
+          clusterMisses / size <= ratio * kOverdrawThreshold)
+      {
+        clusterStart = t + 1u;
+        clusters.push_back(clusterStart);
+        clusterMisses = 0.0;
+      }
+    }
+  }
+  clusters.push_back(triangleCount);
+
+  // area weighted centroid and normal of every cluster
+  const size_t clusterCount = clusters.size() - 1u;
+  std::vector<math::Vector3d> centroids(clusterCount);
+  std::vector<math::Vector3d> normals(clusterCount);
+  math::Vector3d meshCentroid;
+  double meshArea = 0.0;
+  for (size_t c = 0u; c < clusterCount; ++c)
+  {
+    double area = 0.0;
+    for (size_t t = clusters[c]; t < clusters[c + 1u]; ++t)
+    {
+      const math::Vector3d &a = _positions[_indices[t * 3u]];
+      const math::Vector3d &b = _positions[_indices[t * 3u + 1u]];
+      const math::Vector3d &d = _positions[_indices[t * 3u + 2u]];
+      const math::Vector3d normal = (b - a).Cross(d - a);
+      const double triangleArea = normal.Length();
+      centroids[c] += (a + b + d) / 3.0 * triangleArea;
+      normals[c] += normal;
+      area += triangleArea;
+    }
+    meshCentroid += centroids[c];
+    meshArea += area;
+    if (area > 0.0)
+      centroids[c] /= area;
+    normals[c].Normalize();
+  }
+  if (meshArea > 0.0)
+    meshCentroid /= meshArea;
+
+  std::vector<double> keys(clusterCount);
+  for (size_t c = 0u; c < clusterCount; ++c)
+    keys[c] = (centroids[c] - meshCentroid).Dot(normals[c]);
+  std::vector<size_t> order(clusterCount);
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(),
+      [&keys](size_t _a, size_t _b)
+      {
+        return keys[_a] > keys[_b];
+      });
+
+  std::vector<uint32_t> indices;
+  indices.reserve(_indices.size());
+  for (size_t c : order)
+  {
+    indices.insert(indices.end(), _indices.begin() + clusters[c] * 3u,
+        _indices.begin() + clusters[c + 1u] * 3u);
+  }
+  _indices.swap(indices);
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshOptimizer::Optimize(common::SubMesh &_subMesh)
+{
+  // bone assignments refer to the vertices by index
+  if (_subMesh.SubMeshPrimitiveType() != common::SubMesh::TRIANGLES ||
+      _subMesh.NodeAssignmentsCount() > 0u)
+  {
+    return false;
+  }
+
+  const unsigned int vertexCount = _subMesh.VertexCount();
+  const unsigned int indexCount = _subMesh.IndexCount();
+  if (indexCount < 3u || indexCount % 3u != 0u)
+    return false;
+
+  // every vertex needs the same attributes to be merged and reordered
+  const bool hasNormals = _subMesh.NormalCount() > 0u;
+  if (hasNormals && _subMesh.NormalCount() != vertexCount)
+    return false;
+  std::vector<unsigned int> texCoordSets;
+  for (unsigned int k = 0u; k < _subMesh.TexCoordSetCount(); ++k)
+  {
+    const unsigned int count = _subMesh.TexCoordCountBySet(k);
+    if (count > 0u && count != vertexCount)
+      return false;
+    if (count > 0u)
+      texCoordSets.push_back(k);
+  }
+
+  // merge vertices whose attributes are all equal
+  std::unordered_map<std::string, uint32_t> unique;
+  std::vector<uint32_t> remap(vertexCount);
+  std::vector<uint32_t> firsts;
+  std::vector<math::Vector3d> positions;
+  std::string key;
+  auto append = [&key](const double *_values, size_t _count)
+  {
+    key.append(reinterpret_cast<const char *>(_values),
+        sizeof(double) * _count);
+  };
+  for (unsigned int v = 0u; v < vertexCount; ++v)
+  {
+    key.clear();
+    const math::Vector3d &vertex = _subMesh.Vertex(v);
+    const double position[] = {vertex.X(), vertex.Y(), vertex.Z()};
+    append(position, 3u);
+    if (hasNormals)
+    {
+      const math::Vector3d &n = _subMesh.Normal(v);
+      const double normal[] = {n.X(), n.Y(), n.Z()};
+      append(normal, 3u);
+    }
+    for (unsigned int k : texCoordSets)
+    {
+      const math::Vector2d &uv = _subMesh.TexCoordBySet(v, k);
+      const double texCoord[] = {uv.X(), uv.Y()};
+      append(texCoord, 2u);
+    }
+
+    auto inserted = unique.emplace(key, static_cast<uint32_t>(firsts.size()));
+    if (inserted.second)
+    {
+      firsts.push_back(v);
+      positions.push_back(vertex);
+    }
+    remap[v] = inserted.first->second;
+  }
+
+  std::vector<uint32_t> indices(indexCount);
+  for (unsigned int i = 0u; i < indexCount; ++i)
+  {
+    const unsigned int index = _subMesh.Index(i);
+    if (index >= vertexCount)
+      return false;
+    indices[i] = remap[index];
+  }
+
+  indices = OptimizeVertexCache(indices,
+      static_cast<unsigned int>(firsts.size()));
+  OptimizeOverdraw(indices, positions);
+
+  // number the vertices in the order they are first used, which also
+  // drops unused ones
+  const uint32_t unset = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> fetchOrder(firsts.size(), unset);
+  std::vector<uint32_t> fetched;
+  for (uint32_t &index : indices)
+  {
+    if (fetchOrder[index] == unset)
+    {
+      fetchOrder[index] = static_cast<uint32_t>(fetched.size());
+      fetched.push_back(index);
+    }
+    index = fetchOrder[index];
+  }
+
+  common::SubMesh result(_subMesh.Name());
+  result.SetPrimitiveType(common::SubMesh::TRIANGLES);
+  if (const auto materialIndex = _subMesh.GetMaterialIndex())
+    result.SetMaterialIndex(*materialIndex);
+  for (uint32_t u : fetched)
+  {
+    const unsigned int v = firsts[u];
+    result.AddVertex(_subMesh.Vertex(v));
+    if (hasNormals)
+      result.AddNormal(_subMesh.Normal(v));
+    for (unsigned int k : texCoordSets)
+      result.AddTexCoordBySet(_subMesh.TexCoordBySet(v, k), k);
+  }
+  for (uint32_t index : indices)
+    result.AddIndex(index);
+
+  _subMesh = result;
+  return true;
+}
+
+//////////////////////////////////////////////////
+std::vector<uint32_t> Ogre2MeshOptimizer::OptimizeVertexCache(
+    const std::vector<uint32_t> &_indices, unsigned int _vertexCount)
+{
+  const size_t triangleCount = _indices.size() / 3u;
+  if (triangleCount < 2u || _indices.size() % 3u != 0u ||
+      *std::max_element(_indices.begin(), _indices.end()) >= _vertexCount)
+  {
+    return _indices;
+  }
+
+  // triangles of every vertex. The live triangles of a vertex come first
+  // in its range.
+  std::vector<uint32_t> offsets(_vertexCount + 1u, 0u);
+  for (uint32_t index : _indices)
+    ++offsets[index + 1u];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<uint32_t> adjacency(_indices.size());
+  std::vector<uint32_t> live(_vertexCount, 0u);
+  for (size_t i = 0u; i < _indices.size(); ++i)
+  {
+    const uint32_t v = _indices[i];
+    adjacency[offsets[v] + live[v]++] = static_cast<uint32_t>(i / 3u);
+  }
+
+  std::vector<int> cachePos(_vertexCount, -1);
+  std::vector<double> vertexScores(_vertexCount);
+  for (unsigned int v = 0u; v < _vertexCount; ++v)
+    vertexScores[v] = VertexScore(-1, live[v]);
+
+  std::vector<double> triangleScores(triangleCount);
+  std::vector<bool> emitted(triangleCount, false);
+  size_t best = 0u;
+  for (size_t t = 0u; t < triangleCount; ++t)
+  {
+    triangleScores[t] = vertexScores[_indices[t * 3u]] +
+        vertexScores[_indices[t * 3u + 1u]] +
+        vertexScores[_indices[t * 3u + 2u]];
+    if (triangleScores[t] > triangleScores[best])
+      best = t;
+  }
+
+  std::vector<uint32_t> result;
+  result.reserve(_indices.size());
+  std::vector<uint32_t> cache;
+  std::vector<uint32_t> newCache;
+  size_t cursor = 0u;
+  for (size_t count = 0u; count < triangleCount; ++count)
+  {
+    // continue with the first triangle not emitted yet if no cached
+    // vertex has triangles left
+    if (best == triangleCount)
+    {
+      while (emitted[cursor])
+        ++cursor;
+      best = cursor;
+    }
+
+    emitted[best] = true;
+    newCache.clear();
+    for (size_t k = 0u; k < 3u; ++k)
+    {
+      const uint32_t v = _indices[best * 3u + k];
+      result.push_back(v);
+      newCache.push_back(v);
+
+      // move the triangle out of the live range of the vertex
+      const uint32_t begin = offsets[v];
+      const uint32_t end = begin + live[v];
+      auto it = std::find(adjacency.begin() + begin, adjacency.begin() + end,
+          static_cast<uint32_t>(best));
+      std::iter_swap(it, adjacency.begin() + end - 1u);
+      --live[v];
+    }
+    for (uint32_t v : cache)
+    {
+      if (std::find(newCache.begin(), newCache.begin() + 3u, v) ==
+          newCache.begin() + 3u)
+      {
+        newCache.push_back(v);
+      }
+    }
+
+    // rescore the vertices that moved in or out of the cache, then the
+    // triangles that use them
+    for (size_t i = 0u; i < newCache.size(); ++i)
+    {
+      const uint32_t v = newCache[i];
+      cachePos[v] = i < kModelCacheSize ? static_cast<int>(i) : -1;
+      vertexScores[v] = VertexScore(cachePos[v], live[v]);
+    }
+
+    best = triangleCount;
+    double bestScore = -1.0;
+    for (uint32_t v : newCache)
+    {
+      for (uint32_t i = offsets[v]; i < offsets[v] + live[v]; ++i)
+      {
+        const uint32_t t = adjacency[i];
+        triangleScores[t] = vertexScores[_indices[t * 3u]] +
+            vertexScores[_indices[t * 3u + 1u]] +
+            vertexScores[_indices[t * 3u + 2u]];
+        if (triangleScores[t] > bestScore)
+        {
+          bestScore = triangleScores[t];
+          best = t;
+        }
+      }
+    }
+
+    if (newCache.size() > kModelCacheSize)
+      newCache.resize(kModelCacheSize);
+    cache.swap(newCache);
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+double Ogre2MeshOptimizer::CacheMissRatio(
+    const std::vector<uint32_t> &_indices, unsigned int _cacheSize)
+{
+  const std::vector<uint8_t> misses = CacheMisses(_indices, _cacheSize);
+  if (misses.empty())
+    return 0.0;
+  const double total = std::accumulate(misses.begin(), misses.end(), 0.0);
+  return total / static_cast<double>(misses.size());
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2MESHOPTIMIZER_HH_
+#define GZ_RENDERING_OGRE2_OGRE2MESHOPTIMIZER_HH_
+
+#include <cstdint>
+#include <vector>
+
+#include <gz/common/SubMesh.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Reorders the vertices and triangles of submeshes for faster
+/// rendering, see MeshDescriptor::optimize. Meshes exported by authoring
+/// tools often duplicate vertices and list their triangles in an order
+/// that misses the post-transform vertex cache of the GPU.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2MeshOptimizer
+{
+  /// \brief Optimize a triangle list submesh in place: merge duplicate
+  /// vertices, reorder the triangles for the vertex cache and then for
+  /// less overdraw, and renumber the vertices in the order they are
+  /// fetched. The rendered result does not change.
+  /// \param[in,out] _subMesh Submesh to optimize
+  /// \return False if the submesh is left as it is, e.g. because it is not
+  /// a triangle list or has bone assignments
+  public: static bool Optimize(common::SubMesh &_subMesh);
+
+  /// \brief Reorder triangles for the post-transform vertex cache, with
+  /// Tom Forsyth's linear speed vertex cache optimization
+  /// \param[in] _indices Triangle list indices
+  /// \param[in] _vertexCount Number of vertices the indices refer to
+  /// \return Reordered indices, each triangle keeps its winding
+  public: static std::vector<uint32_t> OptimizeVertexCache(
+              const std::vector<uint32_t> &_indices,
+              unsigned int _vertexCount);
+
+  /// \brief Get the average number of vertices transformed per triangle
+  /// (ACMR) for a FIFO vertex cache
+  /// \param[in] _indices Triangle list indices
+  /// \param[in] _cacheSize Number of vertices in the cache
+  /// \return Average cache miss ratio, between 0.5 for the best meshes
+  /// and 3
+  public: static double CacheMissRatio(const std::vector<uint32_t> &_indices,
+              unsigned int _cacheSize = 16u);
+};
+}
+}
+}
+#endif
@@ -15,6 +15,9 @@
  *
  */
 
+#include <algorithm>
+#include <deque>
+
 #include "gz/rendering/ogre2/Ogre2NativeWindow.hh"
 
 #include "gz/rendering/ogre2/Ogre2Camera.hh"
@@ -28,6 +31,7 @@
 #include <Compositor/OgreCompositorWorkspace.h>
 #include <OgreRoot.h>
 #include <OgreWindow.h>
+#include <Vao/OgreVaoManager.h>
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #endif
@@ -40,7 +44,24 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2NativeWindowPrivate
 
   /// \brief The workspace used by Ogre2NativeWindow::Draw
   public: Ogre::CompositorWorkspace *workspace{ nullptr };
+
+  /// \brief Maximum number of frames in flight, 0 if unlimited
+  public: unsigned int maxFramesInFlight{ 0u };
+
+  /// \brief True to skip frames instead of waiting for the GPU
+  public: bool nonBlockingPresent{ false };
+
+  /// \brief Number of frames skipped by Draw
+  public: uint64_t skippedFrames{ 0u };
+
+  /// \brief Render system frames of the draws the GPU may not have
+  /// finished yet, oldest first
+  public: std::deque<uint32_t> framesInFlight;
   // clang-format on
+
+  /// \brief Make room for one more frame in flight
+  /// \return False if the frame must be skipped
+  public: bool AcquireFrame();
 };
 
 using namespace gz;
@@ -48,6 +69,35 @@ using namespace rendering;
 
 static const char *kWorkspaceName = "NativeWindow Copy";
 
+//////////////////////////////////////////////////
+bool Ogre2NativeWindowPrivate::AcquireFrame()
+{
+  if (this->maxFramesInFlight == 0u)
+    return true;
+
+  Ogre::VaoManager *vaoManager =
+    Ogre::Root::getSingleton().getRenderSystem()->getVaoManager();
+  while (!this->framesInFlight.empty() &&
+         vaoManager->isFrameFinished(this->framesInFlight.front()))
+  {
+    this->framesInFlight.pop_front();
+  }
+
+  if (this->framesInFlight.size() >= this->maxFramesInFlight)
+  {
+    if (this->nonBlockingPresent)
+    {
+      ++this->skippedFrames;
+      return false;
+    }
+    vaoManager->waitForSpecificFrameToFinish(this->framesInFlight.front());
+    this->framesInFlight.pop_front();
+  }
+
+  this->framesInFlight.push_back(vaoManager->getFrameCount());
+  return true;
+}
+
 //////////////////////////////////////////////////
 Ogre2NativeWindow::Ogre2NativeWindow(Ogre::Window *_window) :
   dataPtr(new Ogre2NativeWindowPrivate)
@@ -148,6 +198,10 @@ void Ogre2NativeWindow::Draw(CameraPtr _camera)
     return;
   }
 
+  // presenting must not wait for the GPU when it is told not to
+  if (!this->dataPtr->AcquireFrame())
+    return;
+
   Ogre2RenderTargetPtr renderTarget = camera->renderTexture;
 
   Ogre2Scene *scene = dynamic_cast<Ogre2Scene *>(camera->Scene().get());
@@ -199,3 +253,49 @@ void Ogre2NativeWindow::Draw(CameraPtr _camera)
     scene->FlushGpuCommandsAndStartNewFrame(1u, true);
   }
 }
+
+//////////////////////////////////////////////////
+void Ogre2NativeWindow::SetSwapInterval(unsigned int _interval)
+{
+  this->dataPtr->window->setVSync(_interval > 0u, std::max(_interval, 1u));
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2NativeWindow::SwapInterval() const
+{
+  if (!this->dataPtr->window->getVSync())
+    return 0u;
+  return this->dataPtr->window->getVSyncInterval();
+}
+
+//////////////////////////////////////////////////
+void Ogre2NativeWindow::SetMaxFramesInFlight(unsigned int _frames)
+{
+  this->dataPtr->maxFramesInFlight = _frames;
+  if (_frames == 0u)
+    this->dataPtr->framesInFlight.clear();
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2NativeWindow::MaxFramesInFlight() const
+{
+  return this->dataPtr->maxFramesInFlight;
+}
+
+//////////////////////////////////////////////////
+void Ogre2NativeWindow::SetNonBlockingPresent(bool _nonBlocking)
+{
+  this->dataPtr->nonBlockingPresent = _nonBlocking;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2NativeWindow::NonBlockingPresent() const
+{
+  return this->dataPtr->nonBlockingPresent;
+}
+
+//////////////////////////////////////////////////
+uint64_t Ogre2NativeWindow::SkippedFrameCount() const
+{
+  return this->dataPtr->skippedFrames;
+}
@@ -75,6 +75,7 @@ void Ogre2Node::Destroy()
     Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
     if (nullptr != ogreSceneManager)
       ogreSceneManager->destroySceneNode(this->ogreNode);
+    this->scene->SetSceneGraphDirty();
   }
   this->ogreNode = nullptr;
 }
@@ -101,7 +102,7 @@ math::Vector3d Ogre2Node::RawLocalPosition() const
   if (nullptr == this->ogreNode)
     return math::Vector3d();
 
-  return Ogre2Conversions::Convert(this->ogreNode->getPosition());
+  return this->position;
 }
 
 //////////////////////////////////////////////////
@@ -120,7 +121,29 @@ void Ogre2Node::SetRawLocalPosition(const math::Vector3d &_position)
           << "1e9 from origin" << std::endl;
     return;
   }
-  this->ogreNode->setPosition(Ogre2Conversions::Convert(_position));
+  this->position = _position;
+  this->UpdateRenderPosition();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Node::UpdateRenderPosition()
+{
+  if (nullptr == this->ogreNode || nullptr == this->scene)
+    return;
+
+  // the root visual is the only node whose Ogre node is attached to the
+  // root scene node of Ogre
+  math::Vector3d pos = this->position;
+  Ogre::Node *ogreParent = this->ogreNode->getParent();
+  Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreParent && ogreSceneManager &&
+      ogreParent->getParent() == ogreSceneManager->getRootSceneNode())
+  {
+    pos -= this->scene->RenderOrigin();
+  }
+
+  this->ogreNode->setPosition(Ogre2Conversions::Convert(pos));
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -139,6 +162,7 @@ void Ogre2Node::SetRawLocalRotation(const math::Quaterniond &_rotation)
     return;
 
   this->ogreNode->setOrientation(Ogre2Conversions::Convert(_rotation));
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -215,6 +239,8 @@ bool Ogre2Node::AttachChild(NodePtr _child)
 
   derived->SetParent(this->SharedThis());
   this->ogreNode->addChild(derived->Node());
+  derived->UpdateRenderPosition();
+  this->scene->SetSceneGraphDirty();
   return true;
 }
 
@@ -234,6 +260,8 @@ bool Ogre2Node::DetachChild(NodePtr _child)
   }
 
   this->ogreNode->removeChild(derived->Node());
+  derived->UpdateRenderPosition();
+  this->scene->SetSceneGraphDirty();
 
   return true;
 }
@@ -270,6 +298,7 @@ void Ogre2Node::SetInheritScale(bool _inherit)
     return;
 
   this->ogreNode->setInheritScale(_inherit);
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -279,4 +308,5 @@ void Ogre2Node::SetLocalScaleImpl(const math::Vector3d &_scale)
     return;
 
   this->ogreNode->setScale(Ogre2Conversions::Convert(_scale));
+  this->scene->SetSceneGraphDirty();
 }
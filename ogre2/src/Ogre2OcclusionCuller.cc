@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Ogre2OcclusionCuller.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#include <OgreHlmsDatablock.h>
+#include <OgreItem.h>
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#include <OgreSubItem.h>
+#include <OgreViewport.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+namespace
+{
+/// \brief Width of the occlusion depth buffer in pixels. The height
+/// follows the aspect ratio of the camera.
+const unsigned int kDepthBufferWidth = 128u;
+
+/// \brief Maximum extent in texels of the region an AABB is tested against
+const int kMaxTestTexels = 4;
+
+/// \brief Name of the mesh of box geometries
+const char kBoxMeshName[] = "unit_box";
+
+/// \brief Vertex indices of the faces of a box, corners indexed by the
+/// bits x, y, z
+const int kBoxFaces[6][4] =
+{
+  {0, 2, 6, 4}, {1, 3, 7, 5},
+  {0, 1, 5, 4}, {2, 3, 7, 6},
+  {0, 1, 3, 2}, {4, 5, 7, 6}
+};
+
+/// \brief Signed area of the parallelogram spanned by two edges
+/// \param[in] _ax Horizontal coordinate of the first point
+/// \param[in] _ay Vertical coordinate of the first point
+/// \param[in] _bx Horizontal coordinate of the second point
+/// \param[in] _by Vertical coordinate of the second point
+/// \param[in] _px Horizontal coordinate of the tested point
+/// \param[in] _py Vertical coordinate of the tested point
+/// \return Positive if the point is to the left of the edge from a to b
+float Edge(float _ax, float _ay, float _bx, float _by, float _px, float _py)
+{
+  return (_bx - _ax) * (_py - _ay) - (_by - _ay) * (_px - _ax);
+}
+}
+
+//////////////////////////////////////////////////
+Ogre2OcclusionCuller::Ogre2OcclusionCuller(Ogre2Scene *_scene)
+  : scene(_scene)
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2OcclusionCuller::cameraPreRenderScene(Ogre::Camera *_cam)
+{
+  if (!this->scene || !this->scene->OcclusionCulling())
+    return;
+
+  const Ogre::Viewport *vp = _cam->getLastViewport();
+  if (!vp)
+    return;
+
+  // the opaque and transparent scene passes of a camera share the result
+  const uint32_t vpMask = vp->getVisibilityMask();
+  const unsigned long currFrame =
+      Ogre::Root::getSingleton().getNextFrameNumber();
+  const uint64_t currGeneration = this->scene->SceneGraphGeneration();
+  const Ogre::Matrix4 &currView = _cam->getViewMatrix(true);
+  const Ogre::Matrix4 &currProjection = _cam->getProjectionMatrix();
+  if (currFrame != this->frame || currGeneration != this->generation ||
+      vpMask != this->mask || currView != this->view ||
+      currProjection != this->projection)
+  {
+    this->frame = currFrame;
+    this->generation = currGeneration;
+    this->mask = vpMask;
+    this->view = currView;
+    this->projection = currProjection;
+    this->Build(_cam, vpMask);
+  }
+
+  for (Ogre::Item *item : this->occluded)
+  {
+    if (item->getVisible())
+    {
+      item->setVisible(false);
+      this->hidden.push_back(item);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2OcclusionCuller::cameraPostRenderScene(Ogre::Camera *)
+{
+  for (Ogre::Item *item : this->hidden)
+    item->setVisible(true);
+  this->hidden.clear();
+}
+
+//////////////////////////////////////////////////
+void Ogre2OcclusionCuller::Build(const Ogre::Camera *_cam, uint32_t _mask)
+{
+  this->occluded.clear();
+  this->nearClip = _cam->getNearClipDistance();
+
+  const float aspect = std::max(_cam->getAspectRatio(), 1e-3f);
+  this->width = kDepthBufferWidth;
+  this->height = std::max(1u, std::min(kDepthBufferWidth * 4u,
+      static_cast<unsigned int>(std::lround(this->width / aspect))));
+  this->pyramid.resize(1u);
+  this->pyramid[0].assign(this->width * this->height,
+      std::numeric_limits<float>::max());
+
+  // rasterize the occluders and collect the items to test
+  const uint32_t visibleMask =
+      _mask & Ogre::VisibilityFlags::RESERVED_VISIBILITY_FLAGS;
+  std::vector<Ogre::Item *> items;
+  auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itor.getNext());
+    if (!item->isAttached() || !item->getVisible() ||
+        !(item->getVisibilityFlags() & visibleMask))
+    {
+      continue;
+    }
+    items.push_back(item);
+
+    ProjectedVertex corners[8];
+    if (!IsOccluder(item) ||
+        !this->ProjectBox(item->getParentNode()->_getFullTransform(),
+        item->getLocalAabb(), corners))
+    {
+      continue;
+    }
+    for (const auto &face : kBoxFaces)
+    {
+      this->RasterizeTriangle(
+          corners[face[0]], corners[face[1]], corners[face[2]]);
+      this->RasterizeTriangle(
+          corners[face[0]], corners[face[2]], corners[face[3]]);
+    }
+  }
+  if (items.empty())
+  {
+    this->scene->RecordOcclusionCulling(0u, 0u);
+    return;
+  }
+
+  this->BuildPyramid();
+  for (Ogre::Item *item : items)
+  {
+    if (this->IsOccluded(item->getWorldAabb()))
+      this->occluded.push_back(item);
+  }
+  this->scene->RecordOcclusionCulling(items.size(), this->occluded.size());
+}
+
+//////////////////////////////////////////////////
+bool Ogre2OcclusionCuller::ProjectBox(const Ogre::Matrix4 &_transform,
+    const Ogre::Aabb &_box, ProjectedVertex _corners[8]) const
+{
+  if (!std::isfinite(_box.mHalfSize.x) || !std::isfinite(_box.mHalfSize.y) ||
+      !std::isfinite(_box.mHalfSize.z))
+  {
+    return false;
+  }
+
+  const Ogre::Matrix4 toView = this->view * _transform;
+  for (unsigned int i = 0u; i < 8u; ++i)
+  {
+    const Ogre::Vector3 local = _box.mCenter + _box.mHalfSize *
+        Ogre::Vector3((i & 1u) ? 1.0f : -1.0f, (i & 2u) ? 1.0f : -1.0f,
+        (i & 4u) ? 1.0f : -1.0f);
+    const Ogre::Vector4 viewPos = toView * Ogre::Vector4(local);
+    const float depth = -viewPos.z;
+    // clipping against the near plane is not worth it for a conservative
+    // test, boxes crossing it are skipped as occluders and never culled
+    if (!(depth > this->nearClip))
+      return false;
+
+    const Ogre::Vector4 clip = this->projection * viewPos;
+    if (!(clip.w > 0.0f))
+      return false;
+    _corners[i].x = (clip.x / clip.w * 0.5f + 0.5f) * this->width;
+    _corners[i].y = (0.5f - clip.y / clip.w * 0.5f) * this->height;
+    _corners[i].depth = depth;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2OcclusionCuller::RasterizeTriangle(const ProjectedVertex &_a,
+    const ProjectedVertex &_b, const ProjectedVertex &_c)
+{
+  const float area = Edge(_a.x, _a.y, _b.x, _b.y, _c.x, _c.y);
+  if (std::abs(area) < 1e-6f)
+    return;
+  const float sign = area > 0.0f ? 1.0f : -1.0f;
+
+  const int minX = std::max(0,
+      static_cast<int>(std::floor(std::min({_a.x, _b.x, _c.x}))));
+  const int minY = std::max(0,
+      static_cast<int>(std::floor(std::min({_a.y, _b.y, _c.y}))));
+  const int maxX = std::min(static_cast<int>(this->width) - 1,
+      static_cast<int>(std::ceil(std::max({_a.x, _b.x, _c.x}))) - 1);
+  const int maxY = std::min(static_cast<int>(this->height) - 1,
+      static_cast<int>(std::ceil(std::max({_a.y, _b.y, _c.y}))) - 1);
+
+  // the farthest vertex keeps the depth conservative without interpolating
+  const float depth = std::max({_a.depth, _b.depth, _c.depth});
+
+  // a pixel is covered only if all its corners are inside the triangle
+  auto inside = [&](float _px, float _py)
+  {
+    return sign * Edge(_a.x, _a.y, _b.x, _b.y, _px, _py) >= 0.0f &&
+        sign * Edge(_b.x, _b.y, _c.x, _c.y, _px, _py) >= 0.0f &&
+        sign * Edge(_c.x, _c.y, _a.x, _a.y, _px, _py) >= 0.0f;
+  };
+
+  std::vector<float> &buffer = this->pyramid[0];
+  for (int y = minY; y <= maxY; ++y)
+  {
+    const float y0 = static_cast<float>(y);
+    const float y1 = y0 + 1.0f;
+    for (int x = minX; x <= maxX; ++x)
+    {
+      const float x0 = static_cast<float>(x);
+      const float x1 = x0 + 1.0f;
+      if (!inside(x0, y0) || !inside(x1, y0) || !inside(x0, y1) ||
+          !inside(x1, y1))
+      {
+        continue;
+      }
+      float &texel = buffer[y * this->width + x];
+      texel = std::min(texel, depth);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2OcclusionCuller::BuildPyramid()
+{
+  this->levelSizes.clear();
+  this->levelSizes.emplace_back(this->width, this->height);
+  while (this->levelSizes.back().first > 1u ||
+      this->levelSizes.back().second > 1u)
+  {
+    const auto [srcWidth, srcHeight] = this->levelSizes.back();
+    const unsigned int dstWidth = (srcWidth + 1u) / 2u;
+    const unsigned int dstHeight = (srcHeight + 1u) / 2u;
+    const size_t srcLevel = this->levelSizes.size() - 1u;
+    if (this->pyramid.size() <= srcLevel + 1u)
+      this->pyramid.emplace_back();
+    this->pyramid[srcLevel + 1u].assign(dstWidth * dstHeight, 0.0f);
+
+    const std::vector<float> &src = this->pyramid[srcLevel];
+    std::vector<float> &dst = this->pyramid[srcLevel + 1u];
+    for (unsigned int y = 0u; y < srcHeight; ++y)
+    {
+      for (unsigned int x = 0u; x < srcWidth; ++x)
+      {
+        float &texel = dst[(y / 2u) * dstWidth + x / 2u];
+        texel = std::max(texel, src[y * srcWidth + x]);
+      }
+    }
+    this->levelSizes.emplace_back(dstWidth, dstHeight);
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2OcclusionCuller::IsOccluded(const Ogre::Aabb &_box) const
+{
+  ProjectedVertex corners[8];
+  if (!this->ProjectBox(Ogre::Matrix4::IDENTITY, _box, corners))
+    return false;
+
+  float minX = std::numeric_limits<float>::max();
+  float minY = minX;
+  float minDepth = minX;
+  float maxX = std::numeric_limits<float>::lowest();
+  float maxY = maxX;
+  for (const ProjectedVertex &corner : corners)
+  {
+    minX = std::min(minX, corner.x);
+    minY = std::min(minY, corner.y);
+    maxX = std::max(maxX, corner.x);
+    maxY = std::max(maxY, corner.y);
+    minDepth = std::min(minDepth, corner.depth);
+  }
+
+  // the part of the box outside of the view does not need to be hidden;
+  // boxes entirely outside are left to frustum culling
+  int x0 = std::max(0, static_cast<int>(std::floor(minX)));
+  int y0 = std::max(0, static_cast<int>(std::floor(minY)));
+  int x1 = std::min(static_cast<int>(this->width) - 1,
+      static_cast<int>(std::floor(maxX)));
+  int y1 = std::min(static_cast<int>(this->height) - 1,
+      static_cast<int>(std::floor(maxY)));
+  if (x0 > x1 || y0 > y1)
+    return false;
+
+  // descend to the level where the box covers a few texels
+  size_t level = 0u;
+  while (level + 1u < this->levelSizes.size() &&
+      (x1 - x0 >= kMaxTestTexels || y1 - y0 >= kMaxTestTexels))
+  {
+    x0 /= 2;
+    y0 /= 2;
+    x1 /= 2;
+    y1 /= 2;
+    ++level;
+  }
+
+  const std::vector<float> &depths = this->pyramid[level];
+  const unsigned int levelWidth = this->levelSizes[level].first;
+  for (int y = y0; y <= y1; ++y)
+  {
+    for (int x = x0; x <= x1; ++x)
+    {
+      if (depths[y * levelWidth + x] >= minDepth)
+        return false;
+    }
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2OcclusionCuller::IsOccluder(const Ogre::Item *_item)
+{
+  const Ogre::MeshPtr &mesh = _item->getMesh();
+  if (mesh.isNull() || mesh->getName() != kBoxMeshName)
+    return false;
+
+  for (size_t i = 0u; i < _item->getNumSubItems(); ++i)
+  {
+    const Ogre::HlmsDatablock *datablock =
+        _item->getSubItem(i)->getDatablock();
+    if (!datablock || datablock->getBlendblock()->mIsTransparent)
+      return false;
+  }
+  return true;
+}
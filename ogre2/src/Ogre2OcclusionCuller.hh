@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2OCCLUSIONCULLER_HH_
+#define GZ_RENDERING_OGRE2_OGRE2OCCLUSIONCULLER_HH_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Camera listener that hides the items occluded in the camera's
+/// view for the duration of each scene pass. See
+/// Scene::SetOcclusionCulling.
+///
+/// Opaque box items are rasterized into a coarse depth buffer, with the
+/// farthest depth of each triangle and only the pixels the triangle fully
+/// covers, and reduced into a max depth pyramid. An item is occluded if
+/// the depth pyramid is nearer than its world AABB everywhere the AABB
+/// projects to.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2OcclusionCuller :
+  public Ogre::Camera::Listener
+{
+  /// \brief Constructor
+  /// \param[in] _scene Scene the camera renders
+  public: explicit Ogre2OcclusionCuller(Ogre2Scene *_scene);
+
+  /// \brief Destructor
+  public: virtual ~Ogre2OcclusionCuller() = default;
+
+  /// \brief Hide the occluded items before the camera culls the scene
+  /// \param[in] _cam Camera about to render a scene pass
+  public: virtual void cameraPreRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Show the items hidden by cameraPreRenderScene again
+  /// \param[in] _cam Camera that rendered a scene pass
+  public: virtual void cameraPostRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Vertex projected to the depth buffer
+  private: struct ProjectedVertex
+  {
+    /// \brief Horizontal position in pixels
+    float x;
+
+    /// \brief Vertical position in pixels
+    float y;
+
+    /// \brief Distance along the view direction
+    float depth;
+  };
+
+  /// \brief Find the occluded items of a camera view
+  /// \param[in] _cam Camera
+  /// \param[in] _mask Visibility mask of the camera's viewport
+  private: void Build(const Ogre::Camera *_cam, uint32_t _mask);
+
+  /// \brief Project the corners of a box to the depth buffer
+  /// \param[in] _transform Transform from the box frame to world
+  /// \param[in] _box Box in its own frame
+  /// \param[out] _corners Projected corners, indexed by the bits x, y, z
+  /// \return False if a corner is not in front of the near plane
+  private: bool ProjectBox(const Ogre::Matrix4 &_transform,
+               const Ogre::Aabb &_box, ProjectedVertex _corners[8]) const;
+
+  /// \brief Rasterize a triangle into the depth buffer
+  /// \param[in] _a First vertex
+  /// \param[in] _b Second vertex
+  /// \param[in] _c Third vertex
+  private: void RasterizeTriangle(const ProjectedVertex &_a,
+               const ProjectedVertex &_b, const ProjectedVertex &_c);
+
+  /// \brief Build the depth pyramid from the depth buffer
+  private: void BuildPyramid();
+
+  /// \brief Check whether a world AABB is hidden behind the occluders
+  /// \param[in] _box World AABB
+  /// \return True if the box is occluded
+  private: bool IsOccluded(const Ogre::Aabb &_box) const;
+
+  /// \brief Check whether an item is used as an occluder
+  /// \param[in] _item Item to check
+  /// \return True if the item is an opaque box
+  private: static bool IsOccluder(const Ogre::Item *_item);
+
+  /// \brief Scene the camera renders
+  private: Ogre2Scene *scene = nullptr;
+
+  /// \brief View matrix of the last view the culled items were found for
+  private: Ogre::Matrix4 view = Ogre::Matrix4::ZERO;
+
+  /// \brief Projection matrix of the last view
+  private: Ogre::Matrix4 projection = Ogre::Matrix4::ZERO;
+
+  /// \brief Near clip distance of the last view
+  private: float nearClip = 0.0f;
+
+  /// \brief Visibility mask of the last view
+  private: uint32_t mask = 0u;
+
+  /// \brief Frame number of the last view
+  private: unsigned long frame = 0u;
+
+  /// \brief Scene graph generation of the last view
+  private: uint64_t generation = 0u;
+
+  /// \brief Width of the depth buffer in pixels
+  private: unsigned int width = 0u;
+
+  /// \brief Height of the depth buffer in pixels
+  private: unsigned int height = 0u;
+
+  /// \brief Max depth pyramid. Level 0 is the depth buffer, each further
+  /// level halves the resolution.
+  private: std::vector<std::vector<float>> pyramid;
+
+  /// \brief Size in pixels of every pyramid level
+  private: std::vector<std::pair<unsigned int, unsigned int>> levelSizes;
+
+  /// \brief Items occluded in the last view
+  private: std::vector<Ogre::Item *> occluded;
+
+  /// \brief Items hidden during the current scene pass
+  private: std::vector<Ogre::Item *> hidden;
+};
+}
+}
+}
+#endif
@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+// Note this include is placed in the src file because
+// otherwise ogre produces compile errors
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 5033)
+#endif
+#include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/ogre2/Ogre2Material.hh"
+#include "gz/rendering/ogre2/Ogre2OceanVisual.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreItem.h>
+#include <OgreMesh2.h>
+#include <OgreMeshManager2.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreSubItem.h>
+#include <OgreSubMesh2.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+class gz::rendering::Ogre2OceanVisualPrivate
+{
+  /// \brief Mesh holding the buffers
+  public: Ogre::MeshPtr mesh;
+
+  /// \brief Item rendering the mesh
+  public: Ogre::Item *item = nullptr;
+
+  /// \brief Vertex buffer, position and normal of each vertex
+  public: Ogre::VertexBufferPacked *vertexBuffer = nullptr;
+
+  /// \brief Vertices of the surface, kept to reuse the memory
+  public: std::vector<float> vertices;
+
+  /// \brief Material applied to the item
+  public: MaterialPtr appliedMaterial;
+
+  /// \brief Material created for visuals that are not given one
+  public: MaterialPtr defaultMaterial;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2OceanVisual::Ogre2OceanVisual()
+  : dataPtr(new Ogre2OceanVisualPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2OceanVisual::~Ogre2OceanVisual()
+{
+  // no ops
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::Init()
+{
+  BaseOceanVisual::Init();
+
+  // deep blue water with sharp reflections
+  MaterialPtr material = this->scene->CreateMaterial();
+  material->SetAmbient(0.0, 0.05, 0.1);
+  material->SetDiffuse(0.0, 0.15, 0.25);
+  material->SetSpecular(0.8, 0.8, 0.8);
+  material->SetRoughness(0.1f);
+  material->SetMetalness(0.0f);
+  material->SetCastShadows(false);
+  this->dataPtr->defaultMaterial = material;
+  this->SetMaterial(material, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::PreRender()
+{
+  BaseOceanVisual::PreRender();
+
+  if (this->gridDirty || this->surfaceDirty)
+    this->UpdateSurface();
+
+  MaterialPtr material = this->Material();
+  if (this->dataPtr->item && material != this->dataPtr->appliedMaterial)
+  {
+    Ogre2MaterialPtr derived =
+        std::dynamic_pointer_cast<Ogre2Material>(material);
+    if (derived)
+    {
+      this->dataPtr->item->getSubItem(0)->setDatablock(
+          derived->Datablock());
+      this->dataPtr->item->setCastShadows(derived->CastShadows());
+    }
+    this->dataPtr->appliedMaterial = material;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::Destroy()
+{
+  this->DestroySurface();
+  if (this->dataPtr->defaultMaterial && this->scene->IsInitialized())
+    this->scene->DestroyMaterial(this->dataPtr->defaultMaterial);
+  this->dataPtr->defaultMaterial.reset();
+  this->dataPtr->appliedMaterial.reset();
+  BaseOceanVisual::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::UpdateSurface()
+{
+  std::vector<float> &vertices = this->dataPtr->vertices;
+  vertices.resize(static_cast<size_t>(this->VertexCount()) * kVertexSize);
+  this->scene->ParallelForRows(this->RowCount(),
+      [&](unsigned int _begin, unsigned int _end)
+      {
+        this->BuildRows(_begin, _end, vertices.data());
+      }, 8u);
+  this->StitchRings(vertices.data());
+
+  if (this->gridDirty || !this->dataPtr->item)
+  {
+    this->DestroySurface();
+    this->CreateSurface();
+    this->gridDirty = false;
+  }
+  else
+  {
+    this->dataPtr->vertexBuffer->upload(vertices.data(), 0u,
+        this->VertexCount());
+  }
+  this->surfaceDirty = false;
+
+  if (!this->dataPtr->item)
+    return;
+
+  math::Vector3d minPt;
+  math::Vector3d maxPt;
+  this->Bounds(minPt, maxPt);
+  const Ogre::Aabb bounds = Ogre::Aabb::newFromExtents(
+      Ogre::Vector3(static_cast<Ogre::Real>(minPt.X()),
+                    static_cast<Ogre::Real>(minPt.Y()),
+                    static_cast<Ogre::Real>(minPt.Z())),
+      Ogre::Vector3(static_cast<Ogre::Real>(maxPt.X()),
+                    static_cast<Ogre::Real>(maxPt.Y()),
+                    static_cast<Ogre::Real>(maxPt.Z())));
+  this->dataPtr->mesh->_setBounds(bounds, false);
+  this->dataPtr->item->setLocalAabb(bounds);
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::CreateSurface()
+{
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  Ogre::VaoManager *vaoManager =
+      sceneManager->getDestinationRenderSystem()->getVaoManager();
+  if (!vaoManager)
+    return;
+
+  static unsigned int oceanMeshId = 0u;
+  this->dataPtr->mesh = Ogre::MeshManager::getSingleton().createManual(
+      "ocean_surface_" + std::to_string(oceanMeshId++),
+      Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+  Ogre::SubMesh *subMesh = this->dataPtr->mesh->createSubMesh();
+
+  // the layout of the rings only changes with SetGrid, so the triangles
+  // live in GPU memory for good while the vertices are uploaded whenever
+  // the waves move
+  std::vector<uint32_t> indices;
+  this->BuildIndices(indices);
+  Ogre::IndexBufferPacked *indexBuffer = vaoManager->createIndexBuffer(
+      Ogre::IndexBufferPacked::IT_32BIT, indices.size(), Ogre::BT_IMMUTABLE,
+      indices.data(), false);
+
+  Ogre::VertexElement2Vec vertexElements;
+  vertexElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_POSITION));
+  vertexElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_NORMAL));
+  this->dataPtr->vertexBuffer = vaoManager->createVertexBuffer(
+      vertexElements, this->VertexCount(), Ogre::BT_DEFAULT,
+      this->dataPtr->vertices.data(), false);
+
+  Ogre::VertexBufferPackedVec vertexBuffers;
+  vertexBuffers.push_back(this->dataPtr->vertexBuffer);
+  Ogre::VertexArrayObject *vao = vaoManager->createVertexArrayObject(
+      vertexBuffers, indexBuffer, Ogre::OperationType::OT_TRIANGLE_LIST);
+  subMesh->mVao[Ogre::VpNormal].push_back(vao);
+  subMesh->mVao[Ogre::VpShadow].push_back(vao);
+
+  this->dataPtr->item =
+      sceneManager->createItem(this->dataPtr->mesh, Ogre::SCENE_DYNAMIC);
+  this->ogreNode->attachObject(this->dataPtr->item);
+  this->dataPtr->appliedMaterial.reset();
+
+  // new items are visible with all flags set
+  this->SetVisibilityFlags(this->visibilityFlags);
+  this->SetVisible(this->visible);
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2OceanVisual::DestroySurface()
+{
+  if (!this->dataPtr->mesh)
+    return;
+
+  if (this->scene->IsInitialized())
+  {
+    Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+    Ogre::VaoManager *vaoManager =
+        sceneManager->getDestinationRenderSystem()->getVaoManager();
+    if (this->dataPtr->item)
+    {
+      if (this->ogreNode)
+        this->ogreNode->detachObject(this->dataPtr->item);
+      sceneManager->destroyItem(this->dataPtr->item);
+    }
+    Ogre::SubMesh *subMesh = this->dataPtr->mesh->getSubMesh(0);
+    if (vaoManager && !subMesh->mVao[Ogre::VpNormal].empty())
+      subMesh->destroyVaos(subMesh->mVao[Ogre::VpNormal], vaoManager);
+    subMesh->mVao[Ogre::VpShadow].clear();
+    Ogre::MeshManager::getSingleton().remove(
+        this->dataPtr->mesh->getName());
+  }
+  this->dataPtr->item = nullptr;
+  this->dataPtr->vertexBuffer = nullptr;
+  this->dataPtr->mesh.setNull();
+}
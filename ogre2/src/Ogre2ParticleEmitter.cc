@@ -15,6 +15,9 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+
 // Note this include is placed in the src file because
 // otherwise ogre produces compile errors
 #ifdef _MSC_VER
@@ -38,6 +41,13 @@ using namespace rendering;
 
 const uint32_t Ogre2ParticleEmitter::kParticleVisibilityFlags = 0x00100000;
 
+/// \brief Largest particle pool that is still sorted and culled per
+/// particle. Also the minimum pool size.
+static const size_t kSortedParticleQuota = 5000u;
+
+/// \brief Largest particle pool of an emitter
+static const size_t kMaxParticleQuota = 250000u;
+
 class gz::rendering::Ogre2ParticleEmitterPrivate
 {
   /// \brief Internal material name.
@@ -104,6 +114,7 @@ void Ogre2ParticleEmitter::Destroy()
     this->scene->OgreSceneManager()->destroyParticleSystem(
         this->dataPtr->ps);
     this->dataPtr->ps = nullptr;
+    this->scene->ParticleSystemDestroyed();
   }
 
   if (this->dataPtr->materialUnlit)
@@ -131,6 +142,7 @@ void Ogre2ParticleEmitter::SetType(
   this->type = _type;
 
   this->dataPtr->emitterDirty = true;
+  this->SetPreRenderDirty();
   // Call PreRender to re-create the particle emitter
   this->PreRender();
 }
@@ -207,6 +219,7 @@ void Ogre2ParticleEmitter::SetRate(double _rate)
   this->dataPtr->emitter->setEmissionRate(_rate);
 
   this->rate = _rate;
+  this->UpdateParticleQuota();
 }
 
 //////////////////////////////////////////////////
@@ -241,6 +254,7 @@ void Ogre2ParticleEmitter::SetParticleSize(
   this->particleSize = _size;
 
   this->dataPtr->emitterDirty = true;
+  this->SetPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -257,6 +271,7 @@ void Ogre2ParticleEmitter::SetLifetime(double _lifetime)
   this->dataPtr->emitter->setTimeToLive(_lifetime);
 
   this->lifetime = _lifetime;
+  this->UpdateParticleQuota();
 }
 
 //////////////////////////////////////////////////
@@ -473,12 +488,11 @@ void Ogre2ParticleEmitter::CreateParticleSystem()
 {
   // Instantiate the particle system and default parameters.
   this->dataPtr->ps = this->scene->OgreSceneManager()->createParticleSystem();
+  this->scene->ParticleSystemCreated();
   this->dataPtr->ps->getUserObjectBindings().setUserAny(
-      Ogre::Any(this->Id()));
+      Ogre::Any(this->CompactId()));
 
-  this->dataPtr->ps->setCullIndividually(true);
-  this->dataPtr->ps->setParticleQuota(5000);
-  this->dataPtr->ps->setSortingEnabled(true);
+  this->UpdateParticleQuota();
 
   this->dataPtr->ps->setVisibilityFlags(kParticleVisibilityFlags);
 
@@ -507,3 +521,27 @@ void Ogre2ParticleEmitter::CreateParticleSystem()
   this->ogreNode->attachObject(this->dataPtr->ps);
   gzdbg << "Particle emitter initialized" << std::endl;
 }
+
+//////////////////////////////////////////////////
+void Ogre2ParticleEmitter::UpdateParticleQuota()
+{
+  if (!this->dataPtr->ps)
+    return;
+
+  // Enough particles for a full lifetime of emission, with some headroom
+  // for the randomness of the emission
+  const double alive = std::ceil(this->rate * this->lifetime * 1.1);
+  const size_t quota = alive >= static_cast<double>(kMaxParticleQuota) ?
+      kMaxParticleQuota :
+      std::max(kSortedParticleQuota, static_cast<size_t>(alive));
+  if (quota == this->dataPtr->ps->getParticleQuota())
+    return;
+
+  this->dataPtr->ps->setParticleQuota(quota);
+
+  // Sorting and culling every particle is what pins the CPU with dense
+  // effects, and blending many small particles makes the order irrelevant
+  const bool dense = quota > kSortedParticleQuota;
+  this->dataPtr->ps->setSortingEnabled(!dense);
+  this->dataPtr->ps->setCullIndividually(!dense);
+}
@@ -42,85 +42,86 @@ Ogre2ParticleNoiseListener::Ogre2ParticleNoiseListener(
 void Ogre2ParticleNoiseListener::cameraPreRenderScene(
     Ogre::Camera * _cam)
 {
-  // the code here is responsible for setting the depth variation of readings
-  // returned by sensor in areas where particles are. It does so by adding
-  // noise with high std dev values.
-  // 1. Find first particle in the view of the sensor
-  // 2. Set the sensor noise for the particles to half the size of the
-  // bounding box
-  // \todo(anyone) noise std dev is set based on the first particle emitter the
-  // sensor sees. Make this scale to multiple particle emitters!
+  Ogre2ParticleNoiseListener::SetupMaterial(
+      this->ogreMaterial->getTechnique(0)->getPass(0), this->scene, _cam);
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticleNoiseListener::SetupMaterial(Ogre::Pass *_pass,
+                                               Ogre2ScenePtr _scene,
+                                               Ogre::Camera *_cam)
+{
+  if (!_scene->HasParticleSystems())
+    return;
+  _scene->ParticleNoise()->Apply(_pass, _cam);
+}
+
+//////////////////////////////////////////////////
+Ogre2ParticleNoise::Ogre2ParticleNoise(Ogre2Scene *_scene)
+  : scene(_scene)
+{
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticleNoise::NextFrame()
+{
+  this->gathered = false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ParticleNoise::Gather()
+{
+  this->sources.clear();
+  this->rnd = static_cast<float>(gz::math::Rand::DblUniform(0.0, 1.0));
+  this->gathered = true;
+
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME);
   while (itor.hasMoreElements())
   {
-    Ogre::MovableObject *object = itor.peekNext();
+    Ogre::MovableObject *object = itor.getNext();
     Ogre::ParticleSystem *ps = dynamic_cast<Ogre::ParticleSystem *>(object);
-
     if (!ps)
-    {
-      itor.moveNext();
       continue;
-    }
 
     Ogre::Aabb aabb = ps->getWorldAabbUpdated();
     if (std::isinf(aabb.getMinimum().length()) ||
         std::isinf(aabb.getMaximum().length()))
     {
-      itor.moveNext();
       continue;
     }
 
-    Ogre::AxisAlignedBox box = Ogre::AxisAlignedBox(aabb.getMinimum(),
-        aabb.getMaximum());
+    Source source;
+    source.box = Ogre::AxisAlignedBox(aabb.getMinimum(), aabb.getMaximum());
 
-    if (_cam->isVisible(box))
+    // set stddev to half of size of particle emitter aabb
+    source.stddev = static_cast<float>(source.box.getHalfSize().x * 0.5);
+
+    // get particle scatter ratio value from particle emitter user data
+    Ogre::Any userAny = ps->getUserObjectBindings().getUserAny();
+    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
     {
-      // set stddev to half of size of particle emitter aabb
-      auto hs = box.getHalfSize() * 0.5;
-      double particleStddev = hs.x;
-
-      Ogre::Pass *pass = this->ogreMaterial->getTechnique(0)->getPass(0);
-      Ogre::GpuProgramParametersSharedPtr psParams =
-          pass->getFragmentProgramParameters();
-      psParams->setNamedConstant("particleStddev",
-          static_cast<float>(particleStddev));
-      psParams->setNamedConstant("rnd",
-          static_cast<float>(gz::math::Rand::DblUniform(0.0, 1.0)));
-
-      // get particle scatter ratio value from particle emitter user data
-      // and pass that to the shaders
-      float scatterRatio = 0.65f;
-      Ogre::Any userAny = ps->getUserObjectBindings().getUserAny();
-      if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
+      VisualPtr result;
+      try
       {
-        VisualPtr result;
-        try
-        {
-          result = this->scene->VisualById(
-              Ogre::any_cast<unsigned int>(userAny));
-        }
-        catch(Ogre::Exception &e)
-        {
-          gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
-        }
-        Ogre2ParticleEmitterPtr emitterPtr =
-          std::dynamic_pointer_cast<Ogre2ParticleEmitter>(result);
-        if (emitterPtr)
-          scatterRatio = emitterPtr->ParticleScatterRatio();
+        result = this->scene->VisualByCompactId(
+            Ogre::any_cast<unsigned int>(userAny));
       }
-      psParams->setNamedConstant("particleScatterRatio", scatterRatio);
-
-      return;
+      catch(Ogre::Exception &e)
+      {
+        gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
+      }
+      Ogre2ParticleEmitterPtr emitterPtr =
+        std::dynamic_pointer_cast<Ogre2ParticleEmitter>(result);
+      if (emitterPtr)
+        source.scatterRatio = emitterPtr->ParticleScatterRatio();
     }
-    itor.moveNext();
+    this->sources.push_back(source);
   }
 }
 
 //////////////////////////////////////////////////
-void Ogre2ParticleNoiseListener::SetupMaterial(Ogre::Pass *_pass,
-                                               Ogre2ScenePtr _scene,
-                                               Ogre::Camera *_cam)
+void Ogre2ParticleNoise::Apply(Ogre::Pass *_pass, Ogre::Camera *_cam)
 {
   // the code here is responsible for setting the depth variation of readings
   // returned by sensor in areas where particles are. It does so by adding
@@ -130,67 +131,19 @@ void Ogre2ParticleNoiseListener::SetupMaterial(Ogre::Pass *_pass,
   // bounding box
   // \todo(anyone) noise std dev is set based on the first particle emitter the
   // sensor sees. Make this scale to multiple particle emitters!
-  auto itor = _scene->OgreSceneManager()->getMovableObjectIterator(
-    Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME);
-  while (itor.hasMoreElements())
-  {
-    Ogre::MovableObject *object = itor.peekNext();
-    Ogre::ParticleSystem *ps = dynamic_cast<Ogre::ParticleSystem *>(object);
+  if (!this->gathered)
+    this->Gather();
 
-    if (!ps)
-    {
-      itor.moveNext();
-      continue;
-    }
-
-    Ogre::Aabb aabb = ps->getWorldAabbUpdated();
-    if (std::isinf(aabb.getMinimum().length()) ||
-        std::isinf(aabb.getMaximum().length()))
-    {
-      itor.moveNext();
+  for (const Source &source : this->sources)
+  {
+    if (!_cam->isVisible(source.box))
       continue;
-    }
-
-    Ogre::AxisAlignedBox box = Ogre::AxisAlignedBox(aabb.getMinimum(),
-        aabb.getMaximum());
 
-    if (_cam->isVisible(box))
-    {
-      // set stddev to half of size of particle emitter aabb
-      auto hs = box.getHalfSize() * 0.5;
-      double particleStddev = hs.x;
-
-      Ogre::GpuProgramParametersSharedPtr psParams =
-          _pass->getFragmentProgramParameters();
-      psParams->setNamedConstant("particleStddev",
-          static_cast<float>(particleStddev));
-      psParams->setNamedConstant("rnd",
-          static_cast<float>(gz::math::Rand::DblUniform(0.0, 1.0)));
-
-      // get particle scatter ratio value from particle emitter user data
-      // and pass that to the shaders
-      float scatterRatio = 0.65f;
-      Ogre::Any userAny = ps->getUserObjectBindings().getUserAny();
-      if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
-      {
-        VisualPtr result;
-        try
-        {
-          result = _scene->VisualById(Ogre::any_cast<unsigned int>(userAny));
-        }
-        catch(Ogre::Exception &e)
-        {
-          gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
-        }
-        Ogre2ParticleEmitterPtr emitterPtr =
-          std::dynamic_pointer_cast<Ogre2ParticleEmitter>(result);
-        if (emitterPtr)
-          scatterRatio = emitterPtr->ParticleScatterRatio();
-      }
-      psParams->setNamedConstant("particleScatterRatio", scatterRatio);
-
-      return;
-    }
-    itor.moveNext();
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        _pass->getFragmentProgramParameters();
+    psParams->setNamedConstant("particleStddev", source.stddev);
+    psParams->setNamedConstant("rnd", this->rnd);
+    psParams->setNamedConstant("particleScatterRatio", source.scatterRatio);
+    return;
   }
 }
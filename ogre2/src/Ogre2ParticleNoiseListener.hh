@@ -17,12 +17,65 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2PARTICLENOISELISTENER_HH_
 #define GZ_RENDERING_OGRE2_OGRE2PARTICLENOISELISTENER_HH_
 
+#include <vector>
+
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+#include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
+
 namespace gz
 {
   namespace rendering
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
+    /// \brief Particle noise params of the particle systems of a scene,
+    /// gathered at most once per frame and shared by all the sensors that
+    /// render the frame. See Ogre2Scene::ParticleNoise.
+    class Ogre2ParticleNoise
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene whose particle systems are gathered
+      public: explicit Ogre2ParticleNoise(Ogre2Scene *_scene);
+
+      /// \brief Set the particle noise params of a pass for the first
+      /// particle system a camera sees
+      /// \param[in,out] _pass Ogre Pass to setup.
+      /// \param[in] _cam Ogre camera.
+      public: void Apply(Ogre::Pass *_pass, Ogre::Camera *_cam);
+
+      /// \brief Gather the particle systems again the next time the params
+      /// are applied. The scene calls it at the end of every frame.
+      public: void NextFrame();
+
+      /// \brief Gather the bounds and params of the particle systems
+      private: void Gather();
+
+      /// \brief Noise params of a particle system
+      private: struct Source
+      {
+        /// \brief World bounds of the particle system
+        Ogre::AxisAlignedBox box;
+
+        /// \brief Standard deviation of the noise
+        float stddev = 0.0f;
+
+        /// \brief Particle scatter ratio of the emitter
+        float scatterRatio = 0.65f;
+      };
+
+      /// \brief Scene whose particle systems are gathered
+      private: Ogre2Scene *scene = nullptr;
+
+      /// \brief Particle systems with finite bounds, in scene manager order
+      private: std::vector<Source> sources;
+
+      /// \brief Random value of the frame passed to the shaders
+      private: float rnd = 0.0f;
+
+      /// \brief True if the particle systems of the frame were gathered
+      private: bool gathered = false;
+    };
+
     /// \brief Helper class for updating particle noise params
     class Ogre2ParticleNoiseListener : public Ogre::Camera::Listener
     {
@@ -39,7 +92,8 @@ namespace gz
       private: virtual void cameraPreRenderScene(
           Ogre::Camera *_cam) override;
 
-      /// \brief Setups the material with particle noise params
+      /// \brief Setups the material with particle noise params. Does
+      /// nothing if the scene has no particle systems.
       /// \param[in,out] _pass Ogre Pass to setup.
       /// \param[in] _scene Scene.
       /// \param[in] _cam Ogre camera.
@@ -53,15 +107,6 @@ namespace gz
       /// \brief Pointer to ogre matieral with shaders for applying particle
       /// scattering effect to sensors
       private: Ogre::MaterialPtr ogreMaterial;
-
-      /// \brief Particle scatter ratio. This is used to determine the ratio of
-      /// particles that will be detected by sensors. Increasing the ratio
-      /// increases the scatter of the particles, which means there is a higher
-      /// chance of particles reflecting and interfering with depth sensing,
-      /// making the emitter appear more dense. Decreasing the ratio decreases
-      /// the scatter of the particles, making it appear less dense. This value
-      /// should be > 0.
-      private: float particleScatterRatio = 0.65f;
     };
     }
   }
@@ -0,0 +1,402 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef __APPLE__
+  #define GL_SILENCE_DEPRECATION
+  #include <OpenGL/gl.h>
+  #include <OpenGL/glext.h>
+#else
+#ifndef _WIN32
+  #include <GL/gl.h>
+#endif
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/ogre2/Ogre2Conversions.hh"
+#include "gz/rendering/ogre2/Ogre2PointCloudVisual.hh"
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgreMesh2.h>
+#include <OgreMeshManager2.h>
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreSubItem.h>
+#include <OgreSubMesh2.h>
+#include <OgreTechnique.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Number of bits of the index of a point within a chunk
+static const unsigned int kChunkBits = 20u;
+
+/// \brief Maximum number of points of a chunk
+static const unsigned int kChunkSize = 1u << kChunkBits;
+
+/// \brief A range of points with its own vertex buffer and bounds
+struct PointCloudChunk
+{
+  /// \brief Mesh holding the vertex buffer
+  Ogre::MeshPtr mesh;
+
+  /// \brief Item rendering the mesh
+  Ogre::Item *item = nullptr;
+
+  /// \brief Persistently mapped vertex buffer, 4 floats per point
+  Ogre::VertexBufferPacked *vertexBuffer = nullptr;
+
+  /// \brief Vertex array object drawing the vertex buffer
+  Ogre::VertexArrayObject *vao = nullptr;
+
+  /// \brief Number of points the vertex buffer holds, a power of two
+  unsigned int capacity = 0u;
+
+  /// \brief Number of points in the chunk
+  unsigned int count = 0u;
+
+  /// \brief Number of points drawn after decimation
+  unsigned int rendered = 0u;
+};
+
+class gz::rendering::Ogre2PointCloudVisualPrivate
+{
+  /// \brief Chunks of the cloud, in the order of the points
+  public: std::vector<PointCloudChunk> chunks;
+
+  /// \brief Material of the visual, cloned so the uniforms are not shared
+  /// with other point clouds
+  public: Ogre::MaterialPtr material;
+
+  /// \brief Number of points rendered after decimation
+  public: unsigned int renderedCount = 0u;
+};
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Reverse the lowest bits of a number
+/// \param[in] _value Value to reverse
+/// \param[in] _bits Number of bits to reverse
+/// \return _value with its lowest _bits bits in reverse order
+static uint32_t ReverseBits(uint32_t _value, unsigned int _bits)
+{
+  _value = ((_value >> 1) & 0x55555555u) | ((_value & 0x55555555u) << 1);
+  _value = ((_value >> 2) & 0x33333333u) | ((_value & 0x33333333u) << 2);
+  _value = ((_value >> 4) & 0x0F0F0F0Fu) | ((_value & 0x0F0F0F0Fu) << 4);
+  _value = ((_value >> 8) & 0x00FF00FFu) | ((_value & 0x00FF00FFu) << 8);
+  _value = (_value >> 16) | (_value << 16);
+  return _bits == 0u ? 0u : _value >> (32u - _bits);
+}
+
+//////////////////////////////////////////////////
+Ogre2PointCloudVisual::Ogre2PointCloudVisual()
+  : dataPtr(new Ogre2PointCloudVisualPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2PointCloudVisual::~Ogre2PointCloudVisual()
+{
+  // no ops
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Init()
+{
+  BasePointCloudVisual::Init();
+
+  // enable GL_PROGRAM_POINT_SIZE so we can set gl_PointSize in vertex shader
+  auto engine = Ogre2RenderEngine::Instance();
+  std::string renderSystemName =
+      engine->OgreRoot()->getRenderSystem()->getFriendlyName();
+  if (renderSystemName.find("OpenGL") != std::string::npos)
+  {
+#ifdef __APPLE__
+    glEnable(GL_VERTEX_PROGRAM_POINT_SIZE);
+#else
+#ifndef _WIN32
+    glEnable(GL_PROGRAM_POINT_SIZE);
+#endif
+#endif
+  }
+
+  const std::string matName = "PointCloudSplat";
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!mat)
+  {
+    gzerr << "Point cloud material not found: '" << matName << "'"
+          << std::endl;
+    return;
+  }
+  this->dataPtr->material = mat->clone(this->Name() + "_" + matName);
+  this->dataPtr->material->load();
+  this->materialDirty = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::PreRender()
+{
+  BasePointCloudVisual::PreRender();
+
+  if (!this->dataPtr->material)
+    return;
+
+  if (this->pointsDirty)
+  {
+    this->UploadPoints();
+    this->pointsDirty = false;
+    // the decimation depends on the size of the chunks
+    this->materialDirty = true;
+  }
+
+  if (this->materialDirty)
+  {
+    this->UpdateMaterial();
+    this->materialDirty = false;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Destroy()
+{
+  this->DestroyChunks(0u);
+  if (this->dataPtr->material)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->material->getName());
+    this->dataPtr->material.setNull();
+  }
+  BasePointCloudVisual::Destroy();
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2PointCloudVisual::RenderedPointCount() const
+{
+  // the decimation of pending changes is only known after PreRender
+  if (this->pointsDirty || this->materialDirty)
+    return BasePointCloudVisual::RenderedPointCount();
+  return this->dataPtr->renderedCount;
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::UploadPoints()
+{
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  Ogre::VaoManager *vaoManager =
+      sceneManager->getDestinationRenderSystem()->getVaoManager();
+  if (!vaoManager)
+    return;
+
+  const unsigned int pointCount = this->PointCount();
+  const size_t chunkCount = (pointCount + kChunkSize - 1u) / kChunkSize;
+  this->DestroyChunks(chunkCount);
+  this->dataPtr->chunks.resize(chunkCount);
+
+  static unsigned int chunkMeshId = 0u;
+  bool created = false;
+  for (size_t c = 0u; c < chunkCount; ++c)
+  {
+    PointCloudChunk &chunk = this->dataPtr->chunks[c];
+    const unsigned int first = static_cast<unsigned int>(c) * kChunkSize;
+    const unsigned int count = std::min(pointCount - first, kChunkSize);
+
+    unsigned int bits = 0u;
+    while ((1u << bits) < count)
+      ++bits;
+    const unsigned int capacity = 1u << bits;
+
+    // buffers are only reallocated when the chunk size changes
+    if (chunk.capacity != capacity)
+      this->DestroyChunk(c);
+
+    if (!chunk.item)
+    {
+      chunk.mesh = Ogre::MeshManager::getSingleton().createManual(
+          "point_cloud_chunk_" + std::to_string(chunkMeshId++),
+          Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+      Ogre::SubMesh *subMesh = chunk.mesh->createSubMesh();
+
+      // the 4th float holds the color or intensity bits and is decoded in
+      // the vertex shader, so points are uploaded in the layout they were
+      // given in. A persistent buffer is written without staging copies.
+      Ogre::VertexElement2Vec vertexElements;
+      vertexElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_FLOAT4, Ogre::VES_POSITION));
+      chunk.vertexBuffer = vaoManager->createVertexBuffer(vertexElements,
+          capacity, Ogre::BT_DYNAMIC_PERSISTENT, nullptr, false);
+      chunk.capacity = capacity;
+
+      Ogre::VertexBufferPackedVec vertexBuffers;
+      vertexBuffers.push_back(chunk.vertexBuffer);
+      chunk.vao = vaoManager->createVertexArrayObject(vertexBuffers,
+          nullptr, Ogre::OperationType::OT_POINT_LIST);
+      subMesh->mVao[Ogre::VpNormal].push_back(chunk.vao);
+      subMesh->mVao[Ogre::VpShadow].push_back(chunk.vao);
+      created = true;
+    }
+    chunk.count = count;
+
+    // points are written in bit reversed order of their index within the
+    // chunk, so that every prefix is evenly spread
+    Ogre::Vector3 minPt(std::numeric_limits<float>::max());
+    Ogre::Vector3 maxPt(-std::numeric_limits<float>::max());
+    const float *src = this->points.data() + static_cast<size_t>(first) * 4u;
+    float *dst = static_cast<float *>(chunk.vertexBuffer->map(0u, count));
+    size_t written = 0u;
+    for (uint32_t j = 0u; j < capacity; ++j)
+    {
+      const uint32_t index = ReverseBits(j, bits);
+      if (index >= count)
+        continue;
+      const float *pt = src + static_cast<size_t>(index) * 4u;
+      // copy the bits, the 4th float is not necessarily a valid number
+      std::memcpy(dst + written * 4u, pt, 4u * sizeof(float));
+      ++written;
+      if (std::isfinite(pt[0]) && std::isfinite(pt[1]) &&
+          std::isfinite(pt[2]))
+      {
+        minPt.makeFloor(Ogre::Vector3(pt[0], pt[1], pt[2]));
+        maxPt.makeCeil(Ogre::Vector3(pt[0], pt[1], pt[2]));
+      }
+    }
+    chunk.vertexBuffer->unmap(Ogre::UO_KEEP_PERSISTENT);
+
+    Ogre::Aabb bounds = Ogre::Aabb::BOX_NULL;
+    if (minPt.x <= maxPt.x)
+      bounds = Ogre::Aabb::newFromExtents(minPt, maxPt);
+    chunk.mesh->_setBounds(bounds, false);
+
+    if (!chunk.item)
+    {
+      chunk.item = sceneManager->createItem(chunk.mesh, Ogre::SCENE_DYNAMIC);
+      chunk.item->getSubItem(0)->setMaterial(this->dataPtr->material);
+      chunk.item->setCastShadows(false);
+      this->ogreNode->attachObject(chunk.item);
+    }
+    else
+    {
+      chunk.item->setLocalAabb(bounds);
+    }
+  }
+
+  // new items are visible with all flags set
+  if (created)
+  {
+    this->SetVisibilityFlags(this->visibilityFlags);
+    this->SetVisible(this->visible);
+  }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::UpdateMaterial()
+{
+  Ogre::GpuProgramParametersSharedPtr vsParams =
+      this->dataPtr->material->getTechnique(0)->getPass(0)->
+      getVertexProgramParameters();
+  vsParams->setNamedConstant("size",
+      static_cast<Ogre::Real>(this->pointSize));
+  vsParams->setNamedConstant("attenuation",
+      static_cast<Ogre::Real>(this->sizeAttenuation ? 1.0 : 0.0));
+  vsParams->setNamedConstant("maxPixelSize",
+      static_cast<Ogre::Real>(this->maxPixelSize));
+  vsParams->setNamedConstant("format",
+      static_cast<Ogre::Real>(this->format));
+  vsParams->setNamedConstant("intensityMin",
+      static_cast<Ogre::Real>(this->intensityMin));
+  vsParams->setNamedConstant("intensityMax",
+      static_cast<Ogre::Real>(this->intensityMax));
+  vsParams->setNamedConstant("lowColor",
+      Ogre2Conversions::Convert(this->intensityLowColor));
+  vsParams->setNamedConstant("highColor",
+      Ogre2Conversions::Convert(this->intensityHighColor));
+
+  // draw the same share of every chunk. The shares are rounded on the
+  // cumulative counts so they add up to the budget, except that every
+  // chunk draws at least one point.
+  const uint64_t total = this->PointCount();
+  const uint64_t budget =
+      (this->maxRenderedPointCount == 0u ||
+       this->maxRenderedPointCount >= total) ?
+      total : this->maxRenderedPointCount;
+  uint64_t begin = 0u;
+  this->dataPtr->renderedCount = 0u;
+  for (auto &chunk : this->dataPtr->chunks)
+  {
+    const uint64_t end = begin + chunk.count;
+    chunk.rendered = std::max(1u, static_cast<unsigned int>(
+        end * budget / total - begin * budget / total));
+    chunk.vao->setPrimitiveRange(0u, chunk.rendered);
+    this->dataPtr->renderedCount += chunk.rendered;
+    begin = end;
+  }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::DestroyChunks(size_t _first)
+{
+  for (size_t c = _first; c < this->dataPtr->chunks.size(); ++c)
+    this->DestroyChunk(c);
+  if (_first < this->dataPtr->chunks.size())
+    this->dataPtr->chunks.resize(_first);
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::DestroyChunk(size_t _index)
+{
+  PointCloudChunk &chunk = this->dataPtr->chunks[_index];
+  if (this->scene->IsInitialized())
+  {
+    Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+    Ogre::VaoManager *vaoManager =
+        sceneManager->getDestinationRenderSystem()->getVaoManager();
+    if (chunk.item)
+    {
+      if (this->ogreNode)
+        this->ogreNode->detachObject(chunk.item);
+      sceneManager->destroyItem(chunk.item);
+    }
+    if (chunk.mesh)
+    {
+      Ogre::SubMesh *subMesh = chunk.mesh->getSubMesh(0);
+      if (vaoManager && !subMesh->mVao[Ogre::VpNormal].empty())
+        subMesh->destroyVaos(subMesh->mVao[Ogre::VpNormal], vaoManager);
+      subMesh->mVao[Ogre::VpShadow].clear();
+      Ogre::MeshManager::getSingleton().remove(chunk.mesh->getName());
+    }
+  }
+  chunk = PointCloudChunk();
+}
@@ -15,18 +15,22 @@
  *
  */
 
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
+
+#include <gz/common/Image.hh>
 
-#include <OgreCamera.h>
 #include <OgreDecal.h>
+#include <OgreImage2.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreSceneNode.h>
 #include <OgreTextureGpuManager.h>
+#include <OgreViewport.h>
 
-#include "gz/rendering/ogre2/Ogre2Camera.hh"
-#include "gz/rendering/ogre2/Ogre2DepthCamera.hh"
 #include "gz/rendering/ogre2/Ogre2Projector.hh"
 #include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
@@ -38,35 +42,99 @@ namespace rendering
 {
 inline namespace GZ_RENDERING_VERSION_NAMESPACE {
 //
-/// \brief Helper class for checking visibility of projecter to a camera
-class Ogre2ProjectorCameraListener: public Ogre::Camera::Listener
+/// \brief Decals of all the projectors of a scene manager. Forward+ shades
+/// the decals of a pass from the single texture array set with
+/// Ogre::SceneManager::setDecalsDiffuse, so the textures of all projectors
+/// are slices of one texture pool, the decal atlas. A single scene manager
+/// listener shows each decal only in the passes whose visibility mask
+/// matches the projector's flags. It runs before the pass is culled, so
+/// hidden decals are left out when the decal clusters are built and the
+/// cost does not depend on the number of cameras.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2ProjectorDecals :
+  public Ogre::SceneManager::Listener
 {
-  /// \brief Constructor
-  /// \param[in] _decal Pointer to the ogre decal (projected texture)
-  public: Ogre2ProjectorCameraListener(Ogre::Decal *_decal);
-
-  //// \brief Set the visibility flags for this projector
-  /// \param[in] _flags Visibility flags to set
-  public: void SetVisibilityFlags(uint32_t _flags);
-
-  /// \brief Callback when a camara is about to be rendered
-  /// \param[in] _cam Ogre camera pointer which is about to render
-  private: virtual void cameraPreRenderScene(
-    Ogre::Camera * _cam) override;
-
-  /// \brief Callback when a camera is finisned being rendered
-  /// \param[in] _cam Ogre camera pointer which has already render
-  private: virtual void cameraPostRenderScene(
-    Ogre::Camera * _cam) override;
+  /// \brief Decal of a projector
+  public: struct Entry
+  {
+    /// \brief Scene node of the decal
+    Ogre::SceneNode *decalNode = nullptr;
 
-  /// \brief Projector's visibility flags
-  private: uint32_t visibilityFlags = 0u;
+    /// \brief Visibility flags of the projector
+    uint32_t visibilityFlags = GZ_VISIBILITY_ALL;
 
-  /// \brief Pointer to the decal ogre scene node
-  public: Ogre::SceneNode *decalNode{nullptr};
+    /// \brief True if the projector is enabled
+    bool enabled = false;
+  };
 
-  /// \brief Decal - Texture projected onto a surface
-  public: Ogre::Decal *decal{nullptr};
+  /// \brief Constructor
+  /// \param[in] _sceneManager Scene manager of the decals
+  public: explicit Ogre2ProjectorDecals(Ogre::SceneManager *_sceneManager);
+
+  /// \brief Destructor. Removes the listener and destroys the atlas
+  /// textures.
+  public: virtual ~Ogre2ProjectorDecals();
+
+  /// \brief Get the decals of a scene manager, creating them for its first
+  /// projector
+  /// \param[in] _sceneManager Scene manager
+  /// \return Decals shared by the projectors of the scene manager
+  public: static std::shared_ptr<Ogre2ProjectorDecals> Acquire(
+              Ogre::SceneManager *_sceneManager);
+
+  /// \brief Get the atlas slice of a texture file, loading it if no
+  /// projector uses it yet. The atlas has the size of the first texture
+  /// loaded, at most kMaxAtlasSize, and others are rescaled to it.
+  /// \param[in] _path Path to the texture file
+  /// \return Texture in the atlas, null if the file can not be loaded
+  public: Ogre::TextureGpu *Texture(const std::string &_path);
+
+  /// \brief Add the decal of a projector
+  /// \param[in] _entry Decal, which must stay valid until it is removed
+  public: void Add(Entry *_entry);
+
+  /// \brief Remove the decal of a projector
+  /// \param[in] _entry Decal
+  public: void Remove(Entry *_entry);
+
+  /// \brief Callback when a pass is about to be culled. Shows the decals
+  /// of the enabled projectors whose flags match the viewport's
+  /// visibility mask and hides the others.
+  /// \param[in] _source Scene manager of the pass
+  /// \param[in] _irs Illumination render stage
+  /// \param[in] _vp Viewport of the pass
+  private: virtual void preFindVisibleObjects(Ogre::SceneManager *_source,
+    Ogre::SceneManager::IlluminationRenderStage _irs,
+    Ogre::Viewport *_vp) override;
+
+  /// \brief Texture pool id of the atlas
+  private: static constexpr Ogre::uint32 kAtlasPoolId = 1u;
+
+  /// \brief Maximum width and height of the atlas
+  private: static constexpr unsigned int kMaxAtlasSize = 1024u;
+
+  /// \brief Number of slices, i.e. distinct projector textures, the atlas
+  /// is reserved with. Textures beyond it go to another pool, which
+  /// Forward+ can not shade in the same pass as the first one.
+  private: static constexpr Ogre::uint32 kAtlasSlices = 16u;
+
+  /// \brief Scene manager of the decals
+  private: Ogre::SceneManager *sceneManager = nullptr;
+
+  /// \brief Name of the scene manager, to check that it still exists when
+  /// the decals are destroyed
+  private: std::string sceneManagerName;
+
+  /// \brief Decals of the projectors
+  private: std::vector<Entry *> entries;
+
+  /// \brief Atlas textures, keyed by file path
+  private: std::map<std::string, Ogre::TextureGpu *> textures;
+
+  /// \brief Width of the atlas, 0 until the first texture is loaded
+  private: unsigned int atlasWidth = 0u;
+
+  /// \brief Height of the atlas
+  private: unsigned int atlasHeight = 0u;
 };
 }
 }
@@ -81,24 +149,19 @@ class gz::rendering::Ogre2Projector::Implementation
   /// \brief The decal ogre scene node
   public: Ogre::SceneNode *decalNode{nullptr};
 
-  /// \brief Decal diffuse texture
-  public: Ogre::TextureGpu *textureDiff{nullptr};
-
   /// \brief Decal - Texture projected onto a surface
   public: Ogre::Decal *decal{nullptr};
 
   /// \brief Indicate whether the projector is intialized or not
   public: bool initialized{false};
 
-  /// \brief A map of cameras (<Camera ptr, name>) that the listener has been
-  /// added to
-  public: std::unordered_map<Ogre::Camera *, Ogre::IdString>
-      camerasWithListener;
+  /// \brief Decals of the scene, which toggle the projector's visibility
+  /// for each pass. We are not using Ogre::Decal's setVisibilityFlags
+  /// because it does not seem to work.
+  public: std::shared_ptr<Ogre2ProjectorDecals> decals;
 
-  /// \brief Listener for togging projector visibility
-  /// We are using a custom listener because Ogre::Decal's setVisibilityFlags
-  /// does not seem to work
-  public: std::unique_ptr<Ogre2ProjectorCameraListener> listener;
+  /// \brief Decal of the projector in decals
+  public: Ogre2ProjectorDecals::Entry entry;
 };
 
 /////////////////////////////////////////////////
@@ -115,23 +178,10 @@ Ogre2Projector::~Ogre2Projector()
 
   this->SetEnabled(false);
 
-  for (const auto &ogreCamIt : this->dataPtr->camerasWithListener)
-  {
-    Ogre::IdString camName = ogreCamIt.second;
-    auto ogreCam = this->scene->OgreSceneManager()->findCameraNoThrow(camName);
-    if (ogreCam)
-      ogreCam->removeListener(this->dataPtr->listener.get());
-  }
-  this->dataPtr->camerasWithListener.clear();
-
-  if (this->dataPtr->textureDiff)
+  if (this->dataPtr->decals)
   {
-    auto engine = Ogre2RenderEngine::Instance();
-    auto ogreRoot = engine->OgreRoot();
-    auto textureGpuManager =
-        ogreRoot->getRenderSystem()->getTextureGpuManager();
-    textureGpuManager->destroyTexture(this->dataPtr->textureDiff);
-    this->dataPtr->textureDiff = nullptr;
+    this->dataPtr->decals->Remove(&this->dataPtr->entry);
+    this->dataPtr->decals.reset();
   }
   if (this->dataPtr->decal)
   {
@@ -148,6 +198,10 @@ Ogre2Projector::~Ogre2Projector()
 /////////////////////////////////////////////////
 void Ogre2Projector::PreRender()
 {
+  // visibility flags can change any time without marking the projector
+  // dirty
+  this->SetPreRenderDirty();
+
   if (!this->dataPtr->initialized)
   {
     this->CreateProjector();
@@ -155,79 +209,15 @@ void Ogre2Projector::PreRender()
     this->SetEnabled(true);
   }
 
-  this->UpdateCameraListener();
+  this->UpdateVisibilityListener();
 }
 
 /////////////////////////////////////////////////
-void Ogre2Projector::UpdateCameraListener()
+void Ogre2Projector::UpdateVisibilityListener()
 {
-  // if a custom visibility flag is set, we will need to use a listener
-  // for toggling the visibility of the decal
-  if ((this->VisibilityFlags() & GZ_VISIBILITY_ALL) == GZ_VISIBILITY_ALL)
-  {
-    this->dataPtr->decalNode->setVisible(true);
-    this->dataPtr->decalNode->getCreator()->setDecalsDiffuse(
-        this->dataPtr->decal->getDiffuseTexture());
-    this->dataPtr->decalNode->getCreator()->setDecalsEmissive(
-        this->dataPtr->decal->getEmissiveTexture());
-
-    for (auto &ogreCamIt : this->dataPtr->camerasWithListener)
-    {
-      Ogre::IdString camName = ogreCamIt.second;
-      // instead of getting the camera pointer through ogreCamIt.first,
-      // find camera pointer again to make sure the camera still exists
-      // because there is a chance that we are holding onto a dangling pointer
-      // if that camera was deleted already
-      auto ogreCam =
-          this->scene->OgreSceneManager()->findCameraNoThrow(camName);
-      ogreCam->removeListener(this->dataPtr->listener.get());
-    }
-    this->dataPtr->camerasWithListener.clear();
-    return;
-  }
-
-  if (!this->dataPtr->listener)
-  {
-    this->dataPtr->listener = std::make_unique<Ogre2ProjectorCameraListener>(
-        this->dataPtr->decal);
-  }
-  this->dataPtr->listener->SetVisibilityFlags(this->VisibilityFlags());
-  this->dataPtr->decalNode->setVisible(false);
-
-  // loop through color cameras and add listener to toggle visibility of
-  // decals in these cameras
-  for (unsigned int i = 0; i < this->scene->SensorCount(); ++i)
-  {
-    auto sensor = this->scene->SensorByIndex(i);
-    Ogre2CameraPtr camera = std::dynamic_pointer_cast<Ogre2Camera>(sensor);
-    if (camera)
-    {
-      auto ogreCam = camera->OgreCamera();
-      if (this->dataPtr->camerasWithListener.find(ogreCam)
-          == this->dataPtr->camerasWithListener.end())
-      {
-        ogreCam->addListener(this->dataPtr->listener.get());
-        this->dataPtr->camerasWithListener[ogreCam] = ogreCam->getName();
-      }
-    }
-    else
-    {
-      // depth camera can also generate rgb output (when simulating
-      // RGBD cameras)
-      Ogre2DepthCameraPtr depthCamera =
-          std::dynamic_pointer_cast<Ogre2DepthCamera>(sensor);
-      if (depthCamera)
-      {
-        auto ogreCam = depthCamera->OgreCamera();
-        if (this->dataPtr->camerasWithListener.find(ogreCam)
-            == this->dataPtr->camerasWithListener.end())
-        {
-          ogreCam->addListener(this->dataPtr->listener.get());
-          this->dataPtr->camerasWithListener[ogreCam] = ogreCam->getName();
-        }
-      }
-    }
-  }
+  // the decals' listener reads the flags before each pass is culled
+  this->dataPtr->entry.visibilityFlags = this->VisibilityFlags();
+  this->dataPtr->entry.enabled = this->IsEnabled();
 }
 
 /////////////////////////////////////////////////
@@ -240,45 +230,29 @@ void Ogre2Projector::CreateProjector()
   this->dataPtr->decal = this->scene->OgreSceneManager()->createDecal();
   this->dataPtr->decalNode->attachObject(this->dataPtr->decal);
 
-  if (common::isFile(this->textureName))
-  {
-    std::string baseName = common::basename(this->textureName);
-    size_t idx = this->textureName.rfind(baseName);
-    if (idx != std::string::npos)
-    {
-      std::string dirPath = this->textureName.substr(0, idx);
-      if (!dirPath.empty() &&
-          !Ogre::ResourceGroupManager::getSingleton().resourceLocationExists(
-          dirPath))
-      {
-        Ogre::ResourceGroupManager::getSingleton().addResourceLocation(
-            dirPath, "FileSystem", "General");
-      }
-    }
-  }
-  else
+  if (!common::isFile(this->textureName))
   {
     gzerr << "Unable to create projector. Projector texture not found: "
           << this->textureName << std::endl;
     return;
   }
 
-  auto engine = Ogre2RenderEngine::Instance();
-  auto ogreRoot = engine->OgreRoot();
-  Ogre::TextureGpuManager *textureManager =
-    ogreRoot->getRenderSystem()->getTextureGpuManager();
-  int decalDiffuseId = 1;
-  this->dataPtr->textureDiff = textureManager->createOrRetrieveTexture(
-      this->textureName, this->textureName + "_alias",
-      Ogre::GpuPageOutStrategy::Discard,
-      Ogre::CommonTextureTypes::Diffuse,
-      Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME,
-      decalDiffuseId);
-  this->dataPtr->textureDiff->scheduleTransitionTo(
-      Ogre::GpuResidency::Resident);
+  this->dataPtr->decals =
+      Ogre2ProjectorDecals::Acquire(this->scene->OgreSceneManager());
+  Ogre::TextureGpu *texture =
+      this->dataPtr->decals->Texture(this->textureName);
+  if (!texture)
+  {
+    gzerr << "Unable to create projector. Projector texture can not be "
+          << "loaded: " << this->textureName << std::endl;
+    this->dataPtr->decals.reset();
+    return;
+  }
 
-  this->dataPtr->decal->setDiffuseTexture(this->dataPtr->textureDiff);
-  this->dataPtr->decal->setEmissiveTexture(this->dataPtr->textureDiff);
+  this->dataPtr->decal->setDiffuseTexture(texture);
+  this->dataPtr->decal->setEmissiveTexture(texture);
+  this->dataPtr->entry.decalNode = this->dataPtr->decalNode;
+  this->dataPtr->decals->Add(&this->dataPtr->entry);
 
   // approximate frustum size
   common::Image image(this->textureName);
@@ -302,6 +276,7 @@ void Ogre2Projector::CreateProjector()
   this->dataPtr->decalNode->setPosition(
       Ogre::Vector3(this->nearClip + depth * 0.5, 0, 0));
   this->dataPtr->decalNode->setScale(width, depth, height);
+  this->scene->SetSceneGraphDirty();
 }
 
 /////////////////////////////////////////////////
@@ -309,41 +284,149 @@ void Ogre2Projector::SetEnabled(bool _enabled)
 {
   BaseProjector::SetEnabled(_enabled);
   this->SetVisible(_enabled);
+  this->dataPtr->entry.enabled = _enabled;
 }
 
 //////////////////////////////////////////////////
-void Ogre2ProjectorCameraListener::SetVisibilityFlags(uint32_t _flags)
+Ogre2ProjectorDecals::Ogre2ProjectorDecals(
+    Ogre::SceneManager *_sceneManager)
+  : sceneManager(_sceneManager),
+    sceneManagerName(_sceneManager->getName())
 {
-  this->visibilityFlags = _flags;
+  this->sceneManager->addListener(this);
 }
 
 //////////////////////////////////////////////////
-Ogre2ProjectorCameraListener::Ogre2ProjectorCameraListener(
-  Ogre::Decal *_decal)
+Ogre2ProjectorDecals::~Ogre2ProjectorDecals()
 {
-  this->decal = _decal;
-  this->decalNode = _decal->getParentSceneNode();;
+  auto root = Ogre2RenderEngine::Instance()->OgreRoot();
+  if (!root)
+    return;
+
+  if (root->hasSceneManager(this->sceneManagerName))
+  {
+    this->sceneManager->removeListener(this);
+    this->sceneManager->setDecalsDiffuse(nullptr);
+    this->sceneManager->setDecalsEmissive(nullptr);
+  }
+
+  Ogre::TextureGpuManager *textureMgr =
+      root->getRenderSystem()->getTextureGpuManager();
+  for (auto &texture : this->textures)
+    textureMgr->destroyTexture(texture.second);
 }
 
 //////////////////////////////////////////////////
-void Ogre2ProjectorCameraListener::cameraPreRenderScene(
-    Ogre::Camera *_cam)
+std::shared_ptr<Ogre2ProjectorDecals> Ogre2ProjectorDecals::Acquire(
+    Ogre::SceneManager *_sceneManager)
 {
-  uint32_t mask = _cam->getLastViewport()->getVisibilityMask();
-  if (this->visibilityFlags & mask && this->decalNode && this->decal)
+  static std::map<Ogre::SceneManager *, std::weak_ptr<Ogre2ProjectorDecals>>
+      decals;
+  for (auto it = decals.begin(); it != decals.end();)
   {
-    this->decalNode->setVisible(true);
-    this->decalNode->getCreator()->setDecalsDiffuse(
-        this->decal->getDiffuseTexture());
-    this->decalNode->getCreator()->setDecalsEmissive(
-        this->decal->getEmissiveTexture());
+    if (it->second.expired())
+      it = decals.erase(it);
+    else
+      ++it;
   }
+
+  std::shared_ptr<Ogre2ProjectorDecals> result =
+      decals[_sceneManager].lock();
+  if (!result)
+  {
+    result = std::make_shared<Ogre2ProjectorDecals>(_sceneManager);
+    decals[_sceneManager] = result;
+  }
+  return result;
 }
 
 //////////////////////////////////////////////////
-void Ogre2ProjectorCameraListener::cameraPostRenderScene(
-    Ogre::Camera * /*_cam*/)
+Ogre::TextureGpu *Ogre2ProjectorDecals::Texture(const std::string &_path)
 {
-  if (this->decalNode)
-    this->decalNode->setVisible(false);
+  auto it = this->textures.find(_path);
+  if (it != this->textures.end())
+    return it->second;
+
+  common::Image image(_path);
+  if (!image.Valid())
+    return nullptr;
+
+  Ogre::TextureGpuManager *textureMgr =
+      Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+      getTextureGpuManager();
+
+  // the first texture sets the size of the atlas
+  if (this->atlasWidth == 0u)
+  {
+    this->atlasWidth = std::min(image.Width(), kMaxAtlasSize);
+    this->atlasHeight = std::min(image.Height(), kMaxAtlasSize);
+    textureMgr->reservePoolId(kAtlasPoolId, this->atlasWidth,
+        this->atlasHeight, kAtlasSlices, 1u, Ogre::PFG_RGBA8_UNORM_SRGB);
+  }
+  if (image.Width() != this->atlasWidth ||
+      image.Height() != this->atlasHeight)
+  {
+    image.Rescale(static_cast<int>(this->atlasWidth),
+        static_cast<int>(this->atlasHeight));
+  }
+
+  // textures of the same size and format as the pool become its slices
+  Ogre::TextureGpu *texture = textureMgr->createOrRetrieveTexture(
+      _path + "_projector",
+      Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::AutomaticBatching |
+      Ogre::TextureFlags::ManualTexture,
+      Ogre::TextureTypes::Type2D,
+      Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME,
+      0u, kAtlasPoolId);
+  texture->setPixelFormat(Ogre::PFG_RGBA8_UNORM_SRGB);
+  texture->setNumMipmaps(1u);
+  texture->setResolution(this->atlasWidth, this->atlasHeight);
+  texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+  texture->waitForData();
+
+  std::vector<unsigned char> data = image.RGBAData();
+  Ogre::Image2 img;
+  img.loadDynamicImage(data.data(), false, texture);
+  img.uploadTo(texture, 0, 0);
+
+  // any texture of the pool binds the whole array
+  this->sceneManager->setDecalsDiffuse(texture);
+  this->sceneManager->setDecalsEmissive(texture);
+
+  this->textures[_path] = texture;
+  return texture;
+}
+
+//////////////////////////////////////////////////
+void Ogre2ProjectorDecals::Add(Entry *_entry)
+{
+  this->entries.push_back(_entry);
+}
+
+//////////////////////////////////////////////////
+void Ogre2ProjectorDecals::Remove(Entry *_entry)
+{
+  this->entries.erase(std::remove(this->entries.begin(),
+      this->entries.end(), _entry), this->entries.end());
+}
+
+//////////////////////////////////////////////////
+void Ogre2ProjectorDecals::preFindVisibleObjects(
+    Ogre::SceneManager * /*_source*/,
+    Ogre::SceneManager::IlluminationRenderStage /*_irs*/,
+    Ogre::Viewport *_vp)
+{
+  if (!_vp)
+    return;
+
+  const uint32_t mask = _vp->getVisibilityMask();
+  for (Entry *entry : this->entries)
+  {
+    // projectors without custom flags are visible to all cameras
+    const bool visible = entry->enabled &&
+        ((entry->visibilityFlags & GZ_VISIBILITY_ALL) == GZ_VISIBILITY_ALL ||
+        (entry->visibilityFlags & mask) != 0u);
+    entry->decalNode->setVisible(visible);
+  }
 }
@@ -15,6 +15,9 @@
  *
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Mesh.hh>
 #include <gz/common/MeshManager.hh>
@@ -31,6 +34,8 @@
 #include "gz/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 
+#include "Ogre2MeshBvh.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
@@ -73,11 +78,27 @@ class gz::rendering::Ogre2RayQueryPrivate
 
   //// \brief See RayQuery::SetPreferGpu
   public: bool preferGpu = true;
+
+  /// \brief One Ogre ray scene query per worker thread, used by
+  /// ClosestPoints to run the broadphase of many rays in parallel
+  public: std::vector<Ogre::RaySceneQuery *> batchQueries;
 };
 
 using namespace gz;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+/// \brief Get the id of the visual an Ogre item is tagged with
+/// \param[in] _scene Scene of the visual
+/// \param[in] _compactId Compact id stored in the item's user any, see
+/// Ogre2Visual::SetCompactId
+/// \return Id of the visual, 0 if there is none
+static unsigned int VisualId(const ScenePtr &_scene, unsigned int _compactId)
+{
+  VisualPtr visual = _scene ? _scene->VisualByCompactId(_compactId) : nullptr;
+  return visual ? visual->Id() : 0u;
+}
+
 //////////////////////////////////////////////////
 Ogre2RayQuery::Ogre2RayQuery()
     : dataPtr(new Ogre2RayQueryPrivate)
@@ -91,16 +112,20 @@ Ogre2RayQuery::~Ogre2RayQuery()
   if (!this->Scene()->IsInitialized())
     return;
 
+  Ogre2ScenePtr ogreScene =
+      std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!ogreScene)
+    return;
+
   if (this->dataPtr->rayQuery)
   {
-    Ogre2ScenePtr ogreScene =
-        std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
-    if (ogreScene)
-    {
-      ogreScene->OgreSceneManager()->destroyQuery(this->dataPtr->rayQuery);
-      this->dataPtr->rayQuery = nullptr;
-    }
+    ogreScene->OgreSceneManager()->destroyQuery(this->dataPtr->rayQuery);
+    this->dataPtr->rayQuery = nullptr;
   }
+
+  for (auto query : this->dataPtr->batchQueries)
+    ogreScene->OgreSceneManager()->destroyQuery(query);
+  this->dataPtr->batchQueries.clear();
 }
 
 //////////////////////////////////////////////////
@@ -127,7 +152,8 @@ void Ogre2RayQuery::SetFromCamera(const CameraPtr &_camera,
   Ogre::Ray ray = ogre2ObjectInterface->OgreCamera()->getCameraToViewportRay(
       screenPos.X(), screenPos.Y());
 
-  auto originMath = Ogre2Conversions::Convert(ray.getOrigin());
+  auto originMath = Ogre2Conversions::Convert(ray.getOrigin()) +
+      this->Scene()->RenderOrigin();
   if (originMath.IsFinite())
   {
     this->origin = originMath;
@@ -169,7 +195,8 @@ void Ogre2RayQuery::SetFromCamera(const WideAngleCameraPtr &_camera,
 
   Ogre::Ray ray = camera->CameraToViewportRay(screenPos, _faceIdx);
 
-  auto originMath = Ogre2Conversions::Convert(ray.getOrigin());
+  auto originMath = Ogre2Conversions::Convert(ray.getOrigin()) +
+      this->Scene()->RenderOrigin();
   if (originMath.IsFinite())
   {
     this->origin = originMath;
@@ -265,7 +292,8 @@ RayQueryResult Ogre2RayQuery::ClosestPointBySelectionBuffer()
           typeid(unsigned int))
       {
         auto userAny = ogreItem->getUserObjectBindings().getUserAny();
-        objectId = Ogre::any_cast<unsigned int>(userAny);
+        objectId = VisualId(this->Scene(),
+            Ogre::any_cast<unsigned int>(userAny));
       }
     }
     else
@@ -336,17 +364,27 @@ class GZ_RENDERING_OGRE2_HIDDEN ThreadedTriRay final
 };
 
 //////////////////////////////////////////////////
-void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
+/// \brief Triangle-level raycast over the broadphase results of one ray
+/// \param[in] _ogreResult Broadphase results of the ray
+/// \param[in] _rayOrigin Raycast's origin
+/// \param[in] _rayDir Raycast's direction
+/// \param[in] _threadId Index of the slice of triangles to test
+/// \param[in] _numThreads Number of slices the triangles are split into
+/// \return The closest match within the slice (it may be empty)
+static RayQueryResult IntersectTriangles(
+    const Ogre::RaySceneQueryResult &_ogreResult,
+    const Ogre::Vector3 &_rayOrigin, const Ogre::Vector3 &_rayDir,
+    unsigned int _threadId, unsigned int _numThreads)
 {
-  const unsigned int numThreads = static_cast<unsigned int>(_numThreads);
-  const unsigned int threadId = static_cast<unsigned int>(_threadId);
-
   double distance = std::numeric_limits<double>::max();
 
   RayQueryResult result;
 
+  // Number of submeshes tested with a BVH so far
+  unsigned int subMeshCounter = 0u;
+
   // Iterate over all the results.
-  for (auto iter = this->ogreResult.begin(); iter != this->ogreResult.end();
+  for (auto iter = _ogreResult.begin(); iter != _ogreResult.end();
        ++iter)
   {
     if (iter->distance <= 0.0)
@@ -386,13 +424,13 @@ void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
         Ogre::Matrix4 invTransform = transform.inverse();
         Ogre::Matrix3 invTransform3x3;
         invTransform.extract3x3Matrix(invTransform3x3);
-        mouseRay = Ogre::Ray(invTransform * this->rayOrigin,
-                             (invTransform3x3 * this->rayDir).normalisedCopy());
+        mouseRay = Ogre::Ray(invTransform * _rayOrigin,
+                             (invTransform3x3 * _rayDir).normalisedCopy());
       }
       else
 #endif
       {
-        mouseRay = Ogre::Ray(this->rayOrigin, this->rayDir);
+        mouseRay = Ogre::Ray(_rayOrigin, _rayDir);
       }
 
       // test for hitting individual triangles on the mesh
@@ -414,14 +452,28 @@ void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
 
         // Round up to next multiple of numThreads and divide by it
         unsigned int indexCountPerThread =
-          (indexCount + (numThreads - 1u)) / numThreads;
+          (indexCount + (_numThreads - 1u)) / _numThreads;
         // indexCountPerThread must be multiple of 3
         indexCountPerThread = ((indexCountPerThread + 2u) / 3u) * 3u;
 
         unsigned int indexStart =
-          std::min(indexCountPerThread * threadId, indexCount);
+          std::min(indexCountPerThread * _threadId, indexCount);
         unsigned int indexEnd =
-          std::min(indexCountPerThread * (threadId + 1u), indexCount);
+          std::min(indexCountPerThread * (_threadId + 1u), indexCount);
+
+#ifndef SLOW_METHOD
+        if (bIsAffine)
+        {
+          // The ray is in mesh-local space so the cached BVH of the submesh
+          // can be used. It makes splitting the triangles of one submesh
+          // across threads unnecessary, so whole submeshes are distributed
+          // across threads instead.
+          if (subMeshCounter % _numThreads == _threadId)
+            bestHit = Ogre2MeshBvh::Acquire(submesh)->Intersect(mouseRay);
+          ++subMeshCounter;
+          indexEnd = indexStart;
+        }
+#endif
 
         for (unsigned int k = indexStart; k < indexEnd; k += 3)
         {
@@ -485,13 +537,22 @@ void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
             result.point =
               Ogre2Conversions::Convert(mouseRay.getPoint(distance));
           }
+          // compact id, resolved to the visual id by the caller
           result.objectId = Ogre::any_cast<unsigned int>(userAny);
         }
       }
     }
   }
 
-  collectedResults[_threadId] = result;
+  return result;
+}
+
+//////////////////////////////////////////////////
+void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
+{
+  this->collectedResults[_threadId] = IntersectTriangles(this->ogreResult,
+      this->rayOrigin, this->rayDir, static_cast<unsigned int>(_threadId),
+      static_cast<unsigned int>(_numThreads));
 }
 
 //////////////////////////////////////////////////
@@ -511,6 +572,134 @@ RayQueryResult ThreadedTriRay::CollapseCollectedResults()
   return result;
 }
 
+//////////////////////////////////////////////////
+
+/// \brief This class performs Triangle-level raycasts for a batch of rays,
+/// spreading the rays across multiple threads. Each thread runs the
+/// broadphase of its rays with its own Ogre ray scene query.
+class GZ_RENDERING_OGRE2_HIDDEN ThreadedBatchTriRay final
+  : public Ogre::UniformScalableTask
+{
+  /// \brief Ray origins
+  private: const std::vector<math::Vector3d> &origins;
+
+  /// \brief Ray directions
+  private: const std::vector<math::Vector3d> &directions;
+
+  /// \brief One ray scene query per thread
+  private: const std::vector<Ogre::RaySceneQuery *> &queries;
+
+  /// \brief Result of every ray
+  public: std::vector<RayQueryResult> results;
+
+  /// \brief Constructor
+  /// \param[in] _origins Ray origins
+  /// \param[in] _directions Ray directions
+  /// \param[in] _queries One ray scene query per worker thread
+  public: ThreadedBatchTriRay(
+              const std::vector<math::Vector3d> &_origins,
+              const std::vector<math::Vector3d> &_directions,
+              const std::vector<Ogre::RaySceneQuery *> &_queries)
+      : origins(_origins), directions(_directions), queries(_queries)
+  {
+    this->results.resize(_origins.size());
+  }
+
+  // Documentation inherited
+  public: void execute(size_t _threadId, size_t _numThreads) override
+  {
+    const size_t count = this->origins.size();
+    const size_t countPerThread = (count + (_numThreads - 1u)) / _numThreads;
+    const size_t start = std::min(countPerThread * _threadId, count);
+    const size_t end = std::min(countPerThread * (_threadId + 1u), count);
+
+    Ogre::RaySceneQuery *query = this->queries[_threadId];
+    for (size_t i = start; i < end; ++i)
+    {
+      const Ogre::Vector3 rayOrigin =
+          Ogre2Conversions::Convert(this->origins[i]);
+      const Ogre::Vector3 rayDir =
+          Ogre2Conversions::Convert(this->directions[i]);
+      query->setRay(Ogre::Ray(rayOrigin, rayDir));
+      const Ogre::RaySceneQueryResult &ogreResult = query->execute();
+      this->results[i] =
+          IntersectTriangles(ogreResult, rayOrigin, rayDir, 0u, 1u);
+    }
+  }
+};
+
+//////////////////////////////////////////////////
+std::vector<RayQueryResult> Ogre2RayQuery::ClosestPoints(
+    const std::vector<math::Vector3d> &_origins,
+    const std::vector<math::Vector3d> &_directions,
+    bool _forceSceneUpdate)
+{
+  std::vector<RayQueryResult> results;
+  if (_origins.size() != _directions.size())
+  {
+    gzerr << "Number of ray origins and directions differ" << std::endl;
+    return results;
+  }
+
+  Ogre2ScenePtr ogreScene =
+      std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!ogreScene || _origins.empty())
+  {
+    results.resize(_origins.size());
+    return results;
+  }
+
+  Ogre::SceneManager *ogreSceneManager = ogreScene->OgreSceneManager();
+
+  // update the scene once for the whole batch
+  if (_forceSceneUpdate)
+  {
+    ogreSceneManager->updateSceneGraph();
+  }
+
+#ifndef SINGLE_THREADED
+  const size_t numThreads =
+      std::max<size_t>(ogreSceneManager->getNumWorkerThreads(), 1u);
+#else
+  const size_t numThreads = 1u;
+#endif
+
+  // ray scene queries keep their results internally so give every thread
+  // its own query
+  while (this->dataPtr->batchQueries.size() < numThreads)
+  {
+    Ogre::RaySceneQuery *query = ogreSceneManager->createRayQuery(Ogre::Ray());
+    // the closest triangle hit is searched for anyway
+    query->setSortByDistance(false);
+    this->dataPtr->batchQueries.push_back(query);
+  }
+
+  // the Ogre scene is positioned relative to the render origin
+  const math::Vector3d renderOrigin = ogreScene->RenderOrigin();
+  std::vector<math::Vector3d> origins(_origins);
+  for (math::Vector3d &rayOrigin : origins)
+    rayOrigin -= renderOrigin;
+
+  ThreadedBatchTriRay rayTask(origins, _directions,
+                              this->dataPtr->batchQueries);
+#ifndef SINGLE_THREADED
+  ogreSceneManager->executeUserScalableTask(&rayTask, true);
+#else
+  rayTask.execute(0u, 1u);
+#endif
+
+  results.swap(rayTask.results);
+  for (RayQueryResult &result : results)
+  {
+    if (result)
+    {
+      result.objectId = VisualId(ogreScene, result.objectId);
+      result.point += renderOrigin;
+    }
+  }
+  return results;
+}
+
 //////////////////////////////////////////////////
 RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
 {
@@ -527,7 +716,10 @@ RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
     ogreSceneManager->updateSceneGraph();
   }
 
-  const Ogre::Vector3 rayOrigin = Ogre2Conversions::Convert(this->origin);
+  // the Ogre scene is positioned relative to the render origin
+  const math::Vector3d renderOrigin = ogreScene->RenderOrigin();
+  const Ogre::Vector3 rayOrigin =
+      Ogre2Conversions::Convert(this->origin - renderOrigin);
   const Ogre::Vector3 rayDir = Ogre2Conversions::Convert(this->direction);
 
   Ogre::Ray mouseRay(rayOrigin, rayDir);
@@ -552,6 +744,11 @@ RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
 #endif
 
   result = rayTask.CollapseCollectedResults();
+  if (result)
+  {
+    result.objectId = VisualId(ogreScene, result.objectId);
+    result.point += renderOrigin;
+  }
 
   return result;
 }
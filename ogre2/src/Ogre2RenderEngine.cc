@@ -20,9 +20,19 @@
   // pulled in by anybody (e.g., Boost).
   #include <Winsock2.h>
 #endif
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <mutex>
+#include <unordered_set>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
+#include <gz/math/Rand.hh>
 
 #include <gz/plugin/Register.hh>
 
@@ -40,6 +50,10 @@
 #include "Ogre2GzHlmsTerraPrivate.hh"
 #include "Ogre2GzHlmsUnlitPrivate.hh"
 
+#include <OgreHlmsDiskCache.h>
+#include <OgrePlatformInformation.h>
+#include <Vao/OgreVaoManager.h>
+
 #ifdef OGRE_BUILD_RENDERSYSTEM_VULKAN
 #  include "vulkan/vulkan_core.h"
 // Deal with old vulkan headers causing build errors
@@ -66,6 +80,9 @@
 
 #if HAVE_EGL
   #include <EGL/egl.h>
+  #include <EGL/eglext.h>
+  #include <limits.h>
+  #include <stdlib.h>
 #endif
 
 #if defined(__APPLE__)
@@ -105,6 +122,112 @@ class GZ_RENDERING_OGRE2_HIDDEN
   /// \brief Custom Terra modifications
   public: Ogre::Ogre2GzHlmsTerra *gzHlmsTerra{nullptr};
 
+  /// \brief Directory used to cache converted meshes. Empty if mesh
+  /// caching is disabled.
+  public: std::string meshCachePath;
+
+  /// \brief True to keep converted meshes loaded after the scenes that
+  /// used them release them
+  public: bool retainMeshes{false};
+
+  /// \brief True to compress textures to GPU block formats when they are
+  /// loaded
+  public: bool textureCompression{false};
+
+  /// \brief Directory used to cache compressed textures. Empty if
+  /// texture caching is disabled.
+  public: std::string textureCachePath;
+
+  /// \brief Number of worker threads per scene manager. 0 means use the
+  /// number of logical cores.
+  public: unsigned int workerThreadCount{0u};
+
+  /// \brief True if the engine was loaded in deterministic mode
+  public: bool deterministic{false};
+
+  /// \brief True if scenes may be rendered from different threads
+  public: bool sceneThreading{false};
+
+  /// \brief Held by a scene from PreRender to PostRender when scene
+  /// threading is enabled
+  public: std::recursive_mutex renderMutex;
+
+  /// \brief GPU requested with the "device" parameter, as an index or a
+  /// part of the device name. Empty to let the render system choose.
+  public: std::string device;
+
+  /// \brief Name of the GPU selected with the "device" parameter. Empty
+  /// if the render system chose the device.
+  public: std::string deviceName;
+
+  /// \brief Select the GPU requested with the "device" parameter
+  /// \param[in] _renderSys Render system to configure
+  public: void SelectDevice(Ogre::RenderSystem *_renderSys);
+
+  /// \brief Parse and load all material scripts found in a directory
+  /// \param[in] _path Directory that was added to the "General" group
+  public: void ParseMaterialScripts(const std::string &_path);
+
+  /// \brief Uris already passed to AddResourcePath, used to skip the
+  /// findFilePath lookup for repeated requests
+  public: std::unordered_set<std::string> resourceUris;
+
+  /// \brief Resolved resource paths already registered with Ogre
+  public: std::unordered_set<std::string> resourcePathSet;
+
+  /// \brief Nesting depth of BeginResourceBatch / EndResourceBatch
+  public: unsigned int resourceBatchDepth{0u};
+
+  /// \brief Directories added during the current batch whose material
+  /// scripts still need to be parsed once the group is initialised
+  public: std::vector<std::string> pendingResourcePaths;
+
+  /// \brief Root directory of the persistent shader cache. Empty if
+  /// shader caching is disabled.
+  public: std::string shaderCachePath;
+
+  /// \brief Writable archive pointing to the versioned shader cache
+  /// directory of the current gz-rendering version and GPU driver
+  public: Ogre::Archive *shaderCacheArchive{nullptr};
+
+  /// \brief Load the Hlms disk cache and the render system microcode
+  /// cache from shaderCachePath
+  public: void LoadShaderCache();
+
+  /// \brief Save the Hlms disk cache and the render system microcode
+  /// cache to shaderCachePath if new shaders were compiled
+  public: void SaveShaderCache();
+
+  /// \brief Run a startup phase and record its duration in startupTimes
+  /// \param[in] _name Name of the phase
+  /// \param[in] _fn Function performing the phase
+  public: template<typename F>
+          void TimePhase(const std::string &_name, F _fn)
+  {
+    LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+        _name.c_str(), "engine");
+    auto start = std::chrono::steady_clock::now();
+    _fn();
+    this->startupTimes.emplace_back(_name,
+        std::chrono::steady_clock::now() - start);
+  }
+
+  /// \brief Read the files Ogre loads during startup so that they are in
+  /// the OS page cache when Ogre parses them. Only touches the file
+  /// system, so it is safe to run while Ogre is initialised on another
+  /// thread.
+  /// \param[in] _dirs Directories searched recursively
+  /// \param[in] _pluginDirs Directories holding the Ogre plugins, only
+  /// the render system and plugin libraries are read
+  /// \return Number of bytes read
+  public: static std::uintmax_t PrefetchFiles(
+      const std::vector<std::string> &_dirs,
+      const std::vector<std::string> &_pluginDirs);
+
+  /// \brief Duration of each startup phase, in order of execution
+  public: std::vector<std::pair<std::string,
+      std::chrono::steady_clock::duration>> startupTimes;
+
 #ifdef OGRE_BUILD_RENDERSYSTEM_VULKAN
   /// \brief Needed to receive an external Vulkan device from Qt
   /// and inject it into OgreNext.
@@ -144,6 +267,56 @@ RenderEngine *Ogre2RenderEnginePlugin::Engine() const
   return Ogre2RenderEngine::Instance();
 }
 
+//////////////////////////////////////////////////
+std::uintmax_t Ogre2RenderEnginePrivate::PrefetchFiles(
+    const std::vector<std::string> &_dirs,
+    const std::vector<std::string> &_pluginDirs)
+{
+  std::uintmax_t bytes = 0u;
+  std::vector<char> buffer(1u << 16u);
+  auto read = [&](const std::filesystem::path &_path)
+  {
+    std::ifstream file(_path, std::ios::binary);
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+      bytes += static_cast<std::uintmax_t>(file.gcount());
+  };
+
+  std::error_code ec;
+  for (const auto &dir : _dirs)
+  {
+    if (dir.empty() || !std::filesystem::is_directory(dir, ec))
+      continue;
+    for (auto it = std::filesystem::recursive_directory_iterator(dir,
+             std::filesystem::directory_options::skip_permission_denied, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec))
+    {
+      if (it->is_regular_file(ec))
+        read(it->path());
+    }
+    ec.clear();
+  }
+
+  for (const auto &dir : _pluginDirs)
+  {
+    if (!std::filesystem::is_directory(dir, ec))
+      continue;
+    for (auto it = std::filesystem::directory_iterator(dir, ec);
+         !ec && it != std::filesystem::directory_iterator();
+         it.increment(ec))
+    {
+      const std::string name = it->path().filename().string();
+      if ((name.rfind("RenderSystem_", 0) == 0 ||
+           name.rfind("Plugin_", 0) == 0) && it->is_regular_file(ec))
+      {
+        read(it->path());
+      }
+    }
+    ec.clear();
+  }
+  return bytes;
+}
+
 //////////////////////////////////////////////////
 Ogre2RenderEngine::Ogre2RenderEngine() :
   dataPtr(new Ogre2RenderEnginePrivate)
@@ -194,6 +367,8 @@ void Ogre2RenderEngine::Destroy()
 
   if (this->ogreRoot)
   {
+    this->dataPtr->SaveShaderCache();
+
     // Clean up any textures that may still be in flight.
     Ogre::TextureGpuManager *mgr =
     this->ogreRoot->getRenderSystem()->getTextureGpuManager();
@@ -268,6 +443,14 @@ void Ogre2RenderEngine::AddResourcePath(const std::string &_uri)
   if (_uri == "__default__" || _uri.empty())
     return;
 
+  LoadTraceScope scope(this->loadTrace, "Ogre2RenderEngine::AddResourcePath",
+      "engine", _uri);
+
+  // meshes and textures loaded from the same directory all end up here,
+  // skip the filesystem lookup if we've seen this uri before
+  if (this->dataPtr->resourceUris.count(_uri) > 0u)
+    return;
+
   std::string path = common::findFilePath(_uri);
 
   if (path.empty())
@@ -276,6 +459,10 @@ void Ogre2RenderEngine::AddResourcePath(const std::string &_uri)
     return;
   }
 
+  this->dataPtr->resourceUris.insert(_uri);
+  if (!this->dataPtr->resourcePathSet.insert(path).second)
+    return;
+
   this->resourcePaths.push_back(path);
 
   try
@@ -286,62 +473,562 @@ void Ogre2RenderEngine::AddResourcePath(const std::string &_uri)
       Ogre::ResourceGroupManager::getSingleton().addResourceLocation(
           path, "FileSystem", "General", true);
 
+      // defer initialising the group until the end of the batch
+      if (this->dataPtr->resourceBatchDepth > 0u)
+      {
+        this->dataPtr->pendingResourcePaths.push_back(path);
+        return;
+      }
+
       Ogre::ResourceGroupManager::getSingleton().initialiseResourceGroup(
           "General", false);
-      // Parse all material files in the path if any exist
-      if (common::isDirectory(path))
+      this->dataPtr->ParseMaterialScripts(path);
+    }
+  }
+  catch(Ogre::Exception &)
+  {
+    gzerr << "Unable to load Ogre Resources.\nMake sure the"
+        "resources path in the world file is set correctly." << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderEngine::BeginResourceBatch()
+{
+  ++this->dataPtr->resourceBatchDepth;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderEngine::EndResourceBatch()
+{
+  if (this->dataPtr->resourceBatchDepth == 0u)
+  {
+    gzwarn << "EndResourceBatch called without a matching "
+           << "BeginResourceBatch" << std::endl;
+    return;
+  }
+
+  if (--this->dataPtr->resourceBatchDepth > 0u ||
+      this->dataPtr->pendingResourcePaths.empty())
+    return;
+
+  std::vector<std::string> paths;
+  paths.swap(this->dataPtr->pendingResourcePaths);
+
+  try
+  {
+    Ogre::ResourceGroupManager::getSingleton().initialiseResourceGroup(
+        "General", false);
+    for (const auto &path : paths)
+      this->dataPtr->ParseMaterialScripts(path);
+  }
+  catch(Ogre::Exception &)
+  {
+    gzerr << "Unable to load Ogre Resources.\nMake sure the"
+        "resources path in the world file is set correctly." << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderEnginePrivate::ParseMaterialScripts(const std::string &_path)
+{
+  // Parse all material files in the path if any exist
+  if (!common::isDirectory(_path))
+    return;
+
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2RenderEngine::ParseMaterialScripts", "engine", _path);
+
+  std::vector<std::string> paths;
+
+  common::DirIter endIter;
+  for (common::DirIter dirIter(_path); dirIter != endIter; ++dirIter)
+  {
+    paths.push_back(*dirIter);
+  }
+  std::sort(paths.begin(), paths.end());
+
+  // Iterate over all the models in the current gz-rendering path
+  for (auto dIter = paths.begin(); dIter != paths.end(); ++dIter)
+  {
+    std::string fullPath = *dIter;
+    if (fullPath.size() < 9u)
+      continue;
+    std::string matExtension = fullPath.substr(fullPath.size()-9);
+    if (matExtension == ".material")
+    {
+      Ogre::DataStreamPtr stream =
+        Ogre::ResourceGroupManager::getSingleton().openResource(
+            fullPath, "General");
+
+      // There is a material file under there somewhere, read the thing in
+      try
       {
-        std::vector<std::string> paths;
+        Ogre::MaterialManager::getSingleton().parseScript(
+            stream, "General");
+        Ogre::MaterialPtr matPtr =
+          Ogre::MaterialManager::getSingleton().getByName(
+              fullPath);
 
-        common::DirIter endIter;
-        for (common::DirIter dirIter(path); dirIter != endIter; ++dirIter)
+        if (!matPtr.isNull())
         {
-          paths.push_back(*dirIter);
+          // is this necessary to do here? Someday try it without
+          matPtr->compile();
+          matPtr->load();
         }
-        std::sort(paths.begin(), paths.end());
+      }
+      catch(Ogre::Exception&)
+      {
+        gzerr << "Unable to parse material file[" << fullPath << "]\n";
+      }
+      stream->close();
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderEnginePrivate::LoadShaderCache()
+{
+  if (this->shaderCachePath.empty())
+    return;
+
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2RenderEngine::LoadShaderCache", "shader",
+      this->shaderCachePath);
+
+  Ogre::Root *root = Ogre::Root::getSingletonPtr();
+  Ogre::RenderSystem *renderSystem = root->getRenderSystem();
+  if (!renderSystem)
+    return;
+
+  // Shaders are only valid for the gz-rendering version (Hlms templates)
+  // and the GPU driver they were compiled with, so each combination gets
+  // its own directory
+  const Ogre::RenderSystemCapabilities *caps =
+      renderSystem->getCapabilities();
+  std::string key = std::string(GZ_RENDERING_VERSION_FULL) + "_" +
+      renderSystem->getName();
+  if (caps)
+  {
+    key += "_" + Ogre::RenderSystemCapabilities::vendorToString(
+        caps->getVendor()) + "_" + caps->getDeviceName() + "_" +
+        caps->getDriverVersion().toString();
+  }
+  for (auto &c : key)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' &&
+        c != '-')
+    {
+      c = '_';
+    }
+  }
+
+  const std::string dir = common::joinPaths(this->shaderCachePath, key);
+  if (!common::createDirectories(dir))
+  {
+    gzwarn << "Unable to create shader cache directory [" << dir
+           << "], shader caching is disabled." << std::endl;
+    return;
+  }
+
+  try
+  {
+    this->shaderCacheArchive = Ogre::ArchiveManager::getSingleton().load(
+        dir, "FileSystem", false);
+
+    Ogre::GpuProgramManager &gpuProgramManager =
+        Ogre::GpuProgramManager::getSingleton();
+    gpuProgramManager.setSaveMicrocodesToCache(true);
+    const std::string microcodeFile = "microcodeCodeCache.cache";
+    if (this->shaderCacheArchive->exists(microcodeFile))
+    {
+      Ogre::DataStreamPtr stream =
+          this->shaderCacheArchive->open(microcodeFile);
+      gpuProgramManager.loadMicrocodeCache(stream);
+    }
 
-        // Iterate over all the models in the current gz-rendering path
-        for (auto dIter = paths.begin(); dIter != paths.end(); ++dIter)
+    Ogre::HlmsManager *hlmsManager = root->getHlmsManager();
+    Ogre::HlmsDiskCache diskCache(hlmsManager);
+    for (size_t i = Ogre::HLMS_LOW_LEVEL + 1u; i < Ogre::HLMS_MAX; ++i)
+    {
+      Ogre::Hlms *hlms = hlmsManager->getHlms(static_cast<Ogre::HlmsTypes>(i));
+      const std::string hlmsFile =
+          "hlmsDiskCache" + std::to_string(i) + ".bin";
+      if (hlms && this->shaderCacheArchive->exists(hlmsFile))
+      {
+        Ogre::DataStreamPtr stream =
+            this->shaderCacheArchive->open(hlmsFile);
+        diskCache.loadFrom(stream);
+        diskCache.applyTo(hlms);
+      }
+    }
+  }
+  catch(Ogre::Exception &_e)
+  {
+    // a stale or corrupt cache only costs us the compilation time
+    gzwarn << "Unable to load shader cache from [" << dir << "]: "
+           << _e.getDescription() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderEnginePrivate::SaveShaderCache()
+{
+  if (!this->shaderCacheArchive)
+    return;
+
+  try
+  {
+    Ogre::HlmsManager *hlmsManager =
+        Ogre::Root::getSingleton().getHlmsManager();
+    if (hlmsManager->isShaderCodeCacheDirty())
+    {
+      Ogre::HlmsDiskCache diskCache(hlmsManager);
+      for (size_t i = Ogre::HLMS_LOW_LEVEL + 1u; i < Ogre::HLMS_MAX; ++i)
+      {
+        Ogre::Hlms *hlms =
+            hlmsManager->getHlms(static_cast<Ogre::HlmsTypes>(i));
+        if (!hlms)
+          continue;
+        diskCache.copyFrom(hlms);
+        Ogre::DataStreamPtr stream = this->shaderCacheArchive->create(
+            "hlmsDiskCache" + std::to_string(i) + ".bin");
+        diskCache.saveTo(stream);
+      }
+    }
+
+    Ogre::GpuProgramManager &gpuProgramManager =
+        Ogre::GpuProgramManager::getSingleton();
+    if (gpuProgramManager.isCacheDirty())
+    {
+      Ogre::DataStreamPtr stream =
+          this->shaderCacheArchive->create("microcodeCodeCache.cache");
+      gpuProgramManager.saveMicrocodeCache(stream);
+    }
+  }
+  catch(Ogre::Exception &_e)
+  {
+    gzwarn << "Unable to save shader cache to ["
+           << this->shaderCacheArchive->getName() << "]: "
+           << _e.getDescription() << std::endl;
+  }
+
+  Ogre::ArchiveManager::getSingleton().unload(this->shaderCacheArchive);
+  this->shaderCacheArchive = nullptr;
+}
+
+#if HAVE_EGL
+#ifndef EGL_DEVICE_UUID_EXT
+#define EGL_DEVICE_UUID_EXT 0x335C
+#endif
+
+/// \brief Identity of a GPU exposed through EGL
+struct EglDeviceInfo
+{
+  /// \brief DRM device file, e.g. /dev/dri/card1
+  std::string drmFile;
+
+  /// \brief PCI bus id, e.g. 0000:65:00.0
+  std::string pciBusId;
+
+  /// \brief Device UUID, as reported by nvidia-smi without the GPU- prefix
+  std::string uuid;
+};
+
+//////////////////////////////////////////////////
+/// \brief List the GPUs exposed through EGL, in eglQueryDevicesEXT order
+/// \return Identity of every device, empty if EGL cannot enumerate them
+static std::vector<EglDeviceInfo> QueryEglDevices()
+{
+  using QueryDeviceBinaryProc = EGLBoolean (*)(EGLDeviceEXT, EGLint, EGLint,
+      void *, EGLint *);
+
+  std::vector<EglDeviceInfo> infos;
+  auto queryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(
+      eglGetProcAddress("eglQueryDevicesEXT"));
+  auto queryString = reinterpret_cast<PFNEGLQUERYDEVICESTRINGEXTPROC>(
+      eglGetProcAddress("eglQueryDeviceStringEXT"));
+  auto queryBinary = reinterpret_cast<QueryDeviceBinaryProc>(
+      eglGetProcAddress("eglQueryDeviceBinaryEXT"));
+  if (!queryDevices || !queryString)
+    return infos;
+
+  EGLint count = 0;
+  if (!queryDevices(0, nullptr, &count) || count <= 0)
+    return infos;
+  std::vector<EGLDeviceEXT> devices(static_cast<size_t>(count));
+  if (!queryDevices(count, devices.data(), &count))
+    return infos;
+  devices.resize(static_cast<size_t>(count));
+
+  for (EGLDeviceEXT device : devices)
+  {
+    EglDeviceInfo info;
+    const char *extensions = queryString(device, EGL_EXTENSIONS);
+    const std::string ext = extensions ? extensions : "";
+
+    if (ext.find("EGL_EXT_device_drm") != std::string::npos)
+    {
+      const char *drmFile = queryString(device, EGL_DRM_DEVICE_FILE_EXT);
+      if (drmFile)
+      {
+        info.drmFile = drmFile;
+        // /dev/dri/cardN -> /sys/class/drm/cardN/device -> PCI device
+        const std::string card = common::basename(info.drmFile);
+        const std::string sysPath = "/sys/class/drm/" + card + "/device";
+        char resolved[PATH_MAX];
+        if (realpath(sysPath.c_str(), resolved))
+          info.pciBusId = common::basename(resolved);
+      }
+    }
+
+    if (queryBinary &&
+        ext.find("EGL_EXT_device_persistent_id") != std::string::npos)
+    {
+      unsigned char bytes[16];
+      EGLint size = 0;
+      if (queryBinary(device, EGL_DEVICE_UUID_EXT, 16, bytes, &size) &&
+          size == 16)
+      {
+        std::ostringstream uuid;
+        uuid << std::hex << std::setfill('0');
+        for (int i = 0; i < 16; ++i)
         {
-          std::string fullPath = *dIter;
-          std::string matExtension = fullPath.substr(fullPath.size()-9);
-          if (matExtension == ".material")
-          {
-            Ogre::DataStreamPtr stream =
-              Ogre::ResourceGroupManager::getSingleton().openResource(
-                  fullPath, "General");
-
-            // There is a material file under there somewhere, read the thing in
-            try
-            {
-              Ogre::MaterialManager::getSingleton().parseScript(
-                  stream, "General");
-              Ogre::MaterialPtr matPtr =
-                Ogre::MaterialManager::getSingleton().getByName(
-                    fullPath);
-
-              if (!matPtr.isNull())
-              {
-                // is this necessary to do here? Someday try it without
-                matPtr->compile();
-                matPtr->load();
-              }
-            }
-            catch(Ogre::Exception&)
-            {
-              gzerr << "Unable to parse material file[" << fullPath << "]\n";
-            }
-            stream->close();
-          }
+          if (i == 4 || i == 6 || i == 8 || i == 10)
+            uuid << '-';
+          uuid << std::setw(2) << static_cast<int>(bytes[i]);
         }
+        info.uuid = uuid.str();
       }
     }
+    infos.push_back(info);
   }
-  catch(Ogre::Exception &)
+  return infos;
+}
+
+//////////////////////////////////////////////////
+/// \brief Lower case a string and remove its dashes
+/// \param[in] _str String to normalize
+/// \return Normalized string
+static std::string NormalizeDeviceId(const std::string &_str)
+{
+  std::string result;
+  for (unsigned char c : _str)
   {
-    gzerr << "Unable to load Ogre Resources.\nMake sure the"
-        "resources path in the world file is set correctly." << std::endl;
+    if (c != '-')
+      result += static_cast<char>(std::tolower(c));
+  }
+  return result;
+}
+#endif
+
+//////////////////////////////////////////////////
+void Ogre2RenderEnginePrivate::SelectDevice(Ogre::RenderSystem *_renderSys)
+{
+  // both the Vulkan and the headless EGL render systems list the
+  // available GPUs in the "Device" option
+  Ogre::ConfigOptionMap configMap = _renderSys->getConfigOptions();
+  auto deviceOption = configMap.find("Device");
+  if (deviceOption == configMap.end() ||
+      deviceOption->second.possibleValues.empty())
+  {
+    gzwarn << "Render system [" << _renderSys->getName() << "] does not "
+           << "support selecting a device, ignoring device [" << this->device
+           << "]" << std::endl;
+    return;
+  }
+
+  const Ogre::StringVector &devices = deviceOption->second.possibleValues;
+  std::string selected;
+
+#if HAVE_EGL
+  // "pci:<bus id>" and "uuid:<uuid>" identify headless EGL devices the
+  // same way nvidia-smi and container runtimes do
+  const std::vector<EglDeviceInfo> eglDevices = QueryEglDevices();
+  const bool byPci = this->device.rfind("pci:", 0) == 0;
+  const bool byUuid = this->device.rfind("uuid:", 0) == 0;
+  if (byPci || byUuid)
+  {
+    std::string id = NormalizeDeviceId(this->device.substr(byPci ? 4u : 5u));
+    if (byUuid && id.rfind("gpu", 0) == 0)
+      id = id.substr(3u);
+
+    for (size_t i = 0u; i < eglDevices.size() && selected.empty(); ++i)
+    {
+      const std::string candidate = NormalizeDeviceId(
+          byPci ? eglDevices[i].pciBusId : eglDevices[i].uuid);
+      // allow short PCI ids such as 65:00.0
+      const bool match = !candidate.empty() && !id.empty() &&
+          candidate.size() >= id.size() &&
+          candidate.compare(candidate.size() - id.size(), id.size(), id) == 0;
+      if (!match)
+        continue;
+
+      // Ogre names EGL devices after their DRM device file when it is
+      // known, otherwise both lists are in eglQueryDevicesEXT order
+      for (const auto &name : devices)
+      {
+        if (!eglDevices[i].drmFile.empty() &&
+            name.find(eglDevices[i].drmFile) != std::string::npos)
+        {
+          selected = name;
+          break;
+        }
+      }
+      if (selected.empty() && devices.size() == eglDevices.size())
+        selected = devices[i];
+    }
+  }
+  else
+#endif
+  if (std::all_of(this->device.begin(), this->device.end(),
+      [](unsigned char _c) { return std::isdigit(_c); }))
+  {
+    const size_t index = std::stoul(this->device);
+    if (index < devices.size())
+      selected = devices[index];
   }
+  else
+  {
+    for (const auto &name : devices)
+    {
+      if (name.find(this->device) != std::string::npos)
+      {
+        selected = name;
+        break;
+      }
+    }
+  }
+
+  if (selected.empty())
+  {
+    std::ostringstream available;
+    for (size_t i = 0u; i < devices.size(); ++i)
+      available << "\n  " << i << ": " << devices[i];
+#if HAVE_EGL
+    for (size_t i = 0u; i < eglDevices.size(); ++i)
+    {
+      available << "\n  EGL device " << i << ": "
+                << (eglDevices[i].drmFile.empty() ?
+                    "unknown DRM device" : eglDevices[i].drmFile)
+                << ", pci:" << eglDevices[i].pciBusId
+                << ", uuid:" << eglDevices[i].uuid;
+    }
+#endif
+    gzerr << "Device [" << this->device << "] not found, using the default "
+          << "device. Available devices:" << available.str() << std::endl;
+    return;
+  }
+
+  _renderSys->setConfigOption("Device", selected);
+  this->deviceName = selected;
+  gzmsg << "Using device [" << selected << "]" << std::endl;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2RenderEngine::TextureMemoryUsage() const
+{
+  if (!this->ogreRoot || !this->ogreRoot->getRenderSystem())
+    return 0u;
+
+  size_t cpuBytes{0u};
+  size_t gpuBytes{0u};
+  size_t usedStagingBytes{0u};
+  size_t availableStagingBytes{0u};
+  this->ogreRoot->getRenderSystem()->getTextureGpuManager()->getMemoryStats(
+      cpuBytes, gpuBytes, usedStagingBytes, availableStagingBytes);
+  return gpuBytes;
+}
+
+//////////////////////////////////////////////////
+GpuMemoryStats Ogre2RenderEngine::MemoryStats() const
+{
+  GpuMemoryStats stats = BaseRenderEngine::MemoryStats();
+  if (!this->ogreRoot || !this->ogreRoot->getRenderSystem())
+    return stats;
+
+  Ogre::RenderSystem *renderSystem = this->ogreRoot->getRenderSystem();
+  Ogre::TextureGpuManager *textureMgr = renderSystem->getTextureGpuManager();
+
+  // Ogre does not tag textures with what they are used for, so classify
+  // them by type and flags: shadow atlases are the only sampled depth
+  // render targets, and only the voxel volumes of GI are 3D
+  uint64_t textureBytes = 0u;
+  for (const auto &entry : textureMgr->getEntries())
+  {
+    const Ogre::TextureGpu *texture = entry.second.texture;
+    uint64_t bytes = TextureSizeBytes(texture);
+    if (bytes == 0u)
+      continue;
+    textureBytes += bytes;
+
+    const Ogre::TextureTypes::TextureTypes type = texture->getTextureType();
+    if (type == Ogre::TextureTypes::Type3D)
+      stats.globalIllumination += bytes;
+    else if (type == Ogre::TextureTypes::TypeCube ||
+             type == Ogre::TextureTypes::TypeCubeArray)
+      stats.cubemaps += bytes;
+    else if (!texture->isRenderToTexture())
+      stats.textures += bytes;
+    else if (texture->isTexture() &&
+             Ogre::PixelFormatGpuUtils::isDepth(texture->getPixelFormat()))
+      stats.shadowMaps += bytes;
+    else
+      stats.renderTargets += bytes;
+  }
+
+  size_t cpuBytes{0u};
+  size_t gpuBytes{0u};
+  size_t usedStagingBytes{0u};
+  size_t availableStagingBytes{0u};
+  textureMgr->getMemoryStats(
+      cpuBytes, gpuBytes, usedStagingBytes, availableStagingBytes);
+  stats.staging = usedStagingBytes + availableStagingBytes;
+
+  // on some render systems textures are suballocated from the buffer
+  // pools of the vao manager, they are already counted above
+  Ogre::VaoManager::MemoryStatsEntryVec entries;
+  size_t capacityBytes{0u};
+  size_t freeBytes{0u};
+  bool includesTextures{false};
+  renderSystem->getVaoManager()->getMemoryStats(
+      entries, capacityBytes, freeBytes, nullptr, includesTextures);
+  uint64_t bufferBytes = capacityBytes - std::min(freeBytes, capacityBytes);
+  if (includesTextures)
+    bufferBytes -= std::min<uint64_t>(bufferBytes, textureBytes);
+  stats.meshes = bufferBytes;
+
+  stats.total = stats.meshes + stats.textures + stats.shadowMaps +
+      stats.globalIllumination + stats.renderTargets + stats.cubemaps +
+      stats.staging;
+  return stats;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2RenderEngine::TextureSizeBytes(const Ogre::TextureGpu *_texture)
+{
+  if (!_texture ||
+      _texture->getResidencyStatus() != Ogre::GpuResidency::Resident)
+  {
+    return 0u;
+  }
+  return _texture->getSizeBytes();
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2RenderEngine::WorkspaceSizeBytes(
+    const Ogre::CompositorWorkspace *_workspace)
+{
+  if (!_workspace)
+    return 0u;
+
+  size_t bytes = 0u;
+  for (const Ogre::CompositorNode *node : _workspace->getNodeSequence())
+  {
+    for (const Ogre::TextureGpu *texture : node->getLocalTextures())
+      bytes += TextureSizeBytes(texture);
+  }
+  return bytes;
 }
 
 //////////////////////////////////////////////////
@@ -382,6 +1069,105 @@ bool Ogre2RenderEngine::LoadImpl(
   if (it != _params.end())
     std::istringstream(it->second) >> this->winID;
 
+  it = _params.find("meshCache");
+  if (it != _params.end())
+  {
+    bool useMeshCache{false};
+    std::istringstream(it->second) >> useMeshCache;
+    if (useMeshCache)
+    {
+      std::string home;
+      common::env(GZ_HOMEDIR, home);
+      this->dataPtr->meshCachePath =
+          common::joinPaths(home, ".gz", "rendering", "ogre2-mesh-cache");
+    }
+  }
+
+  it = _params.find("meshCachePath");
+  if (it != _params.end() && !it->second.empty())
+    this->dataPtr->meshCachePath = it->second;
+
+  it = _params.find("retainMeshes");
+  if (it != _params.end())
+    std::istringstream(it->second) >> this->dataPtr->retainMeshes;
+
+  it = _params.find("textureCompression");
+  if (it != _params.end())
+    std::istringstream(it->second) >> this->dataPtr->textureCompression;
+
+  it = _params.find("textureCache");
+  if (it != _params.end())
+  {
+    bool useTextureCache{false};
+    std::istringstream(it->second) >> useTextureCache;
+    if (useTextureCache)
+    {
+      std::string home;
+      common::env(GZ_HOMEDIR, home);
+      this->dataPtr->textureCachePath =
+          common::joinPaths(home, ".gz", "rendering", "ogre2-texture-cache");
+    }
+  }
+
+  it = _params.find("textureCachePath");
+  if (it != _params.end() && !it->second.empty())
+    this->dataPtr->textureCachePath = it->second;
+
+  it = _params.find("shaderCache");
+  if (it != _params.end())
+  {
+    bool useShaderCache{false};
+    std::istringstream(it->second) >> useShaderCache;
+    if (useShaderCache)
+    {
+      std::string home;
+      common::env(GZ_HOMEDIR, home);
+      this->dataPtr->shaderCachePath =
+          common::joinPaths(home, ".gz", "rendering", "ogre2-shader-cache");
+    }
+  }
+
+  it = _params.find("shaderCachePath");
+  if (it != _params.end() && !it->second.empty())
+    this->dataPtr->shaderCachePath = it->second;
+
+  it = _params.find("textureMaxSize");
+  if (it != _params.end())
+  {
+    unsigned int textureSize{0u};
+    std::istringstream(it->second) >> textureSize;
+    this->SetTextureMaxSize(textureSize);
+  }
+
+  it = _params.find("workerThreads");
+  if (it != _params.end())
+  {
+    unsigned int workerThreads{0u};
+    std::istringstream(it->second) >> workerThreads;
+    this->dataPtr->workerThreadCount = workerThreads;
+  }
+
+  it = _params.find("deterministic");
+  if (it != _params.end())
+    std::istringstream(it->second) >> this->dataPtr->deterministic;
+
+  if (this->dataPtr->deterministic)
+  {
+    // seed everything drawn from gz::math::Rand, e.g. the default seeds of
+    // the noise passes, so runs render the same frames
+    unsigned int seed{0u};
+    it = _params.find("seed");
+    if (it != _params.end())
+      std::istringstream(it->second) >> seed;
+    math::Rand::Seed(seed);
+    gzmsg << "Ogre2 render engine running in deterministic mode, seed "
+          << seed << std::endl;
+  }
+
+  it = _params.find("device");
+  if (it != _params.end())
+    this->dataPtr->device = it->second;
+
   it = _params.find("metal");
   if (it != _params.end())
   {
@@ -450,6 +1236,21 @@ bool Ogre2RenderEngine::LoadImpl(
     }
   }
 
+  it = _params.find("sceneThreading");
+  if (it != _params.end())
+  {
+    std::istringstream(it->second) >> this->dataPtr->sceneThreading;
+    // GL contexts are bound to the thread that created them
+    if (this->dataPtr->sceneThreading &&
+        this->dataPtr->graphicsAPI == GraphicsAPI::OPENGL)
+    {
+      gzwarn << "Scene threading requires the Vulkan or Metal render "
+                "system, scenes must be rendered from the thread that "
+                "loaded the engine with OpenGL" << std::endl;
+      this->dataPtr->sceneThreading = false;
+    }
+  }
+
   try
   {
     this->LoadAttempt();
@@ -468,6 +1269,83 @@ bool Ogre2RenderEngine::LoadImpl(
   }
 }
 
+//////////////////////////////////////////////////
+std::string Ogre2RenderEngine::MeshCachePath() const
+{
+  return this->dataPtr->meshCachePath;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2RenderEngine::RetainMeshes() const
+{
+  return this->dataPtr->retainMeshes;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2RenderEngine::TextureCompression() const
+{
+  return this->dataPtr->textureCompression;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2RenderEngine::TextureCachePath() const
+{
+  return this->dataPtr->textureCachePath;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2RenderEngine::ShaderCachePath() const
+{
+  return this->dataPtr->shaderCachePath;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2RenderEngine::DeviceName() const
+{
+  return this->dataPtr->deviceName;
+}
+
+//////////////////////////////////////////////////
+std::vector<std::pair<std::string, std::chrono::steady_clock::duration>>
+Ogre2RenderEngine::StartupTimes() const
+{
+  return this->dataPtr->startupTimes;
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2RenderEngine::WorkerThreadCount() const
+{
+  // a single worker keeps the order in which Ogre culls and updates the
+  // scene graph independent of the machine
+  if (this->dataPtr->deterministic)
+    return 1u;
+
+  if (this->dataPtr->workerThreadCount > 0u)
+    return this->dataPtr->workerThreadCount;
+
+  // getNumLogicalCores() may return 0 if couldn't detect
+  return std::max<unsigned int>(
+      1u, Ogre::PlatformInformation::getNumLogicalCores());
+}
+
+//////////////////////////////////////////////////
+bool Ogre2RenderEngine::Deterministic() const
+{
+  return this->dataPtr->deterministic;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2RenderEngine::SceneThreading() const
+{
+  return this->dataPtr->sceneThreading;
+}
+
+//////////////////////////////////////////////////
+std::recursive_mutex &Ogre2RenderEngine::RenderMutex()
+{
+  return this->dataPtr->renderMutex;
+}
+
 //////////////////////////////////////////////////
 bool Ogre2RenderEngine::InitImpl()
 {
@@ -489,21 +1367,82 @@ bool Ogre2RenderEngine::InitImpl()
 //////////////////////////////////////////////////
 void Ogre2RenderEngine::LoadAttempt()
 {
-  this->CreateLogger();
+  this->dataPtr->startupTimes.clear();
+  auto loadStart = std::chrono::steady_clock::now();
+
+  // Ogre is not thread safe, so its initialisation stays on this thread.
+  // Most of a cold start is spent reading the Hlms templates, scripts,
+  // plugins and shader cache from disk though, so read them in the
+  // background while the context, root and render system are created.
+  // The Hlms are registered when the render window is created.
+  const char *env = std::getenv("GZ_RENDERING_RESOURCE_PATH");
+  if (!env)
+    env = std::getenv("IGN_RENDERING_RESOURCE_PATH");
+  std::string resourcePath = (env) ? std::string(env) :
+      gz::rendering::getResourcePath();
+  std::string mediaPath = common::joinPaths(resourcePath, "ogre2", "media");
+  if (!common::exists(mediaPath))
+    mediaPath = common::joinPaths(resourcePath, "ogre2", "src", "media");
+  std::vector<std::string> prefetchDirs = {mediaPath,
+      this->dataPtr->shaderCachePath};
+  std::future<std::uintmax_t> prefetch = std::async(std::launch::async,
+      &Ogre2RenderEnginePrivate::PrefetchFiles, prefetchDirs,
+      this->ogrePaths);
+
+  this->dataPtr->TimePhase("CreateLogger", [this]
+  {
+    this->CreateLogger();
+  });
   if (!this->useCurrentGLContext &&
       (this->dataPtr->graphicsAPI == GraphicsAPI::OPENGL ||
        this->dataPtr->graphicsAPI == GraphicsAPI::VULKAN))
   {
-    this->CreateContext();
+    this->dataPtr->TimePhase("CreateContext", [this]
+    {
+      this->CreateContext();
+    });
   }
 
-  this->CreateRoot();
-  this->CreateOverlay();
-  this->LoadPlugins();
-  this->CreateRenderSystem();
-  this->ogreRoot->initialise(false);
-  this->CreateRenderWindow();
-  this->CreateResources();
+  this->dataPtr->TimePhase("CreateRoot", [this]
+  {
+    this->CreateRoot();
+    this->CreateOverlay();
+  });
+  this->dataPtr->TimePhase("LoadPlugins", [this]
+  {
+    this->LoadPlugins();
+  });
+  this->dataPtr->TimePhase("CreateRenderSystem", [this]
+  {
+    this->CreateRenderSystem();
+    this->ogreRoot->initialise(false);
+  });
+  this->dataPtr->TimePhase("Prefetch", [&prefetch]
+  {
+    auto bytes = prefetch.get();
+    gzdbg << "Prefetched [" << bytes << "] bytes of Ogre2 startup files"
+          << std::endl;
+  });
+  this->dataPtr->TimePhase("CreateRenderWindow", [this]
+  {
+    this->CreateRenderWindow();
+  });
+  this->dataPtr->TimePhase("CreateResources", [this]
+  {
+    this->CreateResources();
+  });
+
+  std::ostringstream breakdown;
+  for (const auto &[name, time] : this->dataPtr->startupTimes)
+  {
+    breakdown << " " << name << " "
+              << std::chrono::duration<double, std::milli>(time).count()
+              << "ms";
+  }
+  gzdbg << "Ogre2 load took "
+        << std::chrono::duration<double, std::milli>(
+           std::chrono::steady_clock::now() - loadStart).count()
+        << "ms:" << breakdown.str() << std::endl;
 }
 
 //////////////////////////////////////////////////
@@ -833,6 +1772,10 @@ void Ogre2RenderEngine::CreateRenderSystem()
     }
   }
 
+  // select the GPU, e.g. to run one process per GPU on multi-GPU machines
+  if (renderSys && !this->dataPtr->device.empty())
+    this->dataPtr->SelectDevice(renderSys);
+
   // get all supported fsaa values
   Ogre::ConfigOptionMap configMap = renderSys->getConfigOptions();
   auto fsaaOoption = configMap.find("FSAA");
@@ -871,6 +1814,9 @@ void Ogre2RenderEngine::CreateRenderSystem()
 
 void Ogre2RenderEngine::RegisterHlms()
 {
+  LoadTraceScope scope(this->loadTrace, "Ogre2RenderEngine::RegisterHlms",
+      "shader");
+
   const char *env = std::getenv("GZ_RENDERING_RESOURCE_PATH");
 
   // TODO(CH3): Deprecated. Remove on tock.
@@ -1155,6 +2101,10 @@ void Ogre2RenderEngine::CreateResources()
       }
     }
   }
+
+  // the Hlms are registered by now, restore the shaders compiled by
+  // previous runs before anything gets rendered
+  this->dataPtr->LoadShaderCache();
 }
 
 //////////////////////////////////////////////////
@@ -1420,7 +2370,11 @@ void Ogre2RenderEngine::InitAttempt()
   this->initialized = false;
 
   // init the resources
-  Ogre::ResourceGroupManager::getSingleton().initialiseAllResourceGroups(false);
+  this->dataPtr->TimePhase("InitialiseResources", []
+  {
+    Ogre::ResourceGroupManager::getSingleton().initialiseAllResourceGroups(
+        false);
+  });
 
   this->scenes = Ogre2SceneStorePtr(new Ogre2SceneStore);
 }
@@ -1454,9 +2408,20 @@ Ogre::v1::OverlaySystem *Ogre2RenderEngine::OverlaySystem() const
 void Ogre2RenderEngine::SetGzOgreRenderingMode(
   GzOgreRenderingMode renderingMode)
 {
-  this->dataPtr->gzHlmsPbs->gzOgreRenderingMode = renderingMode;
-  this->dataPtr->gzHlmsUnlit->gzOgreRenderingMode = renderingMode;
-  this->dataPtr->gzHlmsTerra->gzOgreRenderingMode = renderingMode;
+  this->SetGzOgreRenderingMode(renderingMode, GOIA_SOLID_COLOR);
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::SetGzOgreRenderingMode(
+  GzOgreRenderingMode _renderingMode, GzOgreItemAttribute _attribute)
+{
+  this->dataPtr->gzHlmsPbs->gzOgreRenderingMode = _renderingMode;
+  this->dataPtr->gzHlmsUnlit->gzOgreRenderingMode = _renderingMode;
+  this->dataPtr->gzHlmsTerra->gzOgreRenderingMode = _renderingMode;
+
+  // terra keeps its own solid colours, see Terra::SetSolidColor
+  this->dataPtr->gzHlmsPbs->gzItemAttribute = _attribute;
+  this->dataPtr->gzHlmsUnlit->gzItemAttribute = _attribute;
 }
 
 /////////////////////////////////////////////////
@@ -58,6 +58,12 @@ void Ogre2RenderPass::CreateRenderPass()
   // To be overriden by derived render pass classes
 }
 
+//////////////////////////////////////////////////
+std::string Ogre2RenderPass::FusableMaterialName() const
+{
+  return std::string();
+}
+
 //////////////////////////////////////////////////
 std::string Ogre2RenderPass::OgreCompositorNodeDefinitionName() const
 {
@@ -15,6 +15,14 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
 #include <gz/common/Console.hh>
 
 #include "gz/rendering/Material.hh"
@@ -24,12 +32,19 @@
 #include "gz/rendering/ogre2/Ogre2RenderPass.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2Material.hh"
+#include "gz/rendering/ogre2/Ogre2ParticleEmitter.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/Utils.hh"
 
 #include <string.h>
 
+#include <OgreHlmsManager.h>
+
+#include "Ogre2OcclusionCuller.hh"
+#include "Ogre2SkyBoxMaterial.hh"
+#include "Ogre2TextureReadback.hh"
+
 namespace gz
 {
 namespace rendering
@@ -61,15 +76,53 @@ class Ogre2RenderTargetCompositorListener :
       GZ_ASSERT(scenePass != nullptr, "Unable to get scene pass");
       Ogre::Viewport *vp = scenePass->getCamera()->getLastViewport();
       if (vp == nullptr) return;
+      const SensorQualityProfile &profile =
+          this->ogreRenderTarget->QualityProfile();
       // make sure we do not alter the reserved visibility flags
       uint32_t f = this->ogreRenderTarget->VisibilityMask() &
+                   profile.visibilityMask &
                    Ogre::VisibilityFlags::RESERVED_VISIBILITY_FLAGS;
+      if (!profile.particles)
+        f &= ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
       // apply the new visibility mask
       uint32_t flags = f & vp->getVisibilityMask();
       vp->_setVisibilityMask(flags, vp->getLightVisibilityMask());
+
+      // GI is bound to the Pbs hlms for all cameras, so detach it for the
+      // duration of the pass
+      if (!profile.globalIllumination)
+      {
+        Ogre::HlmsPbs *hlmsPbs = this->HlmsPbs();
+        this->vctLighting = hlmsPbs->getVctLighting();
+        if (this->vctLighting)
+          hlmsPbs->setVctLighting(nullptr);
+      }
     }
   }
 
+  // Documentation inherited.
+  public: virtual void passPosExecute(Ogre::CompositorPass *_pass)
+  {
+    if (_pass->getType() == Ogre::PASS_SCENE && this->vctLighting)
+    {
+      this->HlmsPbs()->setVctLighting(this->vctLighting);
+      this->vctLighting = nullptr;
+    }
+  }
+
+  /// \brief Get the Pbs hlms
+  /// \return The Pbs hlms
+  private: Ogre::HlmsPbs *HlmsPbs() const
+  {
+    Ogre::HlmsManager *hlmsManager =
+        Ogre2RenderEngine::Instance()->OgreRoot()->getHlmsManager();
+    return static_cast<Ogre::HlmsPbs *>(
+        hlmsManager->getHlms(Ogre::HLMS_PBS));
+  }
+
+  /// \brief GI detached from the Pbs hlms during the current scene pass
+  private: Ogre::VctLighting *vctLighting = nullptr;
+
   /// \brief Pointer to render target that added this listener
   private: Ogre2RenderTarget *ogreRenderTarget = nullptr;
 };
@@ -83,8 +136,15 @@ class gz::rendering::Ogre2RenderTargetPrivate
   /// \brief Listener for chaning compositor pass properties
   public: Ogre2RenderTargetCompositorListener *rtListener = nullptr;
 
-  /// \brief Name of sky box material
-  public: const std::string kSkyboxMaterialName = "SkyBox";
+  /// \brief Occlusion culling of the camera's scene passes
+  public: std::unique_ptr<Ogre2OcclusionCuller> occlusionCuller;
+
+  /// \brief Camera the occlusion culler listens to
+  public: Ogre::Camera *occlusionCamera = nullptr;
+
+  /// \brief Name of the sky box material, shared with the other cameras
+  /// rendering the same sky
+  public: std::string skyboxMaterialName;
 
   /// \brief Name of base rendering compositor node
   public: const std::string kBaseNodeName = "PbsMaterialsRenderingNode";
@@ -102,11 +162,285 @@ class gz::rendering::Ogre2RenderTargetPrivate
   /// actual window
   ///
   public: Ogre::TextureGpu *ogreTexture[2] = {nullptr, nullptr};
+
+  /// \brief Destroy the Bayer conversion workspace and its texture
+  public: void DestroyBayer();
+
+  /// \brief Download a region of a texture to memory like
+  /// Ogre::Image2::copyContentsToMemory, but through a staging ticket
+  /// that is reused across copies
+  /// \param[in] _texture Texture to download
+  /// \param[in] _srcBox Region of the texture to download
+  /// \param[in,out] _dstBox Memory to write to
+  /// \param[in] _dstFormat Pixel format of the memory
+  public: void CopyToMemory(Ogre::TextureGpu *_texture,
+      const Ogre::TextureBox &_srcBox, Ogre::TextureBox &_dstBox,
+      Ogre::PixelFormatGpu _dstFormat);
+
+  /// \brief Staging ticket used by CopyToMemory
+  public: Ogre2TextureReadback readback;
+
+  /// \brief Name of the Bayer conversion material
+  public: const std::string kBayerMaterialName = "Bayer";
+
+  /// \brief Name of the Bayer conversion workspace definition, shared by all
+  /// render targets
+  public: const std::string kBayerWorkspaceDefName = "BayerWorkspace";
+
+  /// \brief Single channel texture holding the Bayer image
+  public: Ogre::TextureGpu *bayerTexture = nullptr;
+
+  /// \brief Texture the Bayer conversion workspace reads from
+  public: Ogre::TextureGpu *bayerInput = nullptr;
+
+  /// \brief Workspace that converts the render target to a Bayer image
+  public: Ogre::CompositorWorkspace *bayerWorkspace = nullptr;
+
+  /// \brief Render a workspace that post-processes the render target
+  /// outside of the regular frame, e.g. the Bayer conversion
+  /// \param[in] _workspace Workspace to render
+  /// \param[in] _scene Scene of the render target
+  public: static void RenderWorkspace(Ogre::CompositorWorkspace *_workspace,
+      const Ogre2ScenePtr &_scene);
+
+  /// \brief Texture and workspace the render target is resized with, see
+  /// CopyResized
+  public: struct ResizeTarget
+  {
+    /// \brief Texture holding the resized image
+    Ogre::TextureGpu *texture = nullptr;
+
+    /// \brief Texture the workspace reads from
+    Ogre::TextureGpu *input = nullptr;
+
+    /// \brief Workspace that resizes the render target into texture
+    Ogre::CompositorWorkspace *workspace = nullptr;
+  };
+
+  /// \brief Destroy a resize workspace and its texture
+  /// \param[in] _target Resize target to destroy
+  public: static void DestroyResizeTarget(ResizeTarget &_target);
+
+  /// \brief Destroy all resize workspaces and their textures
+  public: void DestroyResizeTargets();
+
+  /// \brief Name of the resize workspace definition, shared by all render
+  /// targets
+  public: const std::string kResizeWorkspaceDefName = "ResizeWorkspace";
+
+  /// \brief Name of the bilinear copy material the resize workspace uses
+  public: const std::string kResizeMaterialName = "ResizeCopy";
+
+  /// \brief Resize targets by image width and height
+  public: std::map<std::pair<uint32_t, uint32_t>, ResizeTarget>
+      resizeTargets;
+
+  /// \brief Decide whether the workspace re-renders its shadow maps this
+  /// frame, see Scene::SetShadowSettings
+  /// \param[in] _workspace Workspace about to be rendered
+  /// \param[in] _scene Scene of the render target
+  public: void UpdateShadowPolicy(Ogre::CompositorWorkspace *_workspace,
+      const Ogre2ScenePtr &_scene);
+
+  /// \brief True once the workspace rendered its shadow maps
+  public: bool shadowsRendered = false;
+
+  /// \brief True if the workspace was told to skip its shadow update
+  public: bool shadowUpdateSkipped = false;
+
+  /// \brief Scene graph generation the shadow maps were rendered at
+  public: uint64_t shadowGeneration = 0u;
+
+  /// \brief Scene time the shadow maps were rendered at
+  public: std::chrono::steady_clock::duration shadowTime{0};
+
+  /// \brief Fraction of the target resolution the scene is rendered at
+  public: double renderScale = 1.0;
+
+  /// \brief Hold back a size change instead of rebuilding the target
+  /// \param[in] _built True if the target textures exist
+  /// \param[in] _wasDirty True if the target was dirty before the change
+  /// \param[in] _changed True if the size changed
+  /// \return True if the target does not need to be rebuilt now
+  public: bool DeferResize(bool _built, bool _wasDirty, bool _changed);
+
+  /// \brief Time the size must stay unchanged before it is applied
+  public: std::chrono::steady_clock::duration resizeDelay{0};
+
+  /// \brief True if the size changed but the target was not rebuilt yet
+  public: bool resizePending = false;
+
+  /// \brief Time of the last held back size change
+  public: std::chrono::steady_clock::time_point resizeTime;
+
+  /// \brief Anti-aliasing method, see SetAntiAliasingMode
+  public: CameraAntiAliasingMode antiAliasingMode = CAAM_MSAA;
+
+  /// \brief Name of the FXAA post-process material
+  public: const std::string kFxaaMaterialName = "Fxaa";
 };
 
 using namespace gz;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+bool Ogre2RenderTargetPrivate::DeferResize(bool _built, bool _wasDirty,
+    bool _changed)
+{
+  if (this->resizeDelay == std::chrono::steady_clock::duration::zero() ||
+      !_built || _wasDirty)
+  {
+    return false;
+  }
+
+  // every change restarts the wait, so dragging a window edge rebuilds the
+  // target once the size settles
+  if (_changed)
+  {
+    this->resizePending = true;
+    this->resizeTime = std::chrono::steady_clock::now();
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::UpdateShadowPolicy(
+    Ogre::CompositorWorkspace *_workspace, const Ogre2ScenePtr &_scene)
+{
+  const ShadowConfig config = _scene->ShadowSettings();
+  const bool throttled =
+      config.updateRate > 0.0 || config.reuseStaticShadows;
+  if (!throttled && !this->shadowUpdateSkipped)
+    return;
+
+  const std::chrono::steady_clock::duration now = _scene->Time();
+  const uint64_t generation = _scene->SceneGraphGeneration();
+  bool update = true;
+  if (throttled && this->shadowsRendered)
+  {
+    if (config.reuseStaticShadows && generation == this->shadowGeneration)
+    {
+      update = false;
+    }
+    else if (config.updateRate > 0.0 && now >= this->shadowTime &&
+        std::chrono::duration<double>(now - this->shadowTime).count() <
+        1.0 / config.updateRate)
+    {
+      update = false;
+    }
+  }
+
+  // the first scene pass using the shadow node renders the shadow maps,
+  // the others always reuse them
+  for (Ogre::CompositorNode *node : _workspace->getNodeSequence())
+  {
+    for (Ogre::CompositorPass *pass : node->_getPasses())
+    {
+      if (pass->getType() != Ogre::PASS_SCENE)
+        continue;
+      Ogre::CompositorPassScene *scenePass =
+          static_cast<Ogre::CompositorPassScene *>(pass);
+      if (!scenePass->getShadowNode())
+        continue;
+      scenePass->_setUpdateShadowNode(update);
+      this->shadowUpdateSkipped = !update;
+      if (update)
+      {
+        this->shadowsRendered = true;
+        this->shadowGeneration = generation;
+        this->shadowTime = now;
+      }
+      return;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::CopyToMemory(Ogre::TextureGpu *_texture,
+    const Ogre::TextureBox &_srcBox, Ogre::TextureBox &_dstBox,
+    Ogre::PixelFormatGpu _dstFormat)
+{
+  // multisampled textures, e.g. of render windows, must be resolved first
+  if (_texture->isMultisample())
+  {
+    Ogre::Image2::copyContentsToMemory(_texture, _srcBox, _dstBox,
+        _dstFormat);
+    return;
+  }
+
+  Ogre::TextureBox box;
+  if (!this->readback.Read(_texture, box, &_srcBox))
+    return;
+  Ogre::PixelFormatGpuUtils::bulkPixelConversion(
+      box, _texture->getPixelFormat(), _dstBox, _dstFormat);
+  this->readback.Unmap();
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::DestroyBayer()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  if (this->bayerWorkspace)
+  {
+    ogreRoot->getCompositorManager2()->removeWorkspace(this->bayerWorkspace);
+    this->bayerWorkspace = nullptr;
+  }
+  if (this->bayerTexture)
+  {
+    ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+        this->bayerTexture);
+    this->bayerTexture = nullptr;
+  }
+  this->bayerInput = nullptr;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::RenderWorkspace(
+    Ogre::CompositorWorkspace *_workspace, const Ogre2ScenePtr &_scene)
+{
+  _scene->StartForcedRender();
+
+  _workspace->_validateFinalTarget();
+  _workspace->_beginUpdate(false);
+  _workspace->_update();
+  _workspace->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
+  swappedTargets.reserve(2u);
+  _workspace->_swapFinalTarget(swappedTargets);
+
+  _scene->FlushGpuCommandsAndStartNewFrame(1u, false);
+
+  _scene->EndForcedRender();
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::DestroyResizeTarget(ResizeTarget &_target)
+{
+  auto ogreRoot = Ogre2RenderEngine::Instance()->OgreRoot();
+  if (_target.workspace)
+  {
+    ogreRoot->getCompositorManager2()->removeWorkspace(_target.workspace);
+    _target.workspace = nullptr;
+  }
+  if (_target.texture)
+  {
+    ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+        _target.texture);
+    _target.texture = nullptr;
+  }
+  _target.input = nullptr;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTargetPrivate::DestroyResizeTargets()
+{
+  for (auto &it : this->resizeTargets)
+    DestroyResizeTarget(it.second);
+  this->resizeTargets.clear();
+}
+
 //////////////////////////////////////////////////
 // Ogre2RenderTarget
 //////////////////////////////////////////////////
@@ -137,8 +471,7 @@ void Ogre2RenderTarget::BuildCompositor()
 
   this->UpdateBackgroundMaterial();
 
-  bool validBackground = this->backgroundMaterial &&
-      !this->backgroundMaterial->EnvironmentMap().empty();
+  bool validBackground = !this->dataPtr->skyboxMaterialName.empty();
 
   // The function build a similar compositor as the one defined in
   // ogre2/media/2.0/scripts/Compositors/PbsMaterials.compositor
@@ -149,6 +482,10 @@ void Ogre2RenderTarget::BuildCompositor()
   // PbsMaterials.compositor file
   std::string wsDefName = "PbsMaterialWorkspace_" + this->Name();
   this->ogreCompositorWorkspaceDefName = wsDefName;
+  const double renderScale = this->dataPtr->renderScale;
+  const bool scaled = renderScale < 1.0;
+  const bool fxaa = this->qualityProfile.antiAliasing &&
+      this->dataPtr->antiAliasingMode == CAAM_FXAA;
   if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
   {
     // PbsMaterialsRenderingNode
@@ -171,6 +508,29 @@ void Ogre2RenderTarget::BuildCompositor()
 
       *rtvDef = *rt0Def;
 
+      // with a render scale the scene is rendered to a smaller texture that
+      // is upscaled into rt0 afterwards
+      std::string sceneTexName = "rt0";
+      if (scaled)
+      {
+        Ogre::TextureDefinitionBase::TextureDefinition *scaledDef =
+            nodeDef->addTextureDefinition("rt_scaled");
+        scaledDef->widthFactor = static_cast<float>(renderScale);
+        scaledDef->heightFactor = static_cast<float>(renderScale);
+        scaledDef->format = Ogre::PFG_RGBA8_UNORM_SRGB;
+        sceneTexName = "rt_scaled";
+        rtvDef->colourAttachments[0].textureName = sceneTexName;
+      }
+      else if (fxaa)
+      {
+        // FXAA reads the scene from a texture of its own
+        Ogre::TextureDefinitionBase::TextureDefinition *fxaaDef =
+            nodeDef->addTextureDefinition("rt_fxaa");
+        fxaaDef->format = Ogre::PFG_RGBA8_UNORM_SRGB;
+        sceneTexName = "rt_fxaa";
+        rtvDef->colourAttachments[0].textureName = sceneTexName;
+      }
+
       const uint8_t fsaa = TargetFSAA();
       if (fsaa > 1u)
       {
@@ -178,13 +538,15 @@ void Ogre2RenderTarget::BuildCompositor()
             nodeDef->addTextureDefinition("rt_fsaa");
 
         msaaDef->fsaa = std::to_string(fsaa);
+        msaaDef->widthFactor = static_cast<float>(renderScale);
+        msaaDef->heightFactor = static_cast<float>(renderScale);
 
         rtvDef->colourAttachments[0].textureName = "rt_fsaa";
-        rtvDef->colourAttachments[0].resolveTextureName = "rt0";
+        rtvDef->colourAttachments[0].resolveTextureName = sceneTexName;
       }
     }
 
-    nodeDef->setNumTargetPass(2);
+    nodeDef->setNumTargetPass((scaled || fxaa) ? 3 : 2);
     Ogre::CompositorTargetDef *rt0TargetDef =
         nodeDef->addTargetPass("rtv");
 
@@ -198,7 +560,8 @@ void Ogre2RenderTarget::BuildCompositor()
         Ogre::CompositorPassSceneDef *passScene =
             static_cast<Ogre::CompositorPassSceneDef *>(
             rt0TargetDef->addPass(Ogre::PASS_SCENE));
-        passScene->mShadowNode = this->dataPtr->kShadowNodeName;
+        if (this->qualityProfile.shadows)
+          passScene->mShadowNode = this->dataPtr->kShadowNodeName;
         passScene->mIncludeOverlays = false;
         passScene->mFirstRQ = 0u;
         passScene->mLastRQ = 2u;
@@ -222,8 +585,7 @@ void Ogre2RenderTarget::BuildCompositor()
         Ogre::CompositorPassQuadDef *passQuad =
             static_cast<Ogre::CompositorPassQuadDef *>(
             rt0TargetDef->addPass(Ogre::PASS_QUAD));
-        passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-            + this->Name();
+        passQuad->mMaterialName = this->dataPtr->skyboxMaterialName;
         passQuad->mFrustumCorners =
             Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
       }
@@ -234,11 +596,29 @@ void Ogre2RenderTarget::BuildCompositor()
             static_cast<Ogre::CompositorPassSceneDef *>(
             rt0TargetDef->addPass(Ogre::PASS_SCENE));
         passScene->mIncludeOverlays = true;
-        passScene->mShadowNode = this->dataPtr->kShadowNodeName;
+        if (this->qualityProfile.shadows)
+          passScene->mShadowNode = this->dataPtr->kShadowNodeName;
         passScene->mFirstRQ = 2u;
       }
     }
 
+    if (scaled || fxaa)
+    {
+      // copy the scene to the target, upscaling it with a render scale and
+      // smoothing its edges with FXAA
+      Ogre::CompositorTargetDef *upscaleTargetDef =
+          nodeDef->addTargetPass("rt0");
+      upscaleTargetDef->setNumPasses(1);
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          upscaleTargetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+      passQuad->mMaterialName =
+          fxaa ? this->dataPtr->kFxaaMaterialName : "Ogre/Copy/4xFP32";
+      passQuad->addQuadTextureSource(0,
+          scaled ? "rt_scaled" : "rt_fxaa");
+    }
+
     nodeDef->mapOutputChannel(0, "rt0");
     nodeDef->mapOutputChannel(1, "rt1");
 
@@ -308,11 +688,18 @@ void Ogre2RenderTarget::BuildCompositor()
         this->ogreCamera,
         this->ogreCompositorWorkspaceDefName,
         false);
+  this->dataPtr->shadowsRendered = false;
+  this->dataPtr->shadowUpdateSkipped = false;
 
   this->dataPtr->rtListener = new Ogre2RenderTargetCompositorListener(this);
   this->ogreCompositorWorkspace->addListener(this->dataPtr->rtListener);
   this->ogreCompositorWorkspace->addListener(engine->TerraWorkspaceListener());
 
+  this->dataPtr->occlusionCuller =
+      std::make_unique<Ogre2OcclusionCuller>(this->scene.get());
+  this->ogreCamera->addListener(this->dataPtr->occlusionCuller.get());
+  this->dataPtr->occlusionCamera = this->ogreCamera;
+
   for (RenderPassPtr &pass : this->renderPasses)
   {
     Ogre2RenderPass *ogre2RenderPass =
@@ -324,6 +711,9 @@ void Ogre2RenderTarget::BuildCompositor()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::DestroyCompositor()
 {
+  this->dataPtr->DestroyBayer();
+  this->dataPtr->DestroyResizeTargets();
+
   if (!this->ogreCompositorWorkspace)
     return;
 
@@ -358,6 +748,14 @@ void Ogre2RenderTarget::DestroyCompositor()
   this->ogreCompositorWorkspace = nullptr;
   delete this->dataPtr->rtListener;
   this->dataPtr->rtListener = nullptr;
+
+  if (this->dataPtr->occlusionCamera)
+  {
+    this->dataPtr->occlusionCamera->removeListener(
+        this->dataPtr->occlusionCuller.get());
+    this->dataPtr->occlusionCamera = nullptr;
+  }
+  this->dataPtr->occlusionCuller.reset();
 }
 
 //////////////////////////////////////////////////
@@ -370,20 +768,29 @@ void Ogre2RenderTarget::RebuildCompositor()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::Copy(Image &_image) const
 {
-  // TODO(anyone) handle Bayer conversions
-
   if (_image.Width() != this->width || _image.Height() != this->height)
   {
     gzerr << "Invalid image dimensions" << std::endl;
     return;
   }
 
+  if (this->dataPtr->resizePending)
+  {
+    gzerr << "Render target has not been resized yet, see "
+          << "Camera::SetResizeDelay" << std::endl;
+    return;
+  }
+
   Ogre::PixelFormatGpu dstOgrePf;
   if ((_image.Format() == PF_BAYER_RGGB8) ||
       (_image.Format() == PF_BAYER_BGGR8) ||
       (_image.Format() == PF_BAYER_GBRG8) ||
       (_image.Format() == PF_BAYER_GRBG8))
   {
+    // convert on the GPU so only one byte per pixel is read back, and fall
+    // back to converting on the CPU if the conversion material is missing
+    if (this->CopyBayer(_image))
+      return;
     dstOgrePf = Ogre2Conversions::Convert(PF_R8G8B8);
   }
   else
@@ -423,19 +830,314 @@ void Ogre2RenderTarget::Copy(Image &_image) const
     // create tmp color image to get data from gpu
     Image colorImage(this->width, this->height, PF_R8G8B8);
     dstBox.data = colorImage.Data();
-    Ogre::Image2::copyContentsToMemory(
+    this->dataPtr->CopyToMemory(
         texture, texture->getEmptyBox(0u), dstBox, dstOgrePf);
     // convert color image to bayer image
-    _image = gz::rendering::convertRGBToBayer(colorImage, _image.Format());
+    _image.CopyFrom(
+        gz::rendering::convertRGBToBayer(colorImage, _image.Format()));
   }
   else
   {
+    dstBox.bytesPerRow = _image.RowStride();
+    dstBox.bytesPerImage = _image.RowStride() * _image.Height();
     dstBox.data = _image.Data();
-    Ogre::Image2::copyContentsToMemory(
+    this->dataPtr->CopyToMemory(
         texture, texture->getEmptyBox(0u), dstBox, dstOgrePf);
   }
 }
 
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::CopyRegion(Image &_image, unsigned int _x,
+    unsigned int _y) const
+{
+  const PixelFormat format = _image.Format();
+  if (format == PF_BAYER_RGGB8 || format == PF_BAYER_BGGR8 ||
+      format == PF_BAYER_GBRG8 || format == PF_BAYER_GRBG8)
+  {
+    // the bayer conversion runs on the full image
+    BaseRenderTarget::CopyRegion(_image, _x, _y);
+    return;
+  }
+  if (_x + _image.Width() > this->width ||
+      _y + _image.Height() > this->height)
+  {
+    gzerr << "Invalid image region" << std::endl;
+    return;
+  }
+
+  if (this->dataPtr->resizePending)
+  {
+    gzerr << "Render target has not been resized yet, see "
+          << "Camera::SetResizeDelay" << std::endl;
+    return;
+  }
+
+  Ogre::TextureGpu *texture = this->RenderTarget();
+  Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
+  // force a raw copy if the formats only differ in sRGB-ness, see Copy
+  if (Ogre::PixelFormatGpuUtils::isSRgb(texture->getPixelFormat()))
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentSRGB(dstOgrePf);
+  else
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentLinear(dstOgrePf);
+
+  Ogre::TextureBox srcBox = texture->getEmptyBox(0u);
+  srcBox.x = _x;
+  srcBox.y = _y;
+  srcBox.width = _image.Width();
+  srcBox.height = _image.Height();
+
+  Ogre::TextureBox dstBox(
+    srcBox.width, srcBox.height, 1u, 1u,
+    static_cast<uint32_t>(
+      Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+    _image.RowStride(), _image.RowStride() * _image.Height());
+  dstBox.data = _image.Data();
+  this->dataPtr->CopyToMemory(texture, srcBox, dstBox, dstOgrePf);
+}
+
+//////////////////////////////////////////////////
+bool Ogre2RenderTarget::CopyBayer(Image &_image) const
+{
+  // color channel kept at (even row, even column), (even row, odd column),
+  // (odd row, even column) and (odd row, odd column). 0: red, 1: green,
+  // 2: blue
+  Ogre::Vector4 channels;
+  switch (_image.Format())
+  {
+    case PF_BAYER_RGGB8:
+      channels = Ogre::Vector4(0, 1, 1, 2);
+      break;
+    case PF_BAYER_BGGR8:
+      channels = Ogre::Vector4(2, 1, 1, 0);
+      break;
+    case PF_BAYER_GBRG8:
+      channels = Ogre::Vector4(1, 2, 0, 1);
+      break;
+    case PF_BAYER_GRBG8:
+      channels = Ogre::Vector4(1, 0, 2, 1);
+      break;
+    default:
+      return false;
+  }
+
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(
+      this->dataPtr->kBayerMaterialName);
+  if (!ogreMat)
+    return false;
+  if (!ogreMat->isLoaded())
+    ogreMat->load();
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpu *texture = this->RenderTarget();
+
+  // (re)create the workspace if the render target was resized or the final
+  // result moved to a different texture
+  if (this->dataPtr->bayerInput != texture || !this->dataPtr->bayerTexture ||
+      this->dataPtr->bayerTexture->getWidth() != texture->getWidth() ||
+      this->dataPtr->bayerTexture->getHeight() != texture->getHeight())
+  {
+    this->dataPtr->DestroyBayer();
+
+    const std::string &wsDefName = this->dataPtr->kBayerWorkspaceDefName;
+    if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+    {
+      std::string nodeDefName = wsDefName + "/Node";
+      Ogre::CompositorNodeDef *nodeDef =
+          ogreCompMgr->addNodeDefinition(nodeDefName);
+      nodeDef->addTextureSourceName("rt_input", 0,
+          Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+      nodeDef->addTextureSourceName("rt_output", 1,
+          Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+      nodeDef->setNumTargetPass(1);
+      Ogre::CompositorTargetDef *targetDef =
+          nodeDef->addTargetPass("rt_output");
+      targetDef->setNumPasses(1);
+      {
+        // quad pass
+        Ogre::CompositorPassQuadDef *passQuad =
+            static_cast<Ogre::CompositorPassQuadDef *>(
+            targetDef->addPass(Ogre::PASS_QUAD));
+        passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+        passQuad->mMaterialName = this->dataPtr->kBayerMaterialName;
+        passQuad->addQuadTextureSource(0, "rt_input");
+      }
+
+      Ogre::CompositorWorkspaceDef *workDef =
+          ogreCompMgr->addWorkspaceDefinition(wsDefName);
+      workDef->connectExternal(0, nodeDefName, 0);
+      workDef->connectExternal(1, nodeDefName, 1);
+    }
+
+    Ogre::TextureGpuManager *textureMgr =
+        ogreRoot->getRenderSystem()->getTextureGpuManager();
+    this->dataPtr->bayerTexture = textureMgr->createTexture(
+        this->name + "_Bayer",
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+    this->dataPtr->bayerTexture->setResolution(
+        texture->getWidth(), texture->getHeight());
+    this->dataPtr->bayerTexture->setNumMipmaps(1u);
+    this->dataPtr->bayerTexture->setPixelFormat(Ogre::PFG_R8_UNORM);
+    this->dataPtr->bayerTexture->scheduleTransitionTo(
+        Ogre::GpuResidency::Resident);
+
+    Ogre::CompositorChannelVec externalTargets(2u);
+    externalTargets[0] = texture;
+    externalTargets[1] = this->dataPtr->bayerTexture;
+    this->dataPtr->bayerWorkspace = ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(), externalTargets, this->ogreCamera,
+        wsDefName, false);
+    this->dataPtr->bayerInput = texture;
+  }
+
+  Ogre::Pass *pass = ogreMat->getTechnique(0)->getPass(0);
+  pass->getFragmentProgramParameters()->setNamedConstant(
+      "channels", channels);
+
+  this->dataPtr->RenderWorkspace(this->dataPtr->bayerWorkspace, this->scene);
+
+  // the single channel result has the same layout as the Bayer image so
+  // copy it in place
+  Ogre::TextureGpu *bayerTexture = this->dataPtr->bayerTexture;
+  const Ogre::PixelFormatGpu dstOgrePf = Ogre::PFG_R8_UNORM;
+  Ogre::TextureBox dstBox(
+    bayerTexture->getInternalWidth(), bayerTexture->getInternalHeight(),
+    bayerTexture->getDepth(), bayerTexture->getNumSlices(),
+    static_cast<uint32_t>(
+      Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+    _image.RowStride(), _image.RowStride() * _image.Height());
+  dstBox.data = _image.Data();
+  this->dataPtr->CopyToMemory(
+      bayerTexture, bayerTexture->getEmptyBox(0u), dstBox, dstOgrePf);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::CopyResized(Image &_image) const
+{
+  const PixelFormat format = _image.Format();
+  if ((_image.Width() == this->width && _image.Height() == this->height) ||
+      _image.Width() == 0u || _image.Height() == 0u ||
+      this->dataPtr->resizePending || format == PF_BAYER_RGGB8 ||
+      format == PF_BAYER_BGGR8 || format == PF_BAYER_GBRG8 ||
+      format == PF_BAYER_GRBG8)
+  {
+    BaseRenderTarget::CopyResized(_image);
+    return;
+  }
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+  Ogre::TextureGpu *texture = this->RenderTarget();
+
+  // each output size keeps its own texture and workspace, recreated if the
+  // final result moved to a different texture
+  Ogre2RenderTargetPrivate::ResizeTarget &target =
+      this->dataPtr->resizeTargets[std::make_pair(
+      _image.Width(), _image.Height())];
+  if (target.input != texture || !target.texture ||
+      target.texture->getPixelFormat() != texture->getPixelFormat())
+  {
+    this->dataPtr->DestroyResizeTarget(target);
+
+    const std::string &wsDefName = this->dataPtr->kResizeWorkspaceDefName;
+    if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+    {
+      // the stock copy material samples the nearest texel, filter
+      // bilinearly instead so that downsampled outputs are smoother
+      const std::string &matName = this->dataPtr->kResizeMaterialName;
+      if (!Ogre::MaterialManager::getSingleton().getByName(matName))
+      {
+        Ogre::MaterialPtr copyMat =
+            Ogre::MaterialManager::getSingleton().getByName(
+            "Ogre/Copy/4xFP32");
+        Ogre::MaterialPtr resizeMat = copyMat->clone(matName);
+        resizeMat->load();
+        Ogre::HlmsSamplerblock samplerblock;
+        samplerblock.mMinFilter = Ogre::FO_LINEAR;
+        samplerblock.mMagFilter = Ogre::FO_LINEAR;
+        samplerblock.mMipFilter = Ogre::FO_NONE;
+        samplerblock.setAddressingMode(Ogre::TAM_CLAMP);
+        resizeMat->getTechnique(0)->getPass(0)->getTextureUnitState(0)->
+            setSamplerblock(samplerblock);
+      }
+
+      std::string nodeDefName = wsDefName + "/Node";
+      Ogre::CompositorNodeDef *nodeDef =
+          ogreCompMgr->addNodeDefinition(nodeDefName);
+      nodeDef->addTextureSourceName("rt_input", 0,
+          Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+      nodeDef->addTextureSourceName("rt_output", 1,
+          Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+      nodeDef->setNumTargetPass(1);
+      Ogre::CompositorTargetDef *targetDef =
+          nodeDef->addTargetPass("rt_output");
+      targetDef->setNumPasses(1);
+      {
+        // bilinear copy to the output size
+        Ogre::CompositorPassQuadDef *passQuad =
+            static_cast<Ogre::CompositorPassQuadDef *>(
+            targetDef->addPass(Ogre::PASS_QUAD));
+        passQuad->setAllLoadActions(Ogre::LoadAction::DontCare);
+        passQuad->mMaterialName = matName;
+        passQuad->addQuadTextureSource(0, "rt_input");
+      }
+
+      Ogre::CompositorWorkspaceDef *workDef =
+          ogreCompMgr->addWorkspaceDefinition(wsDefName);
+      workDef->connectExternal(0, nodeDefName, 0);
+      workDef->connectExternal(1, nodeDefName, 1);
+    }
+
+    Ogre::TextureGpuManager *textureMgr =
+        ogreRoot->getRenderSystem()->getTextureGpuManager();
+    target.texture = textureMgr->createTexture(
+        this->name + "_Resized_" + std::to_string(_image.Width()) + "x" +
+        std::to_string(_image.Height()),
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+    target.texture->setResolution(_image.Width(), _image.Height());
+    target.texture->setNumMipmaps(1u);
+    target.texture->setPixelFormat(texture->getPixelFormat());
+    target.texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+
+    Ogre::CompositorChannelVec externalTargets(2u);
+    externalTargets[0] = texture;
+    externalTargets[1] = target.texture;
+    target.workspace = ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(), externalTargets, this->ogreCamera,
+        wsDefName, false);
+    target.input = texture;
+  }
+
+  this->dataPtr->RenderWorkspace(target.workspace, this->scene);
+
+  // force a raw copy if the formats only differ in sRGB-ness, see Copy
+  Ogre::TextureGpu *resized = target.texture;
+  Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
+  if (Ogre::PixelFormatGpuUtils::isSRgb(resized->getPixelFormat()))
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentSRGB(dstOgrePf);
+  else
+    dstOgrePf = Ogre::PixelFormatGpuUtils::getEquivalentLinear(dstOgrePf);
+
+  Ogre::TextureBox dstBox(
+    _image.Width(), _image.Height(), 1u, 1u,
+    static_cast<uint32_t>(
+      Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+    _image.RowStride(), _image.RowStride() * _image.Height());
+  dstBox.data = _image.Data();
+  this->dataPtr->CopyToMemory(
+      resized, resized->getEmptyBox(0u), dstBox, dstOgrePf);
+}
+
 //////////////////////////////////////////////////
 Ogre::Camera *Ogre2RenderTarget::Camera() const
 {
@@ -489,9 +1191,37 @@ void Ogre2RenderTarget::SetAntiAliasing(unsigned int _aa)
   this->targetDirty = true;
 }
 
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetAntiAliasingMode(CameraAntiAliasingMode _mode)
+{
+  if (_mode == this->dataPtr->antiAliasingMode)
+    return;
+  this->dataPtr->antiAliasingMode = _mode;
+  this->targetDirty = true;
+}
+
+//////////////////////////////////////////////////
+CameraAntiAliasingMode Ogre2RenderTarget::AntiAliasingMode() const
+{
+  return this->dataPtr->antiAliasingMode;
+}
+
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::PreRender()
 {
+  // apply a held back size once it stopped changing
+  if (this->targetDirty)
+  {
+    this->dataPtr->resizePending = false;
+  }
+  else if (this->dataPtr->resizePending &&
+      std::chrono::steady_clock::now() - this->dataPtr->resizeTime >=
+      this->dataPtr->resizeDelay)
+  {
+    this->dataPtr->resizePending = false;
+    this->targetDirty = true;
+  }
+
   BaseRenderTarget::PreRender();
   this->UpdateBackgroundColor();
 
@@ -513,6 +1243,9 @@ void Ogre2RenderTarget::Render()
 {
   this->scene->StartRendering(this->ogreCamera);
 
+  this->dataPtr->UpdateShadowPolicy(this->ogreCompositorWorkspace,
+      this->scene);
+
   this->ogreCompositorWorkspace->_validateFinalTarget();
   this->ogreCompositorWorkspace->_beginUpdate(false);
   this->ogreCompositorWorkspace->_update();
@@ -537,6 +1270,7 @@ void Ogre2RenderTarget::DestroyTargetImpl()
   if (nullptr == this->dataPtr->ogreTexture[0])
     return;
 
+  this->dataPtr->readback.Destroy();
   this->DestroyCompositor();
 
   Ogre::Root *root = Ogre2RenderEngine::Instance()->OgreRoot();
@@ -636,9 +1370,27 @@ void Ogre2RenderTarget::PrepareForExternalSampling()
   renderSystem->flushCommands();
 }
 
+//////////////////////////////////////////////////
+size_t Ogre2RenderTarget::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->ogreCompositorWorkspace);
+  for (const Ogre::TextureGpu *texture : this->dataPtr->ogreTexture)
+    bytes += Ogre2RenderEngine::TextureSizeBytes(texture);
+  bytes += Ogre2RenderEngine::TextureSizeBytes(this->dataPtr->bayerTexture);
+  for (const auto &it : this->dataPtr->resizeTargets)
+    bytes += Ogre2RenderEngine::TextureSizeBytes(it.second.texture);
+  return bytes;
+}
+
 //////////////////////////////////////////////////
 uint8_t Ogre2RenderTarget::TargetFSAA() const
 {
+  if (!this->qualityProfile.antiAliasing ||
+      this->dataPtr->antiAliasingMode != CAAM_MSAA)
+  {
+    return 1u;
+  }
   return Ogre2RenderTarget::TargetFSAA(
     static_cast<uint8_t>(this->antiAliasing));
 }
@@ -697,6 +1449,84 @@ void Ogre2RenderTarget::SetVisibilityMask(uint32_t _mask)
   this->visibilityMask = _mask;
 }
 
+//////////////////////////////////////////////////
+const SensorQualityProfile &Ogre2RenderTarget::QualityProfile() const
+{
+  return this->qualityProfile;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetQualityProfile(
+    const SensorQualityProfile &_profile)
+{
+  this->qualityProfile = _profile;
+  this->targetDirty = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetRenderScale(double _scale)
+{
+  _scale = std::clamp(_scale, 0.01, 1.0);
+  if (std::abs(_scale - this->dataPtr->renderScale) < 1e-6)
+    return;
+  this->dataPtr->renderScale = _scale;
+  this->targetDirty = true;
+}
+
+//////////////////////////////////////////////////
+double Ogre2RenderTarget::RenderScale() const
+{
+  return this->dataPtr->renderScale;
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetWidth(const unsigned int _width)
+{
+  const bool wasDirty = this->targetDirty;
+  const bool changed = _width != this->width;
+  BaseRenderTarget::SetWidth(_width);
+  if (this->dataPtr->DeferResize(!this->IsRenderWindow() &&
+      this->dataPtr->ogreTexture[0] != nullptr, wasDirty, changed))
+  {
+    this->targetDirty = false;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetHeight(const unsigned int _height)
+{
+  const bool wasDirty = this->targetDirty;
+  const bool changed = _height != this->height;
+  BaseRenderTarget::SetHeight(_height);
+  if (this->dataPtr->DeferResize(!this->IsRenderWindow() &&
+      this->dataPtr->ogreTexture[0] != nullptr, wasDirty, changed))
+  {
+    this->targetDirty = false;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetResizeDelay(
+    std::chrono::steady_clock::duration _delay)
+{
+  this->dataPtr->resizeDelay =
+      std::max(_delay, std::chrono::steady_clock::duration::zero());
+
+  // without a delay a held back size is applied on the next render
+  if (this->dataPtr->resizePending &&
+      this->dataPtr->resizeDelay == std::chrono::steady_clock::duration::zero())
+  {
+    this->dataPtr->resizePending = false;
+    this->targetDirty = true;
+  }
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration Ogre2RenderTarget::ResizeDelay() const
+{
+  return this->dataPtr->resizeDelay;
+}
+
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::UpdateBackgroundColor()
 {
@@ -725,28 +1555,10 @@ void Ogre2RenderTarget::UpdateBackgroundMaterial()
   bool validBackground = this->backgroundMaterial &&
       !this->backgroundMaterial->EnvironmentMap().empty();
 
-  if (validBackground)
-  {
-    Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
-    std::string skyMatName = this->dataPtr->kSkyboxMaterialName + "_"
-        + this->Name();
-    auto mat = matManager.getByName(skyMatName);
-    if (!mat)
-    {
-      auto skyboxMat = matManager.getByName(this->dataPtr->kSkyboxMaterialName);
-      if (!skyboxMat)
-      {
-        gzerr << "Unable to find skybox material" << std::endl;
-        return;
-      }
-      mat = skyboxMat->clone(skyMatName);
-    }
-    Ogre::TextureUnitState *texUnit =
-        mat->getTechnique(0u)->getPass(0u)->getTextureUnitState(0u);
-    texUnit->setTextureName(this->backgroundMaterial->EnvironmentMap(),
-        Ogre::TextureTypes::TypeCube);
-    texUnit->setHardwareGammaEnabled(false);
-  }
+  // the sky material is shared by all cameras rendering the same sky
+  this->dataPtr->skyboxMaterialName = validBackground ?
+      Ogre2SkyBoxMaterial::Acquire(this->backgroundMaterial->EnvironmentMap()) :
+      std::string();
 
   this->backgroundMaterialDirty = false;
 }
@@ -780,12 +1592,75 @@ void Ogre2RenderTarget::UpdateRenderPassChain(
       _baseNode.empty() || _finalNode.empty() || _renderPasses.empty())
     return;
 
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  // The final node of render targets starts with a quad pass that copies
+  // the result of the last render pass. If that pass can be applied by a
+  // single quad pass, the final pass applies it instead of copying.
+  const std::string kCopyMaterialName = "Ogre/Copy/4xFP32";
+  Ogre::CompositorPassQuadDef *finalQuad = nullptr;
+  if (ogreCompMgr->hasNodeDefinition(_finalNode))
+  {
+    Ogre::CompositorNodeDef *finalNodeDef =
+        ogreCompMgr->getNodeDefinitionNonConst(_finalNode);
+    if (finalNodeDef->getNumTargetPasses() > 0u)
+    {
+      const Ogre::CompositorPassDefVec &passDefs =
+          finalNodeDef->getTargetPass(0u)->getCompositorPasses();
+      if (!passDefs.empty() && passDefs[0]->getType() == Ogre::PASS_QUAD)
+        finalQuad = static_cast<Ogre::CompositorPassQuadDef *>(passDefs[0]);
+    }
+  }
+  if (finalQuad && finalQuad->mMaterialName != kCopyMaterialName)
+  {
+    // keep final nodes that do more than copying untouched
+    bool fused = false;
+    for (const auto &pass : _renderPasses)
+    {
+      fused = fused || dynamic_cast<Ogre2RenderPass *>(
+          pass.get())->FusableMaterialName() == finalQuad->mMaterialName;
+    }
+    if (!fused)
+      finalQuad = nullptr;
+  }
+
+  // find the last enabled pass, which is fused into the final pass if
+  // possible
+  auto fusedPass = [&]() -> Ogre2RenderPass *
+  {
+    if (!finalQuad)
+      return nullptr;
+    for (auto it = _renderPasses.rbegin(); it != _renderPasses.rend(); ++it)
+    {
+      Ogre2RenderPass *ogre2RenderPass =
+          dynamic_cast<Ogre2RenderPass *>(it->get());
+      if (ogre2RenderPass->IsEnabled() &&
+          !ogre2RenderPass->OgreCompositorNodeDefinitionName().empty())
+      {
+        return ogre2RenderPass->FusableMaterialName().empty() ?
+            nullptr : ogre2RenderPass;
+      }
+    }
+    return nullptr;
+  };
+
   // check pass enabled state and update connections if necessary.
   // If render pass is dirty then skip the enabled state check since the whole
   // workspace nodes and connections will be recreated
   bool updateConnection = false;
+  if (!_recreateNodes && finalQuad)
+  {
+    // the final pass changes if a different pass, or none, is fused now
+    Ogre2RenderPass *fused = fusedPass();
+    std::string materialName =
+        fused ? fused->FusableMaterialName() : kCopyMaterialName;
+    _recreateNodes = materialName != finalQuad->mMaterialName;
+  }
   if (!_recreateNodes)
   {
+    Ogre2RenderPass *fused = finalQuad ? fusedPass() : nullptr;
     auto nodeSeq = _workspace->getNodeSequence();
 
     // set node instance to render pass and update enabled state
@@ -801,6 +1676,11 @@ void Ogre2RenderTarget::UpdateRenderPassChain(
       // if node does not exist then it means it either has not been added to
       // the chain yet or it was removed because it was disabled.
       // In both cases, we need to recreate the nodes and connections
+      if (ogre2RenderPass == fused)
+      {
+        // fused into the final pass, it has no node of its own
+        continue;
+      }
       if (!node && ogre2RenderPass->IsEnabled())
       {
         _recreateNodes = true;
@@ -816,10 +1696,6 @@ void Ogre2RenderTarget::UpdateRenderPassChain(
   if (!_recreateNodes && !updateConnection)
     return;
 
-  auto engine = Ogre2RenderEngine::Instance();
-  auto ogreRoot = engine->OgreRoot();
-  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
-
   Ogre::CompositorWorkspaceDef *workspaceDef =
     ogreCompMgr->getWorkspaceDefinition(_workspaceDefName);
 
@@ -842,16 +1718,26 @@ void Ogre2RenderTarget::UpdateRenderPassChain(
 
   int numActiveNodes = 0;
 
+  for (const auto &pass : _renderPasses)
+    dynamic_cast<Ogre2RenderPass *>(pass.get())->CreateRenderPass();
+
+  Ogre2RenderPass *fused = fusedPass();
+  if (finalQuad)
+  {
+    finalQuad->mMaterialName =
+        fused ? fused->FusableMaterialName() : kCopyMaterialName;
+  }
+
   // chain the render passes by connecting all the ogre compositor nodes
   // in between the base scene pass node and the final compositor node
   for (const auto &pass : _renderPasses)
   {
     Ogre2RenderPass *ogre2RenderPass =
         dynamic_cast<Ogre2RenderPass *>(pass.get());
-    ogre2RenderPass->CreateRenderPass();
     inNodeDefName = ogre2RenderPass->OgreCompositorNodeDefinitionName();
-    // only connect passes that are enabled
-    if (!inNodeDefName.empty() && ogre2RenderPass->IsEnabled())
+    // only connect passes that are enabled and not fused into the final pass
+    if (!inNodeDefName.empty() && ogre2RenderPass->IsEnabled() &&
+        ogre2RenderPass != fused)
     {
       workspaceDef->connect(outNodeDefName, inNodeDefName);
       outNodeDefName = inNodeDefName;
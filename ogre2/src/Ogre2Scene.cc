@@ -15,15 +15,29 @@
  *
  */
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
 #include <gz/common/Console.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/SubMesh.hh>
 
 #include "gz/rendering/base/SceneExt.hh"
 #include "gz/rendering/GraphicsAPI.hh"
 #include "gz/rendering/RenderTypes.hh"
+#include "gz/rendering/ShaderParams.hh"
 #include "gz/rendering/ogre2/Ogre2ArrowVisual.hh"
 #include "gz/rendering/ogre2/Ogre2AxisVisual.hh"
 #include "gz/rendering/ogre2/Ogre2BoundingBoxCamera.hh"
 #include "gz/rendering/ogre2/Ogre2Camera.hh"
+#include "gz/rendering/ogre2/Ogre2CameraArray.hh"
 #include "gz/rendering/ogre2/Ogre2Capsule.hh"
 #include "gz/rendering/ogre2/Ogre2COMVisual.hh"
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
@@ -43,7 +57,9 @@
 #include "gz/rendering/ogre2/Ogre2Material.hh"
 #include "gz/rendering/ogre2/Ogre2MeshFactory.hh"
 #include "gz/rendering/ogre2/Ogre2Node.hh"
+#include "gz/rendering/ogre2/Ogre2OceanVisual.hh"
 #include "gz/rendering/ogre2/Ogre2ParticleEmitter.hh"
+#include "gz/rendering/ogre2/Ogre2PointCloudVisual.hh"
 #include "gz/rendering/ogre2/Ogre2Projector.hh"
 #include "gz/rendering/ogre2/Ogre2RayQuery.hh"
 #include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
@@ -53,9 +69,14 @@
 #include "gz/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "gz/rendering/ogre2/Ogre2SegmentationCamera.hh"
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
+#include "gz/rendering/ogre2/Ogre2VoxelGridVisual.hh"
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 #include "gz/rendering/ogre2/Ogre2WireBox.hh"
 
+#include "Ogre2BakedSkeletonAnimation.hh"
+#include "Ogre2CameraAtlas.hh"
+#include "Ogre2ParticleNoiseListener.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
@@ -63,11 +84,18 @@
 #include <Compositor/Pass/PassClear/OgreCompositorPassClearDef.h>
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <Animation/OgreSkeletonDef.h>
+#include <Animation/OgreSkeletonInstance.h>
+#include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
 #include <OgreDepthBuffer.h>
+#include <OgreGpuProgramManager.h>
+#include <OgreGpuProgramParams.h>
 #include <OgreMatrix4.h>
 #include <OgrePlatformInformation.h>
+#include <OgreRenderSystem.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <Threading/OgreUniformScalableTask.h>
 #include <Overlay/OgreOverlayManager.h>
 #include <Overlay/OgreOverlaySystem.h>
 #if OGRE_VERSION_MAJOR == 2 && OGRE_VERSION_MINOR == 1
@@ -90,13 +118,53 @@ class gz::rendering::Ogre2ScenePrivate
   /// \brief Flag to indicate if sky is enabled or not
   public: bool skyEnabled = false;
 
+  /// \brief Flag to indicate if textures are streamed in the background
+  public: bool textureStreamingEnabled = false;
+
+  /// \brief Number of streamed textures materials are still waiting for
+  public: unsigned int pendingTextureLoads = 0u;
+
+  /// \brief Number of Ogre particle systems created by particle emitters
+  public: unsigned int particleSystemCount = 0u;
+
+  /// \brief Particle noise parameters of the current frame
+  public: std::unique_ptr<Ogre2ParticleNoise> particleNoise;
+
+  /// \brief Flag to indicate if identical materials share datablocks
+  public: bool materialSharingEnabled = false;
+
+  /// \brief Shared datablocks indexed by the key describing their content
+  public: std::unordered_map<std::string, Ogre::HlmsPbsDatablock *>
+      sharedDatablocks;
+
+  /// \brief Key and number of materials using each shared datablock
+  public: std::unordered_map<Ogre::HlmsPbsDatablock *,
+      std::pair<std::string, unsigned int>> sharedDatablockRefs;
+
+  /// \brief Counter used to generate unique shared datablock names
+  public: unsigned int sharedDatablockCounter = 0u;
+
+  /// \brief Baked skeleton animations indexed by skeleton definition,
+  /// animation name and sampling rate
+  public: std::map<std::tuple<std::string, std::string, double>,
+      std::weak_ptr<Ogre2BakedSkeletonAnimation>> bakedSkeletonAnimations;
+
   /// \brief Flag to alert the user its usage of PreRender/PostRender
   /// is incorrect
   public: bool frameUpdateStarted = false;
 
+  /// \brief Owns the render mutex of the engine from PreRender to
+  /// PostRender, see Ogre2RenderEngine::SceneThreading
+  public: std::unique_lock<std::recursive_mutex> renderLock;
+
   /// \brief Total time elapsed in simulation since last rendering frame
   public: std::chrono::steady_clock::duration lastRenderSimTime{0};
 
+  /// \brief Time the first frame started, recorded in the load trace of
+  /// the engine since it includes compiling the shaders of the scene
+  public: std::optional<std::chrono::steady_clock::time_point>
+      firstFrameStart;
+
   /// \brief Keeps track how many passes we've done so far and
   /// compares it to cameraPassCountPerGpuFlush
   public: uint32_t currNumCameraPasses = 0u;
@@ -104,6 +172,10 @@ class gz::rendering::Ogre2ScenePrivate
   /// \brief Flag to indicate if we should flush GPU very often (per camera)
   public: uint8_t cameraPassCountPerGpuFlush = 6u;
 
+  /// \brief True while inside RenderSensors. Sensors only queue up work
+  /// and the flush happens once all of them have rendered
+  public: bool batchRendering = false;
+
   /// \brief Name of shadow compositor node
   public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
 
@@ -112,6 +184,206 @@ class gz::rendering::Ogre2ScenePrivate
 
   /// \brief See Ogre2Scene::SetLightsGiDirty
   public: bool lightsGiDirty = false;
+
+  /// \brief First directional light, see PrimaryDirectionalLight
+  public: std::weak_ptr<Ogre2DirectionalLight> primaryDirectionalLight;
+
+  /// \brief True if the primary directional light must be looked up again,
+  /// see SetLightListDirty
+  public: bool lightListDirty = true;
+
+  /// \brief Incremented every time the scene graph changes.
+  /// See Ogre2Scene::SetSceneGraphDirty
+  public: uint64_t sceneGraphGeneration = 1u;
+
+  /// \brief Atlas the images of RenderCameraAtlas are downloaded with
+  public: Ogre2CameraAtlas cameraAtlas;
+
+  /// \brief Environment shown while each camera renders, set during
+  /// RenderEnvironments
+  public: std::unordered_map<Camera *, VisualPtr> cameraEnvironments;
+
+  /// \brief See Ogre2Scene::SetRenderOrigin
+  public: math::Vector3d renderOrigin = math::Vector3d::Zero;
+
+  /// \brief Number of items tested for occlusion in the current frame
+  public: uint64_t occlusionTested = 0u;
+
+  /// \brief Number of items found occluded in the current frame
+  public: uint64_t occlusionCulled = 0u;
+
+  /// \brief Mesh of a static visual replaced by a batch
+  public: struct BakedMesh
+  {
+    /// \brief The mesh, it is hidden from cameras while baked
+    std::weak_ptr<Ogre2Mesh> mesh;
+
+    /// \brief Visibility flags of the mesh's item before it was baked
+    uint32_t visibilityFlags = 0u;
+  };
+
+  /// \brief Meshes replaced by the batches of BakeStaticVisuals
+  public: std::vector<BakedMesh> bakedMeshes;
+
+  /// \brief Visuals drawing the batches of BakeStaticVisuals
+  public: std::vector<VisualPtr> staticBatches;
+
+  /// \brief Vertices of the batches, the batch meshes are created from
+  public: std::vector<std::unique_ptr<common::Mesh>> staticBatchMeshes;
+
+  /// \brief Number of batches created so far, used to name them
+  public: unsigned int staticBatchCount = 0u;
+
+  /// \brief Nesting level of SetStaticBatchesBypassed(true)
+  public: unsigned int staticBatchBypass = 0u;
+
+  /// \brief Value of sceneGraphGeneration at the last scene graph update
+  public: uint64_t updatedSceneGraphGeneration = 0u;
+
+  /// \brief Sim time of the last scene graph update
+  public: std::chrono::steady_clock::duration updatedSceneGraphTime{0};
+
+  /// \brief See Ogre2Scene::SharedShaderParams
+  public: ShaderParamsPtr sharedShaderParams =
+      std::make_shared<ShaderParams>();
+
+  /// \brief Ogre shared params the shared shader params and per frame
+  /// built-in uniforms are written to. Created when the first custom
+  /// shader is bound.
+  public: Ogre::GpuSharedParametersPtr ogreSharedParams;
+
+  /// \brief Sim time the per frame built-in uniforms were last written at
+  public: std::chrono::steady_clock::duration sharedParamsTime{0};
+
+  /// \brief Get the Ogre shared params, creating them if needed
+  /// \param[in] _sceneName Name of the scene, Ogre shared params are
+  /// global
+  /// \return Ogre shared params
+  public: Ogre::GpuSharedParametersPtr OgreSharedParams(
+      const std::string &_sceneName)
+  {
+    if (!this->ogreSharedParams)
+    {
+      auto &manager = Ogre::GpuProgramManager::getSingleton();
+      const std::string name = "gz_frame_" + _sceneName;
+      const auto &available = manager.getAvailableSharedParameters();
+      auto it = available.find(name);
+      if (it != available.end())
+      {
+        this->ogreSharedParams = it->second;
+      }
+      else
+      {
+        this->ogreSharedParams = manager.createSharedParameters(name);
+        this->ogreSharedParams->addConstantDefinition("gz_sim_time",
+            Ogre::GCT_FLOAT1);
+        this->ogreSharedParams->addConstantDefinition("gz_delta_time",
+            Ogre::GCT_FLOAT1);
+      }
+    }
+    return this->ogreSharedParams;
+  }
+
+  /// \brief Write the per frame built-in uniforms and the shared shader
+  /// params that changed to the Ogre shared params
+  /// \param[in] _time Current sim time
+  public: void UpdateSharedShaderParams(
+      std::chrono::steady_clock::duration _time)
+  {
+    // no custom shader uses them yet
+    if (!this->ogreSharedParams)
+      return;
+
+    const double delta = std::chrono::duration<double>(
+        _time - this->sharedParamsTime).count();
+    this->sharedParamsTime = _time;
+    this->ogreSharedParams->setNamedConstant("gz_sim_time",
+        static_cast<float>(std::chrono::duration<double>(_time).count()));
+    this->ogreSharedParams->setNamedConstant("gz_delta_time",
+        static_cast<float>(std::max(delta, 0.0)));
+
+    if (!this->sharedShaderParams->IsDirty())
+      return;
+
+    const Ogre::GpuConstantDefinitionMap &definitions =
+        this->ogreSharedParams->getConstantDefinitions().map;
+    for (const auto &name_param : *this->sharedShaderParams)
+    {
+      const std::string &name = name_param.first;
+      const ShaderParam &param = name_param.second;
+      if (name.rfind("gz_", 0) == 0)
+      {
+        gzwarn << "Shared shader param [" << name << "] uses the reserved "
+               << "prefix gz_ and is ignored" << std::endl;
+        continue;
+      }
+
+      Ogre::GpuConstantType type;
+      size_t arraySize = 1u;
+      switch (param.Type())
+      {
+        case ShaderParam::PARAM_FLOAT:
+          type = Ogre::GCT_FLOAT1;
+          break;
+        case ShaderParam::PARAM_INT:
+          type = Ogre::GCT_INT1;
+          break;
+        case ShaderParam::PARAM_FLOAT_BUFFER:
+          type = param.Count() % 4u ? Ogre::GCT_FLOAT1 : Ogre::GCT_FLOAT4;
+          arraySize = param.Count() % 4u ? param.Count() : param.Count() / 4u;
+          break;
+        case ShaderParam::PARAM_INT_BUFFER:
+          type = param.Count() % 4u ? Ogre::GCT_INT1 : Ogre::GCT_INT4;
+          arraySize = param.Count() % 4u ? param.Count() : param.Count() / 4u;
+          break;
+        case ShaderParam::PARAM_NONE:
+          continue;
+        default:
+          gzwarn << "Shared shader param [" << name << "] must be a float, "
+                 << "an int or a buffer of them" << std::endl;
+          continue;
+      }
+
+      auto it = definitions.find(name);
+      if (it != definitions.end() && (it->second.constType != type ||
+          it->second.arraySize != arraySize))
+      {
+        this->ogreSharedParams->removeConstantDefinition(name);
+        it = definitions.end();
+      }
+      if (it == definitions.end())
+        this->ogreSharedParams->addConstantDefinition(name, type, arraySize);
+
+      if (ShaderParam::PARAM_FLOAT == param.Type())
+      {
+        float value;
+        param.Value(&value);
+        this->ogreSharedParams->setNamedConstant(name, value);
+      }
+      else if (ShaderParam::PARAM_INT == param.Type())
+      {
+        int value;
+        param.Value(&value);
+        this->ogreSharedParams->setNamedConstant(name, value);
+      }
+      else
+      {
+        std::shared_ptr<void> buffer;
+        param.Buffer(buffer);
+        if (ShaderParam::PARAM_FLOAT_BUFFER == param.Type())
+        {
+          this->ogreSharedParams->setNamedConstant(name,
+              reinterpret_cast<const float *>(buffer.get()), param.Count());
+        }
+        else
+        {
+          this->ogreSharedParams->setNamedConstant(name,
+              reinterpret_cast<const int *>(buffer.get()), param.Count());
+        }
+      }
+    }
+    this->sharedShaderParams->ClearDirty();
+  }
 };
 
 using namespace gz;
@@ -207,6 +479,35 @@ void Ogre2Scene::SetBackgroundColor(const math::Color &_color)
 //////////////////////////////////////////////////
 void Ogre2Scene::PreRender()
 {
+  auto engine = Ogre2RenderEngine::Instance();
+  if (this->stats.frameCount == 0u && !this->dataPtr->firstFrameStart &&
+      engine->Trace().Enabled())
+  {
+    this->dataPtr->firstFrameStart = std::chrono::steady_clock::now();
+  }
+  // held in a local lock until PreRender returns, so that an exception
+  // thrown while preparing the frame releases it
+  std::unique_lock<std::recursive_mutex> renderLock;
+  if (engine->SceneThreading() && !this->dataPtr->renderLock.owns_lock())
+  {
+    // legacy mode may never call PostRender to release the lock
+    if (this->LegacyAutoGpuFlush())
+    {
+      if (this->Diagnostics().RaiseOnce("Scene/legacySceneThreading"))
+      {
+        gzerr << "Scene threading requires calling Scene::PostRender, "
+              << "scene [" << this->Name() << "] is rendered without "
+              << "locking. See Scene::SetCameraPassCountPerGpuFlush"
+              << std::endl;
+      }
+    }
+    else
+    {
+      renderLock = std::unique_lock<std::recursive_mutex>(
+          engine->RenderMutex());
+    }
+  }
+
   GZ_ASSERT((this->LegacyAutoGpuFlush() ||
               this->dataPtr->frameUpdateStarted == false),
              "Scene::PreRender called again before calling Scene::PostRender. "
@@ -231,9 +532,10 @@ void Ogre2Scene::PreRender()
 
   BaseScene::PreRender();
 
+  this->dataPtr->UpdateSharedShaderParams(this->Time());
+
   if (!this->LegacyAutoGpuFlush())
   {
-    auto engine = Ogre2RenderEngine::Instance();
     const auto currTime = this->Time();
     Ogre::FrameEvent evt;
     evt.timeSinceLastEvent = 0;  // Not used by Ogre so we don't care
@@ -244,7 +546,7 @@ void Ogre2Scene::PreRender()
       1000000000.0);
     engine->OgreRoot()->_fireFrameStarted(evt);
 
-    this->ogreSceneManager->updateSceneGraph();
+    this->UpdateSceneGraph();
   }
 
   if (this->dataPtr->lightsGiDirty)
@@ -255,33 +557,47 @@ void Ogre2Scene::PreRender()
 
   if (this->dataPtr->currNumCameraPasses == 0u && this->dataPtr->activeGi)
     this->dataPtr->activeGi->UpdateCamera();
+
+  if (renderLock.owns_lock())
+    this->dataPtr->renderLock = std::move(renderLock);
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::PostRender()
 {
+  // released when PostRender returns or throws
+  std::unique_lock<std::recursive_mutex> renderLock(
+      std::move(this->dataPtr->renderLock));
+
   GZ_ASSERT((this->LegacyAutoGpuFlush() ||
               this->dataPtr->frameUpdateStarted == true),
              "Scene::PostRender called again before calling Scene::PreRender. "
              "See Scene::SetCameraPassCountPerGpuFlush for details");
   this->dataPtr->frameUpdateStarted = false;
 
-  if (dataPtr->cameraPassCountPerGpuFlush == 0u)
+  if (this->LegacyAutoGpuFlush())
   {
-    gzwarn << "Calling Scene::PostRender but "
-               "SetCameraPassCountPerGpuFlush is 0 (legacy mode for clients"
-               " not calling PostRender)."
-               "Read the documentation on SetCameraPassCountPerGpuFlush, "
-               "you very likely want to increase this number" << std::endl;
+    if (this->Diagnostics().RaiseOnce("Scene/legacyAutoGpuFlush"))
+    {
+      gzwarn << "Calling Scene::PostRender but "
+                 "SetCameraPassCountPerGpuFlush is 0 (legacy mode for clients"
+                 " not calling PostRender)."
+                 "Read the documentation on SetCameraPassCountPerGpuFlush, "
+                 "you very likely want to increase this number" << std::endl;
+    }
   }
   else
   {
     if (this->dataPtr->currNumCameraPasses > 0u)
     {
+      const auto flushStart = std::chrono::steady_clock::now();
       this->FlushGpuCommandsAndStartNewFrame(0u, true);
+      this->stats.flushTime = std::chrono::steady_clock::now() - flushStart;
     }
     else
     {
+      this->stats.flushTime = std::chrono::steady_clock::duration::zero();
+
       // Every camera already calls FlushGpuCommandsAndStartNewFrame(false)
       // right after rendering. So likely commands are already flushed.
       //
@@ -290,6 +606,23 @@ void Ogre2Scene::PostRender()
       this->EndFrame();
     }
   }
+
+  // the frame was submitted, drop the targets of sensors left idle
+  if (this->sensorReleaseTime > std::chrono::steady_clock::duration::zero())
+    this->ReleaseSensorRenderTextures(this->sensorReleaseTime);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::ReleaseSensorRenderTextures(
+    std::chrono::steady_clock::duration _idleTime)
+{
+  if (this->dataPtr->frameUpdateStarted)
+  {
+    gzerr << "Scene::ReleaseSensorRenderTextures called between "
+          << "Scene::PreRender and Scene::PostRender" << std::endl;
+    return 0u;
+  }
+  return BaseScene::ReleaseSensorRenderTextures(_idleTime);
 }
 
 //////////////////////////////////////////////////
@@ -297,7 +630,7 @@ void Ogre2Scene::StartForcedRender()
 {
   if (this->LegacyAutoGpuFlush() || !this->dataPtr->frameUpdateStarted)
   {
-    this->ogreSceneManager->updateSceneGraph();
+    this->UpdateSceneGraph();
   }
 }
 
@@ -341,7 +674,7 @@ void Ogre2Scene::StartRendering(Ogre::Camera *_camera)
       1000000000.0);
     engine->OgreRoot()->_fireFrameStarted(evt);
 
-    this->ogreSceneManager->updateSceneGraph();
+    this->UpdateSceneGraph();
   }
   else
   {
@@ -359,10 +692,14 @@ void Ogre2Scene::StartRendering(Ogre::Camera *_camera)
   // results
   //
   // We don't want placeholder textures to be used; thus wait until all
-  // textures being loaded are done.
-  Ogre::RenderSystem *renderSys =
-    this->ogreSceneManager->getDestinationRenderSystem();
-  renderSys->getTextureGpuManager()->waitForStreamingCompletion();
+  // textures being loaded are done, unless the user opted in to texture
+  // streaming.
+  if (!this->dataPtr->textureStreamingEnabled)
+  {
+    Ogre::RenderSystem *renderSys =
+      this->ogreSceneManager->getDestinationRenderSystem();
+    renderSys->getTextureGpuManager()->waitForStreamingCompletion();
+  }
 #endif
 }
 
@@ -372,6 +709,10 @@ void Ogre2Scene::FlushGpuCommandsAndStartNewFrame(uint8_t _numPasses,
 {
   this->dataPtr->currNumCameraPasses += _numPasses;
 
+  // RenderSensors flushes once all sensors have rendered
+  if (this->dataPtr->batchRendering && !_startNewFrame)
+    return;
+
   if (this->dataPtr->currNumCameraPasses >= dataPtr->cameraPassCountPerGpuFlush
       || _startNewFrame)
   {
@@ -428,6 +769,13 @@ void Ogre2Scene::EndFrame()
   ogreRoot->_fireFrameRenderingQueued(evt);
   this->dataPtr->lastRenderSimTime = currTime;
 
+  // lights left in the light list after culling against the cameras
+  this->stats.lights = this->LightCount();
+  const size_t visibleLights =
+      this->ogreSceneManager->getGlobalLightList().lights.size();
+  this->stats.culledLights = this->stats.lights > visibleLights ?
+      this->stats.lights - visibleLights : 0u;
+
   auto itor = ogreRoot->getSceneManagerIterator();
   while (itor.hasMoreElements())
   {
@@ -435,6 +783,38 @@ void Ogre2Scene::EndFrame()
     sceneManager->clearFrameData();
   }
 
+  // record the counters of the frame and start counting the next one
+  Ogre::RenderSystem *renderSystem = ogreRoot->getRenderSystem();
+  const Ogre::RenderingMetrics &metrics = renderSystem->getMetrics();
+  this->stats.drawCalls = metrics.mDrawCount;
+  this->stats.batches = metrics.mBatchCount;
+  this->stats.instances = metrics.mInstanceCount;
+  this->stats.triangles = metrics.mFaceCount;
+  this->stats.vertices = metrics.mVertexCount;
+  this->stats.occlusionTested = this->dataPtr->occlusionTested;
+  this->stats.occlusionCulled = this->dataPtr->occlusionCulled;
+  this->dataPtr->occlusionTested = 0u;
+  this->dataPtr->occlusionCulled = 0u;
+  if (this->stats.frameCount == 0u && this->dataPtr->firstFrameStart)
+  {
+    LoadTrace &trace = Ogre2RenderEngine::Instance()->Trace();
+    LoadTraceEvent event;
+    event.name = "Ogre2Scene::FirstFrame";
+    event.category = "shader";
+    event.detail = this->Name();
+    event.start = *this->dataPtr->firstFrameStart - trace.Origin();
+    event.duration =
+        std::chrono::steady_clock::now() - *this->dataPtr->firstFrameStart;
+    trace.Record(event);
+  }
+  this->stats.frameCount++;
+  renderSystem->_resetMetrics();
+
+  if (this->dataPtr->particleNoise)
+    this->dataPtr->particleNoise->NextFrame();
+
+  Ogre2RenderEngine::Instance()->CheckMemoryWarning();
+
   ogreRoot->_fireFrameEnded(evt);
 }
 
@@ -453,12 +833,486 @@ uint8_t Ogre2Scene::CameraPassCountPerGpuFlush() const
 //////////////////////////////////////////////////
 bool Ogre2Scene::LegacyAutoGpuFlush() const
 {
-  return this->dataPtr->cameraPassCountPerGpuFlush == 0u;
+  // a batch is always rendered as a single frame
+  return this->dataPtr->cameraPassCountPerGpuFlush == 0u &&
+      !this->dataPtr->batchRendering;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::RenderSensors(const std::vector<SensorPtr> &_sensors)
+{
+  GZ_ASSERT(this->dataPtr->frameUpdateStarted == false,
+             "Scene::RenderSensors called between Scene::PreRender and "
+             "Scene::PostRender");
+
+  std::vector<CameraPtr> cameras = this->RenderableCameras(_sensors);
+  if (cameras.empty())
+    return;
+
+  this->dataPtr->batchRendering = true;
+  this->PreRender();
+  this->RemoveUnchangedCameras(cameras);
+
+  // queue up the passes of all sensors
+  for (auto &camera : cameras)
+  {
+    // cameras cull the scene when they render, so only the environment
+    // shown at that time ends up in their image
+    VisualPtr environment;
+    auto envIt = this->dataPtr->cameraEnvironments.find(camera.get());
+    if (envIt != this->dataPtr->cameraEnvironments.end())
+      environment = envIt->second;
+
+    if (environment)
+      environment->SetVisible(true);
+    camera->Render();
+    if (environment)
+      environment->SetVisible(false);
+  }
+
+  // submit everything at once so the GPU is already busy with the
+  // remaining sensors while the first ones are read back
+  this->dataPtr->currNumCameraPasses = 0u;
+  this->FlushGpuCommandsOnly();
+
+  for (auto &camera : cameras)
+  {
+    camera->PostRender();
+    camera->ClearCaptureRequest();
+  }
+
+  this->PostRender();
+  this->dataPtr->batchRendering = false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::RenderCameraAtlas(const std::vector<CameraPtr> &_cameras,
+    const CameraAtlasCallback &_callback)
+{
+  GZ_ASSERT(this->dataPtr->frameUpdateStarted == false,
+             "Scene::RenderCameraAtlas called between Scene::PreRender and "
+             "Scene::PostRender");
+
+  // the atlas only packs color cameras rendering to a texture, lists with
+  // other cameras are read back one by one
+  std::vector<SensorPtr> sensors;
+  for (const CameraPtr &camera : _cameras)
+  {
+    Ogre2CameraPtr ogreCamera = std::dynamic_pointer_cast<Ogre2Camera>(camera);
+    if (!ogreCamera || !ogreCamera->renderTexture ||
+        ogreCamera->renderTexture->IsRenderWindow())
+    {
+      BaseScene::RenderCameraAtlas(_cameras, _callback);
+      return;
+    }
+  }
+  // the cameras are read back below even if nothing else listens
+  for (const CameraPtr &camera : _cameras)
+  {
+    camera->RequestCapture();
+    sensors.push_back(camera);
+  }
+
+  this->RenderSensors(sensors);
+
+  std::vector<Ogre::TextureGpu *> textures;
+  std::vector<unsigned int> indices;
+  for (unsigned int i = 0; i < _cameras.size(); ++i)
+  {
+    if (!this->HasSensor(_cameras[i]))
+      continue;
+
+    Ogre2CameraPtr ogreCamera =
+        std::dynamic_pointer_cast<Ogre2Camera>(_cameras[i]);
+    Ogre::TextureGpu *texture = ogreCamera->renderTexture->RenderTarget();
+    if (!texture)
+      continue;
+
+    textures.push_back(texture);
+    indices.push_back(i);
+  }
+
+  // render textures are always RGBA8, see Ogre2RenderTarget::BuildTargetImpl
+  this->dataPtr->cameraAtlas.Download(textures, PF_R8G8B8A8,
+      [&](unsigned int _index, const FrameView &_view)
+      {
+        _callback(indices[_index], _view);
+      });
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::RenderEnvironments(
+    const std::vector<VisualPtr> &_environments,
+    const std::vector<CameraPtr> &_cameras,
+    const CameraAtlasCallback &_callback)
+{
+  if (_environments.size() != _cameras.size())
+  {
+    BaseScene::RenderEnvironments(_environments, _cameras, _callback);
+    return;
+  }
+
+  std::vector<bool> visible;
+  for (unsigned int i = 0; i < _environments.size(); ++i)
+  {
+    const VisualPtr &environment = _environments[i];
+    visible.push_back(environment && environment->Visible());
+    if (!visible.back())
+      continue;
+    environment->SetVisible(false);
+    if (_cameras[i])
+      this->dataPtr->cameraEnvironments[_cameras[i].get()] = environment;
+  }
+
+  this->RenderCameraAtlas(_cameras, _callback);
+  this->dataPtr->cameraEnvironments.clear();
+
+  for (unsigned int i = 0; i < _environments.size(); ++i)
+  {
+    if (_environments[i])
+      _environments[i]->SetVisible(visible[i]);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::PreloadMeshes(const std::vector<MeshDescriptor> &_descs)
+{
+  GZ_ASSERT(this->dataPtr->frameUpdateStarted == false,
+             "Scene::PreloadMeshes called between Scene::PreRender and "
+             "Scene::PostRender");
+
+  this->meshFactory->Preload(_descs);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::BakeStaticVisuals()
+{
+  GZ_ASSERT(this->dataPtr->frameUpdateStarted == false,
+             "Scene::BakeStaticVisuals called between Scene::PreRender and "
+             "Scene::PostRender");
+
+  this->UnbakeStaticVisuals();
+
+  // vertex count above which a batch is split, larger batches stop paying
+  // off once frustum culling can no longer skip parts of the world
+  const unsigned int kMaxBatchVertices = 65536u;
+
+  /// \brief Submesh of a static visual to bake
+  struct BakeSource
+  {
+    /// \brief Mesh the submesh belongs to
+    std::shared_ptr<Ogre2Mesh> mesh;
+
+    /// \brief Vertices of the submesh, in the mesh frame
+    std::shared_ptr<common::SubMesh> subMesh;
+
+    /// \brief World pose of the mesh
+    math::Pose3d pose;
+
+    /// \brief World scale of the mesh
+    math::Vector3d scale;
+  };
+
+  /// \brief Submeshes baked into the same batches
+  struct BakeGroup
+  {
+    /// \brief Material shared by the submeshes
+    MaterialPtr material;
+
+    /// \brief Submeshes of the group
+    std::vector<BakeSource> sources;
+  };
+
+  // submeshes can only be merged if they are drawn with the same datablock,
+  // have the same vertex format and are seen by the same cameras
+  using BakeKey = std::tuple<Ogre::HlmsDatablock *, bool, uint32_t>;
+  std::map<BakeKey, BakeGroup> groups;
+
+  for (unsigned int i = 0; i < this->VisualCount(); ++i)
+  {
+    VisualPtr visual = this->VisualByIndex(i);
+    if (!visual || !visual->Static())
+      continue;
+
+    const math::Vector3d scale = visual->WorldScale();
+    if (math::equal(scale.X(), 0.0) || math::equal(scale.Y(), 0.0) ||
+        math::equal(scale.Z(), 0.0))
+    {
+      continue;
+    }
+    const math::Pose3d pose = visual->WorldPose();
+
+    for (unsigned int j = 0; j < visual->GeometryCount(); ++j)
+    {
+      auto mesh = std::dynamic_pointer_cast<Ogre2Mesh>(
+          visual->GeometryByIndex(j));
+      if (!mesh || mesh->HasSkeleton())
+        continue;
+
+      Ogre::MovableObject *item = mesh->OgreObject();
+      if (!item || !item->getVisible() || item->getVisibilityFlags() == 0u)
+        continue;
+
+      // meshes with levels of detail are cheaper drawn on their own
+      MeshDescriptor desc = mesh->Descriptor();
+      desc.Load();
+      if (!desc.mesh || !desc.lodDistances.empty())
+        continue;
+
+      // the submeshes of the common mesh that were loaded, in the order of
+      // the rendering submeshes, see Ogre2MeshFactory
+      std::vector<std::shared_ptr<common::SubMesh>> subMeshes;
+      for (unsigned int k = 0; k < desc.mesh->SubMeshCount(); ++k)
+      {
+        auto s = desc.mesh->SubMeshByIndex(k).lock();
+        if (!s || (!desc.subMeshName.empty() && s->Name() != desc.subMeshName))
+          continue;
+        auto subMesh = std::make_shared<common::SubMesh>(*s);
+        if (desc.centerSubMesh)
+          subMesh->Center(math::Vector3d::Zero);
+        subMeshes.push_back(subMesh);
+      }
+      if (subMeshes.empty() || subMeshes.size() != mesh->SubMeshCount())
+        continue;
+
+      // a mesh is baked entirely or not at all, since hiding it hides all
+      // of its submeshes
+      std::vector<std::pair<BakeKey, BakeSource>> sources;
+      for (unsigned int k = 0; k < subMeshes.size(); ++k)
+      {
+        auto &subMesh = subMeshes[k];
+        auto renderSubMesh = std::dynamic_pointer_cast<Ogre2SubMesh>(
+            mesh->SubMeshByIndex(k));
+        if (!renderSubMesh || !renderSubMesh->Material() ||
+            !renderSubMesh->Ogre2SubItem() ||
+            subMesh->SubMeshPrimitiveType() != common::SubMesh::TRIANGLES ||
+            subMesh->VertexCount() == 0u ||
+            subMesh->VertexCount() > kMaxBatchVertices ||
+            subMesh->IndexCount() == 0u ||
+            subMesh->NormalCount() != subMesh->VertexCount() ||
+            subMesh->TexCoordSetCount() > 1u)
+        {
+          sources.clear();
+          break;
+        }
+        const bool hasTexCoords = subMesh->TexCoordSetCount() == 1u &&
+            subMesh->TexCoordCountBySet(0u) == subMesh->VertexCount();
+        BakeKey key(renderSubMesh->Ogre2SubItem()->getDatablock(),
+            hasTexCoords, item->getVisibilityFlags());
+        sources.push_back({key, {mesh, subMesh, pose, scale}});
+        if (!groups[key].material)
+          groups[key].material = renderSubMesh->Material();
+      }
+
+      for (auto &source : sources)
+        groups[source.first].sources.push_back(source.second);
+    }
+  }
+
+  // don't replace a mesh by a batch if it would be the only one in it
+  std::set<Ogre2Mesh *> unbatched;
+  for (auto &[key, group] : groups)
+  {
+    if (group.sources.size() == 1u)
+      unbatched.insert(group.sources.front().mesh.get());
+  }
+
+  std::map<Ogre2Mesh *, std::shared_ptr<Ogre2Mesh>> bakedMeshes;
+  unsigned int batchCount = 0u;
+  for (auto &[key, group] : groups)
+  {
+    auto &sources = group.sources;
+    sources.erase(std::remove_if(sources.begin(), sources.end(),
+        [&unbatched](const BakeSource &_source)
+        {
+          return unbatched.count(_source.mesh.get()) > 0u;
+        }), sources.end());
+
+    const bool hasTexCoords = std::get<1>(key);
+    size_t next = 0u;
+    while (next < sources.size())
+    {
+      common::SubMesh batch;
+      batch.SetPrimitiveType(common::SubMesh::TRIANGLES);
+      for (; next < sources.size(); ++next)
+      {
+        const BakeSource &source = sources[next];
+        const common::SubMesh &subMesh = *source.subMesh;
+        if (batch.VertexCount() > 0u && batch.VertexCount() +
+            subMesh.VertexCount() > kMaxBatchVertices)
+        {
+          break;
+        }
+
+        const unsigned int offset = batch.VertexCount();
+        for (unsigned int v = 0; v < subMesh.VertexCount(); ++v)
+        {
+          batch.AddVertex(source.pose.Pos() + source.pose.Rot() *
+              (source.scale * subMesh.Vertex(v)));
+          // normals transform with the inverse transpose of the scale
+          batch.AddNormal((source.pose.Rot() *
+              (subMesh.Normal(v) / source.scale)).Normalize());
+          if (hasTexCoords)
+            batch.AddTexCoord(subMesh.TexCoordBySet(v, 0u));
+        }
+        for (unsigned int n = 0; n < subMesh.IndexCount(); ++n)
+          batch.AddIndex(offset + subMesh.Index(n));
+
+        bakedMeshes[source.mesh.get()] = source.mesh;
+      }
+
+      auto batchMesh = std::make_unique<common::Mesh>();
+      batchMesh->SetName("__gz_static_batch_" +
+          std::to_string(this->dataPtr->staticBatchCount++) + "__");
+      batchMesh->AddSubMesh(batch);
+
+      MeshPtr batchGeom = this->CreateMesh(MeshDescriptor(batchMesh.get()));
+      if (!batchGeom)
+        continue;
+      VisualPtr batchVisual = this->CreateVisual();
+      batchVisual->AddGeometry(batchGeom);
+      batchVisual->SetMaterial(group.material, false);
+      batchVisual->SetVisibilityFlags(std::get<2>(key));
+      batchVisual->SetStatic(true);
+      this->RootVisual()->AddChild(batchVisual);
+
+      // ray queries hit the original visuals, see RayQuery
+      auto batchItem = std::dynamic_pointer_cast<Ogre2Mesh>(batchGeom);
+      if (batchItem && batchItem->OgreObject())
+        batchItem->OgreObject()->setQueryFlags(0u);
+
+      this->dataPtr->staticBatches.push_back(batchVisual);
+      this->dataPtr->staticBatchMeshes.push_back(std::move(batchMesh));
+      ++batchCount;
+    }
+  }
+
+  // hide the baked meshes from all cameras. Their items stay visible so
+  // that ray queries and bounding boxes still find them.
+  for (auto &[ptr, mesh] : bakedMeshes)
+  {
+    Ogre::MovableObject *item = mesh->OgreObject();
+    this->dataPtr->bakedMeshes.push_back(
+        {mesh, item->getVisibilityFlags()});
+    item->setVisibilityFlags(0u);
+  }
+
+  if (batchCount > 0u)
+  {
+    gzdbg << "Baked [" << bakedMeshes.size() << "] static meshes of scene ["
+          << this->Name() << "] into [" << batchCount << "] batches"
+          << std::endl;
+  }
+  this->SetSceneGraphDirty();
+  return batchCount;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UnbakeStaticVisuals()
+{
+  if (this->dataPtr->staticBatches.empty())
+    return;
+
+  for (auto &baked : this->dataPtr->bakedMeshes)
+  {
+    auto mesh = baked.mesh.lock();
+    if (mesh && mesh->OgreObject())
+      mesh->OgreObject()->setVisibilityFlags(baked.visibilityFlags);
+  }
+  for (auto &batch : this->dataPtr->staticBatches)
+    this->DestroyVisual(batch, true);
+
+  this->dataPtr->bakedMeshes.clear();
+  this->dataPtr->staticBatches.clear();
+  this->dataPtr->staticBatchMeshes.clear();
+  this->dataPtr->staticBatchBypass = 0u;
+  this->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetStaticBatchesBypassed(bool _bypassed)
+{
+  if (this->dataPtr->staticBatches.empty())
+    return;
+
+  // only the outermost call swaps the visuals
+  if (_bypassed)
+  {
+    if (this->dataPtr->staticBatchBypass++ > 0u)
+      return;
+  }
+  else
+  {
+    if (this->dataPtr->staticBatchBypass == 0u ||
+        --this->dataPtr->staticBatchBypass > 0u)
+      return;
+  }
+
+  for (auto &baked : this->dataPtr->bakedMeshes)
+  {
+    auto mesh = baked.mesh.lock();
+    if (mesh && mesh->OgreObject())
+    {
+      mesh->OgreObject()->setVisibilityFlags(
+          _bypassed ? baked.visibilityFlags : 0u);
+    }
+  }
+  for (auto &batch : this->dataPtr->staticBatches)
+  {
+    for (unsigned int i = 0; i < batch->GeometryCount(); ++i)
+    {
+      auto mesh = std::dynamic_pointer_cast<Ogre2Mesh>(
+          batch->GeometryByIndex(i));
+      if (mesh && mesh->OgreObject())
+        mesh->OgreObject()->setVisible(!_bypassed);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::WarmUpShaders()
+{
+  GZ_ASSERT(this->dataPtr->frameUpdateStarted == false,
+             "Scene::WarmUpShaders called between Scene::PreRender and "
+             "Scene::PostRender");
+
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2Scene::WarmUpShaders", "shader", this->Name());
+
+  std::vector<CameraPtr> cameras;
+  for (unsigned int i = 0; i < this->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<Camera>(this->SensorByIndex(i));
+    if (camera)
+      cameras.push_back(camera);
+  }
+  if (cameras.empty())
+    return;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  // Same as RenderSensors, but without the sensors' PostRender: shaders
+  // are compiled while the workspaces execute, and nothing is read back
+  this->dataPtr->batchRendering = true;
+  this->PreRender();
+  for (auto &camera : cameras)
+    camera->Render();
+  this->dataPtr->currNumCameraPasses = 0u;
+  this->FlushGpuCommandsOnly();
+  this->PostRender();
+  this->dataPtr->batchRendering = false;
+
+  gzdbg << "Warmed up shaders of scene [" << this->Name() << "] with ["
+        << cameras.size() << "] sensors in ["
+        << std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start).count()
+        << "] ms" << std::endl;
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::Clear()
 {
+  this->UnbakeStaticVisuals();
   this->meshFactory->Clear();
 
   BaseScene::Clear();
@@ -467,8 +1321,28 @@ void Ogre2Scene::Clear()
 //////////////////////////////////////////////////
 void Ogre2Scene::Destroy()
 {
+  // destroying resources shared by all scenes must not overlap with the
+  // render of another scene. A scene destroyed between PreRender and
+  // PostRender hands over the lock it holds, which is released here
+  // instead of blocking the other threads for good.
+  std::unique_lock<std::recursive_mutex> renderLock(
+      std::move(this->dataPtr->renderLock));
+  if (!renderLock.owns_lock() &&
+      Ogre2RenderEngine::Instance()->SceneThreading())
+  {
+    renderLock = std::unique_lock<std::recursive_mutex>(
+        Ogre2RenderEngine::Instance()->RenderMutex());
+  }
+  this->dataPtr->frameUpdateStarted = false;
+
   this->DestroyNodes();
 
+  // the batch visuals were destroyed with the other nodes
+  this->dataPtr->bakedMeshes.clear();
+  this->dataPtr->staticBatches.clear();
+  this->dataPtr->staticBatchMeshes.clear();
+  this->dataPtr->staticBatchBypass = 0u;
+
   // cleanup any items that were not attached to nodes
   // make sure to do this before destroying materials done by BaseScene::Destroy
   // otherwise ogre throws an exception when unlinking a renderable from a
@@ -488,6 +1362,8 @@ void Ogre2Scene::Destroy()
     this->dataPtr->activeGi->Destroy();
     this->dataPtr->activeGi.reset();
   }
+
+  this->dataPtr->cameraAtlas.Destroy();
 }
 
 //////////////////////////////////////////////////
@@ -510,6 +1386,10 @@ bool Ogre2Scene::InitImpl()
   this->CreateStores();
   this->CreateMeshFactory();
   UpdateShadowNode();
+
+  // needed for the draw call and triangle counters of Stats
+  auto engine = Ogre2RenderEngine::Instance();
+  engine->OgreRoot()->getRenderSystem()->setMetricsRecordingEnabled(true);
   return true;
 }
 
@@ -538,6 +1418,11 @@ void Ogre2Scene::UpdateAllHeightmaps(Ogre::Camera *_camera)
       itor = Ogre::efficientVectorRemove(this->heightmaps, itor);
       endt = this->heightmaps.end();
     }
+    else if (!heightmap->IsLoaded())
+    {
+      // Heightmap data is still being prepared
+      ++itor;
+    }
     else
     {
       heightmap->UpdateForRender(_camera);
@@ -629,7 +1514,8 @@ void Ogre2Scene::UpdateShadowNode()
   // the number of shadow maps exceeds certain number. The error seems to
   // suggest that the number of uniform variables has exceeded the max number
   // allowed
-  unsigned int maxShadowMaps = 25u;
+  const ShadowConfig &config = this->shadowSettings;
+  unsigned int maxShadowMaps = config.maxShadowMaps;
   if (dirLightCount * 3 + spotPointLightCount > maxShadowMaps)
   {
     dirLightCount = std::min(static_cast<unsigned int>(maxShadowMaps / 3),
@@ -651,7 +1537,7 @@ void Ogre2Scene::UpdateShadowNode()
 
   // directional lights
   unsigned int atlasId = 0u;
-  unsigned int texSize = 2048u;
+  unsigned int texSize = config.directionalTextureSize;
   unsigned int halfTexSize = static_cast<unsigned int>(texSize * 0.5);
   for (unsigned int i = 0; i < dirLightCount; ++i)
   {
@@ -677,7 +1563,8 @@ void Ogre2Scene::UpdateShadowNode()
   }
 
   // others
-  unsigned int maxTexSize = 8192u;
+  texSize = config.textureSize;
+  unsigned int maxTexSize = config.atlasSize;
   unsigned int rowIdx = 0;
   unsigned int colIdx = 0;
   unsigned int rowSize = maxTexSize / texSize;
@@ -729,7 +1616,8 @@ void Ogre2Scene::CreateShadowNodeWithSettings(
     const std::string &_shadowNodeName,
     const Ogre::ShadowNodeHelper::ShadowParamVec &_shadowParams)
 {
-  Ogre::uint32 pointLightCubemapResolution = 1024u;
+  Ogre::uint32 pointLightCubemapResolution =
+      this->shadowSettings.pointLightCubemapSize;
   Ogre::Real pssmLambda = 0.95f;
   Ogre::Real splitPadding = 1.0f;
   Ogre::Real splitBlend = 0.125f;
@@ -1101,6 +1989,15 @@ WideAngleCameraPtr Ogre2Scene::CreateWideAngleCameraImpl(const unsigned int _id,
   return (result) ? camera : nullptr;
 }
 
+//////////////////////////////////////////////////
+CameraArrayPtr Ogre2Scene::CreateCameraArrayImpl(const unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2CameraArrayPtr array(new Ogre2CameraArray);
+  bool result = this->InitObject(array, _id, _name);
+  return (result) ? array : nullptr;
+}
+
 //////////////////////////////////////////////////
 BoundingBoxCameraPtr Ogre2Scene::CreateBoundingBoxCameraImpl(
   const unsigned int _id, const std::string &_name)
@@ -1310,6 +2207,33 @@ LidarVisualPtr Ogre2Scene::CreateLidarVisualImpl(unsigned int _id,
   return (result) ? lidar: nullptr;
 }
 
+//////////////////////////////////////////////////
+PointCloudVisualPtr Ogre2Scene::CreatePointCloudVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2PointCloudVisualPtr pointCloud(new Ogre2PointCloudVisual);
+  bool result = this->InitObject(pointCloud, _id, _name);
+  return (result) ? pointCloud : nullptr;
+}
+
+//////////////////////////////////////////////////
+OceanVisualPtr Ogre2Scene::CreateOceanVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2OceanVisualPtr ocean(new Ogre2OceanVisual);
+  bool result = this->InitObject(ocean, _id, _name);
+  return (result) ? ocean : nullptr;
+}
+
+//////////////////////////////////////////////////
+VoxelGridVisualPtr Ogre2Scene::CreateVoxelGridVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2VoxelGridVisualPtr voxelGrid(new Ogre2VoxelGridVisual);
+  bool result = this->InitObject(voxelGrid, _id, _name);
+  return (result) ? voxelGrid : nullptr;
+}
+
 //////////////////////////////////////////////////
 TextPtr Ogre2Scene::CreateTextImpl(unsigned int /*_id*/,
     const std::string &/*_name*/)
@@ -1421,9 +2345,7 @@ void Ogre2Scene::CreateContext()
 {
   Ogre::Root *root = Ogre2RenderEngine::Instance()->OgreRoot();
 
-  // getNumLogicalCores() may return 0 if couldn't detect
-  const size_t numThreads = std::max<size_t>(
-      1, Ogre::PlatformInformation::getNumLogicalCores());
+  const size_t numThreads = Ogre2RenderEngine::Instance()->WorkerThreadCount();
 
   // See ogre doxygen documentation regarding culling methods.
   // In some cases you may still want to use single thread.
@@ -1447,8 +2369,49 @@ void Ogre2Scene::CreateContext()
   // enable forward plus to support multiple lights
   // this is required for non-shadow-casting point lights and
   // spot lights to work
-  this->ogreSceneManager->setForwardClustered(
-    true, 16, 8, 24, 96, 4, 0, 1, 500);
+  this->ApplyLightClustering();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::SetLightClustering(const LightClusterConfig &_config)
+{
+  if (!BaseScene::SetLightClustering(_config))
+    return false;
+
+  if (this->ogreSceneManager)
+    this->ApplyLightClustering();
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::SetShadowSettings(const ShadowConfig &_config)
+{
+  const ShadowConfig prev = this->shadowSettings;
+  if (!BaseScene::SetShadowSettings(_config))
+    return false;
+
+  // the update policy is read by the render targets every frame, only the
+  // budget requires rebuilding the shadow node
+  if (prev.directionalTextureSize != _config.directionalTextureSize ||
+      prev.textureSize != _config.textureSize ||
+      prev.atlasSize != _config.atlasSize ||
+      prev.pointLightCubemapSize != _config.pointLightCubemapSize ||
+      prev.maxShadowMaps != _config.maxShadowMaps)
+  {
+    this->SetShadowsDirty(true);
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ApplyLightClustering()
+{
+  const LightClusterConfig &config = this->lightClustering;
+  this->ogreSceneManager->setForwardClustered(config.enabled,
+      config.width, config.height, config.slices, config.lightsPerCell,
+      config.decalsPerCell, 0u,
+      static_cast<Ogre::Real>(config.minDistance),
+      static_cast<Ogre::Real>(config.maxDistance));
 }
 
 //////////////////////////////////////////////////
@@ -1554,6 +2517,202 @@ bool Ogre2Scene::SkyEnabled() const
   return this->dataPtr->skyEnabled;
 }
 
+//////////////////////////////////////////////////
+void Ogre2Scene::SetTextureStreamingEnabled(bool _enabled)
+{
+  // placeholder textures would make frames depend on loading times
+  if (_enabled && Ogre2RenderEngine::Instance()->Deterministic())
+  {
+    gzwarn << "Texture streaming is disabled in deterministic mode"
+           << std::endl;
+    return;
+  }
+  this->dataPtr->textureStreamingEnabled = _enabled;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::TextureStreamingEnabled() const
+{
+  return this->dataPtr->textureStreamingEnabled;
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::PendingTextureLoads() const
+{
+  return this->dataPtr->pendingTextureLoads;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::TextureLoadStarted()
+{
+  ++this->dataPtr->pendingTextureLoads;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::TextureLoadFinished()
+{
+  if (this->dataPtr->pendingTextureLoads > 0u)
+    --this->dataPtr->pendingTextureLoads;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ParticleSystemCreated()
+{
+  ++this->dataPtr->particleSystemCount;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ParticleSystemDestroyed()
+{
+  if (this->dataPtr->particleSystemCount > 0u)
+    --this->dataPtr->particleSystemCount;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::HasParticleSystems() const
+{
+  return this->dataPtr->particleSystemCount > 0u;
+}
+
+//////////////////////////////////////////////////
+Ogre2ParticleNoise *Ogre2Scene::ParticleNoise()
+{
+  if (!this->dataPtr->particleNoise)
+  {
+    this->dataPtr->particleNoise =
+        std::make_unique<Ogre2ParticleNoise>(this);
+  }
+  return this->dataPtr->particleNoise.get();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetMaterialSharingEnabled(bool _enabled)
+{
+  this->dataPtr->materialSharingEnabled = _enabled;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::MaterialSharingEnabled() const
+{
+  return this->dataPtr->materialSharingEnabled;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetRenderOrigin(const math::Vector3d &_origin)
+{
+  if (this->dataPtr->renderOrigin == _origin)
+    return;
+
+  this->dataPtr->renderOrigin = _origin;
+  if (!this->rootVisual)
+    return;
+
+  // only the nodes attached to the root visual are offset, their
+  // descendants follow them
+  for (unsigned int i = 0; i < this->rootVisual->ChildCount(); ++i)
+  {
+    Ogre2NodePtr child = std::dynamic_pointer_cast<Ogre2Node>(
+        this->rootVisual->ChildByIndex(i));
+    if (child)
+      child->UpdateRenderPosition();
+  }
+}
+
+//////////////////////////////////////////////////
+math::Vector3d Ogre2Scene::RenderOrigin() const
+{
+  return this->dataPtr->renderOrigin;
+}
+
+//////////////////////////////////////////////////
+ShaderParamsPtr Ogre2Scene::SharedShaderParams() const
+{
+  return this->dataPtr->sharedShaderParams;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::BindSharedShaderParams(Ogre::GpuProgramParameters *_params)
+{
+  if (!_params)
+    return;
+
+  // per camera built-ins are auto constants, updated by Ogre every pass
+  static const std::pair<const char *,
+      Ogre::GpuProgramParameters::AutoConstantType> kAutoConstants[] =
+  {
+    {"gz_view", Ogre::GpuProgramParameters::ACT_VIEW_MATRIX},
+    {"gz_proj", Ogre::GpuProgramParameters::ACT_PROJECTION_MATRIX},
+    {"gz_view_proj", Ogre::GpuProgramParameters::ACT_VIEWPROJ_MATRIX},
+    {"gz_camera_position", Ogre::GpuProgramParameters::ACT_CAMERA_POSITION}
+  };
+  for (const auto &[name, type] : kAutoConstants)
+  {
+    if (_params->_findNamedConstantDefinition(name, false))
+      _params->setNamedAutoConstant(name, type);
+  }
+
+  // per frame built-ins and the scene's shared params
+  Ogre::GpuSharedParametersPtr shared =
+      this->dataPtr->OgreSharedParams(this->Name());
+  if (!_params->isUsingSharedParameters(shared->getName()))
+    _params->addSharedParameters(shared);
+}
+
+//////////////////////////////////////////////////
+Ogre::HlmsPbsDatablock *Ogre2Scene::AcquireSharedDatablock(
+    const std::string &_key, const Ogre::HlmsPbsDatablock *_source)
+{
+  auto it = this->dataPtr->sharedDatablocks.find(_key);
+  if (it != this->dataPtr->sharedDatablocks.end())
+  {
+    ++this->dataPtr->sharedDatablockRefs[it->second].second;
+    return it->second;
+  }
+
+  // the shared datablock gets its own name so that it can outlive the
+  // material it was created from
+  Ogre::HlmsPbsDatablock *datablock =
+      static_cast<Ogre::HlmsPbsDatablock *>(_source->clone(
+      this->Name() + "::SharedDatablock::" +
+      std::to_string(this->dataPtr->sharedDatablockCounter++)));
+  this->dataPtr->sharedDatablocks[_key] = datablock;
+  this->dataPtr->sharedDatablockRefs[datablock] = {_key, 1u};
+  return datablock;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ReleaseSharedDatablock(Ogre::HlmsPbsDatablock *_datablock)
+{
+  auto it = this->dataPtr->sharedDatablockRefs.find(_datablock);
+  if (it == this->dataPtr->sharedDatablockRefs.end())
+    return;
+
+  if (--it->second.second > 0u)
+    return;
+
+  this->dataPtr->sharedDatablocks.erase(it->second.first);
+  this->dataPtr->sharedDatablockRefs.erase(it);
+  _datablock->getCreator()->destroyDatablock(_datablock->getName());
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<Ogre2BakedSkeletonAnimation>
+    Ogre2Scene::AcquireBakedSkeletonAnimation(Ogre::SkeletonInstance *_skel,
+    const std::string &_name, double _rate)
+{
+  auto key = std::make_tuple(_skel->getDefinition()->getName(), _name,
+      _rate);
+  auto &baked = this->dataPtr->bakedSkeletonAnimations[key];
+  std::shared_ptr<Ogre2BakedSkeletonAnimation> animation = baked.lock();
+  if (!animation)
+  {
+    animation = std::make_shared<Ogre2BakedSkeletonAnimation>(
+        _skel, _name, _rate);
+    baked = animation;
+  }
+  return animation;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::SetActiveGlobalIllumination(GlobalIlluminationBasePtr _gi)
 {
@@ -1574,6 +2733,69 @@ void Ogre2Scene::SetLightsGiDirty()
   {
     this->dataPtr->lightsGiDirty = true;
   }
+
+  // the light list is also built during the scene graph update
+  this->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetLightListDirty()
+{
+  this->dataPtr->lightListDirty = true;
+}
+
+//////////////////////////////////////////////////
+Ogre2DirectionalLightPtr Ogre2Scene::PrimaryDirectionalLight()
+{
+  if (!this->dataPtr->lightListDirty)
+    return this->dataPtr->primaryDirectionalLight.lock();
+
+  Ogre2DirectionalLightPtr directionalLight;
+  for (unsigned int i = 0; i < this->LightCount(); ++i)
+  {
+    directionalLight = std::dynamic_pointer_cast<Ogre2DirectionalLight>(
+        this->LightByIndex(i));
+    if (directionalLight)
+      break;
+  }
+  this->dataPtr->primaryDirectionalLight = directionalLight;
+  this->dataPtr->lightListDirty = false;
+  return directionalLight;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetSceneGraphDirty()
+{
+  ++this->dataPtr->sceneGraphGeneration;
+}
+
+//////////////////////////////////////////////////
+uint64_t Ogre2Scene::SceneGraphGeneration() const
+{
+  return this->dataPtr->sceneGraphGeneration;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::RecordOcclusionCulling(uint64_t _tested, uint64_t _culled)
+{
+  this->dataPtr->occlusionTested += _tested;
+  this->dataPtr->occlusionCulled += _culled;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::UpdateSceneGraph()
+{
+  if (this->dataPtr->updatedSceneGraphGeneration ==
+      this->dataPtr->sceneGraphGeneration &&
+      this->dataPtr->updatedSceneGraphTime == this->Time())
+  {
+    return;
+  }
+
+  this->ogreSceneManager->updateSceneGraph();
+  this->dataPtr->updatedSceneGraphGeneration =
+      this->dataPtr->sceneGraphGeneration;
+  this->dataPtr->updatedSceneGraphTime = this->Time();
 }
 
 //////////////////////////////////////////////////
@@ -1612,3 +2834,50 @@ ObjectPtr Ogre2SceneExt::CreateExt(const std::string &_type,
 
   return ObjectPtr();
 }
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ParallelForRows(unsigned int _rows,
+    const std::function<void(unsigned int, unsigned int)> &_func,
+    unsigned int _minRowsPerThread)
+{
+  // below this many rows the cost of waking the workers outweighs the gain
+  const unsigned int minRowsPerThread = std::max(_minRowsPerThread, 1u);
+
+  size_t numThreads = this->ogreSceneManager ?
+      this->ogreSceneManager->getNumWorkerThreads() : 1u;
+  numThreads = std::min<size_t>(numThreads, _rows / minRowsPerThread);
+  if (numThreads <= 1u)
+  {
+    _func(0u, _rows);
+    return;
+  }
+
+  /// \brief Task handing each worker thread a contiguous block of rows
+  class RowTask : public Ogre::UniformScalableTask
+  {
+    public: RowTask(unsigned int _numRows, size_t _numBlocks,
+        const std::function<void(unsigned int, unsigned int)> &_f)
+        : numRows(_numRows), numBlocks(_numBlocks), func(_f) {}
+
+    public: void execute(size_t _threadId, size_t _numThreads) override
+    {
+      for (size_t block = _threadId; block < this->numBlocks;
+           block += _numThreads)
+      {
+        unsigned int begin =
+            static_cast<unsigned int>(block * this->numRows / this->numBlocks);
+        unsigned int end = static_cast<unsigned int>(
+            (block + 1u) * this->numRows / this->numBlocks);
+        if (begin < end)
+          this->func(begin, end);
+      }
+    }
+
+    private: unsigned int numRows;
+    private: size_t numBlocks;
+    private: const std::function<void(unsigned int, unsigned int)> &func;
+  };
+
+  RowTask task(_rows, numThreads, _func);
+  this->ogreSceneManager->executeUserScalableTask(&task, true);
+}
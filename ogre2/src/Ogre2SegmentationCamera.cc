@@ -15,7 +15,12 @@
  *
  */
 
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/math/Color.hh>
@@ -34,6 +39,9 @@
 #include "gz/rendering/Utils.hh"
 
 #include "Ogre2SegmentationMaterialSwitcher.hh"
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2StaticBatchBypass.hh"
+#include "Ogre2TextureReadback.hh"
 
 /// \brief Private data for the Ogre2SegmentationCamera class
 class gz::rendering::Ogre2SegmentationCameraPrivate
@@ -41,6 +49,12 @@ class gz::rendering::Ogre2SegmentationCameraPrivate
   /// \brief buffer to store render texture data & to be sent to listeners
   public: uint8_t *buffer {nullptr};
 
+  /// \brief Lease of buffer from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> bufferLease;
+
+  /// \brief Staging ticket the segmentation texture is downloaded into
+  public: Ogre2TextureReadback readback;
+
   /// \brief Workspace Definition
   public: std::string ogreCompositorWorkspaceDef;
 
@@ -66,6 +80,32 @@ class gz::rendering::Ogre2SegmentationCameraPrivate
     unsigned int _width, unsigned int _height, unsigned int _channels,
     const std::string &_format)> newSegmentationFrame;
 
+  /// \brief Event used to signal a view of the downloaded segmentation data
+  public: gz::common::EventT<void(const FrameView &)> newFrameView;
+
+  /// \brief Event used to signal the sparse segmentation of a frame
+  public: gz::common::EventT<void(const std::vector<SegmentationInstance> &,
+    unsigned int, unsigned int)> newSegmentationInstances;
+
+  /// \brief Runs of every row with the id they belong to, kept to reuse
+  /// their memory
+  public: std::vector<std::vector<std::pair<uint32_t, SegmentationRun>>>
+          rowRuns;
+
+  /// \brief Sparse segmentation sent to listeners
+  public: std::vector<SegmentationInstance> instances;
+
+  /// \brief Compute the sparse segmentation of a downloaded frame and send
+  /// it to the listeners
+  /// \param[in] _box Downloaded RGBA frame
+  /// \param[in] _width Frame width
+  /// \param[in] _height Frame height
+  /// \param[in] _keepRuns True to keep the runs of every instance
+  /// \param[in] _scene Scene whose worker threads encode the rows
+  public: void ExtractInstances(const Ogre::TextureBox &_box,
+              unsigned int _width, unsigned int _height, bool _keepRuns,
+              Ogre2Scene &_scene);
+
   /// \brief Material Switcher to switch item's material
   /// with colored version for segmentation
   public: std::unique_ptr<Ogre2SegmentationMaterialSwitcher>
@@ -105,11 +145,9 @@ void Ogre2SegmentationCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
 
-  if (this->dataPtr->buffer)
-  {
-    delete [] this->dataPtr->buffer;
-    this->dataPtr->buffer = nullptr;
-  }
+  // return the buffer to the pool
+  this->dataPtr->bufferLease.reset();
+  this->dataPtr->buffer = nullptr;
 
   if (!this->ogreCamera)
     return;
@@ -118,6 +156,7 @@ void Ogre2SegmentationCamera::Destroy()
   auto ogreRoot = engine->OgreRoot();
   auto ogreCompMgr = ogreRoot->getCompositorManager2();
 
+  this->dataPtr->readback.Destroy();
   if (this->dataPtr->ogreSegmentationTexture)
   {
     ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
@@ -163,9 +202,31 @@ void Ogre2SegmentationCamera::Destroy()
 /////////////////////////////////////////////////
 void Ogre2SegmentationCamera::PreRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
   if (!this->dataPtr->ogreSegmentationTexture)
     this->CreateSegmentationTexture();
 
+  // lens changes, e.g. zooming, only update the frustum, the render
+  // targets are kept
+  const Ogre::Real aspectRatio =
+      static_cast<Ogre::Real>(this->AspectRatio());
+  const Ogre::Radian vfov(static_cast<Ogre::Real>(
+      2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspectRatio)));
+  if (this->ogreCamera->getFOVy() != vfov ||
+      this->ogreCamera->getAspectRatio() != aspectRatio)
+  {
+    this->ogreCamera->setFOVy(vfov);
+    this->ogreCamera->setAspectRatio(aspectRatio);
+  }
+  if (this->ogreCamera->getNearClipDistance() !=
+      static_cast<Ogre::Real>(this->NearClipPlane()) ||
+      this->ogreCamera->getFarClipDistance() !=
+      static_cast<Ogre::Real>(this->FarClipPlane()))
+  {
+    this->ogreCamera->setNearClipDistance(this->NearClipPlane());
+    this->ogreCamera->setFarClipDistance(this->FarClipPlane());
+  }
+
   // todo(iche033) Override BaseCamera::SetProjectionMatrix() function in
   // main / gz-rendering9 instead of checking and setting the custom
   // projection matrix here
@@ -265,11 +326,33 @@ void Ogre2SegmentationCamera::CreateSegmentationTexture()
     this->dataPtr->materialSwitcher.get());
 }
 
+//////////////////////////////////////////////////
+bool Ogre2SegmentationCamera::HasConnections() const
+{
+  return this->dataPtr->newSegmentationFrame.ConnectionCount() > 0u ||
+      this->dataPtr->newFrameView.ConnectionCount() > 0u ||
+      this->dataPtr->newSegmentationInstances.ConnectionCount() > 0u ||
+      BaseSegmentationCamera::HasConnections();
+}
+
+/////////////////////////////////////////////////
+size_t Ogre2SegmentationCamera::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorWorkspace);
+  bytes += Ogre2RenderEngine::TextureSizeBytes(
+      this->dataPtr->ogreSegmentationTexture);
+  return bytes;
+}
+
 /////////////////////////////////////////////////
 void Ogre2SegmentationCamera::PostRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
   // return if no one is listening to the new frame
-  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
+  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0 &&
+      this->dataPtr->newFrameView.ConnectionCount() == 0 &&
+      this->dataPtr->newSegmentationInstances.ConnectionCount() == 0)
     return;
 
   const auto width = this->ImageWidth();
@@ -281,34 +364,53 @@ void Ogre2SegmentationCamera::PostRender()
   const auto bytesPerChannel = PixelUtil::BytesPerChannel(format);
   const auto bufferSize = len * channelCount * bytesPerChannel;
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreSegmentationTexture, 0u, 0u);
-  Ogre::TextureBox box = image.getData(0);
+  // the frame stays mapped until the next download
+  Ogre::TextureBox box;
+  if (!this->dataPtr->readback.Read(
+      this->dataPtr->ogreSegmentationTexture, box))
+  {
+    return;
+  }
+  this->EndFrameInfo(this->renderFrameInfo);
 
-  if (!this->dataPtr->buffer)
+  // frame view listeners read the downloaded RGBA data directly
+  if (this->dataPtr->newFrameView.ConnectionCount() > 0u)
   {
-    this->dataPtr->buffer = new uint8_t[bufferSize];
+    FrameView view;
+    view.data = box.data;
+    view.width = width;
+    view.height = height;
+    view.rowPitch = box.bytesPerRow;
+    view.format = PF_R8G8B8A8;
+    view.info = this->frameInfo;
+    this->dataPtr->newFrameView(view);
   }
 
-  uint8_t *bufferTmp = static_cast<uint8_t*>(box.data);
+  if (this->dataPtr->newSegmentationInstances.ConnectionCount() > 0u)
+  {
+    this->dataPtr->ExtractInstances(box, width, height,
+        this->instanceRunsEnabled, *this->scene);
+  }
 
-  auto rawChannelCount = 4u;
+  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
+    return;
 
-  for (unsigned int row = 0; row < height; ++row)
+  this->dataPtr->buffer = this->scene->Engine()->BufferPool().Reserve(
+      this->dataPtr->bufferLease, bufferSize);
+
+  uint8_t *bufferTmp = static_cast<uint8_t*>(box.data);
+
+  uint8_t *buffer = this->dataPtr->buffer;
+  this->scene->ParallelForRows(height,
+      [&](unsigned int _begin, unsigned int _end)
   {
-    unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
-    for (unsigned int column = 0; column < width; ++column)
+    for (unsigned int row = _begin; row < _end; ++row)
     {
-      unsigned int idx = (row * width * channelCount) +
-          column * channelCount;
-      unsigned int rawIdx = rawDataRowIdx +
-          column * rawChannelCount;
-
-      this->dataPtr->buffer[idx] = bufferTmp[rawIdx];
-      this->dataPtr->buffer[idx + 1] = bufferTmp[rawIdx + 1];
-      this->dataPtr->buffer[idx + 2] = bufferTmp[rawIdx + 2];
+      unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
+      PixelUtil::PackRgba8ToRgb8(&bufferTmp[rawDataRowIdx],
+          &buffer[row * width * channelCount], width);
     }
-  }
+  });
 
   this->dataPtr->newSegmentationFrame(
     this->dataPtr->buffer,
@@ -316,6 +418,97 @@ void Ogre2SegmentationCamera::PostRender()
     PixelUtil::Name(format));
 }
 
+/////////////////////////////////////////////////
+common::ConnectionPtr Ogre2SegmentationCamera::ConnectNewFrameView(
+    Camera::NewFrameViewListener _listener)
+{
+  return this->dataPtr->newFrameView.Connect(_listener);
+}
+
+/////////////////////////////////////////////////
+void Ogre2SegmentationCameraPrivate::ExtractInstances(
+    const Ogre::TextureBox &_box, unsigned int _width, unsigned int _height,
+    bool _keepRuns, Ogre2Scene &_scene)
+{
+  // run-length encode the rows in parallel, the runs are merged into
+  // instances afterwards in row order
+  this->rowRuns.resize(_height);
+  const uint8_t *data = static_cast<const uint8_t *>(_box.data);
+  _scene.ParallelForRows(_height,
+      [&](unsigned int _begin, unsigned int _end)
+  {
+    for (unsigned int row = _begin; row < _end; ++row)
+    {
+      auto &runs = this->rowRuns[row];
+      runs.clear();
+      const uint8_t *pixel = data + row * _box.bytesPerRow;
+      unsigned int start = 0u;
+      uint32_t runId = 0u;
+      for (unsigned int x = 0; x < _width; ++x, pixel += 4)
+      {
+        const uint32_t id = static_cast<uint32_t>(pixel[0]) |
+            (static_cast<uint32_t>(pixel[1]) << 8u) |
+            (static_cast<uint32_t>(pixel[2]) << 16u);
+        if (x > 0u && id != runId)
+        {
+          runs.push_back({runId, {row, start, x - start}});
+          start = x;
+        }
+        runId = id;
+      }
+      if (_width > 0u)
+        runs.push_back({runId, {row, start, _width - start}});
+    }
+  });
+
+  auto &instances = this->instances;
+  instances.clear();
+  std::unordered_map<uint32_t, size_t> instanceIndex;
+  for (const auto &runs : this->rowRuns)
+  {
+    for (const auto &[id, run] : runs)
+    {
+      auto it = instanceIndex.find(id);
+      if (it == instanceIndex.end())
+      {
+        it = instanceIndex.emplace(id, instances.size()).first;
+        SegmentationInstance instance;
+        instance.id = id;
+        instance.pixelCount = 0u;
+        instance.minX = run.start;
+        instance.minY = run.row;
+        instance.maxX = run.start + run.length - 1u;
+        instance.maxY = run.row;
+        instances.push_back(std::move(instance));
+      }
+
+      SegmentationInstance &instance = instances[it->second];
+      instance.pixelCount += run.length;
+      instance.minX = std::min(instance.minX, run.start);
+      instance.maxX = std::max(instance.maxX, run.start + run.length - 1u);
+      instance.maxY = run.row;
+      if (_keepRuns)
+        instance.runs.push_back(run);
+    }
+  }
+  std::sort(instances.begin(), instances.end(),
+      [](const SegmentationInstance &_a, const SegmentationInstance &_b)
+      {
+        return _a.id < _b.id;
+      });
+
+  this->newSegmentationInstances(instances, _width, _height);
+}
+
+/////////////////////////////////////////////////
+gz::common::ConnectionPtr
+  Ogre2SegmentationCamera::ConnectNewSegmentationInstances(
+  std::function<void(const std::vector<SegmentationInstance> &,
+  unsigned int, unsigned int)> _subscriber)
+{
+  return this->dataPtr->newSegmentationInstances.Connect(_subscriber);
+}
+
 /////////////////////////////////////////////////
 gz::common::ConnectionPtr
   Ogre2SegmentationCamera::ConnectNewSegmentationFrame(
@@ -325,9 +518,22 @@ gz::common::ConnectionPtr
   return this->dataPtr->newSegmentationFrame.Connect(_subscriber);
 }
 
+/////////////////////////////////////////////////
+std::shared_ptr<const uint8_t>
+  Ogre2SegmentationCamera::AcquireSegmentationData() const
+{
+  if (!this->dataPtr->bufferLease)
+    return nullptr;
+  return std::shared_ptr<const uint8_t>(this->dataPtr->bufferLease,
+      this->dataPtr->buffer);
+}
+
 /////////////////////////////////////////////////
 void Ogre2SegmentationCamera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
+  Ogre2StaticBatchBypass bypass(this->scene);
   // update the compositors
   this->scene->StartRendering(this->ogreCamera);
 
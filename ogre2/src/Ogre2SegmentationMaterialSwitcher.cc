@@ -46,6 +46,11 @@
 using namespace gz;
 using namespace rendering;
 
+/// \brief Incremented every time a segmentation camera writes its colors to
+/// the items, so that cameras with different settings notice their colors
+/// were replaced
+static uint64_t gSegmentationColorWrites = 0u;
+
 /////////////////////////////////////////////////
 Ogre2SegmentationMaterialSwitcher::Ogre2SegmentationMaterialSwitcher(
   Ogre2ScenePtr _scene, SegmentationCamera *_camera)
@@ -84,17 +89,10 @@ Ogre::Vector4 Ogre2SegmentationMaterialSwitcher::ColorForVisual(
   const VisualPtr &_visual, std::string &_prevParentName)
 {
   // get class user data
-  Variant labelAny = _visual->UserData("label");
-  int label;
-  try
-  {
-    label = std::get<int>(labelAny);
-  }
-  catch (std::bad_variant_access &)
-  {
-    // items with no class are considered background
-    label = this->segmentationCamera->BackgroundLabel();
-  }
+  // items with no class are considered background
+  const int *labelValue = _visual->UserDataAs<int>(this->labelKey);
+  int label = labelValue ? *labelValue :
+      this->segmentationCamera->BackgroundLabel();
 
   // sub item custom parameter to set the pixel color material
   Ogre::Vector4 customParameter;
@@ -227,37 +225,177 @@ VisualPtr Ogre2SegmentationMaterialSwitcher::TopLevelModelVisual(
 }
 
 ////////////////////////////////////////////////
-void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
-    Ogre::Camera * /*_cam*/)
+bool Ogre2SegmentationMaterialSwitcher::UpdateItemKeys()
 {
-  this->colorToLabel.clear();
+  bool changed = false;
+
+  const SegmentationType type = this->segmentationCamera->Type();
+  const bool coloredMap = this->segmentationCamera->IsColoredMap();
+  const int backgroundLabel = this->segmentationCamera->BackgroundLabel();
+  const math::Color backgroundColor =
+      this->segmentationCamera->BackgroundColor();
+  if (type != this->cachedType || coloredMap != this->cachedColoredMap ||
+      backgroundLabel != this->cachedBackgroundLabel ||
+      backgroundColor != this->cachedBackgroundColor)
+  {
+    this->cachedType = type;
+    this->cachedColoredMap = coloredMap;
+    this->cachedBackgroundLabel = backgroundLabel;
+    this->cachedBackgroundColor = backgroundColor;
+    changed = true;
+  }
+
+  // collect the inputs of the color assignment in scene manager order
+  std::vector<ItemKey> keys;
+  keys.reserve(this->itemKeys.size());
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itor.peekNext());
+    itor.moveNext();
 
-  auto engine = Ogre2RenderEngine::Instance();
-  engine->SetGzOgreRenderingMode(GORM_SOLID_COLOR);
+    // get visual from ogre item
+    Ogre::Any userAny = item->getUserObjectBindings().getUserAny();
+    if (userAny.isEmpty() || userAny.getType() != typeid(unsigned int))
+      continue;
 
-  // Used for multi-link models, where each model has many ogre items but
-  // belongs to the same object, and all of them has the same parent name
-  std::string prevParentName = "";
+    ItemKey key;
+    key.item = item;
+    key.itemId = item->getId();
 
-  // Store the ogre objects in a vector
-  std::vector<Ogre::MovableObject *> ogreObjects;
-  while (itor.hasMoreElements())
+    VisualPtr visual;
+    try
+    {
+      visual = this->scene->VisualByCompactId(
+          Ogre::any_cast<unsigned int>(userAny));
+    }
+    catch(Ogre::Exception &e)
+    {
+      gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
+    }
+    key.visual = visual;
+    if (visual)
+    {
+      key.visualId = visual->Id();
+      if (const Variant *label = visual->UserDataValue(this->labelKey))
+        key.label = *label;
+      // multi-link models are colored by their top level model
+      if (type == SegmentationType::ST_PANOPTIC)
+        key.topLevelId = this->TopLevelModelVisual(visual)->Id();
+    }
+    keys.push_back(key);
+  }
+
+  auto heightmaps = this->scene->Heightmaps();
+  for (auto h : heightmaps)
   {
-    Ogre::MovableObject *object = itor.peekNext();
-    ogreObjects.push_back(object);
-    itor.moveNext();
+    auto heightmap = h.lock();
+    if (!heightmap)
+      continue;
+
+    ItemKey key;
+    VisualPtr visual = heightmap->Parent();
+    key.visual = visual;
+    key.visualId = visual ? visual->Id() : 0u;
+    const Variant *label =
+        visual ? visual->UserDataValue(this->labelKey) : nullptr;
+    if (label)
+      key.label = *label;
+    keys.push_back(key);
   }
 
+  if (keys.size() != this->itemKeys.size())
+  {
+    changed = true;
+  }
+  else
+  {
+    for (size_t i = 0; i < keys.size() && !changed; ++i)
+    {
+      const ItemKey &a = keys[i];
+      const ItemKey &b = this->itemKeys[i];
+      changed = a.item != b.item || a.itemId != b.itemId ||
+          a.visualId != b.visualId || a.topLevelId != b.topLevelId ||
+          a.label != b.label;
+    }
+  }
+
+  this->itemKeys = std::move(keys);
+  return changed;
+}
+
+////////////////////////////////////////////////
+void Ogre2SegmentationMaterialSwitcher::UpdateColors()
+{
+  this->colorToLabel.clear();
+  this->itemColors.clear();
+  this->heightmapColors.clear();
+
+  // Used for multi-link models, where each model has many ogre items but
+  // belongs to the same object, and all of them has the same parent name
+  std::string prevParentName = "";
+
   // Sort the ogre objects by name
   // The algorithm of handeling multi-link models depends on a sorted objects
   // by name, so all links that belongs to the same object come in order
-  std::sort(ogreObjects.begin(), ogreObjects.end(),
-    [] (Ogre::MovableObject * object1, Ogre::MovableObject * object2) {
-      return object1->getName() > object2->getName();
+  std::vector<const ItemKey *> items;
+  std::vector<const ItemKey *> heightmaps;
+  for (const auto &key : this->itemKeys)
+  {
+    if (key.item)
+      items.push_back(&key);
+    else
+      heightmaps.push_back(&key);
+  }
+  std::sort(items.begin(), items.end(),
+    [] (const ItemKey *_key1, const ItemKey *_key2) {
+      return _key1->item->getName() > _key2->item->getName();
   });
 
+  for (auto key : items)
+  {
+    if (!key->visual)
+      continue;
+    this->itemColors.push_back(
+        {key->item, this->ColorForVisual(key->visual, prevParentName)});
+  }
+
+  // Do the same with heightmaps / terrain
+  for (auto key : heightmaps)
+  {
+    this->heightmapColors.push_back(key->visual ?
+        this->ColorForVisual(key->visual, prevParentName) :
+        Ogre::Vector4::ZERO);
+  }
+
+  // reset the count & colors tracking
+  this->instancesCount.clear();
+  this->takenColors.clear();
+  this->coloredLabel.clear();
+}
+
+////////////////////////////////////////////////
+void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
+    Ogre::Camera * /*_cam*/)
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  engine->SetGzOgreRenderingMode(GORM_SOLID_COLOR, GOIA_SEGMENTATION);
+
+  // colors only need to be assigned again when items were added or
+  // removed, or their labels or the camera settings changed
+  if (this->UpdateItemKeys())
+  {
+    this->UpdateColors();
+    this->colorsWritten = 0u;
+  }
+
+  // the colors persist in the items' GOIA_SEGMENTATION parameter
+  const bool writeColors = this->colorsWritten == 0u ||
+      this->colorsWritten != gSegmentationColorWrites;
+  if (writeColors)
+    this->colorsWritten = ++gSegmentationColorWrites;
+
   this->materialMap.clear();
   this->datablockMap.clear();
   Ogre::HlmsManager *hlmsManager = engine->OgreRoot()->getHlmsManager();
@@ -270,95 +408,76 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
   const Ogre::HlmsBlendblock *noBlend =
     hlmsManager->getBlendblock(Ogre::HlmsBlendblock());
 
-  for (auto object : ogreObjects)
+  for (const auto &[item, customParameter] : this->itemColors)
   {
-    Ogre::Item *item = static_cast<Ogre::Item *>(object);
-
-    // get visual from ogre item
-    Ogre::Any userAny = item->getUserObjectBindings().getUserAny();
-
-    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
+    const size_t numSubItems = item->getNumSubItems();
+    for (size_t i = 0; i < numSubItems; ++i)
     {
-      // get visual id for the ogre item
-      auto visualId = Ogre::any_cast<unsigned int>(userAny);
-
-      VisualPtr visual;
-      try
-      {
-        visual = this->scene->VisualById(visualId);
-      }
-      catch(Ogre::Exception &e)
-      {
-        gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
-      }
-
-      const Ogre::Vector4 customParameter =
-        ColorForVisual(visual, prevParentName);
+      // Set the custom value to the sub item to render
+      Ogre::SubItem *subItem = item->getSubItem(i);
+      if (writeColors)
+        subItem->setCustomParameter(GOIA_SEGMENTATION, customParameter);
 
-      const size_t numSubItems = item->getNumSubItems();
-      for (size_t i = 0; i < numSubItems; ++i)
+      if (!subItem->getMaterial().isNull())
       {
-        // Set the custom value to the sub item to render
-        Ogre::SubItem *subItem = item->getSubItem(i);
-        subItem->setCustomParameter(1, customParameter);
-
-        if (!subItem->getMaterial().isNull())
+        this->materialMap.push_back({ subItem, subItem->getMaterial() });
+
+        // low level materials can't pick the custom parameter to read, see
+        // e.g. PointCloudPoint_solid. Give them the color for this render
+        subItem->setCustomParameter(GOIA_SOLID_COLOR, customParameter);
+
+        // We need to keep the material's vertex shader
+        // to keep vertex deformation consistent; so we use
+        // a cloned material with a different pixel shader
+        // https://github.com/gazebosim/gz-rendering/issues/544
+        //
+        // material may be a nullptr if we called setMaterial directly
+        // (i.e. it's not using Ogre2Material interface).
+        // In those cases we fallback to PBS in the current IORM mode.
+        auto material = Ogre::MaterialManager::getSingleton().getByName(
+          subItem->getMaterial()->getName() + "_solid",
+          Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+        if (material)
         {
-          this->materialMap.push_back({ subItem, subItem->getMaterial() });
-
-          // We need to keep the material's vertex shader
-          // to keep vertex deformation consistent; so we use
-          // a cloned material with a different pixel shader
-          // https://github.com/gazebosim/gz-rendering/issues/544
-          //
-          // material may be a nullptr if we called setMaterial directly
-          // (i.e. it's not using Ogre2Material interface).
-          // In those cases we fallback to PBS in the current IORM mode.
-          auto material = Ogre::MaterialManager::getSingleton().getByName(
-            subItem->getMaterial()->getName() + "_solid",
-            Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
-          if (material)
+          if (material->getLoadingState() ==
+              Ogre::Resource::LOADSTATE_UNLOADED)
           {
-            if (material->getLoadingState() ==
-                Ogre::Resource::LOADSTATE_UNLOADED)
-            {
-              // Manually defined materials like PointCloudPoint_solid need this
-              material->load();
-            }
-
-            if (material->getNumSupportedTechniques() > 0u)
-            {
-              subItem->setMaterial(material);
-            }
+            // Manually defined materials like PointCloudPoint_solid need this
+            material->load();
           }
-          else
+
+          if (material->getNumSupportedTechniques() > 0u)
           {
-            // The supplied vertex shader could not pair with the
-            // pixel shader we provide. Try to salvage the situation
-            // using PBS shader. Custom deformation won't work but
-            // if we're lucky that won't matter
-            subItem->setDatablock(defaultPbs);
+            subItem->setMaterial(material);
           }
         }
         else
         {
-          Ogre::HlmsDatablock *datablock = subItem->getDatablock();
-          const Ogre::HlmsBlendblock *blendblock = datablock->getBlendblock();
-
-          // We can't do any sort of blending. This isn't colour what we're
-          // storing, but rather an ID.
-          if (blendblock->mSourceBlendFactor != Ogre::SBF_ONE ||
-              blendblock->mDestBlendFactor != Ogre::SBF_ZERO ||
-              blendblock->mBlendOperation != Ogre::SBO_ADD ||
-              (blendblock->mSeparateBlend &&
-               (blendblock->mSourceBlendFactorAlpha != Ogre::SBF_ONE ||
-                blendblock->mDestBlendFactorAlpha != Ogre::SBF_ZERO ||
-                blendblock->mBlendOperationAlpha != Ogre::SBO_ADD)))
-          {
-            hlmsManager->addReference(blendblock);
-            this->datablockMap[datablock] = blendblock;
-            datablock->setBlendblock(noBlend);
-          }
+          // The supplied vertex shader could not pair with the
+          // pixel shader we provide. Try to salvage the situation
+          // using PBS shader. Custom deformation won't work but
+          // if we're lucky that won't matter
+          subItem->setDatablock(defaultPbs);
+        }
+      }
+      else
+      {
+        Ogre::HlmsDatablock *datablock = subItem->getDatablock();
+        const Ogre::HlmsBlendblock *blendblock = datablock->getBlendblock();
+
+        // We can't do any sort of blending. This isn't colour what we're
+        // storing, but rather an ID.
+        if (blendblock->mSourceBlendFactor != Ogre::SBF_ONE ||
+            blendblock->mDestBlendFactor != Ogre::SBF_ZERO ||
+            blendblock->mBlendOperation != Ogre::SBO_ADD ||
+            (blendblock->mSeparateBlend &&
+             (blendblock->mSourceBlendFactorAlpha != Ogre::SBF_ONE ||
+              blendblock->mDestBlendFactorAlpha != Ogre::SBF_ZERO ||
+              blendblock->mBlendOperationAlpha != Ogre::SBO_ADD)))
+        {
+          hlmsManager->addReference(blendblock);
+          this->datablockMap[datablock] = blendblock;
+          datablock->setBlendblock(noBlend);
         }
       }
     }
@@ -366,27 +485,21 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
 
   // Do the same with heightmaps / terrain
   auto heightmaps = this->scene->Heightmaps();
+  size_t heightmapIdx = 0u;
   for (auto h : heightmaps)
   {
     auto heightmap = h.lock();
-    if (heightmap)
+    if (heightmap && heightmapIdx < this->heightmapColors.size())
     {
       // TODO(anyone): Retrieve datablock and make sure it's not blending
       // like we do with Items (it should be impossible?)
-      VisualPtr visual = heightmap->Parent();
-      const Ogre::Vector4 customParameter =
-        ColorForVisual(visual, prevParentName);
-      heightmap->Terra()->SetSolidColor(1u, customParameter);
+      heightmap->Terra()->SetSolidColor(1u,
+          this->heightmapColors[heightmapIdx++]);
     }
   }
 
   // Remove the reference count on noBlend we created
   hlmsManager->destroyBlendblock(noBlend);
-
-  // reset the count & colors tracking
-  this->instancesCount.clear();
-  this->takenColors.clear();
-  this->coloredLabel.clear();
 }
 
 ////////////////////////////////////////////////
@@ -405,37 +518,20 @@ void Ogre2SegmentationMaterialSwitcher::cameraPostRenderScene(
   }
   this->datablockMap.clear();
 
-  // Remove the custom parameter. Why? If there are multiple cameras that
-  // use GORM_SOLID_COLOR (or any other mode), we want them to throw if
-  // that code forgot to call setCustomParameter. We may miss those errors
-  // if that code forgets to call but it was already carrying the value
-  // we set here.
-  //
-  // This consumes more performance but it's the price to pay for
-  // safety.
-  auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
-      Ogre::ItemFactory::FACTORY_TYPE_NAME);
-  while (itor.hasMoreElements())
-  {
-    Ogre::MovableObject *object = itor.peekNext();
-    Ogre::Item *item = static_cast<Ogre::Item *>(object);
-    const size_t numSubItems = item->getNumSubItems();
-    for (size_t i = 0; i < numSubItems; ++i)
-    {
-      Ogre::SubItem *subItem = item->getSubItem(i);
-      subItem->removeCustomParameter(1u);
-    }
-    itor.moveNext();
-  }
+  // The colors are left on the items for the next render. Other modes read
+  // a different custom parameter so they still throw if their code forgot
+  // to set one; see GzOgreItemAttribute.
 
   // Restore Items with low level materials
   for (auto subItemMat : this->materialMap)
   {
+    subItemMat.first->removeCustomParameter(GOIA_SOLID_COLOR);
     subItemMat.first->setMaterial(subItemMat.second);
   }
   this->materialMap.clear();
 
-  // Remove the custom parameter (same reason as with Items)
+  // Remove the custom parameter. Terra only has the solid colours shared
+  // by all modes, so we must not leave ours behind
   auto heightmaps = this->scene->Heightmaps();
   for (auto h : heightmaps)
   {
@@ -18,6 +18,7 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2SEGMENTATIONMATERIALSWITCHER_HH_
 #define GZ_RENDERING_OGRE2_OGRE2SEGMENTATIONMATERIALSWITCHER_HH_
 
+#include <cstdint>
 #include <random>
 #include <string>
 #include <unordered_map>
@@ -32,6 +33,7 @@
 #include "gz/rendering/ogre2/Ogre2Camera.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/UserDataKey.hh"
 
 namespace gz
 {
@@ -69,6 +71,37 @@ class GZ_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   /// \return The map between color and label IDs
   public: const std::unordered_map<int64_t, int64_t> &ColorToLabel() const;
 
+  /// \brief Inputs of the color assignment for one ogre item or heightmap,
+  /// compared between frames to detect changes
+  private: struct ItemKey
+  {
+    /// \brief Ogre item, null for heightmaps
+    Ogre::Item *item = nullptr;
+
+    /// \brief Ogre item id, guards against reused item pointers
+    Ogre::IdType itemId = 0u;
+
+    /// \brief Id of the visual that owns the item
+    unsigned int visualId = 0u;
+
+    /// \brief Visual that owns the item. Only held until the next frame.
+    VisualPtr visual;
+
+    /// \brief Label user data of the visual
+    Variant label;
+
+    /// \brief Id of the top level model visual, panoptic mode only
+    unsigned int topLevelId = 0u;
+  };
+
+  /// \brief Collect the items in the scene and their labels
+  /// \return True if the items, their labels or the camera settings
+  /// changed since the last frame
+  private: bool UpdateItemKeys();
+
+  /// \brief Assign colors to all items and rebuild the color to label map
+  private: void UpdateColors();
+
   /// \brief Create a color to apply for the given visual
   /// \param[in] _visual Visual will be applying the color to
   /// \param[in,out] _prevParentName A persistent string between call
@@ -129,9 +162,40 @@ class GZ_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   private:
     std::vector<std::pair<Ogre::SubItem *, Ogre::MaterialPtr>> materialMap;
 
+  /// \brief Color assignment inputs from the last frame
+  private: std::vector<ItemKey> itemKeys;
+
+  /// \brief Colors assigned to each item, reused until the items or
+  /// their labels change
+  private: std::vector<std::pair<Ogre::Item *, Ogre::Vector4>> itemColors;
+
+  /// \brief Value of the shared write counter when this switcher last
+  /// wrote its colors to the items. The colors stay set on the items
+  /// between renders and are only written again when they change or
+  /// another segmentation camera overwrote them.
+  private: uint64_t colorsWritten = 0u;
+
+  /// \brief Colors assigned to each heightmap
+  private: std::vector<Ogre::Vector4> heightmapColors;
+
+  /// \brief Segmentation type the colors were assigned for
+  private: SegmentationType cachedType = SegmentationType::ST_SEMANTIC;
+
+  /// \brief Colored map setting the colors were assigned for
+  private: bool cachedColoredMap = false;
+
+  /// \brief Background label the colors were assigned for
+  private: int cachedBackgroundLabel = -1;
+
+  /// \brief Background color the colors were assigned for
+  private: math::Color cachedBackgroundColor;
+
   /// \brief Pseudo num generator to generate colors from label id
   private: std::default_random_engine generator;
 
+  /// \brief User data key of the label of visuals
+  private: const UserDataKey labelKey{"label"};
+
   /// \brief Ogre2 Scene
   private: Ogre2ScenePtr scene = nullptr;
 
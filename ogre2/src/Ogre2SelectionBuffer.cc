@@ -15,7 +15,9 @@
  *
 */
 
+#include <cstring>
 #include <memory>
+#include <set>
 #include <gz/math/Color.hh>
 
 #include "gz/common/Console.hh"
@@ -27,11 +29,13 @@
 #include "gz/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2SelectionBuffer.hh"
+#include "Ogre2StaticBatchBypass.hh"
 
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
 #include <Compositor/OgreCompositorManager2.h>
+#include <OgreAsyncTextureTicket.h>
 #include <Compositor/OgreCompositorWorkspace.h>
 #include <Compositor/Pass/PassClear/OgreCompositorPassClearDef.h>
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
@@ -94,6 +98,13 @@ class gz::rendering::Ogre2SelectionBufferPrivate
 
   /// \brief The selection buffer material
   public: Ogre::MaterialPtr selectionMaterial;
+
+  /// \brief Render texture of region queries, sized to the last queried
+  /// region
+  public: Ogre::TextureGpu *regionTexture = nullptr;
+
+  /// \brief Compositor workspace rendering into regionTexture
+  public: Ogre::CompositorWorkspace *regionWorkspace = nullptr;
 };
 
 /////////////////////////////////////////////////
@@ -176,23 +187,32 @@ void Ogre2SelectionBuffer::Update()
   if (!this->dataPtr->renderTexture)
     return;
 
+  this->UpdateWorkspace(this->dataPtr->ogreCompositorWorkspace);
+}
+
+/////////////////////////////////////////////////
+void Ogre2SelectionBuffer::UpdateWorkspace(
+    Ogre::CompositorWorkspace *_workspace)
+{
   this->dataPtr->materialSwitcher->Reset();
 
+  // the selection buffer identifies visuals by item
+  Ogre2StaticBatchBypass bypass(this->dataPtr->scene);
   this->dataPtr->scene->StartForcedRender();
 
   // manual update
-  // this->dataPtr->ogreCompositorWorkspace->setEnabled(true);
+  // _workspace->setEnabled(true);
   // auto engine = Ogre2RenderEngine::Instance();
   // engine->OgreRoot()->renderOneFrame();
-  // this->dataPtr->ogreCompositorWorkspace->setEnabled(false);
-  this->dataPtr->ogreCompositorWorkspace->_validateFinalTarget();
-  this->dataPtr->ogreCompositorWorkspace->_beginUpdate(false);
-  this->dataPtr->ogreCompositorWorkspace->_update();
-  this->dataPtr->ogreCompositorWorkspace->_endUpdate(false);
+  // _workspace->setEnabled(false);
+  _workspace->_validateFinalTarget();
+  _workspace->_beginUpdate(false);
+  _workspace->_update();
+  _workspace->_endUpdate(false);
 
   Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
   swappedTargets.reserve(2u);
-  this->dataPtr->ogreCompositorWorkspace->_swapFinalTarget(swappedTargets);
+  _workspace->_swapFinalTarget(swappedTargets);
 
   this->dataPtr->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 
@@ -205,6 +225,22 @@ void Ogre2SelectionBuffer::Update()
 /////////////////////////////////////////////////
 void Ogre2SelectionBuffer::DeleteRTTBuffer()
 {
+  if (this->dataPtr->regionWorkspace)
+  {
+    this->dataPtr->ogreCompMgr->removeWorkspace(
+        this->dataPtr->regionWorkspace);
+    this->dataPtr->regionWorkspace = nullptr;
+  }
+
+  if (this->dataPtr->regionTexture)
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    Ogre::TextureGpuManager *textureMgr =
+      engine->OgreRoot()->getRenderSystem()->getTextureGpuManager();
+    textureMgr->destroyTexture(this->dataPtr->regionTexture);
+    this->dataPtr->regionTexture = nullptr;
+  }
+
   if (this->dataPtr->ogreCompositorWorkspace)
   {
     // TODO(ahcorde): Remove the workspace. Potential leak here
@@ -428,54 +464,10 @@ bool Ogre2SelectionBuffer::ExecuteQuery(const int _x, const int _y,
   if (!this->dataPtr->renderTexture)
     return false;
 
-  if (!this->dataPtr->camera)
+  // 1x1 selection buffer
+  if (!this->SetRegionProjection(_x, _y, 1u, 1u))
     return false;
 
-  // check camera has valid projection matrix
-  // There could be nan values if camera was resized
-  Ogre::Matrix4 projectionMatrix =
-      this->dataPtr->camera->getProjectionMatrix();
-  if (projectionMatrix.getTrans().isNaN() ||
-      projectionMatrix.extractQuaternion().isNaN())
-    return false;
-
-   const unsigned int targetWidth = this->dataPtr->width;
-   const unsigned int targetHeight = this->dataPtr->height;
-
-   if (_x < 0 || _y < 0 || _x >= static_cast<int>(targetWidth)
-       || _y >= static_cast<int>(targetHeight))
-     return false;
-
-  // 1x1 selection buffer, adapted from rviz
-  // http://docs.ros.org/indigo/api/rviz/html/c++/selection__manager_8cpp.html
-  unsigned int width = 1;
-  unsigned int height = 1;
-  float x1 = static_cast<float>(_x) /
-      static_cast<float>(targetWidth - 1) - 0.5f;
-  float y1 = static_cast<float>(_y) /
-      static_cast<float>(targetHeight - 1) - 0.5f;
-  float x2 = static_cast<float>(_x+width) /
-      static_cast<float>(targetWidth - 1) - 0.5f;
-  float y2 = static_cast<float>(_y+height) /
-      static_cast<float>(targetHeight - 1) - 0.5f;
-
-  Ogre::Matrix4 scaleMatrix = Ogre::Matrix4::IDENTITY;
-  Ogre::Matrix4 transMatrix = Ogre::Matrix4::IDENTITY;
-  scaleMatrix[0][0] = 1.0 / (x2-x1);
-  scaleMatrix[1][1] = 1.0 / (y2-y1);
-  transMatrix[0][3] -= x1+x2;
-  transMatrix[1][3] += y1+y2;
-  Ogre::Matrix4 customProjectionMatrix =
-      scaleMatrix * transMatrix *
-      this->dataPtr->camera->getProjectionMatrix();
-  this->dataPtr->selectionCamera->setCustomProjectionMatrix(true,
-      customProjectionMatrix);
-
-  this->dataPtr->selectionCamera->setPosition(
-      this->dataPtr->camera->getDerivedPosition());
-  this->dataPtr->selectionCamera->setOrientation(
-      this->dataPtr->camera->getDerivedOrientation());
-
   // update render texture
   this->Update();
 
@@ -499,7 +491,7 @@ bool Ogre2SelectionBuffer::ExecuteQuery(const int _x, const int _y,
   auto pos = Ogre2Conversions::Convert(
       this->dataPtr->camera->getParentSceneNode()->_getDerivedPosition());
   math::Pose3d p(pos, rot);
-  point = rot * point + pos;
+  point = rot * point + pos + this->dataPtr->scene->RenderOrigin();
 
   gz::math::Color cv;
   cv.A(1.0);
@@ -549,3 +541,201 @@ bool Ogre2SelectionBuffer::ExecuteQuery(const int _x, const int _y,
     }
   }
 }
+
+/////////////////////////////////////////////////
+bool Ogre2SelectionBuffer::SetRegionProjection(int _x, int _y,
+    unsigned int _width, unsigned int _height)
+{
+  if (!this->dataPtr->camera)
+    return false;
+
+  // check camera has valid projection matrix
+  // There could be nan values if camera was resized
+  Ogre::Matrix4 projectionMatrix =
+      this->dataPtr->camera->getProjectionMatrix();
+  if (projectionMatrix.getTrans().isNaN() ||
+      projectionMatrix.extractQuaternion().isNaN())
+    return false;
+
+  const unsigned int targetWidth = this->dataPtr->width;
+  const unsigned int targetHeight = this->dataPtr->height;
+
+  if (_x < 0 || _y < 0 || _width == 0u || _height == 0u ||
+      _x + _width > targetWidth || _y + _height > targetHeight)
+    return false;
+
+  // adapted from rviz
+  // http://docs.ros.org/indigo/api/rviz/html/c++/selection__manager_8cpp.html
+  float x1 = static_cast<float>(_x) /
+      static_cast<float>(targetWidth - 1) - 0.5f;
+  float y1 = static_cast<float>(_y) /
+      static_cast<float>(targetHeight - 1) - 0.5f;
+  float x2 = static_cast<float>(_x+_width) /
+      static_cast<float>(targetWidth - 1) - 0.5f;
+  float y2 = static_cast<float>(_y+_height) /
+      static_cast<float>(targetHeight - 1) - 0.5f;
+
+  Ogre::Matrix4 scaleMatrix = Ogre::Matrix4::IDENTITY;
+  Ogre::Matrix4 transMatrix = Ogre::Matrix4::IDENTITY;
+  scaleMatrix[0][0] = 1.0 / (x2-x1);
+  scaleMatrix[1][1] = 1.0 / (y2-y1);
+  transMatrix[0][3] -= x1+x2;
+  transMatrix[1][3] += y1+y2;
+  Ogre::Matrix4 customProjectionMatrix =
+      scaleMatrix * transMatrix *
+      this->dataPtr->camera->getProjectionMatrix();
+  this->dataPtr->selectionCamera->setCustomProjectionMatrix(true,
+      customProjectionMatrix);
+
+  this->dataPtr->selectionCamera->setPosition(
+      this->dataPtr->camera->getDerivedPosition());
+  this->dataPtr->selectionCamera->setOrientation(
+      this->dataPtr->camera->getDerivedOrientation());
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool Ogre2SelectionBuffer::RenderRegion(int _x, int _y,
+    unsigned int _width, unsigned int _height)
+{
+  if (!this->dataPtr->renderTexture)
+    return false;
+
+  if (!this->SetRegionProjection(_x, _y, _width, _height))
+    return false;
+
+  // (re)create the region render texture if the region size changed. The
+  // selection compositor node sizes its textures relative to the final
+  // target so the same workspace definition is reused.
+  Ogre::TextureGpu *texture = this->dataPtr->regionTexture;
+  if (!texture || texture->getWidth() != _width ||
+      texture->getHeight() != _height)
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    Ogre::TextureGpuManager *textureMgr =
+      engine->OgreRoot()->getRenderSystem()->getTextureGpuManager();
+    if (this->dataPtr->regionWorkspace)
+    {
+      this->dataPtr->ogreCompMgr->removeWorkspace(
+          this->dataPtr->regionWorkspace);
+      this->dataPtr->regionWorkspace = nullptr;
+    }
+    if (texture)
+      textureMgr->destroyTexture(texture);
+
+    texture = textureMgr->createTexture(
+        this->dataPtr->camera->getName() + "_SelectionRegionTex",
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::RenderToTexture,
+        Ogre::TextureTypes::Type2D);
+    texture->setResolution(_width, _height);
+    texture->setNumMipmaps(1u);
+    texture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
+    texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    this->dataPtr->regionTexture = texture;
+
+    this->dataPtr->regionWorkspace =
+        this->dataPtr->ogreCompMgr->addWorkspace(
+          this->dataPtr->scene->OgreSceneManager(),
+          texture,
+          this->dataPtr->selectionCamera,
+          this->dataPtr->ogreCompWorkspaceDefName,
+          false);
+  }
+
+  this->UpdateWorkspace(this->dataPtr->regionWorkspace);
+  return true;
+}
+
+/////////////////////////////////////////////////
+std::vector<Ogre::Item *> Ogre2SelectionBuffer::ItemsInBox(
+    const Ogre::TextureBox &_box) const
+{
+  // collect the distinct entity colors first, most pixels of a region
+  // belong to a handful of entities
+  std::set<uint32_t> colors;
+  for (uint32_t y = 0u; y < _box.height; ++y)
+  {
+    const float *row = reinterpret_cast<const float *>(
+        static_cast<const unsigned char *>(_box.data) + y * _box.bytesPerRow);
+    for (uint32_t x = 0u; x < _box.width; ++x)
+    {
+      // the entity color is packed into the bits of the alpha channel
+      uint32_t rgba;
+      std::memcpy(&rgba, &row[x * 4u + 3u], sizeof(rgba));
+      colors.insert(rgba >> 8);
+    }
+  }
+
+  std::vector<Ogre::Item *> items;
+  for (uint32_t rgb : colors)
+  {
+    gz::math::Color cv;
+    cv.A(1.0);
+    cv.R((rgb >> 16 & 0xFF) / 255.0);
+    cv.G((rgb >> 8 & 0xFF) / 255.0);
+    cv.B((rgb & 0xFF) / 255.0);
+
+    const std::string &entName =
+      this->dataPtr->materialSwitcher->EntityName(cv);
+    if (entName.empty())
+      continue;
+
+    // heightmaps are not items so they are not included, see ExecuteQuery
+    auto collection = this->dataPtr->sceneMgr->findMovableObjects(
+        Ogre::ItemFactory::FACTORY_TYPE_NAME, entName);
+    if (!collection.empty())
+    {
+      Ogre::Item *item = dynamic_cast<Ogre::Item *>(collection[0]);
+      if (item)
+        items.push_back(item);
+    }
+  }
+  return items;
+}
+
+/////////////////////////////////////////////////
+std::vector<Ogre::Item *> Ogre2SelectionBuffer::ExecuteRegionQuery(
+    int _x, int _y, unsigned int _width, unsigned int _height)
+{
+  if (!this->RenderRegion(_x, _y, _width, _height))
+    return std::vector<Ogre::Item *>();
+
+  Ogre::Image2 image;
+  image.convertFromTexture(this->dataPtr->regionTexture, 0, 0);
+  return this->ItemsInBox(image.getData(0));
+}
+
+/////////////////////////////////////////////////
+std::future<std::vector<Ogre::Item *>>
+    Ogre2SelectionBuffer::ExecuteRegionQueryAsync(
+    int _x, int _y, unsigned int _width, unsigned int _height)
+{
+  if (!this->RenderRegion(_x, _y, _width, _height))
+  {
+    std::promise<std::vector<Ogre::Item *>> empty;
+    empty.set_value(std::vector<Ogre::Item *>());
+    return empty.get_future();
+  }
+
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::TextureGpuManager *textureMgr =
+    engine->OgreRoot()->getRenderSystem()->getTextureGpuManager();
+  std::shared_ptr<Ogre::AsyncTextureTicket> ticket(
+      textureMgr->createAsyncTextureTicket(_width, _height, 1u,
+          Ogre::TextureTypes::Type2D, Ogre::PFG_RGBA32_FLOAT),
+      [textureMgr](Ogre::AsyncTextureTicket *_ticket)
+      {
+        textureMgr->destroyAsyncTextureTicket(_ticket);
+      });
+  ticket->download(this->dataPtr->regionTexture, 0u, false);
+
+  // the download is only mapped when the caller asks for the result
+  return std::async(std::launch::deferred, [this, ticket]()
+      {
+        const Ogre::TextureBox box = ticket->map(0u);
+        std::vector<Ogre::Item *> items = this->ItemsInBox(box);
+        ticket->unmap();
+        return items;
+      });
+}
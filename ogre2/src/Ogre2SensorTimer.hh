@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2SENSORTIMER_HH_
+#define GZ_RENDERING_OGRE2_OGRE2SENSORTIMER_HH_
+
+#include <chrono>
+#include <string>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/RenderStats.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Times a phase of a sensor update for Scene::Stats. The phase
+/// starts when the timer is constructed and ends when it is destroyed.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2SensorTimer
+{
+  /// \brief Constructor. Starts timing.
+  /// \param[in] _scene Scene of the sensor, may be null
+  /// \param[in] _name Name of the sensor
+  /// \param[in] _phase Phase to time
+  public: Ogre2SensorTimer(const Ogre2ScenePtr &_scene,
+              const std::string &_name, SensorPhase _phase)
+    : scene(_scene.get()), name(_name), phase(_phase),
+      start(std::chrono::steady_clock::now())
+  {
+  }
+
+  /// \brief Destructor. Records the duration of the phase.
+  public: ~Ogre2SensorTimer()
+  {
+    if (this->scene)
+    {
+      this->scene->RecordSensorTime(this->name, this->phase,
+          std::chrono::steady_clock::now() - this->start);
+    }
+  }
+
+  /// \brief Scene to record the duration in
+  private: Ogre2Scene *scene;
+
+  /// \brief Name of the sensor
+  private: std::string name;
+
+  /// \brief Timed phase
+  private: SensorPhase phase;
+
+  /// \brief Start time of the phase
+  private: std::chrono::steady_clock::time_point start;
+};
+}
+}
+}
+#endif
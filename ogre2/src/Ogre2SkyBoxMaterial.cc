@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <gz/common/Console.hh>
+
+#include "Ogre2SkyBoxMaterial.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreTechnique.h>
+#include <OgreTextureUnitState.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Name of the sky box material defined in skybox.material
+static const char kSkyboxMaterialName[] = "SkyBox";
+
+//////////////////////////////////////////////////
+std::string Ogre2SkyBoxMaterial::Acquire(const std::string &_environmentMap)
+{
+  Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
+  const std::string skyMatName =
+      std::string(kSkyboxMaterialName) + "/" + _environmentMap;
+  if (matManager.getByName(skyMatName))
+    return skyMatName;
+
+  auto skyboxMat = matManager.getByName(kSkyboxMaterialName);
+  if (!skyboxMat)
+  {
+    gzerr << "Unable to find skybox material" << std::endl;
+    return std::string();
+  }
+  auto mat = skyboxMat->clone(skyMatName);
+  Ogre::TextureUnitState *texUnit =
+      mat->getTechnique(0u)->getPass(0u)->getTextureUnitState(0u);
+  texUnit->setTextureName(_environmentMap, Ogre::TextureTypes::TypeCube);
+  texUnit->setHardwareGammaEnabled(false);
+  return skyMatName;
+}
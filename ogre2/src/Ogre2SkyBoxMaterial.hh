@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2SKYBOXMATERIAL_HH_
+#define GZ_RENDERING_OGRE2_OGRE2SKYBOXMATERIAL_HH_
+
+#include <string>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Shares the sky box materials between cameras. The sky is a
+/// static cubemap sampled by a quad pass, so every camera that renders the
+/// same environment map uses the same material instead of a clone of its
+/// own.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2SkyBoxMaterial
+{
+  /// \brief Get the sky box material sampling an environment map, creating
+  /// it if no camera uses it yet
+  /// \param[in] _environmentMap Cubemap texture of the sky
+  /// \return Name of the material, empty if it could not be created
+  public: static std::string Acquire(const std::string &_environmentMap);
+};
+}
+}
+}
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2STATICBATCHBYPASS_HH_
+#define GZ_RENDERING_OGRE2_OGRE2STATICBATCHBYPASS_HH_
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Draws the original static visuals instead of the batches of
+/// Scene::BakeStaticVisuals while in scope. Used by sensors that tell
+/// visuals apart, since a batch is a single item for all its visuals.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2StaticBatchBypass
+{
+  /// \brief Constructor. Bypasses the batches.
+  /// \param[in] _scene Scene of the sensor, may be null
+  public: explicit Ogre2StaticBatchBypass(const Ogre2ScenePtr &_scene)
+    : scene(_scene.get())
+  {
+    if (this->scene)
+      this->scene->SetStaticBatchesBypassed(true);
+  }
+
+  /// \brief Destructor. Draws the batches again.
+  public: ~Ogre2StaticBatchBypass()
+  {
+    if (this->scene)
+      this->scene->SetStaticBatchesBypassed(false);
+  }
+
+  /// \brief Scene whose batches are bypassed
+  private: Ogre2Scene *scene;
+};
+}
+}
+}
+#endif
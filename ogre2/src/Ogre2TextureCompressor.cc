@@ -0,0 +1,694 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "Ogre2TextureCompressor.hh"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Image.hh>
+#include <gz/common/Util.hh>
+#include <gz/common/Uuid.hh>
+
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreImage2.h>
+#include <OgreRenderSystem.h>
+#include <OgreRenderSystemCapabilities.h>
+#include <OgreRoot.h>
+#include <OgreTextureGpu.h>
+#include <OgreTextureGpuManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Bump when the compression changes so stale cache entries are
+/// ignored
+static const uint32_t kTextureCacheVersion = 1u;
+
+/// \brief Magic number at the start of cached textures
+static const char kTextureCacheMagic[4] = {'G', 'Z', 'T', 'C'};
+
+/// \brief Interpolation weights of BC7 4 bit indices
+static const int kBc7Weights[16] =
+    {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+/// \brief Compressed mip levels of a texture
+struct Ogre2CompressedTexture
+{
+  /// \brief Width of the first mip level
+  uint32_t width = 0u;
+
+  /// \brief Height of the first mip level
+  uint32_t height = 0u;
+
+  /// \brief Number of mip levels
+  uint32_t mipmaps = 0u;
+
+  /// \brief Blocks of all the mip levels, from the largest one
+  std::vector<uint8_t> data;
+};
+
+/// \brief Writes bits to a block, least significant bit first
+struct BlockWriter
+{
+  /// \brief Write the lowest bits of a value
+  /// \param[in] _value Value to write
+  /// \param[in] _bits Number of bits to write
+  void Write(uint32_t _value, unsigned int _bits)
+  {
+    for (unsigned int i = 0u; i < _bits; ++i, ++this->pos)
+    {
+      if ((_value >> i) & 1u)
+      {
+        this->block[this->pos >> 3u] |=
+            static_cast<uint8_t>(1u << (this->pos & 7u));
+      }
+    }
+  }
+
+  /// \brief Block to write to, zeroed
+  uint8_t *block = nullptr;
+
+  /// \brief Next bit to write
+  unsigned int pos = 0u;
+};
+
+/// \brief Gather the pixels of a 4x4 block, repeating the last row and
+/// column of images smaller than a block
+/// \param[in] _rgba Tightly packed RGBA pixels
+/// \param[in] _width Image width
+/// \param[in] _height Image height
+/// \param[in] _bx Block column
+/// \param[in] _by Block row
+/// \param[out] _pixels Pixels of the block, row by row
+static void GatherBlock(const uint8_t *_rgba, uint32_t _width,
+    uint32_t _height, uint32_t _bx, uint32_t _by, uint8_t _pixels[16][4])
+{
+  for (uint32_t y = 0u; y < 4u; ++y)
+  {
+    const uint32_t py = std::min(_by * 4u + y, _height - 1u);
+    for (uint32_t x = 0u; x < 4u; ++x)
+    {
+      const uint32_t px = std::min(_bx * 4u + x, _width - 1u);
+      std::memcpy(_pixels[y * 4u + x], _rgba + (py * _width + px) * 4u, 4u);
+    }
+  }
+}
+
+/// \brief Compress a block to BC7 mode 6, i.e. a single RGBA line with
+/// 16 interpolation steps. The line is the principal axis of the pixels.
+/// \param[in] _pixels Pixels of the block
+/// \param[out] _block 16 byte block
+static void CompressBc7Block(const uint8_t _pixels[16][4], uint8_t *_block)
+{
+  float mean[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    for (unsigned int c = 0u; c < 4u; ++c)
+      mean[c] += _pixels[i][c] / 16.0f;
+  }
+
+  float cov[4][4] = {};
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    float d[4];
+    for (unsigned int c = 0u; c < 4u; ++c)
+      d[c] = _pixels[i][c] - mean[c];
+    for (unsigned int a = 0u; a < 4u; ++a)
+    {
+      for (unsigned int b = 0u; b < 4u; ++b)
+        cov[a][b] += d[a] * d[b];
+    }
+  }
+
+  // principal axis by power iteration, starting from the channel ranges
+  float axis[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  for (unsigned int c = 0u; c < 4u; ++c)
+  {
+    uint8_t lo = 255u;
+    uint8_t hi = 0u;
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+      lo = std::min(lo, _pixels[i][c]);
+      hi = std::max(hi, _pixels[i][c]);
+    }
+    axis[c] = static_cast<float>(hi - lo);
+  }
+  for (unsigned int iter = 0u; iter < 8u; ++iter)
+  {
+    float next[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (unsigned int a = 0u; a < 4u; ++a)
+    {
+      for (unsigned int b = 0u; b < 4u; ++b)
+        next[a] += cov[a][b] * axis[b];
+    }
+    const float length = std::sqrt(next[0] * next[0] + next[1] * next[1] +
+        next[2] * next[2] + next[3] * next[3]);
+    if (length < 1e-6f)
+      break;
+    for (unsigned int c = 0u; c < 4u; ++c)
+      axis[c] = next[c] / length;
+  }
+
+  float tMin = 0.0f;
+  float tMax = 0.0f;
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    float t = 0.0f;
+    for (unsigned int c = 0u; c < 4u; ++c)
+      t += (_pixels[i][c] - mean[c]) * axis[c];
+    tMin = std::min(tMin, t);
+    tMax = std::max(tMax, t);
+  }
+
+  // quantize the endpoints to 7 bits and a shared lowest bit
+  int endpoints[2][4];
+  int pBits[2];
+  for (unsigned int e = 0u; e < 2u; ++e)
+  {
+    const float t = e == 0u ? tMin : tMax;
+    float target[4];
+    for (unsigned int c = 0u; c < 4u; ++c)
+      target[c] = std::clamp(mean[c] + axis[c] * t, 0.0f, 255.0f);
+
+    float bestError = -1.0f;
+    for (int p = 0; p < 2; ++p)
+    {
+      int q[4];
+      float error = 0.0f;
+      for (unsigned int c = 0u; c < 4u; ++c)
+      {
+        q[c] = std::clamp(
+            static_cast<int>(std::lround((target[c] - p) / 2.0f)), 0, 127);
+        const float diff = static_cast<float>((q[c] << 1) | p) - target[c];
+        error += diff * diff;
+      }
+      if (bestError < 0.0f || error < bestError)
+      {
+        bestError = error;
+        std::copy(q, q + 4, endpoints[e]);
+        pBits[e] = p;
+      }
+    }
+  }
+
+  int palette[16][4];
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    for (unsigned int c = 0u; c < 4u; ++c)
+    {
+      const int e0 = (endpoints[0][c] << 1) | pBits[0];
+      const int e1 = (endpoints[1][c] << 1) | pBits[1];
+      palette[i][c] =
+          ((64 - kBc7Weights[i]) * e0 + kBc7Weights[i] * e1 + 32) >> 6;
+    }
+  }
+
+  unsigned int indices[16];
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    int bestError = -1;
+    for (unsigned int k = 0u; k < 16u; ++k)
+    {
+      int error = 0;
+      for (unsigned int c = 0u; c < 4u; ++c)
+      {
+        const int diff = palette[k][c] - _pixels[i][c];
+        error += diff * diff;
+      }
+      if (bestError < 0 || error < bestError)
+      {
+        bestError = error;
+        indices[i] = k;
+      }
+    }
+  }
+
+  // the highest bit of the first index is implicitly 0
+  if (indices[0] & 8u)
+  {
+    std::swap(endpoints[0], endpoints[1]);
+    std::swap(pBits[0], pBits[1]);
+    for (unsigned int &index : indices)
+      index = 15u - index;
+  }
+
+  std::memset(_block, 0, 16u);
+  BlockWriter writer;
+  writer.block = _block;
+  writer.Write(1u << 6u, 7u);
+  for (unsigned int c = 0u; c < 4u; ++c)
+  {
+    writer.Write(endpoints[0][c], 7u);
+    writer.Write(endpoints[1][c], 7u);
+  }
+  writer.Write(pBits[0], 1u);
+  writer.Write(pBits[1], 1u);
+  writer.Write(indices[0], 3u);
+  for (unsigned int i = 1u; i < 16u; ++i)
+    writer.Write(indices[i], 4u);
+}
+
+/// \brief Compress a channel of a block to BC4
+/// \param[in] _values Values of the block
+/// \param[out] _block 8 byte block
+static void CompressBc4Block(const uint8_t _values[16], uint8_t *_block)
+{
+  uint8_t lo = 255u;
+  uint8_t hi = 0u;
+  for (unsigned int i = 0u; i < 16u; ++i)
+  {
+    lo = std::min(lo, _values[i]);
+    hi = std::max(hi, _values[i]);
+  }
+  _block[0] = hi;
+  _block[1] = lo;
+
+  // with the first endpoint larger there are 6 interpolated values
+  uint64_t bits = 0u;
+  if (hi > lo)
+  {
+    int palette[8];
+    palette[0] = hi;
+    palette[1] = lo;
+    for (int i = 2; i < 8; ++i)
+      palette[i] = ((8 - i) * hi + (i - 1) * lo) / 7;
+
+    for (unsigned int i = 0u; i < 16u; ++i)
+    {
+      uint64_t best = 0u;
+      int bestError = 256;
+      for (unsigned int k = 0u; k < 8u; ++k)
+      {
+        const int error = std::abs(palette[k] - _values[i]);
+        if (error < bestError)
+        {
+          bestError = error;
+          best = k;
+        }
+      }
+      bits |= best << (3u * i);
+    }
+  }
+  for (unsigned int k = 0u; k < 6u; ++k)
+    _block[2u + k] = static_cast<uint8_t>(bits >> (8u * k));
+}
+
+/// \brief Halve the size of an image with a box filter
+/// \param[in] _rgba Tightly packed RGBA pixels
+/// \param[in,out] _width Image width, halved
+/// \param[in,out] _height Image height, halved
+/// \param[in] _srgb True to average the colors in linear space
+/// \param[in] _normalMap True to renormalize the averaged normals
+/// \return Downsampled pixels
+static std::vector<uint8_t> Downsample(const std::vector<uint8_t> &_rgba,
+    uint32_t &_width, uint32_t &_height, bool _srgb, bool _normalMap)
+{
+  static const std::array<float, 256> toLinear = []()
+  {
+    std::array<float, 256> table;
+    for (unsigned int i = 0u; i < 256u; ++i)
+      table[i] = std::pow(i / 255.0f, 2.2f);
+    return table;
+  }();
+
+  const uint32_t width = std::max(_width / 2u, 1u);
+  const uint32_t height = std::max(_height / 2u, 1u);
+  std::vector<uint8_t> result(width * height * 4u);
+  for (uint32_t y = 0u; y < height; ++y)
+  {
+    for (uint32_t x = 0u; x < width; ++x)
+    {
+      float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      for (uint32_t dy = 0u; dy < 2u; ++dy)
+      {
+        const uint32_t sy = std::min(y * 2u + dy, _height - 1u);
+        for (uint32_t dx = 0u; dx < 2u; ++dx)
+        {
+          const uint32_t sx = std::min(x * 2u + dx, _width - 1u);
+          const uint8_t *p = &_rgba[(sy * _width + sx) * 4u];
+          for (unsigned int c = 0u; c < 4u; ++c)
+          {
+            if (_normalMap && c < 3u)
+              sum[c] += p[c] / 127.5f - 1.0f;
+            else if (_srgb && c < 3u)
+              sum[c] += toLinear[p[c]];
+            else
+              sum[c] += p[c] / 255.0f;
+          }
+        }
+      }
+
+      uint8_t *out = &result[(y * width + x) * 4u];
+      if (_normalMap)
+      {
+        float length = std::sqrt(
+            sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+        if (length < 1e-6f)
+        {
+          sum[2] = 1.0f;
+          length = 1.0f;
+        }
+        for (unsigned int c = 0u; c < 3u; ++c)
+        {
+          out[c] = static_cast<uint8_t>(std::lround(
+              std::clamp((sum[c] / length + 1.0f) * 127.5f, 0.0f, 255.0f)));
+        }
+      }
+      for (unsigned int c = _normalMap ? 3u : 0u; c < 4u; ++c)
+      {
+        float value = sum[c] / 4.0f;
+        if (_srgb && c < 3u)
+          value = std::pow(value, 1.0f / 2.2f);
+        out[c] = static_cast<uint8_t>(
+            std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+      }
+    }
+  }
+  _width = width;
+  _height = height;
+  return result;
+}
+
+/// \brief Compress a texture file and generate its mip levels
+/// \param[in] _path Path to the texture file
+/// \param[in] _maxSize Maximum texture width and height, 0 for no limit
+/// \param[in] _srgb True for textures in sRGB color space
+/// \param[in] _normalMap True to compress to BC5
+/// \param[in] _scene Scene whose worker threads compress the texture
+/// \param[out] _texture Compressed texture
+/// \return True if the texture was compressed
+static bool Compress(const std::string &_path, unsigned int _maxSize,
+    bool _srgb, bool _normalMap, Ogre2ScenePtr _scene,
+    Ogre2CompressedTexture &_texture)
+{
+  common::Image image(_path);
+  if (!image.Valid())
+    return false;
+
+  uint32_t width = image.Width();
+  uint32_t height = image.Height();
+  std::vector<uint8_t> rgba = image.RGBAData();
+  if (width == 0u || height == 0u || rgba.size() != width * height * 4u)
+    return false;
+
+  // halve the size until it fits, the same as dropping mip levels
+  while (_maxSize > 0u && std::max(width, height) > _maxSize)
+    rgba = Downsample(rgba, width, height, _srgb, _normalMap);
+
+  // the first level must consist of whole blocks
+  if (width % 4u != 0u || height % 4u != 0u)
+    return false;
+
+  _texture.width = width;
+  _texture.height = height;
+  _texture.mipmaps = 0u;
+  _texture.data.clear();
+  while (true)
+  {
+    const uint32_t blocksX = (width + 3u) / 4u;
+    const uint32_t blocksY = (height + 3u) / 4u;
+    const size_t offset = _texture.data.size();
+    _texture.data.resize(offset + blocksX * blocksY * 16u);
+    uint8_t *blocks = _texture.data.data() + offset;
+    const uint8_t *pixels = rgba.data();
+    auto compressRows = [&](unsigned int _begin, unsigned int _end)
+    {
+      if (_normalMap)
+      {
+        Ogre2TextureCompressor::CompressBc5(pixels, width, height, _begin,
+            _end, blocks);
+      }
+      else
+      {
+        Ogre2TextureCompressor::CompressBc7(pixels, width, height, _begin,
+            _end, blocks);
+      }
+    };
+    if (_scene)
+      _scene->ParallelForRows(blocksY, compressRows, 4u);
+    else
+      compressRows(0u, blocksY);
+    ++_texture.mipmaps;
+
+    if (width == 1u && height == 1u)
+      break;
+    rgba = Downsample(rgba, width, height, _srgb, _normalMap);
+  }
+  return true;
+}
+
+/// \brief Read a compressed texture from the disk cache
+/// \param[in] _path Path to the cached texture
+/// \param[in] _format Expected pixel format
+/// \param[out] _texture Cached texture
+/// \return True if the cached texture was read
+static bool ReadCache(const std::string &_path, uint32_t _format,
+    Ogre2CompressedTexture &_texture)
+{
+  std::ifstream in(_path, std::ios::binary);
+  if (!in)
+    return false;
+
+  char magic[4];
+  uint32_t version = 0u;
+  uint32_t format = 0u;
+  uint64_t size = 0u;
+  in.read(magic, sizeof(magic));
+  in.read(reinterpret_cast<char *>(&version), sizeof(version));
+  in.read(reinterpret_cast<char *>(&format), sizeof(format));
+  in.read(reinterpret_cast<char *>(&_texture.width), sizeof(_texture.width));
+  in.read(reinterpret_cast<char *>(&_texture.height),
+      sizeof(_texture.height));
+  in.read(reinterpret_cast<char *>(&_texture.mipmaps),
+      sizeof(_texture.mipmaps));
+  in.read(reinterpret_cast<char *>(&size), sizeof(size));
+  if (!in || std::memcmp(magic, kTextureCacheMagic, sizeof(magic)) != 0 ||
+      version != kTextureCacheVersion || format != _format ||
+      _texture.mipmaps == 0u || size > (1ull << 32u))
+  {
+    return false;
+  }
+
+  _texture.data.resize(size);
+  in.read(reinterpret_cast<char *>(_texture.data.data()), size);
+  return static_cast<bool>(in);
+}
+
+/// \brief Write a compressed texture to the disk cache
+/// \param[in] _path Path to the cached texture
+/// \param[in] _format Pixel format of the texture
+/// \param[in] _texture Texture to cache
+static void WriteCache(const std::string &_path, uint32_t _format,
+    const Ogre2CompressedTexture &_texture)
+{
+  std::string dir = common::parentPath(_path);
+  if (!common::exists(dir) && !common::createDirectories(dir))
+  {
+    gzwarn << "Unable to create texture cache directory [" << dir << "]"
+           << std::endl;
+    return;
+  }
+
+  // write to a temporary file first so concurrent processes never read a
+  // partially written texture
+  std::string tmpPath = _path + "." + common::Uuid().String() + ".tmp";
+  {
+    std::ofstream out(tmpPath, std::ios::binary);
+    const uint64_t size = _texture.data.size();
+    out.write(kTextureCacheMagic, sizeof(kTextureCacheMagic));
+    out.write(reinterpret_cast<const char *>(&kTextureCacheVersion),
+        sizeof(kTextureCacheVersion));
+    out.write(reinterpret_cast<const char *>(&_format), sizeof(_format));
+    out.write(reinterpret_cast<const char *>(&_texture.width),
+        sizeof(_texture.width));
+    out.write(reinterpret_cast<const char *>(&_texture.height),
+        sizeof(_texture.height));
+    out.write(reinterpret_cast<const char *>(&_texture.mipmaps),
+        sizeof(_texture.mipmaps));
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char *>(_texture.data.data()),
+        _texture.data.size());
+    if (!out)
+    {
+      gzwarn << "Unable to cache texture [" << _path << "]" << std::endl;
+      out.close();
+      common::removeFile(tmpPath);
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmpPath, _path, ec);
+  if (ec)
+    common::removeFile(tmpPath);
+}
+
+//////////////////////////////////////////////////
+Ogre::TextureGpu *Ogre2TextureCompressor::Load(const std::string &_name,
+    const std::string &_path, unsigned int _maxSize, bool _srgb,
+    bool _normalMap, Ogre2ScenePtr _scene)
+{
+  LoadTraceScope scope(Ogre2RenderEngine::Instance()->Trace(),
+      "Ogre2TextureCompressor::Load", "texture", _path);
+
+  Ogre::RenderSystem *renderSystem =
+      Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem();
+  const Ogre::RenderSystemCapabilities *caps =
+      renderSystem->getCapabilities();
+  if (!caps || !caps->hasCapability(_normalMap ?
+      Ogre::RSC_TEXTURE_COMPRESSION_BC4_BC5 :
+      Ogre::RSC_TEXTURE_COMPRESSION_BC6H_BC7))
+  {
+    return nullptr;
+  }
+
+  // compressed textures get their own name, Ogre may load the same file
+  // uncompressed, e.g. for other texture types
+  const std::string name = _name + (_normalMap ? "::BC5" : "::BC7");
+  Ogre::TextureGpuManager *textureMgr = renderSystem->getTextureGpuManager();
+  Ogre::TextureGpu *texture = textureMgr->findTextureNoThrow(name);
+  if (texture)
+    return texture;
+
+  Ogre::PixelFormatGpu format = Ogre::PFG_BC5_UNORM;
+  if (!_normalMap)
+    format = _srgb ? Ogre::PFG_BC7_UNORM_SRGB : Ogre::PFG_BC7_UNORM;
+
+  // cache entries are keyed by the file contents, so edited textures are
+  // compressed again wherever they are
+  std::string cachedPath;
+  const std::string cachePath =
+      Ogre2RenderEngine::Instance()->TextureCachePath();
+  if (!cachePath.empty())
+  {
+    std::ifstream file(_path, std::ios::binary);
+    if (file)
+    {
+      const std::string contents((std::istreambuf_iterator<char>(file)),
+          std::istreambuf_iterator<char>());
+      std::stringstream key;
+      key << kTextureCacheVersion << "::" << static_cast<int>(format)
+          << "::" << _maxSize << "::" << common::sha1(contents);
+      cachedPath =
+          common::joinPaths(cachePath, common::sha1(key.str()) + ".tex");
+    }
+  }
+
+  Ogre2CompressedTexture compressed;
+  const uint32_t formatId = static_cast<uint32_t>(format);
+  if (cachedPath.empty() || !ReadCache(cachedPath, formatId, compressed))
+  {
+    if (!Compress(_path, _maxSize, _srgb, _normalMap, _scene, compressed))
+      return nullptr;
+    gzdbg << "Compressed texture [" << _name << "] to "
+          << (_normalMap ? "BC5" : "BC7") << std::endl;
+    if (!cachedPath.empty())
+      WriteCache(cachedPath, formatId, compressed);
+  }
+
+  try
+  {
+    texture = textureMgr->createOrRetrieveTexture(
+        name,
+        Ogre::GpuPageOutStrategy::Discard,
+        Ogre::TextureFlags::AutomaticBatching |
+        Ogre::TextureFlags::ManualTexture,
+        Ogre::TextureTypes::Type2D,
+        Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME,
+        0u);
+    texture->setPixelFormat(format);
+    texture->setTextureType(Ogre::TextureTypes::Type2D);
+    texture->setNumMipmaps(static_cast<uint8_t>(compressed.mipmaps));
+    texture->setResolution(compressed.width, compressed.height);
+    texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+    texture->waitForData();
+
+    Ogre::Image2 image;
+    image.loadDynamicImage(compressed.data.data(), compressed.width,
+        compressed.height, 1u, Ogre::TextureTypes::Type2D, format, false,
+        static_cast<uint8_t>(compressed.mipmaps));
+    image.uploadTo(texture, 0u, texture->getNumMipmaps() - 1u);
+  }
+  catch(Ogre::Exception &e)
+  {
+    gzwarn << "Unable to upload compressed texture [" << _name << "]: "
+           << e.getDescription() << std::endl;
+    if (texture)
+      textureMgr->destroyTexture(texture);
+    return nullptr;
+  }
+  return texture;
+}
+
+//////////////////////////////////////////////////
+void Ogre2TextureCompressor::CompressBc7(const uint8_t *_rgba,
+    uint32_t _width, uint32_t _height, uint32_t _rowBegin, uint32_t _rowEnd,
+    uint8_t *_blocks)
+{
+  const uint32_t blocksX = (_width + 3u) / 4u;
+  uint8_t pixels[16][4];
+  for (uint32_t by = _rowBegin; by < _rowEnd; ++by)
+  {
+    for (uint32_t bx = 0u; bx < blocksX; ++bx)
+    {
+      GatherBlock(_rgba, _width, _height, bx, by, pixels);
+      CompressBc7Block(pixels, _blocks + (by * blocksX + bx) * 16u);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2TextureCompressor::CompressBc5(const uint8_t *_rgba,
+    uint32_t _width, uint32_t _height, uint32_t _rowBegin, uint32_t _rowEnd,
+    uint8_t *_blocks)
+{
+  const uint32_t blocksX = (_width + 3u) / 4u;
+  uint8_t pixels[16][4];
+  uint8_t values[16];
+  for (uint32_t by = _rowBegin; by < _rowEnd; ++by)
+  {
+    for (uint32_t bx = 0u; bx < blocksX; ++bx)
+    {
+      GatherBlock(_rgba, _width, _height, bx, by, pixels);
+      uint8_t *block = _blocks + (by * blocksX + bx) * 16u;
+      for (unsigned int c = 0u; c < 2u; ++c)
+      {
+        for (unsigned int i = 0u; i < 16u; ++i)
+          values[i] = pixels[i][c];
+        CompressBc4Block(values, block + c * 8u);
+      }
+    }
+  }
+}
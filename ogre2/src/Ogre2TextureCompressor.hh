@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_RENDERING_OGRE2_OGRE2TEXTURECOMPRESSOR_HH_
+#define GZ_RENDERING_OGRE2_OGRE2TEXTURECOMPRESSOR_HH_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace Ogre
+{
+  class TextureGpu;
+}
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Compresses textures to GPU block formats when they are loaded,
+/// see the "textureCompression" parameter of Ogre2RenderEngine. Color
+/// textures become BC7 and normal maps BC5, with all mip levels generated
+/// on the CPU. Compressed textures are cached on disk by the hash of their
+/// file contents, see Ogre2RenderEngine::TextureCachePath.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2TextureCompressor
+{
+  /// \brief Load a compressed texture, compressing it if it is not in the
+  /// disk cache yet
+  /// \param[in] _name Name of the texture resource
+  /// \param[in] _path Path to the texture file
+  /// \param[in] _maxSize Maximum texture width and height, 0 for no limit
+  /// \param[in] _srgb True for textures in sRGB color space
+  /// \param[in] _normalMap True for normal maps
+  /// \param[in] _scene Scene whose worker threads compress the texture
+  /// \return Loaded texture or an existing texture with the same name,
+  /// nullptr if the texture can not be compressed, e.g. because the GPU
+  /// does not support the format, and should be loaded as usual
+  public: static Ogre::TextureGpu *Load(const std::string &_name,
+              const std::string &_path, unsigned int _maxSize, bool _srgb,
+              bool _normalMap, Ogre2ScenePtr _scene);
+
+  /// \brief Compress RGBA pixels to BC7 blocks
+  /// \param[in] _rgba Tightly packed RGBA pixels, 8 bits per channel
+  /// \param[in] _width Width in pixels
+  /// \param[in] _height Height in pixels
+  /// \param[in] _rowBegin First row of blocks to compress
+  /// \param[in] _rowEnd One past the last row of blocks to compress
+  /// \param[out] _blocks Blocks of the whole image, 16 bytes each, row by
+  /// row. Only the blocks of the given rows are written.
+  public: static void CompressBc7(const uint8_t *_rgba, uint32_t _width,
+              uint32_t _height, uint32_t _rowBegin, uint32_t _rowEnd,
+              uint8_t *_blocks);
+
+  /// \brief Compress the red and green channels of RGBA pixels to BC5
+  /// blocks
+  /// \param[in] _rgba Tightly packed RGBA pixels, 8 bits per channel
+  /// \param[in] _width Width in pixels
+  /// \param[in] _height Height in pixels
+  /// \param[in] _rowBegin First row of blocks to compress
+  /// \param[in] _rowEnd One past the last row of blocks to compress
+  /// \param[out] _blocks Blocks of the whole image, 16 bytes each, row by
+  /// row. Only the blocks of the given rows are written.
+  public: static void CompressBc5(const uint8_t *_rgba, uint32_t _width,
+              uint32_t _height, uint32_t _rowBegin, uint32_t _rowEnd,
+              uint8_t *_blocks);
+};
+}
+}
+}
+#endif
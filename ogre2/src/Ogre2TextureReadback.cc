@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "Ogre2TextureReadback.hh"
+
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreAsyncTextureTicket.h>
+#include <OgrePixelFormatGpuUtils.h>
+#include <OgreRenderSystem.h>
+#include <OgreRoot.h>
+#include <OgreTextureGpuManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2TextureReadback::~Ogre2TextureReadback()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2TextureReadback::Download(Ogre::TextureGpu *_texture,
+    unsigned int _count, const FrameInfo &_info,
+    const Ogre::TextureBox *_region)
+{
+  this->Unmap();
+
+  const uint32_t width = _region ? _region->width : _texture->getWidth();
+  const uint32_t height = _region ? _region->height : _texture->getHeight();
+  if (this->tickets.size() != _count ||
+      this->tickets[0]->getWidth() != width ||
+      this->tickets[0]->getHeight() != height ||
+      this->tickets[0]->getPixelFormatFamily() !=
+      Ogre::PixelFormatGpuUtils::getFamily(_texture->getPixelFormat()))
+  {
+    this->Destroy();
+
+    Ogre::TextureGpuManager *textureMgr =
+        Ogre2RenderEngine::Instance()->OgreRoot()->getRenderSystem()->
+        getTextureGpuManager();
+    for (unsigned int i = 0u; i < _count; ++i)
+    {
+      this->tickets.push_back(textureMgr->createAsyncTextureTicket(
+          width, height, _texture->getDepthOrSlices(),
+          _texture->getTextureType(), _texture->getPixelFormat()));
+    }
+    this->infos.assign(_count, FrameInfo());
+    this->pending.assign(_count, false);
+    this->index = 0u;
+  }
+
+  Ogre::TextureBox region = _region ? *_region : _texture->getEmptyBox(0u);
+  this->tickets[this->index]->download(_texture, 0u, false, &region);
+  this->infos[this->index] = _info;
+  this->pending[this->index] = true;
+  this->index = (this->index + 1u) % _count;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2TextureReadback::Read(Ogre::TextureGpu *_texture,
+    Ogre::TextureBox &_box, const Ogre::TextureBox *_region)
+{
+  this->Download(_texture, 1u, FrameInfo(), _region);
+  FrameInfo info;
+  return this->Map(_box, info);
+}
+
+//////////////////////////////////////////////////
+bool Ogre2TextureReadback::Map(Ogre::TextureBox &_box,
+    FrameInfo &_info)
+{
+  // the oldest frame is the one the next download goes to
+  if (this->tickets.empty() || !this->pending[this->index])
+    return false;
+
+  _box = this->tickets[this->index]->map(0u);
+  _info = this->infos[this->index];
+  this->mapped = static_cast<int>(this->index);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2TextureReadback::Unmap()
+{
+  if (this->mapped < 0)
+    return;
+
+  this->tickets[this->mapped]->unmap();
+  this->pending[this->mapped] = false;
+  this->mapped = -1;
+}
+
+//////////////////////////////////////////////////
+void Ogre2TextureReadback::Destroy()
+{
+  if (this->tickets.empty())
+    return;
+
+  this->Unmap();
+
+  auto root = Ogre2RenderEngine::Instance()->OgreRoot();
+  if (root && root->getRenderSystem())
+  {
+    Ogre::TextureGpuManager *textureMgr =
+        root->getRenderSystem()->getTextureGpuManager();
+    for (auto ticket : this->tickets)
+      textureMgr->destroyAsyncTextureTicket(ticket);
+  }
+  this->tickets.clear();
+  this->infos.clear();
+  this->pending.clear();
+  this->index = 0u;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2TEXTUREREADBACK_HH_
+#define GZ_RENDERING_OGRE2_OGRE2TEXTUREREADBACK_HH_
+
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/FrameInfo.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Ring of async texture tickets that downloads a sensor texture
+/// every frame and hands the frames out count - 1 frames later, by which
+/// time their download has most likely completed and mapping them does
+/// not wait for the GPU. Unlike Ogre::Image2::convertFromTexture, which
+/// waits for the whole queue to drain, the download is a copy recorded
+/// after the frame's passes: on Vulkan and Metal it runs as part of the
+/// frame's submission and is tracked with the frame's fence.
+///
+/// Read downloads and maps a frame right away through a ring of one
+/// ticket. Its staging memory is reused across frames, which saves the
+/// allocation of a ticket and of a pageable copy of the frame that
+/// convertFromTexture makes every frame.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2TextureReadback
+{
+  /// \brief Destructor. Destroys the tickets.
+  public: ~Ogre2TextureReadback();
+
+  /// \brief Queue the download of a texture. The ring is recreated, and
+  /// the frames not delivered yet dropped, if the count or the texture
+  /// size or format changed. A frame that is still mapped is released.
+  /// \param[in] _texture Texture to download
+  /// \param[in] _count Number of frames in flight, at least 1
+  /// \param[in] _info Metadata of the frame the texture was rendered in
+  /// \param[in] _region Region of the texture to download, null for the
+  /// whole texture
+  public: void Download(Ogre::TextureGpu *_texture, unsigned int _count,
+              const FrameInfo &_info,
+              const Ogre::TextureBox *_region = nullptr);
+
+  /// \brief Download a texture and map it, waiting for the download to
+  /// finish. The frame stays mapped until Unmap or the next download.
+  /// \param[in] _texture Texture to download
+  /// \param[out] _box Downloaded data
+  /// \param[in] _region Region of the texture to download, null for the
+  /// whole texture
+  /// \return True if the frame was mapped
+  public: bool Read(Ogre::TextureGpu *_texture, Ogre::TextureBox &_box,
+              const Ogre::TextureBox *_region = nullptr);
+
+  /// \brief Map the oldest frame of the ring, if its download was queued
+  /// count - 1 frames ago
+  /// \param[out] _box Downloaded data
+  /// \param[out] _info Metadata of the frame
+  /// \return True if a frame was mapped. It must be released with Unmap.
+  public: bool Map(Ogre::TextureBox &_box, FrameInfo &_info);
+
+  /// \brief Release the frame mapped by Map
+  public: void Unmap();
+
+  /// \brief Destroy the tickets, dropping the frames not delivered yet
+  public: void Destroy();
+
+  /// \brief Ring of tickets
+  private: std::vector<Ogre::AsyncTextureTicket *> tickets;
+
+  /// \brief Metadata of the frame held by each ticket
+  private: std::vector<FrameInfo> infos;
+
+  /// \brief True for tickets holding a frame that has not been delivered
+  private: std::vector<bool> pending;
+
+  /// \brief Index of the ticket the next frame will be downloaded into,
+  /// which is also the oldest frame
+  private: unsigned int index = 0u;
+
+  /// \brief Index of the mapped ticket, -1 if none
+  private: int mapped = -1;
+};
+}
+}
+}
+#endif
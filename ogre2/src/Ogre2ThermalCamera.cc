@@ -26,7 +26,11 @@
 #include <math.h>
 
 #include <algorithm>
+#include <cmath>
+#include <iomanip>
 #include <limits>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -59,6 +63,11 @@
 #include "gz/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 
+#include "Ogre2CompositorDefinitionCache.hh"
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2StaticBatchBypass.hh"
+#include "Ogre2TextureReadback.hh"
+
 #include <gz/common/Image.hh>
 
 #include "Terra/Terra.h"
@@ -69,6 +78,102 @@ namespace rendering
 {
 inline namespace GZ_RENDERING_VERSION_NAMESPACE {
 //
+/// \brief Thermal properties of an item, derived from the user data of the
+/// visual that owns it. Kept across frames and only recomputed when the
+/// user data changes.
+struct ThermalItemState
+{
+  /// \brief How the item is rendered by the thermal camera
+  enum Type
+  {
+    /// \brief Item has a uniform temperature
+    HEAT_SOURCE,
+
+    /// \brief Item uses a heat signature texture
+    HEAT_SIGNATURE,
+
+    /// \brief Item has no temperature, rendered at ambient temperature
+    BACKGROUND
+  };
+
+  /// \brief Compact id of the visual that owns the item
+  unsigned int compactId = 0u;
+
+  /// \brief Visual that owns the item
+  std::weak_ptr<Ogre2Visual> visual;
+
+  /// \brief Temperature user data the state was computed from
+  Variant userData;
+
+  /// \brief True if the state needs to be recomputed
+  bool dirty = true;
+
+  /// \brief Item type
+  Type type = BACKGROUND;
+
+  /// \brief Normalized temperature, for heat sources
+  float color = 0.0f;
+
+  /// \brief Heat signature texture, for heat signature items
+  std::string heatSignature;
+
+  /// \brief Material rendering the heat signature, shared with the items
+  /// that use the same texture and temperature range
+  Ogre::MaterialPtr heatSignatureMaterial;
+
+  /// \brief Last frame the item was seen, used to drop destroyed items
+  uint64_t frame = 0u;
+};
+
+/// \brief Materials used by the thermal cameras, shared by all thermal
+/// cameras so that each material lookup and heat signature clone is done
+/// once per source material and heat signature instead of per item, frame
+/// and camera.
+class ThermalMaterialCache
+{
+  /// \brief Destructor. Removes the heat signature materials.
+  public: ~ThermalMaterialCache();
+
+  /// \brief Get the cache shared by all thermal cameras, created if no
+  /// thermal camera holds it
+  /// \return Shared cache
+  public: static std::shared_ptr<ThermalMaterialCache> Instance();
+
+  /// \brief Get the solid color material paired with a low level
+  /// material, loading it the first time it is requested
+  /// \param[in] _material Low level material of a sub item
+  /// \return Solid color material, null if the material has none
+  public: Ogre::MaterialPtr SolidMaterial(const Ogre::MaterialPtr &_material);
+
+  /// \brief Get the material rendering a heat signature texture
+  /// \param[in] _base Base heat signature material to clone
+  /// \param[in] _texture Heat signature texture
+  /// \param[in] _minTemp Minimum temperature of the texture, may be null
+  /// \param[in] _maxTemp Maximum temperature of the texture, may be null
+  /// \param[in] _bitDepth Bit depth of the thermal image
+  /// \param[in] _resolution Linear temperature resolution
+  /// \return Loaded heat signature material
+  public: Ogre::MaterialPtr HeatSignatureMaterial(
+      const Ogre::MaterialPtr &_base, const std::string &_texture,
+      const float *_minTemp, const float *_maxTemp,
+      unsigned int _bitDepth, double _resolution);
+
+  /// \brief Forget the solid materials of low level materials that are
+  /// only referenced by the cache anymore
+  public: void Prune();
+
+  /// \brief Solid color materials, keyed by the low level material they
+  /// pair with. The low level material is held so its address stays
+  /// unique while it is cached.
+  private: std::unordered_map<const Ogre::Material *,
+      std::pair<Ogre::MaterialPtr, Ogre::MaterialPtr>> solidMaterials;
+
+  /// \brief Heat signature materials, keyed by texture, temperature
+  /// range, bit depth and resolution
+  private: std::unordered_map<std::string, Ogre::MaterialPtr>
+      heatSignatureMaterials;
+};
+
 /// \brief Helper class for switching the ogre item's material to heat source
 /// material when a thermal camera is being rendered.
 class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
@@ -90,6 +195,14 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
   /// \param[in] _resolution Temperature linear resolution
   public: void SetLinearResolution(double _resolution);
 
+  /// \brief Get the thermal state of an item, updating it if the visual or
+  /// its temperature user data changed
+  /// \param[in] _item Ogre item
+  /// \param[in] _compactId Compact id of the visual that owns the item
+  /// \return Thermal state of the item
+  private: ThermalItemState &ItemState(Ogre::Item *_item,
+      unsigned int _compactId);
+
   /// \brief Callback when a camara is about to be rendered
   /// \param[in] _cam Ogre camera pointer which is about to render
   private: virtual void cameraPreRenderScene(
@@ -109,11 +222,8 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
   /// signature texture applied to it
   private: Ogre::MaterialPtr baseHeatSigMaterial;
 
-  /// \brief A map of all items that have a heat signature material.
-  /// The key is the item's ID, and the value is the heat signature
-  /// for that item.
-  private: std::unordered_map<Ogre::IdType, Ogre::MaterialPtr>
-            heatSignatureMaterials;
+  /// \brief Materials shared with the other thermal cameras
+  private: std::shared_ptr<ThermalMaterialCache> materials;
 
   /// \brief The name of the thermal camera sensor
   private: const std::string name;
@@ -143,6 +253,21 @@ class Ogre2ThermalCameraMaterialSwitcher : public Ogre::Camera::Listener
 
   /// \brief thermal camera image bit depth
   private: unsigned int bitDepth = 16u;
+
+  /// \brief Thermal state of all items, keyed by item id
+  private: std::unordered_map<Ogre::IdType, ThermalItemState> itemStates;
+
+  /// \brief Number of frames rendered
+  private: uint64_t frame = 0u;
+
+  /// \brief User data key of the temperature of visuals
+  private: const UserDataKey temperatureKey{"temperature"};
+
+  /// \brief User data key of the minimum heat signature temperature
+  private: const UserDataKey minTempKey{"minTemp"};
+
+  /// \brief User data key of the maximum heat signature temperature
+  private: const UserDataKey maxTempKey{"maxTemp"};
 };
 }
 }
@@ -155,18 +280,26 @@ class gz::rendering::Ogre2ThermalCameraPrivate
   /// \brief Outgoing thermal data, used by newThermalFrame event.
   public: uint16_t *thermalImage = nullptr;
 
+  /// \brief Lease of thermalImage from the engine frame buffer pool
+  public: std::shared_ptr<unsigned char> thermalImageLease;
+
+  /// \brief True once AcquireThermalData has been called, after which
+  /// images are always copied into thermalImage so they can be leased
+  public: mutable bool leaseRequested = false;
+
+  /// \brief Staging ticket the thermal texture is downloaded into
+  public: Ogre2TextureReadback readback;
+
   /// \brief maximum value used for data outside sensor range
   public: uint16_t dataMaxVal = std::numeric_limits<uint16_t>::max();
 
   /// \brief minimum value used for data outside sensor range
   public: uint16_t dataMinVal = 0u;
 
-  /// \brief 1st pass compositor workspace definition
+  /// \brief 1st pass compositor workspace definition, shared with the
+  /// thermal cameras of the same configuration
   public: std::string ogreCompositorWorkspaceDef;
 
-  /// \brief 1st pass compositor node definition
-  public: std::string ogreCompositorNodeDef;
-
   /// \brief 1st pass compositor workspace. One for each cubemap camera
   public: Ogre::CompositorWorkspace *ogreCompositorWorkspace;
 
@@ -176,14 +309,14 @@ class gz::rendering::Ogre2ThermalCameraPrivate
   /// \brief Dummy render texture for the thermal data
   public: RenderTexturePtr thermalTexture = nullptr;
 
-  /// \brief The thermal material
-  public: Ogre::MaterialPtr thermalMaterial;
-
   /// \brief Event used to signal thermal image data
   public: gz::common::EventT<void(const uint16_t *,
               unsigned int, unsigned int, unsigned int,
               const std::string &)> newThermalFrame;
 
+  /// \brief Event used to signal a view of the downloaded thermal data
+  public: gz::common::EventT<void(const FrameView &)> newFrameView;
+
   /// \brief Pointer to material switcher
   public: std::unique_ptr<Ogre2ThermalCameraMaterialSwitcher>
       thermalMaterialSwitcher = nullptr;
@@ -195,11 +328,119 @@ class gz::rendering::Ogre2ThermalCameraPrivate
 
   /// \brief bit depth of each pixel
   public: unsigned int bitDepth = 16u;
+
+  /// \brief True if the camera outputs false color RGBA8 images instead
+  /// of temperatures, i.e. the image format is PF_R8G8B8A8
+  public: bool colormap = false;
 };
 
 using namespace gz;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+ThermalMaterialCache::~ThermalMaterialCache()
+{
+  this->solidMaterials.clear();
+  auto *matManager = Ogre::MaterialManager::getSingletonPtr();
+  if (!matManager)
+    return;
+  for (auto &[key, material] : this->heatSignatureMaterials)
+    matManager->remove(material);
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<ThermalMaterialCache> ThermalMaterialCache::Instance()
+{
+  static std::weak_ptr<ThermalMaterialCache> instance;
+  auto cache = instance.lock();
+  if (!cache)
+  {
+    cache = std::make_shared<ThermalMaterialCache>();
+    instance = cache;
+  }
+  return cache;
+}
+
+//////////////////////////////////////////////////
+Ogre::MaterialPtr ThermalMaterialCache::SolidMaterial(
+    const Ogre::MaterialPtr &_material)
+{
+  auto it = this->solidMaterials.find(_material.get());
+  if (it != this->solidMaterials.end())
+    return it->second.second;
+
+  auto material = Ogre::MaterialManager::getSingleton().getByName(
+    _material->getName() + "_solid",
+    Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+  if (material &&
+      material->getLoadingState() == Ogre::Resource::LOADSTATE_UNLOADED)
+  {
+    // Manually defined materials like PointCloudPoint_solid
+    // need this
+    material->load();
+  }
+  this->solidMaterials[_material.get()] = {_material, material};
+  return material;
+}
+
+//////////////////////////////////////////////////
+Ogre::MaterialPtr ThermalMaterialCache::HeatSignatureMaterial(
+    const Ogre::MaterialPtr &_base, const std::string &_texture,
+    const float *_minTemp, const float *_maxTemp,
+    unsigned int _bitDepth, double _resolution)
+{
+  const bool hasRange = _minTemp && _maxTemp;
+  std::ostringstream key;
+  key << _texture << "_" << _bitDepth << "_" << _resolution;
+  if (hasRange)
+    key << "_" << *_minTemp << "_" << *_maxTemp;
+  auto it = this->heatSignatureMaterials.find(key.str());
+  if (it != this->heatSignatureMaterials.end())
+    return it->second;
+
+  // We must clone the base heat signature material since different items
+  // may use different textures. Items with the same texture and
+  // temperature range share the clone.
+  std::string baseName = common::basename(_texture);
+  auto heatSignatureMaterial = _base->clone(
+      "ThermalHeatSignature_" + key.str());
+  auto textureUnitStatePtr = heatSignatureMaterial->
+    getTechnique(0)->getPass(0)->getTextureUnitState(0);
+  Ogre::String textureName = baseName;
+  textureUnitStatePtr->setTextureName(textureName);
+
+  // set temperature range for the heat signature
+  if (hasRange)
+  {
+    // make sure the temperature range is between [min, max] kelvin
+    // for the given pixel format and camera resolution
+    float maxTemp = ((1 << _bitDepth) - 1.0) * _resolution;
+    Ogre::GpuProgramParametersSharedPtr params =
+      heatSignatureMaterial->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+    params->setNamedConstant("minTemp", std::max(*_minTemp, 0.0f));
+    params->setNamedConstant("maxTemp", std::min(*_maxTemp, maxTemp));
+    params->setNamedConstant("bitDepth", static_cast<int>(_bitDepth));
+    params->setNamedConstant("resolution", static_cast<float>(_resolution));
+  }
+  heatSignatureMaterial->load();
+  this->heatSignatureMaterials[key.str()] = heatSignatureMaterial;
+  return heatSignatureMaterial;
+}
+
+//////////////////////////////////////////////////
+void ThermalMaterialCache::Prune()
+{
+  for (auto it = this->solidMaterials.begin();
+       it != this->solidMaterials.end();)
+  {
+    if (it->second.first.useCount() <= 1u)
+      it = this->solidMaterials.erase(it);
+    else
+      ++it;
+  }
+}
+
 //////////////////////////////////////////////////
 Ogre2ThermalCameraMaterialSwitcher::Ogre2ThermalCameraMaterialSwitcher(
     Ogre2ScenePtr _scene, const std::string & _name) : name(_name)
@@ -212,6 +453,7 @@ Ogre2ThermalCameraMaterialSwitcher::Ogre2ThermalCameraMaterialSwitcher(
 
   this->baseHeatSigMaterial = Ogre::MaterialManager::getSingleton().
     getByName("ThermalHeatSignature");
+  this->materials = ThermalMaterialCache::Instance();
 
   this->ogreCamera = this->scene->OgreSceneManager()->findCamera(this->name);
 }
@@ -221,12 +463,124 @@ void Ogre2ThermalCameraMaterialSwitcher::SetFormat(PixelFormat _format)
 {
   this->format = _format;
   this->bitDepth = 8u * PixelUtil::BytesPerChannel(format);
+  this->itemStates.clear();
 }
 
 //////////////////////////////////////////////////
 void Ogre2ThermalCameraMaterialSwitcher::SetLinearResolution(double _resolution)
 {
   this->resolution = _resolution;
+  this->itemStates.clear();
+}
+
+/// \brief Value of user data that is not set
+static const Variant kNoUserData;
+
+//////////////////////////////////////////////////
+/// \brief Get the temperature stored in user data
+/// \param[in] _tempAny Temperature user data
+/// \param[in] _name Name of the visual, for error messages
+/// \param[in] _diagnostics Rate limiter of the error messages
+/// \return Temperature in kelvin, clamped to 0, or -1 if the user data does
+/// not hold a number
+static float UserDataTemperature(const Variant &_tempAny,
+    const std::string &_name, DiagnosticLog &_diagnostics)
+{
+  float temp = -1.0;
+  if (auto f = std::get_if<float>(&_tempAny))
+  {
+    temp = *f;
+  }
+  else if (auto d = std::get_if<double>(&_tempAny))
+  {
+    temp = static_cast<float>(*d);
+  }
+  else if (auto i = std::get_if<int>(&_tempAny))
+  {
+    temp = static_cast<float>(*i);
+  }
+  else
+  {
+    if (_diagnostics.Raise("ThermalCamera/invalidTemperature/" + _name))
+    {
+      gzerr << "Error casting user data: temperature of [" << _name
+            << "] must be a float, double or int" << std::endl;
+    }
+    return temp;
+  }
+
+  // if a non-positive temperature was given, clamp it to 0
+  if (temp < 0.0)
+  {
+    temp = 0.0;
+    if (_diagnostics.Raise("ThermalCamera/negativeTemperature/" + _name))
+    {
+      gzwarn << "Unable to set negatve temperature for: "
+          << _name << ". Value cannot be lower than absolute "
+          << "zero. Clamping temperature to 0 degrees Kelvin."
+          << std::endl;
+    }
+  }
+  return temp;
+}
+
+//////////////////////////////////////////////////
+ThermalItemState &Ogre2ThermalCameraMaterialSwitcher::ItemState(
+    Ogre::Item *_item, unsigned int _compactId)
+{
+  ThermalItemState &state = this->itemStates[_item->getId()];
+  state.frame = this->frame;
+
+  Ogre2VisualPtr visual = state.visual.lock();
+  if (!visual || state.compactId != _compactId)
+  {
+    try
+    {
+      visual = std::dynamic_pointer_cast<Ogre2Visual>(
+          this->scene->VisualByCompactId(_compactId));
+    }
+    catch(Ogre::Exception &e)
+    {
+      gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
+    }
+    state.visual = visual;
+    state.compactId = _compactId;
+    state.dirty = true;
+  }
+
+  if (!visual)
+    return state;
+
+  // only recompute when the temperature changes
+  const Variant *tempValue = visual->UserDataValue(this->temperatureKey);
+  const Variant &tempAny = tempValue ? *tempValue : kNoUserData;
+  if (!state.dirty && tempAny == state.userData)
+    return state;
+
+  state.userData = tempAny;
+  state.dirty = false;
+  state.heatSignature.clear();
+  state.heatSignatureMaterial.reset();
+  if (auto heatSignature = std::get_if<std::string>(&tempAny))
+  {
+    state.type = ThermalItemState::HEAT_SIGNATURE;
+    state.heatSignature = *heatSignature;
+  }
+  else if (tempAny.index() != 0)
+  {
+    state.type = ThermalItemState::HEAT_SOURCE;
+    float temp = UserDataTemperature(tempAny, visual->Name(),
+        this->scene->Diagnostics());
+
+    // normalize temperature value
+    state.color = static_cast<float>((temp / this->resolution) /
+                                     ((1 << this->bitDepth) - 1.0));
+  }
+  else
+  {
+    state.type = ThermalItemState::BACKGROUND;
+  }
+  return state;
 }
 //////////////////////////////////////////////////
 void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
@@ -250,7 +604,7 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
   const Ogre::HlmsBlendblock *noBlend =
     hlmsManager->getBlendblock(Ogre::HlmsBlendblock());
 
-  const std::string tempKey = "temperature";
+  ++this->frame;
 
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
@@ -263,67 +617,25 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
     Ogre::Any userAny = item->getUserObjectBindings().getUserAny();
     if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
     {
-      VisualPtr result;
-      try
-      {
-        result = this->scene->VisualById(Ogre::any_cast<unsigned int>(userAny));
-      }
-      catch(Ogre::Exception &e)
+      ThermalItemState &state = this->ItemState(item,
+          Ogre::any_cast<unsigned int>(userAny));
+      Ogre2VisualPtr ogreVisual = state.visual.lock();
+
+      // skip items not owned by a visual of this scene
+      if (!ogreVisual)
       {
-        gzerr << "Ogre Error:" << e.getFullDescription() << "\n";
+        itor.moveNext();
+        continue;
       }
-      Ogre2VisualPtr ogreVisual =
-          std::dynamic_pointer_cast<Ogre2Visual>(result);
 
-      // get temperature
-      Variant tempAny = ogreVisual->UserData(tempKey);
-      if (tempAny.index() != 0 && !std::holds_alternative<std::string>(tempAny))
+      if (state.type == ThermalItemState::HEAT_SOURCE)
       {
-        float temp = -1.0;
-        bool foundTemp = true;
-        try
-        {
-          temp = std::get<float>(tempAny);
-        }
-        catch(...)
-        {
-          try
-          {
-            temp = static_cast<float>(std::get<double>(tempAny));
-          }
-          catch(...)
-          {
-            try
-            {
-              temp = static_cast<float>(std::get<int>(tempAny));
-            }
-            catch(std::bad_variant_access &e)
-            {
-              gzerr << "Error casting user data: " << e.what() << "\n";
-              temp = -1.0;
-              foundTemp = false;
-            }
-          }
-        }
-
-        // if a non-positive temperature was given, clamp it to 0
-        if (foundTemp && temp < 0.0)
-        {
-          temp = 0.0;
-          gzwarn << "Unable to set negatve temperature for: "
-              << ogreVisual->Name() << ". Value cannot be lower than absolute "
-              << "zero. Clamping temperature to 0 degrees Kelvin."
-              << std::endl;
-        }
-
         const size_t numSubItems = item->getNumSubItems();
         for (size_t i = 0; i < numSubItems; ++i)
         {
           Ogre::SubItem *subItem = item->getSubItem(i);
 
-          // normalize temperature value
-          const float color = static_cast<float>((temp / this->resolution) /
-                                                 ((1 << bitDepth) - 1.0));
+          const float color = state.color;
 
           // set g, b, a to 0. This will be used by shaders to determine
           // if particular fragment is a heat source or not
@@ -342,19 +654,10 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
             // material may be a nullptr if we called setMaterial directly
             // (i.e. it's not using Ogre2Material interface).
             // In those cases we fallback to PBS in the current IORM mode.
-            auto material = Ogre::MaterialManager::getSingleton().getByName(
-              subItem->getMaterial()->getName() + "_solid",
-              Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+            auto material =
+                this->materials->SolidMaterial(subItem->getMaterial());
             if (material)
             {
-              if (material->getLoadingState() ==
-                  Ogre::Resource::LOADSTATE_UNLOADED)
-              {
-                // Manually defined materials like PointCloudPoint_solid
-                // need this
-                material->load();
-              }
-
               if (material->getNumSupportedTechniques() > 0u)
               {
                 subItem->setMaterial(material);
@@ -392,57 +695,25 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
         }
       }
       // get heat signature and the corresponding min/max temperature values
-      else if (auto heatSignature = std::get_if<std::string>(&tempAny))
+      else if (state.type == ThermalItemState::HEAT_SIGNATURE)
       {
         // if this is the first time rendering the heat signature,
         // we need to make sure that the texture is loaded and applied to
         // the heat signature material before loading the material
-        if (this->heatSignatureMaterials.find(item->getId()) ==
-            this->heatSignatureMaterials.end())
+        if (!state.heatSignatureMaterial)
         {
           // make sure the texture is in ogre's resource path
-          const auto &texture = *heatSignature;
+          const auto &texture = state.heatSignature;
           engine->AddResourcePath(texture);
 
-          // create a material for this item, now that the texture has been
-          // searched for. We must clone the base heat signature material since
-          // different items may use different textures. We also append the
-          // item's ID to the end of the new material name to ensure new
-          // material uniqueness in case two items use the same heat signature
-          // texture, but have different temperature ranges
-          std::string baseName = common::basename(texture);
-          auto heatSignatureMaterial = this->baseHeatSigMaterial->clone(
-              this->name + "_" + baseName + "_" +
-              Ogre::StringConverter::toString(item->getId()));
-          auto textureUnitStatePtr = heatSignatureMaterial->
-            getTechnique(0)->getPass(0)->getTextureUnitState(0);
-          Ogre::String textureName = baseName;
-          textureUnitStatePtr->setTextureName(textureName);
-
-          // set temperature range for the heat signature
-          auto minTempVariant = ogreVisual->UserData("minTemp");
-          auto maxTempVariant = ogreVisual->UserData("maxTemp");
-          auto minTemperature = std::get_if<float>(&minTempVariant);
-          auto maxTemperature = std::get_if<float>(&maxTempVariant);
-          if (minTemperature && maxTemperature)
-          {
-            // make sure the temperature range is between [min, max] kelvin
-            // for the given pixel format and camera resolution
-            float maxTemp = ((1 << bitDepth) - 1.0) * this->resolution;
-            Ogre::GpuProgramParametersSharedPtr params =
-              heatSignatureMaterial->getTechnique(0)->getPass(0)->
-              getFragmentProgramParameters();
-            params->setNamedConstant("minTemp",
-                std::max(static_cast<float>(*minTemperature), 0.0f));
-            params->setNamedConstant("maxTemp",
-                std::min(static_cast<float>(*maxTemperature), maxTemp));
-            params->setNamedConstant("bitDepth",
-                static_cast<int>(this->bitDepth));
-            params->setNamedConstant("resolution",
-                static_cast<float>(this->resolution));
-          }
-          heatSignatureMaterial->load();
-          this->heatSignatureMaterials[item->getId()] = heatSignatureMaterial;
+          // get the material for this texture and temperature range, now
+          // that the texture has been searched for
+          state.heatSignatureMaterial =
+              this->materials->HeatSignatureMaterial(
+              this->baseHeatSigMaterial, texture,
+              ogreVisual->UserDataAs<float>(this->minTempKey),
+              ogreVisual->UserDataAs<float>(this->maxTempKey),
+              this->bitDepth, this->resolution);
         }
 
         const size_t numSubItems = item->getNumSubItems();
@@ -466,7 +737,7 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
             this->itemDatablockMap.push_back({ subItem, datablock });
           }
 
-          subItem->setMaterial(this->heatSignatureMaterials[item->getId()]);
+          subItem->setMaterial(state.heatSignatureMaterial);
         }
       }
       else
@@ -505,19 +776,10 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
             // material may be a nullptr if we called setMaterial directly
             // (i.e. it's not using Ogre2Material interface).
             // In those cases we fallback to PBS in the current IORM mode.
-            auto material = Ogre::MaterialManager::getSingleton().getByName(
-              subItem->getMaterial()->getName() + "_solid",
-              Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+            auto material =
+                this->materials->SolidMaterial(subItem->getMaterial());
             if (material)
             {
-              if (material->getLoadingState() ==
-                  Ogre::Resource::LOADSTATE_UNLOADED)
-              {
-                // Manually defined materials like PointCloudPoint_solid
-                // need this
-                material->load();
-              }
-
               if (material->getNumSupportedTechniques() > 0u)
               {
                 subItem->setMaterial(material);
@@ -555,45 +817,15 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
       VisualPtr visual = heightmap->Parent();
 
       // get temperature
-      Variant tempAny = visual->UserData(tempKey);
+      const Variant *tempValue =
+          visual->UserDataValue(this->temperatureKey);
+      if (!tempValue)
+        tempValue = &kNoUserData;
+      const Variant &tempAny = *tempValue;
       if (tempAny.index() != 0 && !std::holds_alternative<std::string>(tempAny))
       {
-        float temp = -1.0;
-        bool foundTemp = true;
-        try
-        {
-          temp = std::get<float>(tempAny);
-        }
-        catch (...)
-        {
-          try
-          {
-            temp = static_cast<float>(std::get<double>(tempAny));
-          }
-          catch (...)
-          {
-            try
-            {
-              temp = static_cast<float>(std::get<int>(tempAny));
-            }
-            catch (std::bad_variant_access &e)
-            {
-              gzerr << "Error casting user data: " << e.what() << "\n";
-              temp = -1.0;
-              foundTemp = false;
-            }
-          }
-        }
-
-        // if a non-positive temperature was given, clamp it to 0
-        if (foundTemp && temp < 0.0)
-        {
-          temp = 0.0;
-          gzwarn << "Unable to set negatve temperature for: " << visual->Name()
-                  << ". Value cannot be lower than absolute "
-                  << "zero. Clamping temperature to 0 degrees Kelvin."
-                  << std::endl;
-        }
+        float temp = UserDataTemperature(tempAny, visual->Name(),
+            this->scene->Diagnostics());
 
         // normalize temperature value
         const float color = static_cast<float>((temp / this->resolution) /
@@ -606,8 +838,12 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
       // get heat signature and the corresponding min/max temperature values
       else if (std::get_if<std::string>(&tempAny))
       {
-        gzerr << "Heat Signature not yet supported by Heightmaps. Simulation "
-                  "may crash!\n";
+        if (this->scene->Diagnostics().Raise(
+            "ThermalCamera/heightmapHeatSignature/" + visual->Name()))
+        {
+          gzerr << "Heat Signature not yet supported by Heightmaps. "
+                    "Simulation may crash!\n";
+        }
       }
       else
       {
@@ -624,6 +860,16 @@ void Ogre2ThermalCameraMaterialSwitcher::cameraPreRenderScene(
     }
   }
 
+  // drop the state of items that no longer exist
+  for (auto it = this->itemStates.begin(); it != this->itemStates.end();)
+  {
+    if (it->second.frame != this->frame)
+      it = this->itemStates.erase(it);
+    else
+      ++it;
+  }
+  this->materials->Prune();
+
   // Remove the reference count on noBlend we created
   hlmsManager->destroyBlendblock(noBlend);
 }
@@ -726,11 +972,9 @@ void Ogre2ThermalCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
 
-  if (this->dataPtr->thermalImage)
-  {
-    delete [] this->dataPtr->thermalImage;
-    this->dataPtr->thermalImage = nullptr;
-  }
+  // return the buffer to the pool
+  this->dataPtr->thermalImageLease.reset();
+  this->dataPtr->thermalImage = nullptr;
 
   if (!this->ogreCamera)
     return;
@@ -740,6 +984,7 @@ void Ogre2ThermalCamera::Destroy()
   auto ogreCompMgr = ogreRoot->getCompositorManager2();
 
   // remove thermal texture, material, compositor
+  this->dataPtr->readback.Destroy();
   if (this->dataPtr->ogreThermalTexture)
   {
     ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
@@ -752,19 +997,11 @@ void Ogre2ThermalCamera::Destroy()
         this->dataPtr->ogreCompositorWorkspace);
   }
 
-  if (this->dataPtr->thermalMaterial)
-  {
-    Ogre::MaterialManager::getSingleton().remove(
-        this->dataPtr->thermalMaterial->getName());
-    this->dataPtr->thermalMaterial.setNull();
-  }
-
   if (!this->dataPtr->ogreCompositorWorkspaceDef.empty())
   {
-    ogreCompMgr->removeWorkspaceDefinition(
+    Ogre2CompositorDefinitionCache::Release(
         this->dataPtr->ogreCompositorWorkspaceDef);
-    ogreCompMgr->removeNodeDefinition(
-        this->dataPtr->ogreCompositorNodeDef);
+    this->dataPtr->ogreCompositorWorkspaceDef.clear();
   }
 
   Ogre::SceneManager *ogreSceneManager;
@@ -840,43 +1077,43 @@ void Ogre2ThermalCamera::CreateThermalTexture()
   this->ogreCamera->setFOVy(Ogre::Radian((Ogre::Real)vfov));
   this->ogreCamera->setAspectRatio((Ogre::Real)aspectRatio);
 
-  // Load thermal material
-  // The ThermalCamera material is defined in script (thermal_camera.material).
-  // We need to clone it since we are going to modify its uniform variables
-  std::string matThermalName = "ThermalCamera";
-  Ogre::MaterialPtr matThermal =
-      Ogre::MaterialManager::getSingleton().getByName(matThermalName);
-  this->dataPtr->thermalMaterial = matThermal->clone(
-      this->Name() + "_" + matThermalName);
-  this->dataPtr->thermalMaterial->load();
-  Ogre::Pass *pass =
-      this->dataPtr->thermalMaterial->getTechnique(0)->getPass(0);
-  Ogre::GpuProgramParametersSharedPtr psParams =
-      pass->getFragmentProgramParameters();
-
   // Configure camera behaviour.
   double nearPlane = this->NearClipPlane();
   double farPlane = this->FarClipPlane();
   this->ogreCamera->setNearClipDistance(nearPlane);
   this->ogreCamera->setFarClipDistance(farPlane);
 
-  // only support 8 bit and 16 bit formats for now.
+  // only support 8 bit and 16 bit formats, plus RGBA8 for visualization.
   // default to 16 bit
   Ogre::PixelFormatGpu ogrePF;
+  this->dataPtr->colormap = false;
   if (this->ImageFormat() == PF_L8)
   {
     ogrePF = Ogre::PFG_R8_UNORM;
   }
+  else if (this->ImageFormat() == PF_R8G8B8A8)
+  {
+    ogrePF = Ogre::PFG_RGBA8_UNORM;
+    this->dataPtr->colormap = true;
+  }
   else
   {
     this->SetImageFormat(PF_L16);
     ogrePF = Ogre::PFG_R16_UNORM;
   }
 
-  PixelFormat format = this->ImageFormat();
+  // false color output encodes heat sources like the 16 bit format
+  PixelFormat format = this->dataPtr->colormap ? PF_L16 : this->ImageFormat();
   this->dataPtr->bitDepth = 8u * PixelUtil::BytesPerChannel(format);
 
-  // Set the uniform variables (thermal_camera_fs.glsl).
+  // colors span the min and max temperatures, or the range the 16 bit
+  // format can represent if they are not set
+  float colormapMin = std::isfinite(this->minTemp) ?
+      this->minTemp : 0.0f;
+  float colormapMax = std::isfinite(this->maxTemp) ?
+      this->maxTemp : static_cast<float>(
+      std::numeric_limits<uint16_t>::max() * this->resolution);
+
   // The projectParams is used to linearize thermal buffer data
   // The other params are used to clamp the range output
   // Use the 'real' clip distance here so thermal can be
@@ -886,28 +1123,18 @@ void Ogre2ThermalCamera::CreateThermalTexture()
   double projectionA = projectionAB.x;
   double projectionB = projectionAB.y;
   projectionB /= farPlane;
-  psParams->setNamedConstant("projectionParams",
-      Ogre::Vector2(projectionA, projectionB));
-  psParams->setNamedConstant("near",
-      static_cast<float>(this->NearClipPlane()));
-  psParams->setNamedConstant("far",
-      static_cast<float>(this->FarClipPlane()));
-  psParams->setNamedConstant("max",
-      static_cast<float>(this->maxTemp));
-  psParams->setNamedConstant("min",
-      static_cast<float>(this->minTemp));
-  psParams->setNamedConstant("resolution",
-      static_cast<float>(this->resolution));
-  psParams->setNamedConstant("ambient",
-      static_cast<float>(this->ambient));
-  psParams->setNamedConstant("range",
-      static_cast<float>(this->ambientRange));
-  psParams->setNamedConstant("heatSourceTempRange",
-      static_cast<float>(this->heatSourceTempRange));
-  psParams->setNamedConstant("rgbToTemp",
-      static_cast<int>(this->dataPtr->rgbToTemp));
-  psParams->setNamedConstant("bitDepth",
-      static_cast<int>(this->dataPtr->bitDepth));
+
+  // thermal cameras with the same settings share the material and the
+  // compositor definitions
+  std::ostringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10)
+      << projectionA << " " << projectionB << " " << nearPlane << " "
+      << farPlane << " " << this->maxTemp << " " << this->minTemp << " "
+      << this->resolution << " " << this->ambient << " "
+      << this->ambientRange << " " << this->heatSourceTempRange << " "
+      << this->dataPtr->rgbToTemp << " " << this->dataPtr->bitDepth << " "
+      << this->dataPtr->colormap << " " << colormapMin << " "
+      << colormapMax;
 
   // Create thermal camera compositor
   auto engine = Ogre2RenderEngine::Instance();
@@ -915,7 +1142,7 @@ void Ogre2ThermalCamera::CreateThermalTexture()
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
   // We need to programmatically create the compositor because we need to
-  // configure it to use the cloned thermal material created earlier.
+  // configure it to use the cloned thermal material.
   // The compositor workspace definition is equivalent to the following
   // ogre compositor script:
   // compositor_node ThermalCamera
@@ -955,12 +1182,54 @@ void Ogre2ThermalCamera::CreateThermalTexture()
   //   }
   //   out 0 rt_input
   // }
-  std::string wsDefName = "ThermalCameraWorkspace_" + this->Name();
-  this->dataPtr->ogreCompositorWorkspaceDef = wsDefName;
-  if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+  std::string wsDefName = Ogre2CompositorDefinitionCache::Acquire(
+      "ThermalCameraWorkspace", key.str(),
+      [&](const std::string &_name, Ogre2CompositorDefinitions &_definitions)
   {
-    std::string nodeDefName = wsDefName + "/Node";
-    this->dataPtr->ogreCompositorNodeDef = nodeDefName;
+    // Load thermal material
+    // The ThermalCamera material is defined in script
+    // (thermal_camera.material). We need to clone it since we are going to
+    // modify its uniform variables
+    Ogre::MaterialPtr matThermal =
+        Ogre::MaterialManager::getSingleton().getByName("ThermalCamera");
+    Ogre::MaterialPtr thermalMaterial = matThermal->clone(
+        _name + "_ThermalCamera");
+    thermalMaterial->load();
+    _definitions.materials.push_back(thermalMaterial->getName());
+    Ogre::Pass *pass = thermalMaterial->getTechnique(0)->getPass(0);
+    Ogre::GpuProgramParametersSharedPtr psParams =
+        pass->getFragmentProgramParameters();
+
+    // Set the uniform variables (thermal_camera_fs.glsl).
+    psParams->setNamedConstant("projectionParams",
+        Ogre::Vector2(projectionA, projectionB));
+    psParams->setNamedConstant("near",
+        static_cast<float>(this->NearClipPlane()));
+    psParams->setNamedConstant("far",
+        static_cast<float>(this->FarClipPlane()));
+    psParams->setNamedConstant("max",
+        static_cast<float>(this->maxTemp));
+    psParams->setNamedConstant("min",
+        static_cast<float>(this->minTemp));
+    psParams->setNamedConstant("resolution",
+        static_cast<float>(this->resolution));
+    psParams->setNamedConstant("ambient",
+        static_cast<float>(this->ambient));
+    psParams->setNamedConstant("range",
+        static_cast<float>(this->ambientRange));
+    psParams->setNamedConstant("heatSourceTempRange",
+        static_cast<float>(this->heatSourceTempRange));
+    psParams->setNamedConstant("rgbToTemp",
+        static_cast<int>(this->dataPtr->rgbToTemp));
+    psParams->setNamedConstant("bitDepth",
+        static_cast<int>(this->dataPtr->bitDepth));
+    psParams->setNamedConstant("colormap",
+        static_cast<int>(this->dataPtr->colormap));
+    psParams->setNamedConstant("colormapMin", colormapMin);
+    psParams->setNamedConstant("colormapMax", colormapMax);
+
+    std::string nodeDefName = _name + "/Node";
+    _definitions.nodes.push_back(nodeDefName);
     Ogre::CompositorNodeDef *nodeDef =
         ogreCompMgr->addNodeDefinition(nodeDefName);
     // Input texture
@@ -1030,7 +1299,7 @@ void Ogre2ThermalCamera::CreateThermalTexture()
       passQuad->setAllLoadActions(Ogre::LoadAction::Clear);
       passQuad->setAllClearColours(Ogre::ColourValue(this->ambient, 0, 1.0));
 
-      passQuad->mMaterialName = this->dataPtr->thermalMaterial->getName();
+      passQuad->mMaterialName = thermalMaterial->getName();
       passQuad->addQuadTextureSource(0, "depthTexture");
       passQuad->addQuadTextureSource(1, "colorTexture");
       passQuad->mFrustumCorners =
@@ -1038,9 +1307,10 @@ void Ogre2ThermalCamera::CreateThermalTexture()
     }
     nodeDef->mapOutputChannel(0, "rt_input");
     Ogre::CompositorWorkspaceDef *workDef =
-        ogreCompMgr->addWorkspaceDefinition(wsDefName);
+        ogreCompMgr->addWorkspaceDefinition(_name);
     workDef->connectExternal(0, nodeDef->getName(), 0);
-  }
+  });
+  this->dataPtr->ogreCompositorWorkspaceDef = wsDefName;
   Ogre::CompositorWorkspaceDef *wsDef =
       ogreCompMgr->getWorkspaceDefinition(wsDefName);
 
@@ -1088,7 +1358,8 @@ void Ogre2ThermalCamera::CreateThermalTexture()
     {
       this->dataPtr->thermalMaterialSwitcher.reset(
           new Ogre2ThermalCameraMaterialSwitcher(this->scene, this->Name()));
-      this->dataPtr->thermalMaterialSwitcher->SetFormat(this->ImageFormat());
+      this->dataPtr->thermalMaterialSwitcher->SetFormat(
+          this->dataPtr->colormap ? PF_L16 : this->ImageFormat());
       this->dataPtr->thermalMaterialSwitcher->SetLinearResolution(
           this->resolution);
       this->ogreCamera->addListener(
@@ -1101,6 +1372,9 @@ void Ogre2ThermalCamera::CreateThermalTexture()
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
+  Ogre2StaticBatchBypass bypass(this->scene);
   // Our shaders rely on clamped values so enable it for this sensor
   //
   // TODO(anyone): Matias N. Goldberg (dark_sylinc) insists this is a hack
@@ -1129,9 +1403,23 @@ void Ogre2ThermalCamera::Render()
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::PreRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
   if (!this->dataPtr->ogreThermalTexture)
     this->CreateThermalTexture();
 
+  // lens changes, e.g. zooming, only update the frustum, the render
+  // targets are kept
+  const Ogre::Real aspectRatio =
+      static_cast<Ogre::Real>(this->AspectRatio());
+  const Ogre::Radian vfov(static_cast<Ogre::Real>(
+      2.0 * atan(tan(this->HFOV().Radian() / 2.0) / aspectRatio)));
+  if (this->ogreCamera->getFOVy() != vfov ||
+      this->ogreCamera->getAspectRatio() != aspectRatio)
+  {
+    this->ogreCamera->setFOVy(vfov);
+    this->ogreCamera->setAspectRatio(aspectRatio);
+  }
+
   // todo(iche033) Override BaseCamera::SetProjectionMatrix() function in
   // main / gz-rendering9 instead of checking and setting the custom
   // projection matrix here
@@ -1147,10 +1435,32 @@ void Ogre2ThermalCamera::PreRender()
   }
 }
 
+//////////////////////////////////////////////////
+bool Ogre2ThermalCamera::HasConnections() const
+{
+  return this->dataPtr->newThermalFrame.ConnectionCount() > 0u ||
+      this->dataPtr->newFrameView.ConnectionCount() > 0u ||
+      BaseThermalCamera::HasConnections();
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2ThermalCamera::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorWorkspace);
+  bytes += Ogre2RenderEngine::TextureSizeBytes(
+      this->dataPtr->ogreThermalTexture);
+  return bytes;
+}
+
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::PostRender()
 {
-  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
+  // false color images are only delivered as frame views
+  if ((this->dataPtr->colormap ||
+       this->dataPtr->newThermalFrame.ConnectionCount() <= 0u) &&
+      this->dataPtr->newFrameView.ConnectionCount() <= 0u)
     return;
 
   unsigned int width = this->ImageWidth();
@@ -1161,29 +1471,63 @@ void Ogre2ThermalCamera::PostRender()
   unsigned int channelCount = PixelUtil::ChannelCount(format);
   unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreThermalTexture, 0u, 0u);
+  // the frame stays mapped until the next download
+  Ogre::TextureBox box;
+  if (!this->dataPtr->readback.Read(this->dataPtr->ogreThermalTexture, box))
+    return;
+  this->EndFrameInfo(this->renderFrameInfo);
+
+  // frame view listeners read the downloaded data directly
+  if (this->dataPtr->newFrameView.ConnectionCount() > 0u)
+  {
+    FrameView view;
+    view.data = box.data;
+    view.width = width;
+    view.height = height;
+    view.rowPitch = box.bytesPerRow;
+    view.format = format;
+    view.info = this->frameInfo;
+    this->dataPtr->newFrameView(view);
+
+    if (this->dataPtr->colormap ||
+        this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
+      return;
+  }
 
-  if (!this->dataPtr->thermalImage)
+  // the shader writes the final 16 bit values, so tightly packed rows
+  // are passed to the listeners without a copy unless they are leased
+  if (format == PF_L16 && box.bytesPerRow == width * bytesPerChannel &&
+      !this->dataPtr->leaseRequested)
   {
-    this->dataPtr->thermalImage = new uint16_t[len];
+    // thermalImage is not this frame any more
+    this->dataPtr->thermalImageLease.reset();
+    this->dataPtr->thermalImage = nullptr;
+    this->dataPtr->newThermalFrame(
+        static_cast<const uint16_t *>(box.data), width, height, 1,
+        PixelUtil::Name(format));
+    return;
   }
 
-  Ogre::TextureBox box = image.getData(0u);
+  this->dataPtr->thermalImage = reinterpret_cast<uint16_t *>(
+      this->scene->Engine()->BufferPool().Reserve(
+      this->dataPtr->thermalImageLease, len * sizeof(uint16_t)));
+
   if (format == PF_L8)
   {
     uint8_t *thermalBuffer = static_cast<uint8_t*>(box.data);
-    for (unsigned int i = 0u; i < height; ++i)
+    uint16_t *thermalImage = this->dataPtr->thermalImage;
+    this->scene->ParallelForRows(height,
+        [&](unsigned int _begin, unsigned int _end)
     {
-      // the texture box step size could be larger than our image buffer step
-      // size
-      unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-      for (unsigned int j = 0u; j < width; ++j)
+      for (unsigned int i = _begin; i < _end; ++i)
       {
-        unsigned int idx = (i * width) + j;
-        this->dataPtr->thermalImage[idx] = thermalBuffer[rawDataRowIdx + j];
+        // the texture box step size could be larger than our image buffer
+        // step size
+        unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
+        PixelUtil::WidenL8ToL16(&thermalBuffer[rawDataRowIdx],
+            &thermalImage[i * width], width);
       }
-    }
+    });
   }
   else
   {
@@ -1217,6 +1561,13 @@ void Ogre2ThermalCamera::PostRender()
   // }
 }
 
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2ThermalCamera::ConnectNewFrameView(
+    Camera::NewFrameViewListener _listener)
+{
+  return this->dataPtr->newFrameView.Connect(_listener);
+}
+
 //////////////////////////////////////////////////
 common::ConnectionPtr Ogre2ThermalCamera::ConnectNewThermalFrame(
     std::function<void(const uint16_t *, unsigned int, unsigned int,
@@ -1225,6 +1576,17 @@ common::ConnectionPtr Ogre2ThermalCamera::ConnectNewThermalFrame(
   return this->dataPtr->newThermalFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+std::shared_ptr<const uint16_t> Ogre2ThermalCamera::AcquireThermalData()
+    const
+{
+  this->dataPtr->leaseRequested = true;
+  if (!this->dataPtr->thermalImageLease)
+    return nullptr;
+  return std::shared_ptr<const uint16_t>(this->dataPtr->thermalImageLease,
+      this->dataPtr->thermalImage);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2ThermalCamera::RenderTarget() const
 {
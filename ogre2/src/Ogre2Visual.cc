@@ -19,8 +19,11 @@
 
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2Geometry.hh"
+#include "gz/rendering/ogre2/Ogre2Material.hh"
+#include "gz/rendering/ogre2/Ogre2Mesh.hh"
 #include "gz/rendering/ogre2/Ogre2ParticleEmitter.hh"
 #include "gz/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Storage.hh"
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 #include "gz/rendering/Utils.hh"
@@ -41,6 +44,20 @@ class gz::rendering::Ogre2VisualPrivate
 {
   /// \brief True if wireframe mode is enabled
   public: bool wireframe;
+
+  /// \brief Cached result of LocalBoundingBox
+  public: math::AxisAlignedBox localBox;
+
+  /// \brief Scene graph generation localBox was computed at, 0 if it was
+  /// never computed
+  public: uint64_t localBoxGeneration = 0u;
+
+  /// \brief Cached result of BoundingBox
+  public: math::AxisAlignedBox worldBox;
+
+  /// \brief Scene graph generation worldBox was computed at, 0 if it was
+  /// never computed
+  public: uint64_t worldBoxGeneration = 0u;
 };
 
 //////////////////////////////////////////////////
@@ -64,7 +81,25 @@ void Ogre2Visual::SetWireframe(bool _show)
   if (!this->ogreNode)
     return;
 
+  this->MarkSceneChanged();
   this->dataPtr->wireframe = _show;
+
+  // the datablocks are modified below so they must not be shared with
+  // materials of other visuals
+  for (unsigned int i = 0; i < this->GeometryCount(); ++i)
+  {
+    MeshPtr mesh = std::dynamic_pointer_cast<Mesh>(this->GeometryByIndex(i));
+    if (!mesh)
+      continue;
+    for (unsigned int j = 0; j < mesh->SubMeshCount(); ++j)
+    {
+      Ogre2MaterialPtr material = std::dynamic_pointer_cast<Ogre2Material>(
+          mesh->SubMeshByIndex(j)->Material());
+      if (material)
+        material->DetachDatablock();
+    }
+  }
+
   for (unsigned int i = 0; i < this->ogreNode->numAttachedObjects();
       i++)
   {
@@ -99,16 +134,21 @@ bool Ogre2Visual::Wireframe() const
 //////////////////////////////////////////////////
 void Ogre2Visual::SetVisible(bool _visible)
 {
+  if (this->visible != _visible)
+    this->MarkSceneChanged();
+  this->visible = _visible;
   if (!this->ogreNode)
     return;
 
   this->ogreNode->setVisible(_visible);
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
 void Ogre2Visual::SetStatic(bool _static)
 {
   this->ogreNode->setStatic(_static);
+  this->scene->SetSceneGraphDirty();
 }
 
 //////////////////////////////////////////////////
@@ -130,6 +170,23 @@ void Ogre2Visual::SetVisibilityFlags(uint32_t _flags)
     this->ogreNode->getAttachedObject(i)->setVisibilityFlags(_flags
       & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
   }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Visual::SetCompactId(uint32_t _id)
+{
+  BaseVisual::SetCompactId(_id);
+
+  if (!this->ogreNode)
+    return;
+
+  // geometries attached before the visual was registered in the scene
+  for (unsigned int i = 0; i < this->ogreNode->numAttachedObjects(); ++i)
+  {
+    this->ogreNode->getAttachedObject(i)->getUserObjectBindings().setUserAny(
+        Ogre::Any(this->CompactId()));
+  }
 }
 
 //////////////////////////////////////////////////
@@ -174,13 +231,14 @@ bool Ogre2Visual::AttachGeometry(GeometryPtr _geometry)
 
   // set user data for mouse queries
   ogreObj->getUserObjectBindings().setUserAny(
-      Ogre::Any(this->Id()));
+      Ogre::Any(this->CompactId()));
   ogreObj->setName(this->Name() + "_" + _geometry->Name());
   ogreObj->setVisibilityFlags(this->visibilityFlags
       & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
 
   derived->SetParent(this->SharedThis());
   this->ogreNode->attachObject(ogreObj);
+  this->scene->SetSceneGraphDirty();
 
   return true;
 }
@@ -208,23 +266,37 @@ bool Ogre2Visual::DetachGeometry(GeometryPtr _geometry)
   if (nullptr != derived->OgreObject())
     this->ogreNode->detachObject(derived->OgreObject());
   derived->SetParent(nullptr);
+  this->scene->SetSceneGraphDirty();
   return true;
 }
 
 //////////////////////////////////////////////////
 gz::math::AxisAlignedBox Ogre2Visual::LocalBoundingBox() const
 {
-  gz::math::AxisAlignedBox box;
-  this->BoundsHelper(box, true /* local frame */);
-  return box;
+  // every change that can affect the box marks the scene graph dirty
+  const uint64_t generation = this->scene->SceneGraphGeneration();
+  if (this->dataPtr->localBoxGeneration != generation)
+  {
+    gz::math::AxisAlignedBox box;
+    this->BoundsHelper(box, true /* local frame */);
+    this->dataPtr->localBox = box;
+    this->dataPtr->localBoxGeneration = generation;
+  }
+  return this->dataPtr->localBox;
 }
 
 //////////////////////////////////////////////////
 gz::math::AxisAlignedBox Ogre2Visual::BoundingBox() const
 {
-  gz::math::AxisAlignedBox box;
-  this->BoundsHelper(box, false /* world frame */);
-  return box;
+  const uint64_t generation = this->scene->SceneGraphGeneration();
+  if (this->dataPtr->worldBoxGeneration != generation)
+  {
+    gz::math::AxisAlignedBox box;
+    this->BoundsHelper(box, false /* world frame */);
+    this->dataPtr->worldBox = box;
+    this->dataPtr->worldBoxGeneration = generation;
+  }
+  return this->dataPtr->worldBox;
 }
 
 //////////////////////////////////////////////////
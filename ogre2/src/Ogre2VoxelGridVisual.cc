@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+#include "gz/rendering/ogre2/Ogre2VoxelGridVisual.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgreMesh2.h>
+#include <OgreMeshManager2.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreSubItem.h>
+#include <OgreSubMesh2.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Mesh of the faces of a block
+struct VoxelBlockMesh
+{
+  /// \brief Mesh holding the vertex buffer
+  Ogre::MeshPtr mesh;
+
+  /// \brief Item rendering the mesh
+  Ogre::Item *item = nullptr;
+
+  /// \brief Vertex buffer, 4 floats per vertex
+  Ogre::VertexBufferPacked *vertexBuffer = nullptr;
+
+  /// \brief Vertex array object drawing the vertex buffer
+  Ogre::VertexArrayObject *vao = nullptr;
+
+  /// \brief Number of vertices the vertex buffer holds, a power of two
+  size_t capacity = 0u;
+};
+
+class gz::rendering::Ogre2VoxelGridVisualPrivate
+{
+  /// \brief Meshes of the blocks with faces, by block key
+  public: std::unordered_map<uint64_t, VoxelBlockMesh> meshes;
+
+  /// \brief Material of the visual
+  public: Ogre::MaterialPtr material;
+
+  /// \brief Vertices of the block being rebuilt, kept to reuse the memory
+  public: std::vector<float> vertices;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2VoxelGridVisual::Ogre2VoxelGridVisual()
+  : dataPtr(new Ogre2VoxelGridVisualPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2VoxelGridVisual::~Ogre2VoxelGridVisual()
+{
+  // no ops
+}
+
+//////////////////////////////////////////////////
+void Ogre2VoxelGridVisual::Init()
+{
+  BaseVoxelGridVisual::Init();
+
+  const std::string matName = "VoxelGrid";
+  Ogre::MaterialPtr mat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!mat)
+  {
+    gzerr << "Voxel grid material not found: '" << matName << "'"
+          << std::endl;
+    return;
+  }
+  this->dataPtr->material = mat->clone(this->Name() + "_" + matName);
+  this->dataPtr->material->load();
+}
+
+//////////////////////////////////////////////////
+void Ogre2VoxelGridVisual::PreRender()
+{
+  BaseVoxelGridVisual::PreRender();
+
+  if (!this->dataPtr->material || this->dirtyBlocks.empty())
+    return;
+
+  this->UpdateBlocks();
+}
+
+//////////////////////////////////////////////////
+void Ogre2VoxelGridVisual::Destroy()
+{
+  while (!this->dataPtr->meshes.empty())
+    this->DestroyBlockMesh(this->dataPtr->meshes.begin()->first);
+  if (this->dataPtr->material)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->material->getName());
+    this->dataPtr->material.setNull();
+  }
+  BaseVoxelGridVisual::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2VoxelGridVisual::UpdateBlocks()
+{
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  Ogre::VaoManager *vaoManager =
+      sceneManager->getDestinationRenderSystem()->getVaoManager();
+  if (!vaoManager)
+    return;
+
+  static unsigned int blockMeshId = 0u;
+  bool created = false;
+  std::vector<float> &vertices = this->dataPtr->vertices;
+  for (uint64_t key : this->dirtyBlocks)
+  {
+    const unsigned int faceCount = this->BuildBlockFaces(key, vertices);
+    if (faceCount == 0u)
+    {
+      this->DestroyBlockMesh(key);
+      continue;
+    }
+
+    const size_t vertexCount = vertices.size() / 4u;
+    size_t capacity = 1u;
+    while (capacity < vertexCount)
+      capacity <<= 1u;
+
+    // buffers are only reallocated when the block outgrows them or
+    // shrinks to less than a quarter of them
+    auto it = this->dataPtr->meshes.find(key);
+    if (it != this->dataPtr->meshes.end() &&
+        (it->second.capacity < vertexCount ||
+         it->second.capacity > capacity * 2u))
+    {
+      this->DestroyBlockMesh(key);
+      it = this->dataPtr->meshes.end();
+    }
+
+    Ogre::Vector3 minPt(std::numeric_limits<float>::max());
+    Ogre::Vector3 maxPt(-std::numeric_limits<float>::max());
+    for (size_t i = 0u; i < vertices.size(); i += 4u)
+    {
+      const Ogre::Vector3 pt(vertices[i], vertices[i + 1u],
+          vertices[i + 2u]);
+      minPt.makeFloor(pt);
+      maxPt.makeCeil(pt);
+    }
+    const Ogre::Aabb bounds = Ogre::Aabb::newFromExtents(minPt, maxPt);
+
+    if (it == this->dataPtr->meshes.end())
+    {
+      VoxelBlockMesh &blockMesh = this->dataPtr->meshes[key];
+      blockMesh.mesh = Ogre::MeshManager::getSingleton().createManual(
+          "voxel_grid_block_" + std::to_string(blockMeshId++),
+          Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+      Ogre::SubMesh *subMesh = blockMesh.mesh->createSubMesh();
+
+      // the 4th float holds the color and face direction bits and is
+      // decoded in the vertex shader. Blocks change rarely compared to how
+      // often they are drawn, so the buffers live in GPU memory.
+      std::vector<float> initialData(capacity * 4u, 0.0f);
+      std::copy(vertices.begin(), vertices.end(), initialData.begin());
+      Ogre::VertexElement2Vec vertexElements;
+      vertexElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_FLOAT4, Ogre::VES_POSITION));
+      blockMesh.vertexBuffer = vaoManager->createVertexBuffer(
+          vertexElements, capacity, Ogre::BT_DEFAULT, initialData.data(),
+          false);
+      blockMesh.capacity = capacity;
+
+      Ogre::VertexBufferPackedVec vertexBuffers;
+      vertexBuffers.push_back(blockMesh.vertexBuffer);
+      blockMesh.vao = vaoManager->createVertexArrayObject(vertexBuffers,
+          nullptr, Ogre::OperationType::OT_TRIANGLE_LIST);
+      subMesh->mVao[Ogre::VpNormal].push_back(blockMesh.vao);
+      subMesh->mVao[Ogre::VpShadow].push_back(blockMesh.vao);
+      blockMesh.vao->setPrimitiveRange(0u, vertexCount);
+      blockMesh.mesh->_setBounds(bounds, false);
+
+      blockMesh.item =
+          sceneManager->createItem(blockMesh.mesh, Ogre::SCENE_DYNAMIC);
+      blockMesh.item->getSubItem(0)->setMaterial(this->dataPtr->material);
+      blockMesh.item->setCastShadows(false);
+      this->ogreNode->attachObject(blockMesh.item);
+      created = true;
+    }
+    else
+    {
+      VoxelBlockMesh &blockMesh = it->second;
+      blockMesh.vertexBuffer->upload(vertices.data(), 0u, vertexCount);
+      blockMesh.vao->setPrimitiveRange(0u, vertexCount);
+      blockMesh.mesh->_setBounds(bounds, false);
+      blockMesh.item->setLocalAabb(bounds);
+    }
+  }
+  this->dirtyBlocks.clear();
+
+  // new items are visible with all flags set
+  if (created)
+  {
+    this->SetVisibilityFlags(this->visibilityFlags);
+    this->SetVisible(this->visible);
+  }
+  this->scene->SetSceneGraphDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2VoxelGridVisual::DestroyBlockMesh(uint64_t _key)
+{
+  auto it = this->dataPtr->meshes.find(_key);
+  if (it == this->dataPtr->meshes.end())
+    return;
+
+  VoxelBlockMesh &blockMesh = it->second;
+  if (this->scene->IsInitialized())
+  {
+    Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+    Ogre::VaoManager *vaoManager =
+        sceneManager->getDestinationRenderSystem()->getVaoManager();
+    if (blockMesh.item)
+    {
+      if (this->ogreNode)
+        this->ogreNode->detachObject(blockMesh.item);
+      sceneManager->destroyItem(blockMesh.item);
+    }
+    if (blockMesh.mesh)
+    {
+      Ogre::SubMesh *subMesh = blockMesh.mesh->getSubMesh(0);
+      if (vaoManager && !subMesh->mVao[Ogre::VpNormal].empty())
+        subMesh->destroyVaos(subMesh->mVao[Ogre::VpNormal], vaoManager);
+      subMesh->mVao[Ogre::VpShadow].clear();
+      Ogre::MeshManager::getSingleton().remove(blockMesh.mesh->getName());
+    }
+  }
+  this->dataPtr->meshes.erase(it);
+}
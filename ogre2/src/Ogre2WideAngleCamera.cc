@@ -15,6 +15,13 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 
 #include "gz/rendering/CameraLens.hh"
@@ -25,6 +32,9 @@
 
 #include "gz/common/Util.hh"
 
+#include "Ogre2SensorTimer.hh"
+#include "Ogre2SkyBoxMaterial.hh"
+
 #ifdef _MSC_VER
 #  pragma warning(push, 0)
 #endif
@@ -37,10 +47,14 @@
 #include <OgreDepthBuffer.h>
 #include <OgreImage2.h>
 #include <OgrePass.h>
+#include <OgrePixelFormatGpuUtils.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <OgreStagingTexture.h>
 #include <OgreTechnique.h>
 #include <OgreTextureBox.h>
 #include <OgreTextureGpuManager.h>
+#include <OgreTextureUnitState.h>
 #ifdef _MSC_VER
 #  pragma warning(pop)
 #endif
@@ -83,6 +97,256 @@ const Ogre::Quaternion kCubemapRotations[6] = {
 
 static const char *kWideAngleCameraSuffixes[6] = { "PX", "NX", "PY",
                                                    "NY", "PZ", "NZ" };
+
+/// \brief Whether a lens can see any part of a cubemap face. The camera
+/// looks along +Z (kCubemapRotations[4]); the four side faces start 45 deg
+/// off the optical axis and the back face 135 deg off it.
+/// \param[in] _faceIdx Cubemap face index
+/// \param[in] _cutOffAngle Lens cut off angle, in radians
+/// \return True if the face needs to be rendered
+static bool CubemapFaceVisible(uint32_t _faceIdx, double _cutOffAngle)
+{
+  // keep faces just past the cut off so filtering across face edges still
+  // reads rendered texels
+  const double margin = GZ_DTOR(1.0);
+  if (_faceIdx == 4u)
+    return true;
+  if (_faceIdx == 5u)
+    return _cutOffAngle + margin > GZ_PI * 0.75;
+  return _cutOffAngle + margin > GZ_PI * 0.25;
+}
+
+/// \brief Get the focal length of a lens, scaled so that the image spans
+/// the HFOV if the lens asks for it
+/// \param[in] _lens Camera lens
+/// \param[in] _hfov Horizontal field of view, in radians
+/// \return Focal length
+static double LensFocalLength(const CameraLens &_lens, double _hfov)
+{
+  if (!_lens.ScaleToHFOV())
+    return _lens.F();
+  const double param = (_hfov / 2.0) / _lens.C2() + _lens.C3();
+  const double funRes =
+    _lens.ApplyMappingFunction(static_cast<float>(param));
+  return 1.0 / (_lens.C1() * funRes);
+}
+
+/// \brief Texture telling the final pass shader in which direction to
+/// sample the cubemap for each pixel, and how much the pixel is dimmed
+/// towards the cut off angle, see wide_lens_map_fp.glsl. The texture only
+/// depends on the lens and the image size, so cameras with the same lens
+/// share it.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2WideAngleCameraLensMap
+{
+  /// \brief Image size and lens constants the texture depends on
+  public: struct Key
+  {
+    /// \brief Image width in pixels
+    uint32_t width = 0u;
+
+    /// \brief Image height in pixels
+    uint32_t height = 0u;
+
+    /// \brief Linear scaling constant
+    double c1 = 1.0;
+
+    /// \brief Angle scaling constant
+    double c2 = 1.0;
+
+    /// \brief Angle offset constant
+    double c3 = 0.0;
+
+    /// \brief Focal length, see LensFocalLength
+    double f = 1.0;
+
+    /// \brief Mapping function: 0 for sin, 1 for tan and 2 for identity
+    unsigned int fun = 2u;
+
+    /// \brief Cut off angle in radians
+    double cutOffAngle = GZ_PI;
+
+    /// \brief Order keys, for use in std::map
+    /// \param[in] _other Key to compare with
+    /// \return True if this key comes before _other
+    bool operator<(const Key &_other) const
+    {
+      return std::tie(this->width, this->height, this->c1, this->c2,
+          this->c3, this->f, this->fun, this->cutOffAngle) <
+          std::tie(_other.width, _other.height, _other.c1, _other.c2,
+          _other.c3, _other.f, _other.fun, _other.cutOffAngle);
+    }
+
+    /// \brief Compare keys
+    /// \param[in] _other Key to compare with
+    /// \return True if both keys describe the same lens and image size
+    bool operator==(const Key &_other) const
+    {
+      return !(*this < _other) && !(_other < *this);
+    }
+  };
+
+  /// \brief Destructor. Destroys the texture.
+  public: ~Ogre2WideAngleCameraLensMap()
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    if (!this->texture || !engine->OgreRoot())
+      return;
+    engine->OgreRoot()->getRenderSystem()->getTextureGpuManager()->
+        destroyTexture(this->texture);
+  }
+
+  /// \brief Get the texture of a lens, creating it if no camera holds it
+  /// \param[in] _key Lens and image size
+  /// \param[in] _scene Scene whose worker threads fill the texture
+  /// \return Shared texture
+  public: static std::shared_ptr<Ogre2WideAngleCameraLensMap> Acquire(
+      const Key &_key, Ogre2ScenePtr _scene)
+  {
+    auto &lensMaps = LensMaps();
+    for (auto it = lensMaps.begin(); it != lensMaps.end();)
+    {
+      if (it->second.expired())
+        it = lensMaps.erase(it);
+      else
+        ++it;
+    }
+    auto it = lensMaps.find(_key);
+    if (it != lensMaps.end())
+      return it->second.lock();
+
+    auto engine = Ogre2RenderEngine::Instance();
+    Ogre::TextureGpuManager *textureMgr =
+      engine->OgreRoot()->getRenderSystem()->getTextureGpuManager();
+    static unsigned int lensMapCount = 0u;
+    const std::string texName = "WideAngleCameraLensMap_" +
+        std::to_string(lensMapCount++);
+
+    auto lensMap = std::make_shared<Ogre2WideAngleCameraLensMap>();
+    lensMap->key = _key;
+    lensMap->texture = textureMgr->createOrRetrieveTexture(
+      texName,
+      Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::ManualTexture,
+      Ogre::TextureTypes::Type2D,
+      Ogre::BLANKSTRING,
+      0u);
+    lensMap->texture->setResolution(_key.width, _key.height);
+    lensMap->texture->setNumMipmaps(1u);
+    lensMap->texture->setPixelFormat(Ogre::PFG_RGBA16_SNORM);
+    lensMap->texture->scheduleTransitionTo(Ogre::GpuResidency::Resident);
+
+    std::vector<int16_t> data(
+        static_cast<size_t>(_key.width) * _key.height * 4u);
+    _scene->ParallelForRows(_key.height,
+        [&](unsigned int _begin, unsigned int _end)
+        {
+          Fill(_key, _begin, _end, data.data());
+        });
+
+    // upload via a StagingTexture, see Ogre2GpuRays::UploadSampleTable
+    const Ogre::PixelFormatGpu pf = lensMap->texture->getPixelFormat();
+    Ogre::StagingTexture *stagingTexture = textureMgr->getStagingTexture(
+        _key.width, _key.height, 1u, 1u, pf);
+    stagingTexture->startMapRegion();
+    Ogre::TextureBox texBox =
+        stagingTexture->mapRegion(_key.width, _key.height, 1u, 1u, pf);
+    texBox.copyFrom(data.data(), _key.width, _key.height,
+        _key.width * 4u * sizeof(int16_t));
+    stagingTexture->stopMapRegion();
+    stagingTexture->upload(texBox, lensMap->texture, 0, 0, 0, true);
+    textureMgr->removeStagingTexture(stagingTexture);
+
+    lensMaps[_key] = lensMap;
+    return lensMap;
+  }
+
+  /// \brief Compute the texels of some rows, applying the same mapping
+  /// as Ogre2WideAngleCamera::Project3d in reverse
+  /// \param[in] _key Lens and image size
+  /// \param[in] _rowBegin First row to compute
+  /// \param[in] _rowEnd One past the last row to compute
+  /// \param[out] _data Texels of the whole texture, RGBA, row by row. Only
+  /// the texels of the given rows are written.
+  private: static void Fill(const Key &_key, unsigned int _rowBegin,
+      unsigned int _rowEnd, int16_t *_data)
+  {
+    auto applyFun = [&_key](double _x)
+    {
+      return _key.fun == 0u ? std::sin(_x) :
+          (_key.fun == 1u ? std::tan(_x) : _x);
+    };
+    auto toSnorm = [](double _x)
+    {
+      return static_cast<int16_t>(
+          std::lround(std::clamp(_x, -1.0, 1.0) * 32767.0));
+    };
+
+    const double ratio = static_cast<double>(_key.width) /
+        static_cast<double>(_key.height);
+    const double cutRadius = _key.c1 * _key.f *
+        applyFun(_key.cutOffAngle / _key.c2 + _key.c3);
+    for (unsigned int j = _rowBegin; j < _rowEnd; ++j)
+    {
+      // normalized coordinate of the texel center, matching the fragment
+      // positions computed in wide_lens_map_vs.glsl
+      const double v = (j + 0.5) / _key.height;
+      const double y = -(2.0 * v - 1.0) / ratio;
+      for (unsigned int i = 0u; i < _key.width; ++i)
+      {
+        const double u = (i + 0.5) / _key.width;
+        const double x = -(2.0 * u - 1.0);
+        const double r = std::hypot(x, y);
+
+        // angle from optical axis based on the mapping function
+        const double param = r / (_key.c1 * _key.f);
+        double theta = param;
+        if (_key.fun == 0u)
+          theta = std::asin(param);
+        else if (_key.fun == 1u)
+          theta = std::atan(param);
+        theta = (theta - _key.c3) * _key.c2;
+
+        // pixels the lens can not see, e.g. past asin's domain, stay black
+        math::Vector3d dir = math::Vector3d::UnitZ;
+        double weight = 0.0;
+        if (std::isfinite(theta))
+        {
+          // spherical to cartesian conversion
+          const double s = r > 0.0 ? std::sin(theta) / r : 0.0;
+          dir.Set(-s * x, s * y, std::cos(theta));
+
+          // smooth edges at the cut off angle
+          const double t = std::clamp(
+              (r - (cutRadius - 0.02)) / 0.02, 0.0, 1.0);
+          weight = 1.0 - t * t * (3.0 - 2.0 * t);
+        }
+
+        int16_t *texel = _data + (static_cast<size_t>(j) * _key.width + i) * 4u;
+        texel[0] = toSnorm(dir.X());
+        texel[1] = toSnorm(dir.Y());
+        texel[2] = toSnorm(dir.Z());
+        texel[3] = toSnorm(weight);
+      }
+    }
+  }
+
+  /// \brief Get the textures in use, keyed by lens and image size
+  /// \return Textures in use
+  private: static std::map<Key, std::weak_ptr<Ogre2WideAngleCameraLensMap>>
+      &LensMaps()
+  {
+    static std::map<Key, std::weak_ptr<Ogre2WideAngleCameraLensMap>>
+        lensMaps;
+    return lensMaps;
+  }
+
+  /// \brief Lens and image size of the texture
+  public: Key key;
+
+  /// \brief Texture with the cubemap direction in RGB and the weight of
+  /// the pixel in A
+  public: Ogre::TextureGpu *texture = nullptr;
+};
 }
 }
 }
@@ -120,12 +384,19 @@ class gz::rendering::Ogre2WideAngleCamera::Implementation
   /// \brief Compositor workspace. Converts the cubemap into a "fish eye"
   public: Ogre::CompositorWorkspace *ogreCompositorFinalPass = nullptr;
 
-  /// \brief Main pass definition (used for visibility mask manipuluation).
-  public: Ogre::CompositorPassSceneDef *cubePassSceneDef = nullptr;
+  /// \brief Main pass definition of each face (used for visibility mask
+  /// manipuluation). All faces share the same definition unless they are
+  /// rendered directly into the cubemap.
+  public: Ogre::CompositorPassSceneDef *cubePassSceneDef[
+      kWideAngleNumCubemapFaces]{};
 
   /// \brief Pointer to material, used for second rendering pass
   public: Ogre::MaterialPtr compMat;
 
+  /// \brief Lens map of the final pass, shared with the cameras with the
+  /// same lens and image size
+  public: std::shared_ptr<Ogre2WideAngleCameraLensMap> lensMap;
+
   /// \brief Camera lens description
   public: CameraLens lens;
 
@@ -151,8 +422,9 @@ class gz::rendering::Ogre2WideAngleCamera::Implementation
   /// \brief See Ogre2WideAngleCameraWorkspaceListenerPrivate
   public: Ogre2WideAngleCameraWorkspaceListenerPrivate workspaceListener;
 
-  /// \brief Name of sky box material
-  public: const std::string kSkyboxMaterialName = "SkyBox";
+  /// \brief Name of the sky box material, shared with the other cameras
+  /// rendering the same sky
+  public: std::string skyboxMaterialName;
 
   /// \brief Background material of the render target
   public: MaterialPtr backgroundMaterial;
@@ -225,6 +497,7 @@ void Ogre2WideAngleCamera::DestroyRenderTexture()
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::PreRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_PRE_RENDER);
   BaseCamera::PreRender();
 
   if (this->dataPtr->backgroundMaterialDirty)
@@ -258,8 +531,7 @@ void Ogre2WideAngleCamera::PreRender()
     {
       // If render passes were added/destroyed, ogreCompositorWorkspace
       // will become nullptr and must be recreated.
-      const uint8_t msaa =
-        Ogre2RenderTarget::TargetFSAA(static_cast<uint8_t>(this->antiAliasing));
+      const uint8_t msaa = this->TargetFSAA();
       this->CreateFacesWorkspaces(msaa > 1u);
     }
 
@@ -271,6 +543,7 @@ void Ogre2WideAngleCamera::PreRender()
     }
   }
 
+  this->UpdateLensMap();
   this->UpdateRenderPasses();
 }
 
@@ -316,6 +589,34 @@ void Ogre2WideAngleCamera::DestroyTextures()
       this->dataPtr->ogreStitchTexture[i] = nullptr;
     }
   }
+
+  this->dataPtr->lensMap.reset();
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleCamera::UpdateLensMap()
+{
+  const Ogre::TextureGpu *finalTexture =
+    this->dataPtr->ogreStitchTexture[kStichFinalTexture];
+  if (!finalTexture)
+    return;
+
+  const CameraLens &lens = this->Lens();
+  const math::Vector3d fun = lens.MappingFunctionAsVector3d();
+  Ogre2WideAngleCameraLensMap::Key key;
+  key.width = finalTexture->getWidth();
+  key.height = finalTexture->getHeight();
+  key.c1 = lens.C1();
+  key.c2 = lens.C2();
+  key.c3 = lens.C3();
+  key.f = LensFocalLength(lens, this->HFOV().Radian());
+  key.fun = fun.X() > 0.0 ? 0u : (fun.Y() > 0.0 ? 1u : 2u);
+  key.cutOffAngle = lens.CutOffAngle();
+
+  if (this->dataPtr->lensMap && this->dataPtr->lensMap->key == key)
+    return;
+  this->dataPtr->lensMap =
+      Ogre2WideAngleCameraLensMap::Acquire(key, this->scene);
 }
 
 //////////////////////////////////////////////////
@@ -580,6 +881,15 @@ uint32_t Ogre2WideAngleCamera::TempStitchTextureChannel() const
   return enabledPasses & 0x1u ? 1u : 0u;
 }
 
+//////////////////////////////////////////////////
+uint8_t Ogre2WideAngleCamera::TargetFSAA() const
+{
+  if (this->antiAliasingMode != CAAM_MSAA)
+    return 1u;
+  return Ogre2RenderTarget::TargetFSAA(
+      static_cast<uint8_t>(this->antiAliasing));
+}
+
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::SetupMSAA(Ogre::CompositorManager2 *_ogreCompMgr,
                                      uint8_t _msaa)
@@ -602,21 +912,52 @@ void Ogre2WideAngleCamera::SetupMSAA(Ogre::CompositorManager2 *_ogreCompMgr,
 void Ogre2WideAngleCamera::RetrieveCubePassSceneDefs(
   Ogre::CompositorManager2 *_ogreCompMgr, bool _withMsaa)
 {
-  Ogre::CompositorNodeDef *nodeDef = _ogreCompMgr->getNodeDefinitionNonConst(
-    _withMsaa ? "WideAngleCameraCubemapPassMsaa"
-              : "WideAngleCameraCubemapPass");
-
-  Ogre::CompositorTargetDef *target0 = nodeDef->getTargetPass(0);
-  Ogre::CompositorPassDefVec &passes = target0->getCompositorPassesNonConst();
-  GZ_ASSERT(passes.size() >= 1u,
-            "wide_angle_camera.compositor is out of sync?");
-  GZ_ASSERT(passes[0]->getType() == Ogre::PASS_SCENE,
-            "wide_angle_camera.compositor is out of sync?");
-  GZ_ASSERT(dynamic_cast<Ogre::CompositorPassSceneDef *>(passes[0]),
-            "Memory corruption?");
-
-  this->dataPtr->cubePassSceneDef =
-    static_cast<Ogre::CompositorPassSceneDef *>(passes[0]);
+  const bool direct = this->RendersFacesDirectly();
+
+  for (uint32_t faceIdx = 0u; faceIdx < kWideAngleNumCubemapFaces; ++faceIdx)
+  {
+    const std::string nodeDefName = direct ?
+      this->CubemapDirectNodeName(faceIdx) :
+      this->CubemapPassNodeName(_withMsaa);
+    Ogre::CompositorNodeDef *nodeDef =
+      _ogreCompMgr->getNodeDefinitionNonConst(nodeDefName);
+
+    Ogre::CompositorTargetDef *target0 = nodeDef->getTargetPass(0);
+    Ogre::CompositorPassDefVec &passes =
+      target0->getCompositorPassesNonConst();
+    GZ_ASSERT(passes.size() >= 1u,
+              "wide_angle_camera.compositor is out of sync?");
+    GZ_ASSERT(passes[0]->getType() == Ogre::PASS_SCENE,
+              "wide_angle_camera.compositor is out of sync?");
+    GZ_ASSERT(dynamic_cast<Ogre::CompositorPassSceneDef *>(passes[0]),
+              "Memory corruption?");
+
+    this->dataPtr->cubePassSceneDef[faceIdx] =
+      static_cast<Ogre::CompositorPassSceneDef *>(passes[0]);
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2WideAngleCamera::RendersFacesDirectly() const
+{
+  // render pass effects ping pong between 2D textures and the MSAA resolve
+  // targets a 2D texture, everything else can render into the cubemap
+  return this->dataPtr->renderPasses.empty() && this->TargetFSAA() <= 1u;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2WideAngleCamera::CubemapPassNodeName(bool _withMsaa) const
+{
+  return _withMsaa ? "WideAngleCameraCubemapPassMsaa" :
+                     "WideAngleCameraCubemapPass";
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2WideAngleCamera::CubemapDirectNodeName(
+  uint32_t _faceIdx) const
+{
+  return std::string("WideAngleCameraCubemapDirect") +
+         kWideAngleCameraSuffixes[_faceIdx];
 }
 
 //////////////////////////////////////////////////
@@ -636,28 +977,29 @@ void Ogre2WideAngleCamera::CreateWorkspaceDefinition(bool _withMsaa)
   auto ogreRoot = engine->OgreRoot();
   CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
-  const IdString cubemapPassNodeName =
-    _withMsaa ? "WideAngleCameraCubemapPassMsaa" : "WideAngleCameraCubemapPass";
+  const IdString cubemapPassNodeName = this->CubemapPassNodeName(_withMsaa);
+  const bool direct = this->RendersFacesDirectly();
 
-  bool validBackground = this->dataPtr->backgroundMaterial &&
-      !this->dataPtr->backgroundMaterial->EnvironmentMap().empty();
+  bool validBackground = !this->dataPtr->skyboxMaterialName.empty();
 
   // render background, e.g. sky, after opaque stuff
-  if (validBackground)
+  auto addBackgroundPass = [&](const IdString &_nodeDefName)
   {
     Ogre::CompositorNodeDef *nodeDef = ogreCompMgr->getNodeDefinitionNonConst(
-        cubemapPassNodeName);
+        _nodeDefName);
     Ogre::CompositorTargetDef *target0 = nodeDef->getTargetPass(0);
 
     // quad pass
     Ogre::CompositorPassQuadDef *passQuad =
         static_cast<Ogre::CompositorPassQuadDef *>(
         target0->addPass(Ogre::PASS_QUAD));
-    passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-        + this->Name();
+    passQuad->mMaterialName = this->dataPtr->skyboxMaterialName;
     passQuad->mFrustumCorners =
         Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
-  }
+  };
+
+  if (validBackground && !direct)
+    addBackgroundPass(cubemapPassNodeName);
 
   for (uint32_t faceIdx = 0u; faceIdx < kWideAngleNumCubemapFaces; ++faceIdx)
   {
@@ -665,6 +1007,17 @@ void Ogre2WideAngleCamera::CreateWorkspaceDefinition(bool _withMsaa)
     CompositorWorkspaceDef *workDef =
       ogreCompMgr->addWorkspaceDefinition(wsDefName);
 
+    if (direct)
+    {
+      // the face is rendered straight into its cubemap slice, without the
+      // temp 2D texture and the copy pass
+      const IdString directNodeName = this->CubemapDirectNodeName(faceIdx);
+      if (validBackground)
+        addBackgroundPass(directNodeName);
+      workDef->connectExternal(0, directNodeName, 0);
+      continue;
+    }
+
     workDef->connectExternal(0, cubemapPassNodeName, 0);
     workDef->connectExternal(1, cubemapPassNodeName, 1);
 
@@ -706,10 +1059,18 @@ void Ogre2WideAngleCamera::CreateFacesWorkspaces(bool _withMsaa)
 
   this->RetrieveCubePassSceneDefs(ogreCompMgr, _withMsaa);
 
-  const Ogre::CompositorChannelVec channels = {
-    this->dataPtr->ogreTmpTextures[0], this->dataPtr->ogreTmpTextures[1],
-    this->dataPtr->envCubeMapTexture
-  };
+  Ogre::CompositorChannelVec channels = { this->dataPtr->envCubeMapTexture };
+  if (!this->RendersFacesDirectly())
+  {
+    // render passes were added after the textures were created
+    if (!this->dataPtr->ogreTmpTextures[0])
+      this->CreateTmpTextures();
+
+    channels = {
+      this->dataPtr->ogreTmpTextures[0], this->dataPtr->ogreTmpTextures[1],
+      this->dataPtr->envCubeMapTexture
+    };
+  }
 
   for (uint32_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
   {
@@ -759,7 +1120,8 @@ void Ogre2WideAngleCamera::DestroyFacesWorkspaces()
       ogreCompMgr->removeWorkspaceDefinition(workspaceName);
     }
   }
-  this->dataPtr->cubePassSceneDef = nullptr;
+  for (auto &sceneDef : this->dataPtr->cubePassSceneDef)
+    sceneDef = nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -838,18 +1200,19 @@ void Ogre2WideAngleCamera::UpdateRenderPasses()
   if (!updateConnection)
     return;
 
-  const uint8_t msaa =
-    Ogre2RenderTarget::TargetFSAA(static_cast<uint8_t>(this->antiAliasing));
+  const uint8_t msaa = this->TargetFSAA();
   const bool withMsaa = msaa > 1u;
+  // directly rendered faces have no render passes to reconnect
+  const bool direct = this->RendersFacesDirectly();
 
-  const IdString cubemapPassNodeName =
-    withMsaa ? "WideAngleCameraCubemapPassMsaa" : "WideAngleCameraCubemapPass";
+  const IdString cubemapPassNodeName = this->CubemapPassNodeName(withMsaa);
 
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
-  for (uint32_t faceIdx = 0u; faceIdx < kWideAngleNumCubemapFaces; ++faceIdx)
+  for (uint32_t faceIdx = 0u;
+       !direct && faceIdx < kWideAngleNumCubemapFaces; ++faceIdx)
   {
     const std::string wsDefName = this->WorkspaceDefinitionName(faceIdx);
     CompositorWorkspaceDef *workDef =
@@ -922,7 +1285,7 @@ void Ogre2WideAngleCamera::UpdateRenderPasses()
     }
   }
 
-  for (size_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
+  for (size_t i = 0u; !direct && i < kWideAngleNumCubemapFaces; ++i)
   {
     this->dataPtr->ogreCompositorWorkspace[i]->reconnectAllNodes();
   }
@@ -982,8 +1345,35 @@ void Ogre2WideAngleCamera::CreateWideAngleTexture()
   this->dataPtr->envCubeMapTexture->scheduleTransitionTo(
     Ogre::GpuResidency::Resident);
 
+  if (!this->RendersFacesDirectly())
+    this->CreateTmpTextures();
+
+  // Create compositor workspace
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  const uint8_t msaa = this->TargetFSAA();
+
+  if (msaa > 1u)
+  {
+    this->SetupMSAA(ogreCompMgr, msaa);
+  }
+
+  this->CreateFacesWorkspaces(msaa > 1u);
+  this->CreateStitchWorkspace();
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleCamera::CreateTmpTextures()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+
   for (uint32_t i = 0u; i < 2u; ++i)
   {
+    GZ_ASSERT(!this->dataPtr->ogreTmpTextures[i], "Should be nullptr");
+
     this->dataPtr->ogreTmpTextures[i] = textureMgr->createTexture(
       this->Name() + "_tmpTexture2d/" + std::to_string(i),  //
       Ogre::GpuPageOutStrategy::Discard,                    //
@@ -998,29 +1388,18 @@ void Ogre2WideAngleCamera::CreateWideAngleTexture()
     this->dataPtr->ogreTmpTextures[i]->scheduleTransitionTo(
       Ogre::GpuResidency::Resident);
   }
-
-  // Create compositor workspace
-  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
-
-  const uint8_t msaa =
-    Ogre2RenderTarget::TargetFSAA(static_cast<uint8_t>(this->antiAliasing));
-
-  if (msaa > 1u)
-  {
-    this->SetupMSAA(ogreCompMgr, msaa);
-  }
-
-  this->CreateFacesWorkspaces(msaa > 1u);
-  this->CreateStitchWorkspace();
 }
 
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::Render()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_RENDER);
+  this->BeginFrameInfo();
   // make sure we do not alter the reserved visibility flags
   const uint32_t currVisibilityMask = this->VisibilityMask() &
     Ogre::VisibilityFlags::RESERVED_VISIBILITY_FLAGS;
-  this->dataPtr->cubePassSceneDef->mVisibilityMask = currVisibilityMask;
+  for (Ogre::CompositorPassSceneDef *sceneDef : this->dataPtr->cubePassSceneDef)
+    sceneDef->mVisibilityMask = currVisibilityMask;
 
   this->scene->StartRendering(this->dataPtr->ogreCamera);
 
@@ -1029,8 +1408,17 @@ void Ogre2WideAngleCamera::Render()
   const Ogre::Quaternion oldCameraOrientation(
     this->dataPtr->ogreCamera->getOrientation());
 
-  for (size_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
+  // faces outside the lens cut off angle are never sampled by the stitch
+  // pass (see wide_lens_map_fp.glsl) so they are not rendered
+  const double cutOffAngle = this->Lens().CutOffAngle();
+  uint8_t numFacesRendered = 0u;
+
+  for (uint32_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
   {
+    if (!CubemapFaceVisible(i, cutOffAngle))
+      continue;
+    ++numFacesRendered;
+
     this->dataPtr->ogreCompositorWorkspace[i]->setEnabled(true);
 
     this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation *
@@ -1064,23 +1452,36 @@ void Ogre2WideAngleCamera::Render()
     this->dataPtr->ogreCompositorFinalPass->setEnabled(false);
   }
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(kWideAngleNumCubemapFaces,
-                                                false);
+  this->scene->FlushGpuCommandsAndStartNewFrame(numFacesRendered, false);
 }
 
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::Copy(Image &_image) const
 {
-  if (_image.Width() != this->ImageWidth() ||
-      _image.Height() != this->ImageHeight())
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
+
+  Ogre::TextureGpu *texture =
+    this->dataPtr->ogreStitchTexture[kStichFinalTexture];
+
+  // only download the readback region if there is one
+  Ogre::TextureBox srcBox = texture->getEmptyBox(0u);
+  if (this->readbackSize.X() > 0)
+  {
+    srcBox.x = static_cast<uint32_t>(this->readbackOffset.X());
+    srcBox.y = static_cast<uint32_t>(this->readbackOffset.Y());
+    srcBox.width = static_cast<uint32_t>(this->readbackSize.X());
+    srcBox.height = static_cast<uint32_t>(this->readbackSize.Y());
+  }
+  if (_image.Width() != srcBox.width || _image.Height() != srcBox.height ||
+      srcBox.x + srcBox.width > texture->getWidth() ||
+      srcBox.y + srcBox.height > texture->getHeight())
   {
     gzerr << "Invalid image dimensions" << std::endl;
     return;
   }
 
   Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(_image.Format());
-  Ogre::TextureGpu *texture =
-    this->dataPtr->ogreStitchTexture[kStichFinalTexture];
 
   if (Ogre::PixelFormatGpuUtils::isSRgb(dstOgrePf) !=
       Ogre::PixelFormatGpuUtils::isSRgb(texture->getPixelFormat()))
@@ -1095,23 +1496,24 @@ void Ogre2WideAngleCamera::Copy(Image &_image) const
   }
 
   Ogre::TextureBox dstBox(
-    texture->getInternalWidth(), texture->getInternalHeight(),
-    texture->getDepth(), texture->getNumSlices(),
+    srcBox.width, srcBox.height, 1u, 1u,
     static_cast<uint32_t>(
       Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
-    static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
-      texture->getInternalWidth(), 1u, 1u, 1u, dstOgrePf, 1u)),
-    static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
-      texture->getInternalWidth(), texture->getInternalHeight(), 1u, 1u,
-      dstOgrePf, 1u)));
+    _image.RowStride(), _image.RowStride() * _image.Height());
   dstBox.data = _image.Data();
 
-  Ogre::Image2::copyContentsToMemory(texture, texture->getEmptyBox(0u), dstBox,
-                                     dstOgrePf);
+  Ogre::Image2::copyContentsToMemory(texture, srcBox, dstBox, dstOgrePf);
 }
 
 //////////////////////////////////////////////////
 math::Vector3d Ogre2WideAngleCamera::Project3d(const math::Vector3d &_pt) const
+{
+  return this->Project3d(std::vector<math::Vector3d>{_pt})[0];
+}
+
+//////////////////////////////////////////////////
+std::vector<math::Vector3d> Ogre2WideAngleCamera::Project3d(
+    const std::vector<math::Vector3d> &_pts) const
 {
   using namespace Ogre;
 
@@ -1120,47 +1522,66 @@ math::Vector3d Ogre2WideAngleCamera::Project3d(const math::Vector3d &_pt) const
   const Quaternion oldCameraOrientation(
     this->dataPtr->ogreCamera->getOrientation());
 
-  // project world point to camera clip space.
+  // project world point to camera clip space for each face, the matrices
+  // are shared by all points
   const Matrix4 projMatrix = this->dataPtr->ogreCamera->getProjectionMatrix();
-  // const Vector4 basePos = viewProj * Vector4(Ogre2Conversions::Convert(_pt));
-  const Vector3 basePos = Ogre2Conversions::Convert(_pt);
-
-  // project onto cubemap face then onto
-  gz::math::Vector3d screenPos;
-  // loop through all env cameras can find the one that sees the 3d world point
+  Matrix4 viewProj[kWideAngleNumCubemapFaces];
   for (unsigned int i = 0u; i < kWideAngleNumCubemapFaces; ++i)
   {
-    // project world point to camera clip space for each face.
     this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation *
                                               kCubemapRotations[i]);
-    const Matrix4 viewProj =
-      projMatrix * this->dataPtr->ogreCamera->getViewMatrix();
-    Vector4 pos = viewProj * Vector4(basePos);
-    pos.x /= pos.w;
-    pos.y /= pos.w;
-    pos.z /= pos.w;
-    // check if point is visible
-    if (std::fabs(pos.x) <= 1 && std::fabs(pos.y) <= 1 && std::fabs(pos.z) <= 1)
+    viewProj[i] = projMatrix * this->dataPtr->ogreCamera->getViewMatrix();
+  }
+  this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation);
+
+  // rotate dir vector into wide angle camera frame based on the
+  // face of the cube. Note: operate in clip space so
+  // left handed coordinate system rotation
+  const gz::math::Quaterniond faceRotations[kWideAngleNumCubemapFaces] = {
+    gz::math::Quaterniond(0.0, GZ_PI * 0.5, 0.0),
+    gz::math::Quaterniond(0.0, -GZ_PI * 0.5, 0.0),
+    gz::math::Quaterniond(-GZ_PI * 0.5, 0.0, 0.0),
+    gz::math::Quaterniond(GZ_PI * 0.5, 0.0, 0.0),
+    gz::math::Quaterniond::Identity,
+    gz::math::Quaterniond(0.0, GZ_PI, 0.0)
+  };
+
+  // recompute f if scale to HFOV is true
+  const double f = LensFocalLength(this->Lens(), this->HFOV().Radian());
+
+  const uint32_t vpWidth =
+    this->dataPtr->ogreStitchTexture[kStichFinalTexture]->getWidth();
+  const uint32_t vpHeight =
+    this->dataPtr->ogreStitchTexture[kStichFinalTexture]->getHeight();
+  // env cam cube map texture is square and likely to be different size from
+  // viewport. We need to adjust projected pos based on aspect ratio
+  const double asp =
+    static_cast<double>(vpWidth) / static_cast<double>(vpHeight);
+
+  std::vector<math::Vector3d> screenPts;
+  screenPts.reserve(_pts.size());
+  for (const math::Vector3d &pt : _pts)
+  {
+    const Vector3 basePos = Ogre2Conversions::Convert(pt);
+
+    // project onto cubemap face then onto
+    gz::math::Vector3d screenPos;
+    // loop through all env cameras can find the one that sees the 3d world
+    // point
+    for (unsigned int i = 0u; i < kWideAngleNumCubemapFaces; ++i)
     {
+      Vector4 pos = viewProj[i] * Vector4(basePos);
+      pos.x /= pos.w;
+      pos.y /= pos.w;
+      pos.z /= pos.w;
+      // check if point is visible
+      if (std::fabs(pos.x) > 1 || std::fabs(pos.y) > 1 || std::fabs(pos.z) > 1)
+        continue;
+
       // determine dir vector to projected point from env camera
       // work in y up, z forward, x right clip space
       gz::math::Vector3d dir(pos.x, pos.y, 1);
-      gz::math::Quaterniond rot = gz::math::Quaterniond::Identity;
-
-      // rotate dir vector into wide angle camera frame based on the
-      // face of the cube. Note: operate in clip space so
-      // left handed coordinate system rotation
-      if (i == 0)
-        rot = gz::math::Quaterniond(0.0, GZ_PI * 0.5, 0.0);
-      else if (i == 1)
-        rot = gz::math::Quaterniond(0.0, -GZ_PI * 0.5, 0.0);
-      else if (i == 2)
-        rot = gz::math::Quaterniond(-GZ_PI * 0.5, 0.0, 0.0);
-      else if (i == 3)
-        rot = gz::math::Quaterniond(GZ_PI * 0.5, 0.0, 0.0);
-      else if (i == 5)
-        rot = gz::math::Quaterniond(0.0, GZ_PI, 0.0);
-      dir = rot * dir;
+      dir = faceRotations[i] * dir;
       dir.Normalize();
 
       // compute theta and phi from the dir vector
@@ -1177,17 +1598,6 @@ math::Vector3d Ogre2WideAngleCamera::Project3d(const math::Vector3d &_pt) const
       // double theta = std::acos(dir.Z());
       // double phi = std::asin(dir.Y() / std::sin(theta));
 
-      double f = this->Lens().F();
-      double fov = this->HFOV().Radian();
-      // recompute f if scale to HFOV is true
-      if (this->Lens().ScaleToHFOV())
-      {
-        double param = (fov / 2.0) / this->Lens().C2() + this->Lens().C3();
-        double funRes =
-          this->Lens().ApplyMappingFunction(static_cast<float>(param));
-        f = 1.0 / (this->Lens().C1() * funRes);
-      }
-
       // Apply fisheye lens mapping function
       // r is distance of point from image center
       double r = this->Lens().C1() * f *
@@ -1197,14 +1607,6 @@ math::Vector3d Ogre2WideAngleCamera::Project3d(const math::Vector3d &_pt) const
       // compute projected x and y in clip space
       double x = cos(phi) * r;
       double y = sin(phi) * r;
-
-      const uint32_t vpWidth =
-        this->dataPtr->ogreStitchTexture[kStichFinalTexture]->getWidth();
-      const uint32_t vpHeight =
-        this->dataPtr->ogreStitchTexture[kStichFinalTexture]->getHeight();
-      // env cam cube map texture is square and likely to be different size from
-      // viewport. We need to adjust projected pos based on aspect ratio
-      double asp = static_cast<double>(vpWidth) / static_cast<double>(vpHeight);
       y *= asp;
 
       // convert to screen space
@@ -1213,16 +1615,12 @@ math::Vector3d Ogre2WideAngleCamera::Project3d(const math::Vector3d &_pt) const
 
       // r will be > 1.0 if point is not visible (outside of image)
       screenPos.Z() = r;
-
-      this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation);
-
-      return screenPos;
+      break;
     }
+    screenPts.push_back(screenPos);
   }
 
-  this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation);
-
-  return screenPos;
+  return screenPts;
 }
 
 //////////////////////////////////////////////////
@@ -1246,9 +1644,47 @@ Ogre::Ray Ogre2WideAngleCamera::CameraToViewportRay(
   return ray;
 }
 
+//////////////////////////////////////////////////
+bool Ogre2WideAngleCamera::HasConnections() const
+{
+  return this->dataPtr->newImageFrame.ConnectionCount() > 0u ||
+      BaseWideAngleCamera::HasConnections();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2WideAngleCamera::ReleaseRenderTextures()
+{
+  if (!this->dataPtr->ogreStitchTexture[kStichFinalTexture])
+    return false;
+
+  // the cubemap, temp stitch and faces textures are recreated in PreRender
+  this->DestroyTextures();
+  return true;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2WideAngleCamera::MemoryUsage() const
+{
+  size_t bytes = Ogre2RenderEngine::WorkspaceSizeBytes(
+      this->dataPtr->ogreCompositorFinalPass);
+  for (const Ogre::CompositorWorkspace *workspace :
+       this->dataPtr->ogreCompositorWorkspace)
+  {
+    bytes += Ogre2RenderEngine::WorkspaceSizeBytes(workspace);
+  }
+  bytes += Ogre2RenderEngine::TextureSizeBytes(
+      this->dataPtr->envCubeMapTexture);
+  for (const Ogre::TextureGpu *texture : this->dataPtr->ogreTmpTextures)
+    bytes += Ogre2RenderEngine::TextureSizeBytes(texture);
+  for (const Ogre::TextureGpu *texture : this->dataPtr->ogreStitchTexture)
+    bytes += Ogre2RenderEngine::TextureSizeBytes(texture);
+  return bytes;
+}
+
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::PostRender()
 {
+  Ogre2SensorTimer timer(this->scene, this->Name(), SP_POST_RENDER);
   for (RenderPassPtr &pass : this->dataPtr->renderPasses)
   {
     pass->PostRender();
@@ -1290,6 +1726,7 @@ void Ogre2WideAngleCamera::PostRender()
     }
   }
 
+  this->EndFrameInfo(this->renderFrameInfo);
   PixelFormat format = this->ImageFormat();
   unsigned int channelCount = PixelUtil::ChannelCount(format);
   this->dataPtr->newImageFrame(reinterpret_cast<uint8_t *>(box.data), width,
@@ -1351,40 +1788,13 @@ void Ogre2WideAngleCamera::PrepareForFinalPass(Ogre::Pass *_pass)
   this->dataPtr->ogreCamera->setFOVy(Ogre::Radian(
       Ogre::Real(std::clamp(vfov, 0.0, GZ_PI))));
 
-  const float localHfov = static_cast<float>(this->HFOV().Radian());
-
-  Ogre::GpuProgramParametersSharedPtr psParams =
-    _pass->getFragmentProgramParameters();
-
-  psParams->setNamedConstant("c1", static_cast<Ogre::Real>(this->Lens().C1()));
-  psParams->setNamedConstant("c2", static_cast<Ogre::Real>(this->Lens().C2()));
-  psParams->setNamedConstant("c3", static_cast<Ogre::Real>(this->Lens().C3()));
-
-  if (this->Lens().ScaleToHFOV())
-  {
-    float param = (localHfov / 2) / this->Lens().C2() + this->Lens().C3();
-    float funRes = this->Lens().ApplyMappingFunction(static_cast<float>(param));
-
-    float newF = 1.0f / (this->Lens().C1() * funRes);
-
-    psParams->setNamedConstant("f", static_cast<Ogre::Real>(newF));
-  }
-  else
+  // the lens mapping is baked into the lens map, see UpdateLensMap. The
+  // pass is shared by all cameras so the texture is set for every camera.
+  if (this->dataPtr->lensMap)
   {
-    psParams->setNamedConstant("f", static_cast<Ogre::Real>(this->Lens().F()));
+    _pass->getTextureUnitState(1u)->setTexture(
+        this->dataPtr->lensMap->texture);
   }
-
-  auto vecFun = this->Lens().MappingFunctionAsVector3d();
-
-  psParams->setNamedConstant("fun",
-                             Ogre::Vector3(vecFun.X(), vecFun.Y(), vecFun.Z()));
-
-  psParams->setNamedConstant(
-    "cutOffAngle", static_cast<Ogre::Real>(this->Lens().CutOffAngle()));
-
-  Ogre::GpuProgramParametersSharedPtr vsParams =
-    _pass->getVertexProgramParameters();
-  vsParams->setNamedConstant("ratio", static_cast<Ogre::Real>(ratio));
 }
 
 //////////////////////////////////////////////////
@@ -1432,28 +1842,11 @@ void Ogre2WideAngleCamera::UpdateBackgroundMaterial()
   bool validBackground = this->dataPtr->backgroundMaterial &&
       !this->dataPtr->backgroundMaterial->EnvironmentMap().empty();
 
-  if (validBackground)
-  {
-    Ogre::MaterialManager &matManager = Ogre::MaterialManager::getSingleton();
-    std::string skyMatName = this->dataPtr->kSkyboxMaterialName + "_"
-        + this->Name();
-    auto mat = matManager.getByName(skyMatName);
-    if (!mat)
-    {
-      auto skyboxMat = matManager.getByName(this->dataPtr->kSkyboxMaterialName);
-      if (!skyboxMat)
-      {
-        gzerr << "Unable to find skybox material" << std::endl;
-        return;
-      }
-      mat = skyboxMat->clone(skyMatName);
-    }
-    Ogre::TextureUnitState *texUnit =
-        mat->getTechnique(0u)->getPass(0u)->getTextureUnitState(0u);
-    texUnit->setTextureName(this->dataPtr->backgroundMaterial->EnvironmentMap(),
-        Ogre::TextureTypes::TypeCube);
-    texUnit->setHardwareGammaEnabled(false);
-  }
+  // the sky material is shared by all cameras rendering the same sky
+  this->dataPtr->skyboxMaterialName = validBackground ?
+      Ogre2SkyBoxMaterial::Acquire(
+      this->dataPtr->backgroundMaterial->EnvironmentMap()) :
+      std::string();
 
   this->dataPtr->backgroundMaterialDirty = false;
 }
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#version ogre_glsl_ver_330
+
+// This fragment shader converts a rendered color image into a Bayer mosaic
+// so that only one byte per pixel has to be read back from the GPU.
+
+vulkan_layout( ogre_t0 ) uniform texture2D RT;
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  // size of the input texture in pixels
+  uniform vec4 texResolution;
+  // color channel (0: red, 1: green, 2: blue) that is kept at
+  // (even row, even column), (even row, odd column),
+  // (odd row, even column) and (odd row, odd column)
+  uniform vec4 channels;
+vulkan( }; )
+
+// input params from vertex shader
+vulkan_layout( location = 0 )
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// final output color
+vulkan_layout( location = 0 )
+out vec4 fragColor;
+
+// The input texture is sRGB so the fetched color is linear. Encode it back
+// so that the output matches the raw bytes of the rendered image.
+float toSrgb(float c)
+{
+  if (c <= 0.0031308)
+    return c * 12.92;
+  return 1.055 * pow(c, 1.0 / 2.4) - 0.055;
+}
+
+void main()
+{
+  ivec2 p = ivec2(inPs.uv0 * texResolution.xy);
+  vec4 color = texelFetch(RT, p, 0);
+  int idx = int(channels[(p.y & 1) * 2 + (p.x & 1)]);
+  fragColor = vec4(toSrgb(color[idx]), 0.0, 0.0, 1.0);
+}
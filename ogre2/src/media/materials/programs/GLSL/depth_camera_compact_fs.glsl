@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version ogre_glsl_ver_330
+
+vulkan_layout( location = 0 )
+in block
+{
+  vec2 uv0;
+} inPs;
+
+vulkan_layout( ogre_t0 ) uniform utexture2D inputTexture;
+
+vulkan_layout( location = 0 )
+out vec4 fragColor;
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  // scale applied to the depth, e.g. to store millimetres in a unorm texture
+  uniform float depthScale;
+  // 1 if the output is a unorm texture, in which case invalid depths are
+  // written as 0
+  uniform float normalized;
+
+  uniform vec4 texResolution;
+vulkan( }; )
+
+void main()
+{
+  // the input is the PFG_RGBA32_UINT output of the final pass, see
+  // depth_camera_final_fs.glsl. Depth is stored in the x channel.
+  uvec4 p = texelFetch(inputTexture, ivec2(inPs.uv0 * texResolution.xy), 0);
+  float depth = uintBitsToFloat(p.x);
+
+  if (normalized > 0.5)
+  {
+    if (isinf(depth) || isnan(depth) || depth <= 0.0)
+      depth = 0.0;
+    else
+      depth = min(depth * depthScale, 1.0);
+  }
+
+  fragColor = vec4(depth, 0.0, 0.0, 1.0);
+}
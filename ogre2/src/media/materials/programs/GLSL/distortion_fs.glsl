@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#version ogre_glsl_ver_330
+
+// This fragment shader applies lens distortion to a rendered image. For
+// every pixel of the distorted output image it finds the undistorted pixel
+// of the input image that the Brown-Conrady model maps to it, so unlike the
+// ogre1 implementation no distortion map needs to be computed on the CPU.
+// The model is inverted with a fixed point iteration, see undistort.
+
+vulkan_layout( ogre_t0 ) uniform texture2D RT;
+vulkan( layout( ogre_s0 ) uniform sampler texSampler );
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  // radial distortion coefficients k1, k2 and k3
+  uniform vec3 k;
+  // tangential distortion coefficients p1 and p2
+  uniform vec2 p;
+  // distortion center in uv coordinates
+  uniform vec2 center;
+  // focal length in units of the image size
+  uniform vec2 focal;
+  // scale applied to the distorted image to crop the black border
+  uniform vec2 scale;
+vulkan( }; )
+
+// input params from vertex shader
+vulkan_layout( location = 0 )
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// final output color
+vulkan_layout( location = 0 )
+out vec4 fragColor;
+
+#define UNDISTORT_ITERATIONS 20
+
+// Find the normalized undistorted location that is distorted to _xd
+vec2 undistort(vec2 _xd)
+{
+  vec2 x = _xd;
+  for (int i = 0; i < UNDISTORT_ITERATIONS; ++i)
+  {
+    float rSq = dot(x, x);
+    float radial = 1.0 + rSq * (k.x + rSq * (k.y + rSq * k.z));
+    vec2 tangential = vec2(
+        p.y * (rSq + 2.0 * x.x * x.x) + 2.0 * p.x * x.x * x.y,
+        p.x * (rSq + 2.0 * x.y * x.y) + 2.0 * p.y * x.x * x.y);
+    x = (_xd - tangential) / radial;
+  }
+  return x;
+}
+
+void main()
+{
+  vec2 scaleCenter = vec2(0.5, 0.5);
+  vec2 distortedUV = (inPs.uv0.xy - scaleCenter) * scale + scaleCenter;
+  vec2 uv = center + undistort((distortedUV - center) / focal) * focal;
+
+  if (uv.x < 0.0 || uv.y < 0.0 || uv.x > 1.0 || uv.y > 1.0)
+    fragColor = vec4(0.0, 0.0, 0.0, 1.0);
+  else
+    fragColor = texture(vkSampler2D(RT, texSampler), uv);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#version ogre_glsl_ver_330
+
+// This fragment shader applies fast approximate anti-aliasing (FXAA) to a
+// rendered image. Edges are detected from the luma contrast of the
+// neighbouring pixels and blurred along their direction, which smooths
+// aliased edges at the cost of a single full screen pass instead of a
+// multisampled render target.
+
+vulkan_layout( ogre_t0 ) uniform texture2D RT;
+vulkan( layout( ogre_s0 ) uniform sampler texSampler );
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  // inverse of the size of the input texture in pixels
+  uniform vec4 invTexResolution;
+vulkan( }; )
+
+// input params from vertex shader
+vulkan_layout( location = 0 )
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// final output color
+vulkan_layout( location = 0 )
+out vec4 fragColor;
+
+#define FXAA_REDUCE_MIN (1.0 / 128.0)
+#define FXAA_REDUCE_MUL (1.0 / 8.0)
+#define FXAA_SPAN_MAX 8.0
+
+vec3 sampleRT(vec2 uv)
+{
+  return texture(vkSampler2D(RT, texSampler), uv).rgb;
+}
+
+// The input texture is sRGB so the fetched color is linear, use the square
+// root to approximate perceived brightness
+float luma(vec3 color)
+{
+  return sqrt(dot(color, vec3(0.299, 0.587, 0.114)));
+}
+
+void main()
+{
+  vec2 uv = inPs.uv0;
+  vec2 rcp = invTexResolution.xy;
+
+  vec4 colorM = texture(vkSampler2D(RT, texSampler), uv);
+  float lumaNW = luma(sampleRT(uv + vec2(-1.0, -1.0) * rcp));
+  float lumaNE = luma(sampleRT(uv + vec2(1.0, -1.0) * rcp));
+  float lumaSW = luma(sampleRT(uv + vec2(-1.0, 1.0) * rcp));
+  float lumaSE = luma(sampleRT(uv + vec2(1.0, 1.0) * rcp));
+  float lumaM = luma(colorM.rgb);
+
+  float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+  float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+  // blur direction, perpendicular to the luma gradient
+  vec2 dir = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)),
+                  (lumaNW + lumaSW) - (lumaNE + lumaSE));
+  float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) *
+      (0.25 * FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);
+  float rcpDirMin = 1.0 / (min(abs(dir.x), abs(dir.y)) + dirReduce);
+  dir = clamp(dir * rcpDirMin, vec2(-FXAA_SPAN_MAX), vec2(FXAA_SPAN_MAX)) *
+      rcp;
+
+  vec3 rgbA = 0.5 * (sampleRT(uv + dir * (1.0 / 3.0 - 0.5)) +
+                     sampleRT(uv + dir * (2.0 / 3.0 - 0.5)));
+  vec3 rgbB = rgbA * 0.5 + 0.25 * (sampleRT(uv + dir * -0.5) +
+                                   sampleRT(uv + dir * 0.5));
+
+  // the wide blur crossed another edge, fall back to the narrow one
+  float lumaB = luma(rgbB);
+  if (lumaB < lumaMin || lumaB > lumaMax)
+    fragColor = vec4(rgbA, colorM.a);
+  else
+    fragColor = vec4(rgbB, colorM.a);
+}
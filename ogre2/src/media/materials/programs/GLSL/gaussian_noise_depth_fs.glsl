@@ -27,9 +27,10 @@ vulkan_layout( ogre_t0 ) uniform texture2D RT;
 vulkan( layout( ogre_s0 ) uniform sampler texSampler );
 
 vulkan( layout( ogre_P0 ) uniform Params { )
-	// Random values sampled on the CPU, which we'll use as offsets into our 2-D
-	// pseudo-random sampler here.
-	uniform vec3 offsets;
+	// Seed of the noise, set per sensor
+	uniform int seed;
+	// Frame counter of the noise
+	uniform int frame;
 	// Mean of the Gaussian distribution that we want to sample from.
 	uniform float mean;
 	// Standard deviation of the Gaussian distribution that we want to sample from.
@@ -49,37 +50,40 @@ out vec4 fragColor;
 
 #define PI 3.14159265358979323846264
 
-float rand(vec2 co)
+// Hash function of Jarzynski and Olano, "Hash Functions for GPU Rendering",
+// JCGT 2020. Every output bit depends on all input bits, so hashing the
+// pixel, frame and seed gives independent streams per pixel without any
+// state on the GPU.
+uvec4 pcg4d(uvec4 v)
 {
-  // This one-liner can be found in many places, including:
-  // http://stackoverflow.com/questions/4200224/random-noise-functions-for-glsl
-  // I can't find any explanation for it, but experimentally it does seem to
-  // produce approximately uniformly distributed values in the interval [0,1].
-  float r = fract(sin(dot(co.xy, vec2(12.9898,78.233))) * 43758.5453);
-
-  // Make sure that we don't return 0.0
-  return clamp(r, 0.001, 1.0);
+  v = v * 1664525u + 1013904223u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  v ^= v >> 16u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  return v;
 }
 
-vec4 gaussrand(vec2 co)
+// Convert 24 random bits to a uniform value in (0, 1), never 0 so that the
+// log below is finite
+float uniform01(uint bits)
+{
+  return (float(bits >> 8u) + 0.5) / 16777216.0;
+}
+
+vec4 gaussrand(vec2 fragCoord)
 {
   // Box-Muller method for sampling from the normal distribution
   // http://en.wikipedia.org/wiki/Normal_distribution#Generating_values_from_normal_distribution
-  // This method requires 2 uniform random inputs and produces 2
-  // Gaussian random outputs.  We'll take a 3rd random variable and use it to
-  // switch between the two outputs.
-
-  float U, V, R, Z;
-  // Add in the CPU-supplied random offsets to generate the 3 random values that
-  // we'll use.
-  U = rand(co + vec2(offsets.x, offsets.x));
-  V = rand(co + vec2(offsets.y, offsets.y));
-  R = rand(co + vec2(offsets.z, offsets.z));
-  // Switch between the two random outputs.
-  if(R < 0.5)
-    Z = sqrt(-2.0 * log(U)) * sin(2.0 * PI * V);
-  else
-    Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
+  uvec4 h = pcg4d(uvec4(uvec2(fragCoord), uint(frame), uint(seed)));
+  float U = uniform01(h.x);
+  float V = uniform01(h.y);
+  float Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
 
   float oldZ = Z;
 
@@ -117,7 +121,7 @@ void main()
   vec4 p = texture(vkSampler2D(RT,texSampler), inPs.uv0.xy);
 
   // gaussian noise
-  float z = gaussrand(inPs.uv0.xy).x;
+  float z = gaussrand(gl_FragCoord.xy).x;
 
   // apply noise to xyz
   vec3 xyz =  p.xyz + vec3(z, z, z);
@@ -29,28 +29,14 @@
 // want to sample a new value from a Gaussian distribution and add it to each
 // channel in the input image.
 //
-// There isn't (as far as I can tell) a way to generate random values in GLSL.
-// The GPU vendors apparently don't implement the noise[1-4]() functions that
-// are described in the documentation.  What we do have is a deterministic
-// function that does a decent job of appoximating a uniform distribution
-// on [0,1].  But it requires a 2-D vector as input.
+// The random numbers are generated per pixel with a counter based
+// generator: the pixel coordinates, a frame counter and a per sensor seed
+// are hashed into independent uniform values, which the Box-Muller method
+// turns into a Gaussian sample. The noise is therefore uncorrelated between
+// pixels, frames and sensors, and the same seed reproduces the same noise
+// across runs. The CPU only increments the frame counter.
 //
-// So we're doing something mildly complicated:
-//
-// 1. On the CPU, before each call to this shader, generate 3 random numbers
-// that are uniformly distributed on [0,1.0] and pass them here,
-// in the `offsets` parameter.
-//
-// 2. Each time we need a random number here, add one of the CPU-provided
-// offsets to our current pixel coordinates and give the resulting vector to our
-// pseudo-random number generator.
-//
-// 3. Implement the Box-Muller method to sample from a Gaussian distribution.
-// Normally each iteration of this method requires 2 uniform inputs and
-// gives 2 Gaussian outputs.  We're using 3 uniform inputs, with the 3rd
-// being used to select randomly between the 2 Gaussian outputs.
-//
-// 4. Having produced a Gaussian sample, we add this value to each channel of
+// Having produced a Gaussian sample, we add this value to each channel of
 // the input image.
 
 // The input texture, which is set up by the Ogre Compositor infrastructure.
@@ -61,9 +47,10 @@ vulkan( layout( ogre_s0 ) uniform sampler texSampler );
 // Ogre::GpuProgramParameters::setNamedConstant()
 
 vulkan( layout( ogre_P0 ) uniform Params { )
-	// Random values sampled on the CPU, which we'll use as offsets into our 2-D
-	// pseudo-random sampler here.
-	uniform vec3 offsets;
+	// Seed of the noise, set per sensor
+	uniform int seed;
+	// Frame counter of the noise
+	uniform int frame;
 	// Mean of the Gaussian distribution that we want to sample from.
 	uniform float mean;
 	// Standard deviation of the Gaussian distribution that we want to sample from.
@@ -83,40 +70,40 @@ out vec4 fragColor;
 
 #define PI 3.14159265358979323846264
 
-float rand(vec2 co)
+// Hash function of Jarzynski and Olano, "Hash Functions for GPU Rendering",
+// JCGT 2020. Every output bit depends on all input bits, so hashing the
+// pixel, frame and seed gives independent streams per pixel without any
+// state on the GPU.
+uvec4 pcg4d(uvec4 v)
 {
-  // This one-liner can be found in many places, including:
-  // http://stackoverflow.com/questions/4200224/random-noise-functions-for-glsl
-  // I can't find any explanation for it, but experimentally it does seem to
-  // produce approximately uniformly distributed values in the interval [0,1].
-  float r = fract(sin(dot(co.xy, vec2(12.9898,78.233))) * 43758.5453);
+  v = v * 1664525u + 1013904223u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  v ^= v >> 16u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  return v;
+}
 
-  // Make sure that we don't return 0.0
-  if(r == 0.0)
-    return 0.000000000001;
-  else
-    return r;
+// Convert 24 random bits to a uniform value in (0, 1), never 0 so that the
+// log below is finite
+float uniform01(uint bits)
+{
+  return (float(bits >> 8u) + 0.5) / 16777216.0;
 }
 
-vec4 gaussrand(vec2 co)
+vec4 gaussrand(vec2 fragCoord)
 {
   // Box-Muller method for sampling from the normal distribution
   // http://en.wikipedia.org/wiki/Normal_distribution#Generating_values_from_normal_distribution
-  // This method requires 2 uniform random inputs and produces 2
-  // Gaussian random outputs.  We'll take a 3rd random variable and use it to
-  // switch between the two outputs.
-
-  float U, V, R, Z;
-  // Add in the CPU-supplied random offsets to generate the 3 random values that
-  // we'll use.
-  U = rand(co + vec2(offsets.x, offsets.x));
-  V = rand(co + vec2(offsets.y, offsets.y));
-  R = rand(co + vec2(offsets.z, offsets.z));
-  // Switch between the two random outputs.
-  if(R < 0.5)
-    Z = sqrt(-2.0 * log(U)) * sin(2.0 * PI * V);
-  else
-    Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
+  uvec4 h = pcg4d(uvec4(uvec2(fragCoord), uint(frame), uint(seed)));
+  float U = uniform01(h.x);
+  float V = uniform01(h.y);
+  float Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
 
   // Apply the stddev and mean.
   Z = Z * stddev + mean;
@@ -131,7 +118,7 @@ void main()
   // range.
   // note that an exponent is added to sampled noise, i.e. pow(noise, x),
   // which produces more consistent result with ogre1.x
-  float z = gaussrand(inPs.uv0.xy).x;
+  float z = gaussrand(gl_FragCoord.xy).x;
   float n = pow(abs(z), 2.1);
   if (z < 0)
     n = -n;
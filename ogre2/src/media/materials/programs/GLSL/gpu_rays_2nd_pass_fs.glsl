@@ -58,23 +58,36 @@ vulkan( layout( ogre_s0 ) uniform sampler texSampler );
 vulkan_layout( location = 0 )
 out vec4 fragColor;
 
+vulkan( layout( ogre_P0 ) uniform Params { )
+  // number of output texels per ray, 3 for packed [range, retro, 0]
+  // triplets and 1 when each texel holds all channels of a ray
+  uniform float texelsPerRay;
+  // scale applied to the range, e.g. to store millimetres in a unorm texture
+  uniform float rangeScale;
+  // 1 to output [first, last, strongest, strongest retro] returns
+  uniform float multiReturn;
+  // 1 to output [x, y, z, retro] points in the sensor frame
+  uniform float pointCloud;
+  // number of samples gathered within the footprint of each beam
+  uniform float beamSamples;
+  // half angle of the beam cone in radians
+  uniform float beamRadius;
+  // ranges beyond this are misses
+  uniform float farRange;
+vulkan( }; )
+
+#define MAX_BEAM_SAMPLES 16
+// golden angle in radians, spreads the samples evenly over the footprint
+#define GOLDEN_ANGLE 2.39996323
+
 vec2 getRange(vec2 uv, texture2D tex)
 {
   vec2 range = texture(vkSampler2D(tex,texSampler), uv).xy;
   return range;
 }
 
-void main()
+vec2 getFaceRange(float faceIdx, vec2 uv)
 {
-  // get face index and uv coorodate data
-  vec3 data = texture(vkSampler2D(cubeUVTex,texSampler), inPs.uv0).xyz;
-
-  // which face to sample range data from
-  float faceIdx = data.z;
-
-  // uv coordinates on texture that stores the range data
-  vec2 uv = data.xy;
-
   vec2 d;
   d.x = 0;
   d.y = 0;
@@ -90,10 +103,122 @@ void main()
     d = getRange(uv, tex4);
   else if (faceIdx == 5)
     d = getRange(uv, tex5);
+  return d;
+}
+
+// direction of a ray in the sensor frame (x forward, y left, z up) from
+// its cubemap face and uv, i.e. the inverse of Ogre2GpuRays::SampleCubemap
+vec3 rayDirection(float faceIdx, vec2 uv)
+{
+  vec2 p = uv * 2.0 - 1.0;
+  vec3 dir;
+  if (faceIdx == 0)
+    dir = vec3(1.0, -p.y, -p.x);
+  else if (faceIdx == 1)
+    dir = vec3(-1.0, -p.y, p.x);
+  else if (faceIdx == 2)
+    dir = vec3(p.x, 1.0, p.y);
+  else if (faceIdx == 3)
+    dir = vec3(p.x, -1.0, -p.y);
+  else if (faceIdx == 4)
+    dir = vec3(p.x, -p.y, 1.0);
+  else
+    dir = vec3(-p.x, -p.y, -1.0);
+  dir = normalize(dir);
+  // the cubemap is y up with the sensor looking along +z
+  return vec3(dir.z, -dir.x, dir.y);
+}
 
-  float range = d.x;
-  float retro = d.y;
+void main()
+{
+  // get face index and uv coorodate data
+  vec3 data = texture(vkSampler2D(cubeUVTex,texSampler), inPs.uv0).xyz;
+
+  // which face to sample range data from
+  float faceIdx = data.z;
+
+  // uv coordinates on texture that stores the range data
+  vec2 uv = data.xy;
 
-  fragColor = vec4(range, retro, 0, 1.0);
+  vec2 d = getFaceRange(faceIdx, uv);
+  float first = d.x;
+  float firstRetro = d.y;
+  float last = -1.0;
+  float strongest = d.x;
+  float strongestRetro = d.y;
+  if (d.x <= farRange)
+    last = d.x;
+
+  // gather the other samples of the beam on a spiral within its cone. An
+  // angle a away from the ray moves the sample by about a * (1 + x^2 + y^2)
+  // on the face plane at distance 1, i.e. half that in uv. Samples stay on
+  // the face of the ray.
+  float footprint = 0.5 * beamRadius *
+      (1.0 + dot(uv * 2.0 - 1.0, uv * 2.0 - 1.0));
+  for (int i = 1; i < MAX_BEAM_SAMPLES; ++i)
+  {
+    if (float(i) >= beamSamples)
+      break;
+    float r = footprint * sqrt(float(i) / (beamSamples - 1.0));
+    float a = float(i) * GOLDEN_ANGLE;
+    vec2 s = getFaceRange(faceIdx,
+        clamp(uv + r * vec2(cos(a), sin(a)), 0.0, 1.0));
+    if (s.x < first)
+    {
+      first = s.x;
+      firstRetro = s.y;
+    }
+    if (s.x <= farRange)
+    {
+      last = max(last, s.x);
+      if (!(strongest <= farRange) || s.y > strongestRetro ||
+          (s.y == strongestRetro && s.x < strongest))
+      {
+        strongest = s.x;
+        strongestRetro = s.y;
+      }
+    }
+  }
+  if (last < 0.0)
+    last = first;
+
+  if (multiReturn > 0.5)
+  {
+    fragColor = vec4(first, last, strongest, strongestRetro);
+    return;
+  }
+
+  // single return formats report the first return of the beam
+  float range = first;
+  float retro = firstRetro;
+
+  if (pointCloud > 0.5)
+  {
+    fragColor = vec4(rayDirection(faceIdx, uv) * range, retro);
+    return;
+  }
+
+  // Compact formats write all channels of a ray to a single texel
+  if (texelsPerRay < 2.0)
+  {
+    fragColor = vec4(range * rangeScale, retro, 0, 1.0);
+    return;
+  }
+
+  // The output texture is a single channel texture 3 times as wide as
+  // cubeUVTex so that the data is already packed as [range, retro, 0]
+  // triplets when read back on the CPU (RGB32F is not available on all
+  // platforms). Work out which of the 3 channels this texel holds from its
+  // position within the corresponding cubeUVTex texel.
+  float width = float(textureSize(vkSampler2D(cubeUVTex,texSampler), 0).x);
+  float channel = floor(fract(inPs.uv0.x * width) * texelsPerRay);
+
+  float value = 0.0;
+  if (channel == 0.0)
+    value = range;
+  else if (channel == 1.0)
+    value = retro;
+
+  fragColor = vec4(value, 0, 0, 1.0);
   return;
 }
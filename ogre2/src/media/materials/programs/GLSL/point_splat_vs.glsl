@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version ogre_glsl_ver_330
+
+vulkan_layout( OGRE_POSITION ) in vec4 vertex;
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  uniform mat4 worldView;
+  uniform mat4 projection;
+  uniform float viewportHeight;
+  uniform float size;
+  uniform float attenuation;
+  uniform float maxPixelSize;
+  uniform float format;
+  uniform float intensityMin;
+  uniform float intensityMax;
+  uniform vec4 lowColor;
+  uniform vec4 highColor;
+vulkan( }; )
+
+vulkan_layout( location = 0 )
+out block
+{
+  vec3 ptColor;
+} outVs;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+  float gl_PointSize;
+};
+
+void main()
+{
+  vec3 pos = vertex.xyz;
+
+  // points without a valid position, e.g. depth camera pixels without a
+  // return, are moved outside of the clip volume
+  if (any(isnan(pos)) || any(isinf(pos)))
+  {
+    gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+    gl_PointSize = 1.0;
+    outVs.ptColor = vec3(0.0);
+    return;
+  }
+
+  vec4 viewPos = worldView * vec4(pos, 1.0);
+  gl_Position = projection * viewPos;
+
+  // attenuated sizes are in meters, converted with the vertical focal
+  // length in pixels. Orthographic projections have no perspective divide.
+  float pixelSize = size;
+  if (attenuation > 0.5)
+  {
+    float depth = projection[3][3] > 0.5 ? 1.0 : max(-viewPos.z, 1e-4);
+    pixelSize = size * 0.5 * projection[1][1] * viewportHeight / depth;
+  }
+  gl_PointSize = clamp(pixelSize, 1.0, maxPixelSize);
+
+  // the 4th component holds the bits of the color or the intensity
+  uint bits = floatBitsToUint(vertex.w);
+  if (format < 0.5)
+  {
+    // PCF_PACKED_XYZRGBA: red in the first byte
+    outVs.ptColor = vec3(uvec3(bits, bits >> 8u, bits >> 16u) & 0xFFu) /
+        255.0;
+  }
+  else if (format < 1.5)
+  {
+    // PCF_XYZRGBA_FLOAT32: red in the highest byte
+    outVs.ptColor = vec3(uvec3(bits >> 24u, bits >> 16u, bits >> 8u) &
+        0xFFu) / 255.0;
+  }
+  else
+  {
+    // PCF_XYZI_FLOAT32
+    float t = clamp((vertex.w - intensityMin) /
+        max(intensityMax - intensityMin, 1e-6), 0.0, 1.0);
+    outVs.ptColor = mix(lowColor.rgb, highColor.rgb, t);
+  }
+}
@@ -44,6 +44,9 @@ vulkan( layout( ogre_P0 ) uniform Params { )
 	uniform float ambient;
 	uniform int rgbToTemp;
 	uniform int bitDepth;
+	uniform int colormap;
+	uniform float colormapMin;
+	uniform float colormapMax;
 vulkan( }; )
 
 float getDepth(vec2 uv)
@@ -53,6 +56,18 @@ float getDepth(vec2 uv)
   return linearDepth;
 }
 
+// false color gradient used to visualize temperatures, from cold to hot:
+// black, blue, magenta, orange, yellow, white
+vec3 colormapColor(float t)
+{
+  const vec3 stops[6] = vec3[6](
+      vec3(0.0, 0.0, 0.0), vec3(0.1, 0.0, 0.5), vec3(0.6, 0.0, 0.6),
+      vec3(0.95, 0.35, 0.0), vec3(1.0, 0.85, 0.0), vec3(1.0, 1.0, 1.0));
+  float x = clamp(t, 0.0, 1.0) * 5.0;
+  int i = min(int(x), 4);
+  return mix(stops[i], stops[i + 1], x - float(i));
+}
+
 void main()
 {
   // temperature defaults to ambient
@@ -119,6 +134,14 @@ void main()
   temp = temp - heatRange / 2.0 + delta;
   clamp(temp, min, max);
 
+  // visualization output: map the temperature range to colors
+  if (colormap == 1)
+  {
+    float t = (temp - colormapMin) / max(colormapMax - colormapMin, 1e-6);
+    fragColor = vec4(colormapColor(t), 1.0);
+    return;
+  }
+
   // apply resolution factor
   temp /= resolution;
   // normalize
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version ogre_glsl_ver_330
+
+vulkan_layout( OGRE_POSITION ) in vec4 vertex;
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  uniform mat4 worldViewProj;
+vulkan( }; )
+
+vulkan_layout( location = 0 )
+out block
+{
+  vec3 faceColor;
+} outVs;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+void main()
+{
+  gl_Position = worldViewProj * vec4(vertex.xyz, 1.0);
+
+  // the 4th component holds the color, red in the first byte, and the
+  // face direction plus 64 in the highest byte. The faces are shaded with
+  // a fixed brightness per direction so that neighbouring cubes stand out
+  // without lights.
+  uint bits = floatBitsToUint(vertex.w);
+  uint face = (bits >> 24u) - 64u;
+  float shade = face >= 4u ? (face == 4u ? 1.0 : 0.5) :
+      (face >= 2u ? 0.65 : 0.8);
+  outVs.faceColor = vec3(uvec3(bits, bits >> 8u, bits >> 16u) & 0xFFu) /
+      255.0 * shade;
+}
@@ -20,21 +20,19 @@
 vulkan_layout( OGRE_POSITION ) in vec4 vertex;
 
 vulkan( layout( ogre_P0 ) uniform Params { )
-  // aspect ratio
-  uniform float ratio;
   uniform mat4 worldViewProj;
 vulkan( }; )
 
 vulkan_layout( location = 0 )
 out block
 {
-  vec2 fragPos;
+  vec2 uv0;
 } outVs;
 
 void main()
 {
   gl_Position = worldViewProj * vertex;
 
-  // get normalized fragment coordinate (3D to 2D window space transformation)
-  outVs.fragPos = gl_Position.xy/gl_Position.w*vec2(-1.0,-1.0/ratio);
+  // lens map coordinate (3D to 2D window space transformation)
+  outVs.uv0 = gl_Position.xy/gl_Position.w*0.5 + 0.5;
 }
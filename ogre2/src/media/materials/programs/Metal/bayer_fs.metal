@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+// For details and documentation see: bayer_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 texResolution;
+  float4 channels;
+};
+
+float toSrgb(float c)
+{
+  if (c <= 0.0031308)
+    return c * 12.92;
+  return 1.055 * pow(c, 1.0 / 2.4) - 0.055;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  uint2 coord = uint2(inPs.uv0 * p.texResolution.xy);
+  float4 color = RT.read(coord, 0);
+  int idx = int(p.channels[(coord.y & 1u) * 2u + (coord.x & 1u)]);
+  return float4(toSrgb(color[idx]), 0.0, 0.0, 1.0);
+}
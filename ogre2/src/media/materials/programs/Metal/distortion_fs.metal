@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: distortion_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float3 k;
+  float2 p;
+  float2 center;
+  float2 focal;
+  float2 scale;
+};
+
+#define UNDISTORT_ITERATIONS 20
+
+float2 undistort(float2 _xd, float3 k, float2 p)
+{
+  float2 x = _xd;
+  for (int i = 0; i < UNDISTORT_ITERATIONS; ++i)
+  {
+    float rSq = dot(x, x);
+    float radial = 1.0 + rSq * (k.x + rSq * (k.y + rSq * k.z));
+    float2 tangential = float2(
+        p.y * (rSq + 2.0 * x.x * x.x) + 2.0 * p.x * x.x * x.y,
+        p.x * (rSq + 2.0 * x.y * x.y) + 2.0 * p.y * x.x * x.y);
+    x = (_xd - tangential) / radial;
+  }
+  return x;
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  sampler rtSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float2 scaleCenter = float2(0.5, 0.5);
+  float2 distortedUV = (inPs.uv0.xy - scaleCenter) * p.scale + scaleCenter;
+  float2 uv = p.center +
+      undistort((distortedUV - p.center) / p.focal, p.k, p.p) * p.focal;
+
+  if (uv.x < 0.0 || uv.y < 0.0 || uv.x > 1.0 || uv.y > 1.0)
+    return float4(0.0, 0.0, 0.0, 1.0);
+  return RT.sample(rtSampler, uv);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+// For details and documentation see: fxaa_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+  float4 invTexResolution;
+};
+
+#define FXAA_REDUCE_MIN (1.0 / 128.0)
+#define FXAA_REDUCE_MUL (1.0 / 8.0)
+#define FXAA_SPAN_MAX 8.0
+
+float luma(float3 color)
+{
+  return sqrt(dot(color, float3(0.299, 0.587, 0.114)));
+}
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float> RT [[texture(0)]],
+  sampler rtSampler [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  float2 uv = inPs.uv0;
+  float2 rcp = p.invTexResolution.xy;
+
+  float4 colorM = RT.sample(rtSampler, uv);
+  float lumaNW = luma(RT.sample(rtSampler, uv + float2(-1.0, -1.0) * rcp).rgb);
+  float lumaNE = luma(RT.sample(rtSampler, uv + float2(1.0, -1.0) * rcp).rgb);
+  float lumaSW = luma(RT.sample(rtSampler, uv + float2(-1.0, 1.0) * rcp).rgb);
+  float lumaSE = luma(RT.sample(rtSampler, uv + float2(1.0, 1.0) * rcp).rgb);
+  float lumaM = luma(colorM.rgb);
+
+  float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+  float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+  float2 dir = float2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)),
+                      (lumaNW + lumaSW) - (lumaNE + lumaSE));
+  float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) *
+      (0.25 * FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);
+  float rcpDirMin = 1.0 / (min(abs(dir.x), abs(dir.y)) + dirReduce);
+  dir = clamp(dir * rcpDirMin, float2(-FXAA_SPAN_MAX), float2(FXAA_SPAN_MAX)) *
+      rcp;
+
+  float3 rgbA = 0.5 * (RT.sample(rtSampler, uv + dir * (1.0 / 3.0 - 0.5)).rgb +
+                       RT.sample(rtSampler, uv + dir * (2.0 / 3.0 - 0.5)).rgb);
+  float3 rgbB = rgbA * 0.5 + 0.25 *
+      (RT.sample(rtSampler, uv + dir * -0.5).rgb +
+       RT.sample(rtSampler, uv + dir * 0.5).rgb);
+
+  float lumaB = luma(rgbB);
+  if (lumaB < lumaMin || lumaB > lumaMax)
+    return float4(rgbA, colorM.a);
+  return float4(rgbB, colorM.a);
+}
@@ -27,9 +27,10 @@ struct PS_INPUT
 
 struct Params
 {
-  // Random values sampled on the CPU, which we'll use as offsets into our 2-D
-  // pseudo-random sampler here.
-  float3 offsets;
+  // Seed of the noise, set per sensor
+  int seed;
+  // Frame counter of the noise
+  int frame;
   // Mean of the Gaussian distribution that we want to sample from.
   float mean;
   // Standard deviation of the Gaussian distribution that we want to sample from.
@@ -38,40 +39,41 @@ struct Params
 
 #define PI 3.14159265358979323846264
 
-float rand(float2 co)
+// Hash function of Jarzynski and Olano, "Hash Functions for GPU Rendering",
+// JCGT 2020. Every output bit depends on all input bits, so hashing the
+// pixel, frame and seed gives independent streams per pixel without any
+// state on the GPU.
+uint4 pcg4d(uint4 v)
 {
-  // This one-liner can be found in many places, including:
-  // http://stackoverflow.com/questions/4200224/random-noise-functions-for-glsl
-  // I can't find any explanation for it, but experimentally it does seem to
-  // produce approximately uniformly distributed values in the interval [0,1].
-  float r = fract(sin(dot(co.xy, float2(12.9898,78.233))) * 43758.5453);
+  v = v * 1664525u + 1013904223u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  v ^= v >> 16u;
+  v.x += v.y * v.w;
+  v.y += v.z * v.x;
+  v.z += v.x * v.y;
+  v.w += v.y * v.z;
+  return v;
+}
 
-  // Make sure that we don't return 0.0
-  if(r == 0.0)
-    return 0.000000000001;
-  else
-    return r;
+// Convert 24 random bits to a uniform value in (0, 1), never 0 so that the
+// log below is finite
+float uniform01(uint bits)
+{
+  return (float(bits >> 8u) + 0.5) / 16777216.0;
 }
 
-float4 gaussrand(float2 co, float3 offsets, float mean, float stddev)
+float4 gaussrand(float2 fragCoord, int seed, int frame, float mean,
+    float stddev)
 {
   // Box-Muller method for sampling from the normal distribution
   // http://en.wikipedia.org/wiki/Normal_distribution#Generating_values_from_normal_distribution
-  // This method requires 2 uniform random inputs and produces 2
-  // Gaussian random outputs.  We'll take a 3rd random variable and use it to
-  // switch between the two outputs.
-
-  float U, V, R, Z;
-  // Add in the CPU-supplied random offsets to generate the 3 random values that
-  // we'll use.
-  U = rand(co + float2(offsets.x, offsets.x));
-  V = rand(co + float2(offsets.y, offsets.y));
-  R = rand(co + float2(offsets.z, offsets.z));
-  // Switch between the two random outputs.
-  if(R < 0.5)
-    Z = sqrt(-2.0 * log(U)) * sin(2.0 * PI * V);
-  else
-    Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
+  uint4 h = pcg4d(uint4(uint2(fragCoord), uint(frame), uint(seed)));
+  float U = uniform01(h.x);
+  float V = uniform01(h.y);
+  float Z = sqrt(-2.0 * log(U)) * cos(2.0 * PI * V);
 
   // Apply the stddev and mean.
   Z = Z * stddev + mean;
@@ -83,6 +85,7 @@ float4 gaussrand(float2 co, float3 offsets, float mean, float stddev)
 fragment float4 main_metal
 (
   PS_INPUT inPs [[stage_in]],
+  float4 fragCoord [[position]],
   texture2d<float> RT [[texture(0)]],
   sampler rtSampler [[sampler(0)]],
   constant Params &p [[buffer(PARAMETER_SLOT)]]
@@ -92,7 +95,8 @@ fragment float4 main_metal
   // range.
   // note that an exponent is added to sampled noise, i.e. pow(noise, x),
   // which produces more consistent result with ogre1.x
-  float z = gaussrand(inPs.uv0.xy, p.offsets, p.mean, p.stddev).x;
+  float z = gaussrand(fragCoord.xy, p.seed, p.frame, p.mean,
+      p.stddev).x;
   float n = pow(abs(z), 2.1);
   if (z < 0)
     n = -n;
@@ -27,14 +27,68 @@ struct PS_INPUT
 
 struct Params
 {
+  float texelsPerRay;
+  float rangeScale;
+  float multiReturn;
+  float pointCloud;
+  float beamSamples;
+  float beamRadius;
+  float farRange;
 };
 
+#define MAX_BEAM_SAMPLES 16
+#define GOLDEN_ANGLE 2.39996323
+
 float2 getRange(float2 uv, texture2d<float> tex, sampler texSampler)
 {
   float2 range = tex.sample(texSampler, uv).xy;
   return range;
 }
 
+float2 getFaceRange(float faceIdx, float2 uv,
+  texture2d<float> tex0, texture2d<float> tex1, texture2d<float> tex2,
+  texture2d<float> tex3, texture2d<float> tex4, texture2d<float> tex5,
+  sampler tex0Sampler, sampler tex1Sampler, sampler tex2Sampler,
+  sampler tex3Sampler, sampler tex4Sampler, sampler tex5Sampler)
+{
+  float2 d;
+  d.x = 0;
+  d.y = 0;
+  if (faceIdx == 0)
+    d = getRange(uv, tex0, tex0Sampler);
+  else if (faceIdx == 1)
+    d = getRange(uv, tex1, tex1Sampler);
+  else if (faceIdx == 2)
+    d = getRange(uv, tex2, tex2Sampler);
+  else if (faceIdx == 3)
+    d = getRange(uv, tex3, tex3Sampler);
+  else if (faceIdx == 4)
+    d = getRange(uv, tex4, tex4Sampler);
+  else if (faceIdx == 5)
+    d = getRange(uv, tex5, tex5Sampler);
+  return d;
+}
+
+float3 rayDirection(float faceIdx, float2 uv)
+{
+  float2 p = uv * 2.0 - 1.0;
+  float3 dir;
+  if (faceIdx == 0)
+    dir = float3(1.0, -p.y, -p.x);
+  else if (faceIdx == 1)
+    dir = float3(-1.0, -p.y, p.x);
+  else if (faceIdx == 2)
+    dir = float3(p.x, 1.0, p.y);
+  else if (faceIdx == 3)
+    dir = float3(p.x, -1.0, -p.y);
+  else if (faceIdx == 4)
+    dir = float3(p.x, -p.y, 1.0);
+  else
+    dir = float3(-p.x, -p.y, -1.0);
+  dir = normalize(dir);
+  return float3(dir.z, -dir.x, dir.y);
+}
+
 fragment float4 main_metal
 (
   PS_INPUT inPs [[stage_in]],
@@ -64,25 +118,75 @@ fragment float4 main_metal
   // uv coordinates on texture that stores the range data
   float2 uv = data.xy;
 
-  float2 d;
-  d.x = 0;
-  d.y = 0;
-  if (faceIdx == 0)
-    d = getRange(uv, tex0, tex0Sampler);
-  else if (faceIdx == 1)
-    d = getRange(uv, tex1, tex1Sampler);
-  else if (faceIdx == 2)
-    d = getRange(uv, tex2, tex2Sampler);
-  else if (faceIdx == 3)
-    d = getRange(uv, tex3, tex3Sampler);
-  else if (faceIdx == 4)
-    d = getRange(uv, tex4, tex4Sampler);
-  else if (faceIdx == 5)
-    d = getRange(uv, tex5, tex5Sampler);
+  float2 d = getFaceRange(faceIdx, uv, tex0, tex1, tex2, tex3, tex4, tex5,
+      tex0Sampler, tex1Sampler, tex2Sampler, tex3Sampler, tex4Sampler,
+      tex5Sampler);
+  float first = d.x;
+  float firstRetro = d.y;
+  float last = -1.0;
+  float strongest = d.x;
+  float strongestRetro = d.y;
+  if (d.x <= p.farRange)
+    last = d.x;
+
+  // gather the other samples of the beam on a spiral within its cone
+  float footprint = 0.5 * p.beamRadius *
+      (1.0 + dot(uv * 2.0 - 1.0, uv * 2.0 - 1.0));
+  for (int i = 1; i < MAX_BEAM_SAMPLES; ++i)
+  {
+    if (float(i) >= p.beamSamples)
+      break;
+    float r = footprint * sqrt(float(i) / (p.beamSamples - 1.0));
+    float a = float(i) * GOLDEN_ANGLE;
+    float2 s = getFaceRange(faceIdx,
+        clamp(uv + r * float2(cos(a), sin(a)), 0.0, 1.0),
+        tex0, tex1, tex2, tex3, tex4, tex5,
+        tex0Sampler, tex1Sampler, tex2Sampler, tex3Sampler, tex4Sampler,
+        tex5Sampler);
+    if (s.x < first)
+    {
+      first = s.x;
+      firstRetro = s.y;
+    }
+    if (s.x <= p.farRange)
+    {
+      last = max(last, s.x);
+      if (!(strongest <= p.farRange) || s.y > strongestRetro ||
+          (s.y == strongestRetro && s.x < strongest))
+      {
+        strongest = s.x;
+        strongestRetro = s.y;
+      }
+    }
+  }
+  if (last < 0.0)
+    last = first;
+
+  if (p.multiReturn > 0.5)
+    return float4(first, last, strongest, strongestRetro);
+
+  // single return formats report the first return of the beam
+  float range = first;
+  float retro = firstRetro;
+
+  if (p.pointCloud > 0.5)
+    return float4(rayDirection(faceIdx, uv) * range, retro);
+
+  // compact formats write all channels of a ray to a single texel
+  if (p.texelsPerRay < 2.0)
+    return float4(range * p.rangeScale, retro, 0, 1.0);
+
+  // output is packed as [range, retro, 0] triplets in a single channel
+  // texture 3 times as wide as cubeUVTex
+  float width = float(cubeUVTex.get_width());
+  float channel = floor(fract(inPs.uv0.x * width) * p.texelsPerRay);
 
-  float range = d.x;
-  float retro = d.y;
+  float value = 0.0;
+  if (channel == 0.0)
+    value = range;
+  else if (channel == 1.0)
+    value = retro;
 
-  float4 fragColor(range, retro, 0, 1.0);
+  float4 fragColor(value, 0, 0, 1.0);
   return fragColor;
 }
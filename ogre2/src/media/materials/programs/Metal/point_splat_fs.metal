@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float3 ptColor;
+};
+
+struct Params
+{
+};
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  float2 pointCoord [[point_coord]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  // round splats
+  float2 offset = pointCoord * 2.0 - 1.0;
+  if (dot(offset, offset) > 1.0)
+    discard_fragment();
+
+  return float4(inPs.ptColor, 1.0);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VS_INPUT
+{
+  float4 position [[attribute(VES_POSITION)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position  [[position]];
+  float  gl_PointSize [[point_size]];
+  float3 ptColor;
+};
+
+struct Params
+{
+  float4x4 worldView;
+  float4x4 projection;
+  float viewportHeight;
+  float size;
+  float attenuation;
+  float maxPixelSize;
+  float format;
+  float intensityMin;
+  float intensityMax;
+  float4 lowColor;
+  float4 highColor;
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+  float3 pos = input.position.xyz;
+
+  // points without a valid position, e.g. depth camera pixels without a
+  // return, are moved outside of the clip volume
+  if (any(isnan(pos)) || any(isinf(pos)))
+  {
+    outVs.gl_Position = float4(2.0, 2.0, 2.0, 1.0);
+    outVs.gl_PointSize = 1.0;
+    outVs.ptColor = float3(0.0);
+    return outVs;
+  }
+
+  float4 viewPos = p.worldView * float4(pos, 1.0);
+  outVs.gl_Position = p.projection * viewPos;
+
+  // attenuated sizes are in meters, converted with the vertical focal
+  // length in pixels. Orthographic projections have no perspective divide.
+  float pixelSize = p.size;
+  if (p.attenuation > 0.5)
+  {
+    float depth = p.projection[3][3] > 0.5 ? 1.0 : max(-viewPos.z, 1e-4);
+    pixelSize = p.size * 0.5 * p.projection[1][1] * p.viewportHeight / depth;
+  }
+  outVs.gl_PointSize = clamp(pixelSize, 1.0, p.maxPixelSize);
+
+  // the 4th component holds the bits of the color or the intensity
+  uint bits = as_type<uint>(input.position.w);
+  if (p.format < 0.5)
+  {
+    // PCF_PACKED_XYZRGBA: red in the first byte
+    outVs.ptColor = float3(uint3(bits, bits >> 8u, bits >> 16u) & 0xFFu) /
+        255.0;
+  }
+  else if (p.format < 1.5)
+  {
+    // PCF_XYZRGBA_FLOAT32: red in the highest byte
+    outVs.ptColor = float3(uint3(bits >> 24u, bits >> 16u, bits >> 8u) &
+        0xFFu) / 255.0;
+  }
+  else
+  {
+    // PCF_XYZI_FLOAT32
+    float t = clamp((input.position.w - p.intensityMin) /
+        max(p.intensityMax - p.intensityMin, 1e-6), 0.0, 1.0);
+    outVs.ptColor = mix(p.lowColor.rgb, p.highColor.rgb, t);
+  }
+
+  return outVs;
+}
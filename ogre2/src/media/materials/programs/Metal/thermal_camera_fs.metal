@@ -39,8 +39,21 @@ struct Params
   float ambient;
   int rgbToTemp;
   int bitDepth;
+  int colormap;
+  float colormapMin;
+  float colormapMax;
 };
 
+float3 colormapColor(float t)
+{
+  const float3 stops[6] = {
+      float3(0.0, 0.0, 0.0), float3(0.1, 0.0, 0.5), float3(0.6, 0.0, 0.6),
+      float3(0.95, 0.35, 0.0), float3(1.0, 0.85, 0.0), float3(1.0, 1.0, 1.0)};
+  float x = clamp(t, 0.0, 1.0) * 5.0;
+  int i = min(int(x), 4);
+  return mix(stops[i], stops[i + 1], x - float(i));
+}
+
 float getDepth(
   float2 uv,
   texture2d<float> depthTexture,
@@ -126,6 +139,13 @@ fragment float4 main_metal
   temp = temp - heatRange / 2.0 + delta;
   clamp(temp, p.min, p.max);
 
+  if (p.colormap == 1)
+  {
+    float t = (temp - p.colormapMin) /
+        max(p.colormapMax - p.colormapMin, 1e-6);
+    return float4(colormapColor(t), 1.0);
+  }
+
   // apply resolution factor
   temp /= p.resolution;
   // normalize
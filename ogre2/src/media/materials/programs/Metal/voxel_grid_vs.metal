@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VS_INPUT
+{
+  float4 position [[attribute(VES_POSITION)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position [[position]];
+  float3 faceColor;
+};
+
+struct Params
+{
+  float4x4 worldViewProj;
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+  outVs.gl_Position = p.worldViewProj * float4(input.position.xyz, 1.0);
+
+  // the 4th component holds the color, red in the first byte, and the
+  // face direction plus 64 in the highest byte. The faces are shaded with
+  // a fixed brightness per direction so that neighbouring cubes stand out
+  // without lights.
+  uint bits = as_type<uint>(input.position.w);
+  uint face = (bits >> 24u) - 64u;
+  float shade = face >= 4u ? (face == 4u ? 1.0 : 0.5) :
+      (face >= 2u ? 0.65 : 0.8);
+  outVs.faceColor = float3(uint3(bits, bits >> 8u, bits >> 16u) & 0xFFu) /
+      255.0 * shade;
+
+  return outVs;
+}
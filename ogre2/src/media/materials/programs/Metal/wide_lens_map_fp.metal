@@ -18,74 +18,23 @@
 #include <metal_stdlib>
 using namespace metal;
 
-struct Params
-{
-  float cutOffAngle;
-
-  // focal length
-  float f;
-
-  // linear scaling constant
-  float c1;
-
-  // angle scaling constant
-  float c2;
-
-  // angle offset constant
-  float c3;
-
-  // unit axis
-  // depends on the type of math function sin (X), tan (Y), or identity (Z)
-  float3 fun;
-};
-
 struct PS_INPUT
 {
-  float2 fragPos;
+  float2 uv0;
 };
 
-float3 map(float th, float2 fragPos, float r)
-{
-  // spherical to cartesian conversion
-  return float3(-sin(th)*fragPos.x/r, sin(th)*fragPos.y/r, cos(th));
-}
-
 fragment float4 main_metal
 (
   PS_INPUT inPs [[stage_in]],
   texturecube<float> envMap  [[texture(0)]],
-  sampler texSampler [[sampler(0)]],
-  constant Params &p [[buffer(PARAMETER_SLOT)]]
+  // direction to sample envMap with in xyz and weight of the pixel in w,
+  // baked from the lens mapping function by Ogre2WideAngleCamera
+  texture2d<float> lensMap  [[texture(1)]],
+  sampler texSampler [[sampler(0)]]
 )
 {
-  float4 fragColor;
-
-  float r = length(inPs.fragPos);
-  // calculate angle from optical axis based on the mapping function specified
-  float param = r/(p.c1*p.f);
-  float theta = 0.0;
-  if (p.fun.x > 0)
-    theta = asin(param);
-  else if (p.fun.y > 0)
-    theta = atan(param);
-  else if (p.fun.z > 0)
-    theta = param;
-  theta = (theta-p.c3)*p.c2;
-
-  // compute the direction vector that will be used to sample from the cubemap
-  float3 tc = map(theta, inPs.fragPos, r);
-
-  // sample and set resulting color
-  fragColor = float4(envMap.sample(texSampler, tc).rgb, 1);
-
-  // limit to visible fov
-  //TODO: move to vertex shader
-  float param2 = p.cutOffAngle/p.c2+p.c3;
-  float cutRadius = p.c1*p.f*(p.fun.x*sin(param2)+p.fun.y*tan(param2)+p.fun.z*param2);
-
-  // smooth edges
-  // gl_FragColor.rgb *= 1.0-step(cutRadius,r);
-  fragColor.rgb *= 1.0-smoothstep(cutRadius-0.02,cutRadius,r);
+  float4 lens = lensMap.sample(texSampler, inPs.uv0);
 
-  return fragColor;
+  // sample and set resulting color, limited to visible fov
+  return float4(envMap.sample(texSampler, lens.xyz).rgb * lens.w, 1);
 }
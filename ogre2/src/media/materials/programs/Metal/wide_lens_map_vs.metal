@@ -25,14 +25,12 @@ struct VS_INPUT
 
 struct Params
 {
-  // aspect ratio
-  float ratio;
   float4x4 worldViewProj;
 };
 
 struct PS_INPUT
 {
-  float2 fragPos;
+  float2 uv0;
   float4 gl_Position [[position]];
 };
 
@@ -46,8 +44,10 @@ vertex PS_INPUT main_metal
 
   outVs.gl_Position = p.worldViewProj * input.position;
 
-  // get normalized fragment coordinate (3D to 2D window space transformation)
-  outVs.fragPos = outVs.gl_Position.xy/outVs.gl_Position.w*float2(-1.0,1.0/p.ratio);
+  // lens map coordinate (3D to 2D window space transformation), flipped
+  // to match the other render systems
+  outVs.uv0 = outVs.gl_Position.xy/outVs.gl_Position.w*float2(0.5,-0.5) +
+      0.5;
 
   return outVs;
 }
@@ -212,6 +212,56 @@ namespace Ogre
         /// Marks all SetSolidColor as unset so that SolidColor throws
         /// if used again without setting.
         void UnsetSolidColors();
+
+        /// \brief Cells selected by update for a camera
+        struct CellSelection
+        {
+            /// \brief A selected cell
+            struct Cell
+            {
+                /// \brief Index of the cell, which decides its skirts
+                uint32 index;
+                GridPoint gridPos;
+                uint32 sizeX;
+                uint32 sizeZ;
+                uint32 lodLevel;
+            };
+
+            std::vector<Cell> cells;
+            size_t currentCell = 0u;
+        };
+
+        /// \brief Update the shadow map if the light direction changed,
+        /// without selecting the visible cells. See update
+        /// \param[in] lightDir Light direction for computing the shadow map
+        /// \param[in] lightEpsilon See update
+        void updateShadowMap( const Vector3 &lightDir,
+                              float lightEpsilon=1e-6f );
+
+        /// \brief Save the cells selected by the last update, so they can
+        /// be restored for the same camera without selecting them again
+        /// \param[out] selection Selected cells
+        void saveCellSelection( CellSelection &selection ) const;
+
+        /// \brief Restore cells saved with saveCellSelection. Replaces
+        /// the cell selection of update.
+        /// \param[in] selection Selected cells
+        void restoreCellSelection( const CellSelection &selection );
+
+        /// \brief Free the CPU copy of the heights once loaded, the GPU
+        /// keeps its own. getHeightAt fails afterwards.
+        void releaseHeightMapData();
+
+        /// \brief Get whether the CPU copy of the heights is available
+        /// \return False if not loaded or released with
+        /// releaseHeightMapData
+        bool hasHeightMapData() const { return !m_heightMap.empty(); }
+
+        /// \brief Get whether the last update or restoreCellSelection
+        /// selected any cell, i.e. whether the terrain is in the view of
+        /// the camera
+        /// \return True if cells are rendered
+        bool hasVisibleCells() const { return !mRenderables.empty(); }
         // GZ CUSTOMIZE END
 
         /** Must be called every frame so we can check the camera's position
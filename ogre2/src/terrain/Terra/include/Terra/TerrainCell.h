@@ -59,6 +59,14 @@ namespace Ogre
 
         bool getUseSkirts(void) const                   { return m_useSkirts; }
 
+        // GZ CUSTOMIZE BEGIN
+        int32 getGridX(void) const                      { return m_gridX; }
+        int32 getGridZ(void) const                      { return m_gridZ; }
+        uint32 getSizeX(void) const                     { return m_sizeX; }
+        uint32 getSizeZ(void) const                     { return m_sizeZ; }
+        uint32 getLodLevel(void) const                  { return m_lodLevel; }
+        // GZ CUSTOMIZE END
+
         bool isZUp( void ) const;
 
         void initialize( VaoManager *vaoManager, bool useSkirts );
@@ -576,9 +576,8 @@ namespace Ogre
       mSolidColorSet[0] = false;
       mSolidColorSet[1] = false;
     }
-    // GZ CUSTOMIZE END
     //-----------------------------------------------------------------------------------
-    void Terra::update( const Vector3 &lightDir, float lightEpsilon )
+    void Terra::updateShadowMap( const Vector3 &lightDir, float lightEpsilon )
     {
         const float lightCosAngleChange = Math::Clamp(
                     (float)m_prevLightDir.dotProduct( lightDir.normalisedCopy() ), -1.0f, 1.0f );
@@ -587,6 +586,52 @@ namespace Ogre
             m_shadowMapper->updateShadowMap( toYUp( lightDir ), m_xzDimensions, m_height );
             m_prevLightDir = lightDir.normalisedCopy();
         }
+    }
+    //-----------------------------------------------------------------------------------
+    void Terra::saveCellSelection( CellSelection &selection ) const
+    {
+        selection.cells.clear();
+        selection.cells.reserve( mRenderables.size() );
+        const TerrainCell *firstCell = m_terrainCells[0].data();
+        for( const Renderable *renderable : mRenderables )
+        {
+            const TerrainCell *cell = static_cast<const TerrainCell*>( renderable );
+            CellSelection::Cell saved;
+            saved.index = static_cast<uint32>( cell - firstCell );
+            saved.gridPos.x = cell->getGridX();
+            saved.gridPos.z = cell->getGridZ();
+            saved.sizeX = cell->getSizeX();
+            saved.sizeZ = cell->getSizeZ();
+            saved.lodLevel = cell->getLodLevel();
+            selection.cells.push_back( saved );
+        }
+        selection.currentCell = m_currentCell;
+    }
+    //-----------------------------------------------------------------------------------
+    void Terra::restoreCellSelection( const CellSelection &selection )
+    {
+        mRenderables.clear();
+        for( const CellSelection::Cell &saved : selection.cells )
+        {
+            // the sizes were already clamped to the terrain bounds
+            TerrainCell *cell = &m_terrainCells[0][saved.index];
+            cell->setOrigin( saved.gridPos, saved.sizeX, saved.sizeZ, saved.lodLevel );
+            mRenderables.push_back( cell );
+        }
+        m_currentCell = selection.currentCell;
+    }
+    //-----------------------------------------------------------------------------------
+    void Terra::releaseHeightMapData()
+    {
+        std::vector<float>().swap( m_heightMap );
+    }
+    // GZ CUSTOMIZE END
+    //-----------------------------------------------------------------------------------
+    void Terra::update( const Vector3 &lightDir, float lightEpsilon )
+    {
+        // GZ CUSTOMIZE BEGIN
+        updateShadowMap( lightDir, lightEpsilon );
+        // GZ CUSTOMIZE END
         //m_shadowMapper->updateShadowMap( Vector3::UNIT_X, m_xzDimensions, m_height );
         //m_shadowMapper->updateShadowMap( Vector3(2048,0,1024), m_xzDimensions, m_height );
         //m_shadowMapper->updateShadowMap( Vector3(1,0,0.1), m_xzDimensions, m_height );
@@ -779,6 +824,11 @@ namespace Ogre
     {
         bool retVal = false;
 
+        // GZ CUSTOMIZE BEGIN
+        if( m_heightMap.empty() )
+            return retVal;
+        // GZ CUSTOMIZE END
+
         Vector3 vPos = toYUp( vPosArg );
 
         GridPoint pos2D = worldToGrid( vPos );
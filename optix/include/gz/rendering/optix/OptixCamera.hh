@@ -18,6 +18,7 @@
 #define GZ_RENDERING_OPTIX_OPTIXCAMERA_HH_
 
 #include <string>
+#include <gz/math/Pose3.hh>
 #include "gz/rendering/base/BaseCamera.hh"
 #include "gz/rendering/optix/OptixRenderTypes.hh"
 #include "gz/rendering/optix/OptixSensor.hh"
@@ -45,6 +46,42 @@ namespace gz
 
       public: virtual void Render();
 
+      // Documentation inherited.
+      public: virtual void *RenderTextureCudaPointer() const override;
+
+      /// \brief Enable progressive sampling. Each Render traces one
+      /// jittered sample per pixel and averages it with the samples of the
+      /// previous renders, so the image converges while the camera stays
+      /// still. The samples are discarded when the camera moves or its
+      /// properties change. Changes to the rest of the scene are not
+      /// detected, call ResetProgressiveSampling after moving objects or
+      /// lights. Disabled by default.
+      /// \param[in] _enabled True to enable progressive sampling
+      public: void SetProgressiveSamplingEnabled(bool _enabled);
+
+      /// \brief Get whether progressive sampling is enabled
+      /// \return True if progressive sampling is enabled
+      public: bool ProgressiveSamplingEnabled() const;
+
+      /// \brief Set the number of samples after which a progressive image
+      /// is considered converged. Renders after that keep the image and
+      /// launch no rays.
+      /// \param[in] _samples Number of samples, 0 to never stop (default)
+      public: void SetMaxProgressiveSamples(unsigned int _samples);
+
+      /// \brief Get the number of samples after which a progressive image
+      /// is converged
+      /// \return Number of samples, 0 if sampling never stops
+      public: unsigned int MaxProgressiveSamples() const;
+
+      /// \brief Get the number of samples accumulated in the current image
+      /// \return Number of samples, 0 if progressive sampling is disabled
+      public: unsigned int ProgressiveSampleCount() const;
+
+      /// \brief Discard the accumulated samples, e.g. after the scene
+      /// changed
+      public: void ResetProgressiveSampling();
+
       protected: virtual RenderTargetPtr RenderTarget() const;
 
       protected: virtual void WriteCameraToDevice();
@@ -80,6 +117,16 @@ namespace gz
 
       protected: unsigned int clearId;
 
+      protected: optix::Buffer accumBuffer;
+
+      protected: bool progressive = false;
+
+      protected: unsigned int maxProgressiveSamples = 0u;
+
+      protected: unsigned int progressiveSamples = 0u;
+
+      protected: math::Pose3d progressivePose;
+
       private: static const std::string PTX_BASE_NAME;
 
       private: static const std::string PTX_RENDER_FUNCTION;
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OPTIX_OPTIXGPURAYS_HH_
+#define GZ_RENDERING_OPTIX_OPTIXGPURAYS_HH_
+
+#include <string>
+#include <vector>
+
+#include <gz/common/Event.hh>
+
+#include "gz/rendering/base/BaseGpuRays.hh"
+#include "gz/rendering/optix/OptixIncludes.hh"
+#include "gz/rendering/optix/OptixRenderTypes.hh"
+#include "gz/rendering/optix/OptixSensor.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief GpuRays that trace every beam of the configured pattern
+    /// directly, one ray per range, instead of resampling a rendered cube
+    /// map. The cost scales with RangeCount() * VerticalRangeCount().
+    /// The retro channel is always 0.
+    class GZ_RENDERING_OPTIX_VISIBLE OptixGpuRays :
+      public BaseGpuRays<OptixSensor>
+    {
+      protected: OptixGpuRays();
+
+      public: virtual ~OptixGpuRays();
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Render() override;
+
+      // Documentation inherited.
+      public: virtual void PostRender() override;
+
+      // Documentation inherited.
+      public: virtual bool HasConnections() const override;
+
+      // Documentation inherited.
+      public: virtual const float *Data() const override;
+
+      // Documentation inherited.
+      public: virtual void Copy(float *_data) override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewGpuRaysFrame(
+                  std::function<void(const float *_frame, unsigned int _width,
+                  unsigned int _height, unsigned int _channels,
+                  const std::string &_format)> _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual RenderTargetPtr RenderTarget() const override;
+
+      protected: virtual void Init() override;
+
+      protected: virtual void CreateRenderProgram();
+
+      protected: virtual void WriteSensorToDevice();
+
+      protected: optix::Program optixRenderProgram;
+
+      protected: OptixRenderTexturePtr renderTexture;
+
+      protected: unsigned int traceId;
+
+      /// \brief Ranges of the last scan, 3 floats per range
+      protected: std::vector<float> scan;
+
+      /// \brief Event used to emit the ranges of every scan
+      protected: common::EventT<void(const float *,
+                     unsigned int, unsigned int, unsigned int,
+                     const std::string &)> newGpuRaysFrame;
+
+      private: static const std::string PTX_BASE_NAME;
+
+      private: static const std::string PTX_RENDER_FUNCTION;
+
+      private: friend class OptixScene;
+    };
+    }
+  }
+}
+#endif
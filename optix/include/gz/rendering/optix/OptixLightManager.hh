@@ -47,15 +47,33 @@ namespace gz
 
       public: virtual void Clear();
 
+      /// \brief Set the number of point lights sampled per hit. Scenes
+      /// with more point lights than this pick them in proportion to their
+      /// power, instead of shading every one of them.
+      /// \param[in] _count Number of samples, 0 to always shade every light
+      public: virtual void SetMaxPointLightSamples(unsigned int _count);
+
+      /// \brief Get the number of point lights sampled per hit
+      /// \return Number of samples, 0 if every light is shaded
+      public: virtual unsigned int MaxPointLightSamples() const;
+
       protected: virtual void WriteDirectionalBuffer();
 
       protected: virtual void WritePointBuffer();
 
       protected: virtual void WriteSpotBuffer();
 
+      /// \brief Upload the point light alias table
+      protected: virtual void WritePointAliasBuffer();
+
+      /// \brief Upload light data, unless it is the same as last time
+      /// \param[in] _buffer Device buffer
+      /// \param[in] _data Data to upload
+      /// \param[in,out] _uploaded Data uploaded last time
+      /// \return True if the data was uploaded
       protected: template <class T>
-                 void WriteBuffer(optix::Buffer _buffer,
-                     const std::vector<T> &_data);
+                 bool WriteBuffer(optix::Buffer _buffer,
+                     const std::vector<T> &_data, std::vector<T> &_uploaded);
 
       private: void CreateBuffers();
 
@@ -75,6 +93,21 @@ namespace gz
       protected: optix::Buffer pointBuffer;
 
       protected: optix::Buffer spotBuffer;
+
+      /// \brief Alias table of the point lights, by power
+      protected: optix::Buffer pointAliasBuffer;
+
+      /// \brief Directional light data uploaded last time
+      private: std::vector<OptixDirectionalLightData> uploadedDirectionalData;
+
+      /// \brief Point light data uploaded last time
+      private: std::vector<OptixPointLightData> uploadedPointData;
+
+      /// \brief Spot light data uploaded last time
+      private: std::vector<OptixSpotLightData> uploadedSpotData;
+
+      /// \brief Number of point lights sampled per hit
+      private: unsigned int maxPointLightSamples = 16u;
     };
     }
   }
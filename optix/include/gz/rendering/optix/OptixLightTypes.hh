@@ -91,6 +91,23 @@ namespace gz
     OptixLightSpot spot;
   };
 
+  /// \brief Entry of an alias table used to pick lights in proportion to
+  /// their power
+  struct OptixLightAliasData
+  {
+    /// \brief Probability of keeping this entry rather than its alias
+    // cppcheck-suppress unusedStructMember
+    float probability;
+
+    /// \brief Index of the light picked otherwise
+    // cppcheck-suppress unusedStructMember
+    unsigned int alias;
+
+    /// \brief Probability of picking the light of this entry
+    // cppcheck-suppress unusedStructMember
+    float pdf;
+  };
+
 #ifndef __CUDA_ARCH__
   }
   }
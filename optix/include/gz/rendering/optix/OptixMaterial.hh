@@ -141,6 +141,8 @@ namespace gz
 
       private: static const std::string PTX_ANY_HIT_FUNC;
 
+      private: static const std::string PTX_RANGE_CLOSEST_HIT_FUNC;
+
       private: friend class OptixScene;
     };
     }
@@ -65,6 +65,10 @@ namespace gz
 
       protected: virtual void WritePoseToDeviceImpl();
 
+      /// \brief Mark the acceleration of this node and of all its ancestors
+      /// for rebuild, e.g. after the bounds of its subtree changed
+      protected: void MarkAccelDirty();
+
       protected: virtual void SetParent(OptixNodePtr _parent);
 
       protected: virtual void Init() override;
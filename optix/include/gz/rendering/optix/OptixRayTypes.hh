@@ -32,7 +32,8 @@ namespace gz
   {
     RT_RADIANCE = 0,
     RT_SHADOW   = 1,
-    RT_COUNT    = 2,
+    RT_RANGE    = 2,
+    RT_COUNT    = 3,
   } OptixRayType;
 
   struct OptixRadianceRayData
@@ -49,6 +50,13 @@ namespace gz
     float3 attenuation;
   };
 
+  struct OptixRangeRayData
+  {
+    float range;
+    // cppcheck-suppress unusedStructMember
+    float retro;
+  };
+
 #ifndef __CUDA_ARCH__
   }
   }
@@ -55,6 +55,9 @@ namespace gz
 
       public: virtual optix::Buffer OptixBuffer() const;
 
+      // Documentation inherited.
+      public: virtual void *CudaDevicePointer() const override;
+
       protected: virtual void RebuildImpl();
 
       protected: optix::Buffer optixBuffer;
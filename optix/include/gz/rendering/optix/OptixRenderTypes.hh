@@ -33,6 +33,7 @@ namespace gz
     class OptixCylinder;
     class OptixDirectionalLight;
     class OptixGeometry;
+    class OptixGpuRays;
     class OptixGrid;
     class OptixJointVisual;
     class OptixLight;
@@ -49,6 +50,7 @@ namespace gz
     class OptixSphere;
     class OptixSpotLight;
     class OptixSubMesh;
+    class OptixTextureFactory;
     class OptixVisual;
     class OptixRenderTarget;
     class OptixRenderTexture;
@@ -72,6 +74,7 @@ namespace gz
     typedef shared_ptr<OptixCylinder>             OptixCylinderPtr;
     typedef shared_ptr<OptixDirectionalLight>     OptixDirectionalLightPtr;
     typedef shared_ptr<OptixGeometry>             OptixGeometryPtr;
+    typedef shared_ptr<OptixGpuRays>              OptixGpuRaysPtr;
     typedef shared_ptr<OptixGrid>                 OptixGridPtr;
     typedef shared_ptr<OptixJointVisual>          OptixJointVisualPtr;
     typedef shared_ptr<OptixLight>                OptixLightPtr;
@@ -87,6 +90,7 @@ namespace gz
     typedef shared_ptr<OptixSphere>               OptixSpherePtr;
     typedef shared_ptr<OptixSpotLight>            OptixSpotLightPtr;
     typedef shared_ptr<OptixSubMesh>              OptixSubMeshPtr;
+    typedef shared_ptr<OptixTextureFactory>       OptixTextureFactoryPtr;
     typedef shared_ptr<OptixVisual>               OptixVisualPtr;
     typedef shared_ptr<OptixSceneStore>           OptixSceneStorePtr;
     typedef shared_ptr<OptixNodeStore>            OptixNodeStorePtr;
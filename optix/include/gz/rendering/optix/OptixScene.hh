@@ -59,6 +59,9 @@ namespace gz
 
       public: virtual void PreRender();
 
+      // Documentation inherited.
+      public: virtual void SetPreRenderDirtyTracking(bool _enabled);
+
       public: virtual void Clear();
 
       public: virtual void Destroy();
@@ -67,6 +70,11 @@ namespace gz
 
       public: virtual optix::Context OptixContext() const;
 
+      /// \brief Get the factory that creates and caches the textures of
+      /// the materials of this scene
+      /// \return Texture factory
+      public: virtual OptixTextureFactoryPtr TextureFactory() const;
+
       public: virtual optix::Program CreateOptixProgram(
                   const std::string &_fileBase, const std::string &_function);
 
@@ -90,6 +98,10 @@ namespace gz
       protected: virtual DepthCameraPtr CreateDepthCameraImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual GpuRaysPtr CreateGpuRaysImpl(unsigned int _id,
+                     const std::string &_name) override;
+
       protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
                      const std::string &_name);
 
@@ -158,6 +170,8 @@ namespace gz
 
       private: void CreateMeshFactory();
 
+      private: void CreateTextureFactory();
+
       private: void CreateStores();
 
       private: OptixScenePtr SharedThis();
@@ -168,6 +182,8 @@ namespace gz
 
       protected: OptixMeshFactoryPtr meshFactory;
 
+      protected: OptixTextureFactoryPtr textureFactory;
+
       protected: OptixLightStorePtr lights;
 
       protected: OptixSensorStorePtr sensors;
@@ -17,7 +17,10 @@
 #ifndef GZ_RENDERING_OPTIX_OPTIXTEXTUREFACTORY_HH_
 #define GZ_RENDERING_OPTIX_OPTIXTEXTUREFACTORY_HH_
 
+#include <memory>
 #include <string>
+#include <vector>
+#include <gz/utils/SuppressWarning.hh>
 #include "gz/rendering/optix/OptixRenderTypes.hh"
 #include "gz/rendering/optix/OptixIncludes.hh"
 #include "gz/rendering/optix/Export.hh"
@@ -28,14 +31,33 @@ namespace gz
   {
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
+    // forward declaration
+    class OptixTextureFactoryPrivate;
+
+    /// \brief Creates texture samplers of image files. Buffers are cached
+    /// by filename and modification time, so materials that use the same
+    /// image share a single device buffer. See OptixScene::TextureFactory.
     class GZ_RENDERING_OPTIX_VISIBLE OptixTextureFactory
     {
       public: explicit OptixTextureFactory(OptixScenePtr _scene);
 
       public: virtual ~OptixTextureFactory();
 
+      /// \brief Create a texture sampler of an image file. The image is
+      /// decoded, unless it is cached or was preloaded.
+      /// \param[in] _filename Path to the image file
+      /// \return Texture sampler, of an empty texture if loading fails
       public: optix::TextureSampler Create(const std::string &_filename);
 
+      /// \brief Start decoding image files in the background, so a later
+      /// Create only uploads them. Files that are cached are skipped.
+      /// \param[in] _filenames Paths to the image files
+      public: void Preload(const std::vector<std::string> &_filenames);
+
+      /// \brief Forget the cached buffers. Samplers created earlier keep
+      /// their buffer.
+      public: void Clear();
+
       public: optix::TextureSampler Create();
 
       protected: optix::Buffer CreateBuffer(const std::string &_filename);
@@ -45,6 +67,11 @@ namespace gz
       protected: optix::TextureSampler CreateSampler(optix::Buffer _buffer);
 
       protected: OptixScenePtr scene;
+
+      /// \brief Private data pointer
+      GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+      private: std::unique_ptr<OptixTextureFactoryPrivate> dataPtr;
+      GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
     };
     }
   }
@@ -54,6 +54,12 @@ namespace gz
 
       protected: OptixGeometryStorePtr geometries;
 
+      /// \brief World scale last applied to the geometries
+      private: math::Vector3d geometryScale = math::Vector3d::One;
+
+      /// \brief True if the geometries need the world scale applied
+      private: bool geometryScaleDirty = true;
+
       private: friend class OptixScene;
     };
     }
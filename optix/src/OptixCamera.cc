@@ -82,8 +82,84 @@ void OptixCamera::Render()
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
   optix::Context optixContext = this->scene->OptixContext();
-  optixContext->launch(this->clearId, width, height);
+
+  if (!this->progressive)
+  {
+    optixContext->launch(this->clearId, width, height);
+    optixContext->launch(this->traceId, width, height);
+    return;
+  }
+
+  // start over if the image was resized or the camera moved with its parent
+  RTsize accumWidth = 0u;
+  RTsize accumHeight = 0u;
+  this->accumBuffer->getSize(accumWidth, accumHeight);
+  if (accumWidth != width || accumHeight != height)
+  {
+    this->accumBuffer->setSize(width, height);
+    this->progressiveSamples = 0u;
+  }
+  if (this->WorldPose() != this->progressivePose)
+  {
+    this->progressivePose = this->WorldPose();
+    this->progressiveSamples = 0u;
+  }
+
+  // a converged image stays in the output buffer
+  if (this->maxProgressiveSamples > 0u &&
+      this->progressiveSamples >= this->maxProgressiveSamples)
+  {
+    return;
+  }
+
+  this->optixRenderProgram["frameIndex"]->setUint(this->progressiveSamples);
   optixContext->launch(this->traceId, width, height);
+  ++this->progressiveSamples;
+}
+
+//////////////////////////////////////////////////
+void OptixCamera::SetProgressiveSamplingEnabled(bool _enabled)
+{
+  if (this->progressive == _enabled)
+    return;
+
+  this->progressive = _enabled;
+  this->progressiveSamples = 0u;
+  this->optixRenderProgram["progressive"]->setUint(_enabled ? 1u : 0u);
+
+  // keep the accumulation buffer small while it is not used
+  if (!_enabled)
+    this->accumBuffer->setSize(1u, 1u);
+}
+
+//////////////////////////////////////////////////
+bool OptixCamera::ProgressiveSamplingEnabled() const
+{
+  return this->progressive;
+}
+
+//////////////////////////////////////////////////
+void OptixCamera::SetMaxProgressiveSamples(unsigned int _samples)
+{
+  this->maxProgressiveSamples = _samples;
+}
+
+//////////////////////////////////////////////////
+unsigned int OptixCamera::MaxProgressiveSamples() const
+{
+  return this->maxProgressiveSamples;
+}
+
+//////////////////////////////////////////////////
+unsigned int OptixCamera::ProgressiveSampleCount() const
+{
+  return this->progressive ? this->progressiveSamples : 0u;
+}
+
+//////////////////////////////////////////////////
+void OptixCamera::ResetProgressiveSampling()
+{
+  this->progressiveSamples = 0u;
 }
 
 //////////////////////////////////////////////////
@@ -92,6 +168,15 @@ RenderTargetPtr OptixCamera::RenderTarget() const
   return this->renderTexture;
 }
 
+//////////////////////////////////////////////////
+void *OptixCamera::RenderTextureCudaPointer() const
+{
+  if (!this->renderTexture)
+    return nullptr;
+
+  return this->renderTexture->CudaDevicePointer();
+}
+
 //////////////////////////////////////////////////
 void OptixCamera::WriteCameraToDevice()
 {
@@ -106,6 +191,7 @@ void OptixCamera::WriteCameraToDevice()
 void OptixCamera::WriteCameraToDeviceImpl()
 {
   this->optixRenderProgram["aa"]->setUint(this->AntiAliasing() + 1u);
+  this->progressiveSamples = 0u;
 }
 
 //////////////////////////////////////////////////
@@ -131,6 +217,7 @@ void OptixCamera::WritePoseToDeviceImpl()
   this->optixRenderProgram["u"]->setFloat(u);
   this->optixRenderProgram["v"]->setFloat(v);
   this->optixRenderProgram["w"]->setFloat(w);
+  this->progressiveSamples = 0u;
 }
 
 //////////////////////////////////////////////////
@@ -176,6 +263,13 @@ void OptixCamera::CreateRenderProgram()
 
   optix::Buffer optixBuffer = this->renderTexture->OptixBuffer();
   this->optixRenderProgram["buffer"]->setBuffer(optixBuffer);
+
+  // running sum of the progressive samples, resized when enabled
+  this->accumBuffer = optixContext->createBuffer(RT_BUFFER_INPUT_OUTPUT,
+      RT_FORMAT_FLOAT3, 1u, 1u);
+  this->optixRenderProgram["accumBuffer"]->setBuffer(this->accumBuffer);
+  this->optixRenderProgram["progressive"]->setUint(0u);
+  this->optixRenderProgram["frameIndex"]->setUint(0u);
 }
 
 //////////////////////////////////////////////////
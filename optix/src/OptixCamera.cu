@@ -26,6 +26,11 @@ rtDeclareVariable(float3,   w, , );
 rtDeclareVariable(uint,    aa, , );
 rtBuffer<float3, 2> buffer;
 
+// progressive sampling variables
+rtDeclareVariable(uint, progressive, , );
+rtDeclareVariable(uint, frameIndex, , );
+rtBuffer<float3, 2> accumBuffer;
+
 // current ray variables
 rtDeclareVariable(uint2, launchIndex, rtLaunchIndex, );
 rtDeclareVariable(uint2, launchDim, rtLaunchDim, );
@@ -143,9 +148,62 @@ static __inline__ __device__ void RenderNoAA()
   buffer[launchIndex] = data.color;
 }
 
+// tiny encryption algorithm, used to seed the per-pixel jitter
+static __inline__ __device__ uint Tea(uint _v0, uint _v1)
+{
+  uint sum = 0;
+  for (uint i = 0; i < 4; ++i)
+  {
+    sum += 0x9e3779b9;
+    _v0 += ((_v1 << 4) + 0xa341316c) ^ (_v1 + sum) ^ ((_v1 >> 5) + 0xc8013ea4);
+    _v1 += ((_v0 << 4) + 0xad90777d) ^ (_v0 + sum) ^ ((_v0 >> 5) + 0x7e95761e);
+  }
+  return _v0;
+}
+
+// random float in [0, 1) from a linear congruential generator
+static __inline__ __device__ float Rnd(uint &_seed)
+{
+  _seed = 1664525u * _seed + 1013904223u;
+  return static_cast<float>(_seed & 0x00FFFFFF) / 0x01000000;
+}
+
+static __inline__ __device__ void RenderProgressive()
+{
+  // jitter the sample within the pixel, differently for every frame
+  uint seed = Tea(launchIndex.y * launchDim.x + launchIndex.x, frameIndex);
+  float2 jitter = make_float2(Rnd(seed), Rnd(seed));
+
+  // get image plane intersect point
+  float2 pixel = make_float2(launchIndex) + jitter;
+  float2 size  = make_float2(launchDim);
+  float2 ratio = pixel / size - 0.5;
+
+  // create ray that traverses through image plane point
+  float3 direction = normalize(ratio.x * u + ratio.y * v + w);
+  optix::Ray ray(eye, direction, RT_RADIANCE, sceneEpsilon);
+
+  // initialize ray payload
+  OptixRadianceRayData data;
+  data.color = make_float3(0, 0, 0);
+  data.importance = 1;
+  data.depth = 0;
+
+  // accumulate the sample and write the average
+  rtTrace(rootGroup, ray, data);
+  float3 sum = (frameIndex == 0) ? data.color :
+      accumBuffer[launchIndex] + data.color;
+  accumBuffer[launchIndex] = sum;
+  buffer[launchIndex] = sum / static_cast<float>(frameIndex + 1);
+}
+
 RT_PROGRAM void Render()
 {
-  if (aa > 1)
+  if (progressive)
+  {
+    RenderProgressive();
+  }
+  else if (aa > 1)
   {
     RenderAA();
   }
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "gz/rendering/optix/OptixGpuRays.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include <gz/math/Matrix3.hh>
+
+#include "gz/rendering/optix/OptixRenderTarget.hh"
+#include "gz/rendering/optix/OptixScene.hh"
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+
+const std::string OptixGpuRays::PTX_BASE_NAME("OptixGpuRays");
+
+const std::string OptixGpuRays::PTX_RENDER_FUNCTION("Render");
+
+//////////////////////////////////////////////////
+OptixGpuRays::OptixGpuRays() :
+  optixRenderProgram(nullptr),
+  renderTexture(nullptr),
+  traceId(0)
+{
+  // r = range, g = retro, and b = n/a
+  this->channels = 3u;
+}
+
+//////////////////////////////////////////////////
+OptixGpuRays::~OptixGpuRays()
+{
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::PreRender()
+{
+  // one output texel per traced beam
+  this->renderTexture->SetWidth(
+      static_cast<unsigned int>(std::max(this->RangeCount(), 1)));
+  this->renderTexture->SetHeight(
+      static_cast<unsigned int>(std::max(this->VerticalRangeCount(), 1)));
+
+  BaseGpuRays::PreRender();
+  this->WriteSensorToDevice();
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::Render()
+{
+  optix::Context optixContext = this->scene->OptixContext();
+  optixContext->launch(this->traceId, this->renderTexture->Width(),
+      this->renderTexture->Height());
+}
+
+//////////////////////////////////////////////////
+bool OptixGpuRays::HasConnections() const
+{
+  return this->newGpuRaysFrame.ConnectionCount() > 0u ||
+      BaseGpuRays::HasConnections();
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::PostRender()
+{
+  BaseGpuRays::PostRender();
+
+  unsigned int width = this->renderTexture->Width();
+  unsigned int height = this->renderTexture->Height();
+  unsigned int count = width * height * this->Channels();
+  this->scan.resize(count);
+
+  // the output buffer already holds range, retro and 0 for every beam
+  optix::Buffer buffer = this->renderTexture->OptixBuffer();
+  const float *deviceData = static_cast<const float *>(buffer->map());
+  std::memcpy(this->scan.data(), deviceData, count * sizeof(float));
+  buffer->unmap();
+
+  this->newGpuRaysFrame(this->scan.data(), width, height, this->Channels(),
+      "PF_FLOAT32_RGB");
+}
+
+//////////////////////////////////////////////////
+const float *OptixGpuRays::Data() const
+{
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
+  return this->scan.empty() ? nullptr : this->scan.data();
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::Copy(float *_data)
+{
+  // polled sensors stay active when demand driven
+  this->captureRequested = true;
+  std::copy(this->scan.begin(), this->scan.end(), _data);
+}
+
+//////////////////////////////////////////////////
+common::ConnectionPtr OptixGpuRays::ConnectNewGpuRaysFrame(
+    std::function<void(const float *_frame, unsigned int _width,
+    unsigned int _height, unsigned int _channels,
+    const std::string &/*_format*/)> _subscriber)
+{
+  return this->newGpuRaysFrame.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+RenderTargetPtr OptixGpuRays::RenderTarget() const
+{
+  return this->renderTexture;
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::Init()
+{
+  BaseGpuRays::Init();
+
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->renderTexture = std::dynamic_pointer_cast<OptixRenderTexture>(base);
+  this->renderTexture->SetFormat(PF_FLOAT32_RGB);
+
+  this->CreateRenderProgram();
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::CreateRenderProgram()
+{
+  this->optixRenderProgram =
+      this->scene->CreateOptixProgram(PTX_BASE_NAME, PTX_RENDER_FUNCTION);
+
+  optix::Context optixContext = this->scene->OptixContext();
+
+  optixContext->setRayGenerationProgram(this->traceId,
+      this->optixRenderProgram);
+
+  optix::Buffer optixBuffer = this->renderTexture->OptixBuffer();
+  this->optixRenderProgram["buffer"]->setBuffer(optixBuffer);
+}
+
+//////////////////////////////////////////////////
+void OptixGpuRays::WriteSensorToDevice()
+{
+  // the beams are defined in the sensor frame: x forward, y left, z up
+  math::Pose3d worldPose = this->WorldPose();
+  math::Vector3d pos = worldPose.Pos();
+  math::Matrix3d rot(worldPose.Rot());
+
+  this->optixRenderProgram["eye"]->setFloat(pos.X(), pos.Y(), pos.Z());
+  this->optixRenderProgram["forward"]->setFloat(
+      rot(0, 0), rot(1, 0), rot(2, 0));
+  this->optixRenderProgram["left"]->setFloat(
+      rot(0, 1), rot(1, 1), rot(2, 1));
+  this->optixRenderProgram["up"]->setFloat(
+      rot(0, 2), rot(1, 2), rot(2, 2));
+
+  this->optixRenderProgram["hAngles"]->setFloat(
+      this->AngleMin().Radian(), this->AngleMax().Radian());
+
+  // a purely horizontal scanner has a single row at zero pitch
+  if (this->VerticalRangeCount() > 1)
+  {
+    this->optixRenderProgram["vAngles"]->setFloat(
+        this->VerticalAngleMin().Radian(), this->VerticalAngleMax().Radian());
+  }
+  else
+  {
+    this->optixRenderProgram["vAngles"]->setFloat(
+        this->VerticalAngleMin().Radian(), this->VerticalAngleMin().Radian());
+  }
+
+  this->optixRenderProgram["nearClip"]->setFloat(this->NearClipPlane());
+  this->optixRenderProgram["farClip"]->setFloat(this->FarClipPlane());
+  this->optixRenderProgram["minVal"]->setFloat(this->dataMinVal);
+  this->optixRenderProgram["maxVal"]->setFloat(this->dataMaxVal);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <optix.h>
+#include <optix_math.h>
+#include <gz/rendering/optix/OptixRayTypes.hh>
+
+// sensor variables
+rtDeclareVariable(float3,     eye, , );
+rtDeclareVariable(float3, forward, , );
+rtDeclareVariable(float3,    left, , );
+rtDeclareVariable(float3,      up, , );
+rtDeclareVariable(float2, hAngles, , );
+rtDeclareVariable(float2, vAngles, , );
+rtDeclareVariable(float, nearClip, , );
+rtDeclareVariable(float,  farClip, , );
+rtDeclareVariable(float,   minVal, , );
+rtDeclareVariable(float,   maxVal, , );
+rtBuffer<float3, 2> buffer;
+
+// current ray variables
+rtDeclareVariable(uint2, launchIndex, rtLaunchIndex, );
+rtDeclareVariable(uint2, launchDim, rtLaunchDim, );
+
+// scene variables
+rtDeclareVariable(rtObject, rootGroup, , );
+rtDeclareVariable(float, sceneEpsilon, , );
+
+static __inline__ __device__ float BeamAngle(const float2 &_range,
+    unsigned int _index, unsigned int _count)
+{
+  if (_count < 2)
+    return _range.x;
+
+  return _range.x + (_range.y - _range.x) * _index / (_count - 1);
+}
+
+RT_PROGRAM void Render()
+{
+  // beams are spread evenly from the min to the max angles, column 0 and
+  // row 0 being the min angles
+  float yaw = BeamAngle(hAngles, launchIndex.x, launchDim.x);
+  float pitch = BeamAngle(vAngles, launchIndex.y, launchDim.y);
+
+  float3 direction = normalize(cosf(pitch) *
+      (cosf(yaw) * forward + sinf(yaw) * left) + sinf(pitch) * up);
+  optix::Ray ray(eye, direction, RT_RANGE, sceneEpsilon, farClip);
+
+  // initialize ray payload, a miss leaves the range at infinity
+  OptixRangeRayData data;
+  data.range = RT_DEFAULT_MAX;
+  data.retro = 0;
+
+  rtTrace(rootGroup, ray, data);
+
+  float range = data.range;
+  if (range < nearClip)
+    range = minVal;
+  else if (range > farClip)
+    range = maxVal;
+
+  buffer[launchIndex] = make_float3(range, data.retro, 0);
+}
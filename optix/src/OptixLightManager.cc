@@ -16,6 +16,9 @@
  */
 #include "gz/rendering/optix/OptixLightManager.hh"
 
+#include <algorithm>
+#include <cstring>
+
 #include "gz/rendering/optix/OptixLight.hh"
 #include "gz/rendering/optix/OptixScene.hh"
 #include "gz/rendering/optix/OptixVisual.hh"
@@ -28,6 +31,7 @@ OptixLightManager::OptixLightManager(OptixScenePtr _scene) :
   scene(_scene)
 {
   this->CreateBuffers();
+  this->SetMaxPointLightSamples(this->maxPointLightSamples);
 }
 
 //////////////////////////////////////////////////
@@ -69,34 +73,131 @@ void OptixLightManager::Clear()
   spotData.clear();
 }
 
+//////////////////////////////////////////////////
+void OptixLightManager::SetMaxPointLightSamples(unsigned int _count)
+{
+  this->maxPointLightSamples = _count;
+  optix::Context optixContext = this->scene->OptixContext();
+  optixContext["maxPointLightSamples"]->setUint(_count);
+}
+
+//////////////////////////////////////////////////
+unsigned int OptixLightManager::MaxPointLightSamples() const
+{
+  return this->maxPointLightSamples;
+}
+
 //////////////////////////////////////////////////
 void OptixLightManager::WriteDirectionalBuffer()
 {
   this->WriteBuffer<OptixDirectionalLightData>(this->directionalBuffer,
-      this->directionalData);
+      this->directionalData, this->uploadedDirectionalData);
 }
 
 //////////////////////////////////////////////////
 void OptixLightManager::WritePointBuffer()
 {
-  this->WriteBuffer<OptixPointLightData>(this->pointBuffer, this->pointData);
+  if (this->WriteBuffer<OptixPointLightData>(this->pointBuffer,
+      this->pointData, this->uploadedPointData))
+  {
+    this->WritePointAliasBuffer();
+  }
 }
 
 //////////////////////////////////////////////////
 void OptixLightManager::WriteSpotBuffer()
 {
-  this->WriteBuffer<OptixSpotLightData>(this->spotBuffer, this->spotData);
+  this->WriteBuffer<OptixSpotLightData>(this->spotBuffer, this->spotData,
+      this->uploadedSpotData);
+}
+
+//////////////////////////////////////////////////
+void OptixLightManager::WritePointAliasBuffer()
+{
+  // Vose's alias method: picking an entry uniformly, then keeping it or
+  // taking its alias, picks each light in proportion to its power
+  const size_t count = this->pointData.size();
+  std::vector<double> weights(count);
+  double total = 0.0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float4 &color = this->pointData[i].common.color.diffuse;
+    weights[i] = std::max(0.0,
+        0.2126 * color.x + 0.7152 * color.y + 0.0722 * color.z);
+    total += weights[i];
+  }
+  if (total <= 0.0)
+  {
+    std::fill(weights.begin(), weights.end(), 1.0);
+    total = static_cast<double>(count);
+  }
+
+  std::vector<OptixLightAliasData> table(count);
+  std::vector<double> scaled(count);
+  std::vector<unsigned int> small;
+  std::vector<unsigned int> large;
+  for (size_t i = 0; i < count; ++i)
+  {
+    table[i].pdf = static_cast<float>(weights[i] / total);
+    table[i].alias = static_cast<unsigned int>(i);
+    scaled[i] = weights[i] * count / total;
+    if (scaled[i] < 1.0)
+      small.push_back(static_cast<unsigned int>(i));
+    else
+      large.push_back(static_cast<unsigned int>(i));
+  }
+
+  while (!small.empty() && !large.empty())
+  {
+    unsigned int less = small.back();
+    small.pop_back();
+    unsigned int more = large.back();
+    table[less].probability = static_cast<float>(scaled[less]);
+    table[less].alias = more;
+    scaled[more] += scaled[less] - 1.0;
+    if (scaled[more] < 1.0)
+    {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+
+  // whatever is left is only off by rounding errors
+  for (unsigned int i : small)
+    table[i].probability = 1.0f;
+  for (unsigned int i : large)
+    table[i].probability = 1.0f;
+
+  this->pointAliasBuffer->setSize(count);
+  if (count > 0u)
+  {
+    std::memcpy(this->pointAliasBuffer->map(), table.data(),
+        sizeof(OptixLightAliasData) * count);
+    this->pointAliasBuffer->unmap();
+  }
 }
 
 //////////////////////////////////////////////////
 template <class T>
-void OptixLightManager::WriteBuffer(optix::Buffer _buffer,
-    const std::vector<T> &_data)
+bool OptixLightManager::WriteBuffer(optix::Buffer _buffer,
+    const std::vector<T> &_data, std::vector<T> &_uploaded)
 {
-  _buffer->setSize(_data.size());
+  // lights are added again every frame, but rarely change
   unsigned int memSize = sizeof(T) * _data.size();
-  std::memcpy(_buffer->map(), &_data[0], memSize);
-  _buffer->unmap();
+  if (_data.size() == _uploaded.size() && (_data.empty() ||
+      std::memcmp(_data.data(), _uploaded.data(), memSize) == 0))
+  {
+    return false;
+  }
+
+  _buffer->setSize(_data.size());
+  if (!_data.empty())
+  {
+    std::memcpy(_buffer->map(), _data.data(), memSize);
+    _buffer->unmap();
+  }
+  _uploaded = _data;
+  return true;
 }
 
 //////////////////////////////////////////////////
@@ -107,6 +208,8 @@ void OptixLightManager::CreateBuffers()
 
   this->pointBuffer = this->CreateBuffer<OptixPointLightData>("pointLights");
   this->spotBuffer = this->CreateBuffer<OptixSpotLightData>("spotLights");
+  this->pointAliasBuffer =
+      this->CreateBuffer<OptixLightAliasData>("pointLightAlias");
 }
 
 //////////////////////////////////////////////////
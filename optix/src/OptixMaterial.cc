@@ -32,6 +32,8 @@ const std::string OptixMaterial::PTX_CLOSEST_HIT_FUNC("ClosestHit");
 
 const std::string OptixMaterial::PTX_ANY_HIT_FUNC("AnyHit");
 
+const std::string OptixMaterial::PTX_RANGE_CLOSEST_HIT_FUNC("RangeClosestHit");
+
 //////////////////////////////////////////////////
 OptixMaterial::OptixMaterial() :
   optixMaterial(nullptr),
@@ -212,6 +214,7 @@ void OptixMaterial::SetTexture(const std::string &_name)
   {
     this->textureName = _name;
     this->textureDirty = true;
+    this->scene->TextureFactory()->Preload({_name});
   }
 }
 
@@ -248,6 +251,7 @@ void OptixMaterial::SetNormalMap(const std::string &_name)
   {
     this->normalMapName = _name;
     this->normalMapDirty = true;
+    this->scene->TextureFactory()->Preload({_name});
   }
 }
 
@@ -372,8 +376,8 @@ void OptixMaterial::WriteTextureToDeviceImpl()
   }
   else
   {
-    OptixTextureFactory texFactory(this->scene);
-    this->optixTexture = texFactory.Create(this->textureName);
+    this->optixTexture =
+        this->scene->TextureFactory()->Create(this->textureName);
     this->optixMaterial["texSampler"]->setTextureSampler(this->optixTexture);
   }
 }
@@ -394,8 +398,8 @@ void OptixMaterial::WriteNormalMapToDeviceImpl()
   }
   else
   {
-    OptixTextureFactory texFactory(this->scene);
-    this->optixNormalMap = texFactory.Create(this->normalMapName);
+    this->optixNormalMap =
+        this->scene->TextureFactory()->Create(this->normalMapName);
     this->optixMaterial["normSampler"]->setTextureSampler(this->optixNormalMap);
   }
 }
@@ -412,12 +416,15 @@ void OptixMaterial::Init()
   optix::Program anyHitProgram =
       this->scene->CreateOptixProgram(PTX_FILE_BASE, PTX_ANY_HIT_FUNC);
 
+  optix::Program rangeClosestHitProgram = this->scene->CreateOptixProgram(
+      PTX_FILE_BASE, PTX_RANGE_CLOSEST_HIT_FUNC);
+
   this->optixMaterial = optixContext->createMaterial();
   optixMaterial->setClosestHitProgram(RT_RADIANCE, closestHitProgram);
   optixMaterial->setAnyHitProgram(RT_SHADOW, anyHitProgram);
+  optixMaterial->setClosestHitProgram(RT_RANGE, rangeClosestHitProgram);
 
-  OptixTextureFactory texFactory(this->scene);
-  this->optixEmptyTexture = texFactory.Create();
+  this->optixEmptyTexture = this->scene->TextureFactory()->Create();
   this->optixMaterial["texSampler"]->setTextureSampler(this->optixEmptyTexture);
 
   this->Reset();
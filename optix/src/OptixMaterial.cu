@@ -29,6 +29,8 @@ rtDeclareVariable(float, sceneEpsilon, , );
 rtDeclareVariable(rtObject, rootGroup, , );
 rtBuffer<OptixDirectionalLightData> directionalLights;
 rtBuffer<OptixPointLightData> pointLights;
+rtBuffer<OptixLightAliasData> pointLightAlias;
+rtDeclareVariable(uint, maxPointLightSamples, , );
 rtTextureSampler<float4, 2> texSampler;
 rtTextureSampler<float4, 2> normSampler;
 rtDeclareVariable(bool, normWorldSpace, , );
@@ -45,8 +47,10 @@ rtDeclareVariable(uint, receiveShadows, , );
 
 // ray variables
 rtDeclareVariable(optix::Ray, ray, rtCurrentRay, );
+rtDeclareVariable(uint2, launchIndex, rtLaunchIndex, );
 rtDeclareVariable(OptixRadianceRayData, radianceData, rtPayload, );
 rtDeclareVariable(OptixShadowRayData, shadowData, rtPayload, );
+rtDeclareVariable(OptixRangeRayData, rangeData, rtPayload, );
 
 // intersect variables
 rtDeclareVariable(float, hitDist, rtIntersectionDistance, );
@@ -60,6 +64,57 @@ static __device__ __inline__ float3 Exp(const float3 &_x)
   return make_float3(exp(_x.x), exp(_x.y), exp(_x.z));
 }
 
+static __device__ __inline__ uint Hash(uint _x)
+{
+  _x ^= _x >> 16;
+  _x *= 0x7feb352d;
+  _x ^= _x >> 15;
+  _x *= 0x846ca68b;
+  _x ^= _x >> 16;
+  return _x;
+}
+
+static __device__ __inline__ float3 ShadePointLight(
+    const OptixPointLightData &_light, const float3 &_hitPoint,
+    const float3 &_normal)
+{
+  float3 color = make_float3(0);
+  float3 l = normalize(_light.common.position - _hitPoint);
+  float ndl = dot(_normal, l);
+
+  if (ndl > 0)
+  {
+    OptixShadowRayData data;
+    data.attenuation = make_float3(1);
+    float dist = length(_light.common.position - _hitPoint);
+    optix::Ray shadowRay(_hitPoint, l, RT_SHADOW, sceneEpsilon, dist);
+    rtTrace(rootGroup, shadowRay, data);
+    float3 attenuation = data.attenuation;
+
+    if (fmaxf(attenuation) > 0)
+    {
+      // TODO: add light's attenuation
+      float4 ld4 = _light.common.color.diffuse;
+      float3 Lc = make_float3(ld4.x, ld4.y, ld4.z) * attenuation;
+      color += diffuse * ndl * Lc;
+
+      float3 H = normalize(l - ray.direction);
+      float nDh = dot( _normal, H );
+
+      if(nDh > 0)
+      {
+        // TODO: include material specular
+        // float4 ks4 = light.common.color.specular;
+        // float3 Ks = make_float3(ks4.x, ks4.y, ks4.z) * attenuation;
+        float3 Ks = make_float3(0.5, 0.5, 0.5);
+        float phong_exp = 50;
+        color += Ks * Lc * pow(nDh, phong_exp);
+      }
+    }
+  }
+  return color;
+}
+
 RT_PROGRAM void AnyHit()
 {
   float3 shadowAtten   = diffuse;
@@ -224,41 +279,36 @@ RT_PROGRAM void ClosestHit()
     }
   }
 
-  for (int i = 0; i < pointLights.size() && lightingEnabled; ++i)
+  uint pointLightCount = pointLights.size();
+  if (lightingEnabled && (maxPointLightSamples == 0 ||
+      pointLightCount <= maxPointLightSamples))
   {
-    OptixPointLightData light = pointLights[i];
-    float3 l = normalize(light.common.position - hitPoint);
-    float ndl = dot(forwardNormal, l);
-
-    if (ndl > 0)
+    for (uint i = 0; i < pointLightCount; ++i)
+      color += ShadePointLight(pointLights[i], hitPoint, forwardNormal);
+  }
+  else if (lightingEnabled)
+  {
+    // too many lights to shade each of them, pick a few in proportion to
+    // their power with the alias table and weight them by their pdf
+    uint seed = Hash(launchIndex.x ^ Hash(launchIndex.y ^
+        Hash(radianceData.depth)));
+    for (uint s = 0; s < maxPointLightSamples; ++s)
     {
-      OptixShadowRayData data;
-      data.attenuation = make_float3(1);
-      float dist = length(light.common.position - hitPoint);
-      optix::Ray shadowRay(hitPoint, l, RT_SHADOW, sceneEpsilon, dist);
-      rtTrace(rootGroup, shadowRay, data);
-      float3 attenuation = data.attenuation;
-
-      if (fmaxf(attenuation) > 0)
+      float u = (Hash(seed + s) >> 8) * (1.0f / 16777216.0f);
+      float scaled = u * pointLightCount;
+      uint i = min(static_cast<uint>(scaled), pointLightCount - 1);
+      OptixLightAliasData entry = pointLightAlias[i];
+      if (scaled - i >= entry.probability)
       {
-        // TODO: add light's attenuation
-        float4 ld4 = light.common.color.diffuse;
-        float3 Lc = make_float3(ld4.x, ld4.y, ld4.z) * attenuation;
-        color += diffuse * ndl * Lc;
-
-        float3 H = normalize(l - ray.direction);
-        float nDh = dot( forwardNormal, H );
-
-        if(nDh > 0)
-        {
-          // TODO: include material specular
-          // float4 ks4 = light.common.color.specular;
-          // float3 Ks = make_float3(ks4.x, ks4.y, ks4.z) * attenuation;
-          float3 Ks = make_float3(0.5, 0.5, 0.5);
-          float phong_exp = 50;
-          color += Ks * Lc * pow(nDh, phong_exp);
-        }
+        i = entry.alias;
+        entry = pointLightAlias[i];
       }
+      if (entry.pdf <= 0)
+        continue;
+
+      float weight = 1.0f / (maxPointLightSamples * entry.pdf);
+      color += weight *
+          ShadePointLight(pointLights[i], hitPoint, forwardNormal);
     }
   }
 
@@ -281,3 +331,8 @@ RT_PROGRAM void ClosestHit()
   radianceData.color = (1 - transparency) * finalColor +
       (transparency * result * beerAtten);
 }
+
+RT_PROGRAM void RangeClosestHit()
+{
+  rangeData.range = hitDist;
+}
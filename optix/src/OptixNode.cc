@@ -52,7 +52,6 @@ void OptixNode::PreRender()
 {
   BaseNode::PreRender();
   this->WritePoseToDevice();
-  this->optixAccel->markDirty();
 }
 
 //////////////////////////////////////////////////
@@ -81,9 +80,21 @@ void OptixNode::WritePoseToDevice()
   {
     this->WritePoseToDeviceImpl();
     this->poseDirty = false;
+
+    // moving a node changes the bounds of its ancestors only, the
+    // accelerations of its own subtree stay valid
+    if (this->parent)
+      this->parent->MarkAccelDirty();
   }
 }
 
+//////////////////////////////////////////////////
+void OptixNode::MarkAccelDirty()
+{
+  for (OptixNode *node = this; node; node = node->parent.get())
+    node->optixAccel->markDirty();
+}
+
 //////////////////////////////////////////////////
 void OptixNode::WritePoseToDeviceImpl()
 {
@@ -131,7 +142,10 @@ void OptixNode::Init()
   this->optixTransform = optixContext->createTransform();
   // this->optixAccel = optixContext->createAcceleration("MedianBvh", "Bvh");
   // this->optixAccel = optixContext->createAcceleration("Lbvh", "Bvh");
-  this->optixAccel = optixContext->createAcceleration("Sbvh", "Bvh");
+  // groups only hold transforms of child nodes and are rebuilt whenever a
+  // child moves, so use a fast builder and refit the existing tree
+  this->optixAccel = optixContext->createAcceleration("Trbvh", "Bvh");
+  this->optixAccel->setProperty("refit", "1");
   this->optixGroup = optixContext->createGroup();
   this->optixGroup->setAcceleration(this->optixAccel);
   this->optixTransform->setChild(this->optixGroup);
@@ -159,7 +173,7 @@ bool OptixNode::AttachChild(NodePtr _child)
   derived->SetParent(this->SharedThis());
   optix::Transform childTransform = derived->OptixTransform();
   this->optixGroup->addChild(childTransform);
-  this->optixAccel->markDirty();
+  this->MarkAccelDirty();
   return true;
 }
 
@@ -174,7 +188,7 @@ bool OptixNode::DetachChild(NodePtr _child)
   }
 
   this->optixGroup->removeChild(derived->OptixTransform());
-  this->optixAccel->markDirty();
+  this->MarkAccelDirty();
   return true;
 }
 
@@ -51,18 +51,23 @@ void OptixRenderTarget::Copy(Image &_image) const
   }
 
   float3 *deviceData = static_cast<float3 *>(this->OptixBuffer()->map());
-  unsigned char *imageData = _image.Data<unsigned char>();
-  unsigned int count = this->width * this->height;
-  unsigned int index = 0;
+  unsigned int i = 0;
 
-  for (unsigned int i = 0; i < count; ++i)
+  for (unsigned int y = 0; y < this->height; ++y)
   {
-    imageData[index++] =
-        (unsigned char)fminf(fmaxf(255 * deviceData[i].x, 0), 255);
-    imageData[index++] =
-        (unsigned char)fminf(fmaxf(255 * deviceData[i].y, 0), 255);
-    imageData[index++] =
-        (unsigned char)fminf(fmaxf(255 * deviceData[i].z, 0), 255);
+    unsigned char *imageData =
+        _image.Data<unsigned char>() + y * _image.RowStride();
+    unsigned int index = 0;
+
+    for (unsigned int x = 0; x < this->width; ++x, ++i)
+    {
+      imageData[index++] =
+          (unsigned char)fminf(fmaxf(255 * deviceData[i].x, 0), 255);
+      imageData[index++] =
+          (unsigned char)fminf(fmaxf(255 * deviceData[i].y, 0), 255);
+      imageData[index++] =
+          (unsigned char)fminf(fmaxf(255 * deviceData[i].z, 0), 255);
+    }
   }
 
   this->OptixBuffer()->unmap();
@@ -98,6 +103,16 @@ optix::Buffer OptixRenderTexture::OptixBuffer() const
   return this->optixBuffer;
 }
 
+//////////////////////////////////////////////////
+void *OptixRenderTexture::CudaDevicePointer() const
+{
+  if (!this->optixBuffer || this->width == 0u || this->height == 0u)
+    return nullptr;
+
+  // the output buffer lives on the first device of the context
+  return this->optixBuffer->getDevicePointer(0);
+}
+
 //////////////////////////////////////////////////
 void OptixRenderTexture::RebuildImpl()
 {
@@ -22,6 +22,7 @@
 #include "gz/rendering/optix/OptixCone.hh"
 #include "gz/rendering/optix/OptixCylinder.hh"
 #include "gz/rendering/optix/OptixGeometry.hh"
+#include "gz/rendering/optix/OptixGpuRays.hh"
 #include "gz/rendering/optix/OptixGrid.hh"
 #include "gz/rendering/optix/OptixLightManager.hh"
 #include "gz/rendering/optix/OptixMeshFactory.hh"
@@ -31,6 +32,7 @@
 #include "gz/rendering/optix/OptixScene.hh"
 #include "gz/rendering/optix/OptixSphere.hh"
 #include "gz/rendering/optix/OptixStorage.hh"
+#include "gz/rendering/optix/OptixTextureFactory.hh"
 #include "gz/rendering/optix/OptixVisual.hh"
 
 using namespace gz;
@@ -41,6 +43,7 @@ OptixScene::OptixScene(unsigned int _id, const std::string &_name) :
   BaseScene(_id, _name),
   rootVisual(nullptr),
   meshFactory(nullptr),
+  textureFactory(nullptr),
   optixContext(nullptr),
   optixMissProgram(nullptr),
   optixBoxGeometry(nullptr),
@@ -128,6 +131,18 @@ void OptixScene::PreRender()
   this->lightManager->PreRender();
 }
 
+//////////////////////////////////////////////////
+void OptixScene::SetPreRenderDirtyTracking(bool _enabled)
+{
+  // lights are re-registered with the light manager every frame so the
+  // whole scene graph must be traversed
+  if (_enabled)
+  {
+    gzwarn << "PreRender dirty tracking not supported for Optix"
+            << std::endl;
+  }
+}
+
 //////////////////////////////////////////////////
 void OptixScene::Clear()
 {
@@ -150,6 +165,12 @@ optix::Context OptixScene::OptixContext() const
   return this->optixContext;
 }
 
+//////////////////////////////////////////////////
+OptixTextureFactoryPtr OptixScene::TextureFactory() const
+{
+  return this->textureFactory;
+}
+
 //////////////////////////////////////////////////
 optix::Program OptixScene::CreateOptixProgram(const std::string &_fileBase,
     const std::string &_function)
@@ -171,6 +192,7 @@ bool OptixScene::InitImpl()
   this->CreateRootVisual();
   this->CreateLightManager();
   this->CreateMeshFactory();
+  this->CreateTextureFactory();
   this->CreateStores();
   return true;
 }
@@ -237,6 +259,16 @@ CameraPtr OptixScene::CreateCameraImpl(unsigned int _id,
   return (result) ? camera : nullptr;
 }
 
+//////////////////////////////////////////////////
+GpuRaysPtr OptixScene::CreateGpuRaysImpl(unsigned int _id,
+    const std::string &_name)
+{
+  OptixGpuRaysPtr gpuRays(new OptixGpuRays);
+  gpuRays->traceId = this->NextEntryId();
+  bool result = this->InitObject(gpuRays, _id, _name);
+  return (result) ? gpuRays : nullptr;
+}
+
 //////////////////////////////////////////////////
 DepthCameraPtr OptixScene::CreateDepthCameraImpl(unsigned int /*_id*/,
     const std::string &/*_name*/)
@@ -513,6 +545,14 @@ void OptixScene::CreateMeshFactory()
   this->meshFactory = OptixMeshFactoryPtr(new OptixMeshFactory(sharedThis));
 }
 
+//////////////////////////////////////////////////
+void OptixScene::CreateTextureFactory()
+{
+  OptixScenePtr sharedThis = this->SharedThis();
+  this->textureFactory =
+      OptixTextureFactoryPtr(new OptixTextureFactory(sharedThis));
+}
+
 //////////////////////////////////////////////////
 void OptixScene::CreateStores()
 {
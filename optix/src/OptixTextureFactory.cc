@@ -14,6 +14,12 @@
  *
  */
 
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <map>
+#include <vector>
+
 #include <FreeImage.h>
 #include <gz/common/Console.hh>
 
@@ -24,10 +30,127 @@
 using namespace gz;
 using namespace rendering;
 
-// TODO: clone texture sampler, reuse texture buffers
+/// \brief Image decoded to RGBA bytes, rows from bottom to top
+struct DecodedImage
+{
+  /// \brief Width in pixels, 0 if decoding failed
+  unsigned int width = 0u;
+
+  /// \brief Height in pixels, 0 if decoding failed
+  unsigned int height = 0u;
+
+  /// \brief Pixel bytes
+  std::vector<unsigned char> pixels;
+};
+
+/// \brief Private data for the OptixTextureFactory class
+class gz::rendering::OptixTextureFactoryPrivate
+{
+  /// \brief Decode an image file. Safe to call on any thread.
+  /// \param[in] _filename Path to the image file
+  /// \return Decoded image, empty if decoding failed
+  public: static DecodedImage Decode(const std::string &_filename);
+
+  /// \brief Get the modification time of a file
+  /// \param[in] _filename Path to the file
+  /// \return Modification time, the minimum if it is unknown
+  public: static std::filesystem::file_time_type ModifiedTime(
+              const std::string &_filename);
+
+  /// \brief Buffer uploaded from an image file
+  public: struct CachedBuffer
+  {
+    /// \brief Modification time of the file when it was decoded
+    std::filesystem::file_time_type modifiedTime;
+
+    /// \brief Device buffer, shared by every sampler of the file
+    optix::Buffer buffer;
+  };
+
+  /// \brief Image file being decoded in the background
+  public: struct PendingImage
+  {
+    /// \brief Modification time of the file when decoding started
+    std::filesystem::file_time_type modifiedTime;
+
+    /// \brief Decoded image
+    std::future<DecodedImage> image;
+  };
+
+  /// \brief Uploaded buffers, by filename
+  public: std::map<std::string, CachedBuffer> buffers;
+
+  /// \brief Images being decoded, by filename
+  public: std::map<std::string, PendingImage> pending;
+};
+
+//////////////////////////////////////////////////
+DecodedImage OptixTextureFactoryPrivate::Decode(const std::string &_filename)
+{
+  DecodedImage result;
+
+  FREE_IMAGE_FORMAT format = FreeImage_GetFileType(_filename.c_str(), 0);
+  FIBITMAP *image = FreeImage_Load(format, _filename.c_str());
+
+  if (!image)
+    return result;
+
+  FIBITMAP *temp = image;
+  image = FreeImage_ConvertTo32Bits(image);
+  FreeImage_Unload(temp);
+
+  if (!image)
+    return result;
+
+  unsigned w = FreeImage_GetWidth(image);
+  unsigned h = FreeImage_GetHeight(image);
+
+  // freeimage stores data as BGR[A] on little endian architecture
+  // reverse pixel values if needed
+#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
+  unsigned p = FreeImage_GetPitch(image);
+  unsigned bpp = FreeImage_GetBPP(image) / 8;
+  unsigned lineSize = FreeImage_GetLine(image);
+  BYTE* line = FreeImage_GetBits(image);
+  for (unsigned y = 0; y < h; ++y, line += p)
+  {
+    for (BYTE* pixel = line; pixel < line + lineSize; pixel += bpp)
+    {
+      // in- place swap
+      pixel[0] ^= pixel[2]; pixel[2] ^= pixel[0]; pixel[0] ^= pixel[2];
+    }
+  }
+#endif
+
+  // get raw bits after flipping vertical axis (last bool arg)
+  // as free image stores data upside down in memory
+  result.pixels.resize(
+      static_cast<size_t>(FreeImage_GetLine(image)) * h);
+  FreeImage_ConvertToRawBits(result.pixels.data(),
+      image, FreeImage_GetLine(image), FreeImage_GetBPP(image),
+      FI_RGBA_RED_MASK, FI_RGBA_GREEN_MASK, FI_RGBA_BLUE_MASK, true);
+  FreeImage_Unload(image);
+
+  result.width = w;
+  result.height = h;
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::filesystem::file_time_type OptixTextureFactoryPrivate::ModifiedTime(
+    const std::string &_filename)
+{
+  std::error_code ec;
+  auto mtime = std::filesystem::last_write_time(_filename, ec);
+  if (ec)
+    return std::filesystem::file_time_type::min();
+  return mtime;
+}
 
+//////////////////////////////////////////////////
 OptixTextureFactory::OptixTextureFactory(OptixScenePtr _scene) :
-  scene(_scene)
+  scene(_scene),
+  dataPtr(std::make_unique<OptixTextureFactoryPrivate>())
 {
 }
 
@@ -43,6 +166,43 @@ optix::TextureSampler OptixTextureFactory::Create(const std::string &_filename)
   return this->CreateSampler(buffer);
 }
 
+//////////////////////////////////////////////////
+void OptixTextureFactory::Preload(const std::vector<std::string> &_filenames)
+{
+  for (const auto &filename : _filenames)
+  {
+    if (filename.empty())
+      continue;
+
+    auto mtime = OptixTextureFactoryPrivate::ModifiedTime(filename);
+    auto cached = this->dataPtr->buffers.find(filename);
+    if (cached != this->dataPtr->buffers.end() &&
+        cached->second.modifiedTime == mtime)
+    {
+      continue;
+    }
+    auto pending = this->dataPtr->pending.find(filename);
+    if (pending != this->dataPtr->pending.end() &&
+        pending->second.modifiedTime == mtime)
+    {
+      continue;
+    }
+
+    OptixTextureFactoryPrivate::PendingImage image;
+    image.modifiedTime = mtime;
+    image.image = std::async(std::launch::async,
+        &OptixTextureFactoryPrivate::Decode, filename);
+    this->dataPtr->pending[filename] = std::move(image);
+  }
+}
+
+//////////////////////////////////////////////////
+void OptixTextureFactory::Clear()
+{
+  this->dataPtr->buffers.clear();
+  this->dataPtr->pending.clear();
+}
+
 //////////////////////////////////////////////////
 optix::TextureSampler OptixTextureFactory::Create()
 {
@@ -59,53 +219,46 @@ optix::Buffer OptixTextureFactory::CreateBuffer(const std::string &_filename)
     return this->CreateBuffer();
   }
 
-  FREE_IMAGE_FORMAT format = FreeImage_GetFileType(_filename.c_str(), 0);
-  FIBITMAP *image = FreeImage_Load(format, _filename.c_str());
-
-  if (!image)
+  // reuse the buffer unless the file changed since it was decoded
+  auto mtime = OptixTextureFactoryPrivate::ModifiedTime(_filename);
+  auto cached = this->dataPtr->buffers.find(_filename);
+  if (cached != this->dataPtr->buffers.end())
   {
-    gzerr << "Unable to load texture: " << _filename << std::endl;
-    return this->CreateBuffer();
+    if (cached->second.modifiedTime == mtime)
+      return cached->second.buffer;
+    this->dataPtr->buffers.erase(cached);
   }
 
-  FIBITMAP *temp = image;
-  image = FreeImage_ConvertTo32Bits(image);
-
-  unsigned w = FreeImage_GetWidth(image);
-  unsigned h = FreeImage_GetHeight(image);
-
-  // freeimage stores data as BGR[A] on little endian architecture
-  // reverse pixel values if needed
-#if FREEIMAGE_COLORORDER == FREEIMAGE_COLORORDER_BGR
-  unsigned p = FreeImage_GetPitch(image);
-  unsigned bpp = FreeImage_GetBPP(image) / 8;
-  unsigned lineSize = FreeImage_GetLine(image);
-  BYTE* line = FreeImage_GetBits(image);
-  for (unsigned y = 0; y < h; ++y, line += p)
+  // wait for a preloaded image, or decode it now
+  DecodedImage image;
+  auto pending = this->dataPtr->pending.find(_filename);
+  if (pending != this->dataPtr->pending.end() &&
+      pending->second.modifiedTime == mtime)
   {
-    for (BYTE* pixel = line; pixel < line + lineSize; pixel += bpp)
-    {
-      // in- place swap
-      pixel[0] ^= pixel[2]; pixel[2] ^= pixel[0]; pixel[0] ^= pixel[2];
-    }
+    image = pending->second.image.get();
   }
-#endif
+  else
+  {
+    image = OptixTextureFactoryPrivate::Decode(_filename);
+  }
+  if (pending != this->dataPtr->pending.end())
+    this->dataPtr->pending.erase(pending);
 
-  FreeImage_Unload(temp);
+  if (image.pixels.empty())
+  {
+    gzerr << "Unable to load texture: " << _filename << std::endl;
+    return this->CreateBuffer();
+  }
 
   optix::Context optixContext = this->scene->OptixContext();
 
   optix::Buffer buffer = optixContext->createBuffer(RT_BUFFER_INPUT);
   buffer->setFormat(RT_FORMAT_UNSIGNED_BYTE4);
-  buffer->setSize(w, h);
-  // get raw bits after flipping vertical axis (last bool arg)
-  // as free image stores data upside down in memory
-  FreeImage_ConvertToRawBits(reinterpret_cast<BYTE *>(buffer->map()),
-      image, FreeImage_GetLine(image), FreeImage_GetBPP(image),
-      FI_RGBA_RED_MASK, FI_RGBA_GREEN_MASK, FI_RGBA_BLUE_MASK, true);
+  buffer->setSize(image.width, image.height);
+  std::memcpy(buffer->map(), image.pixels.data(), image.pixels.size());
   buffer->unmap();
-  FreeImage_Unload(image);
 
+  this->dataPtr->buffers[_filename] = {mtime, buffer};
   return buffer;
 }
 
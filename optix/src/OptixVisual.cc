@@ -52,14 +52,20 @@ void OptixVisual::PreRender()
 {
   BaseVisual::PreRender();
 
-  // TODO: optimize this funtionality
+  // scaled geometries have new bounds, so only touch them on changes
   math::Vector3d worldScale = this->WorldScale();
+  if (!this->geometryScaleDirty && worldScale == this->geometryScale)
+    return;
 
   for (unsigned int i = 0; i < this->GeometryCount(); ++i)
   {
     OptixGeometryPtr geometry = this->geometries->DerivedByIndex(i);
     geometry->SetScale(worldScale);
+    geometry->OptixGeometryGroup()->getAcceleration()->markDirty();
   }
+  this->geometryScale = worldScale;
+  this->geometryScaleDirty = false;
+  this->MarkAccelDirty();
 }
 
 //////////////////////////////////////////////////
@@ -85,7 +91,8 @@ bool OptixVisual::AttachGeometry(GeometryPtr _geometry)
   derived->SetParent(this->SharedThis());
   optix::GeometryGroup childGeomGroup = derived->OptixGeometryGroup();
   this->optixGroup->addChild(childGeomGroup);
-  this->optixAccel->markDirty();
+  this->geometryScaleDirty = true;
+  this->MarkAccelDirty();
   return true;
 }
 
@@ -104,7 +111,7 @@ bool OptixVisual::DetachGeometry(GeometryPtr _geometry)
   }
 
   this->optixGroup->removeChild(derived->OptixGeometryGroup());
-  this->optixAccel->markDirty();
+  this->MarkAccelDirty();
   return true;
 }
 
@@ -36,6 +36,18 @@ class gz::rendering::BoundingBoxPrivate
   /// \brief Label of the bounding box
   public: uint32_t label;
 
+  /// \brief Number of visible pixels of the object
+  public: uint32_t visiblePixelCount = 0u;
+
+  /// \brief Unoccluded projected area inside the image, in pixels
+  public: double projectedArea = 0.0;
+
+  /// \brief Fraction of the projected object outside the image
+  public: double truncation = 0.0;
+
+  /// \brief Fraction of the projected area inside the image occluded
+  public: double occlusion = 0.0;
+
   /// \brief 3D vertices of the bounding box
   public: std::vector<math::Vector3d> vertices3d;
 
@@ -175,3 +187,51 @@ void BoundingBox::SetLabel(uint32_t _label)
 {
   this->dataPtr->label = _label;
 }
+
+/////////////////////////////////////////////////
+uint32_t BoundingBox::VisiblePixelCount() const
+{
+  return this->dataPtr->visiblePixelCount;
+}
+
+/////////////////////////////////////////////////
+void BoundingBox::SetVisiblePixelCount(uint32_t _count)
+{
+  this->dataPtr->visiblePixelCount = _count;
+}
+
+/////////////////////////////////////////////////
+double BoundingBox::ProjectedArea() const
+{
+  return this->dataPtr->projectedArea;
+}
+
+/////////////////////////////////////////////////
+void BoundingBox::SetProjectedArea(double _area)
+{
+  this->dataPtr->projectedArea = _area;
+}
+
+/////////////////////////////////////////////////
+double BoundingBox::Truncation() const
+{
+  return this->dataPtr->truncation;
+}
+
+/////////////////////////////////////////////////
+void BoundingBox::SetTruncation(double _truncation)
+{
+  this->dataPtr->truncation = _truncation;
+}
+
+/////////////////////////////////////////////////
+double BoundingBox::Occlusion() const
+{
+  return this->dataPtr->occlusion;
+}
+
+/////////////////////////////////////////////////
+void BoundingBox::SetOcclusion(double _occlusion)
+{
+  this->dataPtr->occlusion = _occlusion;
+}
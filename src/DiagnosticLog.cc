@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/DiagnosticLog.hh"
+
+#include <mutex>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Private data of DiagnosticLog
+class gz::rendering::DiagnosticLogPrivate
+{
+  /// \brief Log state of a key, kept when the counters are reset
+  public: struct Entry
+  {
+    /// \brief True if the key was logged at least once
+    bool logged = false;
+
+    /// \brief Time the key was last logged
+    std::chrono::steady_clock::time_point lastLogged;
+  };
+
+  /// \brief Count a key and check whether it should be logged
+  /// \param[in] _key Key of the diagnostic
+  /// \param[in] _once True to only log the key once
+  /// \return True if the key should be logged
+  public: bool Raise(const std::string &_key, bool _once);
+
+  /// \brief Minimum time between two logs of the same key
+  public: std::chrono::steady_clock::duration interval =
+      std::chrono::seconds(10);
+
+  /// \brief Log state of every raised key
+  public: std::map<std::string, Entry> entries;
+
+  /// \brief Counters of every key raised since the last reset
+  public: std::map<std::string, DiagnosticStats> counts;
+
+  /// \brief Protects all members
+  public: mutable std::mutex mutex;
+};
+
+//////////////////////////////////////////////////
+bool DiagnosticLogPrivate::Raise(const std::string &_key, bool _once)
+{
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(this->mutex);
+  Entry &entry = this->entries[_key];
+  DiagnosticStats &stats = this->counts[_key];
+  ++stats.count;
+  if (entry.logged && (_once || now - entry.lastLogged < this->interval))
+    return false;
+  ++stats.logged;
+  entry.logged = true;
+  entry.lastLogged = now;
+  return true;
+}
+
+//////////////////////////////////////////////////
+DiagnosticLog::DiagnosticLog()
+  : dataPtr(std::make_unique<DiagnosticLogPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+DiagnosticLog::~DiagnosticLog() = default;
+
+//////////////////////////////////////////////////
+bool DiagnosticLog::Raise(const std::string &_key)
+{
+  return this->dataPtr->Raise(_key, false);
+}
+
+//////////////////////////////////////////////////
+bool DiagnosticLog::RaiseOnce(const std::string &_key)
+{
+  return this->dataPtr->Raise(_key, true);
+}
+
+//////////////////////////////////////////////////
+void DiagnosticLog::SetInterval(std::chrono::steady_clock::duration _interval)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->interval = _interval;
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration DiagnosticLog::Interval() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->interval;
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, DiagnosticStats> DiagnosticLog::Counts() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->counts;
+}
+
+//////////////////////////////////////////////////
+void DiagnosticLog::Reset()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->counts.clear();
+}
+
+//////////////////////////////////////////////////
+void DiagnosticLog::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->counts.clear();
+  this->dataPtr->entries.clear();
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "gz/rendering/DiagnosticLog.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(DiagnosticLogTest, Raise)
+{
+  DiagnosticLog log;
+  EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::seconds(10)),
+      log.Interval());
+  EXPECT_TRUE(log.Counts().empty());
+
+  // the first diagnostic of a key is logged, the next ones are suppressed
+  // until the interval elapsed
+  EXPECT_TRUE(log.Raise("a"));
+  EXPECT_FALSE(log.Raise("a"));
+  EXPECT_FALSE(log.Raise("a"));
+  EXPECT_TRUE(log.Raise("b"));
+
+  auto counts = log.Counts();
+  ASSERT_EQ(2u, counts.size());
+  EXPECT_EQ(3u, counts["a"].count);
+  EXPECT_EQ(1u, counts["a"].logged);
+  EXPECT_EQ(1u, counts["b"].count);
+  EXPECT_EQ(1u, counts["b"].logged);
+
+  // without an interval every diagnostic is logged
+  log.SetInterval(std::chrono::steady_clock::duration::zero());
+  EXPECT_TRUE(log.Raise("a"));
+  EXPECT_TRUE(log.Raise("a"));
+  EXPECT_EQ(3u, log.Counts()["a"].logged);
+
+  // once per key ignores the interval
+  EXPECT_TRUE(log.RaiseOnce("c"));
+  EXPECT_FALSE(log.RaiseOnce("c"));
+  EXPECT_EQ(2u, log.Counts()["c"].count);
+
+  // reset only clears the counters, keys logged once stay quiet
+  log.Reset();
+  EXPECT_TRUE(log.Counts().empty());
+  EXPECT_FALSE(log.RaiseOnce("c"));
+  EXPECT_EQ(1u, log.Counts()["c"].count);
+  EXPECT_EQ(0u, log.Counts()["c"].logged);
+
+  // clear forgets the keys
+  log.Clear();
+  EXPECT_TRUE(log.Counts().empty());
+  EXPECT_TRUE(log.RaiseOnce("c"));
+}
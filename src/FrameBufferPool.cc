@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/FrameBufferPool.hh"
+
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+/// \brief Functions the buffers of a pool are allocated and freed with
+struct FrameBufferAllocator
+{
+  /// \brief Allocation function
+  FrameBufferPool::AllocateFunction allocate;
+
+  /// \brief Function freeing the buffers of allocate
+  FrameBufferPool::FreeFunction free;
+};
+
+/// \brief Deleter of leased buffers. Returns the buffer to its pool if the
+/// pool still exists and still allocates buffers the same way.
+struct FrameBufferDeleter
+{
+  /// \brief Return the buffer to the pool or free it
+  /// \param[in] _buffer Released buffer
+  void operator()(unsigned char *_buffer) const;
+
+  /// \brief Pool the buffer was leased from
+  std::weak_ptr<FrameBufferPoolPrivate> pool;
+
+  /// \brief Allocator of the buffer, null for the default allocation
+  std::shared_ptr<const FrameBufferAllocator> allocator;
+
+  /// \brief Bucket size of the buffer in bytes
+  std::size_t size = 0u;
+};
+}
+}
+}
+
+/// \brief Private data for the FrameBufferPool class
+class gz::rendering::FrameBufferPoolPrivate
+{
+  /// \brief Destructor. Frees the buffers released after the pool was
+  /// cleared.
+  public: ~FrameBufferPoolPrivate()
+  {
+    this->Trim(0u);
+  }
+
+  /// \brief Get the bucket size of a requested size, the next power of two
+  /// and at least the alignment
+  /// \param[in] _size Requested size in bytes
+  /// \return Bucket size in bytes
+  public: static std::size_t BucketSize(std::size_t _size)
+  {
+    std::size_t size = FrameBufferPool::kAlignment;
+    while (size < _size)
+      size <<= 1u;
+    return size;
+  }
+
+  /// \brief Allocate an aligned buffer
+  /// \param[in] _size Size in bytes
+  /// \param[in,out] _allocator Allocator to use, reset to null if it
+  /// failed and the default allocation was used instead
+  /// \return New buffer
+  public: static unsigned char *Allocate(std::size_t _size,
+      std::shared_ptr<const FrameBufferAllocator> &_allocator)
+  {
+    if (_allocator)
+    {
+      void *buffer = _allocator->allocate(_size);
+      if (buffer)
+        return static_cast<unsigned char *>(buffer);
+      _allocator.reset();
+    }
+    return static_cast<unsigned char *>(::operator new(_size,
+        std::align_val_t(FrameBufferPool::kAlignment)));
+  }
+
+  /// \brief Free a buffer allocated with Allocate
+  /// \param[in] _buffer Buffer to free
+  /// \param[in] _size Size of the buffer in bytes
+  /// \param[in] _allocator Allocator the buffer was allocated with
+  public: static void Free(unsigned char *_buffer, std::size_t _size,
+      const std::shared_ptr<const FrameBufferAllocator> &_allocator)
+  {
+    if (_allocator)
+    {
+      if (_allocator->free)
+        _allocator->free(_buffer, _size);
+      return;
+    }
+    ::operator delete(_buffer, std::align_val_t(FrameBufferPool::kAlignment));
+  }
+
+  /// \brief Put a released buffer back in its bucket, or free it if the
+  /// pool is full or allocates buffers differently now
+  /// \param[in] _buffer Released buffer
+  /// \param[in] _size Bucket size of the buffer
+  /// \param[in] _allocator Allocator the buffer was allocated with
+  public: void Release(unsigned char *_buffer, std::size_t _size,
+      const std::shared_ptr<const FrameBufferAllocator> &_allocator)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (_allocator == this->allocator &&
+          this->freeBytes + _size <= this->maxFreeBytes)
+      {
+        this->buckets[_size].push_back(_buffer);
+        this->freeBytes += _size;
+        return;
+      }
+    }
+    Free(_buffer, _size, _allocator);
+  }
+
+  /// \brief Free buffers, largest first, until the free buffers fit in
+  /// the given size. Must be called with the mutex locked.
+  /// \param[in] _bytes Size the free buffers must fit in
+  public: void Trim(std::size_t _bytes)
+  {
+    while (this->freeBytes > _bytes && !this->buckets.empty())
+    {
+      auto it = std::prev(this->buckets.end());
+      Free(it->second.back(), it->first, this->allocator);
+      it->second.pop_back();
+      this->freeBytes -= it->first;
+      if (it->second.empty())
+        this->buckets.erase(it);
+    }
+  }
+
+  /// \brief Protects the buckets
+  public: std::mutex mutex;
+
+  /// \brief Free buffers indexed by bucket size
+  public: std::map<std::size_t, std::vector<unsigned char *>> buckets;
+
+  /// \brief Total size of the free buffers in bytes
+  public: std::size_t freeBytes = 0u;
+
+  /// \brief Maximum total size of the free buffers in bytes
+  public: std::size_t maxFreeBytes = 256u * 1024u * 1024u;
+
+  /// \brief Allocator of new buffers and of the free buffers, null for
+  /// the default allocation
+  public: std::shared_ptr<const FrameBufferAllocator> allocator;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+void FrameBufferDeleter::operator()(unsigned char *_buffer) const
+{
+  auto owner = this->pool.lock();
+  if (owner)
+    owner->Release(_buffer, this->size, this->allocator);
+  else
+    FrameBufferPoolPrivate::Free(_buffer, this->size, this->allocator);
+}
+
+//////////////////////////////////////////////////
+FrameBufferPool::FrameBufferPool()
+  : dataPtr(std::make_shared<FrameBufferPoolPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+FrameBufferPool::~FrameBufferPool()
+{
+  this->Clear();
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<unsigned char> FrameBufferPool::Acquire(std::size_t _size)
+{
+  if (_size == 0u)
+    return std::shared_ptr<unsigned char>();
+
+  const std::size_t size = FrameBufferPoolPrivate::BucketSize(_size);
+  unsigned char *buffer = nullptr;
+  std::shared_ptr<const FrameBufferAllocator> allocator;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    allocator = this->dataPtr->allocator;
+    auto it = this->dataPtr->buckets.find(size);
+    if (it != this->dataPtr->buckets.end())
+    {
+      buffer = it->second.back();
+      it->second.pop_back();
+      this->dataPtr->freeBytes -= size;
+      if (it->second.empty())
+        this->dataPtr->buckets.erase(it);
+    }
+  }
+  if (!buffer)
+    buffer = FrameBufferPoolPrivate::Allocate(size, allocator);
+
+  FrameBufferDeleter deleter;
+  deleter.pool = this->dataPtr;
+  deleter.allocator = allocator;
+  deleter.size = size;
+  return std::shared_ptr<unsigned char>(buffer, deleter);
+}
+
+//////////////////////////////////////////////////
+unsigned char *FrameBufferPool::Reserve(
+    std::shared_ptr<unsigned char> &_lease, std::size_t _size)
+{
+  if (!_lease || _lease.use_count() > 1 || Capacity(_lease) < _size)
+    _lease = this->Acquire(_size);
+  return _lease.get();
+}
+
+//////////////////////////////////////////////////
+std::size_t FrameBufferPool::Capacity(
+    const std::shared_ptr<unsigned char> &_lease)
+{
+  const FrameBufferDeleter *deleter =
+      std::get_deleter<FrameBufferDeleter>(_lease);
+  return deleter ? deleter->size : 0u;
+}
+
+//////////////////////////////////////////////////
+std::size_t FrameBufferPool::FreeBufferCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::size_t count = 0u;
+  for (const auto &bucket : this->dataPtr->buckets)
+    count += bucket.second.size();
+  return count;
+}
+
+//////////////////////////////////////////////////
+std::size_t FrameBufferPool::FreeBytes() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->freeBytes;
+}
+
+//////////////////////////////////////////////////
+void FrameBufferPool::SetMaxFreeBytes(std::size_t _bytes)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->maxFreeBytes = _bytes;
+  this->dataPtr->Trim(_bytes);
+}
+
+//////////////////////////////////////////////////
+std::size_t FrameBufferPool::MaxFreeBytes() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->maxFreeBytes;
+}
+
+//////////////////////////////////////////////////
+void FrameBufferPool::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->Trim(0u);
+}
+
+//////////////////////////////////////////////////
+void FrameBufferPool::SetAllocator(AllocateFunction _allocate,
+    FreeFunction _free)
+{
+  std::shared_ptr<const FrameBufferAllocator> allocator;
+  if (_allocate)
+  {
+    auto custom = std::make_shared<FrameBufferAllocator>();
+    custom->allocate = std::move(_allocate);
+    custom->free = std::move(_free);
+    allocator = custom;
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  // the free buffers are freed with the allocator they came from
+  this->dataPtr->Trim(0u);
+  this->dataPtr->allocator = allocator;
+}
+
+//////////////////////////////////////////////////
+bool FrameBufferPool::HasCustomAllocator() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->allocator != nullptr;
+}
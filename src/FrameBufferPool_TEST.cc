@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <new>
+
+#include "gz/rendering/FrameBufferPool.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, Acquire)
+{
+  FrameBufferPool pool;
+  EXPECT_EQ(nullptr, pool.Acquire(0u));
+
+  std::shared_ptr<unsigned char> buffer = pool.Acquire(1000u);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(buffer.get()) %
+      FrameBufferPool::kAlignment);
+  // the whole buffer is writable
+  buffer.get()[999] = 1u;
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+
+  // released buffers go back to their bucket
+  unsigned char *data = buffer.get();
+  buffer.reset();
+  EXPECT_EQ(1u, pool.FreeBufferCount());
+  EXPECT_EQ(1024u, pool.FreeBytes());
+
+  // and are reused for requests of the same bucket
+  buffer = pool.Acquire(800u);
+  EXPECT_EQ(data, buffer.get());
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+
+  // other buckets get a new buffer
+  std::shared_ptr<unsigned char> other = pool.Acquire(2000u);
+  EXPECT_NE(data, other.get());
+}
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, Reserve)
+{
+  FrameBufferPool pool;
+  std::shared_ptr<unsigned char> lease;
+  EXPECT_EQ(0u, FrameBufferPool::Capacity(lease));
+
+  unsigned char *data = pool.Reserve(lease, 100u);
+  ASSERT_NE(nullptr, data);
+  EXPECT_EQ(data, lease.get());
+  EXPECT_EQ(128u, FrameBufferPool::Capacity(lease));
+
+  // a lease that is large enough is kept
+  EXPECT_EQ(data, pool.Reserve(lease, 128u));
+
+  // a larger size replaces it
+  EXPECT_NE(nullptr, pool.Reserve(lease, 129u));
+  EXPECT_EQ(256u, FrameBufferPool::Capacity(lease));
+
+  // a lease held by someone else is not overwritten
+  std::shared_ptr<unsigned char> held = lease;
+  EXPECT_NE(held.get(), pool.Reserve(lease, 16u));
+  EXPECT_NE(held, lease);
+
+  // buffers that do not come from a pool have no capacity
+  std::shared_ptr<unsigned char> plain(new unsigned char[4],
+      std::default_delete<unsigned char[]>());
+  EXPECT_EQ(0u, FrameBufferPool::Capacity(plain));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, SharedLease)
+{
+  FrameBufferPool pool;
+  std::shared_ptr<unsigned char> buffer = pool.Acquire(64u);
+  std::shared_ptr<unsigned char> copy = buffer;
+  buffer.reset();
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+  copy.reset();
+  EXPECT_EQ(1u, pool.FreeBufferCount());
+}
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, MaxFreeBytes)
+{
+  FrameBufferPool pool;
+  EXPECT_GT(pool.MaxFreeBytes(), 0u);
+
+  std::shared_ptr<unsigned char> a = pool.Acquire(4096u);
+  std::shared_ptr<unsigned char> b = pool.Acquire(4096u);
+  a.reset();
+  b.reset();
+  EXPECT_EQ(2u, pool.FreeBufferCount());
+
+  // shrinking the limit frees buffers
+  pool.SetMaxFreeBytes(4096u);
+  EXPECT_EQ(4096u, pool.MaxFreeBytes());
+  EXPECT_EQ(1u, pool.FreeBufferCount());
+  EXPECT_EQ(4096u, pool.FreeBytes());
+
+  // buffers that do not fit are freed when released
+  a = pool.Acquire(4096u);
+  b = pool.Acquire(4096u);
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+  a.reset();
+  b.reset();
+  EXPECT_EQ(1u, pool.FreeBufferCount());
+
+  pool.Clear();
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+  EXPECT_EQ(0u, pool.FreeBytes());
+}
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, LeaseOutlivesPool)
+{
+  std::shared_ptr<unsigned char> buffer;
+  {
+    FrameBufferPool pool;
+    buffer = pool.Acquire(128u);
+  }
+  ASSERT_NE(nullptr, buffer);
+  buffer.get()[127] = 1u;
+  buffer.reset();
+}
+
+/////////////////////////////////////////////////
+TEST(FrameBufferPoolTest, Allocator)
+{
+  FrameBufferPool pool;
+  EXPECT_FALSE(pool.HasCustomAllocator());
+
+  std::size_t allocated = 0u;
+  std::size_t freed = 0u;
+  auto allocate = [&allocated](std::size_t _size) -> void *
+  {
+    ++allocated;
+    return ::operator new(_size,
+        std::align_val_t(FrameBufferPool::kAlignment));
+  };
+  auto free = [&freed](void *_buffer, std::size_t)
+  {
+    ++freed;
+    ::operator delete(_buffer,
+        std::align_val_t(FrameBufferPool::kAlignment));
+  };
+
+  // free buffers of the default allocation are dropped
+  pool.Acquire(1024u).reset();
+  EXPECT_EQ(1u, pool.FreeBufferCount());
+  pool.SetAllocator(allocate, free);
+  EXPECT_TRUE(pool.HasCustomAllocator());
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+
+  std::shared_ptr<unsigned char> buffer = pool.Acquire(1024u);
+  ASSERT_NE(nullptr, buffer);
+  EXPECT_EQ(0u,
+      reinterpret_cast<std::uintptr_t>(buffer.get()) %
+      FrameBufferPool::kAlignment);
+  EXPECT_EQ(1u, allocated);
+
+  // released buffers are reused
+  buffer.reset();
+  buffer = pool.Acquire(1024u);
+  EXPECT_EQ(1u, allocated);
+  EXPECT_EQ(0u, freed);
+
+  // leased buffers are freed with their own allocator after a change
+  pool.SetAllocator(nullptr, nullptr);
+  EXPECT_FALSE(pool.HasCustomAllocator());
+  buffer.reset();
+  EXPECT_EQ(1u, freed);
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+
+  // a failing allocator falls back to the default allocation
+  pool.SetAllocator([](std::size_t) -> void * { return nullptr; }, free);
+  buffer = pool.Acquire(64u);
+  ASSERT_NE(nullptr, buffer);
+  buffer.reset();
+  EXPECT_EQ(1u, freed);
+  EXPECT_EQ(0u, pool.FreeBufferCount());
+}
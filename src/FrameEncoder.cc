@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/FrameEncoder.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Image.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/PixelFormat.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Write an encoded frame to a file
+/// \param[in] _data Encoded frame
+/// \param[in] _filename Path of the file to write
+/// \return True if the file was written
+static bool WriteFrame(const std::vector<unsigned char> &_data,
+    const std::string &_filename)
+{
+  if (_data.empty())
+  {
+    gzerr << "Unable to encode frame [" << _filename << "]" << std::endl;
+    return false;
+  }
+
+  std::ofstream out(_filename, std::ios::binary);
+  out.write(reinterpret_cast<const char *>(_data.data()),
+      static_cast<std::streamsize>(_data.size()));
+  if (!out)
+  {
+    gzerr << "Unable to write frame [" << _filename << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/// \brief Private data for the FrameEncoder class
+class gz::rendering::FrameEncoderPrivate
+{
+  /// \brief Run queued jobs until the encoder is destroyed
+  public: void Work();
+
+  /// \brief Queue a job
+  /// \param[in] _job Job to run on a worker thread
+  public: void Push(std::function<void()> _job);
+
+  /// \brief Encode an image with the current encode function
+  /// \param[in] _image Image to encode
+  /// \param[out] _data Encoded image
+  /// \return True if the image was encoded
+  public: bool Encode(const Image &_image, std::vector<unsigned char> &_data);
+
+  /// \brief Worker threads
+  public: std::vector<std::thread> workers;
+
+  /// \brief Jobs waiting for a worker
+  public: std::deque<std::function<void()>> jobs;
+
+  /// \brief Number of jobs queued or running
+  public: std::size_t pending = 0u;
+
+  /// \brief True once the workers must stop
+  public: bool stop = false;
+
+  /// \brief Function frames are encoded with, null for PNG
+  public: FrameEncoder::EncodeFunction encode;
+
+  /// \brief Protects the members above
+  public: mutable std::mutex mutex;
+
+  /// \brief Signals queued jobs
+  public: std::condition_variable jobAdded;
+
+  /// \brief Signals finished jobs
+  public: std::condition_variable jobDone;
+};
+
+//////////////////////////////////////////////////
+void FrameEncoderPrivate::Work()
+{
+  while (true)
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->jobAdded.wait(lock, [this]
+      {
+        return this->stop || !this->jobs.empty();
+      });
+      if (this->jobs.empty())
+        return;
+      job = std::move(this->jobs.front());
+      this->jobs.pop_front();
+    }
+
+    job();
+
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      --this->pending;
+    }
+    this->jobDone.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+void FrameEncoderPrivate::Push(std::function<void()> _job)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->jobs.push_back(std::move(_job));
+    ++this->pending;
+  }
+  this->jobAdded.notify_one();
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoderPrivate::Encode(const Image &_image,
+    std::vector<unsigned char> &_data)
+{
+  FrameEncoder::EncodeFunction encode;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    encode = this->encode;
+  }
+  if (encode)
+    return encode(_image, _data);
+  return FrameEncoder::EncodePng(_image, _data);
+}
+
+//////////////////////////////////////////////////
+FrameEncoder::FrameEncoder(unsigned int _threadCount)
+  : dataPtr(std::make_unique<FrameEncoderPrivate>())
+{
+  if (_threadCount == 0u)
+    _threadCount = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned int i = 0u; i < _threadCount; ++i)
+  {
+    this->dataPtr->workers.emplace_back(
+        &FrameEncoderPrivate::Work, this->dataPtr.get());
+  }
+}
+
+//////////////////////////////////////////////////
+FrameEncoder::~FrameEncoder()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->jobAdded.notify_all();
+  for (auto &worker : this->dataPtr->workers)
+    worker.join();
+}
+
+//////////////////////////////////////////////////
+unsigned int FrameEncoder::ThreadCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->workers.size());
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::SetEncodeFunction(EncodeFunction _encode)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->encode = std::move(_encode);
+}
+
+//////////////////////////////////////////////////
+std::future<std::vector<unsigned char>> FrameEncoder::Encode(
+    const Image &_image)
+{
+  // the caller may reuse its image, e.g. the next frame of a camera
+  auto image = std::make_shared<Image>(_image.Width(), _image.Height(),
+      _image.Format());
+  image->CopyFrom(_image);
+
+  auto promise = std::make_shared<std::promise<std::vector<unsigned char>>>();
+  auto future = promise->get_future();
+  FrameEncoderPrivate *data = this->dataPtr.get();
+  data->Push([data, image, promise]
+  {
+    std::vector<unsigned char> encoded;
+    if (!data->Encode(*image, encoded))
+      encoded.clear();
+    promise->set_value(std::move(encoded));
+  });
+  return future;
+}
+
+//////////////////////////////////////////////////
+std::future<bool> FrameEncoder::Save(const Image &_image,
+    const std::string &_filename)
+{
+  auto image = std::make_shared<Image>(_image.Width(), _image.Height(),
+      _image.Format());
+  image->CopyFrom(_image);
+
+  auto promise = std::make_shared<std::promise<bool>>();
+  auto future = promise->get_future();
+  FrameEncoderPrivate *data = this->dataPtr.get();
+  data->Push([data, image, promise, _filename]
+  {
+    std::vector<unsigned char> encoded;
+    if (!data->Encode(*image, encoded))
+      encoded.clear();
+    promise->set_value(WriteFrame(encoded, _filename));
+  });
+  return future;
+}
+
+//////////////////////////////////////////////////
+common::ConnectionPtr FrameEncoder::Record(const CameraPtr &_camera,
+    const std::string &_directory)
+{
+  if (!_camera)
+    return nullptr;
+
+  const std::string prefix =
+      common::joinPaths(_directory, _camera->Name() + "_");
+  auto frameCount = std::make_shared<std::atomic<uint64_t>>(0u);
+  return _camera->ConnectNewImageFrame(
+      [this, prefix, frameCount](const void *_data, unsigned int _width,
+          unsigned int _height, unsigned int /*_depth*/,
+          const std::string &_format)
+      {
+        // wraps the camera's buffer, Save copies it
+        Image frame(_width, _height, PixelUtil::Enum(_format),
+            const_cast<void *>(_data));
+        std::stringstream filename;
+        filename << prefix << std::setw(6) << std::setfill('0')
+                 << (*frameCount)++ << ".png";
+        this->Save(frame, filename.str());
+      });
+}
+
+//////////////////////////////////////////////////
+std::size_t FrameEncoder::PendingCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->pending;
+}
+
+//////////////////////////////////////////////////
+void FrameEncoder::Wait()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->jobDone.wait(lock, [this]
+  {
+    return this->dataPtr->pending == 0u;
+  });
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoder::EncodePng(const Image &_image,
+    std::vector<unsigned char> &_data)
+{
+  common::Image::PixelFormatType format;
+  switch (_image.Format())
+  {
+    case PF_L8:
+      format = common::Image::L_INT8;
+      break;
+    case PF_L16:
+      format = common::Image::L_INT16;
+      break;
+    case PF_R8G8B8:
+      format = common::Image::RGB_INT8;
+      break;
+    case PF_B8G8R8:
+      format = common::Image::BGR_INT8;
+      break;
+    case PF_R8G8B8A8:
+      format = common::Image::RGBA_INT8;
+      break;
+    default:
+      return false;
+  }
+
+  if (_image.Width() == 0u || _image.Height() == 0u || !_image.Data())
+    return false;
+
+  // common::Image expects tightly packed rows
+  const Image *packed = &_image;
+  Image copy;
+  if (!_image.IsPacked())
+  {
+    copy = Image(_image.Width(), _image.Height(), _image.Format());
+    copy.CopyFrom(_image);
+    packed = &copy;
+  }
+
+  common::Image image;
+  image.SetFromData(packed->Data<unsigned char>(), packed->Width(),
+      packed->Height(), format);
+  _data.clear();
+  image.SavePNGToBuffer(_data);
+  return !_data.empty();
+}
+
+//////////////////////////////////////////////////
+bool FrameEncoder::SavePng(const Image &_image, const std::string &_filename)
+{
+  std::vector<unsigned char> encoded;
+  if (!EncodePng(_image, encoded))
+    encoded.clear();
+  return WriteFrame(encoded, _filename);
+}
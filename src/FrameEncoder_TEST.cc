@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#include "gz/rendering/FrameEncoder.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, EncodePng)
+{
+  Image image(4u, 2u, PF_R8G8B8);
+  std::memset(image.Data(), 128, image.MemorySize());
+
+  FrameEncoder encoder(2u);
+  EXPECT_EQ(2u, encoder.ThreadCount());
+
+  std::vector<unsigned char> data = encoder.Encode(image).get();
+  ASSERT_GT(data.size(), 8u);
+  const unsigned char signature[] = {0x89, 'P', 'N', 'G'};
+  EXPECT_EQ(0, std::memcmp(signature, data.data(), sizeof(signature)));
+
+  // formats without a matching PNG layout cannot be encoded
+  Image floats(4u, 2u, PF_FLOAT32_R);
+  std::vector<unsigned char> unused;
+  EXPECT_FALSE(FrameEncoder::EncodePng(floats, unused));
+  EXPECT_TRUE(encoder.Encode(floats).get().empty());
+}
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, Save)
+{
+  Image image(4u, 2u, PF_L8);
+  std::memset(image.Data(), 255, image.MemorySize());
+
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "gz_frame_encoder_test.png";
+  std::filesystem::remove(path);
+
+  FrameEncoder encoder(1u);
+  std::future<bool> saved = encoder.Save(image, path.string());
+  encoder.Wait();
+  EXPECT_EQ(0u, encoder.PendingCount());
+  EXPECT_TRUE(saved.get());
+  EXPECT_TRUE(std::filesystem::exists(path));
+  EXPECT_GT(std::filesystem::file_size(path), 0u);
+  std::filesystem::remove(path);
+
+  EXPECT_TRUE(FrameEncoder::SavePng(image, path.string()));
+  EXPECT_TRUE(std::filesystem::exists(path));
+  std::filesystem::remove(path);
+}
+
+/////////////////////////////////////////////////
+TEST(FrameEncoderTest, EncodeFunction)
+{
+  FrameEncoder encoder(1u);
+  encoder.SetEncodeFunction(
+      [](const Image &_image, std::vector<unsigned char> &_data)
+      {
+        _data.assign(1u, static_cast<unsigned char>(_image.Width()));
+        return true;
+      });
+
+  Image image(7u, 1u, PF_FLOAT32_R);
+  std::vector<unsigned char> data = encoder.Encode(image).get();
+  ASSERT_EQ(1u, data.size());
+  EXPECT_EQ(7u, data[0]);
+}
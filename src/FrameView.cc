@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+
+#include "gz/rendering/FrameView.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Multiplier of the MurmurHash64A mix
+static const uint64_t kHashMultiplier = 0xc6a4a7935bd1e995ull;
+
+/// \brief Shift of the MurmurHash64A mix
+static const int kHashShift = 47;
+
+//////////////////////////////////////////////////
+uint64_t FrameView::Hash() const
+{
+  if (!this->data)
+    return 0u;
+
+  // MurmurHash64A over the pixels of each row, seeded with the frame
+  // layout so frames of different sizes or formats do not collide
+  const size_t rowSize = static_cast<size_t>(this->width) *
+      PixelUtil::BytesPerPixel(this->format);
+  uint64_t h = (static_cast<uint64_t>(this->width) << 32 | this->height) ^
+      (static_cast<uint64_t>(this->format) * kHashMultiplier) ^
+      (rowSize * this->height * kHashMultiplier);
+
+  for (unsigned int row = 0u; row < this->height; ++row)
+  {
+    const unsigned char *bytes = this->Row<unsigned char>(row);
+    size_t i = 0u;
+    for (; i + sizeof(uint64_t) <= rowSize; i += sizeof(uint64_t))
+    {
+      uint64_t k;
+      std::memcpy(&k, bytes + i, sizeof(k));
+      k *= kHashMultiplier;
+      k ^= k >> kHashShift;
+      k *= kHashMultiplier;
+      h ^= k;
+      h *= kHashMultiplier;
+    }
+    if (i < rowSize)
+    {
+      uint64_t k = 0u;
+      std::memcpy(&k, bytes + i, rowSize - i);
+      h ^= k;
+      h *= kHashMultiplier;
+    }
+  }
+
+  h ^= h >> kHashShift;
+  h *= kHashMultiplier;
+  h ^= h >> kHashShift;
+  return h;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "gz/rendering/FrameView.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(FrameViewTest, Hash)
+{
+  FrameView empty;
+  EXPECT_FALSE(empty);
+  EXPECT_EQ(0u, empty.Hash());
+
+  // 5x3 RGB frame, rows padded to 16 bytes
+  const unsigned int width = 5u;
+  const unsigned int height = 3u;
+  std::vector<uint8_t> padded(16u * height, 0xAAu);
+  for (unsigned int y = 0u; y < height; ++y)
+  {
+    for (unsigned int x = 0u; x < width * 3u; ++x)
+      padded[y * 16u + x] = static_cast<uint8_t>(y * 31u + x);
+  }
+  FrameView view;
+  view.data = padded.data();
+  view.width = width;
+  view.height = height;
+  view.rowPitch = 16u;
+  view.format = PF_R8G8B8;
+  const uint64_t hash = view.Hash();
+  EXPECT_NE(0u, hash);
+  EXPECT_EQ(hash, view.Hash());
+
+  // the padding does not change the hash
+  std::vector<uint8_t> tight(width * 3u * height);
+  for (unsigned int y = 0u; y < height; ++y)
+  {
+    for (unsigned int x = 0u; x < width * 3u; ++x)
+      tight[y * width * 3u + x] = padded[y * 16u + x];
+    padded[y * 16u + 15u] = 0x55u;
+  }
+  EXPECT_EQ(hash, view.Hash());
+  FrameView tightView = view;
+  tightView.data = tight.data();
+  tightView.rowPitch = width * 3u;
+  EXPECT_EQ(hash, tightView.Hash());
+
+  // any pixel change does
+  tight[7u] ^= 1u;
+  EXPECT_NE(hash, tightView.Hash());
+  tight[7u] ^= 1u;
+
+  // so does the layout of the same bytes
+  tightView.width = height;
+  tightView.height = width;
+  tightView.rowPitch = height * 3u;
+  EXPECT_NE(hash, tightView.Hash());
+}
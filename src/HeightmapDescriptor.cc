@@ -62,6 +62,12 @@ class gz::rendering::HeightmapDescriptorPrivate
   /// \brief Flag that enables/disables the terrain paging
   public: bool useTerrainPaging{false};
 
+  /// \brief Flag that enables/disables asynchronous data preparation
+  public: bool asyncLoading{false};
+
+  /// \brief Flag that keeps the heights in memory for height queries
+  public: bool heightQueries{false};
+
   /// \brief Number of samples per heightmap datum.
   public: unsigned int sampling{1u};
 
@@ -301,6 +307,30 @@ void HeightmapDescriptor::SetUseTerrainPaging(bool _useTerrainPaging)
   this->dataPtr->useTerrainPaging = _useTerrainPaging;
 }
 
+//////////////////////////////////////////////////
+bool HeightmapDescriptor::AsyncLoading() const
+{
+  return this->dataPtr->asyncLoading;
+}
+
+//////////////////////////////////////////////////
+void HeightmapDescriptor::SetAsyncLoading(bool _async)
+{
+  this->dataPtr->asyncLoading = _async;
+}
+
+//////////////////////////////////////////////////
+bool HeightmapDescriptor::HeightQueries() const
+{
+  return this->dataPtr->heightQueries;
+}
+
+//////////////////////////////////////////////////
+void HeightmapDescriptor::SetHeightQueries(bool _enabled)
+{
+  this->dataPtr->heightQueries = _enabled;
+}
+
 //////////////////////////////////////////////////
 unsigned int HeightmapDescriptor::Sampling() const
 {
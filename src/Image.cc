@@ -15,7 +15,11 @@
  *
  */
 
+#include <cstring>
 #include <memory>
+#include <utility>
+
+#include <gz/common/Console.hh>
 
 #include "gz/rendering/Image.hh"
 
@@ -34,6 +38,10 @@ class gz::rendering::Image::Implementation
   /// \brief Image pixel format
   public: PixelFormat format = PF_UNKNOWN;
 
+  /// \brief Number of bytes between the starts of two rows, 0 for
+  /// tightly packed rows
+  public: unsigned int rowStride = 0;
+
   /// \brief Pointer to the image data
   public: DataPtr data = nullptr;
 };
@@ -70,6 +78,35 @@ Image::Image(unsigned int _width, unsigned int _height,
       DataPtr(new unsigned char[size], ArrayDeleter<unsigned char>());
 }
 
+//////////////////////////////////////////////////
+Image::Image(unsigned int _width, unsigned int _height,
+  PixelFormat _format, void *_data, unsigned int _rowStride,
+  std::function<void(void *)> _deleter)
+  : dataPtr(utils::MakeImpl<Implementation>())
+{
+  _format = PixelUtil::Sanitize(_format);
+  const unsigned int rowSize = PixelUtil::MemorySize(_format, _width, 1u);
+  if (!_data || (_rowStride > 0u && _rowStride < rowSize))
+  {
+    gzerr << "Invalid image buffer, a row holds " << rowSize
+          << " bytes but the row stride is " << _rowStride << std::endl;
+    return;
+  }
+
+  this->dataPtr->width = _width;
+  this->dataPtr->height = _height;
+  this->dataPtr->format = _format;
+  if (_rowStride != rowSize)
+    this->dataPtr->rowStride = _rowStride;
+  auto deleter = [_deleter = std::move(_deleter)](unsigned char *_ptr)
+  {
+    if (_deleter)
+      _deleter(_ptr);
+  };
+  this->dataPtr->data =
+      DataPtr(static_cast<unsigned char *>(_data), std::move(deleter));
+}
+
 //////////////////////////////////////////////////
 Image::~Image() = default;
 
@@ -100,10 +137,55 @@ unsigned int Image::Depth() const
 //////////////////////////////////////////////////
 unsigned int Image::MemorySize() const
 {
+  if (this->dataPtr->rowStride > 0u)
+    return this->dataPtr->rowStride * this->dataPtr->height;
   return PixelUtil::MemorySize(this->dataPtr->format, this->dataPtr->width,
       this->dataPtr->height);
 }
 
+//////////////////////////////////////////////////
+unsigned int Image::RowStride() const
+{
+  if (this->dataPtr->rowStride > 0u)
+    return this->dataPtr->rowStride;
+  return PixelUtil::MemorySize(this->dataPtr->format, this->dataPtr->width,
+      1u);
+}
+
+//////////////////////////////////////////////////
+bool Image::IsPacked() const
+{
+  return this->dataPtr->rowStride == 0u;
+}
+
+//////////////////////////////////////////////////
+bool Image::CopyFrom(const Image &_image)
+{
+  if (_image.Width() != this->Width() || _image.Height() != this->Height() ||
+      _image.Format() != this->Format())
+  {
+    return false;
+  }
+  if (!this->Data() || !_image.Data())
+    return this->MemorySize() == 0u;
+
+  const unsigned int rowSize =
+      PixelUtil::MemorySize(this->Format(), this->Width(), 1u);
+  const unsigned char *src = _image.Data<unsigned char>();
+  unsigned char *dst = this->Data<unsigned char>();
+  if (this->IsPacked() && _image.IsPacked())
+  {
+    std::memcpy(dst, src, this->MemorySize());
+    return true;
+  }
+  for (unsigned int row = 0u; row < this->Height(); ++row)
+  {
+    std::memcpy(dst + row * this->RowStride(),
+        src + row * _image.RowStride(), rowSize);
+  }
+  return true;
+}
+
 //////////////////////////////////////////////////
 const void *Image::Data() const
 {
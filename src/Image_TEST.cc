@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gz/rendering/Image.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(ImageTest, Allocated)
+{
+  Image image(5u, 3u, PF_R8G8B8);
+  EXPECT_EQ(5u, image.Width());
+  EXPECT_EQ(3u, image.Height());
+  EXPECT_EQ(PF_R8G8B8, image.Format());
+  EXPECT_TRUE(image.IsPacked());
+  EXPECT_EQ(15u, image.RowStride());
+  EXPECT_EQ(45u, image.MemorySize());
+  EXPECT_NE(nullptr, image.Data());
+}
+
+/////////////////////////////////////////////////
+TEST(ImageTest, Wrapped)
+{
+  // rows padded to 16 bytes
+  std::vector<uint8_t> buffer(16u * 3u, 0u);
+  {
+    Image image(5u, 3u, PF_R8G8B8, buffer.data(), 16u);
+    EXPECT_EQ(buffer.data(), image.Data());
+    EXPECT_FALSE(image.IsPacked());
+    EXPECT_EQ(16u, image.RowStride());
+    EXPECT_EQ(48u, image.MemorySize());
+
+    // copies share the caller's buffer
+    Image copy = image;
+    EXPECT_EQ(buffer.data(), copy.Data());
+  }
+  // the caller keeps ownership without a deleter
+  EXPECT_EQ(0u, buffer[0]);
+
+  // a packed stride is the same as no stride
+  Image packed(5u, 3u, PF_R8G8B8, buffer.data(), 15u);
+  EXPECT_TRUE(packed.IsPacked());
+
+  // strides shorter than a row and null buffers are rejected
+  Image shortStride(5u, 3u, PF_R8G8B8, buffer.data(), 12u);
+  EXPECT_EQ(0u, shortStride.Width());
+  EXPECT_EQ(nullptr, shortStride.Data());
+  Image noData(5u, 3u, PF_R8G8B8, nullptr);
+  EXPECT_EQ(nullptr, noData.Data());
+}
+
+/////////////////////////////////////////////////
+TEST(ImageTest, Deleter)
+{
+  uint8_t *buffer = new uint8_t[4u * 2u];
+  unsigned int deleted = 0u;
+  {
+    Image image(4u, 2u, PF_L8, buffer, 0u,
+        [&deleted](void *_data)
+        {
+          delete [] static_cast<uint8_t *>(_data);
+          ++deleted;
+        });
+    Image copy = image;
+    EXPECT_EQ(0u, deleted);
+  }
+  EXPECT_EQ(1u, deleted);
+}
+
+/////////////////////////////////////////////////
+TEST(ImageTest, CopyFrom)
+{
+  Image src(2u, 2u, PF_L8);
+  uint8_t *srcData = src.Data<uint8_t>();
+  for (unsigned int i = 0u; i < 4u; ++i)
+    srcData[i] = static_cast<uint8_t>(i + 1u);
+
+  // only the pixels of the padded rows are written
+  std::vector<uint8_t> buffer(4u * 2u, 0u);
+  Image dst(2u, 2u, PF_L8, buffer.data(), 4u);
+  EXPECT_TRUE(dst.CopyFrom(src));
+  const std::vector<uint8_t> expected = {1u, 2u, 0u, 0u, 3u, 4u, 0u, 0u};
+  EXPECT_EQ(expected, buffer);
+
+  // and back into a packed image
+  Image packed(2u, 2u, PF_L8);
+  EXPECT_TRUE(packed.CopyFrom(dst));
+  EXPECT_EQ(0, std::memcmp(srcData, packed.Data(), 4u));
+
+  // the size and format must match
+  EXPECT_FALSE(packed.CopyFrom(Image(3u, 2u, PF_L8)));
+  EXPECT_FALSE(packed.CopyFrom(Image(2u, 2u, PF_R8G8B8)));
+}
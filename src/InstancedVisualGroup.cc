@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/InstancedVisualGroup.hh"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Mesh.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+/// \brief Private data for the InstancedVisualGroup class
+class gz::rendering::InstancedVisualGroupPrivate
+{
+  /// \brief Get the material to use for instances with the given color
+  /// \param[in] _color Diffuse color
+  /// \return Material shared by all instances with that color
+  public: MaterialPtr ColorMaterial(const math::Color &_color)
+  {
+    auto key = std::make_tuple(_color.R(), _color.G(), _color.B(),
+        _color.A());
+    auto it = this->colorMaterials.find(key);
+    if (it != this->colorMaterials.end())
+      return it->second;
+
+    MaterialPtr material = this->material->Clone();
+    material->SetDiffuse(_color);
+    material->SetAmbient(_color);
+    this->colorMaterials[key] = material;
+    return material;
+  }
+
+  /// \brief Scene the instances are created in
+  public: ScenePtr scene;
+
+  /// \brief Descriptor of the mesh every instance renders
+  public: MeshDescriptor meshDesc;
+
+  /// \brief Material shared by instances without their own color
+  public: MaterialPtr material;
+
+  /// \brief True if the group created the material itself
+  public: bool ownMaterial = false;
+
+  /// \brief Materials of instances with their own color, indexed by color
+  public: std::map<std::tuple<float, float, float, float>, MaterialPtr>
+      colorMaterials;
+
+  /// \brief Parent visual of all instances
+  public: VisualPtr visual;
+
+  /// \brief Instance visuals
+  public: std::vector<VisualPtr> instances;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+InstancedVisualGroup::InstancedVisualGroup(ScenePtr _scene,
+    const MeshDescriptor &_desc, MaterialPtr _material)
+  : dataPtr(std::make_unique<InstancedVisualGroupPrivate>())
+{
+  this->dataPtr->scene = _scene;
+  this->dataPtr->meshDesc = _desc;
+  this->dataPtr->material = _material;
+  if (!this->dataPtr->material)
+  {
+    this->dataPtr->material = _scene->CreateMaterial();
+    this->dataPtr->ownMaterial = true;
+  }
+  this->dataPtr->visual = _scene->CreateVisual();
+}
+
+//////////////////////////////////////////////////
+InstancedVisualGroup::~InstancedVisualGroup() = default;
+
+//////////////////////////////////////////////////
+VisualPtr InstancedVisualGroup::Visual() const
+{
+  return this->dataPtr->visual;
+}
+
+//////////////////////////////////////////////////
+unsigned int InstancedVisualGroup::AddInstance(const math::Pose3d &_pose)
+{
+  if (!this->dataPtr->visual)
+  {
+    gzerr << "Cannot add instance, group was destroyed" << std::endl;
+    return 0u;
+  }
+
+  MeshPtr mesh = this->dataPtr->scene->CreateMesh(this->dataPtr->meshDesc);
+  if (!mesh)
+  {
+    gzerr << "Failed to create instance mesh" << std::endl;
+    return 0u;
+  }
+
+  VisualPtr instance = this->dataPtr->scene->CreateVisual();
+  instance->AddGeometry(mesh);
+  instance->SetLocalPose(_pose);
+  // share the material instead of cloning it so identical instances can be
+  // batched by the render engine
+  instance->SetMaterial(this->dataPtr->material, false);
+  this->dataPtr->visual->AddChild(instance);
+  this->dataPtr->instances.push_back(instance);
+  return static_cast<unsigned int>(this->dataPtr->instances.size() - 1u);
+}
+
+//////////////////////////////////////////////////
+unsigned int InstancedVisualGroup::AddInstance(const math::Pose3d &_pose,
+    const math::Color &_color)
+{
+  unsigned int count = this->InstanceCount();
+  unsigned int index = this->AddInstance(_pose);
+  if (this->InstanceCount() > count)
+    this->SetInstanceColor(index, _color);
+  return index;
+}
+
+//////////////////////////////////////////////////
+unsigned int InstancedVisualGroup::InstanceCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->instances.size());
+}
+
+//////////////////////////////////////////////////
+VisualPtr InstancedVisualGroup::InstanceByIndex(unsigned int _index) const
+{
+  if (_index >= this->dataPtr->instances.size())
+    return VisualPtr();
+  return this->dataPtr->instances[_index];
+}
+
+//////////////////////////////////////////////////
+void InstancedVisualGroup::SetInstancePose(unsigned int _index,
+    const math::Pose3d &_pose)
+{
+  VisualPtr instance = this->InstanceByIndex(_index);
+  if (!instance)
+  {
+    gzerr << "Invalid instance index: " << _index << std::endl;
+    return;
+  }
+  instance->SetLocalPose(_pose);
+}
+
+//////////////////////////////////////////////////
+void InstancedVisualGroup::SetInstanceColor(unsigned int _index,
+    const math::Color &_color)
+{
+  VisualPtr instance = this->InstanceByIndex(_index);
+  if (!instance)
+  {
+    gzerr << "Invalid instance index: " << _index << std::endl;
+    return;
+  }
+  instance->SetMaterial(this->dataPtr->ColorMaterial(_color), false);
+}
+
+//////////////////////////////////////////////////
+void InstancedVisualGroup::Destroy()
+{
+  if (!this->dataPtr->visual)
+    return;
+
+  // materials are not unique so destroying the visuals leaves them intact
+  this->dataPtr->scene->DestroyVisual(this->dataPtr->visual, true);
+  this->dataPtr->visual.reset();
+  this->dataPtr->instances.clear();
+
+  for (auto &it : this->dataPtr->colorMaterials)
+    this->dataPtr->scene->DestroyMaterial(it.second);
+  this->dataPtr->colorMaterials.clear();
+
+  if (this->dataPtr->ownMaterial)
+    this->dataPtr->scene->DestroyMaterial(this->dataPtr->material);
+  this->dataPtr->material.reset();
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/LoadTrace.hh"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <gz/common/Console.hh>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Number of scopes of the current thread that are being timed
+static thread_local unsigned int tlScopeDepth = 0u;
+
+/// \brief Private data of LoadTrace
+class gz::rendering::LoadTracePrivate
+{
+  /// \brief Write a string as a JSON string literal
+  /// \param[in] _out Stream to write to
+  /// \param[in] _str String to write
+  public: static void WriteJsonString(std::ostream &_out,
+              const std::string &_str);
+
+  /// \brief True if phases are recorded. Atomic so that disabled scopes
+  /// do not lock the mutex.
+  public: std::atomic<bool> enabled{false};
+
+  /// \brief Time recording was first enabled since the last Clear
+  public: std::chrono::steady_clock::time_point origin;
+
+  /// \brief True if origin is set
+  public: bool hasOrigin = false;
+
+  /// \brief Path of the trace file written by WriteOutput
+  public: std::string outputPath;
+
+  /// \brief Recorded phases
+  public: std::vector<LoadTraceEvent> events;
+
+  /// \brief Index of every thread that recorded a phase
+  public: std::unordered_map<std::thread::id, unsigned int> threads;
+
+  /// \brief Protects all members but enabled
+  public: mutable std::mutex mutex;
+};
+
+//////////////////////////////////////////////////
+void LoadTracePrivate::WriteJsonString(std::ostream &_out,
+    const std::string &_str)
+{
+  _out << '"';
+  for (char c : _str)
+  {
+    switch (c)
+    {
+      case '"':
+        _out << "\\\"";
+        break;
+      case '\\':
+        _out << "\\\\";
+        break;
+      case '\n':
+        _out << "\\n";
+        break;
+      case '\t':
+        _out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20u)
+        {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x",
+              static_cast<unsigned int>(c));
+          _out << escaped;
+        }
+        else
+        {
+          _out << c;
+        }
+        break;
+    }
+  }
+  _out << '"';
+}
+
+//////////////////////////////////////////////////
+LoadTrace::LoadTrace()
+  : dataPtr(std::make_unique<LoadTracePrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+LoadTrace::~LoadTrace() = default;
+
+//////////////////////////////////////////////////
+void LoadTrace::SetEnabled(bool _enabled)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (_enabled && !this->dataPtr->hasOrigin)
+  {
+    this->dataPtr->origin = std::chrono::steady_clock::now();
+    this->dataPtr->hasOrigin = true;
+  }
+  this->dataPtr->enabled = _enabled;
+}
+
+//////////////////////////////////////////////////
+bool LoadTrace::Enabled() const
+{
+  return this->dataPtr->enabled;
+}
+
+//////////////////////////////////////////////////
+void LoadTrace::SetOutputPath(const std::string &_path)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->outputPath = _path;
+}
+
+//////////////////////////////////////////////////
+std::string LoadTrace::OutputPath() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->outputPath;
+}
+
+//////////////////////////////////////////////////
+void LoadTrace::Record(const LoadTraceEvent &_event)
+{
+  if (!this->dataPtr->enabled)
+    return;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  LoadTraceEvent event = _event;
+  auto it = this->dataPtr->threads.emplace(std::this_thread::get_id(),
+      static_cast<unsigned int>(this->dataPtr->threads.size()));
+  event.thread = it.first->second;
+  this->dataPtr->events.push_back(std::move(event));
+}
+
+//////////////////////////////////////////////////
+std::vector<LoadTraceEvent> LoadTrace::Events() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->events;
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, std::chrono::steady_clock::duration>
+    LoadTrace::Totals() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::map<std::string, std::chrono::steady_clock::duration> totals;
+  for (const auto &event : this->dataPtr->events)
+    totals[event.name] += event.duration;
+  return totals;
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::time_point LoadTrace::Origin() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->origin;
+}
+
+//////////////////////////////////////////////////
+void LoadTrace::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->events.clear();
+  this->dataPtr->threads.clear();
+  this->dataPtr->hasOrigin = this->dataPtr->enabled;
+  this->dataPtr->origin = std::chrono::steady_clock::now();
+}
+
+//////////////////////////////////////////////////
+bool LoadTrace::WriteChromeTrace(const std::string &_path) const
+{
+  std::vector<LoadTraceEvent> events = this->Events();
+
+  std::ofstream out(_path);
+  if (!out)
+  {
+    gzerr << "Unable to write load trace [" << _path << "]" << std::endl;
+    return false;
+  }
+
+  // complete events with times in microseconds, see the Trace Event Format
+  // document of the Chromium project
+  out << "{\"traceEvents\": [";
+  for (size_t i = 0; i < events.size(); ++i)
+  {
+    const LoadTraceEvent &event = events[i];
+    out << (i == 0u ? "\n" : ",\n") << "  {\"name\": ";
+    LoadTracePrivate::WriteJsonString(out, event.name);
+    out << ", \"cat\": ";
+    LoadTracePrivate::WriteJsonString(out, event.category);
+    out << ", \"ph\": \"X\", \"ts\": "
+        << std::chrono::duration<double, std::micro>(event.start).count()
+        << ", \"dur\": "
+        << std::chrono::duration<double, std::micro>(event.duration).count()
+        << ", \"pid\": 0, \"tid\": " << event.thread;
+    if (!event.detail.empty())
+    {
+      out << ", \"args\": {\"detail\": ";
+      LoadTracePrivate::WriteJsonString(out, event.detail);
+      out << "}";
+    }
+    out << "}";
+  }
+  out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+
+  if (!out)
+  {
+    gzerr << "Unable to write load trace [" << _path << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool LoadTrace::WriteOutput() const
+{
+  std::string path = this->OutputPath();
+  if (path.empty())
+    return true;
+
+  if (!this->WriteChromeTrace(path))
+    return false;
+  gzmsg << "Load trace written to [" << path << "]" << std::endl;
+  return true;
+}
+
+//////////////////////////////////////////////////
+LoadTraceScope::LoadTraceScope(LoadTrace &_trace, const char *_name,
+    const char *_category, const std::string &_detail)
+{
+  if (!_trace.Enabled())
+    return;
+
+  this->trace = &_trace;
+  this->name = _name;
+  this->category = _category;
+  this->detail = _detail;
+  ++tlScopeDepth;
+  this->start = std::chrono::steady_clock::now();
+}
+
+//////////////////////////////////////////////////
+LoadTraceScope::~LoadTraceScope()
+{
+  if (!this->trace)
+    return;
+
+  auto end = std::chrono::steady_clock::now();
+  --tlScopeDepth;
+
+  LoadTraceEvent event;
+  event.name = this->name;
+  event.category = this->category;
+  event.detail = this->detail;
+  event.start = this->start - this->trace->Origin();
+  event.duration = end - this->start;
+  event.depth = tlScopeDepth;
+  this->trace->Record(event);
+}
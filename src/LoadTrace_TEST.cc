@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gz/rendering/LoadTrace.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(LoadTraceTest, Disabled)
+{
+  LoadTrace trace;
+  EXPECT_FALSE(trace.Enabled());
+  EXPECT_TRUE(trace.OutputPath().empty());
+
+  // nothing is recorded while disabled
+  {
+    LoadTraceScope scope(trace, "a", "engine");
+  }
+  trace.Record(LoadTraceEvent());
+  EXPECT_TRUE(trace.Events().empty());
+  EXPECT_TRUE(trace.Totals().empty());
+
+  // a scope that started disabled is not recorded either
+  {
+    LoadTraceScope scope(trace, "a", "engine");
+    trace.SetEnabled(true);
+  }
+  EXPECT_TRUE(trace.Events().empty());
+
+  // without an output path there is nothing to write
+  EXPECT_TRUE(trace.WriteOutput());
+}
+
+/////////////////////////////////////////////////
+TEST(LoadTraceTest, Nesting)
+{
+  LoadTrace trace;
+  trace.SetEnabled(true);
+
+  {
+    LoadTraceScope outer(trace, "load", "engine");
+    {
+      LoadTraceScope inner(trace, "mesh", "mesh", "box");
+    }
+    {
+      LoadTraceScope inner(trace, "mesh", "mesh", "sphere");
+    }
+  }
+
+  // phases are recorded in the order they ended
+  auto events = trace.Events();
+  ASSERT_EQ(3u, events.size());
+  EXPECT_EQ("mesh", events[0].name);
+  EXPECT_EQ("mesh", events[0].category);
+  EXPECT_EQ("box", events[0].detail);
+  EXPECT_EQ(1u, events[0].depth);
+  EXPECT_EQ("sphere", events[1].detail);
+  EXPECT_EQ(1u, events[1].depth);
+  EXPECT_EQ("load", events[2].name);
+  EXPECT_EQ("engine", events[2].category);
+  EXPECT_TRUE(events[2].detail.empty());
+  EXPECT_EQ(0u, events[2].depth);
+
+  // the outer phase contains the nested ones
+  EXPECT_LE(events[2].start, events[0].start);
+  EXPECT_LE(events[0].start + events[0].duration, events[1].start);
+  EXPECT_GE(events[2].start + events[2].duration,
+      events[1].start + events[1].duration);
+
+  auto totals = trace.Totals();
+  ASSERT_EQ(2u, totals.size());
+  EXPECT_EQ(events[0].duration + events[1].duration, totals["mesh"]);
+  EXPECT_EQ(events[2].duration, totals["load"]);
+
+  trace.Clear();
+  EXPECT_TRUE(trace.Events().empty());
+  EXPECT_TRUE(trace.Enabled());
+}
+
+/////////////////////////////////////////////////
+TEST(LoadTraceTest, Threads)
+{
+  LoadTrace trace;
+  trace.SetEnabled(true);
+
+  {
+    LoadTraceScope scope(trace, "main", "engine");
+  }
+  std::thread worker([&trace]
+  {
+    // depth is tracked per thread
+    LoadTraceScope scope(trace, "worker", "mesh");
+  });
+  worker.join();
+
+  auto events = trace.Events();
+  ASSERT_EQ(2u, events.size());
+  EXPECT_EQ(0u, events[0].thread);
+  EXPECT_EQ(0u, events[0].depth);
+  EXPECT_EQ(1u, events[1].thread);
+  EXPECT_EQ(0u, events[1].depth);
+}
+
+/////////////////////////////////////////////////
+TEST(LoadTraceTest, WriteChromeTrace)
+{
+  LoadTrace trace;
+  trace.SetEnabled(true);
+  {
+    LoadTraceScope scope(trace, "load", "engine");
+    LoadTraceScope inner(trace, "texture", "texture", "a \"b\"\\c.png");
+  }
+
+  std::string path = testing::TempDir() + "/load_trace_test.json";
+  trace.SetOutputPath(path);
+  EXPECT_EQ(path, trace.OutputPath());
+  ASSERT_TRUE(trace.WriteOutput());
+
+  std::ifstream in(path);
+  ASSERT_TRUE(in.good());
+  std::stringstream ss;
+  ss << in.rdbuf();
+  std::string json = ss.str();
+  EXPECT_EQ(0u, json.find("{\"traceEvents\": ["));
+  EXPECT_NE(std::string::npos, json.find("\"name\": \"load\""));
+  EXPECT_NE(std::string::npos, json.find("\"cat\": \"texture\""));
+  EXPECT_NE(std::string::npos, json.find("\"ph\": \"X\""));
+  EXPECT_NE(std::string::npos,
+      json.find("\"args\": {\"detail\": \"a \\\"b\\\"\\\\c.png\"}"));
+  EXPECT_NE(std::string::npos, json.find("\"displayTimeUnit\": \"ms\""));
+  in.close();
+  std::remove(path.c_str());
+
+  // writing to a directory that does not exist fails
+  EXPECT_FALSE(trace.WriteChromeTrace(
+      testing::TempDir() + "/no_such_dir/load_trace_test.json"));
+}
@@ -15,6 +15,17 @@
  *
  */
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GZ_RENDERING_PIXELUTIL_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GZ_RENDERING_PIXELUTIL_NEON
+#endif
+
 #include <gz/common/Console.hh>
 
 #include "gz/rendering/PixelFormat.hh"
@@ -37,7 +48,9 @@ const char *PixelUtil::names[PF_COUNT] =
       "FLOAT32_RGBA",
       "FLOAT32_RGB",
       "L16",
-      "R8G8B8A8"
+      "R8G8B8A8",
+      "FLOAT16_RG",
+      "FLOAT16_R"
     };
 
 //////////////////////////////////////////////////
@@ -68,7 +81,11 @@ const unsigned char PixelUtil::channelCounts[PF_COUNT] =
       // PF_L16
       1,
       // PF_R8G8B8A8
-      4
+      4,
+      // PF_FLOAT16_RG
+      2,
+      // PF_FLOAT16_R
+      1
     };
 
 //////////////////////////////////////////////////
@@ -99,7 +116,11 @@ const unsigned char PixelUtil::channelByteCounts[PF_COUNT] =
       // PF_L16
       2,
       // PF_R8G8B8A8
-      1
+      1,
+      // PF_FLOAT16_RG
+      2,
+      // PF_FLOAT16_R
+      2
     };
 
 //////////////////////////////////////////////////
@@ -177,3 +198,89 @@ PixelFormat PixelUtil::Enum(const std::string &_name)
   // no match found
   return PF_UNKNOWN;
 }
+
+//////////////////////////////////////////////////
+void PixelUtil::PackFloat4ToFloat1(const float *_src, float *_dst,
+    unsigned int _count)
+{
+  unsigned int i = 0u;
+#if defined(GZ_RENDERING_PIXELUTIL_SSE2)
+  for (; i + 4u <= _count; i += 4u)
+  {
+    const float *p = _src + i * 4u;
+    __m128 ab = _mm_unpacklo_ps(_mm_loadu_ps(p), _mm_loadu_ps(p + 4u));
+    __m128 cd = _mm_unpacklo_ps(_mm_loadu_ps(p + 8u), _mm_loadu_ps(p + 12u));
+    _mm_storeu_ps(_dst + i, _mm_movelh_ps(ab, cd));
+  }
+#elif defined(GZ_RENDERING_PIXELUTIL_NEON)
+  for (; i + 4u <= _count; i += 4u)
+    vst1q_f32(_dst + i, vld4q_f32(_src + i * 4u).val[0]);
+#endif
+  for (; i < _count; ++i)
+    _dst[i] = _src[i * 4u];
+}
+
+//////////////////////////////////////////////////
+void PixelUtil::PackFloat4ToFloat3(const float *_src, float *_dst,
+    unsigned int _count)
+{
+  if (_count == 0u)
+    return;
+
+  // Each 16 byte pixel store overlaps the alpha of the previous one with the
+  // next pixel's first channel, which compilers turn into a single unaligned
+  // vector move. The last pixel is copied exactly to stay within _dst.
+  unsigned int i = 0u;
+  for (; i + 1u < _count; ++i)
+    std::memcpy(_dst + i * 3u, _src + i * 4u, 4u * sizeof(float));
+  std::memcpy(_dst + i * 3u, _src + i * 4u, 3u * sizeof(float));
+}
+
+//////////////////////////////////////////////////
+void PixelUtil::PackRgba8ToRgb8(const uint8_t *_src, uint8_t *_dst,
+    unsigned int _count)
+{
+  if (_count == 0u)
+    return;
+
+  unsigned int i = 0u;
+#if defined(GZ_RENDERING_PIXELUTIL_NEON)
+  for (; i + 16u < _count; i += 16u)
+  {
+    uint8x16x4_t rgba = vld4q_u8(_src + i * 4u);
+    uint8x16x3_t rgb = {{rgba.val[0], rgba.val[1], rgba.val[2]}};
+    vst3q_u8(_dst + i * 3u, rgb);
+  }
+#endif
+  // Same overlapping store as PackFloat4ToFloat3, 4 bytes at a time
+  for (; i + 1u < _count; ++i)
+    std::memcpy(_dst + i * 3u, _src + i * 4u, 4u);
+  std::memcpy(_dst + i * 3u, _src + i * 4u, 3u);
+}
+
+//////////////////////////////////////////////////
+void PixelUtil::WidenL8ToL16(const uint8_t *_src, uint16_t *_dst,
+    unsigned int _count)
+{
+  unsigned int i = 0u;
+#if defined(GZ_RENDERING_PIXELUTIL_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16u <= _count; i += 16u)
+  {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i),
+        _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i + 8u),
+        _mm_unpackhi_epi8(v, zero));
+  }
+#elif defined(GZ_RENDERING_PIXELUTIL_NEON)
+  for (; i + 16u <= _count; i += 16u)
+  {
+    uint8x16_t v = vld1q_u8(_src + i);
+    vst1q_u16(_dst + i, vmovl_u8(vget_low_u8(v)));
+    vst1q_u16(_dst + i + 8u, vmovl_u8(vget_high_u8(v)));
+  }
+#endif
+  for (; i < _count; ++i)
+    _dst[i] = _src[i];
+}
@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 #include "gz/rendering/PixelFormat.hh"
 
 using namespace gz;
@@ -64,6 +67,22 @@ TEST(PixelFormatTest, PixelUtil)
   EXPECT_EQ(4u, PixelUtil::BytesPerPixel(format));
   EXPECT_EQ(1u, PixelUtil::BytesPerChannel(format));
   EXPECT_EQ(4096u, PixelUtil::MemorySize(format, 32, 32));
+
+  format = PF_FLOAT16_RG;
+  EXPECT_EQ(4u, PixelUtil::BytesPerPixel(format));
+  EXPECT_EQ(2u, PixelUtil::BytesPerChannel(format));
+  EXPECT_EQ(2u, PixelUtil::ChannelCount(format));
+  EXPECT_EQ(4096u, PixelUtil::MemorySize(format, 32, 32));
+  EXPECT_EQ("FLOAT16_RG", PixelUtil::Name(format));
+  EXPECT_EQ(format, PixelUtil::Enum("FLOAT16_RG"));
+
+  format = PF_FLOAT16_R;
+  EXPECT_EQ(2u, PixelUtil::BytesPerPixel(format));
+  EXPECT_EQ(2u, PixelUtil::BytesPerChannel(format));
+  EXPECT_EQ(1u, PixelUtil::ChannelCount(format));
+  EXPECT_EQ(2048u, PixelUtil::MemorySize(format, 32, 32));
+  EXPECT_EQ("FLOAT16_R", PixelUtil::Name(format));
+  EXPECT_EQ(format, PixelUtil::Enum("FLOAT16_R"));
 }
 
 /////////////////////////////////////////////////
@@ -77,6 +96,51 @@ TEST(PixelFormatTest, PixelUtilInvalid)
   EXPECT_EQ(PF_UNKNOWN, PixelUtil::Enum("invalid"));
 }
 
+/////////////////////////////////////////////////
+TEST(PixelFormatTest, PackRows)
+{
+  // odd pixel counts exercise both the vector body and the scalar tail
+  for (unsigned int count : {0u, 1u, 3u, 17u, 37u})
+  {
+    std::vector<float> rgbaf(count * 4u);
+    std::vector<uint8_t> rgba8(count * 4u);
+    std::vector<uint8_t> l8(count);
+    for (unsigned int i = 0u; i < count * 4u; ++i)
+    {
+      rgbaf[i] = static_cast<float>(i) + 0.5f;
+      rgba8[i] = static_cast<uint8_t>(i * 7u);
+    }
+    for (unsigned int i = 0u; i < count; ++i)
+      l8[i] = static_cast<uint8_t>(255u - i);
+
+    // one extra element to detect writes past the end
+    std::vector<float> r(count + 1u, -1.0f);
+    std::vector<float> rgb(count * 3u + 1u, -1.0f);
+    std::vector<uint8_t> rgb8(count * 3u + 1u, 0xAB);
+    std::vector<uint16_t> l16(count + 1u, 0xABCD);
+
+    PixelUtil::PackFloat4ToFloat1(rgbaf.data(), r.data(), count);
+    PixelUtil::PackFloat4ToFloat3(rgbaf.data(), rgb.data(), count);
+    PixelUtil::PackRgba8ToRgb8(rgba8.data(), rgb8.data(), count);
+    PixelUtil::WidenL8ToL16(l8.data(), l16.data(), count);
+
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+      EXPECT_FLOAT_EQ(rgbaf[i * 4u], r[i]);
+      EXPECT_EQ(l8[i], l16[i]);
+      for (unsigned int c = 0u; c < 3u; ++c)
+      {
+        EXPECT_FLOAT_EQ(rgbaf[i * 4u + c], rgb[i * 3u + c]);
+        EXPECT_EQ(rgba8[i * 4u + c], rgb8[i * 3u + c]);
+      }
+    }
+    EXPECT_FLOAT_EQ(-1.0f, r[count]);
+    EXPECT_FLOAT_EQ(-1.0f, rgb[count * 3u]);
+    EXPECT_EQ(0xAB, rgb8[count * 3u]);
+    EXPECT_EQ(0xABCDu, l16[count]);
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
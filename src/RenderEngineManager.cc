@@ -17,6 +17,7 @@
 
 #include <map>
 #include <mutex>
+#include <set>
 
 #include <gz/common/Console.hh>
 #include <gz/common/SystemPaths.hh>
@@ -57,10 +58,27 @@ class gz::rendering::RenderEngineManagerPrivate
 
   /// \brief Unload the given render engine from an EngineMap iterator.
   /// The engine will remain registered and can be loaded again later.
+  /// If engines are recycled, only the scenes of the engine are
+  /// destroyed.
   /// \param[in] _iter EngineMap iterator
   /// \return True if the engine is unloaded
   public: bool UnloadEngine(EngineIter _iter);
 
+  /// \brief Destroy the given render engine and unload its plugin,
+  /// whether engines are recycled or not
+  /// \param[in] _iter EngineMap iterator
+  /// \return True if the engine is unloaded
+  public: bool DestroyEngine(EngineIter _iter);
+
+  /// \brief Check if an engine is loaded and not recycled
+  /// \param[in] _engine Engine to check, may be null
+  /// \return True if the engine can be used
+  public: bool IsActive(RenderEngine *_engine) const
+  {
+    return nullptr != _engine &&
+        this->recycledEngines.find(_engine) == this->recycledEngines.end();
+  }
+
   /// \brief Register default engines supplied by gz-rendering
   public: void RegisterDefaultEngines();
 
@@ -105,6 +123,17 @@ class gz::rendering::RenderEngineManagerPrivate
   /// \brief List which holds paths to look for engine plugins.
   public: std::list<std::string> pluginPaths;
 
+  /// \brief True to recycle engines when they are unloaded
+  public: bool recycle{false};
+
+  /// \brief Engines that were unloaded while recycling was enabled. They
+  /// are still loaded and are reused by the next Engine call.
+  public: std::set<RenderEngine *> recycledEngines;
+
+  /// \brief Parameters each engine was loaded with
+  public: std::map<RenderEngine *, std::map<std::string, std::string>>
+      engineParams;
+
   /// \brief Mutex to protect the engines map.
   public: std::recursive_mutex enginesMutex;
 };
@@ -172,7 +201,7 @@ bool RenderEngineManager::IsEngineLoaded(const std::string &_name) const
       return false;
   }
 
-  return nullptr != iter->second;
+  return this->dataPtr->IsActive(iter->second);
 }
 
 //////////////////////////////////////////////////
@@ -184,7 +213,7 @@ std::vector<std::string> RenderEngineManager::LoadedEngines() const
       this->dataPtr->engines)
   {
     std::string n = name;
-    if (nullptr != engine)
+    if (this->dataPtr->IsActive(engine))
     {
       // gz-rendering3 changed loaded engine names to the actual lib name.
       // For backward compatibility, return engine name if it is one of the
@@ -347,6 +376,29 @@ void RenderEngineManager::UnregisterEngineAt(unsigned int _index)
   this->dataPtr->UnregisterEngine(iter);
 }
 
+//////////////////////////////////////////////////
+void RenderEngineManager::SetRecycleEngines(bool _recycle)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->enginesMutex);
+  this->dataPtr->recycle = _recycle;
+  if (_recycle)
+    return;
+
+  auto &engines = this->dataPtr->engines;
+  for (auto iter = engines.begin(); iter != engines.end(); ++iter)
+  {
+    if (iter->second && this->dataPtr->recycledEngines.count(iter->second))
+      this->dataPtr->DestroyEngine(iter);
+  }
+}
+
+//////////////////////////////////////////////////
+bool RenderEngineManager::RecycleEngines() const
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->enginesMutex);
+  return this->dataPtr->recycle;
+}
+
 //////////////////////////////////////////////////
 void RenderEngineManager::SetPluginPaths(const std::list<std::string> &_paths)
 {
@@ -398,10 +450,34 @@ RenderEngine *RenderEngineManagerPrivate::Engine(EngineInfo _info,
   if (!engine)
     return nullptr;
 
+  std::lock_guard<std::recursive_mutex> lock(this->enginesMutex);
+  auto recycledIt = this->recycledEngines.find(engine);
+  if (recycledIt != this->recycledEngines.end())
+  {
+    this->recycledEngines.erase(recycledIt);
+    if (this->engineParams[engine] == _params)
+      return engine;
+
+    // the context and resources depend on the parameters
+    gzmsg << "Reloading recycled render-engine [" << engine->Name()
+          << "] with new parameters" << std::endl;
+    for (auto iter = this->engines.begin(); iter != this->engines.end();
+         ++iter)
+    {
+      if (iter->second == engine)
+      {
+        std::string name = iter->first;
+        this->DestroyEngine(iter);
+        return this->Engine({name, nullptr}, _params, _path);
+      }
+    }
+  }
+
   if (!engine->IsInitialized())
   {
     engine->Load(_params);
     engine->Init();
+    this->engineParams[engine] = _params;
   }
 
   return engine;
@@ -412,9 +488,29 @@ bool RenderEngineManagerPrivate::UnloadEngine(EngineIter _iter)
 {
   RenderEngine *engine = _iter->second;
 
+  if (!this->IsActive(engine))
+    return false;
+
+  if (this->recycle && engine->IsInitialized())
+  {
+    engine->DestroyScenes();
+    this->recycledEngines.insert(engine);
+    return true;
+  }
+
+  return this->DestroyEngine(_iter);
+}
+
+//////////////////////////////////////////////////
+bool RenderEngineManagerPrivate::DestroyEngine(EngineIter _iter)
+{
+  RenderEngine *engine = _iter->second;
+
   if (!engine)
     return false;
 
+  this->recycledEngines.erase(engine);
+  this->engineParams.erase(engine);
   engine->Destroy();
 
   return this->UnloadEnginePlugin(_iter->first);
@@ -607,5 +703,7 @@ void RenderEngineManagerPrivate::UnregisterEngine(EngineIter _iter)
   _iter->second->Destroy();
 
   std::lock_guard<std::recursive_mutex> lock(this->enginesMutex);
+  this->recycledEngines.erase(_iter->second);
+  this->engineParams.erase(_iter->second);
   this->engines.erase(_iter);
 }
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SceneChangeTracker.hh"
+
+#include <deque>
+#include <map>
+#include <utility>
+
+#include "gz/rendering/Node.hh"
+#include "gz/rendering/Sensor.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Maximum number of changes kept, older changes count as changes
+/// of the whole scene
+static const size_t kMaxChangeHistory = 4096u;
+
+/// \brief Private data for the SceneChangeTracker class
+class gz::rendering::SceneChangeTrackerPrivate
+{
+  /// \brief Record a change
+  /// \param[in] _box World box of the change, the whole scene if empty
+  public: void Record(const math::AxisAlignedBox &_box);
+
+  /// \brief Record the region of a node
+  /// \param[in] _node Node that changes
+  public: void RecordNode(const NodePtr &_node);
+
+  /// \brief True if changes are recorded
+  public: bool enabled = false;
+
+  /// \brief Sequence number of the last change
+  public: uint64_t changeCount = 0u;
+
+  /// \brief Sequence number of the last change of the whole scene
+  public: uint64_t globalChangeCount = 0u;
+
+  /// \brief Sequence numbers and world boxes of the latest changes, in
+  /// order
+  public: std::deque<std::pair<uint64_t, math::AxisAlignedBox>> history;
+
+  /// \brief Nodes that changed since the last Flush, by id
+  public: std::map<unsigned int, std::weak_ptr<Node>> pending;
+};
+
+//////////////////////////////////////////////////
+void SceneChangeTrackerPrivate::Record(const math::AxisAlignedBox &_box)
+{
+  ++this->changeCount;
+  if (_box == math::AxisAlignedBox())
+  {
+    this->globalChangeCount = this->changeCount;
+    return;
+  }
+
+  // forgotten changes count as changes of the whole scene
+  if (this->history.size() >= kMaxChangeHistory)
+  {
+    this->globalChangeCount = this->history.front().first;
+    this->history.pop_front();
+  }
+  this->history.emplace_back(this->changeCount, _box);
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTrackerPrivate::RecordNode(const NodePtr &_node)
+{
+  VisualPtr visual = std::dynamic_pointer_cast<Visual>(_node);
+  if (visual)
+  {
+    // visuals without anything visible change nothing
+    math::AxisAlignedBox box = visual->BoundingBox();
+    if (box != math::AxisAlignedBox())
+      this->Record(box);
+    return;
+  }
+
+  // cameras compare their own pose, but other nodes, e.g. lights, can
+  // change what every camera sees
+  if (std::dynamic_pointer_cast<Sensor>(_node) && _node->ChildCount() == 0u)
+    return;
+  this->Record(math::AxisAlignedBox());
+}
+
+//////////////////////////////////////////////////
+SceneChangeTracker::SceneChangeTracker()
+  : dataPtr(std::make_unique<SceneChangeTrackerPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+SceneChangeTracker::~SceneChangeTracker() = default;
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::SetEnabled(bool _enabled)
+{
+  if (_enabled == this->dataPtr->enabled)
+    return;
+
+  this->dataPtr->enabled = _enabled;
+  this->Reset();
+}
+
+//////////////////////////////////////////////////
+bool SceneChangeTracker::Enabled() const
+{
+  return this->dataPtr->enabled;
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::MarkChanged()
+{
+  if (this->dataPtr->enabled)
+    this->dataPtr->Record(math::AxisAlignedBox());
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::MarkChanged(const math::AxisAlignedBox &_box)
+{
+  if (this->dataPtr->enabled)
+    this->dataPtr->Record(_box);
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::MarkNodeChanged(const NodePtr &_node)
+{
+  if (!this->dataPtr->enabled || !_node)
+    return;
+
+  // only the region before the first change of a frame is needed
+  auto inserted = this->dataPtr->pending.emplace(_node->Id(), _node);
+  if (inserted.second)
+    this->dataPtr->RecordNode(_node);
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::Flush()
+{
+  if (this->dataPtr->pending.empty())
+    return;
+
+  // nodes destroyed in the meantime only changed where they were
+  std::map<unsigned int, std::weak_ptr<Node>> pending;
+  pending.swap(this->dataPtr->pending);
+  for (auto &it : pending)
+  {
+    NodePtr node = it.second.lock();
+    if (node)
+      this->dataPtr->RecordNode(node);
+  }
+}
+
+//////////////////////////////////////////////////
+uint64_t SceneChangeTracker::ChangeCount() const
+{
+  return this->dataPtr->changeCount;
+}
+
+//////////////////////////////////////////////////
+bool SceneChangeTracker::ChangedSince(uint64_t _count) const
+{
+  return this->dataPtr->changeCount > _count;
+}
+
+//////////////////////////////////////////////////
+bool SceneChangeTracker::ChangedSince(uint64_t _count,
+    const math::Frustum &_frustum) const
+{
+  if (this->dataPtr->globalChangeCount > _count)
+    return true;
+
+  const auto &history = this->dataPtr->history;
+  for (auto it = history.rbegin(); it != history.rend(); ++it)
+  {
+    if (it->first <= _count)
+      break;
+    if (_frustum.Contains(it->second))
+      return true;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+void SceneChangeTracker::Reset()
+{
+  this->dataPtr->pending.clear();
+  this->dataPtr->history.clear();
+  this->dataPtr->Record(math::AxisAlignedBox());
+}
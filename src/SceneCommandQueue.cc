@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SceneCommandQueue.hh"
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Node.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Kinds of scene commands
+enum class SceneCommandType
+{
+  /// \brief Visual world pose, see Scene::SetWorldPoses
+  WORLD_POSE,
+
+  /// \brief Node::SetLocalPose
+  LOCAL_POSE,
+
+  /// \brief Visual::SetVisible
+  VISIBLE,
+
+  /// \brief Visual::SetMaterial
+  MATERIAL,
+
+  /// \brief Arbitrary function
+  FUNCTION
+};
+
+/// \brief A queued scene command, linked to the command enqueued before it
+struct SceneCommand
+{
+  /// \brief Kind of command
+  SceneCommandType type = SceneCommandType::FUNCTION;
+
+  /// \brief Id of the node or visual the command applies to
+  unsigned int id = 0u;
+
+  /// \brief Pose of pose commands
+  math::Pose3d pose;
+
+  /// \brief Flag of visibility commands, or unique flag of material
+  /// commands
+  bool flag = false;
+
+  /// \brief Material name of material commands
+  std::string materialName;
+
+  /// \brief Function of function commands
+  std::function<void(Scene &)> function;
+
+  /// \brief Next command in the list
+  SceneCommand *next = nullptr;
+};
+
+/// \brief Private data for the SceneCommandQueue class
+class gz::rendering::SceneCommandQueuePrivate
+{
+  /// \brief Push a command. Lock-free, safe to call from any thread.
+  /// \param[in] _command Command to push, owned by the queue afterwards
+  public: void Push(SceneCommand *_command)
+  {
+    _command->next = this->head.load(std::memory_order_relaxed);
+    while (!this->head.compare_exchange_weak(_command->next, _command,
+        std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  /// \brief Take all pending commands
+  /// \return Pending commands in the order they were enqueued
+  public: SceneCommand *TakeAll()
+  {
+    SceneCommand *list = this->head.exchange(nullptr,
+        std::memory_order_acquire);
+
+    // the list is last in, first out
+    SceneCommand *ordered = nullptr;
+    while (list)
+    {
+      SceneCommand *next = list->next;
+      list->next = ordered;
+      ordered = list;
+      list = next;
+    }
+    return ordered;
+  }
+
+  /// \brief Most recently enqueued command
+  public: std::atomic<SceneCommand *> head{nullptr};
+};
+
+//////////////////////////////////////////////////
+SceneCommandQueue::SceneCommandQueue()
+  : dataPtr(std::make_unique<SceneCommandQueuePrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+SceneCommandQueue::~SceneCommandQueue()
+{
+  SceneCommand *command = this->dataPtr->TakeAll();
+  while (command)
+  {
+    SceneCommand *next = command->next;
+    delete command;
+    command = next;
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneCommandQueue::SetWorldPose(unsigned int _visualId,
+    const math::Pose3d &_pose)
+{
+  auto command = new SceneCommand;
+  command->type = SceneCommandType::WORLD_POSE;
+  command->id = _visualId;
+  command->pose = _pose;
+  this->dataPtr->Push(command);
+}
+
+//////////////////////////////////////////////////
+void SceneCommandQueue::SetLocalPose(unsigned int _nodeId,
+    const math::Pose3d &_pose)
+{
+  auto command = new SceneCommand;
+  command->type = SceneCommandType::LOCAL_POSE;
+  command->id = _nodeId;
+  command->pose = _pose;
+  this->dataPtr->Push(command);
+}
+
+//////////////////////////////////////////////////
+void SceneCommandQueue::SetVisible(unsigned int _visualId, bool _visible)
+{
+  auto command = new SceneCommand;
+  command->type = SceneCommandType::VISIBLE;
+  command->id = _visualId;
+  command->flag = _visible;
+  this->dataPtr->Push(command);
+}
+
+//////////////////////////////////////////////////
+void SceneCommandQueue::SetMaterial(unsigned int _visualId,
+    const std::string &_materialName, bool _unique)
+{
+  auto command = new SceneCommand;
+  command->type = SceneCommandType::MATERIAL;
+  command->id = _visualId;
+  command->materialName = _materialName;
+  command->flag = _unique;
+  this->dataPtr->Push(command);
+}
+
+//////////////////////////////////////////////////
+void SceneCommandQueue::Enqueue(std::function<void(Scene &)> _command)
+{
+  if (!_command)
+    return;
+
+  auto command = new SceneCommand;
+  command->type = SceneCommandType::FUNCTION;
+  command->function = std::move(_command);
+  this->dataPtr->Push(command);
+}
+
+//////////////////////////////////////////////////
+bool SceneCommandQueue::Empty() const
+{
+  return this->dataPtr->head.load(std::memory_order_acquire) == nullptr;
+}
+
+//////////////////////////////////////////////////
+unsigned int SceneCommandQueue::Apply(Scene &_scene)
+{
+  SceneCommand *command = this->dataPtr->TakeAll();
+  if (!command)
+    return 0u;
+
+  // consecutive world poses are set in bulk, e.g. all links of a physics
+  // step
+  std::vector<unsigned int> ids;
+  std::vector<math::Pose3d> poses;
+  auto flushPoses = [&]()
+  {
+    if (ids.empty())
+      return;
+    _scene.SetWorldPoses(ids, poses);
+    ids.clear();
+    poses.clear();
+  };
+
+  unsigned int count = 0u;
+  while (command)
+  {
+    std::unique_ptr<SceneCommand> current(command);
+    command = command->next;
+    ++count;
+
+    if (current->type == SceneCommandType::WORLD_POSE)
+    {
+      ids.push_back(current->id);
+      poses.push_back(current->pose);
+      continue;
+    }
+    flushPoses();
+
+    switch (current->type)
+    {
+      case SceneCommandType::LOCAL_POSE:
+      {
+        NodePtr node = _scene.NodeById(current->id);
+        if (node)
+          node->SetLocalPose(current->pose);
+        break;
+      }
+      case SceneCommandType::VISIBLE:
+      {
+        VisualPtr visual = _scene.VisualById(current->id);
+        if (visual)
+          visual->SetVisible(current->flag);
+        break;
+      }
+      case SceneCommandType::MATERIAL:
+      {
+        VisualPtr visual = _scene.VisualById(current->id);
+        MaterialPtr material = _scene.Material(current->materialName);
+        if (visual && material)
+          visual->SetMaterial(material, current->flag);
+        break;
+      }
+      case SceneCommandType::FUNCTION:
+        current->function(_scene);
+        break;
+      default:
+        break;
+    }
+  }
+  flushPoses();
+  return count;
+}
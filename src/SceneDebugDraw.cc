@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SceneDebugDraw.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/math/Helpers.hh>
+
+#include "gz/rendering/Marker.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Text.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Lines of one color, drawn by a single marker
+struct DebugDrawBatch
+{
+  /// \brief Line color
+  math::Color color;
+
+  /// \brief Line list marker, created on first use
+  MarkerPtr marker;
+
+  /// \brief Unlit material of the marker
+  MaterialPtr material;
+
+  /// \brief Positions of the line end points drawn since the last Flush,
+  /// 3 floats per point
+  std::vector<float> points;
+
+  /// \brief True if the marker shows the lines of the previous frame
+  bool drawn = false;
+};
+
+/// \brief A text label drawn since the last Flush
+struct DebugDrawLabel
+{
+  /// \brief Position of the label
+  math::Vector3d position;
+
+  /// \brief Text of the label
+  std::string text;
+
+  /// \brief Text color
+  math::Color color;
+
+  /// \brief Character height
+  double height = 0.2;
+};
+
+/// \brief A visual showing a text label, reused across frames
+struct DebugDrawTextSlot
+{
+  /// \brief Visual positioning the text
+  VisualPtr visual;
+
+  /// \brief Text geometry
+  TextPtr text;
+};
+
+/// \brief Private data for the SceneDebugDraw class
+class gz::rendering::SceneDebugDrawPrivate
+{
+  /// \brief Add a line to the batch of its color
+  /// \param[in] _start Start point
+  /// \param[in] _end End point
+  /// \param[in] _color Line color
+  public: void AddLine(const math::Vector3d &_start,
+              const math::Vector3d &_end, const math::Color &_color)
+  {
+    DebugDrawBatch &batch = this->batches[_color.AsRGBA()];
+    batch.color = _color;
+    batch.points.insert(batch.points.end(), {
+        static_cast<float>(_start.X()), static_cast<float>(_start.Y()),
+        static_cast<float>(_start.Z()), static_cast<float>(_end.X()),
+        static_cast<float>(_end.Y()), static_cast<float>(_end.Z())});
+  }
+
+  /// \brief Create the visual holding the debug geometry if needed
+  /// \param[in] _scene Scene to create it in
+  public: void CreateVisual(Scene &_scene)
+  {
+    if (this->visual)
+      return;
+    this->visual = _scene.CreateVisual();
+    this->visual->SetVisibilityFlags(this->visibilityFlags);
+    _scene.RootVisual()->AddChild(this->visual);
+  }
+
+  /// \brief Create the marker and material of a batch
+  /// \param[in] _scene Scene to create them in
+  /// \param[in] _batch Batch to create them for
+  public: void CreateMarker(Scene &_scene, DebugDrawBatch &_batch)
+  {
+    _batch.material = _scene.CreateMaterial();
+    _batch.material->SetAmbient(_batch.color);
+    _batch.material->SetDiffuse(_batch.color);
+    _batch.material->SetEmissive(_batch.color);
+    _batch.material->SetLightingEnabled(false);
+    _batch.material->SetCastShadows(false);
+
+    _batch.marker = _scene.CreateMarker();
+    _batch.marker->SetType(MT_LINE_LIST);
+    _batch.marker->SetMaterial(_batch.material, false);
+    this->visual->AddGeometry(_batch.marker);
+  }
+
+  /// \brief Visual holding all debug geometry, created on first use
+  public: VisualPtr visual;
+
+  /// \brief Line batches, keyed by color
+  public: std::map<math::Color::RGBA, DebugDrawBatch> batches;
+
+  /// \brief Labels drawn since the last Flush
+  public: std::vector<DebugDrawLabel> labels;
+
+  /// \brief Visuals showing labels
+  public: std::vector<DebugDrawTextSlot> textSlots;
+
+  /// \brief True if the render engine does not support text
+  public: bool textUnsupported = false;
+
+  /// \brief Visibility flags of the debug geometry
+  public: uint32_t visibilityFlags = GZ_VISIBILITY_ALL;
+};
+
+//////////////////////////////////////////////////
+SceneDebugDraw::SceneDebugDraw()
+  : dataPtr(std::make_unique<SceneDebugDrawPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+SceneDebugDraw::~SceneDebugDraw() = default;
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Line(const math::Vector3d &_start,
+    const math::Vector3d &_end, const math::Color &_color)
+{
+  this->dataPtr->AddLine(_start, _end, _color);
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Arrow(const math::Vector3d &_start,
+    const math::Vector3d &_end, const math::Color &_color, double _headSize)
+{
+  const math::Vector3d dir = _end - _start;
+  const double length = dir.Length();
+  if (length <= 0.0)
+    return;
+
+  this->dataPtr->AddLine(_start, _end, _color);
+
+  // the head is a wire pyramid with its apex at the tip
+  const math::Vector3d axis = dir / length;
+  math::Vector3d u = axis.Cross(math::Vector3d::UnitZ);
+  if (u.Length() < 1e-6)
+    u = axis.Cross(math::Vector3d::UnitX);
+  u.Normalize();
+  const math::Vector3d v = axis.Cross(u);
+
+  const double headLength = length * _headSize;
+  const math::Vector3d base = _end - axis * headLength;
+  const double halfWidth = headLength * 0.5;
+  this->dataPtr->AddLine(_end, base + u * halfWidth, _color);
+  this->dataPtr->AddLine(_end, base - u * halfWidth, _color);
+  this->dataPtr->AddLine(_end, base + v * halfWidth, _color);
+  this->dataPtr->AddLine(_end, base - v * halfWidth, _color);
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Axes(const math::Pose3d &_pose, double _length)
+{
+  const math::Vector3d &origin = _pose.Pos();
+  this->Arrow(origin, origin + _pose.Rot() * math::Vector3d(_length, 0, 0),
+      math::Color::Red);
+  this->Arrow(origin, origin + _pose.Rot() * math::Vector3d(0, _length, 0),
+      math::Color::Green);
+  this->Arrow(origin, origin + _pose.Rot() * math::Vector3d(0, 0, _length),
+      math::Color::Blue);
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Box(const math::Pose3d &_pose,
+    const math::Vector3d &_size, const math::Color &_color)
+{
+  // corner i has the max coordinate along axis k if bit k of i is set
+  const math::Vector3d half = _size * 0.5;
+  math::Vector3d corners[8];
+  for (unsigned int i = 0u; i < 8u; ++i)
+  {
+    const math::Vector3d corner(
+        (i & 1u) ? half.X() : -half.X(),
+        (i & 2u) ? half.Y() : -half.Y(),
+        (i & 4u) ? half.Z() : -half.Z());
+    corners[i] = _pose.Pos() + _pose.Rot() * corner;
+  }
+
+  for (unsigned int i = 0u; i < 8u; ++i)
+  {
+    for (unsigned int bit = 1u; bit < 8u; bit <<= 1u)
+    {
+      if (!(i & bit))
+        this->dataPtr->AddLine(corners[i], corners[i | bit], _color);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Sphere(const math::Vector3d &_center, double _radius,
+    const math::Color &_color, unsigned int _segments)
+{
+  _segments = std::max(_segments, 3u);
+
+  // point of circle _plane at _angle: 0 is XY, 1 is XZ and 2 is YZ
+  auto point = [&](unsigned int _plane, double _angle)
+  {
+    const double c = _radius * std::cos(_angle);
+    const double s = _radius * std::sin(_angle);
+    if (_plane == 0u)
+      return _center + math::Vector3d(c, s, 0);
+    if (_plane == 1u)
+      return _center + math::Vector3d(c, 0, s);
+    return _center + math::Vector3d(0, c, s);
+  };
+
+  const double step = 2.0 * GZ_PI / _segments;
+  for (unsigned int plane = 0u; plane < 3u; ++plane)
+  {
+    math::Vector3d prev = point(plane, 0.0);
+    for (unsigned int i = 1u; i <= _segments; ++i)
+    {
+      const math::Vector3d next = point(plane, step * i);
+      this->dataPtr->AddLine(prev, next, _color);
+      prev = next;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Text(const math::Vector3d &_position,
+    const std::string &_text, const math::Color &_color, double _height)
+{
+  this->dataPtr->labels.push_back({_position, _text, _color, _height});
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Clear()
+{
+  for (auto &it : this->dataPtr->batches)
+    it.second.points.clear();
+  this->dataPtr->labels.clear();
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Reset()
+{
+  this->Clear();
+  this->dataPtr->visual.reset();
+  this->dataPtr->textSlots.clear();
+  this->dataPtr->batches.clear();
+}
+
+//////////////////////////////////////////////////
+size_t SceneDebugDraw::LineCount() const
+{
+  size_t count = 0u;
+  for (const auto &it : this->dataPtr->batches)
+    count += it.second.points.size() / 6u;
+  return count;
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::SetVisibilityFlags(uint32_t _flags)
+{
+  this->dataPtr->visibilityFlags = _flags;
+  if (this->dataPtr->visual)
+    this->dataPtr->visual->SetVisibilityFlags(_flags);
+}
+
+//////////////////////////////////////////////////
+uint32_t SceneDebugDraw::VisibilityFlags() const
+{
+  return this->dataPtr->visibilityFlags;
+}
+
+//////////////////////////////////////////////////
+void SceneDebugDraw::Flush(Scene &_scene)
+{
+  SceneDebugDrawPrivate &data = *this->dataPtr;
+
+  // the debug visual was destroyed by someone else
+  if (data.visual && !_scene.HasVisual(data.visual))
+  {
+    this->Reset();
+  }
+
+  for (auto &it : data.batches)
+  {
+    DebugDrawBatch &batch = it.second;
+    if (batch.points.empty())
+    {
+      // keep the marker of the color for the next frames
+      if (batch.drawn)
+        batch.marker->ClearPoints();
+      batch.drawn = false;
+      continue;
+    }
+
+    data.CreateVisual(_scene);
+    if (!batch.marker)
+      data.CreateMarker(_scene, batch);
+
+    batch.marker->SetPoints(batch.points.data(), nullptr,
+        batch.points.size() / 3u);
+    batch.points.clear();
+    batch.drawn = true;
+  }
+
+  size_t slot = 0u;
+  for (const DebugDrawLabel &label : data.labels)
+  {
+    if (data.textUnsupported)
+      break;
+
+    if (slot == data.textSlots.size())
+    {
+      TextPtr text = _scene.CreateText();
+      if (!text)
+      {
+        gzwarn << "Debug draw text labels are not supported by the render "
+               << "engine" << std::endl;
+        data.textUnsupported = true;
+        break;
+      }
+      data.CreateVisual(_scene);
+      DebugDrawTextSlot newSlot;
+      newSlot.visual = _scene.CreateVisual();
+      newSlot.text = text;
+      newSlot.visual->AddGeometry(text);
+      data.visual->AddChild(newSlot.visual);
+      data.textSlots.push_back(newSlot);
+    }
+
+    DebugDrawTextSlot &textSlot = data.textSlots[slot++];
+    textSlot.text->SetTextString(label.text);
+    textSlot.text->SetColor(label.color);
+    textSlot.text->SetCharHeight(static_cast<float>(label.height));
+    textSlot.visual->SetLocalPosition(label.position);
+    textSlot.visual->SetVisible(true);
+  }
+  for (; slot < data.textSlots.size(); ++slot)
+    data.textSlots[slot].visual->SetVisible(false);
+  data.labels.clear();
+}
@@ -0,0 +1,380 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SceneMarkerPool.hh"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Duration of a tick of the timer wheel
+static const std::chrono::steady_clock::duration kMarkerTick =
+    std::chrono::milliseconds(10);
+
+/// \brief Number of slots of the timer wheel, i.e. ticks per revolution
+static const int64_t kMarkerSlotCount = 256;
+
+/// \brief A marker managed by the pool
+struct PooledMarker
+{
+  /// \brief The marker
+  MarkerPtr marker;
+
+  /// \brief Visual positioning the marker
+  VisualPtr visual;
+
+  /// \brief Scene time the marker expires at, zero if it does not expire
+  std::chrono::steady_clock::duration expiry{0};
+
+  /// \brief Incremented whenever the marker is scheduled or retired, so
+  /// outdated timers are ignored
+  uint32_t generation = 0u;
+
+  /// \brief True if the marker was acquired and is not retired
+  bool active = false;
+};
+
+/// \brief Timer of the wheel
+struct MarkerTimer
+{
+  /// \brief Id of the marker, see Object::Id
+  unsigned int markerId = 0u;
+
+  /// \brief Generation of the marker the timer was scheduled for
+  uint32_t generation = 0u;
+
+  /// \brief Scene time the marker expires at
+  std::chrono::steady_clock::duration expiry{0};
+};
+
+/// \brief Private data for the SceneMarkerPool class
+class gz::rendering::SceneMarkerPoolPrivate
+{
+  /// \brief Get the tick a scene time falls in
+  /// \param[in] _time Scene time
+  /// \return Tick
+  public: static int64_t Tick(std::chrono::steady_clock::duration _time)
+  {
+    return static_cast<int64_t>(_time / kMarkerTick);
+  }
+
+  /// \brief Get the slot of the wheel of a tick
+  /// \param[in] _tick Tick
+  /// \return Slot index
+  public: static size_t Slot(int64_t _tick)
+  {
+    return static_cast<size_t>(
+        ((_tick % kMarkerSlotCount) + kMarkerSlotCount) % kMarkerSlotCount);
+  }
+
+  /// \brief Schedule the expiry of a marker
+  /// \param[in] _entry Marker to schedule
+  /// \param[in] _markerId Id of the marker
+  public: void Schedule(PooledMarker &_entry, unsigned int _markerId)
+  {
+    ++_entry.generation;
+    if (_entry.expiry == std::chrono::steady_clock::duration::zero())
+      return;
+
+    // the first tick that starts at or after the expiry, so every timer of
+    // a slot that is reached has expired, unless it is for a later
+    // revolution
+    int64_t tick = Tick(_entry.expiry);
+    if (std::chrono::steady_clock::duration(tick * kMarkerTick) <
+        _entry.expiry)
+    {
+      ++tick;
+    }
+    tick = std::max(tick, this->lastTick + 1);
+    this->wheel[Slot(tick)].push_back(
+        {_markerId, _entry.generation, _entry.expiry});
+  }
+
+  /// \brief Retire an active marker
+  /// \param[in] _entry Marker to retire
+  public: void Retire(PooledMarker &_entry)
+  {
+    _entry.active = false;
+    ++_entry.generation;
+    _entry.marker->ClearPoints();
+    _entry.visual->SetVisible(false);
+    VisualPtr parent = _entry.visual->Parent();
+    if (parent)
+      parent->RemoveChild(_entry.visual);
+    this->free[_entry.marker->Type()].push_back(_entry.marker->Id());
+    --this->activeCount;
+  }
+
+  /// \brief Retire the markers of a slot that expired
+  /// \param[in] _slot Slot of the wheel
+  /// \param[in] _now Current scene time
+  public: void ExpireSlot(std::vector<MarkerTimer> &_slot,
+              std::chrono::steady_clock::duration _now)
+  {
+    size_t kept = 0u;
+    for (size_t i = 0u; i < _slot.size(); ++i)
+    {
+      MarkerTimer timer = _slot[i];
+      auto it = this->markers.find(timer.markerId);
+      if (it == this->markers.end() || !it->second.active ||
+          it->second.generation != timer.generation)
+      {
+        continue;
+      }
+      if (timer.expiry <= _now)
+      {
+        this->Retire(it->second);
+        continue;
+      }
+      // due in a later revolution of the wheel
+      _slot[kept++] = timer;
+    }
+    _slot.resize(kept);
+  }
+
+  /// \brief Timer wheel, one slot per tick of a revolution
+  public: std::array<std::vector<MarkerTimer>, kMarkerSlotCount> wheel;
+
+  /// \brief Last tick whose slot was processed
+  public: int64_t lastTick = 0;
+
+  /// \brief Scene time of the last update
+  public: std::chrono::steady_clock::duration lastTime{0};
+
+  /// \brief All markers of the pool, indexed by marker id
+  public: std::unordered_map<unsigned int, PooledMarker> markers;
+
+  /// \brief Ids of the retired markers of each type
+  public: std::map<MarkerType, std::vector<unsigned int>> free;
+
+  /// \brief Number of active markers
+  public: unsigned int activeCount = 0u;
+
+  /// \brief Maximum number of retired markers kept per type
+  public: unsigned int maxPooledPerType = 256u;
+};
+
+//////////////////////////////////////////////////
+SceneMarkerPool::SceneMarkerPool()
+  : dataPtr(std::make_unique<SceneMarkerPoolPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+SceneMarkerPool::~SceneMarkerPool() = default;
+
+//////////////////////////////////////////////////
+MarkerPtr SceneMarkerPool::Acquire(Scene &_scene, MarkerType _type,
+    std::chrono::steady_clock::duration _lifetime, VisualPtr _parent)
+{
+  if (!_parent)
+    _parent = _scene.RootVisual();
+  if (!_parent)
+    return MarkerPtr();
+
+  PooledMarker *entry = nullptr;
+  unsigned int markerId = 0u;
+
+  // reuse a retired marker of the same type whose visual still exists
+  auto &freeIds = this->dataPtr->free[_type];
+  while (!freeIds.empty() && !entry)
+  {
+    markerId = freeIds.back();
+    freeIds.pop_back();
+    auto it = this->dataPtr->markers.find(markerId);
+    if (it == this->dataPtr->markers.end())
+      continue;
+    if (!_scene.HasVisual(it->second.visual))
+    {
+      this->dataPtr->markers.erase(it);
+      continue;
+    }
+    entry = &it->second;
+  }
+
+  if (entry)
+  {
+    entry->visual->SetLocalPose(math::Pose3d::Zero);
+    entry->visual->SetLocalScale(1.0);
+    entry->visual->SetVisibilityFlags(GZ_VISIBILITY_ALL);
+    entry->visual->SetVisible(true);
+    entry->marker->SetLayer(0);
+    entry->marker->SetSize(1.0);
+  }
+  else
+  {
+    MarkerPtr marker = _scene.CreateMarker();
+    VisualPtr visual = _scene.CreateVisual();
+    if (!marker || !visual)
+    {
+      gzerr << "Unable to create a pooled marker" << std::endl;
+      return MarkerPtr();
+    }
+    marker->SetType(_type);
+    visual->AddGeometry(marker);
+    markerId = marker->Id();
+    entry = &this->dataPtr->markers[markerId];
+    entry->marker = marker;
+    entry->visual = visual;
+  }
+
+  _parent->AddChild(entry->visual);
+  entry->active = true;
+  ++this->dataPtr->activeCount;
+
+  entry->marker->SetLifetime(_lifetime);
+  entry->expiry = _lifetime > std::chrono::steady_clock::duration::zero() ?
+      _scene.Time() + _lifetime : std::chrono::steady_clock::duration::zero();
+  this->dataPtr->Schedule(*entry, markerId);
+  return entry->marker;
+}
+
+//////////////////////////////////////////////////
+bool SceneMarkerPool::Renew(Scene &_scene, const MarkerPtr &_marker,
+    std::chrono::steady_clock::duration _lifetime)
+{
+  if (!_marker)
+    return false;
+  auto it = this->dataPtr->markers.find(_marker->Id());
+  if (it == this->dataPtr->markers.end() || !it->second.active)
+    return false;
+
+  PooledMarker &entry = it->second;
+  entry.marker->SetLifetime(_lifetime);
+  entry.expiry = _lifetime > std::chrono::steady_clock::duration::zero() ?
+      _scene.Time() + _lifetime : std::chrono::steady_clock::duration::zero();
+  this->dataPtr->Schedule(entry, it->first);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SceneMarkerPool::Release(const MarkerPtr &_marker)
+{
+  if (!_marker)
+    return false;
+  auto it = this->dataPtr->markers.find(_marker->Id());
+  if (it == this->dataPtr->markers.end() || !it->second.active)
+    return false;
+  this->dataPtr->Retire(it->second);
+  return true;
+}
+
+//////////////////////////////////////////////////
+unsigned int SceneMarkerPool::ActiveCount() const
+{
+  return this->dataPtr->activeCount;
+}
+
+//////////////////////////////////////////////////
+unsigned int SceneMarkerPool::PooledCount() const
+{
+  size_t count = 0u;
+  for (const auto &it : this->dataPtr->free)
+    count += it.second.size();
+  return static_cast<unsigned int>(count);
+}
+
+//////////////////////////////////////////////////
+void SceneMarkerPool::SetMaxPooledPerType(unsigned int _count)
+{
+  this->dataPtr->maxPooledPerType = _count;
+}
+
+//////////////////////////////////////////////////
+unsigned int SceneMarkerPool::MaxPooledPerType() const
+{
+  return this->dataPtr->maxPooledPerType;
+}
+
+//////////////////////////////////////////////////
+void SceneMarkerPool::Update(Scene &_scene)
+{
+  const std::chrono::steady_clock::duration now = _scene.Time();
+  const int64_t nowTick = SceneMarkerPoolPrivate::Tick(now);
+
+  if (now < this->dataPtr->lastTime)
+  {
+    // the scene time was reset, keep the remaining lifetimes from now on
+    for (auto &slot : this->dataPtr->wheel)
+      slot.clear();
+    this->dataPtr->lastTick = nowTick;
+    for (auto &it : this->dataPtr->markers)
+    {
+      PooledMarker &entry = it.second;
+      if (!entry.active ||
+          entry.expiry == std::chrono::steady_clock::duration::zero())
+      {
+        continue;
+      }
+      entry.expiry = now + std::max(entry.expiry - this->dataPtr->lastTime,
+          std::chrono::steady_clock::duration(1));
+      this->dataPtr->Schedule(entry, it.first);
+    }
+  }
+  else if (nowTick > this->dataPtr->lastTick)
+  {
+    // process each slot at most once, even if many revolutions passed
+    const int64_t first = std::max(this->dataPtr->lastTick + 1,
+        nowTick - kMarkerSlotCount + 1);
+    for (int64_t tick = first; tick <= nowTick; ++tick)
+    {
+      this->dataPtr->ExpireSlot(
+          this->dataPtr->wheel[SceneMarkerPoolPrivate::Slot(tick)], now);
+    }
+    this->dataPtr->lastTick = nowTick;
+  }
+  this->dataPtr->lastTime = now;
+
+  // destroy the retired markers the pool does not keep
+  for (auto &it : this->dataPtr->free)
+  {
+    auto &freeIds = it.second;
+    while (freeIds.size() > this->dataPtr->maxPooledPerType)
+    {
+      auto markerIt = this->dataPtr->markers.find(freeIds.back());
+      freeIds.pop_back();
+      if (markerIt == this->dataPtr->markers.end())
+        continue;
+      if (_scene.HasVisual(markerIt->second.visual))
+        _scene.DestroyVisual(markerIt->second.visual);
+      this->dataPtr->markers.erase(markerIt);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneMarkerPool::Reset()
+{
+  for (auto &slot : this->dataPtr->wheel)
+    slot.clear();
+  this->dataPtr->markers.clear();
+  this->dataPtr->free.clear();
+  this->dataPtr->activeCount = 0u;
+  this->dataPtr->lastTick = 0;
+  this->dataPtr->lastTime = std::chrono::steady_clock::duration::zero();
+}
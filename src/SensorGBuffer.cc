@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SensorGBuffer.hh"
+
+#include <map>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/DepthCamera.hh"
+#include "gz/rendering/RenderEngine.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/ThermalCamera.hh"
+#include "gz/rendering/Visual.hh"
+
+/// \brief Private data for the SensorGBuffer class
+class gz::rendering::SensorGBufferPrivate
+{
+  /// \brief Add a camera that renders some of the outputs
+  /// \param[in] _camera Camera, ignored if null
+  /// \param[in] _outputs Outputs the camera renders
+  public: void AddCamera(const CameraPtr &_camera,
+              const std::vector<GBufferOutput> &_outputs)
+  {
+    if (!_camera)
+      return;
+
+    for (GBufferOutput output : _outputs)
+      this->outputCameras[output] = _camera;
+    this->visual->AddChild(_camera);
+    this->cameras.push_back(_camera);
+  }
+
+  /// \brief Scene the cameras are created in
+  public: ScenePtr scene;
+
+  /// \brief Parent visual of all cameras
+  public: VisualPtr visual;
+
+  /// \brief Camera of every output
+  public: std::map<GBufferOutput, CameraPtr> outputCameras;
+
+  /// \brief Distinct cameras, one per scene render
+  public: std::vector<CameraPtr> cameras;
+};
+
+using namespace gz;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+SensorGBuffer::SensorGBuffer(ScenePtr _scene,
+    const std::set<GBufferOutput> &_outputs)
+  : dataPtr(std::make_unique<SensorGBufferPrivate>())
+{
+  this->dataPtr->scene = _scene;
+  this->dataPtr->visual = _scene->CreateVisual();
+
+  auto has = [&_outputs](GBufferOutput _output)
+  {
+    return _outputs.count(_output) > 0;
+  };
+
+  // the depth camera also produces the colour of its render
+  if (has(GBufferOutput::DEPTH))
+  {
+    std::vector<GBufferOutput> outputs = {GBufferOutput::DEPTH};
+    if (has(GBufferOutput::COLOR))
+      outputs.push_back(GBufferOutput::COLOR);
+    this->dataPtr->AddCamera(_scene->CreateDepthCamera(), outputs);
+  }
+  else if (has(GBufferOutput::COLOR))
+  {
+    this->dataPtr->AddCamera(_scene->CreateCamera(),
+        {GBufferOutput::COLOR});
+  }
+
+  // the panoptic mode produces the label and the instance id at once
+  if (has(GBufferOutput::LABEL) || has(GBufferOutput::INSTANCE))
+  {
+    std::vector<GBufferOutput> outputs;
+    if (has(GBufferOutput::LABEL))
+      outputs.push_back(GBufferOutput::LABEL);
+    if (has(GBufferOutput::INSTANCE))
+      outputs.push_back(GBufferOutput::INSTANCE);
+
+    SegmentationCameraPtr camera = _scene->CreateSegmentationCamera();
+    if (camera)
+    {
+      camera->SetSegmentationType(has(GBufferOutput::INSTANCE) ?
+          SegmentationType::ST_PANOPTIC : SegmentationType::ST_SEMANTIC);
+    }
+    this->dataPtr->AddCamera(camera, outputs);
+  }
+
+  if (has(GBufferOutput::TEMPERATURE))
+  {
+    this->dataPtr->AddCamera(_scene->CreateThermalCamera(),
+        {GBufferOutput::TEMPERATURE});
+  }
+
+  if (this->dataPtr->outputCameras.size() < _outputs.size())
+  {
+    gzwarn << "Some sensor outputs are not supported by: "
+           << _scene->Engine()->Name() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+SensorGBuffer::~SensorGBuffer() = default;
+
+//////////////////////////////////////////////////
+VisualPtr SensorGBuffer::Visual() const
+{
+  return this->dataPtr->visual;
+}
+
+//////////////////////////////////////////////////
+std::set<GBufferOutput> SensorGBuffer::Outputs() const
+{
+  std::set<GBufferOutput> outputs;
+  for (const auto &it : this->dataPtr->outputCameras)
+    outputs.insert(it.first);
+  return outputs;
+}
+
+//////////////////////////////////////////////////
+CameraPtr SensorGBuffer::OutputCamera(GBufferOutput _output) const
+{
+  auto it = this->dataPtr->outputCameras.find(_output);
+  if (it == this->dataPtr->outputCameras.end())
+    return CameraPtr();
+  return it->second;
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorGBuffer::RenderCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->cameras.size());
+}
+
+//////////////////////////////////////////////////
+void SensorGBuffer::SetImageSize(unsigned int _width, unsigned int _height)
+{
+  for (auto &camera : this->dataPtr->cameras)
+  {
+    camera->SetImageWidth(_width);
+    camera->SetImageHeight(_height);
+    camera->SetAspectRatio(static_cast<double>(_width) / _height);
+  }
+}
+
+//////////////////////////////////////////////////
+void SensorGBuffer::SetHFOV(const math::Angle &_hfov)
+{
+  for (auto &camera : this->dataPtr->cameras)
+    camera->SetHFOV(_hfov);
+}
+
+//////////////////////////////////////////////////
+void SensorGBuffer::SetClipPlanes(double _near, double _far)
+{
+  for (auto &camera : this->dataPtr->cameras)
+  {
+    camera->SetNearClipPlane(_near);
+    camera->SetFarClipPlane(_far);
+  }
+}
+
+//////////////////////////////////////////////////
+void SensorGBuffer::Update()
+{
+  if (this->dataPtr->cameras.empty())
+    return;
+
+  std::vector<SensorPtr> sensors(this->dataPtr->cameras.begin(),
+      this->dataPtr->cameras.end());
+  this->dataPtr->scene->RenderSensors(sensors);
+}
+
+//////////////////////////////////////////////////
+void SensorGBuffer::Destroy()
+{
+  if (!this->dataPtr->visual)
+    return;
+
+  for (auto &camera : this->dataPtr->cameras)
+    this->dataPtr->scene->DestroySensor(camera);
+  this->dataPtr->cameras.clear();
+  this->dataPtr->outputCameras.clear();
+
+  this->dataPtr->scene->DestroyVisual(this->dataPtr->visual);
+  this->dataPtr->visual.reset();
+}
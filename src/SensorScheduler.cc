@@ -0,0 +1,450 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/SensorScheduler.hh"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/GpuRays.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/WideAngleCamera.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Scheduling state of a sensor
+struct SensorScheduleEntry
+{
+  /// \brief The sensor
+  SensorPtr sensor;
+
+  /// \brief Update period
+  std::chrono::steady_clock::duration period{0};
+
+  /// \brief Maximum time the sensor may be postponed, zero for no limit
+  std::chrono::steady_clock::duration deadline{0};
+
+  /// \brief Scene time the sensor is next due at
+  std::chrono::steady_clock::duration next{0};
+
+  /// \brief Number of camera passes the sensor costs
+  unsigned int cost = 1u;
+
+  /// \brief True until the sensor is due for the first time
+  bool pending = true;
+
+  /// \brief Number of updates
+  uint64_t updateCount = 0u;
+
+  /// \brief Scene time of the first update
+  std::chrono::steady_clock::duration firstUpdate{0};
+
+  /// \brief Scene time of the last update
+  std::chrono::steady_clock::duration lastUpdate{0};
+
+  /// \brief Number of times the sensor was deferred by the time budget
+  uint64_t deferCount = 0u;
+
+  /// \brief Number of times the sensor was rendered past the time budget
+  uint64_t reducedCount = 0u;
+};
+
+/// \brief Private data for the SensorScheduler class
+class gz::rendering::SensorSchedulerPrivate
+{
+  /// \brief Find the entry of a sensor
+  /// \param[in] _sensor Sensor to find
+  /// \return Entry of the sensor, null if it is not scheduled
+  public: SensorScheduleEntry *Find(const SensorPtr &_sensor)
+  {
+    for (auto &entry : this->entries)
+    {
+      if (entry.sensor == _sensor)
+        return &entry;
+    }
+    return nullptr;
+  }
+
+  /// \brief Scene whose sensors are scheduled
+  public: ScenePtr scene;
+
+  /// \brief Scheduled sensors
+  public: std::vector<SensorScheduleEntry> entries;
+
+  /// \brief Maximum number of passes per GPU flush, 0 to follow the scene
+  public: unsigned int passBudget = 0u;
+
+  /// \brief Maximum number of passes per Update, 0 for no limit
+  public: unsigned int maxPassesPerStep = 0u;
+
+  /// \brief Wall-clock time one Update may take, zero for no limit
+  public: std::chrono::steady_clock::duration timeBudget{0};
+
+  /// \brief Factor applied to the LOD bias of sensors past the budget
+  public: double reducedLodBias = 1.0;
+};
+
+//////////////////////////////////////////////////
+SensorScheduler::SensorScheduler(ScenePtr _scene)
+  : dataPtr(std::make_unique<SensorSchedulerPrivate>())
+{
+  this->dataPtr->scene = _scene;
+}
+
+//////////////////////////////////////////////////
+SensorScheduler::~SensorScheduler() = default;
+
+//////////////////////////////////////////////////
+bool SensorScheduler::AddSensor(const SensorPtr &_sensor, double _rate,
+    std::chrono::steady_clock::duration _deadline)
+{
+  if (!std::dynamic_pointer_cast<Camera>(_sensor))
+  {
+    gzerr << "Only cameras can be scheduled" << std::endl;
+    return false;
+  }
+  if (!this->dataPtr->scene || !this->dataPtr->scene->HasSensor(_sensor))
+  {
+    gzerr << "Sensor [" << _sensor->Name() << "] does not belong to the "
+          << "scheduler's scene" << std::endl;
+    return false;
+  }
+  if (!(_rate > 0.0))
+  {
+    gzerr << "Invalid update rate for sensor [" << _sensor->Name() << "]: "
+          << _rate << std::endl;
+    return false;
+  }
+
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  if (!entry)
+  {
+    this->dataPtr->entries.emplace_back();
+    entry = &this->dataPtr->entries.back();
+    entry->sensor = _sensor;
+    // cube map based sensors render one pass per face
+    if (std::dynamic_pointer_cast<WideAngleCamera>(_sensor) ||
+        std::dynamic_pointer_cast<GpuRays>(_sensor))
+    {
+      entry->cost = 6u;
+    }
+  }
+  entry->period = std::chrono::duration_cast<
+      std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(1.0 / _rate));
+  entry->deadline = _deadline;
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::RemoveSensor(const SensorPtr &_sensor)
+{
+  auto &entries = this->dataPtr->entries;
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+      [&_sensor](const SensorScheduleEntry &_entry)
+      {
+        return _entry.sensor == _sensor;
+      }), entries.end());
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorScheduler::SensorCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->entries.size());
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::SetSensorCost(const SensorPtr &_sensor,
+    unsigned int _passes)
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  if (!entry)
+  {
+    gzerr << "Sensor is not scheduled" << std::endl;
+    return;
+  }
+  entry->cost = std::max(_passes, 1u);
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorScheduler::SensorCost(const SensorPtr &_sensor) const
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  return entry ? entry->cost : 0u;
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::SetPassBudget(unsigned int _passes)
+{
+  this->dataPtr->passBudget = std::max(_passes, 1u);
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorScheduler::PassBudget() const
+{
+  if (this->dataPtr->passBudget > 0u)
+    return this->dataPtr->passBudget;
+  if (this->dataPtr->scene &&
+      this->dataPtr->scene->CameraPassCountPerGpuFlush() > 0u)
+  {
+    return this->dataPtr->scene->CameraPassCountPerGpuFlush();
+  }
+  return 6u;
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::SetMaxPassesPerStep(unsigned int _passes)
+{
+  this->dataPtr->maxPassesPerStep = _passes;
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorScheduler::MaxPassesPerStep() const
+{
+  return this->dataPtr->maxPassesPerStep;
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::SetTimeBudget(
+    std::chrono::steady_clock::duration _budget)
+{
+  this->dataPtr->timeBudget =
+      std::max(_budget, std::chrono::steady_clock::duration::zero());
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration SensorScheduler::TimeBudget() const
+{
+  return this->dataPtr->timeBudget;
+}
+
+//////////////////////////////////////////////////
+void SensorScheduler::SetReducedLodBias(double _factor)
+{
+  if (!(_factor > 0.0))
+  {
+    gzerr << "Invalid level of detail bias factor: " << _factor
+          << std::endl;
+    return;
+  }
+  this->dataPtr->reducedLodBias = std::min(_factor, 1.0);
+}
+
+//////////////////////////////////////////////////
+double SensorScheduler::ReducedLodBias() const
+{
+  return this->dataPtr->reducedLodBias;
+}
+
+//////////////////////////////////////////////////
+unsigned int SensorScheduler::Update()
+{
+  if (!this->dataPtr->scene)
+    return 0u;
+
+  const auto updateStart = std::chrono::steady_clock::now();
+
+  // forget sensors that were destroyed
+  auto &entries = this->dataPtr->entries;
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+      [this](const SensorScheduleEntry &_entry)
+      {
+        return !this->dataPtr->scene->HasSensor(_entry.sensor);
+      }), entries.end());
+
+  const std::chrono::steady_clock::duration now =
+      this->dataPtr->scene->Time();
+
+  // keep the cadence unless the sensor fell more than a period behind
+  auto advance = [&now](SensorScheduleEntry &_entry)
+  {
+    _entry.next += _entry.period;
+    if (_entry.next <= now)
+      _entry.next = now + _entry.period;
+  };
+
+  std::vector<SensorScheduleEntry *> due;
+  for (auto &entry : entries)
+  {
+    if (entry.pending)
+    {
+      entry.next = now;
+      entry.pending = false;
+    }
+    if (entry.next > now)
+      continue;
+
+    // idle sensors keep their slot in the cadence but cost no passes
+    if (entry.sensor->IsIdle())
+    {
+      advance(entry);
+      continue;
+    }
+    due.push_back(&entry);
+  }
+  if (due.empty())
+    return 0u;
+
+  // sensors beyond their deadline first, then the longest waiting ones
+  auto overdue = [&now](const SensorScheduleEntry *_entry)
+  {
+    return _entry->deadline > std::chrono::steady_clock::duration::zero() &&
+        now - _entry->next >= _entry->deadline;
+  };
+  std::stable_sort(due.begin(), due.end(),
+      [&overdue](const SensorScheduleEntry *_a, const SensorScheduleEntry *_b)
+      {
+        const bool overdueA = overdue(_a);
+        const bool overdueB = overdue(_b);
+        if (overdueA != overdueB)
+          return overdueA;
+        return _a->next < _b->next;
+      });
+
+  // pick the sensors that fit in the step, the others stay due
+  std::vector<SensorScheduleEntry *> selected;
+  unsigned int stepPasses = 0u;
+  for (SensorScheduleEntry *entry : due)
+  {
+    if (this->dataPtr->maxPassesPerStep > 0u && !selected.empty() &&
+        stepPasses + entry->cost > this->dataPtr->maxPassesPerStep &&
+        !overdue(entry))
+    {
+      continue;
+    }
+    selected.push_back(entry);
+    stepPasses += entry->cost;
+  }
+
+  // the cost of a sensor is estimated from its last timings
+  const auto timeBudget = this->dataPtr->timeBudget;
+  RenderStats stats;
+  if (timeBudget > std::chrono::steady_clock::duration::zero())
+    stats = this->dataPtr->scene->Stats();
+  auto estimate = [&stats](const SensorScheduleEntry *_entry)
+  {
+    auto it = stats.sensors.find(_entry->sensor->Name());
+    if (it == stats.sensors.end())
+      return std::chrono::steady_clock::duration::zero();
+    return it->second.preRenderTime + it->second.renderTime +
+        it->second.postRenderTime;
+  };
+
+  // split the step into GPU flush batches
+  const unsigned int budget = this->PassBudget();
+  unsigned int batchCount = 0u;
+  unsigned int renderCount = 0u;
+  std::vector<SensorPtr> batch;
+  unsigned int batchPasses = 0u;
+  std::chrono::steady_clock::duration batchEstimate{0};
+  std::vector<std::pair<CameraPtr, double>> reduced;
+  auto flush = [&]()
+  {
+    if (batch.empty())
+      return;
+    this->dataPtr->scene->RenderSensors(batch);
+    for (auto &camera : reduced)
+      camera.first->SetLodBias(camera.second);
+    reduced.clear();
+    batch.clear();
+    batchPasses = 0u;
+    batchEstimate = std::chrono::steady_clock::duration::zero();
+    ++batchCount;
+  };
+  for (SensorScheduleEntry *entry : selected)
+  {
+    if (batchPasses > 0u && batchPasses + entry->cost > budget)
+      flush();
+
+    // defer sensors that do not fit in the rest of the time budget
+    if (timeBudget > std::chrono::steady_clock::duration::zero() &&
+        renderCount > 0u)
+    {
+      const auto cost = estimate(entry);
+      const auto elapsed = std::chrono::steady_clock::now() - updateStart;
+      if (elapsed + batchEstimate + cost > timeBudget)
+      {
+        if (!overdue(entry))
+        {
+          ++entry->deferCount;
+          continue;
+        }
+        CameraPtr camera = std::dynamic_pointer_cast<Camera>(entry->sensor);
+        if (camera && this->dataPtr->reducedLodBias < 1.0)
+        {
+          reduced.emplace_back(camera, camera->LodBias());
+          camera->SetLodBias(
+              camera->LodBias() * this->dataPtr->reducedLodBias);
+        }
+        ++entry->reducedCount;
+      }
+      batchEstimate += cost;
+    }
+    ++renderCount;
+
+    batch.push_back(entry->sensor);
+    batchPasses += entry->cost;
+
+    if (entry->updateCount == 0u)
+      entry->firstUpdate = now;
+    entry->lastUpdate = now;
+    ++entry->updateCount;
+    advance(*entry);
+  }
+  flush();
+
+  return batchCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t SensorScheduler::UpdateCount(const SensorPtr &_sensor) const
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  return entry ? entry->updateCount : 0u;
+}
+
+//////////////////////////////////////////////////
+uint64_t SensorScheduler::DeferCount(const SensorPtr &_sensor) const
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  return entry ? entry->deferCount : 0u;
+}
+
+//////////////////////////////////////////////////
+uint64_t SensorScheduler::ReducedCount(const SensorPtr &_sensor) const
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  return entry ? entry->reducedCount : 0u;
+}
+
+//////////////////////////////////////////////////
+double SensorScheduler::AchievedRate(const SensorPtr &_sensor) const
+{
+  SensorScheduleEntry *entry = this->dataPtr->Find(_sensor);
+  if (!entry || entry->updateCount < 2u)
+    return 0.0;
+  const double seconds = std::chrono::duration<double>(
+      entry->lastUpdate - entry->firstUpdate).count();
+  if (seconds <= 0.0)
+    return 0.0;
+  return static_cast<double>(entry->updateCount - 1u) / seconds;
+}
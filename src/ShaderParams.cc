@@ -18,6 +18,7 @@
 #include "gz/rendering/ShaderParams.hh"
 
 #include <unordered_map>
+#include <vector>
 
 using namespace gz::rendering;
 
@@ -27,10 +28,35 @@ class gz::rendering::ShaderParamsPrivate
   /// \brief collection of parameters
   public: std::unordered_map<std::string, ShaderParam> parameters;
 
-  /// \brief true if the parameters have been modified since last cleared
+  /// \brief Registered param, see ShaderParams::Register
+  public: struct Registration
+  {
+    /// \brief Param in the map. Map nodes are stable across rehashes.
+    std::pair<const std::string, ShaderParam> *param = nullptr;
+
+    /// \brief Registered type
+    ShaderParam::ParamType type = ShaderParam::PARAM_NONE;
+
+    /// \brief True if the param was accessed since last cleared
+    bool isDirty = false;
+  };
+
+  /// \brief Registered params, indexed by handle
+  public: std::vector<Registration> registrations;
+
+  /// \brief true if the parameters have been modified by name since last
+  /// cleared
   public: bool isDirty = false;
+
+  /// \brief true if a registered param was accessed since last cleared
+  public: bool isHandleDirty = false;
+
+  /// \brief Empty name returned for invalid handles
+  public: static const std::string kEmptyName;
 };
 
+const std::string ShaderParamsPrivate::kEmptyName;
+
 
 class gz::rendering::ShaderParams::IteratorPrivate
 {
@@ -137,6 +163,80 @@ const ShaderParam &ShaderParams::operator[](const std::string &_name) const
   return this->dataPtr->parameters.at(_name);
 }
 
+//////////////////////////////////////////////////
+ShaderParams::Handle ShaderParams::Register(const std::string &_name,
+    ShaderParam::ParamType _type)
+{
+  auto &registrations = this->dataPtr->registrations;
+  for (std::size_t i = 0; i < registrations.size(); ++i)
+  {
+    if (registrations[i].param->first == _name)
+    {
+      registrations[i].type = _type;
+      return static_cast<Handle>(i);
+    }
+  }
+
+  auto it = this->dataPtr->parameters.try_emplace(_name).first;
+  ShaderParamsPrivate::Registration registration;
+  registration.param = &*it;
+  registration.type = _type;
+  registration.isDirty = true;
+  registrations.push_back(registration);
+  this->dataPtr->isHandleDirty = true;
+  return static_cast<Handle>(registrations.size() - 1u);
+}
+
+//////////////////////////////////////////////////
+ShaderParam &ShaderParams::operator[](Handle _handle)
+{
+  auto &registration = this->dataPtr->registrations.at(_handle);
+  registration.isDirty = true;
+  this->dataPtr->isHandleDirty = true;
+  return registration.param->second;
+}
+
+//////////////////////////////////////////////////
+const ShaderParam &ShaderParams::operator[](Handle _handle) const
+{
+  return this->dataPtr->registrations.at(_handle).param->second;
+}
+
+//////////////////////////////////////////////////
+uint32_t ShaderParams::HandleCount() const
+{
+  return static_cast<uint32_t>(this->dataPtr->registrations.size());
+}
+
+//////////////////////////////////////////////////
+const std::string &ShaderParams::HandleName(Handle _handle) const
+{
+  if (_handle >= this->dataPtr->registrations.size())
+    return ShaderParamsPrivate::kEmptyName;
+  return this->dataPtr->registrations[_handle].param->first;
+}
+
+//////////////////////////////////////////////////
+ShaderParam::ParamType ShaderParams::HandleType(Handle _handle) const
+{
+  if (_handle >= this->dataPtr->registrations.size())
+    return ShaderParam::PARAM_NONE;
+  return this->dataPtr->registrations[_handle].type;
+}
+
+//////////////////////////////////////////////////
+bool ShaderParams::IsDirty(Handle _handle) const
+{
+  return _handle < this->dataPtr->registrations.size() &&
+      this->dataPtr->registrations[_handle].isDirty;
+}
+
+//////////////////////////////////////////////////
+bool ShaderParams::IsNameDirty() const
+{
+  return this->dataPtr->isDirty;
+}
+
 //////////////////////////////////////////////////
 ShaderParams::Iterator ShaderParams::begin() const
 {
@@ -156,11 +256,17 @@ ShaderParams::Iterator ShaderParams::end() const
 //////////////////////////////////////////////////
 bool ShaderParams::IsDirty() const
 {
-  return this->dataPtr->isDirty;
+  return this->dataPtr->isDirty || this->dataPtr->isHandleDirty;
 }
 
 //////////////////////////////////////////////////
 void ShaderParams::ClearDirty()
 {
   this->dataPtr->isDirty = false;
+  if (this->dataPtr->isHandleDirty)
+  {
+    for (auto &registration : this->dataPtr->registrations)
+      registration.isDirty = false;
+    this->dataPtr->isHandleDirty = false;
+  }
 }
@@ -103,3 +103,52 @@ int main(int argc, char **argv)
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
+
+/////////////////////////////////////////////////
+TEST(ShaderParams, Handles)
+{
+  ShaderParams params;
+  EXPECT_EQ(0u, params.HandleCount());
+  EXPECT_TRUE(params.HandleName(0u).empty());
+  EXPECT_EQ(ShaderParam::PARAM_NONE, params.HandleType(0u));
+
+  ShaderParams::Handle amplitude =
+      params.Register("amplitude", ShaderParam::PARAM_FLOAT);
+  ShaderParams::Handle steps =
+      params.Register("steps", ShaderParam::PARAM_INT);
+  EXPECT_NE(amplitude, steps);
+  EXPECT_EQ(amplitude,
+      params.Register("amplitude", ShaderParam::PARAM_FLOAT));
+  EXPECT_EQ(2u, params.HandleCount());
+  EXPECT_EQ("steps", params.HandleName(steps));
+  EXPECT_EQ(ShaderParam::PARAM_INT, params.HandleType(steps));
+
+  // registered params are dirty until they are first updated
+  EXPECT_TRUE(params.IsDirty());
+  EXPECT_FALSE(params.IsNameDirty());
+  EXPECT_TRUE(params.IsDirty(amplitude));
+  params.ClearDirty();
+  EXPECT_FALSE(params.IsDirty());
+  EXPECT_FALSE(params.IsDirty(amplitude));
+
+  // access through a handle only dirties that handle
+  params[amplitude] = 0.5f;
+  EXPECT_TRUE(params.IsDirty());
+  EXPECT_FALSE(params.IsNameDirty());
+  EXPECT_TRUE(params.IsDirty(amplitude));
+  EXPECT_FALSE(params.IsDirty(steps));
+
+  // the handle and the name refer to the same param
+  float value = 0.0f;
+  const ShaderParams &constParams = params;
+  EXPECT_TRUE(constParams["amplitude"].Value(&value));
+  EXPECT_FLOAT_EQ(0.5f, value);
+  params["amplitude"] = 1.5f;
+  EXPECT_TRUE(params.IsNameDirty());
+  EXPECT_TRUE(constParams[amplitude].Value(&value));
+  EXPECT_FLOAT_EQ(1.5f, value);
+
+  params.ClearDirty();
+  EXPECT_FALSE(params.IsDirty());
+  EXPECT_FALSE(params.IsNameDirty());
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "gz/rendering/UserDataKey.hh"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+using namespace gz;
+using namespace rendering;
+
+namespace
+{
+/// \brief Ids of the interned key names. The names are the keys of the
+/// map, which never moves them, so keys can point at them.
+struct UserDataKeyRegistry
+{
+  /// \brief Protects the ids. Most lookups find an existing name, so they
+  /// only take a shared lock.
+  std::shared_mutex mutex;
+
+  /// \brief Id of each name, ids start at 1
+  std::unordered_map<std::string, uint32_t> ids;
+};
+
+/// \brief Get the key registry
+/// \return Registry shared by all keys
+UserDataKeyRegistry &Registry()
+{
+  static UserDataKeyRegistry registry;
+  return registry;
+}
+}
+
+//////////////////////////////////////////////////
+UserDataKey::UserDataKey(const std::string &_name)
+{
+  *this = UserDataKey::Find(_name);
+  if (this->Valid())
+    return;
+
+  UserDataKeyRegistry &registry = Registry();
+  std::unique_lock<std::shared_mutex> lock(registry.mutex);
+  // another thread may have interned the name in the meantime
+  auto it = registry.ids.find(_name);
+  if (it == registry.ids.end())
+  {
+    const uint32_t newId = static_cast<uint32_t>(registry.ids.size()) + 1u;
+    it = registry.ids.emplace(_name, newId).first;
+  }
+  this->id = it->second;
+  this->name = &it->first;
+}
+
+//////////////////////////////////////////////////
+UserDataKey UserDataKey::Find(const std::string &_name)
+{
+  UserDataKey key;
+  UserDataKeyRegistry &registry = Registry();
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  auto it = registry.ids.find(_name);
+  if (it != registry.ids.end())
+  {
+    key.id = it->second;
+    key.name = &it->first;
+  }
+  return key;
+}
+
+//////////////////////////////////////////////////
+uint32_t UserDataKey::Id() const
+{
+  return this->id;
+}
+
+//////////////////////////////////////////////////
+const std::string &UserDataKey::Name() const
+{
+  static const std::string kEmptyName;
+  return this->name ? *this->name : kEmptyName;
+}
+
+//////////////////////////////////////////////////
+bool UserDataKey::Valid() const
+{
+  return this->id != 0u;
+}
+
+//////////////////////////////////////////////////
+bool UserDataKey::operator==(const UserDataKey &_other) const
+{
+  return this->id == _other.id;
+}
+
+//////////////////////////////////////////////////
+bool UserDataKey::operator!=(const UserDataKey &_other) const
+{
+  return this->id != _other.id;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "gz/rendering/UserDataKey.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(UserDataKey, Intern)
+{
+  UserDataKey invalid;
+  EXPECT_FALSE(invalid.Valid());
+  EXPECT_EQ(0u, invalid.Id());
+  EXPECT_TRUE(invalid.Name().empty());
+
+  UserDataKey label("label");
+  EXPECT_TRUE(label.Valid());
+  EXPECT_NE(0u, label.Id());
+  EXPECT_EQ("label", label.Name());
+  EXPECT_NE(invalid, label);
+
+  // the same name resolves to the same key
+  UserDataKey label2(std::string("label"));
+  EXPECT_EQ(label, label2);
+  EXPECT_EQ(label.Id(), label2.Id());
+  EXPECT_EQ(&label.Name(), &label2.Name());
+
+  UserDataKey temperature("temperature");
+  EXPECT_NE(label, temperature);
+  EXPECT_EQ("temperature", temperature.Name());
+}
+
+/////////////////////////////////////////////////
+TEST(UserDataKey, Find)
+{
+  // finding a name does not intern it
+  EXPECT_FALSE(UserDataKey::Find("UserDataKey_TEST_find").Valid());
+  EXPECT_FALSE(UserDataKey::Find("UserDataKey_TEST_find").Valid());
+  EXPECT_TRUE(UserDataKey::Find("UserDataKey_TEST_find").Name().empty());
+
+  // once interned, it finds the same key
+  UserDataKey key("UserDataKey_TEST_find");
+  UserDataKey found = UserDataKey::Find("UserDataKey_TEST_find");
+  EXPECT_TRUE(found.Valid());
+  EXPECT_EQ(key, found);
+  EXPECT_EQ(&key.Name(), &found.Name());
+}
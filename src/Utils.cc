@@ -20,6 +20,15 @@
 #include <X11/Xresource.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GZ_RENDERING_UTILS_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GZ_RENDERING_UTILS_NEON
+#endif
+
 #include "gz/math/Plane.hh"
 #include "gz/math/Vector2.hh"
 #include "gz/math/Vector3.hh"
@@ -76,6 +85,56 @@ math::Vector3d screenToScene(
   return screenToScene(_screenPos, _camera, _rayQuery, rayResult, _maxDistance);
 }
 
+/////////////////////////////////////////////////
+std::vector<math::Vector3d> screenToScene(
+    const std::vector<math::Vector2i> &_screenPos,
+    const CameraPtr &_camera,
+    const RayQueryPtr &_rayQuery,
+    std::vector<RayQueryResult> &_rayResults,
+    float _maxDistance)
+{
+  double width = _camera->ImageWidth();
+  double height = _camera->ImageHeight();
+
+  // the rays are cheap to compute, intersecting them is batched
+  std::vector<math::Vector3d> origins;
+  std::vector<math::Vector3d> directions;
+  origins.reserve(_screenPos.size());
+  directions.reserve(_screenPos.size());
+  for (const math::Vector2i &screenPos : _screenPos)
+  {
+    double nx = 2.0 * screenPos.X() / width - 1.0;
+    double ny = 1.0 - 2.0 * screenPos.Y() / height;
+    _rayQuery->SetFromCamera(_camera, math::Vector2d(nx, ny));
+    origins.push_back(_rayQuery->Origin());
+    directions.push_back(_rayQuery->Direction());
+  }
+
+  _rayResults = _rayQuery->ClosestPoints(origins, directions);
+  _rayResults.resize(origins.size());
+
+  std::vector<math::Vector3d> points(origins.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    // Set point to be maxDistance m away if no intersection found
+    points[i] = _rayResults[i] ? _rayResults[i].point :
+        origins[i] + directions[i] * _maxDistance;
+  }
+  return points;
+}
+
+/////////////////////////////////////////////////
+std::vector<math::Vector3d> screenToScene(
+    const std::vector<math::Vector2i> &_screenPos,
+    const CameraPtr &_camera,
+    const RayQueryPtr &_rayQuery,
+    float _maxDistance)
+{
+  std::vector<RayQueryResult> rayResults;
+  return screenToScene(_screenPos, _camera, _rayQuery, rayResults,
+      _maxDistance);
+}
+
 /////////////////////////////////////////////////
 math::Vector3d screenToPlane(
     const math::Vector2i &_screenPos,
@@ -185,6 +244,95 @@ gz::math::Matrix3d projectionToCameraIntrinsic(
                             0, 0, 1);
 }
 
+/////////////////////////////////////////////////
+void projectPoints(const math::Matrix4d &_viewProjection,
+    unsigned int _width, unsigned int _height,
+    const math::Vector3d *_pts, math::Vector2d *_screenPts,
+    size_t _count)
+{
+  const math::Matrix4d &m = _viewProjection;
+  const double width = static_cast<double>(_width);
+  const double height = static_cast<double>(_height);
+
+  // Same as BaseCamera::Project, two points at a time. Only rows 0, 1 and
+  // 3 of the matrix are needed: the clip space x, y and w.
+  size_t i = 0u;
+#if defined(GZ_RENDERING_UTILS_SSE2)
+  const __m128d m00 = _mm_set1_pd(m(0, 0)), m01 = _mm_set1_pd(m(0, 1)),
+      m02 = _mm_set1_pd(m(0, 2)), m03 = _mm_set1_pd(m(0, 3));
+  const __m128d m10 = _mm_set1_pd(m(1, 0)), m11 = _mm_set1_pd(m(1, 1)),
+      m12 = _mm_set1_pd(m(1, 2)), m13 = _mm_set1_pd(m(1, 3));
+  const __m128d m30 = _mm_set1_pd(m(3, 0)), m31 = _mm_set1_pd(m(3, 1)),
+      m32 = _mm_set1_pd(m(3, 2)), m33 = _mm_set1_pd(m(3, 3));
+  const __m128d half = _mm_set1_pd(0.5);
+  const __m128d widthV = _mm_set1_pd(width);
+  const __m128d heightV = _mm_set1_pd(height);
+  for (; i + 2u <= _count; i += 2u)
+  {
+    const math::Vector3d &a = _pts[i];
+    const math::Vector3d &b = _pts[i + 1u];
+    const __m128d x = _mm_set_pd(b.X(), a.X());
+    const __m128d y = _mm_set_pd(b.Y(), a.Y());
+    const __m128d z = _mm_set_pd(b.Z(), a.Z());
+    const __m128d cx = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(m00, x), _mm_mul_pd(m01, y)), _mm_mul_pd(m02, z)), m03);
+    const __m128d cy = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(m10, x), _mm_mul_pd(m11, y)), _mm_mul_pd(m12, z)), m13);
+    const __m128d cw = _mm_add_pd(_mm_add_pd(_mm_add_pd(
+        _mm_mul_pd(m30, x), _mm_mul_pd(m31, y)), _mm_mul_pd(m32, z)), m33);
+    // ((x / w / 2) + 0.5) * width and (1 - ((y / w / 2) + 0.5)) * height
+    const __m128d sx = _mm_mul_pd(
+        _mm_add_pd(_mm_mul_pd(_mm_div_pd(cx, cw), half), half), widthV);
+    const __m128d sy = _mm_mul_pd(
+        _mm_sub_pd(half, _mm_mul_pd(_mm_div_pd(cy, cw), half)), heightV);
+    _mm_storel_pd(&_screenPts[i].X(), sx);
+    _mm_storeh_pd(&_screenPts[i + 1u].X(), sx);
+    _mm_storel_pd(&_screenPts[i].Y(), sy);
+    _mm_storeh_pd(&_screenPts[i + 1u].Y(), sy);
+  }
+#elif defined(GZ_RENDERING_UTILS_NEON)
+  const float64x2_t half = vdupq_n_f64(0.5);
+  for (; i + 2u <= _count; i += 2u)
+  {
+    const math::Vector3d &a = _pts[i];
+    const math::Vector3d &b = _pts[i + 1u];
+    const double xs[2] = {a.X(), b.X()};
+    const double ys[2] = {a.Y(), b.Y()};
+    const double zs[2] = {a.Z(), b.Z()};
+    const float64x2_t x = vld1q_f64(xs);
+    const float64x2_t y = vld1q_f64(ys);
+    const float64x2_t z = vld1q_f64(zs);
+    float64x2_t cx = vdupq_n_f64(m(0, 3));
+    cx = vfmaq_n_f64(vfmaq_n_f64(vfmaq_n_f64(cx, x, m(0, 0)), y, m(0, 1)),
+        z, m(0, 2));
+    float64x2_t cy = vdupq_n_f64(m(1, 3));
+    cy = vfmaq_n_f64(vfmaq_n_f64(vfmaq_n_f64(cy, x, m(1, 0)), y, m(1, 1)),
+        z, m(1, 2));
+    float64x2_t cw = vdupq_n_f64(m(3, 3));
+    cw = vfmaq_n_f64(vfmaq_n_f64(vfmaq_n_f64(cw, x, m(3, 0)), y, m(3, 1)),
+        z, m(3, 2));
+    const float64x2_t sx = vmulq_n_f64(
+        vfmaq_f64(half, vdivq_f64(cx, cw), half), width);
+    const float64x2_t sy = vmulq_n_f64(
+        vfmsq_f64(half, vdivq_f64(cy, cw), half), height);
+    _screenPts[i].Set(vgetq_lane_f64(sx, 0), vgetq_lane_f64(sy, 0));
+    _screenPts[i + 1u].Set(vgetq_lane_f64(sx, 1), vgetq_lane_f64(sy, 1));
+  }
+#endif
+  for (; i < _count; ++i)
+  {
+    const math::Vector3d &pt = _pts[i];
+    const double w = m(3, 0) * pt.X() + m(3, 1) * pt.Y() + m(3, 2) * pt.Z()
+        + m(3, 3);
+    const double x = (m(0, 0) * pt.X() + m(0, 1) * pt.Y() +
+        m(0, 2) * pt.Z() + m(0, 3)) / w;
+    const double y = (m(1, 0) * pt.X() + m(1, 1) * pt.Y() +
+        m(1, 2) * pt.Z() + m(1, 3)) / w;
+    _screenPts[i].Set(((x / 2.0) + 0.5) * width,
+        (1 - ((y / 2.0) + 0.5)) * height);
+  }
+}
+
 /////////////////////////////////////////////////
 gz::math::AxisAlignedBox transformAxisAlignedBox(
     const gz::math::AxisAlignedBox &_bbox,
@@ -15,6 +15,7 @@
  *
  */
 #include "gz/rendering/base/BaseObject.hh"
+#include "gz/rendering/Scene.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -71,3 +72,17 @@ void BaseObject::Load()
 void BaseObject::Init()
 {
 }
+
+//////////////////////////////////////////////////
+void BaseObject::SetPreRenderDirty()
+{
+  ScenePtr scene = this->Scene();
+  if (!scene || !scene->PreRenderDirtyTracking())
+    return;
+
+  // not yet or no longer owned by a shared pointer, e.g. during
+  // construction or destruction
+  std::shared_ptr<BaseObject> self = this->weak_from_this().lock();
+  if (self)
+    scene->SetPreRenderDirty(std::dynamic_pointer_cast<Object>(self));
+}
@@ -15,9 +15,14 @@
  *
  */
 
+#include <cstdlib>
+#include <utility>
+
 #include <gz/common/Console.hh>
 
 #include "gz/rendering/RenderPassSystem.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Sensor.hh"
 #include "gz/rendering/base/BaseRenderEngine.hh"
 
 using namespace gz;
@@ -43,6 +48,27 @@ bool BaseRenderEngine::Load(const std::map<std::string, std::string> &_params)
     return true;
   }
 
+  // record engine startup when a trace file is requested
+  std::string tracePath;
+  auto it = _params.find("loadTrace");
+  if (it != _params.end())
+  {
+    tracePath = it->second;
+  }
+  else
+  {
+    const char *env = std::getenv("GZ_RENDERING_LOAD_TRACE");
+    if (env)
+      tracePath = env;
+  }
+  if (!tracePath.empty())
+  {
+    this->loadTrace.SetOutputPath(tracePath);
+    this->loadTrace.SetEnabled(true);
+  }
+
+  LoadTraceScope scope(this->loadTrace, "RenderEngine::Load", "engine",
+      this->Name());
   this->loaded = this->LoadImpl(_params);
   return this->loaded;
 }
@@ -62,6 +88,8 @@ bool BaseRenderEngine::Init()
     return true;
   }
 
+  LoadTraceScope scope(this->loadTrace, "RenderEngine::Init", "engine",
+      this->Name());
   this->initialized = this->InitImpl();
   return this->initialized;
 }
@@ -236,6 +264,9 @@ ScenePtr BaseRenderEngine::CreateScene(unsigned int _id,
 //////////////////////////////////////////////////
 void BaseRenderEngine::Destroy()
 {
+  if (this->loaded)
+    this->loadTrace.WriteOutput();
+
   this->DestroyScenes();
   this->loaded = false;
   this->initialized = false;
@@ -259,6 +290,106 @@ bool BaseRenderEngine::Headless() const
   return this->isHeadless;
 }
 
+//////////////////////////////////////////////////
+void BaseRenderEngine::SetTextureMaxSize(unsigned int _size)
+{
+  this->textureMaxSize = _size;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseRenderEngine::TextureMaxSize() const
+{
+  return this->textureMaxSize;
+}
+
+//////////////////////////////////////////////////
+size_t BaseRenderEngine::TextureMemoryUsage() const
+{
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+GpuMemoryStats BaseRenderEngine::MemoryStats() const
+{
+  GpuMemoryStats stats;
+  for (unsigned int i = 0u; i < this->SceneCount(); ++i)
+  {
+    ScenePtr scene = this->SceneByIndex(i);
+    if (!scene)
+      continue;
+
+    uint64_t sceneBytes = 0u;
+    for (unsigned int j = 0u; j < scene->SensorCount(); ++j)
+    {
+      SensorPtr sensor = scene->SensorByIndex(j);
+      if (!sensor)
+        continue;
+      uint64_t bytes = sensor->MemoryUsage();
+      stats.sensors[sensor->Name()] += bytes;
+      sceneBytes += bytes;
+    }
+    stats.scenes[scene->Name()] += sceneBytes;
+  }
+  return stats;
+}
+
+//////////////////////////////////////////////////
+void BaseRenderEngine::SetMemoryWarning(size_t _threshold,
+    MemoryWarningCallback _callback)
+{
+  this->memoryWarningThreshold = _threshold;
+  this->memoryWarningCallback = std::move(_callback);
+  this->memoryWarningActive = false;
+}
+
+//////////////////////////////////////////////////
+size_t BaseRenderEngine::MemoryWarningThreshold() const
+{
+  return this->memoryWarningThreshold;
+}
+
+//////////////////////////////////////////////////
+void BaseRenderEngine::CheckMemoryWarning()
+{
+  if (this->memoryWarningThreshold == 0u)
+    return;
+
+  GpuMemoryStats stats = this->MemoryStats();
+  if (stats.total < this->memoryWarningThreshold)
+  {
+    this->memoryWarningActive = false;
+    return;
+  }
+  if (this->memoryWarningActive)
+    return;
+
+  this->memoryWarningActive = true;
+  gzwarn << "GPU memory usage of " << stats.total / (1024u * 1024u)
+         << " MiB exceeds the warning threshold of "
+         << this->memoryWarningThreshold / (1024u * 1024u) << " MiB: "
+         << stats.meshes / (1024u * 1024u) << " MiB meshes, "
+         << stats.textures / (1024u * 1024u) << " MiB textures, "
+         << stats.shadowMaps / (1024u * 1024u) << " MiB shadow maps, "
+         << stats.globalIllumination / (1024u * 1024u) << " MiB GI, "
+         << stats.renderTargets / (1024u * 1024u) << " MiB render targets, "
+         << stats.cubemaps / (1024u * 1024u) << " MiB cubemaps"
+         << std::endl;
+  if (this->memoryWarningCallback)
+    this->memoryWarningCallback(stats);
+}
+
+//////////////////////////////////////////////////
+FrameBufferPool &BaseRenderEngine::BufferPool()
+{
+  return this->bufferPool;
+}
+
+//////////////////////////////////////////////////
+LoadTrace &BaseRenderEngine::Trace()
+{
+  return this->loadTrace;
+}
+
 //////////////////////////////////////////////////
 void BaseRenderEngine::PrepareScene(ScenePtr _scene)
 {
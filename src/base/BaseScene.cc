@@ -15,7 +15,12 @@
  *
  */
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gz/math/Helpers.hh>
 
@@ -28,30 +33,97 @@
 #include "gz/rendering/COMVisual.hh"
 #include "gz/rendering/InertiaVisual.hh"
 #include "gz/rendering/InstallationDirectories.hh"
+#include "gz/rendering/InstancedVisualGroup.hh"
 #include "gz/rendering/JointVisual.hh"
 #include "gz/rendering/LidarVisual.hh"
 #include "gz/rendering/LightVisual.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Mesh.hh"
 #include "gz/rendering/Camera.hh"
+#include "gz/rendering/CameraArray.hh"
 #include "gz/rendering/Capsule.hh"
 #include "gz/rendering/DepthCamera.hh"
 #include "gz/rendering/GizmoVisual.hh"
 #include "gz/rendering/GpuRays.hh"
 #include "gz/rendering/Grid.hh"
+#include "gz/rendering/OceanVisual.hh"
 #include "gz/rendering/ParticleEmitter.hh"
+#include "gz/rendering/PointCloudVisual.hh"
 #include "gz/rendering/Projector.hh"
 #include "gz/rendering/RayQuery.hh"
 #include "gz/rendering/RenderTarget.hh"
 #include "gz/rendering/Text.hh"
 #include "gz/rendering/ThermalCamera.hh"
 #include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/SensorGBuffer.hh"
 #include "gz/rendering/Visual.hh"
+#include "gz/rendering/VoxelGridVisual.hh"
 #include "gz/rendering/WideAngleCamera.hh"
 #include "gz/rendering/base/BaseStorage.hh"
 #include "gz/rendering/base/BaseScene.hh"
 
+#include "SceneSnapshotFile.hh"
+
 using namespace gz;
 using namespace rendering;
 
+/// \brief World poses of visuals, each visual at most once in the order
+/// it was first set
+struct ScenePoseBuffer
+{
+  /// \brief Set the pose of a visual
+  /// \param[in] _id Id of the visual
+  /// \param[in] _pose World pose
+  void Set(unsigned int _id, const math::Pose3d &_pose)
+  {
+    auto it = this->index.emplace(_id, this->ids.size());
+    if (it.second)
+    {
+      this->ids.push_back(_id);
+      this->poses.push_back(_pose);
+    }
+    else
+    {
+      this->poses[it.first->second] = _pose;
+    }
+  }
+
+  /// \brief Remove all poses, keeping the allocated memory
+  void Clear()
+  {
+    this->ids.clear();
+    this->poses.clear();
+    this->index.clear();
+  }
+
+  /// \brief Ids of the visuals
+  std::vector<unsigned int> ids;
+
+  /// \brief World poses, one per id
+  std::vector<math::Pose3d> poses;
+
+  /// \brief Index of each id in ids
+  std::unordered_map<unsigned int, size_t> index;
+};
+
+/// \brief Double buffered pose state of a scene, see
+/// Scene::StageWorldPose
+class gz::rendering::BaseSceneState
+{
+  /// \brief Protects staged and published
+  public: std::mutex mutex;
+
+  /// \brief Poses staged since the last PublishState
+  public: ScenePoseBuffer staged;
+
+  /// \brief Poses published since the last SwapState
+  public: ScenePoseBuffer published;
+
+  /// \brief Poses being applied by SwapState. Only used by the render
+  /// thread.
+  public: ScenePoseBuffer front;
+};
+
 //////////////////////////////////////////////////
 BaseScene::BaseScene(unsigned int _id, const std::string &_name) :
   id(_id),
@@ -59,7 +131,13 @@ BaseScene::BaseScene(unsigned int _id, const std::string &_name) :
   loaded(false),
   initialized(false),
   nextObjectId(math::MAX_UI16),
-  nodes(nullptr)
+  nodes(nullptr),
+  commandQueue(std::make_unique<SceneCommandQueue>()),
+  debugDraw(std::make_unique<SceneDebugDraw>()),
+  markerPool(std::make_unique<SceneMarkerPool>()),
+  diagnostics(std::make_unique<DiagnosticLog>()),
+  changeTracker(std::make_unique<SceneChangeTracker>()),
+  state(std::make_unique<BaseSceneState>())
 {
 }
 
@@ -522,6 +600,30 @@ VisualPtr BaseScene::VisualById(unsigned int _id) const
   return this->Visuals()->GetById(_id);
 }
 
+//////////////////////////////////////////////////
+VisualPtr BaseScene::VisualByCompactId(uint32_t _compactId) const
+{
+  if (_compactId >= this->compactVisuals.size())
+    return VisualPtr();
+
+  VisualPtr visual = this->compactVisuals[_compactId].lock();
+  return (visual && visual->CompactId() == _compactId) ? visual : nullptr;
+}
+
+//////////////////////////////////////////////////
+std::vector<math::AxisAlignedBox> BaseScene::BoundingBoxes(
+    const std::vector<unsigned int> &_visualIds) const
+{
+  std::vector<math::AxisAlignedBox> boxes(_visualIds.size());
+  for (size_t i = 0u; i < _visualIds.size(); ++i)
+  {
+    VisualPtr visual = this->VisualById(_visualIds[i]);
+    if (visual)
+      boxes[i] = visual->BoundingBox();
+  }
+  return boxes;
+}
+
 //////////////////////////////////////////////////
 VisualPtr BaseScene::VisualByName(const std::string &_name) const
 {
@@ -571,6 +673,244 @@ void BaseScene::DestroyVisuals()
   this->Visuals()->DestroyAll();
 }
 
+//////////////////////////////////////////////////
+void BaseScene::DestroyVisuals(const std::vector<VisualPtr> &_visuals,
+    bool _recursive)
+{
+  auto visuals = this->Visuals();
+  if (!_recursive)
+  {
+    for (const auto &visual : _visuals)
+    {
+      if (visual)
+        visuals->Destroy(visual);
+    }
+    return;
+  }
+
+  // share the visited ids, descendants of visuals destroyed earlier are
+  // already gone
+  std::set<unsigned int> nodeIds;
+  for (const auto &visual : _visuals)
+  {
+    if (!visual || nodeIds.find(visual->Id()) != nodeIds.end())
+      continue;
+    this->DestroyNodeRecursive(visual, nodeIds);
+  }
+}
+
+//////////////////////////////////////////////////
+void BaseScene::DestroyVisualDeferred(VisualPtr _visual, bool _recursive)
+{
+  if (!_visual)
+    return;
+
+  _visual->SetVisible(false);
+  _visual->RemoveParent();
+
+  if (!_recursive)
+  {
+    this->pendingDestruction.push_back(_visual);
+    return;
+  }
+
+  // queue the subtree children first, so each node is destroyed on its own
+  std::vector<NodePtr> order;
+  std::set<unsigned int> nodeIds;
+  std::vector<NodePtr> stack{_visual};
+  while (!stack.empty())
+  {
+    NodePtr node = stack.back();
+    stack.pop_back();
+    if (!nodeIds.insert(node->Id()).second)
+    {
+      gzwarn << "Detected loop in scene tree while queueing nodes for "
+             << "destruction. Breaking loop." << std::endl;
+      continue;
+    }
+    order.push_back(node);
+    for (unsigned int i = 0u; i < node->ChildCount(); ++i)
+      stack.push_back(node->ChildByIndex(i));
+  }
+  this->pendingDestruction.insert(this->pendingDestruction.end(),
+      order.rbegin(), order.rend());
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetDestructionBudget(
+    std::chrono::steady_clock::duration _budget)
+{
+  this->destructionBudget = _budget;
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration BaseScene::DestructionBudget() const
+{
+  return this->destructionBudget;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::PendingDestructionCount() const
+{
+  return static_cast<unsigned int>(this->pendingDestruction.size());
+}
+
+//////////////////////////////////////////////////
+void BaseScene::DestroyPendingNodes()
+{
+  if (this->pendingDestruction.empty())
+    return;
+
+  auto start = std::chrono::steady_clock::now();
+  do
+  {
+    NodePtr node = this->pendingDestruction.front();
+    this->pendingDestruction.pop_front();
+    this->DestroyNode(node, false);
+  }
+  while (!this->pendingDestruction.empty() &&
+      std::chrono::steady_clock::now() - start < this->destructionBudget);
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetWorldPoses(const std::vector<unsigned int> &_ids,
+    const std::vector<math::Pose3d> &_poses)
+{
+  if (_ids.size() != _poses.size())
+  {
+    gzerr << "Unable to set world poses, got " << _ids.size()
+          << " ids but " << _poses.size() << " poses" << std::endl;
+    return;
+  }
+
+  auto visuals = this->Visuals();
+
+  // inverse world pose of parents, most bodies share the same parent
+  std::unordered_map<unsigned int, math::Pose3d> parentInvPoses;
+
+  unsigned int unknownCount = 0u;
+  for (size_t i = 0u; i < _ids.size(); ++i)
+  {
+    VisualPtr visual = visuals->GetById(_ids[i]);
+    if (!visual)
+    {
+      ++unknownCount;
+      continue;
+    }
+
+    NodePtr parent = visual->Parent();
+    if (!parent)
+    {
+      visual->SetLocalPose(_poses[i]);
+    }
+    else
+    {
+      auto it = parentInvPoses.find(parent->Id());
+      if (it == parentInvPoses.end())
+      {
+        it = parentInvPoses.emplace(
+            parent->Id(), parent->WorldPose().Inverse()).first;
+      }
+      visual->SetLocalPose(it->second * _poses[i]);
+    }
+
+    // moving a parent invalidates the world pose of its descendants
+    if (visual->ChildCount() > 0u)
+      parentInvPoses.clear();
+  }
+
+  if (unknownCount > 0u)
+  {
+    gzwarn << "Skipped " << unknownCount << " unknown visual ids when "
+           << "setting world poses" << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetWorldPoses(const std::vector<unsigned int> &_ids,
+    const std::vector<float> &_positions,
+    const std::vector<float> &_rotations)
+{
+  if (_positions.size() != _ids.size() * 3u ||
+      _rotations.size() != _ids.size() * 4u)
+  {
+    gzerr << "Unable to set world poses, expected " << _ids.size() * 3u
+          << " position and " << _ids.size() * 4u << " rotation values but "
+          << "got " << _positions.size() << " and " << _rotations.size()
+          << std::endl;
+    return;
+  }
+
+  std::vector<math::Pose3d> poses;
+  poses.reserve(_ids.size());
+  for (size_t i = 0u; i < _ids.size(); ++i)
+  {
+    const float *p = &_positions[i * 3u];
+    const float *q = &_rotations[i * 4u];
+    poses.emplace_back(p[0], p[1], p[2], q[0], q[1], q[2], q[3]);
+  }
+  this->SetWorldPoses(_ids, poses);
+}
+
+//////////////////////////////////////////////////
+void BaseScene::StageWorldPose(unsigned int _id, const math::Pose3d &_pose)
+{
+  std::lock_guard<std::mutex> lock(this->state->mutex);
+  this->state->staged.Set(_id, _pose);
+}
+
+//////////////////////////////////////////////////
+void BaseScene::StageWorldPoses(const std::vector<unsigned int> &_ids,
+    const std::vector<math::Pose3d> &_poses)
+{
+  if (_ids.size() != _poses.size())
+  {
+    gzerr << "Unable to stage world poses, got " << _ids.size()
+          << " ids but " << _poses.size() << " poses" << std::endl;
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(this->state->mutex);
+  for (size_t i = 0u; i < _ids.size(); ++i)
+    this->state->staged.Set(_ids[i], _poses[i]);
+}
+
+//////////////////////////////////////////////////
+void BaseScene::PublishState()
+{
+  std::lock_guard<std::mutex> lock(this->state->mutex);
+  ScenePoseBuffer &staged = this->state->staged;
+  ScenePoseBuffer &published = this->state->published;
+  if (published.ids.empty())
+  {
+    // the render thread is up to date, publishing is a swap
+    std::swap(staged, published);
+  }
+  else
+  {
+    for (size_t i = 0u; i < staged.ids.size(); ++i)
+      published.Set(staged.ids[i], staged.poses[i]);
+  }
+  staged.Clear();
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::SwapState()
+{
+  ScenePoseBuffer &front = this->state->front;
+  {
+    std::lock_guard<std::mutex> lock(this->state->mutex);
+    if (this->state->published.ids.empty())
+      return false;
+    std::swap(front, this->state->published);
+  }
+
+  // writers keep staging the next state while the poses are applied
+  this->SetWorldPoses(front.ids, front.poses);
+  front.Clear();
+  return true;
+}
+
 //////////////////////////////////////////////////
 bool BaseScene::MaterialRegistered(const std::string &_name) const
 {
@@ -879,6 +1219,36 @@ WideAngleCameraPtr BaseScene::CreateWideAngleCamera(
   return (result) ? camera : nullptr;
 }
 
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateCameraArray(objId);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(
+  const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "CameraArray");
+  return this->CreateCameraArray(_id, objName);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(
+  const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateCameraArray(objId, _name);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(
+  const unsigned int _id,
+    const std::string &_name)
+{
+  CameraArrayPtr array = this->CreateCameraArrayImpl(_id, _name);
+  bool result = this->RegisterSensor(array);
+  return (result) ? array : nullptr;
+}
+
 //////////////////////////////////////////////////
 GpuRaysPtr BaseScene::CreateGpuRays()
 {
@@ -932,6 +1302,45 @@ VisualPtr BaseScene::CreateVisual(unsigned int _id, const std::string &_name)
   return (result) ? visual : nullptr;
 }
 
+//////////////////////////////////////////////////
+std::vector<VisualPtr> BaseScene::CreateVisuals(
+    const std::vector<VisualDescriptor> &_descs)
+{
+  std::vector<VisualPtr> result;
+  result.reserve(_descs.size());
+
+  VisualPtr root = this->RootVisual();
+  const std::string prefix = this->name + "::Visual(";
+  for (const auto &desc : _descs)
+  {
+    unsigned int objId = this->CreateObjectId();
+    VisualPtr visual = this->CreateVisual(objId, desc.name.empty() ?
+        prefix + std::to_string(objId) + ")" : desc.name);
+    if (!visual)
+    {
+      result.push_back(nullptr);
+      continue;
+    }
+
+    if (desc.mesh.mesh || !desc.mesh.meshName.empty())
+    {
+      MeshPtr mesh = this->CreateMesh(desc.mesh);
+      if (mesh)
+        visual->AddGeometry(mesh);
+    }
+    if (desc.material)
+      visual->SetMaterial(desc.material, false);
+    visual->SetLocalScale(desc.localScale);
+    visual->SetLocalPose(desc.localPose);
+
+    VisualPtr parent = desc.parent ? desc.parent : root;
+    if (parent)
+      parent->AddChild(visual);
+    result.push_back(visual);
+  }
+  return result;
+}
+
 //////////////////////////////////////////////////
 ArrowVisualPtr BaseScene::CreateArrowVisual()
 {
@@ -1208,6 +1617,29 @@ MeshPtr BaseScene::CreateMesh(const MeshDescriptor &_desc)
   return this->CreateMeshImpl(objId, objName, _desc);
 }
 
+//////////////////////////////////////////////////
+void BaseScene::PreloadMeshes(const std::vector<MeshDescriptor> &)
+{
+  // no-op for render engines that convert meshes in CreateMesh
+}
+
+//////////////////////////////////////////////////
+InstancedVisualGroupPtr BaseScene::CreateInstancedVisualGroup(
+    const MeshDescriptor &_desc, MaterialPtr _material)
+{
+  return std::make_shared<InstancedVisualGroup>(
+      this->shared_from_this(), _desc, _material);
+}
+
+//////////////////////////////////////////////////
+SensorGBufferPtr BaseScene::CreateSensorGBuffer(
+    const std::set<GBufferOutput> &_outputs)
+{
+  // the constructor is only accessible to the scene
+  return SensorGBufferPtr(
+      new SensorGBuffer(this->shared_from_this(), _outputs));
+}
+
 //////////////////////////////////////////////////
 HeightmapPtr BaseScene::CreateHeightmap(const HeightmapDescriptor &_desc)
 {
@@ -1262,6 +1694,105 @@ LidarVisualPtr BaseScene::CreateLidarVisual(unsigned int _id,
   return (result) ? lidar : nullptr;
 }
 
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreatePointCloudVisual(objId);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(unsigned int _id)
+{
+  const std::string objName =
+      this->CreateObjectName(_id, "PointCloudVisual");
+  return this->CreatePointCloudVisual(_id, objName);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(
+    const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreatePointCloudVisual(objId, _name);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(unsigned int _id,
+    const std::string &_name)
+{
+  PointCloudVisualPtr pointCloud =
+      this->CreatePointCloudVisualImpl(_id, _name);
+  bool result = this->RegisterVisual(pointCloud);
+  return (result) ? pointCloud : nullptr;
+}
+
+//////////////////////////////////////////////////
+VoxelGridVisualPtr BaseScene::CreateVoxelGridVisual()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateVoxelGridVisual(objId);
+}
+
+//////////////////////////////////////////////////
+VoxelGridVisualPtr BaseScene::CreateVoxelGridVisual(unsigned int _id)
+{
+  const std::string objName =
+      this->CreateObjectName(_id, "VoxelGridVisual");
+  return this->CreateVoxelGridVisual(_id, objName);
+}
+
+//////////////////////////////////////////////////
+VoxelGridVisualPtr BaseScene::CreateVoxelGridVisual(
+    const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateVoxelGridVisual(objId, _name);
+}
+
+//////////////////////////////////////////////////
+VoxelGridVisualPtr BaseScene::CreateVoxelGridVisual(unsigned int _id,
+    const std::string &_name)
+{
+  VoxelGridVisualPtr voxelGrid =
+      this->CreateVoxelGridVisualImpl(_id, _name);
+  bool result = this->RegisterVisual(voxelGrid);
+  return (result) ? voxelGrid : nullptr;
+}
+
+//////////////////////////////////////////////////
+OceanVisualPtr BaseScene::CreateOceanVisual()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateOceanVisual(objId);
+}
+
+//////////////////////////////////////////////////
+OceanVisualPtr BaseScene::CreateOceanVisual(unsigned int _id)
+{
+  const std::string objName =
+      this->CreateObjectName(_id, "OceanVisual");
+  return this->CreateOceanVisual(_id, objName);
+}
+
+//////////////////////////////////////////////////
+OceanVisualPtr BaseScene::CreateOceanVisual(
+    const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateOceanVisual(objId, _name);
+}
+
+//////////////////////////////////////////////////
+OceanVisualPtr BaseScene::CreateOceanVisual(unsigned int _id,
+    const std::string &_name)
+{
+  OceanVisualPtr ocean =
+      this->CreateOceanVisualImpl(_id, _name);
+  bool result = this->RegisterVisual(ocean);
+  return (result) ? ocean : nullptr;
+}
+
 //////////////////////////////////////////////////
 WireBoxPtr BaseScene::CreateWireBox()
 {
@@ -1475,6 +2006,86 @@ bool BaseScene::SkyEnabled() const
   return false;
 }
 
+//////////////////////////////////////////////////
+void BaseScene::SetTextureStreamingEnabled(bool _enabled)
+{
+  // no op, let derived class implement this.
+  if (_enabled)
+  {
+    gzerr << "Texture streaming not supported by: "
+           << this->Engine()->Name() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::TextureStreamingEnabled() const
+{
+  return false;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::PendingTextureLoads() const
+{
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetMaterialSharingEnabled(bool _enabled)
+{
+  // no op, let derived class implement this.
+  if (_enabled)
+  {
+    gzerr << "Material sharing not supported by: "
+           << this->Engine()->Name() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::MaterialSharingEnabled() const
+{
+  return false;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetTextBatchingEnabled(bool _enabled)
+{
+  // no op, let derived class implement this.
+  if (_enabled)
+  {
+    gzerr << "Text batching not supported by: "
+           << this->Engine()->Name() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::TextBatchingEnabled() const
+{
+  return false;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetRenderOrigin(const math::Vector3d &_origin)
+{
+  // no op, let derived class implement this.
+  if (_origin != math::Vector3d::Zero)
+  {
+    gzerr << "Render origin not supported by: "
+           << this->Engine()->Name() << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+math::Vector3d BaseScene::RenderOrigin() const
+{
+  return math::Vector3d::Zero;
+}
+
+//////////////////////////////////////////////////
+ShaderParamsPtr BaseScene::SharedShaderParams() const
+{
+  return ShaderParamsPtr();
+}
+
 //////////////////////////////////////////////////
 void BaseScene::SetActiveGlobalIllumination(GlobalIlluminationBasePtr _gi)
 {
@@ -1489,7 +2100,94 @@ void BaseScene::SetActiveGlobalIllumination(GlobalIlluminationBasePtr _gi)
 //////////////////////////////////////////////////
 void BaseScene::PreRender()
 {
-  this->RootVisual()->PreRender();
+  this->DestroyPendingNodes();
+  this->commandQueue->Apply(*this);
+  this->markerPool->Update(*this);
+  this->debugDraw->Flush(*this);
+
+  this->stats.preRenderDirtyObjects.clear();
+  if (!this->preRenderDirtyTracking || this->preRenderFullTraversal)
+  {
+    this->preRenderDirty.clear();
+    this->preRenderFullTraversal = false;
+    this->stats.preRenderFullTraversal = true;
+    this->RootVisual()->PreRender();
+    return;
+  }
+  this->stats.preRenderFullTraversal = false;
+
+  // sensors check their render targets and follow / track targets every
+  // frame
+  for (unsigned int i = 0; i < this->SensorCount(); ++i)
+    this->SensorByIndex(i)->PreRender();
+
+  // objects may mark themselves dirty again while being pre-rendered,
+  // e.g. to request an update every frame, so work on a copy
+  std::map<unsigned int, std::weak_ptr<Object>> dirty;
+  dirty.swap(this->preRenderDirty);
+  for (auto &it : dirty)
+  {
+    ObjectPtr object = it.second.lock();
+    if (object)
+    {
+      object->PreRender();
+      this->stats.preRenderDirtyObjects.push_back(it.first);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+SceneCommandQueue &BaseScene::CommandQueue()
+{
+  return *this->commandQueue;
+}
+
+//////////////////////////////////////////////////
+SceneDebugDraw &BaseScene::DebugDraw()
+{
+  return *this->debugDraw;
+}
+
+//////////////////////////////////////////////////
+SceneMarkerPool &BaseScene::MarkerPool()
+{
+  return *this->markerPool;
+}
+
+//////////////////////////////////////////////////
+DiagnosticLog &BaseScene::Diagnostics()
+{
+  return *this->diagnostics;
+}
+
+//////////////////////////////////////////////////
+SceneChangeTracker &BaseScene::ChangeTracker()
+{
+  return *this->changeTracker;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetPreRenderDirtyTracking(bool _enabled)
+{
+  if (_enabled && !this->preRenderDirtyTracking)
+    this->preRenderFullTraversal = true;
+  this->preRenderDirtyTracking = _enabled;
+  if (!_enabled)
+    this->preRenderDirty.clear();
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::PreRenderDirtyTracking() const
+{
+  return this->preRenderDirtyTracking;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetPreRenderDirty(ObjectPtr _object)
+{
+  if (!this->preRenderDirtyTracking || !_object)
+    return;
+  this->preRenderDirty[_object->Id()] = _object;
 }
 
 //////////////////////////////////////////////////
@@ -1514,9 +2212,400 @@ bool BaseScene::LegacyAutoGpuFlush() const
   return true;
 }
 
+//////////////////////////////////////////////////
+void BaseScene::RenderSensors(const std::vector<SensorPtr> &_sensors)
+{
+  std::vector<CameraPtr> cameras = this->RenderableCameras(_sensors);
+  if (cameras.empty())
+    return;
+
+  this->PreRender();
+  this->RemoveUnchangedCameras(cameras);
+  for (auto &camera : cameras)
+    camera->Render();
+  for (auto &camera : cameras)
+  {
+    camera->PostRender();
+    camera->ClearCaptureRequest();
+  }
+  if (!this->LegacyAutoGpuFlush())
+    this->PostRender();
+}
+
+//////////////////////////////////////////////////
+void BaseScene::RenderCameraAtlas(const std::vector<CameraPtr> &_cameras,
+    const CameraAtlasCallback &_callback)
+{
+  // the cameras are read back below even if nothing else listens
+  std::vector<SensorPtr> sensors(_cameras.begin(), _cameras.end());
+  for (const CameraPtr &camera : _cameras)
+  {
+    if (camera)
+      camera->RequestCapture();
+  }
+  this->RenderSensors(sensors);
+
+  // no atlas support, read back the cameras one by one
+  for (unsigned int i = 0; i < _cameras.size(); ++i)
+  {
+    const CameraPtr &camera = _cameras[i];
+    if (!camera || !this->HasSensor(camera))
+      continue;
+
+    Image image = camera->CreateImage();
+    camera->Copy(image);
+    camera->ClearCaptureRequest();
+
+    FrameView view;
+    view.data = image.Data();
+    view.width = image.Width();
+    view.height = image.Height();
+    view.format = image.Format();
+    view.rowPitch = PixelUtil::MemorySize(view.format, view.width, 1u);
+    _callback(i, view);
+  }
+}
+
+//////////////////////////////////////////////////
+void BaseScene::RenderEnvironments(
+    const std::vector<VisualPtr> &_environments,
+    const std::vector<CameraPtr> &_cameras,
+    const CameraAtlasCallback &_callback)
+{
+  if (_environments.size() != _cameras.size())
+  {
+    gzerr << "RenderEnvironments needs one camera per environment, got "
+          << _cameras.size() << " cameras for " << _environments.size()
+          << " environments" << std::endl;
+    return;
+  }
+
+  std::vector<bool> visible;
+  for (const VisualPtr &environment : _environments)
+  {
+    visible.push_back(environment && environment->Visible());
+    if (environment)
+      environment->SetVisible(false);
+  }
+
+  // without a way to switch environments between the cameras of a batch,
+  // each environment is rendered on its own
+  for (unsigned int i = 0; i < _cameras.size(); ++i)
+  {
+    if (visible[i])
+      _environments[i]->SetVisible(true);
+    this->RenderCameraAtlas({_cameras[i]},
+        [&](unsigned int, const FrameView &_view)
+        {
+          _callback(i, _view);
+        });
+    if (visible[i])
+      _environments[i]->SetVisible(false);
+  }
+
+  for (unsigned int i = 0; i < _environments.size(); ++i)
+  {
+    if (_environments[i])
+      _environments[i]->SetVisible(visible[i]);
+  }
+}
+
+//////////////////////////////////////////////////
+void BaseScene::WarmUpShaders()
+{
+  // no-op for render engines that do not compile shaders lazily
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetSensorReleaseTime(
+    std::chrono::steady_clock::duration _time)
+{
+  this->sensorReleaseTime =
+      std::max(_time, std::chrono::steady_clock::duration::zero());
+}
+
+//////////////////////////////////////////////////
+std::chrono::steady_clock::duration BaseScene::SensorReleaseTime() const
+{
+  return this->sensorReleaseTime;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::ReleaseSensorRenderTextures(
+    std::chrono::steady_clock::duration _idleTime)
+{
+  const std::chrono::steady_clock::duration now = this->Time();
+  unsigned int count = 0u;
+
+  // rebuild the render times so destroyed sensors are forgotten
+  std::map<std::string, std::chrono::steady_clock::duration> renderTimes;
+  for (unsigned int i = 0u; i < this->SensorCount(); ++i)
+  {
+    SensorPtr sensor = this->SensorByIndex(i);
+    if (!sensor)
+      continue;
+
+    // sensors that were never rendered are idle from the first check on
+    auto it = this->sensorRenderTimes.find(sensor->Name());
+    const std::chrono::steady_clock::duration lastRender =
+        it != this->sensorRenderTimes.end() ? it->second : now;
+    renderTimes[sensor->Name()] = lastRender;
+
+    if (now - lastRender >= _idleTime && sensor->ReleaseRenderTextures())
+      ++count;
+  }
+  this->sensorRenderTimes = std::move(renderTimes);
+  return count;
+}
+
+//////////////////////////////////////////////////
+RenderStats BaseScene::Stats() const
+{
+  RenderStats result = this->stats;
+  result.diagnostics = this->diagnostics->Counts();
+  return result;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::ResetStats()
+{
+  this->stats = RenderStats();
+  this->diagnostics->Reset();
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::SetLightClustering(const LightClusterConfig &_config)
+{
+  if (_config.width == 0u || _config.height == 0u || _config.slices == 0u ||
+      _config.lightsPerCell == 0u)
+  {
+    gzerr << "Light clustering needs at least one tile, slice and light "
+          << "per cell" << std::endl;
+    return false;
+  }
+  if (!(_config.minDistance > 0.0) ||
+      !(_config.maxDistance > _config.minDistance))
+  {
+    gzerr << "Invalid light clustering distances [" << _config.minDistance
+          << ", " << _config.maxDistance << "]" << std::endl;
+    return false;
+  }
+  this->lightClustering = _config;
+  return true;
+}
+
+//////////////////////////////////////////////////
+LightClusterConfig BaseScene::LightClustering() const
+{
+  return this->lightClustering;
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::SetShadowSettings(const ShadowConfig &_config)
+{
+  if (_config.directionalTextureSize == 0u || _config.textureSize == 0u ||
+      _config.pointLightCubemapSize == 0u || _config.maxShadowMaps == 0u)
+  {
+    gzerr << "Shadow map sizes and budget must be positive" << std::endl;
+    return false;
+  }
+  if (_config.atlasSize < _config.textureSize ||
+      _config.atlasSize % _config.textureSize != 0u)
+  {
+    gzerr << "Shadow atlas size [" << _config.atlasSize << "] must be a "
+          << "multiple of the shadow texture size [" << _config.textureSize
+          << "]" << std::endl;
+    return false;
+  }
+  if (!(_config.updateRate >= 0.0))
+  {
+    gzerr << "Invalid shadow update rate [" << _config.updateRate << "]"
+          << std::endl;
+    return false;
+  }
+  this->shadowSettings = _config;
+  return true;
+}
+
+//////////////////////////////////////////////////
+ShadowConfig BaseScene::ShadowSettings() const
+{
+  return this->shadowSettings;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::SetOcclusionCulling(bool _enabled)
+{
+  this->occlusionCulling = _enabled;
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::OcclusionCulling() const
+{
+  return this->occlusionCulling;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::BakeStaticVisuals()
+{
+  // no batching by default
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::UnbakeStaticVisuals()
+{
+}
+
+//////////////////////////////////////////////////
+SceneSnapshot BaseScene::Snapshot() const
+{
+  SceneSnapshot snapshot;
+  for (unsigned int i = 0; i < this->nodes->Size(); ++i)
+  {
+    NodePtr node = this->nodes->GetByIndex(i);
+    if (!node)
+      continue;
+
+    NodeSnapshot &state = snapshot.nodes[node->Id()];
+    state.localPose = node->LocalPose();
+    state.localScale = node->LocalScale();
+    for (const auto &key : node->UserDataKeys())
+      state.userData[key] = node->UserData(key);
+
+    VisualPtr visual = std::dynamic_pointer_cast<Visual>(node);
+    if (visual)
+    {
+      state.isVisual = true;
+      state.visible = visual->Visible();
+      state.material = visual->Material();
+    }
+  }
+  return snapshot;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::Restore(const SceneSnapshot &_snapshot)
+{
+  for (const auto &[id, state] : _snapshot.nodes)
+  {
+    NodePtr node = this->nodes->GetById(id);
+    if (!node)
+      continue;
+
+    if (node->LocalPose() != state.localPose)
+      node->SetLocalPose(state.localPose);
+    if (node->LocalScale() != state.localScale)
+      node->SetLocalScale(state.localScale);
+    for (const auto &[key, value] : state.userData)
+      node->SetUserData(key, value);
+
+    if (!state.isVisual)
+      continue;
+    VisualPtr visual = std::dynamic_pointer_cast<Visual>(node);
+    if (!visual)
+      continue;
+    if (visual->Visible() != state.visible)
+      visual->SetVisible(state.visible);
+    if (state.material && visual->Material() != state.material)
+      visual->SetMaterial(state.material, false);
+  }
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::SaveSnapshot(const std::string &_path) const
+{
+  return SaveSceneSnapshotFile(*this, _path);
+}
+
+//////////////////////////////////////////////////
+bool BaseScene::LoadSnapshot(const std::string &_path)
+{
+  return LoadSceneSnapshotFile(*this, _path);
+}
+
+//////////////////////////////////////////////////
+void BaseScene::RecordSensorTime(const std::string &_name,
+    SensorPhase _phase, std::chrono::steady_clock::duration _duration)
+{
+  SensorStats &sensorStats = this->stats.sensors[_name];
+  switch (_phase)
+  {
+    case SP_PRE_RENDER:
+      sensorStats.preRenderTime = _duration;
+      break;
+    case SP_RENDER:
+      sensorStats.renderTime = _duration;
+      sensorStats.renderCount++;
+      this->sensorRenderTimes[_name] = this->Time();
+      break;
+    case SP_POST_RENDER:
+      sensorStats.postRenderTime = _duration;
+      break;
+    default:
+      return;
+  }
+  sensorStats.totalTime += _duration;
+}
+
+//////////////////////////////////////////////////
+std::vector<CameraPtr> BaseScene::RenderableCameras(
+    const std::vector<SensorPtr> &_sensors) const
+{
+  std::vector<CameraPtr> cameras;
+  cameras.reserve(_sensors.size());
+  for (const auto &sensor : _sensors)
+  {
+    CameraPtr camera = std::dynamic_pointer_cast<Camera>(sensor);
+    if (!camera)
+    {
+      if (sensor)
+      {
+        gzwarn << "Sensor [" << sensor->Name() << "] is not a camera "
+               << "and cannot be rendered" << std::endl;
+      }
+      continue;
+    }
+    if (camera->Scene().get() != this)
+    {
+      gzerr << "Sensor [" << camera->Name() << "] does not belong to scene ["
+            << this->Name() << "]" << std::endl;
+      continue;
+    }
+    // demand driven sensors nobody needs this frame
+    if (camera->IsIdle())
+      continue;
+    cameras.push_back(camera);
+  }
+  return cameras;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::RemoveUnchangedCameras(std::vector<CameraPtr> &_cameras) const
+{
+  // skipped frames are not read back, the last frame stays valid
+  auto unchanged = [](const CameraPtr &_camera)
+  {
+    if (!_camera->CheckFrameUnchanged())
+      return false;
+    _camera->ClearCaptureRequest();
+    return true;
+  };
+  _cameras.erase(std::remove_if(_cameras.begin(), _cameras.end(), unchanged),
+      _cameras.end());
+}
+
 //////////////////////////////////////////////////
 void BaseScene::Clear()
 {
+  // the debug geometry is destroyed with the other nodes and materials
+  this->debugDraw->Reset();
+  this->markerPool->Reset();
+  this->pendingDestruction.clear();
+
+  // the whole scene changes, there is no need to record each node
+  const bool trackChanges = this->changeTracker->Enabled();
+  this->changeTracker->SetEnabled(false);
   this->DestroyNodes();
   auto root = this->RootVisual();
   if (root)
@@ -1526,6 +2615,7 @@ void BaseScene::Clear()
   }
   this->DestroyMaterials();
   this->nextObjectId = math::MAX_UI16;
+  this->changeTracker->SetEnabled(trackChanges);
 }
 
 //////////////////////////////////////////////////
@@ -1568,7 +2658,35 @@ bool BaseScene::RegisterSensor(SensorPtr _sensor)
 //////////////////////////////////////////////////
 bool BaseScene::RegisterVisual(VisualPtr _visual)
 {
-  return (_visual) ? this->Visuals()->Add(_visual) : false;
+  if (!_visual || !this->Visuals()->Add(_visual))
+    return false;
+
+  // reclaim the ids of destroyed visuals once most of the table is unused,
+  // lowest ids first
+  if (this->freeCompactIds.empty() &&
+      this->compactVisuals.size() >= 2u * this->Visuals()->Size() + 64u)
+  {
+    for (size_t i = this->compactVisuals.size(); i-- > 0u;)
+    {
+      if (this->compactVisuals[i].expired())
+        this->freeCompactIds.push_back(static_cast<uint32_t>(i));
+    }
+  }
+
+  uint32_t compactId;
+  if (!this->freeCompactIds.empty())
+  {
+    compactId = this->freeCompactIds.back();
+    this->freeCompactIds.pop_back();
+    this->compactVisuals[compactId] = _visual;
+  }
+  else
+  {
+    compactId = static_cast<uint32_t>(this->compactVisuals.size());
+    this->compactVisuals.push_back(_visual);
+  }
+  _visual->SetCompactId(compactId);
+  return true;
 }
 
 //////////////////////////////////////////////////
@@ -0,0 +1,947 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "SceneSnapshotFile.hh"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/MeshManager.hh>
+
+#include "gz/rendering/Capsule.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Mesh.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Magic number at the start of scene snapshot files
+static const char kSnapshotMagic[8] = {'G', 'Z', 'R', 'S', 'N', 'A', 'P', 0};
+
+/// \brief Version of the scene snapshot file format, increment when the
+/// records change
+static const uint32_t kSnapshotVersion = 1u;
+
+/// \brief Type of a snapshot geometry
+enum SnapshotGeometryType : uint32_t
+{
+  /// \brief Mesh, see MeshDescriptor
+  SGT_MESH = 0,
+
+  /// \brief Capsule
+  SGT_CAPSULE = 1
+};
+
+/// \brief Flags of snapshot records
+enum SnapshotFlag : uint32_t
+{
+  /// \brief Visual is visible
+  SF_VISIBLE = 1u << 0u,
+
+  /// \brief Visual is static
+  SF_STATIC = 1u << 1u,
+
+  /// \brief Visual is drawn as wireframe
+  SF_WIREFRAME = 1u << 2u,
+
+  /// \brief Mesh descriptor centers the submesh
+  SF_CENTER_SUBMESH = 1u << 3u,
+
+  /// \brief Mesh descriptor is dynamic
+  SF_DYNAMIC = 1u << 4u,
+
+  /// \brief Mesh descriptor stores half precision positions
+  SF_HALF_POSITIONS = 1u << 5u,
+
+  /// \brief Mesh descriptor optimizes the mesh
+  SF_OPTIMIZE = 1u << 6u,
+
+  /// \brief Material is lit
+  SF_LIGHTING = 1u << 7u,
+
+  /// \brief Material tests depth
+  SF_DEPTH_CHECK = 1u << 8u,
+
+  /// \brief Material writes depth
+  SF_DEPTH_WRITE = 1u << 9u,
+
+  /// \brief Material casts shadows
+  SF_CAST_SHADOWS = 1u << 10u,
+
+  /// \brief Material receives shadows
+  SF_RECEIVE_SHADOWS = 1u << 11u,
+
+  /// \brief Material has reflections enabled
+  SF_REFLECTION = 1u << 12u,
+
+  /// \brief Material takes alpha from its texture
+  SF_TEXTURE_ALPHA = 1u << 13u,
+
+  /// \brief Material is two sided
+  SF_TWO_SIDED = 1u << 14u
+};
+
+/// \brief Reference to a string in the string table of a snapshot
+struct SnapshotString
+{
+  /// \brief Offset of the first character in the string table
+  uint32_t offset = 0u;
+
+  /// \brief Number of characters
+  uint32_t size = 0u;
+};
+
+/// \brief Header of a snapshot file. It is followed by the tables of
+/// materials, visuals, geometries, submesh materials, LOD distances and
+/// user data, each padded to 8 bytes, and then by the string table.
+struct SnapshotHeader
+{
+  /// \brief Magic number, kSnapshotMagic
+  char magic[8];
+
+  /// \brief File format version, kSnapshotVersion
+  uint32_t version = kSnapshotVersion;
+
+  /// \brief Number of materials
+  uint32_t materialCount = 0u;
+
+  /// \brief Number of visuals
+  uint32_t visualCount = 0u;
+
+  /// \brief Number of geometries
+  uint32_t geometryCount = 0u;
+
+  /// \brief Number of submesh materials
+  uint32_t subMeshCount = 0u;
+
+  /// \brief Number of LOD distances
+  uint32_t lodCount = 0u;
+
+  /// \brief Number of user data entries
+  uint32_t userDataCount = 0u;
+
+  /// \brief Unused, keeps the string table size aligned
+  uint32_t reserved = 0u;
+
+  /// \brief Size of the string table in bytes
+  uint64_t stringsSize = 0u;
+};
+
+/// \brief Parameters of a material in a snapshot
+struct SnapshotMaterial
+{
+  /// \brief Name of the material
+  SnapshotString name;
+
+  /// \brief Texture maps, in the order of the SetTexture, SetNormalMap,
+  /// SetRoughnessMap, SetMetalnessMap, SetEmissiveMap, SetEnvironmentMap
+  /// and SetLightMap setters
+  SnapshotString maps[7];
+
+  /// \brief Vertex shader path
+  SnapshotString vertexShader;
+
+  /// \brief Fragment shader path
+  SnapshotString fragmentShader;
+
+  /// \brief Ambient, diffuse, specular and emissive colors, RGBA each
+  float colors[16];
+
+  /// \brief Shininess
+  float shininess = 0.0f;
+
+  /// \brief Transparency
+  float transparency = 0.0f;
+
+  /// \brief Reflectivity
+  float reflectivity = 0.0f;
+
+  /// \brief Roughness
+  float roughness = 0.0f;
+
+  /// \brief Metalness
+  float metalness = 0.0f;
+
+  /// \brief Alpha threshold of textures with alpha
+  float alphaThreshold = 0.0f;
+
+  /// \brief Render order
+  float renderOrder = 0.0f;
+
+  /// \brief Texture coordinate set of the light map
+  uint32_t lightMapTexCoordSet = 0u;
+
+  /// \brief Shader type
+  uint32_t shaderType = 0u;
+
+  /// \brief SnapshotFlag bits
+  uint32_t flags = 0u;
+};
+
+/// \brief Visual in a snapshot. Visuals are stored depth first, so a
+/// visual's parent is always stored before it.
+struct SnapshotVisual
+{
+  /// \brief Name of the visual
+  SnapshotString name;
+
+  /// \brief Local position, x y z
+  double position[3];
+
+  /// \brief Local rotation, w x y z
+  double rotation[4];
+
+  /// \brief Local scale, x y z
+  double scale[3];
+
+  /// \brief Index of the parent visual, -1 for the root visual
+  int32_t parent = -1;
+
+  /// \brief Index of the material, -1 for none
+  int32_t material = -1;
+
+  /// \brief Visibility flags
+  uint32_t visibilityFlags = 0u;
+
+  /// \brief SnapshotFlag bits
+  uint32_t flags = 0u;
+
+  /// \brief Index of the first geometry
+  uint32_t firstGeometry = 0u;
+
+  /// \brief Number of geometries
+  uint32_t geometryCount = 0u;
+
+  /// \brief Index of the first user data entry
+  uint32_t firstUserData = 0u;
+
+  /// \brief Number of user data entries
+  uint32_t userDataCount = 0u;
+};
+
+/// \brief Geometry in a snapshot
+struct SnapshotGeometry
+{
+  /// \brief Mesh name, i.e. the key of the mesh in common::MeshManager
+  SnapshotString meshName;
+
+  /// \brief Submesh name
+  SnapshotString subMeshName;
+
+  /// \brief Capsule radius
+  double radius = 0.0;
+
+  /// \brief Capsule length
+  double length = 0.0;
+
+  /// \brief LOD reduction of the mesh
+  float lodReduction = 0.0f;
+
+  /// \brief SnapshotGeometryType
+  uint32_t type = SGT_MESH;
+
+  /// \brief SnapshotFlag bits
+  uint32_t flags = 0u;
+
+  /// \brief Index of the material of the first submesh
+  uint32_t firstSubMesh = 0u;
+
+  /// \brief Number of submesh materials
+  uint32_t subMeshCount = 0u;
+
+  /// \brief Index of the first LOD distance
+  uint32_t firstLod = 0u;
+
+  /// \brief Number of LOD distances
+  uint32_t lodCount = 0u;
+
+  /// \brief Unused, keeps the record size aligned
+  uint32_t reserved = 0u;
+};
+
+/// \brief User data entry in a snapshot
+struct SnapshotUserData
+{
+  /// \brief Key
+  SnapshotString key;
+
+  /// \brief Index of the alternative of Variant
+  uint32_t type = 0u;
+
+  /// \brief Unused, keeps the record size aligned
+  uint32_t reserved = 0u;
+
+  /// \brief Value of integer and boolean alternatives
+  int64_t integer = 0;
+
+  /// \brief Value of floating point alternatives
+  double real = 0.0;
+
+  /// \brief Value of the string alternative
+  SnapshotString text;
+};
+
+static_assert(sizeof(SnapshotHeader) % 8u == 0u &&
+    sizeof(SnapshotMaterial) % 8u == 0u &&
+    sizeof(SnapshotVisual) % 8u == 0u &&
+    sizeof(SnapshotGeometry) % 8u == 0u &&
+    sizeof(SnapshotUserData) % 8u == 0u,
+    "Snapshot records must keep the tables 8 byte aligned");
+
+/// \brief Create a user data value from a snapshot entry
+/// \param[in] _record User data entry
+/// \param[in] _text Value of the string alternative
+/// \return Value, std::monostate if the entry has an unknown type
+template <std::size_t I = 0>
+static Variant SnapshotUserDataValue(const SnapshotUserData &_record,
+    const std::string &_text)
+{
+  if constexpr (I < std::variant_size_v<Variant>)
+  {
+    if (_record.type != I)
+      return SnapshotUserDataValue<I + 1>(_record, _text);
+
+    using T = std::variant_alternative_t<I, Variant>;
+    if constexpr (std::is_same_v<T, std::string>)
+      return Variant(std::in_place_index<I>, _text);
+    else if constexpr (std::is_floating_point_v<T>)
+      return Variant(std::in_place_index<I>, static_cast<T>(_record.real));
+    else if constexpr (std::is_integral_v<T>)
+      return Variant(std::in_place_index<I>, static_cast<T>(_record.integer));
+    else
+      return Variant();
+  }
+  else
+  {
+    return Variant();
+  }
+}
+
+/// \brief Tables of a scene snapshot file, see Scene::SaveSnapshot
+struct SnapshotTables
+{
+  /// \brief Add a string to the string table
+  /// \param[in] _str String to add
+  /// \return Reference to the string
+  SnapshotString AddString(const std::string &_str)
+  {
+    SnapshotString ref;
+    ref.offset = static_cast<uint32_t>(this->strings.size());
+    ref.size = static_cast<uint32_t>(_str.size());
+    this->strings += _str;
+    return ref;
+  }
+
+  /// \brief Get a string from the string table
+  /// \param[in] _ref Reference to the string
+  /// \return String, empty if the reference is out of bounds
+  std::string String(const SnapshotString &_ref) const
+  {
+    if (static_cast<uint64_t>(_ref.offset) + _ref.size > this->strings.size())
+      return std::string();
+    return this->strings.substr(_ref.offset, _ref.size);
+  }
+
+  /// \brief Add a material to the table of materials, once
+  /// \param[in] _material Material to add
+  /// \return Index of the material, -1 if it is null
+  int32_t AddMaterial(const MaterialPtr &_material)
+  {
+    if (!_material)
+      return -1;
+
+    auto it = this->materialIndex.emplace(_material.get(),
+        static_cast<int32_t>(this->materials.size()));
+    if (!it.second)
+      return it.first->second;
+
+    SnapshotMaterial record;
+    record.name = this->AddString(_material->Name());
+    record.maps[0] = this->AddString(_material->Texture());
+    record.maps[1] = this->AddString(_material->NormalMap());
+    record.maps[2] = this->AddString(_material->RoughnessMap());
+    record.maps[3] = this->AddString(_material->MetalnessMap());
+    record.maps[4] = this->AddString(_material->EmissiveMap());
+    record.maps[5] = this->AddString(_material->EnvironmentMap());
+    record.maps[6] = this->AddString(_material->LightMap());
+    record.vertexShader = this->AddString(_material->VertexShader());
+    record.fragmentShader = this->AddString(_material->FragmentShader());
+    const math::Color colors[4] = {_material->Ambient(),
+        _material->Diffuse(), _material->Specular(), _material->Emissive()};
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+      record.colors[i * 4u] = colors[i].R();
+      record.colors[i * 4u + 1u] = colors[i].G();
+      record.colors[i * 4u + 2u] = colors[i].B();
+      record.colors[i * 4u + 3u] = colors[i].A();
+    }
+    record.shininess = static_cast<float>(_material->Shininess());
+    record.transparency = static_cast<float>(_material->Transparency());
+    record.reflectivity = static_cast<float>(_material->Reflectivity());
+    record.roughness = _material->Roughness();
+    record.metalness = _material->Metalness();
+    record.alphaThreshold = static_cast<float>(_material->AlphaThreshold());
+    record.renderOrder = _material->RenderOrder();
+    record.lightMapTexCoordSet = _material->LightMapTexCoordSet();
+    record.shaderType = static_cast<uint32_t>(_material->ShaderType());
+    record.flags =
+        (_material->LightingEnabled() ? SF_LIGHTING : 0u) |
+        (_material->DepthCheckEnabled() ? SF_DEPTH_CHECK : 0u) |
+        (_material->DepthWriteEnabled() ? SF_DEPTH_WRITE : 0u) |
+        (_material->CastShadows() ? SF_CAST_SHADOWS : 0u) |
+        (_material->ReceiveShadows() ? SF_RECEIVE_SHADOWS : 0u) |
+        (_material->ReflectionEnabled() ? SF_REFLECTION : 0u) |
+        (_material->TextureAlphaEnabled() ? SF_TEXTURE_ALPHA : 0u) |
+        (_material->TwoSidedEnabled() ? SF_TWO_SIDED : 0u);
+    this->materials.push_back(record);
+    return it.first->second;
+  }
+
+  /// \brief Apply the parameters of a snapshot material to a material
+  /// \param[in] _record Snapshot material
+  /// \param[in] _material Material to modify
+  void ApplyMaterial(const SnapshotMaterial &_record,
+      const MaterialPtr &_material) const
+  {
+    math::Color colors[4];
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+      colors[i].Set(_record.colors[i * 4u], _record.colors[i * 4u + 1u],
+          _record.colors[i * 4u + 2u], _record.colors[i * 4u + 3u]);
+    }
+    _material->SetAmbient(colors[0]);
+    _material->SetDiffuse(colors[1]);
+    _material->SetSpecular(colors[2]);
+    _material->SetEmissive(colors[3]);
+    _material->SetShininess(_record.shininess);
+    _material->SetTransparency(_record.transparency);
+    _material->SetReflectivity(_record.reflectivity);
+    _material->SetRoughness(_record.roughness);
+    _material->SetMetalness(_record.metalness);
+    _material->SetRenderOrder(_record.renderOrder);
+    _material->SetLightingEnabled(_record.flags & SF_LIGHTING);
+    _material->SetDepthCheckEnabled(_record.flags & SF_DEPTH_CHECK);
+    _material->SetDepthWriteEnabled(_record.flags & SF_DEPTH_WRITE);
+    _material->SetCastShadows(_record.flags & SF_CAST_SHADOWS);
+    _material->SetReceiveShadows(_record.flags & SF_RECEIVE_SHADOWS);
+    _material->SetReflectionEnabled(_record.flags & SF_REFLECTION);
+    _material->SetAlphaFromTexture(_record.flags & SF_TEXTURE_ALPHA,
+        _record.alphaThreshold, _record.flags & SF_TWO_SIDED);
+    _material->SetShaderType(static_cast<enum ShaderType>(_record.shaderType));
+
+    std::string maps[7];
+    for (unsigned int i = 0; i < 7u; ++i)
+      maps[i] = this->String(_record.maps[i]);
+    if (!maps[0].empty())
+      _material->SetTexture(maps[0]);
+    if (!maps[1].empty())
+      _material->SetNormalMap(maps[1]);
+    if (!maps[2].empty())
+      _material->SetRoughnessMap(maps[2]);
+    if (!maps[3].empty())
+      _material->SetMetalnessMap(maps[3]);
+    if (!maps[4].empty())
+      _material->SetEmissiveMap(maps[4]);
+    if (!maps[5].empty())
+      _material->SetEnvironmentMap(maps[5]);
+    if (!maps[6].empty())
+      _material->SetLightMap(maps[6], _record.lightMapTexCoordSet);
+
+    std::string vertexShader = this->String(_record.vertexShader);
+    if (!vertexShader.empty())
+      _material->SetVertexShader(vertexShader);
+    std::string fragmentShader = this->String(_record.fragmentShader);
+    if (!fragmentShader.empty())
+      _material->SetFragmentShader(fragmentShader);
+  }
+
+  /// \brief Add a visual, its geometries and its user data
+  /// \param[in] _visual Visual to add
+  /// \param[in] _parent Index of the parent visual, -1 for the root visual
+  /// \return Number of geometries that were skipped because they are
+  /// neither meshes nor capsules
+  unsigned int AddVisual(const VisualPtr &_visual, int32_t _parent)
+  {
+    unsigned int skipped = 0u;
+
+    SnapshotVisual record;
+    record.name = this->AddString(_visual->Name());
+    const math::Pose3d pose = _visual->LocalPose();
+    const math::Vector3d scale = _visual->LocalScale();
+    for (unsigned int i = 0; i < 3u; ++i)
+    {
+      record.position[i] = pose.Pos()[i];
+      record.scale[i] = scale[i];
+    }
+    record.rotation[0] = pose.Rot().W();
+    record.rotation[1] = pose.Rot().X();
+    record.rotation[2] = pose.Rot().Y();
+    record.rotation[3] = pose.Rot().Z();
+    record.parent = _parent;
+    record.material = this->AddMaterial(_visual->Material());
+    record.visibilityFlags = _visual->VisibilityFlags();
+    record.flags =
+        (_visual->Visible() ? SF_VISIBLE : 0u) |
+        (_visual->Static() ? SF_STATIC : 0u) |
+        (_visual->Wireframe() ? SF_WIREFRAME : 0u);
+
+    record.firstGeometry = static_cast<uint32_t>(this->geometries.size());
+    for (unsigned int i = 0; i < _visual->GeometryCount(); ++i)
+    {
+      GeometryPtr geometry = _visual->GeometryByIndex(i);
+      CapsulePtr capsule = std::dynamic_pointer_cast<Capsule>(geometry);
+      MeshPtr mesh = std::dynamic_pointer_cast<Mesh>(geometry);
+
+      SnapshotGeometry geom;
+      geom.firstSubMesh =
+          static_cast<uint32_t>(this->subMeshMaterials.size());
+      if (capsule)
+      {
+        geom.type = SGT_CAPSULE;
+        geom.radius = capsule->Radius();
+        geom.length = capsule->Length();
+        this->subMeshMaterials.push_back(
+            this->AddMaterial(capsule->Material()));
+      }
+      else if (mesh)
+      {
+        const MeshDescriptor &desc = mesh->Descriptor();
+        std::string meshName = desc.mesh ? desc.mesh->Name() : desc.meshName;
+        if (meshName.empty())
+        {
+          ++skipped;
+          continue;
+        }
+        geom.type = SGT_MESH;
+        geom.meshName = this->AddString(meshName);
+        geom.subMeshName = this->AddString(desc.subMeshName);
+        geom.lodReduction = static_cast<float>(desc.lodReduction);
+        geom.flags =
+            (desc.centerSubMesh ? SF_CENTER_SUBMESH : 0u) |
+            (desc.dynamic ? SF_DYNAMIC : 0u) |
+            (desc.halfPositions ? SF_HALF_POSITIONS : 0u) |
+            (desc.optimize ? SF_OPTIMIZE : 0u);
+        geom.firstLod = static_cast<uint32_t>(this->lodDistances.size());
+        geom.lodCount = static_cast<uint32_t>(desc.lodDistances.size());
+        this->lodDistances.insert(this->lodDistances.end(),
+            desc.lodDistances.begin(), desc.lodDistances.end());
+        for (unsigned int s = 0; s < mesh->SubMeshCount(); ++s)
+        {
+          this->subMeshMaterials.push_back(
+              this->AddMaterial(mesh->SubMeshByIndex(s)->Material()));
+        }
+      }
+      else
+      {
+        ++skipped;
+        continue;
+      }
+      geom.subMeshCount = static_cast<uint32_t>(
+          this->subMeshMaterials.size()) - geom.firstSubMesh;
+      this->geometries.push_back(geom);
+    }
+    record.geometryCount = static_cast<uint32_t>(this->geometries.size()) -
+        record.firstGeometry;
+
+    record.firstUserData = static_cast<uint32_t>(this->userData.size());
+    for (const auto &key : _visual->UserDataKeys())
+    {
+      SnapshotUserData entry;
+      entry.key = this->AddString(key);
+      Variant value = _visual->UserData(key);
+      entry.type = static_cast<uint32_t>(value.index());
+      std::visit([&](const auto &_value)
+      {
+        using T = std::decay_t<decltype(_value)>;
+        if constexpr (std::is_same_v<T, std::string>)
+          entry.text = this->AddString(_value);
+        else if constexpr (std::is_floating_point_v<T>)
+          entry.real = _value;
+        else if constexpr (std::is_integral_v<T>)
+          entry.integer = static_cast<int64_t>(_value);
+      }, value);
+      this->userData.push_back(entry);
+    }
+    record.userDataCount = static_cast<uint32_t>(this->userData.size()) -
+        record.firstUserData;
+
+    this->visuals.push_back(record);
+    return skipped;
+  }
+
+  /// \brief Write the tables to a stream
+  /// \param[in] _out Stream to write to
+  void Write(std::ostream &_out) const
+  {
+    SnapshotHeader header;
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.materialCount = static_cast<uint32_t>(this->materials.size());
+    header.visualCount = static_cast<uint32_t>(this->visuals.size());
+    header.geometryCount = static_cast<uint32_t>(this->geometries.size());
+    header.subMeshCount =
+        static_cast<uint32_t>(this->subMeshMaterials.size());
+    header.lodCount = static_cast<uint32_t>(this->lodDistances.size());
+    header.userDataCount = static_cast<uint32_t>(this->userData.size());
+    header.stringsSize = this->strings.size();
+
+    _out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    WriteTable(_out, this->materials);
+    WriteTable(_out, this->visuals);
+    WriteTable(_out, this->geometries);
+    WriteTable(_out, this->subMeshMaterials);
+    WriteTable(_out, this->lodDistances);
+    WriteTable(_out, this->userData);
+    _out.write(this->strings.data(), this->strings.size());
+  }
+
+  /// \brief Read and validate the tables of a snapshot file
+  /// \param[in] _data Contents of the file
+  /// \return True if the file is a valid snapshot
+  bool Read(const std::vector<char> &_data)
+  {
+    SnapshotHeader header;
+    if (_data.size() < sizeof(header))
+      return false;
+    std::memcpy(&header, _data.data(), sizeof(header));
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0
+        || header.version != kSnapshotVersion)
+    {
+      return false;
+    }
+
+    size_t offset = sizeof(header);
+    if (!ReadTable(_data, header.materialCount, offset, this->materials) ||
+        !ReadTable(_data, header.visualCount, offset, this->visuals) ||
+        !ReadTable(_data, header.geometryCount, offset, this->geometries) ||
+        !ReadTable(_data, header.subMeshCount, offset,
+            this->subMeshMaterials) ||
+        !ReadTable(_data, header.lodCount, offset, this->lodDistances) ||
+        !ReadTable(_data, header.userDataCount, offset, this->userData) ||
+        header.stringsSize > _data.size() - offset)
+    {
+      return false;
+    }
+    this->strings.assign(_data.data() + offset, header.stringsSize);
+
+    // check the references between tables once, so that loading does not
+    // have to
+    const int32_t materialCount = static_cast<int32_t>(header.materialCount);
+    for (uint32_t i = 0; i < header.visualCount; ++i)
+    {
+      const SnapshotVisual &visual = this->visuals[i];
+      if (visual.parent >= static_cast<int32_t>(i) ||
+          visual.material >= materialCount ||
+          !InRange(visual.firstGeometry, visual.geometryCount,
+              header.geometryCount) ||
+          !InRange(visual.firstUserData, visual.userDataCount,
+              header.userDataCount))
+      {
+        return false;
+      }
+    }
+    for (const auto &geom : this->geometries)
+    {
+      if (!InRange(geom.firstSubMesh, geom.subMeshCount,
+              header.subMeshCount) ||
+          !InRange(geom.firstLod, geom.lodCount, header.lodCount))
+      {
+        return false;
+      }
+    }
+    for (int32_t material : this->subMeshMaterials)
+    {
+      if (material >= materialCount)
+        return false;
+    }
+    return true;
+  }
+
+  /// \brief Write a table padded to 8 bytes
+  /// \param[in] _out Stream to write to
+  /// \param[in] _table Table to write
+  template <typename T>
+  static void WriteTable(std::ostream &_out, const std::vector<T> &_table)
+  {
+    const size_t size = _table.size() * sizeof(T);
+    const char padding[8] = {0};
+    _out.write(reinterpret_cast<const char *>(_table.data()), size);
+    _out.write(padding, (8u - size % 8u) % 8u);
+  }
+
+  /// \brief Read a table padded to 8 bytes
+  /// \param[in] _data Contents of the file
+  /// \param[in] _count Number of records in the table
+  /// \param[in, out] _offset Offset of the table in the file, advanced
+  /// past the table
+  /// \param[out] _table Table to read
+  /// \return True if the table lies within the file
+  template <typename T>
+  static bool ReadTable(const std::vector<char> &_data, uint32_t _count,
+      size_t &_offset, std::vector<T> &_table)
+  {
+    const uint64_t size = static_cast<uint64_t>(_count) * sizeof(T);
+    const uint64_t padded = size + (8u - size % 8u) % 8u;
+    if (padded > _data.size() - _offset)
+      return false;
+    _table.resize(_count);
+    std::memcpy(_table.data(), _data.data() + _offset, size);
+    _offset += padded;
+    return true;
+  }
+
+  /// \brief Check that a range of records lies within a table
+  /// \param[in] _first Index of the first record
+  /// \param[in] _count Number of records
+  /// \param[in] _size Number of records in the table
+  /// \return True if the range lies within the table
+  static bool InRange(uint32_t _first, uint32_t _count, uint32_t _size)
+  {
+    return static_cast<uint64_t>(_first) + _count <= _size;
+  }
+
+  /// \brief Materials
+  std::vector<SnapshotMaterial> materials;
+
+  /// \brief Visuals, depth first
+  std::vector<SnapshotVisual> visuals;
+
+  /// \brief Geometries of the visuals
+  std::vector<SnapshotGeometry> geometries;
+
+  /// \brief Index of the material of each submesh, -1 for none
+  std::vector<int32_t> subMeshMaterials;
+
+  /// \brief LOD distances of the meshes
+  std::vector<double> lodDistances;
+
+  /// \brief User data of the visuals
+  std::vector<SnapshotUserData> userData;
+
+  /// \brief String table
+  std::string strings;
+
+  /// \brief Index of each material added with AddMaterial
+  std::unordered_map<const Material *, int32_t> materialIndex;
+};
+
+//////////////////////////////////////////////////
+bool gz::rendering::SaveSceneSnapshotFile(const Scene &_scene,
+    const std::string &_path)
+{
+  VisualPtr root = _scene.RootVisual();
+  if (!root)
+  {
+    gzerr << "Unable to save scene snapshot [" << _path
+          << "]: scene has no root visual" << std::endl;
+    return false;
+  }
+
+  // depth first, so that parents are saved before their children
+  SnapshotTables tables;
+  unsigned int skipped = 0u;
+  std::vector<std::pair<VisualPtr, int32_t>> stack;
+  auto pushChildren = [&stack](const VisualPtr &_visual, int32_t _index)
+  {
+    for (unsigned int i = _visual->ChildCount(); i > 0u; --i)
+    {
+      VisualPtr child =
+          std::dynamic_pointer_cast<Visual>(_visual->ChildByIndex(i - 1u));
+      if (child)
+        stack.emplace_back(child, _index);
+    }
+  };
+  pushChildren(root, -1);
+  while (!stack.empty())
+  {
+    auto [visual, parent] = stack.back();
+    stack.pop_back();
+    int32_t index = static_cast<int32_t>(tables.visuals.size());
+    skipped += tables.AddVisual(visual, parent);
+    pushChildren(visual, index);
+  }
+
+  std::ofstream out(_path, std::ios::binary);
+  if (out)
+    tables.Write(out);
+  if (!out)
+  {
+    gzerr << "Unable to write scene snapshot [" << _path << "]"
+          << std::endl;
+    return false;
+  }
+
+  if (skipped > 0u)
+  {
+    gzwarn << skipped << " geometries of scene [" << _scene.Name() << "] are "
+           << "neither meshes nor capsules and were not saved to scene "
+           << "snapshot [" << _path << "]" << std::endl;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool gz::rendering::LoadSceneSnapshotFile(Scene &_scene,
+    const std::string &_path)
+{
+  std::ifstream in(_path, std::ios::binary | std::ios::ate);
+  if (!in)
+  {
+    gzerr << "Unable to open scene snapshot [" << _path << "]" << std::endl;
+    return false;
+  }
+  std::vector<char> data(static_cast<size_t>(in.tellg()));
+  in.seekg(0);
+  in.read(data.data(), static_cast<std::streamsize>(data.size()));
+
+  SnapshotTables tables;
+  if (!in || !tables.Read(data))
+  {
+    gzerr << "Invalid scene snapshot [" << _path << "]" << std::endl;
+    return false;
+  }
+
+  // load all meshes before creating any visual, so that render engines
+  // that preload meshes convert them together
+  auto *meshManager = common::MeshManager::Instance();
+  std::vector<MeshDescriptor> descs(tables.geometries.size());
+  std::vector<MeshDescriptor> preload;
+  for (size_t i = 0; i < tables.geometries.size(); ++i)
+  {
+    const SnapshotGeometry &geom = tables.geometries[i];
+    if (geom.type != SGT_MESH)
+      continue;
+
+    MeshDescriptor &desc = descs[i];
+    desc.meshName = tables.String(geom.meshName);
+    desc.subMeshName = tables.String(geom.subMeshName);
+    desc.centerSubMesh = geom.flags & SF_CENTER_SUBMESH;
+    desc.dynamic = geom.flags & SF_DYNAMIC;
+    desc.halfPositions = geom.flags & SF_HALF_POSITIONS;
+    desc.optimize = geom.flags & SF_OPTIMIZE;
+    desc.lodReduction = geom.lodReduction;
+    desc.lodDistances.assign(
+        tables.lodDistances.begin() + geom.firstLod,
+        tables.lodDistances.begin() + geom.firstLod + geom.lodCount);
+    if (!meshManager->HasMesh(desc.meshName))
+      meshManager->Load(desc.meshName);
+    desc.Load();
+    if (desc.mesh)
+      preload.push_back(desc);
+  }
+  _scene.PreloadMeshes(preload);
+
+  std::vector<MaterialPtr> materials;
+  materials.reserve(tables.materials.size());
+  for (const auto &record : tables.materials)
+  {
+    std::string materialName = tables.String(record.name);
+    MaterialPtr material = _scene.MaterialRegistered(materialName) ?
+        _scene.CreateMaterial() : _scene.CreateMaterial(materialName);
+    if (material)
+      tables.ApplyMaterial(record, material);
+    materials.push_back(material);
+  }
+
+  VisualPtr root = _scene.RootVisual();
+  std::vector<VisualPtr> visuals;
+  visuals.reserve(tables.visuals.size());
+  for (const auto &record : tables.visuals)
+  {
+    std::string visualName = tables.String(record.name);
+    VisualPtr visual = (visualName.empty() || _scene.HasVisualName(visualName))
+        ? _scene.CreateVisual() : _scene.CreateVisual(visualName);
+    visuals.push_back(visual);
+    if (!visual)
+      continue;
+
+    // the visual's material first, so that the submesh materials below
+    // override it where they differ
+    if (record.material >= 0 && materials[record.material])
+      visual->SetMaterial(materials[record.material], false);
+
+    for (uint32_t g = record.firstGeometry;
+         g < record.firstGeometry + record.geometryCount; ++g)
+    {
+      const SnapshotGeometry &geom = tables.geometries[g];
+      GeometryPtr geometry;
+      MeshPtr mesh;
+      if (geom.type == SGT_CAPSULE)
+      {
+        CapsulePtr capsule = _scene.CreateCapsule();
+        if (capsule)
+        {
+          capsule->SetRadius(geom.radius);
+          capsule->SetLength(geom.length);
+        }
+        geometry = capsule;
+      }
+      else if (geom.type == SGT_MESH && descs[g].mesh)
+      {
+        mesh = _scene.CreateMesh(descs[g]);
+        geometry = mesh;
+      }
+      if (!geometry)
+        continue;
+      visual->AddGeometry(geometry);
+
+      for (uint32_t s = 0; s < geom.subMeshCount; ++s)
+      {
+        int32_t m = tables.subMeshMaterials[geom.firstSubMesh + s];
+        if (m < 0 || !materials[m])
+          continue;
+        if (!mesh)
+          geometry->SetMaterial(materials[m], false);
+        else if (s < mesh->SubMeshCount())
+          mesh->SubMeshByIndex(s)->SetMaterial(materials[m], false);
+      }
+    }
+
+    for (uint32_t u = record.firstUserData;
+         u < record.firstUserData + record.userDataCount; ++u)
+    {
+      const SnapshotUserData &entry = tables.userData[u];
+      visual->SetUserData(tables.String(entry.key),
+          SnapshotUserDataValue(entry, tables.String(entry.text)));
+    }
+
+    visual->SetLocalScale(math::Vector3d(
+        record.scale[0], record.scale[1], record.scale[2]));
+    visual->SetLocalPose(math::Pose3d(
+        math::Vector3d(record.position[0], record.position[1],
+            record.position[2]),
+        math::Quaterniond(record.rotation[0], record.rotation[1],
+            record.rotation[2], record.rotation[3])));
+    visual->SetVisibilityFlags(record.visibilityFlags);
+    visual->SetStatic(record.flags & SF_STATIC);
+    visual->SetWireframe(record.flags & SF_WIREFRAME);
+    visual->SetVisible(record.flags & SF_VISIBLE);
+
+    VisualPtr parent = record.parent >= 0 ? visuals[record.parent] : root;
+    if (parent)
+      parent->AddChild(visual);
+  }
+  return true;
+}
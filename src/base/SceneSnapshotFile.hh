@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASE_SCENESNAPSHOTFILE_HH_
+#define GZ_RENDERING_BASE_SCENESNAPSHOTFILE_HH_
+
+#include <string>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Scene.hh"
+
+namespace gz
+{
+namespace rendering
+{
+inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+/// \brief Save the visuals below the root visual of a scene to a binary
+/// snapshot file, see Scene::SaveSnapshot
+/// \param[in] _scene Scene to save
+/// \param[in] _path Path of the file to write
+/// \return True if the file was written
+bool SaveSceneSnapshotFile(const Scene &_scene, const std::string &_path);
+
+/// \brief Recreate the visuals of a snapshot file below the root visual
+/// of a scene, see Scene::LoadSnapshot
+/// \param[in] _scene Scene to load the visuals into
+/// \param[in] _path Path of the file to read
+/// \return True if the file was read
+bool LoadSceneSnapshotFile(Scene &_scene, const std::string &_path);
+}
+}
+}
+#endif
@@ -33,3 +33,24 @@ TEST(BoundingBoxTest, BoundingBox)
 {
   BoundingBox box;
 }
+
+/////////////////////////////////////////////////
+TEST(BoundingBoxTest, Visibility)
+{
+  BoundingBox box;
+  EXPECT_EQ(0u, box.VisiblePixelCount());
+  EXPECT_DOUBLE_EQ(0.0, box.ProjectedArea());
+  EXPECT_DOUBLE_EQ(0.0, box.Truncation());
+  EXPECT_DOUBLE_EQ(0.0, box.Occlusion());
+
+  box.SetVisiblePixelCount(120u);
+  box.SetProjectedArea(200.0);
+  box.SetTruncation(0.25);
+  box.SetOcclusion(0.4);
+
+  BoundingBox copy(box);
+  EXPECT_EQ(120u, copy.VisiblePixelCount());
+  EXPECT_DOUBLE_EQ(200.0, copy.ProjectedArea());
+  EXPECT_DOUBLE_EQ(0.25, copy.Truncation());
+  EXPECT_DOUBLE_EQ(0.4, copy.Occlusion());
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/CameraArray.hh"
+#include "gz/rendering/Light.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class CameraArrayTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(CameraArrayTest, Views)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraArrayPtr array = scene->CreateCameraArray();
+  ASSERT_NE(nullptr, array);
+  scene->RootVisual()->AddChild(array);
+  EXPECT_EQ(0u, array->ViewCount());
+  EXPECT_EQ(nullptr, array->ViewByIndex(0u));
+  EXPECT_TRUE(array->SharedCulling());
+
+  // views are children of the array
+  math::Pose3d pose(0, 0.1, 0, 0, 0, 0);
+  CameraPtr view = array->AddView(pose);
+  ASSERT_NE(nullptr, view);
+  EXPECT_EQ(1u, array->ViewCount());
+  EXPECT_EQ(view, array->ViewByIndex(0u));
+  EXPECT_EQ(pose, view->LocalPose());
+  EXPECT_TRUE(array->HasChild(view));
+
+  array->SetLocalPosition(1, 0, 0);
+  EXPECT_EQ(math::Vector3d(1, 0.1, 0), view->WorldPosition());
+
+  array->SetSharedCulling(false);
+  EXPECT_FALSE(array->SharedCulling());
+
+  // destroying the array destroys its views
+  scene->DestroySensor(array);
+  EXPECT_FALSE(scene->HasSensor(view));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraArrayTest, SharedCulling)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  // one view looks along +X, the other along -X
+  CameraArrayPtr array = scene->CreateCameraArray();
+  ASSERT_NE(nullptr, array);
+  root->AddChild(array);
+  for (double yaw : {0.0, GZ_PI})
+  {
+    CameraPtr view = array->AddView(math::Pose3d(0, 0, 0, 0, 0, yaw));
+    ASSERT_NE(nullptr, view);
+    view->SetImageWidth(16u);
+    view->SetImageHeight(16u);
+    view->SetFarClipPlane(20.0);
+  }
+
+  // a box in front of each view and one above both of them
+  auto createBox = [&](const math::Vector3d &_position)
+  {
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetLocalPosition(_position);
+    root->AddChild(box);
+    return box;
+  };
+  VisualPtr front = createBox(math::Vector3d(5, 0, 0));
+  VisualPtr back = createBox(math::Vector3d(-5, 0, 0));
+  VisualPtr above = createBox(math::Vector3d(0, 0, 15));
+
+  // the hidden visual is already skipped by the render engine
+  VisualPtr hidden = createBox(math::Vector3d(0, 0, -15));
+  hidden->SetVisible(false);
+
+  array->Update();
+  EXPECT_EQ(1u, array->CulledVisualCount());
+  EXPECT_FALSE(array->IsCulled(front));
+  EXPECT_FALSE(array->IsCulled(back));
+  EXPECT_TRUE(array->IsCulled(above));
+  EXPECT_FALSE(array->IsCulled(hidden));
+
+  // culling does not change the visibility seen by the user
+  EXPECT_TRUE(above->Visible());
+  EXPECT_FALSE(hidden->Visible());
+
+  // moving the box in front of a view makes it visible again
+  above->SetLocalPosition(5, 0, 2);
+  array->Update();
+  EXPECT_EQ(0u, array->CulledVisualCount());
+  EXPECT_FALSE(array->IsCulled(above));
+
+  // a view whose frustum is unknown disables culling
+  above->SetLocalPosition(0, 0, 15);
+  array->Update();
+  EXPECT_EQ(1u, array->CulledVisualCount());
+  array->ViewByIndex(1u)->SetProjectionType(CPT_ORTHOGRAPHIC);
+  array->Update();
+  EXPECT_EQ(0u, array->CulledVisualCount());
+  array->ViewByIndex(1u)->SetProjectionType(CPT_PERSPECTIVE);
+
+  // visuals that cast shadows are kept if a light casts shadows
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetCastShadows(true);
+  root->AddChild(light);
+  array->Update();
+  EXPECT_EQ(0u, array->CulledVisualCount());
+  light->SetCastShadows(false);
+
+  // a lamp outside of the views still lights what they see
+  array->Update();
+  EXPECT_TRUE(array->IsCulled(above));
+  PointLightPtr lamp = scene->CreatePointLight();
+  lamp->SetCastShadows(false);
+  above->AddChild(lamp);
+  array->Update();
+  EXPECT_FALSE(array->IsCulled(above));
+  scene->DestroyLight(lamp);
+  array->Update();
+  EXPECT_TRUE(array->IsCulled(above));
+
+  array->SetSharedCulling(false);
+  array->Update();
+  EXPECT_EQ(0u, array->CulledVisualCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -17,12 +17,17 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstring>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
 #include "gz/rendering/GaussianNoisePass.hh"
 #include "gz/rendering/RenderPassSystem.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/SensorQualityProfile.hh"
 #include "gz/rendering/Utils.hh"
 
 using namespace gz;
@@ -123,6 +128,23 @@ TEST_F(CameraTest, ViewProjectionMatrix)
   EXPECT_LT(static_cast<int>(width * 0.5), pos2d.X());
   EXPECT_LT(static_cast<int>(height * 0.5), pos2d.Y());
 
+  // project many points at once, an odd number to cover the points left
+  // over by the vectorized loop
+  std::vector<math::Vector3d> pts;
+  for (int i = -2; i <= 2; ++i)
+  {
+    for (int j = -1; j <= 1; ++j)
+      pts.emplace_back(2.0 + j, i * 0.5, j * 0.3);
+  }
+  std::vector<math::Vector2d> screenPts(pts.size());
+  camera->ProjectPoints(pts.data(), screenPts.data(), pts.size());
+  for (size_t i = 0u; i < pts.size(); ++i)
+  {
+    pos2d = camera->Project(pts[i]);
+    EXPECT_NEAR(pos2d.X(), screenPts[i].X(), 1.0);
+    EXPECT_NEAR(pos2d.Y(), screenPts[i].Y(), 1.0);
+  }
+
   // Clean up
   engine->DestroyScene(scene);
 }
@@ -300,6 +322,80 @@ TEST_F(CameraTest, VisibilityMask)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(CameraTest, QualityProfile)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(32u);
+  camera->SetImageHeight(32u);
+  scene->RootVisual()->AddChild(camera);
+
+  // everything is enabled by default
+  SensorQualityProfile profile = camera->QualityProfile();
+  EXPECT_TRUE(profile.shadows);
+  EXPECT_TRUE(profile.globalIllumination);
+  EXPECT_TRUE(profile.particles);
+  EXPECT_TRUE(profile.antiAliasing);
+  EXPECT_EQ(static_cast<uint32_t>(GZ_VISIBILITY_ALL), profile.visibilityMask);
+
+  profile.shadows = false;
+  profile.globalIllumination = false;
+  profile.particles = false;
+  profile.antiAliasing = false;
+  profile.visibilityMask = 0x00000010u;
+  camera->SetQualityProfile(profile);
+
+  profile = camera->QualityProfile();
+  EXPECT_FALSE(profile.shadows);
+  EXPECT_FALSE(profile.globalIllumination);
+  EXPECT_FALSE(profile.particles);
+  EXPECT_FALSE(profile.antiAliasing);
+  EXPECT_EQ(0x00000010u, profile.visibilityMask);
+
+  // the profile does not change the camera's own settings
+  EXPECT_EQ(static_cast<uint32_t>(GZ_VISIBILITY_ALL),
+      camera->VisibilityMask());
+
+  // render with the profile, then with it reverted
+  camera->Update();
+  camera->SetQualityProfile(SensorQualityProfile());
+  camera->Update();
+  EXPECT_TRUE(camera->QualityProfile().shadows);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, LodBias)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+
+  // check initial value
+  EXPECT_DOUBLE_EQ(1.0, camera->LodBias());
+
+  // check setting new values
+  camera->SetLodBias(0.25);
+  EXPECT_DOUBLE_EQ(0.25, camera->LodBias());
+
+  // invalid values are ignored
+  camera->SetLodBias(0.0);
+  EXPECT_DOUBLE_EQ(0.25, camera->LodBias());
+  camera->SetLodBias(-1.0);
+  EXPECT_DOUBLE_EQ(0.25, camera->LodBias());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(CameraTest, IntrinsicMatrix)
 {
@@ -377,3 +473,257 @@ TEST_F(CameraTest, IntrinsicMatrix)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, DynamicResolution)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(48u);
+  scene->RootVisual()->AddChild(camera);
+
+  // disabled by default
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      camera->DynamicResolutionTarget());
+  EXPECT_DOUBLE_EQ(1.0, camera->DynamicResolutionScale());
+
+  // invalid minimum scales are rejected
+  camera->SetDynamicResolution(std::chrono::milliseconds(16), 0.0);
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      camera->DynamicResolutionTarget());
+
+  // a target no frame can meet lowers the scale down to the minimum
+  camera->SetDynamicResolution(std::chrono::nanoseconds(1), 0.5);
+  EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::nanoseconds(1)),
+      camera->DynamicResolutionTarget());
+  for (unsigned int i = 0u; i < 100u; ++i)
+    camera->Update();
+  EXPECT_LT(camera->DynamicResolutionScale(), 1.0);
+  EXPECT_GE(camera->DynamicResolutionScale(), 0.5);
+
+  // images keep the camera's resolution
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  EXPECT_EQ(64u, image.Width());
+  EXPECT_EQ(48u, image.Height());
+
+  // disabling restores the full resolution
+  camera->SetDynamicResolution(std::chrono::steady_clock::duration::zero());
+  EXPECT_DOUBLE_EQ(1.0, camera->DynamicResolutionScale());
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, ResizeDelay)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(1.0, 0.0, 0.0);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(48u);
+  scene->RootVisual()->AddChild(camera);
+
+  // disabled by default
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      camera->ResizeDelay());
+
+  camera->SetResizeDelay(std::chrono::hours(1));
+  EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::hours(1)),
+      camera->ResizeDelay());
+  camera->Update();
+
+  // the new size is reported right away, but the target keeps rendering
+  // at the previous size so images cannot be copied yet
+  camera->SetImageWidth(80u);
+  camera->SetImageHeight(60u);
+  EXPECT_EQ(80u, camera->ImageWidth());
+  EXPECT_EQ(60u, camera->ImageHeight());
+  Image image = camera->CreateImage();
+  EXPECT_EQ(80u, image.Width());
+  memset(image.Data(), 0, image.MemorySize());
+  camera->Capture(image);
+  EXPECT_EQ(0u, image.Data<unsigned char>()[0]);
+
+  // without a delay the held back size is applied on the next render
+  camera->SetResizeDelay(std::chrono::steady_clock::duration::zero());
+  camera->Capture(image);
+  EXPECT_EQ(255u, image.Data<unsigned char>()[0]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, ImageOutputs)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(1.0, 0.0, 0.0);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(48u);
+  camera->SetImageFormat(PF_R8G8B8);
+  scene->RootVisual()->AddChild(camera);
+
+  EXPECT_EQ(0u, camera->ImageOutputCount());
+  EXPECT_EQ(math::Vector2i::Zero, camera->ImageOutputSize(0u));
+  EXPECT_EQ(nullptr, camera->ConnectNewImageOutputFrame(0u,
+      [](const void *, unsigned int, unsigned int, unsigned int,
+      const std::string &){}));
+
+  EXPECT_EQ(0u, camera->AddImageOutput(16u, 16u));
+  EXPECT_EQ(1u, camera->AddImageOutput(32u, 24u));
+  EXPECT_EQ(2u, camera->ImageOutputCount());
+  EXPECT_EQ(math::Vector2i(32, 24), camera->ImageOutputSize(1u));
+
+  // listeners receive each frame at the output size
+  unsigned int frameWidth = 0u;
+  unsigned int frameHeight = 0u;
+  unsigned char red = 0u;
+  common::ConnectionPtr connection = camera->ConnectNewImageOutputFrame(0u,
+      [&](const void *_data, unsigned int _width, unsigned int _height,
+      unsigned int, const std::string &)
+      {
+        frameWidth = _width;
+        frameHeight = _height;
+        red = static_cast<const unsigned char *>(_data)[0];
+      });
+  ASSERT_NE(nullptr, connection);
+  EXPECT_TRUE(camera->HasConnections());
+  camera->Update();
+  EXPECT_EQ(16u, frameWidth);
+  EXPECT_EQ(16u, frameHeight);
+  EXPECT_EQ(255u, red);
+
+  // outputs can be copied like the full image
+  Image image(32u, 24u, PF_R8G8B8);
+  memset(image.Data(), 0, image.MemorySize());
+  camera->CopyImageOutput(1u, image);
+  EXPECT_EQ(255u, image.Data<unsigned char>()[0]);
+  EXPECT_EQ(0u, image.Data<unsigned char>()[1]);
+
+  camera->RemoveImageOutputs();
+  EXPECT_EQ(0u, camera->ImageOutputCount());
+  EXPECT_FALSE(camera->HasConnections());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, LastFrameInfo)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(32u);
+  camera->SetImageHeight(32u);
+  camera->SetWorldPose(math::Pose3d(1, 2, 3, 0, 0.5, 0));
+  scene->RootVisual()->AddChild(camera);
+
+  // no frame yet
+  EXPECT_EQ(0u, camera->LastFrameInfo().sequence);
+
+  // listeners see the metadata of the frame they receive
+  FrameInfo listenerInfo;
+  common::ConnectionPtr connection = camera->ConnectNewImageFrame(
+      [&](const void *, unsigned int, unsigned int, unsigned int,
+      const std::string &)
+      {
+        listenerInfo = camera->LastFrameInfo();
+      });
+  ASSERT_NE(nullptr, connection);
+
+  scene->SetTime(std::chrono::seconds(2));
+  camera->Update();
+  FrameInfo info = camera->LastFrameInfo();
+  EXPECT_EQ(1u, info.sequence);
+  EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::seconds(2)),
+      info.time);
+  EXPECT_EQ(camera->WorldPose(), info.pose);
+  EXPECT_LE(info.submitTime, info.readbackTime);
+  EXPECT_EQ(info.sequence, listenerInfo.sequence);
+
+  // the pose and time of each frame are recorded
+  camera->SetWorldPosition(4, 5, 6);
+  scene->SetTime(std::chrono::seconds(3));
+  camera->Update();
+  info = camera->LastFrameInfo();
+  EXPECT_EQ(2u, info.sequence);
+  EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::seconds(3)),
+      info.time);
+  EXPECT_EQ(math::Vector3d(4, 5, 6), info.pose.Pos());
+
+  connection.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, RenderViewpoints)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.0, 1.0, 0.0);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(32u);
+  camera->SetImageHeight(24u);
+  camera->SetImageFormat(PF_R8G8B8);
+  const math::Pose3d pose(1, 2, 3, 0, 0, 0);
+  camera->SetWorldPose(pose);
+  scene->RootVisual()->AddChild(camera);
+
+  std::vector<math::Pose3d> poses;
+  for (unsigned int i = 0u; i < 7u; ++i)
+    poses.emplace_back(i * 0.5, 0, 0, 0, 0, i * 0.1);
+
+  // every viewpoint is delivered once, in order
+  std::vector<std::size_t> indices;
+  unsigned char green = 0u;
+  camera->RenderViewpoints(poses,
+      [&](std::size_t _index, const Image &_image)
+      {
+        indices.push_back(_index);
+        EXPECT_EQ(32u, _image.Width());
+        EXPECT_EQ(24u, _image.Height());
+        green = _image.Data<unsigned char>()[1];
+      }, 3u);
+  ASSERT_EQ(poses.size(), indices.size());
+  for (std::size_t i = 0u; i < indices.size(); ++i)
+    EXPECT_EQ(i, indices[i]);
+  EXPECT_EQ(255u, green);
+
+  // the camera and the scene are left as they were
+  EXPECT_EQ(pose, camera->WorldPose());
+  EXPECT_FALSE(scene->PreRenderDirtyTracking());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -18,11 +18,15 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
+
+#include <gz/common/MeshManager.hh>
 
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Capsule.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -89,3 +93,49 @@ TEST_F(CapsuleTest, Capsule)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(CapsuleTest, CapsuleMeshRelease)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  // capsules of the same size share a mesh
+  const std::string meshName = "capsule_mesh_0.250000_0.750000";
+  VisualPtr visual = scene->CreateVisual();
+  root->AddChild(visual);
+  CapsulePtr capsule = scene->CreateCapsule();
+  ASSERT_NE(nullptr, capsule);
+  capsule->SetRadius(0.25);
+  capsule->SetLength(0.75);
+  visual->AddGeometry(capsule);
+
+  VisualPtr visual2 = scene->CreateVisual();
+  root->AddChild(visual2);
+  CapsulePtr capsule2 = scene->CreateCapsule();
+  ASSERT_NE(nullptr, capsule2);
+  capsule2->SetRadius(0.25);
+  capsule2->SetLength(0.75);
+  visual2->AddGeometry(capsule2);
+
+  visual->PreRender();
+  visual2->PreRender();
+  EXPECT_TRUE(common::MeshManager::Instance()->HasMesh(meshName));
+
+  // the mesh is kept while a capsule of that size is left
+  visual->RemoveGeometry(capsule);
+  capsule->Destroy();
+  EXPECT_TRUE(common::MeshManager::Instance()->HasMesh(meshName));
+
+  // and unloaded when the last one is resized
+  capsule2->SetRadius(0.3);
+  visual2->PreRender();
+  EXPECT_FALSE(common::MeshManager::Instance()->HasMesh(meshName));
+  EXPECT_TRUE(common::MeshManager::Instance()->HasMesh(
+      "capsule_mesh_0.300000_0.750000"));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -71,6 +71,10 @@ TEST_F(GaussianNoisePassTest, GaussianNoise)
   EXPECT_LE(std::fabs(noisePass->Bias()), biasMean + biasStdDev*4);
   EXPECT_GE(std::fabs(noisePass->Bias()), biasMean - biasStdDev*4);
 
+  // seed
+  noisePass->SetSeed(1234u);
+  EXPECT_EQ(1234u, noisePass->Seed());
+
   noisePass->SetWideAngleCameraAfterStitching(false);
   EXPECT_EQ(false, noisePass->WideAngleCameraAfterStitching());
   noisePass->SetWideAngleCameraAfterStitching(true);
@@ -93,6 +93,28 @@ TEST_F(GlobalIlluminationTest, GlobalIlluminationVct)
   EXPECT_TRUE(gi->ConserveMemory());
   EXPECT_FLOAT_EQ(1.0f, gi->ThinWallCounter());
 
+  // nothing changed since the last build
+  EXPECT_FALSE(gi->BuildIfChanged());
+
+  // adding a static visual requires voxelizing the scene again
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  root->AddChild(box);
+  box->SetStatic(true);
+  EXPECT_TRUE(gi->BuildIfChanged());
+  EXPECT_FALSE(gi->BuildIfChanged());
+
+  // dynamic visuals don't participate by default
+  VisualPtr dynamicBox = scene->CreateVisual();
+  dynamicBox->AddGeometry(scene->CreateBox());
+  root->AddChild(dynamicBox);
+  dynamicBox->SetLocalPosition(1, 2, 3);
+  EXPECT_FALSE(gi->BuildIfChanged());
+
+  // changing settings requires voxelizing the scene again
+  gi->SetOctantCount(octantCount);
+  EXPECT_TRUE(gi->BuildIfChanged());
+
   EXPECT_FALSE(gi->Enabled());
   scene->SetActiveGlobalIllumination(gi);
   EXPECT_TRUE(gi->Enabled());
@@ -266,6 +288,11 @@ TEST_F(GlobalIlluminationTest, GlobalIlluminationCiVct)
   EXPECT_FALSE(gi->Anisotropic());
   EXPECT_EQ(3u, gi->BounceCount());
 
+  EXPECT_EQ(1u, gi->UpdateInterval());
+  gi->SetUpdateInterval(4u);
+  EXPECT_EQ(4u, gi->UpdateInterval());
+  gi->Converge();
+
   EXPECT_EQ(GlobalIlluminationCiVct::DVM_None, gi->DebugVisualization());
   gi->SetDebugVisualization(GlobalIlluminationCiVct::DVM_Albedo);
   EXPECT_EQ(GlobalIlluminationCiVct::DVM_Albedo, gi->DebugVisualization());
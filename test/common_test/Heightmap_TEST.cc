@@ -17,6 +17,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/geospatial/ImageHeightmap.hh>
@@ -141,6 +146,160 @@ TEST_F(HeightmapTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Heightmap))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+// ogre1 not supported on Windows
+TEST_F(HeightmapTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(AsyncLoading))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  auto heightImage = common::joinPaths(TEST_MEDIA_PATH, "heightmap_bowl.png");
+  auto data = std::make_shared<common::ImageHeightmap>();
+  data->Load(heightImage);
+
+  HeightmapDescriptor desc;
+  EXPECT_FALSE(desc.AsyncLoading());
+  desc.SetData(data);
+  desc.SetSize({17, 17, 10});
+  desc.SetSampling(2u);
+  desc.SetAsyncLoading(true);
+  EXPECT_TRUE(desc.AsyncLoading());
+
+  auto heightmap = scene->CreateHeightmap(desc);
+  ASSERT_NE(nullptr, heightmap);
+  EXPECT_TRUE(heightmap->Descriptor().AsyncLoading());
+
+  auto vis = scene->CreateVisual();
+  vis->AddGeometry(heightmap);
+  scene->RootVisual()->AddChild(vis);
+
+  // the heightmap finishes loading on the render thread
+  for (unsigned int i = 0; i < 500u && !heightmap->IsLoaded(); ++i)
+  {
+    scene->PreRender();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(heightmap->IsLoaded());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+// ogre1 not supported on Windows
+TEST_F(HeightmapTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ShadowUpdate))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  auto heightImage = common::joinPaths(TEST_MEDIA_PATH, "heightmap_bowl.png");
+  auto data = std::make_shared<common::ImageHeightmap>();
+  data->Load(heightImage);
+
+  HeightmapDescriptor desc;
+  desc.SetData(data);
+  desc.SetSize({17, 17, 10});
+  desc.SetSampling(2u);
+
+  auto heightmap = scene->CreateHeightmap(desc);
+  ASSERT_NE(nullptr, heightmap);
+
+  EXPECT_EQ(math::Angle::Zero, heightmap->ShadowUpdateThreshold());
+  EXPECT_EQ(0u, heightmap->ShadowUpdateInterval());
+
+  heightmap->SetShadowUpdateThreshold(GZ_DTOR(0.5));
+  heightmap->SetShadowUpdateInterval(10u);
+  EXPECT_EQ(math::Angle(GZ_DTOR(0.5)), heightmap->ShadowUpdateThreshold());
+  EXPECT_EQ(10u, heightmap->ShadowUpdateInterval());
+
+  EXPECT_DOUBLE_EQ(0.0, heightmap->LodUpdateDistance());
+  heightmap->SetLodUpdateDistance(2.0);
+  EXPECT_DOUBLE_EQ(2.0, heightmap->LodUpdateDistance());
+  heightmap->SetLodUpdateDistance(-1.0);
+  EXPECT_DOUBLE_EQ(0.0, heightmap->LodUpdateDistance());
+
+  EXPECT_EQ(0u, heightmap->TextureUnloadFrames());
+  heightmap->SetTextureUnloadFrames(30u);
+  EXPECT_EQ(30u, heightmap->TextureUnloadFrames());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(HeightmapTest, HeightsAt)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  auto heightImage = common::joinPaths(TEST_MEDIA_PATH, "heightmap_bowl.png");
+  auto data = std::make_shared<common::ImageHeightmap>();
+  data->Load(heightImage);
+
+  HeightmapDescriptor desc;
+  desc.SetData(data);
+  desc.SetSize({17, 17, 10});
+  desc.SetSampling(2u);
+
+  // the heights are dropped once loaded unless requested
+  EXPECT_FALSE(desc.HeightQueries());
+  auto noQueries = scene->CreateHeightmap(desc);
+  ASSERT_NE(nullptr, noQueries);
+  ASSERT_TRUE(noQueries->IsLoaded());
+  std::vector<double> noHeights = noQueries->HeightsAt({{0.0, 0.0}});
+  ASSERT_EQ(1u, noHeights.size());
+  EXPECT_TRUE(std::isnan(noHeights[0]));
+
+  desc.SetHeightQueries(true);
+  auto heightmap = scene->CreateHeightmap(desc);
+  ASSERT_NE(nullptr, heightmap);
+  ASSERT_TRUE(heightmap->IsLoaded());
+
+  EXPECT_TRUE(heightmap->HeightsAt({}).empty());
+
+  // the bowl is low in the middle and high at the rim, positions outside
+  // of the terrain have no height
+  std::vector<math::Vector2d> positions = {
+      {0.0, 0.0}, {7.0, 0.0}, {0.0, -7.0}, {20.0, 0.0}, {0.0, -20.0}};
+  std::vector<double> heights = heightmap->HeightsAt(positions);
+  ASSERT_EQ(positions.size(), heights.size());
+  for (unsigned int i = 0; i < 3u; ++i)
+  {
+    EXPECT_FALSE(std::isnan(heights[i]));
+    EXPECT_LE(-1e-3, heights[i]);
+    EXPECT_GE(10.0 + 1e-3, heights[i]);
+  }
+  EXPECT_LT(heights[0], heights[1]);
+  EXPECT_LT(heights[0], heights[2]);
+  EXPECT_TRUE(std::isnan(heights[3]));
+  EXPECT_TRUE(std::isnan(heights[4]));
+
+  // large batches are spread across threads and give the same heights
+  std::vector<math::Vector2d> manyPositions;
+  for (unsigned int i = 0; i < 2000u; ++i)
+    manyPositions.insert(manyPositions.end(), positions.begin(),
+                         positions.end());
+  std::vector<double> manyHeights = heightmap->HeightsAt(manyPositions);
+  ASSERT_EQ(manyPositions.size(), manyHeights.size());
+  for (size_t i = 0; i < manyHeights.size(); ++i)
+  {
+    const double expected = heights[i % heights.size()];
+    if (std::isnan(expected))
+      EXPECT_TRUE(std::isnan(manyHeights[i]));
+    else
+      EXPECT_DOUBLE_EQ(expected, manyHeights[i]);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 //////////////////////////////////////////////////
 TEST_F(HeightmapTest, MoveConstructor)
 {
@@ -182,12 +341,14 @@ TEST_F(HeightmapTest, CopyConstructor)
   descriptor.SetSize({0.1, 0.2, 0.3});
   descriptor.SetPosition({0.5, 0.6, 0.7});
   descriptor.SetUseTerrainPaging(true);
+  descriptor.SetHeightQueries(true);
   descriptor.SetSampling(123u);
 
   HeightmapDescriptor descriptor2(descriptor);
   EXPECT_EQ(gz::math::Vector3d(0.1, 0.2, 0.3), descriptor2.Size());
   EXPECT_EQ(gz::math::Vector3d(0.5, 0.6, 0.7), descriptor2.Position());
   EXPECT_TRUE(descriptor2.UseTerrainPaging());
+  EXPECT_TRUE(descriptor2.HeightQueries());
   EXPECT_EQ(123u, descriptor2.Sampling());
 
   HeightmapTexture texture;
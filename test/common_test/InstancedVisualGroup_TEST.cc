@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <variant>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/InstancedVisualGroup.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class InstancedVisualGroupTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(InstancedVisualGroupTest, InstancedVisualGroup)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.3, 0.8, 0.2);
+
+  InstancedVisualGroupPtr group =
+      scene->CreateInstancedVisualGroup(MeshDescriptor("unit_box"), material);
+  ASSERT_NE(nullptr, group);
+  VisualPtr groupVis = group->Visual();
+  ASSERT_NE(nullptr, groupVis);
+  scene->RootVisual()->AddChild(groupVis);
+  EXPECT_EQ(0u, group->InstanceCount());
+  EXPECT_EQ(nullptr, group->InstanceByIndex(0u));
+
+  // instances share the group material
+  const unsigned int count = 10u;
+  for (unsigned int i = 0u; i < count; ++i)
+  {
+    EXPECT_EQ(i, group->AddInstance(math::Pose3d(i, 0, 0, 0, 0, 0)));
+  }
+  EXPECT_EQ(count, group->InstanceCount());
+  EXPECT_EQ(count, groupVis->ChildCount());
+  for (unsigned int i = 0u; i < count; ++i)
+  {
+    VisualPtr instance = group->InstanceByIndex(i);
+    ASSERT_NE(nullptr, instance);
+    EXPECT_EQ(math::Pose3d(i, 0, 0, 0, 0, 0), instance->LocalPose());
+    EXPECT_EQ(material, instance->GeometryByIndex(0u)->Material());
+  }
+
+  group->SetInstancePose(1u, math::Pose3d(1, 2, 3, 0, 0, 0));
+  EXPECT_EQ(math::Pose3d(1, 2, 3, 0, 0, 0),
+      group->InstanceByIndex(1u)->LocalPose());
+
+  // instances with the same color share a material
+  unsigned int red0 = group->AddInstance(math::Pose3d::Zero,
+      math::Color::Red);
+  unsigned int red1 = group->AddInstance(math::Pose3d::Zero,
+      math::Color::Red);
+  MaterialPtr red0Mat =
+      group->InstanceByIndex(red0)->GeometryByIndex(0u)->Material();
+  MaterialPtr red1Mat =
+      group->InstanceByIndex(red1)->GeometryByIndex(0u)->Material();
+  ASSERT_NE(nullptr, red0Mat);
+  EXPECT_EQ(red0Mat, red1Mat);
+  EXPECT_NE(material, red0Mat);
+  EXPECT_EQ(math::Color::Red, red0Mat->Diffuse());
+
+  group->SetInstanceColor(0u, math::Color::Blue);
+  EXPECT_EQ(math::Color::Blue,
+      group->InstanceByIndex(0u)->GeometryByIndex(0u)->Material()->Diffuse());
+  EXPECT_EQ(math::Color(0.3f, 0.8f, 0.2f), material->Diffuse());
+
+  // per-instance user data used by sensors
+  group->InstanceByIndex(2u)->SetUserData("label", 5);
+  EXPECT_EQ(5, std::get<int>(group->InstanceByIndex(2u)->UserData("label")));
+
+  group->Destroy();
+  EXPECT_EQ(nullptr, group->Visual());
+  EXPECT_EQ(0u, group->InstanceCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -16,10 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Marker.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -97,3 +100,80 @@ TEST_F(MarkerTest, Marker)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(MarkerTest, IncrementalUpdate)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  MarkerPtr marker = scene->CreateMarker();
+  ASSERT_NE(nullptr, marker);
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(marker);
+  scene->RootVisual()->AddChild(visual);
+
+  // append points one at a time, across buffer reallocations
+  for (auto type : {MT_POINTS, MT_LINE_STRIP, MT_TRIANGLE_LIST})
+  {
+    marker->SetType(type);
+    marker->ClearPoints();
+    for (unsigned int i = 0u; i < 100u; ++i)
+    {
+      marker->AddPoint(math::Vector3d(i, 0, 0), math::Color::Red);
+      marker->PreRender();
+    }
+    // update a point in the middle of the buffer
+    marker->SetPoint(10u, math::Vector3d(10, 1, 0));
+    marker->PreRender();
+  }
+
+  // Clear and refill
+  marker->ClearPoints();
+  marker->PreRender();
+  marker->AddPoint(math::Vector3d::Zero, math::Color::Blue);
+  marker->PreRender();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MarkerTest, BulkPoints)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  MarkerPtr marker = scene->CreateMarker();
+  ASSERT_NE(nullptr, marker);
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(marker);
+  scene->RootVisual()->AddChild(visual);
+  marker->SetType(MT_POINTS);
+
+  const size_t count = 1000u;
+  std::vector<float> xyz(count * 3u);
+  std::vector<float> rgba(count * 4u, 1.0f);
+  for (size_t i = 0u; i < xyz.size(); ++i)
+    xyz[i] = static_cast<float>(i);
+
+  marker->SetPoints(xyz.data(), rgba.data(), count);
+  marker->PreRender();
+
+  // append without colors
+  marker->AppendPoints(xyz.data(), nullptr, count);
+  marker->PreRender();
+
+  // replace with fewer points
+  marker->SetPoints(xyz.data(), nullptr, 10u);
+  marker->PreRender();
+
+  // empty input is a no-op
+  marker->AppendPoints(nullptr, nullptr, 0u);
+  marker->PreRender();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
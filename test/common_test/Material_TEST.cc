@@ -560,3 +560,190 @@ TEST_F(MaterialTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Copy))
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(MaterialTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(TextureStreaming))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  EXPECT_FALSE(scene->TextureStreamingEnabled());
+  EXPECT_EQ(0u, scene->PendingTextureLoads());
+
+  scene->SetTextureStreamingEnabled(true);
+  EXPECT_TRUE(scene->TextureStreamingEnabled());
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-2, 0, 0);
+  root->AddChild(camera);
+
+  std::string textureName =
+      common::joinPaths(TEST_MEDIA_PATH, "texture.png");
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetTexture(textureName);
+  EXPECT_EQ(textureName, material->Texture());
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  // textures finish loading in the background while rendering
+  for (unsigned int i = 0u; i < 100u && scene->PendingTextureLoads() > 0u;
+       ++i)
+  {
+    camera->Update();
+  }
+  EXPECT_EQ(0u, scene->PendingTextureLoads());
+
+  // clearing a texture that may still be loading cancels it
+  material->SetNormalMap(textureName);
+  material->ClearNormalMap();
+  EXPECT_EQ(0u, scene->PendingTextureLoads());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MaterialTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(TextureMaxSize))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  EXPECT_EQ(0u, engine->TextureMaxSize());
+  engine->SetTextureMaxSize(16u);
+  EXPECT_EQ(16u, engine->TextureMaxSize());
+
+  // textures larger than the max size are downscaled on load
+  std::string textureName =
+      common::joinPaths(TEST_MEDIA_PATH, "blue_texture.png");
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetTexture(textureName);
+  EXPECT_EQ(textureName, material->Texture());
+  EXPECT_TRUE(material->HasTexture());
+
+  if (engine->Name() == "ogre2")
+    EXPECT_GT(engine->TextureMemoryUsage(), 0u);
+
+  engine->SetTextureMaxSize(0u);
+  EXPECT_EQ(0u, engine->TextureMaxSize());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MaterialTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CloneCopyOnWrite))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-2, 0, 0);
+  root->AddChild(camera);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(1.0, 0.0, 0.0);
+  MaterialPtr clone = material->Clone("clone");
+  ASSERT_NE(nullptr, clone);
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), clone->Diffuse());
+
+  VisualPtr box = scene->CreateVisual();
+  GeometryPtr geom = scene->CreateBox();
+  box->AddGeometry(geom);
+  box->SetMaterial(clone, false);
+  root->AddChild(box);
+  camera->Update();
+
+  // modifying the clone does not affect the original and vice versa
+  clone->SetDiffuse(0.0, 1.0, 0.0);
+  camera->Update();
+  EXPECT_EQ(math::Color(0.0f, 1.0f, 0.0f), clone->Diffuse());
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), material->Diffuse());
+
+  MaterialPtr clone2 = material->Clone();
+  material->SetDiffuse(0.0, 0.0, 1.0);
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), clone2->Diffuse());
+
+  // clones outlive the material they were cloned from
+  scene->DestroyMaterial(material);
+  camera->Update();
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), clone2->Diffuse());
+  clone2->SetDiffuse(1.0, 1.0, 0.0);
+  EXPECT_EQ(math::Color(1.0f, 1.0f, 0.0f), clone2->Diffuse());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MaterialTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(MaterialSharing))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  EXPECT_FALSE(scene->MaterialSharingEnabled());
+
+  scene->SetMaterialSharingEnabled(true);
+  EXPECT_TRUE(scene->MaterialSharingEnabled());
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-2, 0, 0);
+  root->AddChild(camera);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(1.0, 0.0, 0.0);
+
+  // each box gets its own copy of the material
+  GeometryPtr geoms[2];
+  for (auto &geom : geoms)
+  {
+    VisualPtr box = scene->CreateVisual();
+    geom = scene->CreateBox();
+    box->AddGeometry(geom);
+    box->SetMaterial(material);
+    root->AddChild(box);
+  }
+  camera->Update();
+
+  MaterialPtr mat0 = geoms[0]->Material();
+  MaterialPtr mat1 = geoms[1]->Material();
+  ASSERT_NE(nullptr, mat0);
+  ASSERT_NE(nullptr, mat1);
+  EXPECT_NE(mat0, mat1);
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), mat0->Diffuse());
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), mat1->Diffuse());
+
+  // modifying one material does not affect the other one
+  mat0->SetDiffuse(0.0, 1.0, 0.0);
+  camera->Update();
+  EXPECT_EQ(math::Color(0.0f, 1.0f, 0.0f), mat0->Diffuse());
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), mat1->Diffuse());
+
+  // materials can still be destroyed while others use the same content
+  mat1->SetDiffuse(0.0, 1.0, 0.0);
+  camera->Update();
+  scene->DestroyMaterial(material);
+  camera->Update();
+  EXPECT_EQ(math::Color(0.0f, 1.0f, 0.0f), mat1->Diffuse());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "CommonRenderingTest.hh"
 
@@ -28,6 +29,7 @@
 #include "gz/rendering/Camera.hh"
 #include "gz/rendering/Mesh.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -85,6 +87,228 @@ TEST_F(MeshTest, MeshSubMesh)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshLod)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+
+  // invalid lod settings
+  MeshDescriptor invalid("unit_sphere");
+  invalid.lodDistances = {20.0, 10.0};
+  EXPECT_EQ(nullptr, scene->CreateMesh(invalid));
+  invalid.lodDistances = {10.0};
+  invalid.lodReduction = 1.5;
+  EXPECT_EQ(nullptr, scene->CreateMesh(invalid));
+
+  // mesh with two generated levels of detail
+  MeshDescriptor descriptor("unit_sphere");
+  descriptor.lodDistances = {10.0, 50.0};
+  descriptor.lodReduction = 0.25;
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_EQ(1u, mesh->SubMeshCount());
+
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(mesh);
+  root->AddChild(visual);
+
+  // render at every level of detail, with a coarser bias for the last one
+  for (double distance : {2.0, 20.0, 100.0})
+  {
+    camera->SetWorldPosition(-distance, 0, 0);
+    camera->Update();
+  }
+  camera->SetLodBias(0.1);
+  camera->SetWorldPosition(-2.0, 0, 0);
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshDynamic)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-5, 0, 0);
+  root->AddChild(camera);
+
+  const common::Mesh *unitBox =
+      common::MeshManager::Instance()->MeshByName("unit_box");
+  ASSERT_NE(nullptr, unitBox);
+  auto subMesh = unitBox->SubMeshByIndex(0u).lock();
+  ASSERT_NE(nullptr, subMesh);
+  const unsigned int vertexCount = subMesh->VertexCount();
+  std::vector<float> positions;
+  for (unsigned int i = 0u; i < vertexCount; ++i)
+  {
+    const math::Vector3d v = subMesh->Vertex(i) * 2.0;
+    positions.push_back(static_cast<float>(v.X()));
+    positions.push_back(static_cast<float>(v.Y()));
+    positions.push_back(static_cast<float>(v.Z()));
+  }
+
+  // static meshes can not be updated
+  MeshPtr staticMesh = scene->CreateMesh(MeshDescriptor("unit_box"));
+  ASSERT_NE(nullptr, staticMesh);
+  EXPECT_FALSE(staticMesh->UpdateVertices(0u, positions.data(), nullptr,
+      vertexCount));
+
+  MeshDescriptor descriptor("unit_box");
+  descriptor.dynamic = true;
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_EQ(1u, mesh->SubMeshCount());
+
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(mesh);
+  root->AddChild(visual);
+  camera->Update();
+  EXPECT_NEAR(1.0, visual->LocalBoundingBox().Size().X(), 1e-5);
+
+  // invalid arguments are rejected
+  EXPECT_FALSE(mesh->UpdateVertices(1u, positions.data(), nullptr,
+      vertexCount));
+  EXPECT_FALSE(mesh->UpdateVertices(0u, positions.data(), nullptr,
+      vertexCount - 1u));
+  EXPECT_FALSE(mesh->UpdateVertices(0u, nullptr, nullptr, vertexCount));
+
+  // normals are recomputed and the bounds follow the new vertices
+  EXPECT_TRUE(mesh->UpdateVertices(0u, positions.data(), nullptr,
+      vertexCount));
+  camera->Update();
+  EXPECT_NEAR(2.0, visual->LocalBoundingBox().Size().X(), 1e-5);
+
+  std::vector<float> normals(positions.size(), 0.0f);
+  for (unsigned int i = 0u; i < vertexCount; ++i)
+    normals[i * 3u + 2u] = 1.0f;
+  EXPECT_TRUE(mesh->UpdateVertices(0u, positions.data(), normals.data(),
+      vertexCount));
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshHalfPositions)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-5, 0, 0);
+  root->AddChild(camera);
+
+  MeshDescriptor descriptor("unit_box");
+  descriptor.halfPositions = true;
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_EQ(1u, mesh->SubMeshCount());
+
+  // half float positions are loaded next to the full precision mesh
+  MeshPtr fullMesh = scene->CreateMesh(MeshDescriptor("unit_box"));
+  ASSERT_NE(nullptr, fullMesh);
+
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(mesh);
+  root->AddChild(visual);
+  camera->Update();
+  EXPECT_NEAR(1.0, visual->LocalBoundingBox().Size().X(), 1e-3);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshOptimize)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetWorldPosition(-5, 0, 0);
+  root->AddChild(camera);
+
+  // optimizing keeps the submeshes, the bounds and the levels of detail
+  MeshDescriptor descriptor("unit_sphere");
+  descriptor.optimize = true;
+  descriptor.lodDistances = {10.0};
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_EQ(1u, mesh->SubMeshCount());
+
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(mesh);
+  root->AddChild(visual);
+  camera->Update();
+  EXPECT_NEAR(1.0, visual->LocalBoundingBox().Size().X(), 1e-5);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, PreloadMeshes)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  MeshDescriptor sphere("unit_sphere");
+  MeshDescriptor box("unit_box");
+  MeshDescriptor lodSphere("unit_sphere");
+  lodSphere.lodDistances = {10.0};
+  MeshDescriptor invalid("no_such_mesh");
+
+  // duplicates and invalid descriptors are skipped
+  scene->PreloadMeshes({sphere, box, lodSphere, sphere, invalid});
+  scene->PreloadMeshes({});
+
+  for (const auto &desc : {sphere, box, lodSphere})
+  {
+    MeshPtr mesh = scene->CreateMesh(desc);
+    ASSERT_NE(nullptr, mesh);
+    EXPECT_EQ(1u, mesh->SubMeshCount());
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(mesh);
+    scene->RootVisual()->AddChild(visual);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(MeshTest, MeshSkeleton)
 {
@@ -243,6 +467,144 @@ TEST_F(MeshTest, MeshSkeletonAnimation)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshSkeletonAnimationInstanced)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  MeshDescriptor descriptor;
+  descriptor.meshName = common::joinPaths(TEST_MEDIA_PATH, "walk.dae");
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  descriptor.mesh = meshManager->Load(descriptor.meshName);
+  ASSERT_NE(nullptr, descriptor.mesh);
+  MeshPtr mesh1 = scene->CreateMesh(descriptor);
+  MeshPtr mesh2 = scene->CreateMesh(descriptor);
+  ASSERT_TRUE(mesh1->HasSkeleton());
+  ASSERT_TRUE(mesh2->HasSkeleton());
+
+  std::string animName =
+      descriptor.mesh->MeshSkeleton()->Animation(0u)->Name();
+
+  // an animation enabled before switching keeps playing
+  EXPECT_FALSE(mesh1->SkeletonAnimationInstanced());
+  mesh1->SetSkeletonAnimationEnabled(animName, true);
+  mesh1->SetSkeletonAnimationInstanced(true);
+  EXPECT_TRUE(mesh1->SkeletonAnimationInstanced());
+  EXPECT_TRUE(mesh1->SkeletonAnimationEnabled(animName));
+
+  mesh2->SetSkeletonAnimationInstanced(true);
+  EXPECT_FALSE(mesh2->SkeletonAnimationEnabled(animName));
+  mesh2->SetSkeletonAnimationEnabled(animName, true);
+  EXPECT_TRUE(mesh2->SkeletonAnimationEnabled(animName));
+
+  // meshes at the same playback time get the same pose
+  auto time = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(0.5));
+  mesh1->UpdateSkeletonAnimation(time);
+  mesh2->UpdateSkeletonAnimation(time);
+  std::vector<math::Matrix4d> tfs1;
+  std::vector<math::Matrix4d> tfs2;
+  mesh1->SkeletonBoneTransforms(tfs1);
+  mesh2->SkeletonBoneTransforms(tfs2);
+  ASSERT_FALSE(tfs1.empty());
+  ASSERT_EQ(tfs1.size(), tfs2.size());
+  for (unsigned int i = 0; i < tfs1.size(); ++i)
+    EXPECT_EQ(tfs1[i], tfs2[i]);
+
+  EXPECT_NO_THROW(mesh2->UpdateSkeletonAnimation(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(1234.5))));
+  EXPECT_NO_THROW(mesh2->UpdateSkeletonAnimation(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(-11.0))));
+
+  // switching back keeps the animation enabled
+  mesh1->SetSkeletonAnimationInstanced(false);
+  EXPECT_FALSE(mesh1->SkeletonAnimationInstanced());
+  EXPECT_TRUE(mesh1->SkeletonAnimationEnabled(animName));
+  EXPECT_NO_THROW(mesh1->UpdateSkeletonAnimation(time));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, MeshSkeletonByIndex)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // box mesh without skeleton
+  MeshDescriptor boxDescriptor("unit_box");
+  MeshPtr boxMesh = scene->CreateMesh(boxDescriptor);
+  ASSERT_NE(nullptr, boxMesh);
+  EXPECT_TRUE(boxMesh->SkeletonBoneNames().empty());
+  std::vector<math::Matrix4d> tfs;
+  boxMesh->SkeletonBoneTransforms(tfs);
+  EXPECT_TRUE(tfs.empty());
+
+  MeshDescriptor descriptor;
+  descriptor.meshName = common::joinPaths(TEST_MEDIA_PATH, "walk.dae");
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  descriptor.mesh = meshManager->Load(descriptor.meshName);
+  ASSERT_NE(nullptr, descriptor.mesh);
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_TRUE(mesh->HasSkeleton());
+
+  // bone order covers every skeleton node
+  auto skel = descriptor.mesh->MeshSkeleton();
+  std::vector<std::string> names = mesh->SkeletonBoneNames();
+  EXPECT_EQ(skel->NodeCount(), names.size());
+  for (const auto &name : names)
+    EXPECT_NE(nullptr, skel->NodeByName(name));
+
+  // transforms by index match the name based api
+  mesh->SkeletonBoneTransforms(tfs);
+  ASSERT_EQ(names.size(), tfs.size());
+  auto mapTfs = mesh->SkeletonLocalTransforms();
+  for (unsigned int i = 0; i < names.size(); ++i)
+    EXPECT_EQ(mapTfs[names[i]], tfs[i]);
+
+  // set a translation on the first bone
+  tfs[0].SetTranslation(math::Vector3d(0.5, 0.25, 1.0));
+  mesh->SetSkeletonBoneTransforms(tfs.data(),
+      static_cast<unsigned int>(tfs.size()));
+  std::vector<math::Matrix4d> newTfs;
+  mesh->SkeletonBoneTransforms(newTfs);
+  ASSERT_EQ(tfs.size(), newTfs.size());
+  EXPECT_EQ(math::Vector3d(0.5, 0.25, 1.0), newTfs[0].Translation());
+
+  // float 3x4 variant, identity rotation
+  std::vector<float> tfs3x4(12u, 0.0f);
+  tfs3x4[0] = tfs3x4[5] = tfs3x4[10] = 1.0f;
+  tfs3x4[3] = 1.0f;
+  tfs3x4[7] = 2.0f;
+  tfs3x4[11] = 3.0f;
+  mesh->SetSkeletonBoneTransforms3x4(tfs3x4.data(), 1u);
+  mesh->SkeletonBoneTransforms(newTfs);
+  ASSERT_FALSE(newTfs.empty());
+  EXPECT_EQ(math::Vector3d(1, 2, 3), newTfs[0].Translation());
+  EXPECT_EQ(math::Quaterniond::Identity, newTfs[0].Rotation());
+
+  // weights by index
+  std::vector<float> weights(names.size(), 1.0f);
+  weights[0] = 0.5f;
+  mesh->SetSkeletonBoneWeights(weights.data(),
+      static_cast<unsigned int>(weights.size()));
+  auto mapWeights = mesh->SkeletonWeights();
+  EXPECT_FLOAT_EQ(0.5f, mapWeights[names[0]]);
+  if (names.size() > 1u)
+  {
+    EXPECT_FLOAT_EQ(1.0f, mapWeights[names[1]]);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(MeshTest, MeshClone)
 {
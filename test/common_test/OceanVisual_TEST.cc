@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/OceanVisual.hh"
+#include "gz/rendering/Scene.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class OceanVisualTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(OceanVisualTest, OceanVisual)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  OceanVisualPtr ocean = scene->CreateOceanVisual();
+  ASSERT_NE(nullptr, ocean);
+  scene->RootVisual()->AddChild(ocean);
+
+  // defaults
+  EXPECT_DOUBLE_EQ(0.5, ocean->CellSize());
+  EXPECT_EQ(64u, ocean->CellsPerRing());
+  EXPECT_EQ(8u, ocean->RingCount());
+  EXPECT_DOUBLE_EQ(64.0 * 0.5 * 128.0, ocean->Extent());
+  EXPECT_EQ(0u, ocean->WaveCount());
+  EXPECT_NE(nullptr, ocean->Material());
+
+  // the innermost ring is full, the others have a hole of a quarter
+  ocean->SetGrid(1.0, 16u, 3u);
+  EXPECT_DOUBLE_EQ(1.0, ocean->CellSize());
+  EXPECT_EQ(16u, ocean->CellsPerRing());
+  EXPECT_EQ(3u, ocean->RingCount());
+  EXPECT_DOUBLE_EQ(64.0, ocean->Extent());
+  EXPECT_EQ(2u * (256u + 2u * 192u), ocean->TriangleCount());
+
+  // invalid layouts are ignored
+  ocean->SetGrid(-1.0, 16u, 3u);
+  ocean->SetGrid(1.0, 10u, 3u);
+  ocean->SetGrid(1.0, 16u, 0u);
+  EXPECT_DOUBLE_EQ(1.0, ocean->CellSize());
+  EXPECT_EQ(16u, ocean->CellsPerRing());
+  EXPECT_EQ(3u, ocean->RingCount());
+
+  ocean->SetCenter(math::Vector2d(10.3, -4.1));
+  EXPECT_EQ(math::Vector2d(10.3, -4.1), ocean->Center());
+
+  // flat without waves
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_DOUBLE_EQ(0.0, ocean->Height(math::Vector2d(3.0, 7.0)));
+
+  // a rolling wave along x at time 0
+  ocean->AddWave(0.5, 8.0, 0.0, 0.0);
+  ocean->AddWave(1.0, 8.0, 0.0, -1.0);
+  EXPECT_EQ(1u, ocean->WaveCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_NEAR(0.5, ocean->Height(math::Vector2d(0.0, 3.0)), 1e-6);
+  EXPECT_NEAR(-0.5, ocean->Height(math::Vector2d(4.0, 3.0)), 1e-6);
+  EXPECT_NEAR(0.0, ocean->Height(math::Vector2d(2.0, 3.0)), 1e-6);
+
+  // choppy waves move the crests, the height stays within the amplitude
+  ocean->ClearWaves();
+  ocean->AddWave(0.5, 8.0, GZ_PI / 4.0, 1.0);
+  ocean->AddWave(0.2, 3.0, 1.0, 0.5, 0.3);
+  EXPECT_EQ(2u, ocean->WaveCount());
+  scene->PreRender();
+  scene->PostRender();
+  for (double x = 0.0; x < 10.0; x += 0.7)
+  {
+    const double height = ocean->Height(math::Vector2d(x, 1.0));
+    EXPECT_LE(std::abs(height), 0.7 + 1e-6) << x;
+  }
+
+  scene->DestroyVisual(ocean);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(OceanVisualTest, PreRenderDirtyTracking)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  OceanVisualPtr ocean = scene->CreateOceanVisual();
+  ASSERT_NE(nullptr, ocean);
+  ocean->SetGrid(1.0, 16u, 2u);
+  scene->RootVisual()->AddChild(ocean);
+
+  // the first frame traverses the whole scene
+  scene->SetPreRenderDirtyTracking(true);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderFullTraversal);
+
+  auto preRendered = [&]()
+  {
+    scene->PreRender();
+    scene->PostRender();
+    const std::vector<unsigned int> &ids =
+        scene->Stats().preRenderDirtyObjects;
+    return std::find(ids.begin(), ids.end(), ocean->Id()) != ids.end();
+  };
+
+  // a flat ocean is not pre-rendered again
+  EXPECT_FALSE(preRendered());
+
+  // every change is applied on the next frame
+  ocean->AddWave(0.5, 8.0, 0.0, 0.0);
+  EXPECT_TRUE(preRendered());
+
+  // waves move with the time, so the ocean stays dirty
+  EXPECT_TRUE(preRendered());
+
+  ocean->ClearWaves();
+  EXPECT_TRUE(preRendered());
+  EXPECT_FALSE(preRendered());
+
+  ocean->SetGrid(2.0, 16u, 2u);
+  EXPECT_TRUE(preRendered());
+  EXPECT_FALSE(preRendered());
+
+  // recentring within a snapping step keeps the surface
+  ocean->SetCenter(math::Vector2d(0.5, 0.0));
+  EXPECT_FALSE(preRendered());
+  ocean->SetCenter(math::Vector2d(40.0, 0.0));
+  EXPECT_TRUE(preRendered());
+  EXPECT_FALSE(preRendered());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
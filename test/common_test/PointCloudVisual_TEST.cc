@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/DepthCamera.hh"
+#include "gz/rendering/PointCloudVisual.hh"
+#include "gz/rendering/Scene.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class PointCloudVisualTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(PointCloudVisualTest, PointCloudVisual)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  PointCloudVisualPtr pointCloud = scene->CreatePointCloudVisual();
+  ASSERT_NE(nullptr, pointCloud);
+  scene->RootVisual()->AddChild(pointCloud);
+
+  // defaults
+  EXPECT_EQ(0u, pointCloud->PointCount());
+  EXPECT_EQ(0u, pointCloud->RenderedPointCount());
+  EXPECT_DOUBLE_EQ(2.0, pointCloud->PointSize());
+  EXPECT_FALSE(pointCloud->SizeAttenuation());
+  EXPECT_DOUBLE_EQ(64.0, pointCloud->MaxPixelSize());
+  EXPECT_EQ(10000000u, pointCloud->MaxRenderedPointCount());
+
+  pointCloud->SetPointSize(0.05);
+  pointCloud->SetSizeAttenuation(true);
+  pointCloud->SetMaxPixelSize(16.0);
+  pointCloud->SetIntensityRange(1.0, 5.0);
+  pointCloud->SetIntensityColors(math::Color::Blue, math::Color::Red);
+  EXPECT_DOUBLE_EQ(0.05, pointCloud->PointSize());
+  EXPECT_TRUE(pointCloud->SizeAttenuation());
+  EXPECT_DOUBLE_EQ(16.0, pointCloud->MaxPixelSize());
+  EXPECT_DOUBLE_EQ(1.0, pointCloud->IntensityMin());
+  EXPECT_DOUBLE_EQ(5.0, pointCloud->IntensityMax());
+  EXPECT_EQ(math::Color::Blue, pointCloud->IntensityLowColor());
+  EXPECT_EQ(math::Color::Red, pointCloud->IntensityHighColor());
+
+  // packed points, some of them invalid
+  std::vector<PackedPoint> packed(1000u);
+  for (unsigned int i = 0u; i < packed.size(); ++i)
+  {
+    packed[i] = {static_cast<float>(i), 0.0f, 1.0f, 255u, 0u, 0u, 255u};
+    if (i % 10u == 0u)
+      packed[i].x = std::numeric_limits<float>::quiet_NaN();
+  }
+  pointCloud->SetPoints(packed.data(),
+      static_cast<unsigned int>(packed.size()), PCF_PACKED_XYZRGBA);
+  EXPECT_EQ(1000u, pointCloud->PointCount());
+  EXPECT_EQ(PCF_PACKED_XYZRGBA, pointCloud->Format());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(1000u, pointCloud->RenderedPointCount());
+
+  // decimation
+  pointCloud->SetMaxRenderedPointCount(250u);
+  EXPECT_EQ(250u, pointCloud->MaxRenderedPointCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(250u, pointCloud->RenderedPointCount());
+
+  // a cloud of several chunks, as given by GpuRays
+  const unsigned int count = 3000000u;
+  std::vector<float> xyzi(count * 4u, 1.0f);
+  pointCloud->SetMaxRenderedPointCount(1000000u);
+  pointCloud->SetPoints(xyzi.data(), count, PCF_XYZI_FLOAT32);
+  EXPECT_EQ(count, pointCloud->PointCount());
+  EXPECT_EQ(PCF_XYZI_FLOAT32, pointCloud->Format());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(1000000u, pointCloud->RenderedPointCount());
+
+  pointCloud->SetMaxRenderedPointCount(0u);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(count, pointCloud->RenderedPointCount());
+
+  // invalid data is ignored
+  pointCloud->SetPoints(nullptr, 10u, PCF_XYZRGBA_FLOAT32);
+  EXPECT_EQ(count, pointCloud->PointCount());
+
+  pointCloud->ClearPoints();
+  EXPECT_EQ(0u, pointCloud->PointCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(0u, pointCloud->RenderedPointCount());
+
+  scene->DestroyVisual(pointCloud);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
@@ -111,3 +113,61 @@ TEST_F(RayQueryTest, RayQuery)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(RayQueryTest, ClosestPoints)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  VisualPtr root = scene->RootVisual();
+
+  // unit box 5m in front of the origin
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(5.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+  rayQuery->SetOrigin(math::Vector3d(1, 2, 3));
+  rayQuery->SetDirection(math::Vector3d::UnitZ);
+
+  std::vector<math::Vector3d> origins;
+  std::vector<math::Vector3d> directions;
+  for (unsigned int i = 0u; i < 100u; ++i)
+  {
+    origins.push_back(math::Vector3d::Zero);
+    // even rays hit the box, odd rays point away from it
+    directions.push_back(i % 2u == 0u ? math::Vector3d::UnitX :
+        -math::Vector3d::UnitX);
+  }
+
+  std::vector<RayQueryResult> results =
+      rayQuery->ClosestPoints(origins, directions);
+  ASSERT_EQ(origins.size(), results.size());
+  for (unsigned int i = 0u; i < results.size(); ++i)
+  {
+    if (i % 2u == 0u)
+    {
+      EXPECT_TRUE(results[i]);
+      EXPECT_NEAR(4.5, results[i].distance, 1e-4);
+      EXPECT_EQ(box->Id(), results[i].objectId);
+    }
+    else
+    {
+      EXPECT_FALSE(results[i]);
+    }
+  }
+
+  // the query's own ray is left untouched
+  EXPECT_EQ(math::Vector3d(1, 2, 3), rayQuery->Origin());
+  EXPECT_EQ(math::Vector3d::UnitZ, rayQuery->Direction());
+
+  // mismatched input
+  directions.pop_back();
+  EXPECT_TRUE(rayQuery->ClosestPoints(origins, directions).empty());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 
 #include "CommonRenderingTest.hh"
+#include "gz/rendering/Camera.hh"
 #include "gz/rendering/Scene.hh"
 
 #include <gz/utils/ExtraTestMacros.hh>
@@ -115,3 +116,56 @@ TEST_F(RenderEngineTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RenderEngine))
   engine->DestroyScenes();
   EXPECT_EQ(engine->SceneCount(), 0u);
 }
+
+/////////////////////////////////////////////////
+TEST_F(RenderEngineTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(MemoryStats))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  scene->RootVisual()->AddChild(camera);
+
+  unsigned int warnings = 0u;
+  EXPECT_EQ(0u, engine->MemoryWarningThreshold());
+  engine->SetMemoryWarning(1u,
+      [&warnings](const GpuMemoryStats &_stats)
+      {
+        EXPECT_GT(_stats.total, 0u);
+        ++warnings;
+      });
+  EXPECT_EQ(1u, engine->MemoryWarningThreshold());
+
+  // the render target is allocated when the camera is first rendered
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    scene->PreRender();
+    camera->Render();
+    scene->PostRender();
+  }
+
+  GpuMemoryStats stats = engine->MemoryStats();
+  EXPECT_GE(stats.renderTargets, 320u * 240u * 3u);
+  EXPECT_GT(stats.meshes, 0u);
+  EXPECT_EQ(stats.total, stats.meshes + stats.textures + stats.shadowMaps +
+      stats.globalIllumination + stats.renderTargets + stats.cubemaps +
+      stats.staging);
+  ASSERT_EQ(1u, stats.sensors.count("camera"));
+  EXPECT_GE(stats.sensors["camera"], 320u * 240u * 3u);
+  EXPECT_GE(stats.total, stats.sensors["camera"]);
+  EXPECT_EQ(stats.sensors["camera"], stats.scenes["scene"]);
+  EXPECT_EQ(camera->MemoryUsage(), stats.sensors["camera"]);
+
+  // the callback is called once when the threshold is crossed
+  EXPECT_EQ(1u, warnings);
+
+  engine->SetMemoryWarning(0u);
+  EXPECT_EQ(0u, engine->MemoryWarningThreshold());
+
+  engine->DestroyScene(scene);
+}
@@ -43,6 +43,8 @@ TEST_F(RenderTargetTest, RenderTexture)
   EXPECT_EQ(scene->BackgroundColor(), renderTexture->BackgroundColor());
   // test basic properties
   EXPECT_EQ(0u, renderTexture->GLId());
+  if (engine->Name() != "optix")
+    EXPECT_EQ(nullptr, renderTexture->CudaDevicePointer());
   renderTexture->SetFormat(PF_R8G8B8);
   renderTexture->SetWidth(800u);
   renderTexture->SetHeight(600u);
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <gz/math/Helpers.hh>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SceneChangeTracker.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class SceneChangeTrackerTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(SceneChangeTrackerTest, Changes)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  SceneChangeTracker &tracker = scene->ChangeTracker();
+  EXPECT_FALSE(tracker.Enabled());
+
+  // enabling it changes the whole scene
+  const uint64_t disabledCount = tracker.ChangeCount();
+  tracker.SetEnabled(true);
+  EXPECT_TRUE(tracker.Enabled());
+  EXPECT_TRUE(tracker.ChangedSince(disabledCount));
+
+  const math::Frustum frustum(0.1, 10.0, math::Angle(GZ_DTOR(90.0)), 1.0,
+      math::Pose3d::Zero);
+  uint64_t count = tracker.ChangeCount();
+  EXPECT_FALSE(tracker.ChangedSince(count));
+  EXPECT_FALSE(tracker.ChangedSince(count, frustum));
+
+  // in front of and behind the frustum looking along +X
+  tracker.MarkChanged(math::AxisAlignedBox(math::Vector3d(-6, -1, -1),
+      math::Vector3d(-4, 1, 1)));
+  EXPECT_TRUE(tracker.ChangedSince(count));
+  EXPECT_FALSE(tracker.ChangedSince(count, frustum));
+  tracker.MarkChanged(math::AxisAlignedBox(math::Vector3d(4, -1, -1),
+      math::Vector3d(6, 1, 1)));
+  EXPECT_TRUE(tracker.ChangedSince(count, frustum));
+
+  count = tracker.ChangeCount();
+  tracker.MarkChanged();
+  EXPECT_TRUE(tracker.ChangedSince(count, frustum));
+
+  // visuals record where they were and where they are
+  VisualPtr visual = scene->CreateVisual();
+  ASSERT_NE(nullptr, visual);
+  visual->AddGeometry(scene->CreateBox());
+  visual->SetLocalPosition(5, 0, 0);
+  scene->RootVisual()->AddChild(visual);
+  tracker.Flush();
+  EXPECT_TRUE(tracker.ChangedSince(count, frustum));
+
+  count = tracker.ChangeCount();
+  visual->SetLocalPosition(5, 0, 0);
+  tracker.Flush();
+  EXPECT_FALSE(tracker.ChangedSince(count));
+
+  visual->SetLocalPosition(-5, 0, 0);
+  tracker.Flush();
+  EXPECT_TRUE(tracker.ChangedSince(count, frustum));
+
+  count = tracker.ChangeCount();
+  visual->SetLocalPosition(-6, 0, 0);
+  tracker.Flush();
+  EXPECT_TRUE(tracker.ChangedSince(count));
+  EXPECT_FALSE(tracker.ChangedSince(count, frustum));
+
+  tracker.SetEnabled(false);
+  count = tracker.ChangeCount();
+  visual->SetLocalPosition(5, 0, 0);
+  tracker.Flush();
+  EXPECT_FALSE(tracker.ChangedSince(count));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneChangeTrackerTest, SkipUnchangedFrames)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(64);
+  camera->SetHFOV(math::Angle(GZ_DTOR(90.0)));
+  camera->SetNearClipPlane(0.1);
+  camera->SetFarClipPlane(100.0);
+  root->AddChild(camera);
+  EXPECT_FALSE(camera->SkipUnchangedFrames());
+
+  VisualPtr inView = scene->CreateVisual();
+  inView->AddGeometry(scene->CreateBox());
+  inView->SetLocalPosition(5, 0, 0);
+  root->AddChild(inView);
+  VisualPtr behind = scene->CreateVisual();
+  behind->AddGeometry(scene->CreateBox());
+  behind->SetLocalPosition(-5, 0, 0);
+  root->AddChild(behind);
+
+  unsigned int unchangedCount = 0u;
+  common::ConnectionPtr connection = camera->ConnectFrameUnchanged(
+      [&unchangedCount]()
+      {
+        ++unchangedCount;
+      });
+  ASSERT_NE(nullptr, connection);
+
+  // without skipping, every frame is rendered
+  camera->Update();
+  camera->Update();
+  EXPECT_EQ(0u, unchangedCount);
+
+  camera->SetSkipUnchangedFrames(true);
+  EXPECT_TRUE(camera->SkipUnchangedFrames());
+  EXPECT_TRUE(scene->ChangeTracker().Enabled());
+  camera->Update();
+  EXPECT_EQ(0u, unchangedCount);
+  camera->Update();
+  EXPECT_EQ(1u, unchangedCount);
+
+  // poses set again and changes outside of the view
+  inView->SetLocalPosition(5, 0, 0);
+  behind->SetLocalPosition(-6, 0, 0);
+  camera->Update();
+  EXPECT_EQ(2u, unchangedCount);
+
+  // changes in view
+  inView->SetLocalPosition(5, 1, 0);
+  camera->Update();
+  EXPECT_EQ(2u, unchangedCount);
+  camera->Update();
+  EXPECT_EQ(3u, unchangedCount);
+
+  inView->SetMaterial(scene->CreateMaterial());
+  camera->Update();
+  EXPECT_EQ(3u, unchangedCount);
+
+  inView->SetVisible(false);
+  camera->Update();
+  EXPECT_EQ(3u, unchangedCount);
+
+  scene->ChangeTracker().MarkChanged();
+  camera->Update();
+  EXPECT_EQ(3u, unchangedCount);
+
+  // moving the camera changes the frame
+  camera->SetLocalPosition(0, 0, 1);
+  camera->Update();
+  EXPECT_EQ(3u, unchangedCount);
+  camera->Update();
+  EXPECT_EQ(4u, unchangedCount);
+
+  // scene batches skip unchanged cameras too
+  scene->RenderSensors({camera});
+  EXPECT_EQ(5u, unchangedCount);
+
+  camera->SetSkipUnchangedFrames(false);
+  camera->Update();
+  EXPECT_EQ(5u, unchangedCount);
+
+  // Clean up
+  connection.reset();
+  engine->DestroyScene(scene);
+}
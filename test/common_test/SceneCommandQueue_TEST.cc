@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SceneCommandQueue.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class SceneCommandQueueTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(SceneCommandQueueTest, Commands)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr box = scene->CreateVisual("box");
+  root->AddChild(box);
+  MaterialPtr red = scene->CreateMaterial("red");
+  red->SetDiffuse(1, 0, 0);
+
+  SceneCommandQueue &queue = scene->CommandQueue();
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(0u, queue.Apply(*scene));
+
+  // commands are applied in order
+  queue.SetWorldPose(box->Id(), math::Pose3d(1, 0, 0, 0, 0, 0));
+  queue.SetWorldPose(box->Id(), math::Pose3d(2, 0, 0, 0, 0, 0));
+  queue.SetVisible(box->Id(), false);
+  queue.SetMaterial(box->Id(), "red", false);
+  queue.Enqueue([](Scene &_scene)
+      {
+        _scene.SetBackgroundColor(math::Color(0, 1, 0));
+      });
+  EXPECT_FALSE(queue.Empty());
+
+  // nothing changes until the scene is prepared for rendering
+  EXPECT_EQ(math::Vector3d::Zero, box->WorldPosition());
+
+  scene->PreRender();
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(math::Vector3d(2, 0, 0), box->WorldPosition());
+  EXPECT_FALSE(box->Visible());
+  EXPECT_EQ(red, box->Material());
+  EXPECT_EQ(math::Color(0, 1, 0), scene->BackgroundColor());
+  scene->PostRender();
+
+  // commands on unknown ids are skipped
+  queue.SetLocalPose(123456u, math::Pose3d(1, 1, 1, 0, 0, 0));
+  queue.SetVisible(123456u, true);
+  queue.SetMaterial(box->Id(), "unknown");
+  EXPECT_EQ(3u, queue.Apply(*scene));
+  EXPECT_EQ(red, box->Material());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneCommandQueueTest, Producers)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  const unsigned int threadCount = 4u;
+  unsigned int commandCount = 1000u;
+
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0u; i < threadCount; ++i)
+  {
+    visuals.push_back(scene->CreateVisual());
+    scene->RootVisual()->AddChild(visuals.back());
+  }
+
+  // every thread moves its own visual, the last pose must win
+  std::vector<std::thread> producers;
+  for (unsigned int i = 0u; i < threadCount; ++i)
+  {
+    unsigned int id = visuals[i]->Id();
+    producers.emplace_back([&scene, id, commandCount]()
+        {
+          for (unsigned int k = 1u; k <= commandCount; ++k)
+          {
+            scene->CommandQueue().SetWorldPose(id,
+                math::Pose3d(k, 0, 0, 0, 0, 0));
+          }
+        });
+  }
+  for (auto &producer : producers)
+    producer.join();
+
+  EXPECT_EQ(threadCount * commandCount, scene->CommandQueue().Apply(*scene));
+  for (auto &visual : visuals)
+    EXPECT_DOUBLE_EQ(static_cast<double>(commandCount),
+        visual->WorldPosition().X());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
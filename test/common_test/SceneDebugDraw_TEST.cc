@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <gtest/gtest.h>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Marker.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SceneDebugDraw.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class SceneDebugDrawTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(SceneDebugDrawTest, Shapes)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+  const unsigned int childCount = root->ChildCount();
+
+  SceneDebugDraw &debugDraw = scene->DebugDraw();
+  EXPECT_EQ(0u, debugDraw.LineCount());
+  EXPECT_EQ(GZ_VISIBILITY_ALL, debugDraw.VisibilityFlags());
+
+  // nothing is created until something is drawn
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(childCount, root->ChildCount());
+
+  debugDraw.Line(math::Vector3d::Zero, math::Vector3d::UnitX,
+      math::Color::White);
+  EXPECT_EQ(1u, debugDraw.LineCount());
+  // shaft and 4 head lines
+  debugDraw.Arrow(math::Vector3d::Zero, math::Vector3d::UnitZ,
+      math::Color::White);
+  EXPECT_EQ(6u, debugDraw.LineCount());
+  // 3 arrows
+  debugDraw.Axes(math::Pose3d::Zero);
+  EXPECT_EQ(21u, debugDraw.LineCount());
+  // 12 edges
+  debugDraw.Box(math::Pose3d::Zero, math::Vector3d::One, math::Color::Red);
+  EXPECT_EQ(33u, debugDraw.LineCount());
+  // 3 circles
+  debugDraw.Sphere(math::Vector3d::Zero, 1.0, math::Color::Blue, 8u);
+  EXPECT_EQ(57u, debugDraw.LineCount());
+
+  debugDraw.Clear();
+  EXPECT_EQ(0u, debugDraw.LineCount());
+
+  // all lines of the same color share a marker
+  debugDraw.Box(math::Pose3d::Zero, math::Vector3d::One, math::Color::Red);
+  debugDraw.Box(math::Pose3d(1, 0, 0, 0, 0, 0), math::Vector3d::One,
+      math::Color::Red);
+  debugDraw.Line(math::Vector3d::Zero, math::Vector3d::UnitY,
+      math::Color::Green);
+  scene->PreRender();
+  EXPECT_EQ(0u, debugDraw.LineCount());
+  ASSERT_EQ(childCount + 1u, root->ChildCount());
+  VisualPtr visual =
+      std::dynamic_pointer_cast<Visual>(root->ChildByIndex(childCount));
+  ASSERT_NE(nullptr, visual);
+  EXPECT_EQ(2u, visual->GeometryCount());
+  scene->PostRender();
+
+  // the shapes only last one frame, the markers are reused
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(2u, visual->GeometryCount());
+
+  debugDraw.SetVisibilityFlags(0x01);
+  EXPECT_EQ(0x01u, debugDraw.VisibilityFlags());
+  EXPECT_EQ(0x01u, visual->VisibilityFlags());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
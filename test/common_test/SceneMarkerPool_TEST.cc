@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Marker.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SceneMarkerPool.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+using namespace std::chrono_literals;
+
+class SceneMarkerPoolTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(SceneMarkerPoolTest, Expiry)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+  const unsigned int childCount = root->ChildCount();
+
+  SceneMarkerPool &pool = scene->MarkerPool();
+  EXPECT_EQ(0u, pool.ActiveCount());
+  EXPECT_EQ(0u, pool.PooledCount());
+  EXPECT_EQ(256u, pool.MaxPooledPerType());
+
+  scene->SetTime(1s);
+  MarkerPtr shortLived = pool.Acquire(*scene, MT_LINE_LIST, 100ms);
+  ASSERT_NE(nullptr, shortLived);
+  EXPECT_EQ(MT_LINE_LIST, shortLived->Type());
+  shortLived->AddPoint(math::Vector3d::Zero, math::Color::White);
+  shortLived->AddPoint(math::Vector3d::UnitX, math::Color::White);
+  MarkerPtr longLived = pool.Acquire(*scene, MT_LINE_LIST, 10s);
+  ASSERT_NE(nullptr, longLived);
+  MarkerPtr forever = pool.Acquire(*scene, MT_POINTS, 0s);
+  ASSERT_NE(nullptr, forever);
+  EXPECT_EQ(3u, pool.ActiveCount());
+  EXPECT_EQ(childCount + 3u, root->ChildCount());
+
+  // not expired yet
+  scene->SetTime(1s + 99ms);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(3u, pool.ActiveCount());
+
+  scene->SetTime(1s + 100ms);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(2u, pool.ActiveCount());
+  EXPECT_EQ(1u, pool.PooledCount());
+  EXPECT_EQ(childCount + 2u, root->ChildCount());
+
+  // retired markers of the same type are reused
+  MarkerPtr reused = pool.Acquire(*scene, MT_LINE_LIST, 100ms);
+  EXPECT_EQ(shortLived, reused);
+  EXPECT_EQ(0u, pool.PooledCount());
+  EXPECT_EQ(3u, pool.ActiveCount());
+
+  // renewing postpones the expiry
+  scene->SetTime(1s + 150ms);
+  EXPECT_TRUE(pool.Renew(*scene, reused, 100ms));
+  scene->SetTime(1s + 220ms);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(3u, pool.ActiveCount());
+  scene->SetTime(1s + 250ms);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(2u, pool.ActiveCount());
+  EXPECT_FALSE(pool.Renew(*scene, reused, 100ms));
+  EXPECT_FALSE(pool.Release(reused));
+
+  // lifetimes longer than a revolution of the wheel
+  scene->SetTime(10s);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(2u, pool.ActiveCount());
+  scene->SetTime(11s);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(1u, pool.ActiveCount());
+  EXPECT_EQ(2u, pool.PooledCount());
+
+  // markers without lifetime are only retired on request
+  scene->SetTime(100s);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(1u, pool.ActiveCount());
+  EXPECT_TRUE(pool.Release(forever));
+  EXPECT_EQ(0u, pool.ActiveCount());
+  EXPECT_EQ(3u, pool.PooledCount());
+  EXPECT_EQ(childCount, root->ChildCount());
+
+  // markers beyond the pool size are destroyed
+  pool.SetMaxPooledPerType(1u);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(2u, pool.PooledCount());
+
+  // a time reset keeps the remaining lifetimes
+  MarkerPtr marker = pool.Acquire(*scene, MT_LINE_LIST, 1s);
+  ASSERT_NE(nullptr, marker);
+  scene->SetTime(0s);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(1u, pool.ActiveCount());
+  scene->SetTime(1s);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(0u, pool.ActiveCount());
+
+  // parented markers
+  VisualPtr parent = scene->CreateVisual();
+  root->AddChild(parent);
+  marker = pool.Acquire(*scene, MT_LINE_LIST, 1s, parent);
+  ASSERT_NE(nullptr, marker);
+  EXPECT_EQ(1u, parent->ChildCount());
+  EXPECT_TRUE(pool.Release(marker));
+  EXPECT_EQ(0u, parent->ChildCount());
+
+  engine->DestroyScene(scene);
+}
@@ -17,10 +17,19 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
+#include "gz/rendering/Capsule.hh"
+#include "gz/rendering/Marker.hh"
 #include "gz/rendering/RenderTarget.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/ShaderParams.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -751,3 +760,855 @@ TEST_F(SceneTest, Sky)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, PreRenderDirtyTracking)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  EXPECT_FALSE(scene->PreRenderDirtyTracking());
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(scene->CreateBox());
+  root->AddChild(visual);
+  MarkerPtr marker = scene->CreateMarker();
+  ASSERT_NE(nullptr, marker);
+  marker->SetType(MarkerType::MT_LINE_LIST);
+  VisualPtr markerVisual = scene->CreateVisual();
+  markerVisual->AddGeometry(marker);
+  root->AddChild(markerVisual);
+
+  // without dirty tracking every PreRender traverses the scene graph
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderFullTraversal);
+  EXPECT_TRUE(scene->Stats().preRenderDirtyObjects.empty());
+
+  scene->SetPreRenderDirtyTracking(true);
+  EXPECT_TRUE(scene->PreRenderDirtyTracking());
+
+  // first PreRender after enabling traverses the whole scene graph
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderFullTraversal);
+
+  // a clean scene skips the update
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_FALSE(scene->Stats().preRenderFullTraversal);
+  EXPECT_TRUE(scene->Stats().preRenderDirtyObjects.empty());
+
+  // a changed marker is the only object updated
+  marker->SetLayer(1);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_FALSE(scene->Stats().preRenderFullTraversal);
+  EXPECT_EQ(std::vector<unsigned int>({marker->Id()}),
+      scene->Stats().preRenderDirtyObjects);
+
+  // and is clean again afterwards
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderDirtyObjects.empty());
+
+  // a node added to the scene graph is the only object updated
+  VisualPtr child = scene->CreateVisual();
+  visual->AddChild(child);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(std::vector<unsigned int>({child->Id()}),
+      scene->Stats().preRenderDirtyObjects);
+
+  // marking destroyed or null objects is ignored
+  VisualPtr visual2 = scene->CreateVisual();
+  scene->SetPreRenderDirty(visual2);
+  scene->SetPreRenderDirty(nullptr);
+  scene->DestroyVisual(visual2);
+  visual2 = nullptr;
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderDirtyObjects.empty());
+
+  scene->SetPreRenderDirtyTracking(false);
+  EXPECT_FALSE(scene->PreRenderDirtyTracking());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(scene->Stats().preRenderFullTraversal);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, StorageIndexing)
+{
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  const unsigned int count = 100u;
+  const unsigned int initialCount = scene->VisualCount();
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0; i < initialCount; ++i)
+    visuals.push_back(scene->VisualByIndex(i));
+  for (unsigned int i = 0; i < count; ++i)
+    visuals.push_back(scene->CreateVisual("visual_" + std::to_string(i)));
+  ASSERT_EQ(initialCount + count, scene->VisualCount());
+
+  // remove a visual in the middle and verify insertion order is kept and
+  // lookups by index, id and name still match
+  VisualPtr removed = visuals[initialCount + 10];
+  unsigned int removedId = removed->Id();
+  scene->DestroyVisual(removed);
+  visuals.erase(visuals.begin() + initialCount + 10);
+  ASSERT_EQ(visuals.size(), scene->VisualCount());
+  for (unsigned int i = 0; i < scene->VisualCount(); ++i)
+  {
+    VisualPtr visual = scene->VisualByIndex(i);
+    EXPECT_EQ(visuals[i], visual);
+    EXPECT_EQ(visual, scene->VisualById(visual->Id()));
+    EXPECT_EQ(visual, scene->VisualByName(visual->Name()));
+  }
+  EXPECT_FALSE(scene->HasVisualName("visual_10"));
+  EXPECT_FALSE(scene->HasVisualId(removedId));
+  EXPECT_EQ(nullptr, scene->VisualByIndex(scene->VisualCount()));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/// \brief Compare poses with a tolerance suitable for single precision
+/// render engine transforms
+static void ExpectPoseNear(const math::Pose3d &_expected,
+    const math::Pose3d &_actual)
+{
+  EXPECT_TRUE(_expected.Pos().Equal(_actual.Pos(), 1e-4))
+      << _expected << " vs " << _actual;
+  EXPECT_TRUE(_expected.Rot().Equal(_actual.Rot(), 1e-4))
+      << _expected << " vs " << _actual;
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, SetWorldPoses)
+{
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr parent = scene->CreateVisual();
+  root->AddChild(parent);
+  parent->SetWorldPose(math::Pose3d(1, 2, 3, 0, 0, GZ_PI * 0.5));
+  VisualPtr child = scene->CreateVisual();
+  parent->AddChild(child);
+  VisualPtr other = scene->CreateVisual();
+  root->AddChild(other);
+
+  math::Pose3d parentPose(-1, 0, 2, 0, 0, 0);
+  math::Pose3d childPose(4, 5, 6, 0.1, 0.2, 0.3);
+  math::Pose3d otherPose(7, 8, 9, 0.3, 0.2, 0.1);
+  scene->SetWorldPoses({parent->Id(), child->Id(), other->Id()},
+      {parentPose, childPose, otherPose});
+  ExpectPoseNear(parentPose, parent->WorldPose());
+  ExpectPoseNear(childPose, child->WorldPose());
+  ExpectPoseNear(otherPose, other->WorldPose());
+
+  // unknown ids are skipped and mismatched sizes are rejected
+  scene->SetWorldPoses({12345u, other->Id()}, {childPose, parentPose});
+  ExpectPoseNear(parentPose, other->WorldPose());
+  scene->SetWorldPoses({other->Id()}, std::vector<math::Pose3d>());
+  ExpectPoseNear(parentPose, other->WorldPose());
+
+  // flat float arrays
+  scene->SetWorldPoses({other->Id()}, std::vector<float>{1.0f, 2.0f, 3.0f},
+      std::vector<float>{1.0f, 0.0f, 0.0f, 0.0f});
+  ExpectPoseNear(math::Pose3d(1, 2, 3, 0, 0, 0), other->WorldPose());
+  scene->SetWorldPoses({other->Id()}, std::vector<float>{1.0f},
+      std::vector<float>{1.0f, 0.0f, 0.0f, 0.0f});
+  ExpectPoseNear(math::Pose3d(1, 2, 3, 0, 0, 0), other->WorldPose());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, Stats)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetCameraPassCountPerGpuFlush(6u);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2, 0, 0);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera("stats_camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+
+  EXPECT_EQ(0u, scene->Stats().frameCount);
+  EXPECT_TRUE(scene->Stats().sensors.empty());
+
+  const unsigned int frames = 3u;
+  for (unsigned int i = 0u; i < frames; ++i)
+    camera->Update();
+
+  RenderStats stats = scene->Stats();
+  EXPECT_EQ(frames, stats.frameCount);
+  EXPECT_LT(0u, stats.drawCalls);
+  EXPECT_LT(0u, stats.triangles);
+  ASSERT_EQ(1u, stats.sensors.count("stats_camera"));
+  const SensorStats &cameraStats = stats.sensors["stats_camera"];
+  EXPECT_EQ(frames, cameraStats.renderCount);
+  EXPECT_LT(0, cameraStats.renderTime.count());
+  EXPECT_LE(cameraStats.preRenderTime + cameraStats.renderTime +
+      cameraStats.postRenderTime, cameraStats.totalTime);
+
+  scene->ResetStats();
+  EXPECT_EQ(0u, scene->Stats().frameCount);
+  EXPECT_TRUE(scene->Stats().sensors.empty());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, OcclusionCulling)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  EXPECT_FALSE(scene->OcclusionCulling());
+  scene->SetOcclusionCulling(true);
+  EXPECT_TRUE(scene->OcclusionCulling());
+
+  scene->SetCameraPassCountPerGpuFlush(6u);
+
+  // a wall filling the camera's view with a sphere behind it
+  VisualPtr root = scene->RootVisual();
+  VisualPtr wall = scene->CreateVisual();
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalPosition(2, 0, 0);
+  wall->SetLocalScale(0.2, 20, 20);
+  root->AddChild(wall);
+
+  VisualPtr sphere = scene->CreateVisual();
+  sphere->AddGeometry(scene->CreateSphere());
+  sphere->SetLocalPosition(6, 0, 0);
+  root->AddChild(sphere);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+
+  camera->Update();
+  RenderStats stats = scene->Stats();
+  EXPECT_LE(2u, stats.occlusionTested);
+  EXPECT_LE(1u, stats.occlusionCulled);
+  EXPECT_GT(stats.occlusionTested, stats.occlusionCulled);
+
+  // the culled sphere is visible again once the camera rendered
+  EXPECT_TRUE(sphere->Visible());
+
+  // nothing is culled once the wall is out of the way
+  wall->SetLocalPosition(2, 0, 50);
+  camera->Update();
+  EXPECT_EQ(0u, scene->Stats().occlusionCulled);
+
+  scene->SetOcclusionCulling(false);
+  wall->SetLocalPosition(2, 0, 0);
+  camera->Update();
+  EXPECT_EQ(0u, scene->Stats().occlusionTested);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, SnapshotRestore)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr box = scene->CreateVisual("box");
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPose(math::Pose3d(1, 2, 3, 0, 0, 0.5));
+  box->SetLocalScale(2.0);
+  box->SetUserData("label", 3);
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetDiffuse(1, 0, 0);
+  box->SetMaterial(red, false);
+  root->AddChild(box);
+
+  LightPtr light = scene->CreatePointLight();
+  light->SetLocalPosition(0, 0, 5);
+  root->AddChild(light);
+
+  SceneSnapshot snapshot = scene->Snapshot();
+  EXPECT_EQ(1u, snapshot.nodes.count(box->Id()));
+  EXPECT_EQ(1u, snapshot.nodes.count(light->Id()));
+  EXPECT_TRUE(snapshot.nodes[box->Id()].isVisual);
+  EXPECT_FALSE(snapshot.nodes[light->Id()].isVisual);
+
+  // change the scene during an episode
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetDiffuse(0, 1, 0);
+  box->SetMaterial(green, false);
+  box->SetLocalPose(math::Pose3d(-1, 0, 0, 0, 0, 0));
+  box->SetLocalScale(0.5);
+  box->SetVisible(false);
+  box->SetUserData("label", 7);
+  light->SetLocalPosition(1, 1, 1);
+  VisualPtr sphere = scene->CreateVisual("sphere");
+  root->AddChild(sphere);
+  EXPECT_FALSE(box->Visible());
+
+  scene->Restore(snapshot);
+  EXPECT_EQ(math::Pose3d(1, 2, 3, 0, 0, 0.5), box->LocalPose());
+  EXPECT_EQ(math::Vector3d(2, 2, 2), box->LocalScale());
+  EXPECT_TRUE(box->Visible());
+  EXPECT_EQ(red, box->Material());
+  EXPECT_EQ(3, std::get<int>(box->UserData("label")));
+  EXPECT_EQ(math::Vector3d(0, 0, 5), light->LocalPosition());
+
+  // nodes created after the snapshot are kept
+  EXPECT_TRUE(scene->HasVisualName("sphere"));
+
+  // nodes destroyed after the snapshot are skipped
+  scene->DestroyVisual(box);
+  scene->Restore(snapshot);
+  EXPECT_EQ(math::Vector3d(0, 0, 5), light->LocalPosition());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, SaveLoadSnapshot)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  const std::string path = testing::TempDir() + "scene_snapshot.bin";
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr box = scene->CreateVisual("box");
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPose(math::Pose3d(1, 2, 3, 0, 0, 0.5));
+  box->SetLocalScale(2.0);
+  box->SetUserData("label", 3);
+  box->SetUserData("category", std::string("crate"));
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetDiffuse(1, 0, 0);
+  red->SetRoughness(0.25f);
+  box->SetMaterial(red, false);
+  root->AddChild(box);
+
+  VisualPtr capsule = scene->CreateVisual("capsule");
+  CapsulePtr capsuleGeom = scene->CreateCapsule();
+  capsuleGeom->SetRadius(0.3);
+  capsuleGeom->SetLength(1.2);
+  capsule->AddGeometry(capsuleGeom);
+  capsule->SetLocalPosition(0, 0, 1);
+  capsule->SetVisible(false);
+  box->AddChild(capsule);
+
+  // lights are not saved
+  LightPtr light = scene->CreatePointLight();
+  root->AddChild(light);
+
+  EXPECT_TRUE(scene->SaveSnapshot(path));
+  engine->DestroyScene(scene);
+
+  scene = engine->CreateScene("scene2");
+  ASSERT_NE(nullptr, scene);
+  EXPECT_FALSE(scene->LoadSnapshot(path + ".missing"));
+  EXPECT_TRUE(scene->LoadSnapshot(path));
+  EXPECT_EQ(2u, scene->VisualCount());
+  EXPECT_EQ(0u, scene->LightCount());
+
+  box = scene->VisualByName("box");
+  ASSERT_NE(nullptr, box);
+  EXPECT_EQ(scene->RootVisual(), box->Parent());
+  EXPECT_EQ(math::Pose3d(1, 2, 3, 0, 0, 0.5), box->LocalPose());
+  EXPECT_EQ(math::Vector3d(2, 2, 2), box->LocalScale());
+  EXPECT_EQ(3, std::get<int>(box->UserData("label")));
+  EXPECT_EQ("crate", std::get<std::string>(box->UserData("category")));
+  EXPECT_EQ(1u, box->GeometryCount());
+  ASSERT_NE(nullptr, box->Material());
+  EXPECT_EQ(math::Color(1, 0, 0), box->Material()->Diffuse());
+  EXPECT_FLOAT_EQ(0.25f, box->Material()->Roughness());
+
+  capsule = scene->VisualByName("capsule");
+  ASSERT_NE(nullptr, capsule);
+  EXPECT_EQ(box, capsule->Parent());
+  EXPECT_EQ(math::Vector3d(0, 0, 1), capsule->LocalPosition());
+  EXPECT_FALSE(capsule->Visible());
+  ASSERT_EQ(1u, capsule->GeometryCount());
+  capsuleGeom = std::dynamic_pointer_cast<Capsule>(
+      capsule->GeometryByIndex(0));
+  ASSERT_NE(nullptr, capsuleGeom);
+  EXPECT_DOUBLE_EQ(0.3, capsuleGeom->Radius());
+  EXPECT_DOUBLE_EQ(1.2, capsuleGeom->Length());
+
+  // loading again keeps the names unique
+  EXPECT_TRUE(scene->LoadSnapshot(path));
+  EXPECT_EQ(4u, scene->VisualCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  std::remove(path.c_str());
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, LightClustering)
+{
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // defaults
+  LightClusterConfig config = scene->LightClustering();
+  EXPECT_TRUE(config.enabled);
+  EXPECT_EQ(16u, config.width);
+  EXPECT_EQ(8u, config.height);
+  EXPECT_EQ(24u, config.slices);
+  EXPECT_EQ(96u, config.lightsPerCell);
+
+  // invalid configurations are rejected
+  LightClusterConfig invalid;
+  invalid.slices = 0u;
+  EXPECT_FALSE(scene->SetLightClustering(invalid));
+  invalid = LightClusterConfig();
+  invalid.minDistance = 10.0;
+  invalid.maxDistance = 5.0;
+  EXPECT_FALSE(scene->SetLightClustering(invalid));
+  EXPECT_EQ(24u, scene->LightClustering().slices);
+
+  // finer grid for many lights
+  config.width = 32u;
+  config.height = 16u;
+  config.slices = 32u;
+  config.lightsPerCell = 64u;
+  config.maxDistance = 100.0;
+  EXPECT_TRUE(scene->SetLightClustering(config));
+  EXPECT_EQ(32u, scene->LightClustering().width);
+  EXPECT_EQ(16u, scene->LightClustering().height);
+  EXPECT_EQ(32u, scene->LightClustering().slices);
+  EXPECT_EQ(64u, scene->LightClustering().lightsPerCell);
+  EXPECT_DOUBLE_EQ(100.0, scene->LightClustering().maxDistance);
+
+  VisualPtr root = scene->RootVisual();
+  for (unsigned int i = 0u; i < 20u; ++i)
+  {
+    PointLightPtr light = scene->CreatePointLight();
+    light->SetLocalPosition(i * 2.0, 0, 1);
+    light->SetCastShadows(false);
+    root->AddChild(light);
+  }
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, ShadowSettings)
+{
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // defaults
+  ShadowConfig config = scene->ShadowSettings();
+  EXPECT_EQ(2048u, config.directionalTextureSize);
+  EXPECT_EQ(2048u, config.textureSize);
+  EXPECT_EQ(8192u, config.atlasSize);
+  EXPECT_EQ(25u, config.maxShadowMaps);
+  EXPECT_DOUBLE_EQ(0.0, config.updateRate);
+  EXPECT_FALSE(config.reuseStaticShadows);
+
+  // invalid settings are rejected
+  ShadowConfig invalid;
+  invalid.atlasSize = 3000u;
+  EXPECT_FALSE(scene->SetShadowSettings(invalid));
+  invalid = ShadowConfig();
+  invalid.maxShadowMaps = 0u;
+  EXPECT_FALSE(scene->SetShadowSettings(invalid));
+  invalid = ShadowConfig();
+  invalid.updateRate = -1.0;
+  EXPECT_FALSE(scene->SetShadowSettings(invalid));
+  EXPECT_EQ(8192u, scene->ShadowSettings().atlasSize);
+
+  // smaller shadow maps updated at 10 Hz
+  config.textureSize = 1024u;
+  config.atlasSize = 4096u;
+  config.updateRate = 10.0;
+  config.reuseStaticShadows = true;
+  EXPECT_TRUE(scene->SetShadowSettings(config));
+  EXPECT_EQ(1024u, scene->ShadowSettings().textureSize);
+  EXPECT_EQ(4096u, scene->ShadowSettings().atlasSize);
+  EXPECT_DOUBLE_EQ(10.0, scene->ShadowSettings().updateRate);
+  EXPECT_TRUE(scene->ShadowSettings().reuseStaticShadows);
+
+  VisualPtr root = scene->RootVisual();
+  SpotLightPtr light = scene->CreateSpotLight();
+  light->SetLocalPosition(0, 0, 5);
+  light->SetDirection(0, 0, -1);
+  light->SetCastShadows(true);
+  root->AddChild(light);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  camera->SetLocalPosition(-5, 0, 1);
+  root->AddChild(camera);
+
+  // render frames with and without changes between them
+  for (unsigned int i = 0u; i < 4u; ++i)
+  {
+    scene->SetTime(std::chrono::milliseconds(i * 50));
+    if (i == 2u)
+      box->SetLocalPosition(0, 1, 0);
+    camera->Update();
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, BakeStaticVisuals)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // nothing to bake
+  EXPECT_EQ(0u, scene->BakeStaticVisuals());
+
+  VisualPtr root = scene->RootVisual();
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0, 0, 1);
+  for (unsigned int i = 0u; i < 4u; ++i)
+  {
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetLocalPosition(3, i * 1.5 - 2.25, 0);
+    box->SetMaterial(material, false);
+    box->SetStatic(i < 3u);
+    root->AddChild(box);
+  }
+  const unsigned int visualCount = scene->VisualCount();
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64u);
+  camera->SetImageHeight(64u);
+  root->AddChild(camera);
+  camera->Update();
+
+  // the three static boxes share a material, the dynamic one is kept
+  EXPECT_EQ(1u, scene->BakeStaticVisuals());
+  EXPECT_EQ(visualCount + 1u, scene->VisualCount());
+  camera->Update();
+
+  // rebaking replaces the batches
+  EXPECT_EQ(1u, scene->BakeStaticVisuals());
+  EXPECT_EQ(visualCount + 1u, scene->VisualCount());
+
+  scene->UnbakeStaticVisuals();
+  EXPECT_EQ(visualCount, scene->VisualCount());
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, CreateDestroyVisuals)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr parent = scene->CreateVisual("parent");
+  root->AddChild(parent);
+  MaterialPtr material = scene->CreateMaterial();
+  const unsigned int visualCount = scene->VisualCount();
+
+  std::vector<VisualDescriptor> descs(3u);
+  descs[0].name = "named";
+  descs[0].localPose = math::Pose3d(1, 2, 3, 0, 0, 0);
+  descs[1].parent = parent;
+  descs[1].localScale = math::Vector3d(2, 2, 2);
+  descs[1].mesh.meshName = "unit_box";
+  descs[1].material = material;
+  // name in use
+  descs[2].name = "parent";
+
+  auto visuals = scene->CreateVisuals(descs);
+  ASSERT_EQ(3u, visuals.size());
+  ASSERT_NE(nullptr, visuals[0]);
+  ASSERT_NE(nullptr, visuals[1]);
+  EXPECT_EQ(nullptr, visuals[2]);
+  EXPECT_EQ(visualCount + 2u, scene->VisualCount());
+
+  EXPECT_EQ("named", visuals[0]->Name());
+  EXPECT_EQ(root, visuals[0]->Parent());
+  EXPECT_EQ(math::Pose3d(1, 2, 3, 0, 0, 0), visuals[0]->LocalPose());
+  EXPECT_EQ(0u, visuals[0]->GeometryCount());
+
+  EXPECT_EQ(scene->Name() + "::Visual(" +
+      std::to_string(visuals[1]->Id()) + ")", visuals[1]->Name());
+  EXPECT_EQ(parent, visuals[1]->Parent());
+  EXPECT_EQ(math::Vector3d(2, 2, 2), visuals[1]->LocalScale());
+  EXPECT_EQ(1u, visuals[1]->GeometryCount());
+  EXPECT_EQ(material, visuals[1]->Material());
+
+  // the child of parent is destroyed with it and skipped afterwards
+  scene->DestroyVisuals({parent, visuals[1], nullptr}, true);
+  EXPECT_EQ(visualCount, scene->VisualCount());
+  EXPECT_FALSE(scene->HasVisualName("parent"));
+  EXPECT_TRUE(scene->HasVisualName("named"));
+
+  scene->DestroyVisuals({visuals[0]});
+  EXPECT_FALSE(scene->HasVisualName("named"));
+  EXPECT_EQ(visualCount - 1u, scene->VisualCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, DestroyVisualDeferred)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr parent = scene->CreateVisual("parent");
+  VisualPtr child = scene->CreateVisual("child");
+  VisualPtr grandChild = scene->CreateVisual("grandChild");
+  root->AddChild(parent);
+  parent->AddChild(child);
+  child->AddChild(grandChild);
+  child->AddGeometry(scene->CreateBox());
+
+  EXPECT_EQ(0u, scene->PendingDestructionCount());
+  EXPECT_EQ(std::chrono::milliseconds(2), scene->DestructionBudget());
+
+  // one node per frame
+  scene->SetDestructionBudget(std::chrono::steady_clock::duration::zero());
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      scene->DestructionBudget());
+
+  scene->DestroyVisualDeferred(parent, true);
+  EXPECT_EQ(nullptr, parent->Parent());
+  EXPECT_FALSE(parent->Visible());
+  EXPECT_EQ(3u, scene->PendingDestructionCount());
+  EXPECT_TRUE(scene->HasVisualName("parent"));
+
+  // children are destroyed first
+  scene->PreRender();
+  EXPECT_EQ(2u, scene->PendingDestructionCount());
+  EXPECT_FALSE(scene->HasVisualName("grandChild"));
+  EXPECT_TRUE(scene->HasVisualName("child"));
+
+  scene->PreRender();
+  scene->PreRender();
+  EXPECT_EQ(0u, scene->PendingDestructionCount());
+  EXPECT_FALSE(scene->HasVisualName("child"));
+  EXPECT_FALSE(scene->HasVisualName("parent"));
+
+  // queued nodes are dropped when the scene is cleared
+  VisualPtr other = scene->CreateVisual("other");
+  root->AddChild(other);
+  scene->DestroyVisualDeferred(other);
+  EXPECT_EQ(1u, scene->PendingDestructionCount());
+  scene->Clear();
+  EXPECT_EQ(0u, scene->PendingDestructionCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, VisualByCompactId)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+  EXPECT_EQ(root, scene->VisualByCompactId(root->CompactId()));
+
+  // compact ids are dense, unlike user provided ids
+  VisualPtr a = scene->CreateVisual(1000u, "a");
+  VisualPtr b = scene->CreateVisual(50000u, "b");
+  ASSERT_NE(nullptr, a);
+  ASSERT_NE(nullptr, b);
+  EXPECT_NE(a->CompactId(), b->CompactId());
+  EXPECT_GT(scene->VisualCount() + 1u, a->CompactId());
+  EXPECT_GT(scene->VisualCount() + 1u, b->CompactId());
+  EXPECT_EQ(a, scene->VisualByCompactId(a->CompactId()));
+  EXPECT_EQ(b, scene->VisualByCompactId(b->CompactId()));
+  EXPECT_EQ(nullptr, scene->VisualByCompactId(1000000u));
+
+  // destroyed visuals are not found anymore
+  const uint32_t compactId = a->CompactId();
+  scene->DestroyVisual(a);
+  a.reset();
+  EXPECT_EQ(nullptr, scene->VisualByCompactId(compactId));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, DoubleBufferedState)
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr parent = scene->CreateVisual();
+  VisualPtr child = scene->CreateVisual();
+  root->AddChild(parent);
+  parent->AddChild(child);
+
+  // nothing published yet
+  EXPECT_FALSE(scene->SwapState());
+
+  // a simulation thread writes two steps while nothing is rendered
+  std::thread simulation([&]()
+      {
+        scene->StageWorldPose(parent->Id(), math::Pose3d(1, 0, 0, 0, 0, 0));
+        scene->StageWorldPose(child->Id(), math::Pose3d(1, 1, 0, 0, 0, 0));
+        scene->PublishState();
+        scene->StageWorldPoses({parent->Id()},
+            {math::Pose3d(2, 0, 0, 0, 0, 0)});
+        scene->PublishState();
+
+        // staged, but the step is not complete
+        scene->StageWorldPose(parent->Id(), math::Pose3d(3, 0, 0, 0, 0, 0));
+      });
+  simulation.join();
+
+  // the scene is untouched until the state is swapped
+  EXPECT_EQ(math::Vector3d::Zero, parent->WorldPosition());
+
+  EXPECT_TRUE(scene->SwapState());
+  EXPECT_EQ(math::Vector3d(2, 0, 0), parent->WorldPosition());
+  EXPECT_EQ(math::Vector3d(1, 1, 0), child->WorldPosition());
+  EXPECT_FALSE(scene->SwapState());
+
+  scene->PublishState();
+  EXPECT_TRUE(scene->SwapState());
+  EXPECT_EQ(math::Vector3d(3, 0, 0), parent->WorldPosition());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, RenderOrigin)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  EXPECT_EQ(math::Vector3d::Zero, scene->RenderOrigin());
+
+  // a node far away from the world origin, with a child
+  const math::Vector3d far(1.0e7 + 0.25, -2.0e7 + 0.5, 3.0);
+  VisualPtr visual = scene->CreateVisual();
+  VisualPtr child = scene->CreateVisual();
+  visual->AddChild(child);
+  child->SetLocalPosition(0.0, 0.0, 1.0);
+  visual->SetWorldPosition(far);
+  scene->RootVisual()->AddChild(visual);
+
+  const math::Vector3d origin(1.0e7, -2.0e7, 0.0);
+  scene->SetRenderOrigin(origin);
+  EXPECT_EQ(origin, scene->RenderOrigin());
+
+  // poses stay in world coordinates and keep their double precision
+  EXPECT_EQ(far, visual->WorldPosition());
+  EXPECT_EQ(far + math::Vector3d(0.0, 0.0, 1.0), child->WorldPosition());
+
+  // nodes added after the render origin was set also keep world poses
+  VisualPtr other = scene->CreateVisual();
+  scene->RootVisual()->AddChild(other);
+  other->SetWorldPosition(far + math::Vector3d(0.125, 0.0, 0.0));
+  EXPECT_EQ(far + math::Vector3d(0.125, 0.0, 0.0), other->WorldPosition());
+
+  scene->SetRenderOrigin(math::Vector3d::Zero);
+  EXPECT_EQ(math::Vector3d::Zero, scene->RenderOrigin());
+  EXPECT_EQ(far, visual->WorldPosition());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, SharedShaderParams)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  ShaderParamsPtr params = scene->SharedShaderParams();
+  ASSERT_NE(nullptr, params);
+  EXPECT_EQ(params, scene->SharedShaderParams());
+
+  (*params)["wind_speed"] = 2.5f;
+  float wind[8] = {0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f};
+  (*params)["wind_dirs"].InitializeBuffer(8u);
+  (*params)["wind_dirs"].UpdateBuffer(wind);
+  EXPECT_TRUE(params->IsDirty());
+
+  // shared params are only written once a custom shader uses them
+  scene->SetTime(std::chrono::milliseconds(100));
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_TRUE(params->IsDirty());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/DepthCamera.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/SensorGBuffer.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class SensorGBufferTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(SensorGBufferTest, SensorGBuffer)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(3, 0, 0);
+  box->SetUserData("label", 5);
+  root->AddChild(box);
+
+  // RGB-D with semantic and instance masks
+  std::set<GBufferOutput> outputs = {GBufferOutput::COLOR,
+      GBufferOutput::DEPTH, GBufferOutput::LABEL,
+      GBufferOutput::INSTANCE};
+  SensorGBufferPtr sensor = scene->CreateSensorGBuffer(outputs);
+  ASSERT_NE(nullptr, sensor);
+  ASSERT_NE(nullptr, sensor->Visual());
+  root->AddChild(sensor->Visual());
+  EXPECT_EQ(outputs, sensor->Outputs());
+  EXPECT_EQ(nullptr, sensor->OutputCamera(GBufferOutput::TEMPERATURE));
+
+  // four outputs from two renders
+  EXPECT_EQ(2u, sensor->RenderCount());
+  DepthCameraPtr depth = std::dynamic_pointer_cast<DepthCamera>(
+      sensor->OutputCamera(GBufferOutput::DEPTH));
+  ASSERT_NE(nullptr, depth);
+  EXPECT_EQ(depth, sensor->OutputCamera(GBufferOutput::COLOR));
+  SegmentationCameraPtr segmentation =
+      std::dynamic_pointer_cast<SegmentationCamera>(
+      sensor->OutputCamera(GBufferOutput::LABEL));
+  ASSERT_NE(nullptr, segmentation);
+  EXPECT_EQ(segmentation,
+      sensor->OutputCamera(GBufferOutput::INSTANCE));
+  EXPECT_EQ(SegmentationType::ST_PANOPTIC, segmentation->Type());
+  EXPECT_TRUE(sensor->Visual()->HasChild(depth));
+  EXPECT_TRUE(sensor->Visual()->HasChild(segmentation));
+
+  // the settings apply to every output
+  sensor->SetImageSize(32u, 16u);
+  sensor->SetHFOV(GZ_PI / 2);
+  sensor->SetClipPlanes(0.1, 10.0);
+  for (const CameraPtr &camera : {CameraPtr(depth),
+      CameraPtr(segmentation)})
+  {
+    EXPECT_EQ(32u, camera->ImageWidth());
+    EXPECT_EQ(16u, camera->ImageHeight());
+    EXPECT_DOUBLE_EQ(2.0, camera->AspectRatio());
+    EXPECT_DOUBLE_EQ(GZ_PI / 2, camera->HFOV().Radian());
+    EXPECT_DOUBLE_EQ(0.1, camera->NearClipPlane());
+    EXPECT_DOUBLE_EQ(10.0, camera->FarClipPlane());
+  }
+
+  // every output keeps its own signal
+  unsigned int rgbFrames = 0u;
+  unsigned int depthFrames = 0u;
+  unsigned int segmentationFrames = 0u;
+  common::ConnectionPtr rgbConnection = depth->ConnectNewRgbFrame(
+      [&rgbFrames](const void *, unsigned int, unsigned int,
+      unsigned int, const std::string &)
+      {
+        ++rgbFrames;
+      });
+  common::ConnectionPtr depthConnection = depth->ConnectNewDepthFrame(
+      [&depthFrames](const float *, unsigned int, unsigned int,
+      unsigned int, const std::string &)
+      {
+        ++depthFrames;
+      });
+  common::ConnectionPtr segmentationConnection =
+      segmentation->ConnectNewSegmentationFrame(
+      [&segmentationFrames](const uint8_t *, unsigned int, unsigned int,
+      unsigned int, const std::string &)
+      {
+        ++segmentationFrames;
+      });
+
+  sensor->Update();
+  EXPECT_EQ(1u, rgbFrames);
+  EXPECT_EQ(1u, depthFrames);
+  EXPECT_EQ(1u, segmentationFrames);
+
+  // destroying the sensor destroys its cameras
+  sensor->Destroy();
+  EXPECT_EQ(nullptr, sensor->Visual());
+  EXPECT_EQ(0u, sensor->RenderCount());
+  EXPECT_FALSE(scene->HasSensor(depth));
+  EXPECT_FALSE(scene->HasSensor(segmentation));
+
+  // colour without depth uses a plain camera
+  SensorGBufferPtr color =
+      scene->CreateSensorGBuffer({GBufferOutput::COLOR});
+  ASSERT_NE(nullptr, color);
+  EXPECT_EQ(1u, color->RenderCount());
+  CameraPtr camera = color->OutputCamera(GBufferOutput::COLOR);
+  ASSERT_NE(nullptr, camera);
+  EXPECT_EQ(nullptr, std::dynamic_pointer_cast<DepthCamera>(camera));
+  color->Destroy();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
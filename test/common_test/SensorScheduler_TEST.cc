@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SensorScheduler.hh"
+
+using namespace gz;
+using namespace rendering;
+using namespace std::chrono_literals;
+
+class SensorSchedulerTest : public CommonRenderingTest
+{
+  /// \brief Create a small camera in the scene
+  public: CameraPtr CreateCamera(ScenePtr _scene)
+  {
+    CameraPtr camera = _scene->CreateCamera();
+    camera->SetImageWidth(32u);
+    camera->SetImageHeight(32u);
+    _scene->RootVisual()->AddChild(camera);
+    return camera;
+  }
+};
+
+/////////////////////////////////////////////////
+TEST_F(SensorSchedulerTest, Rates)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetCameraPassCountPerGpuFlush(6u);
+
+  CameraPtr fast = this->CreateCamera(scene);
+  CameraPtr slow = this->CreateCamera(scene);
+
+  SensorScheduler scheduler(scene);
+  EXPECT_EQ(6u, scheduler.PassBudget());
+  EXPECT_FALSE(scheduler.AddSensor(fast, 0.0));
+  EXPECT_FALSE(scheduler.AddSensor(nullptr, 10.0));
+  EXPECT_TRUE(scheduler.AddSensor(fast, 30.0));
+  EXPECT_TRUE(scheduler.AddSensor(slow, 10.0));
+  EXPECT_EQ(2u, scheduler.SensorCount());
+  EXPECT_EQ(1u, scheduler.SensorCost(fast));
+
+  // one second of simulation at 100 Hz
+  for (unsigned int i = 0u; i < 100u; ++i)
+  {
+    scene->SetTime(i * 10ms);
+    scheduler.Update();
+  }
+
+  EXPECT_NEAR(30.0, static_cast<double>(scheduler.UpdateCount(fast)), 1.0);
+  EXPECT_NEAR(10.0, static_cast<double>(scheduler.UpdateCount(slow)), 1.0);
+  EXPECT_NEAR(30.0, scheduler.AchievedRate(fast), 3.0);
+  EXPECT_NEAR(10.0, scheduler.AchievedRate(slow), 1.0);
+
+  scheduler.RemoveSensor(fast);
+  EXPECT_EQ(1u, scheduler.SensorCount());
+  EXPECT_EQ(0u, scheduler.UpdateCount(fast));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorSchedulerTest, Budgets)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetCameraPassCountPerGpuFlush(6u);
+
+  CameraPtr a = this->CreateCamera(scene);
+  CameraPtr b = this->CreateCamera(scene);
+  CameraPtr c = this->CreateCamera(scene);
+
+  SensorScheduler scheduler(scene);
+  scheduler.AddSensor(a, 10.0);
+  scheduler.AddSensor(b, 10.0);
+  scheduler.AddSensor(c, 10.0);
+  scheduler.SetSensorCost(a, 4u);
+  scheduler.SetSensorCost(b, 4u);
+  EXPECT_EQ(4u, scheduler.SensorCost(a));
+
+  // every sensor is due: a and b do not fit in one flush
+  scene->SetTime(0ms);
+  EXPECT_EQ(2u, scheduler.Update());
+  EXPECT_EQ(1u, scheduler.UpdateCount(a));
+  EXPECT_EQ(1u, scheduler.UpdateCount(b));
+  EXPECT_EQ(1u, scheduler.UpdateCount(c));
+
+  // nothing is due before the next period
+  scene->SetTime(50ms);
+  EXPECT_EQ(0u, scheduler.Update());
+
+  // limit the step to 4 passes: the sensors are staggered across steps
+  scheduler.SetMaxPassesPerStep(4u);
+  scene->SetTime(100ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  scene->SetTime(110ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  scene->SetTime(120ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  EXPECT_EQ(2u, scheduler.UpdateCount(a));
+  EXPECT_EQ(2u, scheduler.UpdateCount(b));
+  EXPECT_EQ(2u, scheduler.UpdateCount(c));
+
+  // destroyed sensors are dropped
+  scene->DestroySensor(c);
+  scene->SetTime(200ms);
+  scheduler.Update();
+  EXPECT_EQ(2u, scheduler.SensorCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorSchedulerTest, DemandDriven)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = this->CreateCamera(scene);
+  EXPECT_FALSE(camera->DemandDriven());
+  EXPECT_FALSE(camera->HasConnections());
+  EXPECT_FALSE(camera->IsIdle());
+
+  // demand driven without connections or requests: idle
+  camera->SetDemandDriven(true);
+  EXPECT_TRUE(camera->DemandDriven());
+  EXPECT_TRUE(camera->IsIdle());
+
+  SensorScheduler scheduler(scene);
+  scheduler.AddSensor(camera, 10.0);
+  scene->SetTime(0ms);
+  EXPECT_EQ(0u, scheduler.Update());
+  EXPECT_EQ(0u, scheduler.UpdateCount(camera));
+
+  // a capture request renders the next frame only
+  camera->RequestCapture();
+  EXPECT_FALSE(camera->IsIdle());
+  scene->SetTime(100ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  EXPECT_EQ(1u, scheduler.UpdateCount(camera));
+  EXPECT_TRUE(camera->IsIdle());
+
+  // a connection keeps the sensor active
+  common::ConnectionPtr connection = camera->ConnectNewImageFrame(
+      [](const void *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+  EXPECT_TRUE(camera->HasConnections());
+  EXPECT_FALSE(camera->IsIdle());
+  scene->SetTime(200ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  EXPECT_EQ(2u, scheduler.UpdateCount(camera));
+  connection.reset();
+  EXPECT_TRUE(camera->IsIdle());
+
+  // capture always renders and does not keep the sensor active
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  EXPECT_TRUE(camera->IsIdle());
+
+  // copying the data requests the next frame
+  camera->Copy(image);
+  EXPECT_FALSE(camera->IsIdle());
+  camera->Update();
+  EXPECT_TRUE(camera->IsIdle());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorSchedulerTest, TimeBudget)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr first = this->CreateCamera(scene);
+  CameraPtr second = this->CreateCamera(scene);
+  CameraPtr third = this->CreateCamera(scene);
+
+  SensorScheduler scheduler(scene);
+  EXPECT_EQ(std::chrono::steady_clock::duration::zero(),
+      scheduler.TimeBudget());
+  EXPECT_DOUBLE_EQ(1.0, scheduler.ReducedLodBias());
+  scheduler.AddSensor(first, 10.0);
+  scheduler.AddSensor(second, 10.0, 5ms);
+  scheduler.AddSensor(third, 10.0, 5ms);
+
+  // a budget of 1 ns only fits the sensor that is always rendered
+  scheduler.SetTimeBudget(1ns);
+  scheduler.SetReducedLodBias(0.5);
+  EXPECT_EQ(std::chrono::steady_clock::duration(1ns),
+      scheduler.TimeBudget());
+  EXPECT_DOUBLE_EQ(0.5, scheduler.ReducedLodBias());
+
+  // the first sensor is always rendered, the others are deferred
+  scene->SetTime(0ms);
+  EXPECT_EQ(1u, scheduler.Update());
+  EXPECT_EQ(1u, scheduler.UpdateCount(first));
+  EXPECT_EQ(0u, scheduler.UpdateCount(second));
+  EXPECT_EQ(0u, scheduler.UpdateCount(third));
+  EXPECT_EQ(0u, scheduler.DeferCount(first));
+  EXPECT_EQ(1u, scheduler.DeferCount(second));
+  EXPECT_EQ(1u, scheduler.DeferCount(third));
+
+  // sensors past their deadline are rendered with reduced detail
+  scene->SetTime(10ms);
+  scheduler.Update();
+  EXPECT_EQ(1u, scheduler.UpdateCount(second));
+  EXPECT_EQ(1u, scheduler.UpdateCount(third));
+  EXPECT_EQ(0u, scheduler.ReducedCount(second));
+  EXPECT_EQ(1u, scheduler.ReducedCount(third));
+  EXPECT_DOUBLE_EQ(1.0, third->LodBias());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -16,10 +16,14 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "CommonRenderingTest.hh"
 
+#include "gz/rendering/Camera.hh"
 #include "gz/rendering/Text.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -95,3 +99,45 @@ TEST_F(TextTest, Text)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(TextTest, TextBatching)
+{
+  CHECK_SUPPORTED_ENGINE("ogre");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  EXPECT_FALSE(scene->TextBatchingEnabled());
+
+  scene->SetTextBatchingEnabled(true);
+  EXPECT_TRUE(scene->TextBatchingEnabled());
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(80);
+  camera->SetImageHeight(60);
+  scene->RootVisual()->AddChild(camera);
+
+  // labels with the same font and two on top settings
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    TextPtr text = scene->CreateText();
+    ASSERT_NE(nullptr, text);
+    text->SetTextString("label " + std::to_string(i));
+    text->SetShowOnTop(i % 2 == 0);
+
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(text);
+    visual->SetLocalPosition(5.0, i - 5.0, 0.0);
+    scene->RootVisual()->AddChild(visual);
+  }
+  camera->Update();
+
+  // texts draw themselves again when batching is disabled
+  scene->SetTextBatchingEnabled(false);
+  EXPECT_FALSE(scene->TextBatchingEnabled());
+  camera->Update();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -15,6 +15,8 @@
 */
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/geospatial/ImageHeightmap.hh>
@@ -156,6 +158,22 @@ TEST_F(UtilTest, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(ClickToScene))
   EXPECT_NEAR(6.5 - camera->NearClipPlane(), rayResult.distance, 1e-4);
   EXPECT_EQ(box->Id(), rayResult.objectId);
 
+  // batched positions give the same results, the corner misses the box
+  std::vector<RayQueryResult> rayResults;
+  std::vector<math::Vector3d> results = screenToScene(
+      {centerClick, math::Vector2i(0, 0)}, camera, rayQuery, rayResults);
+  ASSERT_EQ(2u, results.size());
+  ASSERT_EQ(2u, rayResults.size());
+  EXPECT_NEAR(result.X(), results[0].X(), 1e-4);
+  EXPECT_NEAR(result.Y(), results[0].Y(), 1e-4);
+  EXPECT_NEAR(result.Z(), results[0].Z(), 1e-3);
+  EXPECT_TRUE(rayResults[0]);
+  EXPECT_EQ(box->Id(), rayResults[0].objectId);
+  EXPECT_FALSE(rayResults[1]);
+  EXPECT_NEAR(10.0, (results[1] - rayQuery->Origin()).Length(), 1e-3);
+  EXPECT_TRUE(screenToScene(std::vector<math::Vector2i>(), camera,
+      rayQuery).empty());
+
   // Clean up
   engine->DestroyScene(scene);
 }
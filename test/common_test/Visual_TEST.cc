@@ -335,6 +335,36 @@ TEST_F(VisualTest, UserData)
     gzdbg << res << std::endl;
   }, std::bad_variant_access);
 
+  // keys are listed in lexicographic order
+  std::vector<std::string> keys = visual->UserDataKeys();
+  ASSERT_EQ(8u, keys.size());
+  EXPECT_EQ(boolKey, keys.front());
+  EXPECT_EQ(unsignedIntKey, keys.back());
+
+  // interned keys access the same data as their names
+  UserDataKey intDataKey(intKey);
+  EXPECT_TRUE(visual->HasUserData(intDataKey));
+  ASSERT_NE(nullptr, visual->UserDataAs<int>(intDataKey));
+  EXPECT_EQ(intValue, *visual->UserDataAs<int>(intDataKey));
+  EXPECT_EQ(nullptr, visual->UserDataAs<float>(intDataKey));
+
+  UserDataKey labelKey("label");
+  EXPECT_FALSE(visual->HasUserData(labelKey));
+  EXPECT_EQ(nullptr, visual->UserDataValue(labelKey));
+  EXPECT_EQ(nullptr, visual->UserDataAs<int>(labelKey));
+  visual->SetUserData(labelKey, 3);
+  EXPECT_EQ(3, std::get<int>(visual->UserData("label")));
+  visual->SetUserData("label", 4);
+  ASSERT_NE(nullptr, visual->UserDataAs<int>(labelKey));
+  EXPECT_EQ(4, *visual->UserDataAs<int>(labelKey));
+  EXPECT_EQ(9u, visual->UserDataKeys().size());
+
+  // reading unknown keys does not intern them
+  EXPECT_FALSE(visual->HasUserData("Visual_TEST_missing"));
+  EXPECT_TRUE(std::holds_alternative<std::monostate>(
+      visual->UserData("Visual_TEST_missing")));
+  EXPECT_FALSE(UserDataKey::Find("Visual_TEST_missing").Valid());
+
   // Clean up
   engine->DestroyScene(scene);
 }
@@ -476,6 +506,24 @@ TEST_F(VisualTest, BoundingBox)
   EXPECT_EQ(gz::math::Vector3d(0.5, 1.5, 2.5), boundingBox.Min());
   EXPECT_EQ(gz::math::Vector3d(1.5, 2.5, 3.5), boundingBox.Max());
 
+  // the boxes follow changes made after they were queried
+  visual->SetWorldPosition(-1.0, 0.0, 0.0);
+  boundingBox = visual->BoundingBox();
+  EXPECT_EQ(gz::math::Vector3d(-1.5, -0.5, -0.5), boundingBox.Min());
+  EXPECT_EQ(gz::math::Vector3d(-0.5, 0.5, 0.5), boundingBox.Max());
+
+  visual->SetLocalScale(2.0);
+  localBoundingBox = visual->LocalBoundingBox();
+  EXPECT_EQ(gz::math::Vector3d(-1.0, -1.0, -1.0), localBoundingBox.Min());
+  EXPECT_EQ(gz::math::Vector3d(1.0, 1.0, 1.0), localBoundingBox.Max());
+
+  // batched query, unknown ids get empty boxes
+  std::vector<gz::math::AxisAlignedBox> boxes =
+      scene->BoundingBoxes({visual->Id(), 123456u});
+  ASSERT_EQ(2u, boxes.size());
+  EXPECT_EQ(visual->BoundingBox(), boxes[0]);
+  EXPECT_EQ(gz::math::AxisAlignedBox(), boxes[1]);
+
   // Clean up
   engine->DestroyScene(scene);
 }
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include <gtest/gtest.h>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/VoxelGridVisual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+class VoxelGridVisualTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(VoxelGridVisualTest, VoxelGridVisual)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VoxelGridVisualPtr voxelGrid = scene->CreateVoxelGridVisual();
+  ASSERT_NE(nullptr, voxelGrid);
+  scene->RootVisual()->AddChild(voxelGrid);
+
+  // defaults
+  EXPECT_DOUBLE_EQ(0.1, voxelGrid->Resolution());
+  EXPECT_DOUBLE_EQ(0.5, voxelGrid->OccupancyThreshold());
+  EXPECT_EQ(0u, voxelGrid->VoxelCount());
+  EXPECT_EQ(0u, voxelGrid->RenderedFaceCount());
+
+  // cells
+  voxelGrid->SetResolution(0.5);
+  EXPECT_DOUBLE_EQ(0.5, voxelGrid->Resolution());
+  voxelGrid->SetResolution(-1.0);
+  EXPECT_DOUBLE_EQ(0.5, voxelGrid->Resolution());
+  EXPECT_EQ(math::Vector3i(0, 1, -1),
+      voxelGrid->Cell(math::Vector3d(0.2, 0.7, -0.2)));
+  EXPECT_EQ(math::Vector3d(0.25, 0.75, -0.25),
+      voxelGrid->CellCenter(math::Vector3i(0, 1, -1)));
+
+  // two neighbours across a block border share a face
+  voxelGrid->SetVoxel(math::Vector3i(-1, 0, 0), math::Color::Red);
+  voxelGrid->SetVoxel(math::Vector3i(0, 0, 0), math::Color::Green);
+  EXPECT_EQ(2u, voxelGrid->VoxelCount());
+  EXPECT_TRUE(voxelGrid->HasVoxel(math::Vector3i(-1, 0, 0)));
+  EXPECT_FALSE(voxelGrid->HasVoxel(math::Vector3i(1, 0, 0)));
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(10u, voxelGrid->RenderedFaceCount());
+
+  // voxels below the threshold are kept but not rendered
+  voxelGrid->SetVoxel(math::Vector3i(0, 0, 0), math::Color::Green, 0.2);
+  EXPECT_EQ(2u, voxelGrid->VoxelCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(6u, voxelGrid->RenderedFaceCount());
+
+  voxelGrid->SetOccupancyThreshold(0.1);
+  EXPECT_DOUBLE_EQ(0.1, voxelGrid->OccupancyThreshold());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(10u, voxelGrid->RenderedFaceCount());
+
+  // removal
+  EXPECT_TRUE(voxelGrid->RemoveVoxel(math::Vector3i(-1, 0, 0)));
+  EXPECT_FALSE(voxelGrid->RemoveVoxel(math::Vector3i(-1, 0, 0)));
+  EXPECT_EQ(1u, voxelGrid->VoxelCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(6u, voxelGrid->RenderedFaceCount());
+
+  // a solid block only renders its outer faces
+  for (int x = 0; x < 20; ++x)
+  {
+    for (int y = 0; y < 20; ++y)
+    {
+      for (int z = 0; z < 20; ++z)
+        voxelGrid->SetVoxel(math::Vector3i(x, y, z), math::Color::Blue);
+    }
+  }
+  EXPECT_EQ(8000u, voxelGrid->VoxelCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(6u * 20u * 20u, voxelGrid->RenderedFaceCount());
+
+  voxelGrid->ClearVoxels();
+  EXPECT_EQ(0u, voxelGrid->VoxelCount());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(0u, voxelGrid->RenderedFaceCount());
+
+  scene->DestroyVisual(voxelGrid);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
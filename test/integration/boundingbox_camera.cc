@@ -17,15 +17,23 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Event.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/MeshManager.hh>
+#include <gz/common/SubMesh.hh>
 
 #include <gz/math/Color.hh>
 
 #include "gz/rendering/Scene.hh"
 #include "gz/rendering/BoundingBoxCamera.hh"
+#include "gz/rendering/Mesh.hh"
+#include "gz/rendering/MeshDescriptor.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -201,6 +209,78 @@ TEST_F(BoundingBoxCameraTest, SimpleBoxes)
   engine->DestroyScene(scene);
 }
 
+//////////////////////////////////////////////////
+TEST_F(BoundingBoxCameraTest, SegmentationFrame)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  BuildSimpleScene(scene);
+
+  auto camera = scene->CreateBoundingBoxCamera("BoundingBoxCamera");
+  ASSERT_NE(camera, nullptr);
+
+  unsigned int width = 320;
+  unsigned int height = 240;
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  camera->SetAspectRatio(1.333);
+  camera->SetHFOV(GZ_PI / 2);
+  camera->SetBoundingBoxType(BoundingBoxType::BBT_VISIBLEBOX2D);
+  scene->RootVisual()->AddChild(camera);
+
+  EXPECT_EQ(SegmentationType::ST_SEMANTIC, camera->SegmentationMapType());
+
+  // boxes and the segmentation image come from a single render
+  std::vector<uint8_t> segmentation;
+  unsigned int channels = 0u;
+  gz::common::ConnectionPtr segmentationConnection =
+    camera->ConnectNewSegmentationFrame(
+      [&](const uint8_t *_data, unsigned int _width, unsigned int _height,
+          unsigned int _channels, const std::string &)
+      {
+        channels = _channels;
+        segmentation.assign(_data, _data + _width * _height * _channels);
+      });
+  ASSERT_NE(nullptr, segmentationConnection);
+  gz::common::ConnectionPtr connection =
+    camera->ConnectNewBoundingBoxes(
+      std::bind(OnNewBoundingBoxes, std::placeholders::_1));
+  ASSERT_NE(nullptr, connection);
+
+  camera->Update();
+  ASSERT_EQ(3u, channels);
+  ASSERT_EQ(width * height * 3u, segmentation.size());
+
+  g_mutex.lock();
+  EXPECT_EQ(2u, g_boxes.size());
+  g_mutex.unlock();
+
+  const unsigned int leftIndex = (height / 2u * width + width / 4u) * 3u;
+  const unsigned int rightIndex = (height / 2u * width + width * 3u / 4u) * 3u;
+  EXPECT_EQ(1u, segmentation[leftIndex]);
+  EXPECT_EQ(1u, segmentation[leftIndex + 2u]);
+  EXPECT_EQ(2u, segmentation[rightIndex]);
+  EXPECT_EQ(2u, segmentation[rightIndex + 2u]);
+  EXPECT_EQ(255u, segmentation[0]);
+
+  // every label has a single model, so a single instance
+  camera->SetSegmentationType(SegmentationType::ST_PANOPTIC);
+  EXPECT_EQ(SegmentationType::ST_PANOPTIC, camera->SegmentationMapType());
+  camera->Update();
+  ASSERT_EQ(width * height * 3u, segmentation.size());
+  EXPECT_EQ(1u, segmentation[leftIndex]);
+  EXPECT_EQ(0u, segmentation[leftIndex + 1u]);
+  EXPECT_EQ(1u, segmentation[leftIndex + 2u]);
+  EXPECT_EQ(1u, segmentation[rightIndex]);
+  EXPECT_EQ(0u, segmentation[rightIndex + 1u]);
+  EXPECT_EQ(2u, segmentation[rightIndex + 2u]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 //////////////////////////////////////////////////
 TEST_F(BoundingBoxCameraTest, OccludedBoxes)
 {
@@ -271,6 +351,14 @@ TEST_F(BoundingBoxCameraTest, OccludedBoxes)
   EXPECT_NEAR(frontBox.Size().Y(), 105, marginError);
   EXPECT_EQ(frontBox.Label(), frontLabel);
 
+  // the visible pixels fill the box of the front object only
+  EXPECT_GT(occludedBox.VisiblePixelCount(), 0u);
+  EXPECT_LE(occludedBox.VisiblePixelCount(),
+      (occludedBox.Size().X() + 1) * (occludedBox.Size().Y() + 1));
+  EXPECT_NEAR(frontBox.VisiblePixelCount(),
+      (frontBox.Size().X() + 1) * (frontBox.Size().Y() + 1),
+      frontBox.Size().X() * marginError * 4);
+
   g_mutex.unlock();
 
   // Full Boxes Type Test
@@ -301,6 +389,21 @@ TEST_F(BoundingBoxCameraTest, OccludedBoxes)
 
   EXPECT_EQ(frontFullBox.Label(), frontLabel);
 
+  // the boxes are inside the image, only the back box is occluded
+  EXPECT_DOUBLE_EQ(occludedFullBox.Truncation(), 0.0);
+  EXPECT_DOUBLE_EQ(frontFullBox.Truncation(), 0.0);
+  EXPECT_NEAR(occludedFullBox.VisiblePixelCount(),
+      occludedBox.VisiblePixelCount(), 1u);
+  EXPECT_NEAR(occludedFullBox.ProjectedArea(),
+      occludedFullBox.Size().X() * occludedFullBox.Size().Y(),
+      occludedFullBox.Size().X() * marginError * 4);
+  EXPECT_GT(occludedFullBox.Occlusion(), 0.5);
+  EXPECT_LT(occludedFullBox.Occlusion(), 0.9);
+  EXPECT_NEAR(frontFullBox.ProjectedArea(),
+      frontFullBox.Size().X() * frontFullBox.Size().Y(),
+      frontFullBox.Size().X() * marginError * 4);
+  EXPECT_NEAR(frontFullBox.Occlusion(), 0.0, 0.05);
+
   g_mutex.unlock();
 
   // Clean up
@@ -369,3 +472,72 @@ TEST_F(BoundingBoxCameraTest, Oriented3dBoxes)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+//////////////////////////////////////////////////
+TEST_F(BoundingBoxCameraTest, DeformedMesh3dBoxes)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // a dynamic mesh whose vertices are rewritten between frames
+  MeshDescriptor descriptor("unit_box");
+  descriptor.dynamic = true;
+  MeshPtr mesh = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, mesh);
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(mesh);
+  visual->SetLocalPosition(3, 0, 0);
+  visual->SetUserData("label", 1);
+  scene->RootVisual()->AddChild(visual);
+
+  auto camera = scene->CreateBoundingBoxCamera("BoundingBoxCamera");
+  ASSERT_NE(camera, nullptr);
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  camera->SetAspectRatio(1.333);
+  camera->SetHFOV(GZ_PI / 2);
+  camera->SetBoundingBoxType(BoundingBoxType::BBT_BOX3D);
+  scene->RootVisual()->AddChild(camera);
+
+  gz::common::ConnectionPtr connection =
+    camera->ConnectNewBoundingBoxes(
+      std::bind(OnNewBoundingBoxes, std::placeholders::_1));
+  EXPECT_NE(nullptr, connection);
+
+  double marginError = 0.05;
+  camera->Update();
+  g_mutex.lock();
+  ASSERT_EQ(g_boxes.size(), std::size_t(1));
+  EXPECT_NEAR(1.0, g_boxes[0].Size().X(), marginError);
+  EXPECT_NEAR(1.0, g_boxes[0].Size().Z(), marginError);
+  g_mutex.unlock();
+
+  // the box follows the deformed vertices instead of the first frame
+  const common::Mesh *unitBox =
+      common::MeshManager::Instance()->MeshByName("unit_box");
+  ASSERT_NE(nullptr, unitBox);
+  auto subMesh = unitBox->SubMeshByIndex(0u).lock();
+  ASSERT_NE(nullptr, subMesh);
+  std::vector<float> positions;
+  for (unsigned int i = 0u; i < subMesh->VertexCount(); ++i)
+  {
+    const math::Vector3d v = subMesh->Vertex(i) * 2.0;
+    positions.push_back(static_cast<float>(v.X()));
+    positions.push_back(static_cast<float>(v.Y()));
+    positions.push_back(static_cast<float>(v.Z()));
+  }
+  ASSERT_TRUE(mesh->UpdateVertices(0u, positions.data(), nullptr,
+      subMesh->VertexCount()));
+
+  camera->Update();
+  g_mutex.lock();
+  ASSERT_EQ(g_boxes.size(), std::size_t(1));
+  EXPECT_NEAR(2.0, g_boxes[0].Size().X(), marginError);
+  EXPECT_NEAR(2.0, g_boxes[0].Size().Z(), marginError);
+  g_mutex.unlock();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
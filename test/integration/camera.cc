@@ -17,6 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
@@ -25,6 +32,7 @@
 #include "gz/rendering/SegmentationCamera.hh"
 #include "gz/rendering/ShaderParams.hh"
 #include "gz/rendering/ThermalCamera.hh"
+#include "gz/rendering/Utils.hh"
 
 #include <gz/utils/ExtraTestMacros.hh>
 
@@ -274,6 +282,79 @@ TEST_F(CameraTest, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(VisualAt))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(VisualsInRegion))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  // same layout as the VisualAt test: sphere on the left, box on the right
+  VisualPtr box = scene->CreateVisual("box");
+  ASSERT_NE(nullptr, box);
+  box->AddGeometry(scene->CreateBox());
+  box->SetOrigin(0.0, 0.7, 0.0);
+  box->SetLocalPosition(2, 0, 0);
+  root->AddChild(box);
+
+  VisualPtr sphere = scene->CreateVisual("sphere");
+  ASSERT_NE(nullptr, sphere);
+  sphere->AddGeometry(scene->CreateSphere());
+  sphere->SetOrigin(0.0, -0.7, 0.0);
+  sphere->SetLocalPosition(2, 0, 0);
+  root->AddChild(sphere);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(800);
+  camera->SetImageHeight(600);
+  camera->SetAspectRatio(1.333);
+  camera->SetHFOV(GZ_PI / 2);
+  root->AddChild(camera);
+
+  for (auto i = 0; i < 30; ++i)
+    camera->Update();
+
+  auto names = [](const std::vector<VisualPtr> &_visuals)
+  {
+    std::set<std::string> result;
+    for (const auto &vis : _visuals)
+      result.insert(vis->Name());
+    return result;
+  };
+
+  // whole image contains both visuals
+  std::vector<VisualPtr> visuals = camera->VisualsInRegion(
+      math::Vector2i(0, 0), math::Vector2i(800, 600));
+  EXPECT_EQ(2u, visuals.size());
+  EXPECT_EQ(std::set<std::string>({"box", "sphere"}), names(visuals));
+
+  // left half only contains the sphere
+  visuals = camera->VisualsInRegion(
+      math::Vector2i(0, 0), math::Vector2i(350, 600));
+  EXPECT_EQ(std::set<std::string>({"sphere"}), names(visuals));
+
+  // empty area and empty rectangle
+  EXPECT_TRUE(camera->VisualsInRegion(
+      math::Vector2i(0, 0), math::Vector2i(50, 50)).empty());
+  EXPECT_TRUE(camera->VisualsInRegion(
+      math::Vector2i(10, 10), math::Vector2i(10, 10)).empty());
+
+  // async query returns the same result after the next frame
+  std::future<std::vector<VisualPtr>> future =
+      camera->VisualsInRegionAsync(math::Vector2i(450, 0),
+      math::Vector2i(800, 600));
+  camera->Update();
+  EXPECT_EQ(std::set<std::string>({"box"}), names(future.get()));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Follow))
 {
@@ -510,6 +591,269 @@ TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Visibility))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RenderSensors))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0, 0, 0);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  // two cameras looking at the same spot, each seeing a different box
+  CameraPtr cameraA = scene->CreateCamera();
+  ASSERT_NE(nullptr, cameraA);
+  cameraA->SetWorldPosition(-1, 0, 0);
+  cameraA->SetVisibilityMask(0x01);
+  root->AddChild(cameraA);
+
+  CameraPtr cameraB = scene->CreateCamera();
+  ASSERT_NE(nullptr, cameraB);
+  cameraB->SetWorldPosition(-1, 0, 0);
+  cameraB->SetVisibilityMask(0x02);
+  root->AddChild(cameraB);
+
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetAmbient(0.0, 1.0, 0.0);
+  green->SetDiffuse(0.0, 1.0, 0.0);
+  VisualPtr visualA = scene->CreateVisual();
+  visualA->AddGeometry(scene->CreateBox());
+  visualA->SetVisibilityFlags(0x01);
+  visualA->SetMaterial(green);
+  root->AddChild(visualA);
+
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  VisualPtr visualB = scene->CreateVisual();
+  visualB->AddGeometry(scene->CreateBox());
+  visualB->SetVisibilityFlags(0x02);
+  visualB->SetMaterial(red);
+  root->AddChild(visualB);
+
+  // render both cameras in one batch, null sensors are skipped
+  scene->RenderSensors({cameraA, nullptr, cameraB});
+
+  Image imageA = cameraA->CreateImage();
+  Image imageB = cameraB->CreateImage();
+  cameraA->Copy(imageA);
+  cameraB->Copy(imageB);
+
+  unsigned int width = cameraA->ImageWidth();
+  unsigned int height = cameraA->ImageHeight();
+  unsigned int bpp = PixelUtil::BytesPerPixel(cameraA->ImageFormat());
+  unsigned int mid = (height / 2u * width + width / 2u) * bpp;
+
+  unsigned char *dataA = imageA.Data<unsigned char>();
+  EXPECT_GT(dataA[mid + 1], dataA[mid]);
+  EXPECT_GT(dataA[mid + 1], dataA[mid + 2]);
+
+  unsigned char *dataB = imageB.Data<unsigned char>();
+  EXPECT_GT(dataB[mid], dataB[mid + 1]);
+  EXPECT_GT(dataB[mid], dataB[mid + 2]);
+
+  // nothing to render
+  scene->RenderSensors({});
+
+  // warming up shaders must not change what the sensors see
+  unsigned char before = dataA[mid + 1];
+  scene->WarmUpShaders();
+  cameraA->Copy(imageA);
+  EXPECT_EQ(before, imageA.Data<unsigned char>()[mid + 1]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RenderCameraAtlas))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0, 0, 0);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetAmbient(0.0, 1.0, 0.0);
+  green->SetDiffuse(0.0, 1.0, 0.0);
+  VisualPtr visualA = scene->CreateVisual();
+  visualA->AddGeometry(scene->CreateBox());
+  visualA->SetVisibilityFlags(0x01);
+  visualA->SetMaterial(green);
+  root->AddChild(visualA);
+
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  VisualPtr visualB = scene->CreateVisual();
+  visualB->AddGeometry(scene->CreateBox());
+  visualB->SetVisibilityFlags(0x02);
+  visualB->SetMaterial(red);
+  root->AddChild(visualB);
+
+  // a swarm of small cameras of different sizes, even ones see the green
+  // box and odd ones the red box
+  const unsigned int cameraCount = 12u;
+  std::vector<CameraPtr> cameras;
+  for (unsigned int i = 0; i < cameraCount; ++i)
+  {
+    CameraPtr camera = scene->CreateCamera();
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(i % 3u == 0u ? 160u : 64u);
+    camera->SetImageHeight(i % 3u == 0u ? 120u : 64u);
+    camera->SetWorldPosition(-1, 0, 0);
+    camera->SetVisibilityMask(i % 2u == 0u ? 0x01 : 0x02);
+    root->AddChild(camera);
+    cameras.push_back(camera);
+  }
+
+  std::vector<unsigned int> calls(cameraCount, 0u);
+  scene->RenderCameraAtlas(cameras,
+      [&](unsigned int _index, const FrameView &_view)
+      {
+        ASSERT_LT(_index, cameraCount);
+        ++calls[_index];
+        ASSERT_TRUE(_view);
+        EXPECT_EQ(cameras[_index]->ImageWidth(), _view.width);
+        EXPECT_EQ(cameras[_index]->ImageHeight(), _view.height);
+
+        unsigned int bpp = PixelUtil::BytesPerPixel(_view.format);
+        ASSERT_GE(bpp, 3u);
+        EXPECT_GE(_view.rowPitch, _view.width * bpp);
+
+        const unsigned char *pixel =
+            _view.Row<unsigned char>(_view.height / 2u) +
+            _view.width / 2u * bpp;
+        if (_index % 2u == 0u)
+        {
+          EXPECT_GT(pixel[1], pixel[0]);
+          EXPECT_GT(pixel[1], pixel[2]);
+        }
+        else
+        {
+          EXPECT_GT(pixel[0], pixel[1]);
+          EXPECT_GT(pixel[0], pixel[2]);
+        }
+      });
+
+  for (unsigned int i = 0; i < cameraCount; ++i)
+    EXPECT_EQ(1u, calls[i]) << i;
+
+  // nothing to render
+  scene->RenderCameraAtlas({},
+      [](unsigned int, const FrameView &)
+      {
+        FAIL() << "No camera was rendered";
+      });
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RenderEnvironments))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0, 0, 0);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetAmbient(0.0, 1.0, 0.0);
+  green->SetDiffuse(0.0, 1.0, 0.0);
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+
+  // all environments overlap at the origin, even ones hold a green box
+  // and odd ones a red box
+  const unsigned int envCount = 6u;
+  std::vector<VisualPtr> environments;
+  std::vector<CameraPtr> cameras;
+  for (unsigned int i = 0; i < envCount; ++i)
+  {
+    VisualPtr environment = scene->CreateVisual();
+    root->AddChild(environment);
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetMaterial(i % 2u == 0u ? green : red);
+    environment->AddChild(box);
+    environments.push_back(environment);
+
+    CameraPtr camera = scene->CreateCamera();
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(64u);
+    camera->SetImageHeight(64u);
+    camera->SetWorldPosition(-1, 0, 0);
+    root->AddChild(camera);
+    cameras.push_back(camera);
+  }
+  environments[1]->SetVisible(false);
+
+  std::vector<unsigned int> calls(envCount, 0u);
+  scene->RenderEnvironments(environments, cameras,
+      [&](unsigned int _index, const FrameView &_view)
+      {
+        ASSERT_LT(_index, envCount);
+        ++calls[_index];
+        ASSERT_TRUE(_view);
+
+        unsigned int bpp = PixelUtil::BytesPerPixel(_view.format);
+        ASSERT_GE(bpp, 3u);
+        const unsigned char *pixel =
+            _view.Row<unsigned char>(_view.height / 2u) +
+            _view.width / 2u * bpp;
+        if (_index == 1u)
+        {
+          // hidden environment, only the background is seen
+          EXPECT_EQ(0u, pixel[0]);
+          EXPECT_EQ(0u, pixel[1]);
+        }
+        else if (_index % 2u == 0u)
+        {
+          EXPECT_GT(pixel[1], pixel[0]) << _index;
+          EXPECT_EQ(0u, pixel[2]) << _index;
+        }
+        else
+        {
+          EXPECT_GT(pixel[0], pixel[1]) << _index;
+          EXPECT_EQ(0u, pixel[2]) << _index;
+        }
+      });
+
+  for (unsigned int i = 0; i < envCount; ++i)
+    EXPECT_EQ(1u, calls[i]) << i;
+
+  // visibility is restored
+  EXPECT_TRUE(environments[0]->Visible());
+  EXPECT_FALSE(environments[1]->Visible());
+
+  // one camera per environment is required
+  environments.pop_back();
+  scene->RenderEnvironments(environments, cameras,
+      [](unsigned int, const FrameView &)
+      {
+        FAIL() << "Mismatched lists must not be rendered";
+      });
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ShaderSelection))
 {
@@ -814,3 +1158,270 @@ TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(AspectRatioTest))
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(BayerCapture))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.2, 0.4, 0.6);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  // a box with a different value in every channel
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetWorldPosition(0.0, 0.0, 0.0);
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(0.9, 0.5, 0.1);
+  material->SetDiffuse(0.9, 0.5, 0.1);
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  // two cameras looking at the same view, one captures color images and
+  // the other Bayer images
+  CameraPtr colorCamera = scene->CreateCamera();
+  ASSERT_NE(nullptr, colorCamera);
+  colorCamera->SetWorldPosition(-2, 0, 0);
+  colorCamera->SetImageWidth(64);
+  colorCamera->SetImageHeight(48);
+  colorCamera->SetImageFormat(PF_R8G8B8);
+  root->AddChild(colorCamera);
+
+  CameraPtr bayerCamera = scene->CreateCamera();
+  ASSERT_NE(nullptr, bayerCamera);
+  bayerCamera->SetWorldPosition(-2, 0, 0);
+  bayerCamera->SetImageWidth(64);
+  bayerCamera->SetImageHeight(48);
+  root->AddChild(bayerCamera);
+
+  Image colorImage = colorCamera->CreateImage();
+  colorCamera->Capture(colorImage);
+
+  for (PixelFormat format : {PF_BAYER_RGGB8, PF_BAYER_BGGR8,
+      PF_BAYER_GBRG8, PF_BAYER_GRBG8})
+  {
+    bayerCamera->SetImageFormat(format);
+    Image bayerImage = bayerCamera->CreateImage();
+    bayerCamera->Capture(bayerImage);
+
+    // the GPU conversion must match the CPU conversion
+    Image expected = convertRGBToBayer(colorImage, format);
+    unsigned char *data = bayerImage.Data<unsigned char>();
+    unsigned char *expectedData = expected.Data<unsigned char>();
+    unsigned int mismatches = 0u;
+    for (unsigned int i = 0u; i < 64u * 48u; ++i)
+    {
+      if (std::abs(static_cast<int>(data[i]) -
+          static_cast<int>(expectedData[i])) > 1)
+      {
+        ++mismatches;
+      }
+    }
+    EXPECT_EQ(0u, mismatches) << "format " << format;
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CaptureAsync))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.2, 0.4, 0.6);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(0.9, 0.5, 0.1);
+  material->SetDiffuse(0.9, 0.5, 0.1);
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetWorldPosition(-2, 0, 0);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(48);
+  camera->SetImageFormat(PF_R8G8B8);
+  root->AddChild(camera);
+
+  Image expected = camera->CreateImage();
+  camera->Capture(expected);
+
+  // keep several captures in flight before accessing them
+  std::vector<Image> images;
+  std::vector<std::future<bool>> frames;
+  images.reserve(3u);
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    images.push_back(camera->CreateImage());
+    frames.push_back(camera->CaptureAsync(images.back()));
+  }
+
+  // the scene is static so every frame matches the synchronous capture
+  unsigned int size = camera->ImageMemorySize();
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    EXPECT_TRUE(frames[i].get());
+    EXPECT_EQ(0, memcmp(expected.Data(), images[i].Data(), size));
+  }
+
+  // a pending capture fails once the camera is gone
+  Image pendingImage = camera->CreateImage();
+  std::future<bool> pending = camera->CaptureAsync(pendingImage);
+  scene->DestroySensor(camera);
+  if (engine->Name() == "ogre2")
+    EXPECT_FALSE(pending.get());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ReadbackRegion))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.2, 0.4, 0.6);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(0.9, 0.5, 0.1);
+  material->SetDiffuse(0.9, 0.5, 0.1);
+  box->SetMaterial(material);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetWorldPosition(-2, 0, 0);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(48);
+  camera->SetImageFormat(PF_R8G8B8);
+  root->AddChild(camera);
+
+  Image full = camera->CreateImage();
+  camera->Capture(full);
+
+  // regions that do not fit in the image are rejected
+  camera->SetReadbackRegion(math::Vector2i(60, 0), math::Vector2i(8, 8));
+  EXPECT_EQ(math::Vector2i::Zero, camera->ReadbackRegionSize());
+
+  const math::Vector2i offset(10, 20);
+  const math::Vector2i regionSize(16, 8);
+  camera->SetReadbackRegion(offset, regionSize);
+  EXPECT_EQ(offset, camera->ReadbackRegionOffset());
+  EXPECT_EQ(regionSize, camera->ReadbackRegionSize());
+
+  Image region = camera->CreateImage();
+  EXPECT_EQ(16u, region.Width());
+  EXPECT_EQ(8u, region.Height());
+  Image asyncRegion = camera->CreateImage();
+  camera->Copy(region);
+  std::future<bool> frame = camera->CaptureAsync(asyncRegion);
+  EXPECT_TRUE(frame.get());
+
+  // the region matches the same pixels of the full image
+  const unsigned int bpp = PixelUtil::BytesPerPixel(PF_R8G8B8);
+  const unsigned char *fullData = full.Data<unsigned char>();
+  for (unsigned int y = 0u; y < region.Height(); ++y)
+  {
+    const unsigned char *src =
+        fullData + ((y + 20u) * full.Width() + 10u) * bpp;
+    EXPECT_EQ(0, memcmp(src,
+        region.Data<unsigned char>() + y * region.Width() * bpp,
+        region.Width() * bpp));
+    EXPECT_EQ(0, memcmp(src,
+        asyncRegion.Data<unsigned char>() + y * region.Width() * bpp,
+        region.Width() * bpp));
+  }
+
+  // a zero size reads back the full image again
+  camera->SetReadbackRegion(math::Vector2i::Zero, math::Vector2i::Zero);
+  EXPECT_EQ(64u, camera->CreateImage().Width());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(AntiAliasingMode))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.2, 0.4, 0.6);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  // a rotated box has diagonal edges that alias without anti-aliasing
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(0.9, 0.5, 0.1);
+  material->SetDiffuse(0.9, 0.5, 0.1);
+  box->SetMaterial(material);
+  box->SetLocalRotation(0.4, 0.0, 0.4);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetWorldPosition(-3, 0, 0);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(48);
+  camera->SetImageFormat(PF_R8G8B8);
+  root->AddChild(camera);
+  EXPECT_EQ(CAAM_MSAA, camera->AntiAliasingMode());
+
+  auto colorCount = [](const Image &_image)
+  {
+    std::set<unsigned int> colors;
+    const unsigned char *data = _image.Data<unsigned char>();
+    for (unsigned int i = 0u; i < _image.Width() * _image.Height(); ++i)
+    {
+      colors.insert(data[i * 3u] | (data[i * 3u + 1u] << 8u) |
+          (data[i * 3u + 2u] << 16u));
+    }
+    return colors.size();
+  };
+
+  camera->SetAntiAliasingMode(CAAM_NONE);
+  EXPECT_EQ(CAAM_NONE, camera->AntiAliasingMode());
+  Image aliased = camera->CreateImage();
+  camera->Capture(aliased);
+
+  // the MSAA level is ignored unless the mode is CAAM_MSAA
+  camera->SetAntiAliasing(4u);
+  Image noSamples = camera->CreateImage();
+  camera->Capture(noSamples);
+  EXPECT_EQ(0, memcmp(aliased.Data<unsigned char>(),
+      noSamples.Data<unsigned char>(), aliased.MemorySize()));
+
+  // FXAA blends the pixels of the edges
+  camera->SetAntiAliasingMode(CAAM_FXAA);
+  EXPECT_EQ(CAAM_FXAA, camera->AntiAliasingMode());
+  Image smoothed = camera->CreateImage();
+  camera->Capture(smoothed);
+  EXPECT_NE(0, memcmp(aliased.Data<unsigned char>(),
+      smoothed.Data<unsigned char>(), aliased.MemorySize()));
+  EXPECT_GT(colorCount(smoothed), colorCount(aliased));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -16,7 +16,9 @@
 */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <string>
+#include <vector>
 
 #include "CommonRenderingTest.hh"
 
@@ -856,3 +858,640 @@ TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraProjection))
 
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraZoom))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  int imgWidth = 256;
+  int imgHeight = 256;
+
+  double unitBoxSize = 1.0;
+  gz::math::Vector3d boxPosition(1.8, 0.0, 0.0);
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(boxPosition);
+  box->SetLocalScale(unitBoxSize, unitBoxSize, unitBoxSize);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(100.0);
+    depthCamera->SetNearClipPlane(0.01);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.5);
+    depthCamera->CreateDepthTexture();
+    scene->RootVisual()->AddChild(depthCamera);
+
+    float *scan = new float[imgHeight * imgWidth];
+    gz::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, scan,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+
+    auto countBoxValues = [&]()
+    {
+      float expectedRange = boxPosition.X() - unitBoxSize * 0.5;
+      unsigned int count = 0u;
+      for (int i = 0; i < imgHeight * imgWidth; ++i)
+      {
+        if (gz::math::equal(expectedRange, scan[i]))
+          ++count;
+      }
+      return count;
+    };
+
+    g_depthCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(1u, g_depthCounter);
+    unsigned int wideBoxValues = countBoxValues();
+    EXPECT_LT(0u, wideBoxValues);
+    EXPECT_GT(static_cast<unsigned int>(imgWidth * imgHeight), wideBoxValues);
+
+    // zooming in after the first frame makes the box fill the image
+    depthCamera->SetHFOV(0.5);
+    depthCamera->Update();
+    EXPECT_EQ(2u, g_depthCounter);
+    EXPECT_EQ(static_cast<unsigned int>(imgWidth * imgHeight),
+        countBoxValues());
+
+    // moving the far plane in front of the box leaves nothing in range
+    depthCamera->SetFarClipPlane(1.0);
+    depthCamera->Update();
+    EXPECT_EQ(3u, g_depthCounter);
+    for (int i = 0; i < imgHeight * imgWidth; ++i)
+      EXPECT_TRUE(std::isinf(scan[i])) << scan[i];
+
+    // and zooming out again brings the first frame back
+    depthCamera->SetFarClipPlane(100.0);
+    depthCamera->SetHFOV(1.5);
+    depthCamera->Update();
+    EXPECT_EQ(4u, g_depthCounter);
+    EXPECT_EQ(wideBoxValues, countBoxValues());
+
+    connection.reset();
+    delete [] scan;
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraAsyncReadback))
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  double unitBoxSize = 1.0;
+  gz::math::Vector3d boxPosition(1.8, 0.0, 0.0);
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // Create an scene with a box in it
+  gz::rendering::VisualPtr root = scene->RootVisual();
+
+  // create box visual
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(boxPosition);
+  box->SetLocalScale(unitBoxSize, unitBoxSize, unitBoxSize);
+  root->AddChild(box);
+  {
+    // Create depth camera
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+
+    // synchronous readback by default
+    EXPECT_EQ(1u, depthCamera->ReadbackBufferCount());
+    depthCamera->SetReadbackBufferCount(2u);
+    EXPECT_EQ(2u, depthCamera->ReadbackBufferCount());
+
+    depthCamera->CreateDepthTexture();
+    scene->RootVisual()->AddChild(depthCamera);
+
+    float *scan = new float[imgHeight * imgWidth];
+    gz::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, scan,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+
+    // with two readback buffers frames are delivered one update late
+    g_depthCounter = 0u;
+    auto firstFrameTime = scene->Time();
+    depthCamera->Update();
+    EXPECT_EQ(0u, g_depthCounter);
+
+    scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+    depthCamera->Update();
+    EXPECT_EQ(1u, g_depthCounter);
+    EXPECT_EQ(firstFrameTime, depthCamera->DepthDataTime());
+
+    // verify the delayed frame contains valid depth data
+    float expectedRange = boxPosition.X() - unitBoxSize * 0.5;
+    unsigned int mid = imgHeight / 2 * imgWidth + imgWidth / 2;
+    EXPECT_NEAR(expectedRange, scan[mid], DEPTH_TOL);
+
+    scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+    depthCamera->Update();
+    EXPECT_EQ(2u, g_depthCounter);
+    EXPECT_EQ(firstFrameTime + std::chrono::milliseconds(16),
+        depthCamera->DepthDataTime());
+
+    // switching back to synchronous readback delivers frames immediately
+    depthCamera->SetReadbackBufferCount(1u);
+    scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+    depthCamera->Update();
+    EXPECT_EQ(3u, g_depthCounter);
+    EXPECT_EQ(scene->Time(), depthCamera->DepthDataTime());
+    EXPECT_NEAR(expectedRange, scan[mid], DEPTH_TOL);
+
+    // Clean up
+    connection.reset();
+    delete [] scan;
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraFrameView))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+
+    // copy the depth channel out of the view while it is valid
+    std::vector<float> viewDepth;
+    unsigned int viewCounter = 0u;
+    gz::common::ConnectionPtr viewConnection =
+      depthCamera->ConnectNewFrameView(
+          [&](const gz::rendering::FrameView &_view)
+          {
+            EXPECT_TRUE(_view);
+            EXPECT_EQ(imgWidth, _view.width);
+            EXPECT_EQ(imgHeight, _view.height);
+            EXPECT_EQ(gz::rendering::PF_FLOAT32_RGBA, _view.format);
+            EXPECT_LE(_view.width * 4u * sizeof(float), _view.rowPitch);
+            viewDepth.clear();
+            for (unsigned int i = 0; i < _view.height; ++i)
+            {
+              const float *row = _view.Row<float>(i);
+              for (unsigned int j = 0; j < _view.width; ++j)
+                viewDepth.push_back(row[j * 4u]);
+            }
+            viewCounter++;
+          });
+    ASSERT_NE(nullptr, viewConnection);
+
+    float *scan = new float[imgHeight * imgWidth];
+    gz::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, scan,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+
+    g_depthCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(1u, viewCounter);
+    EXPECT_EQ(1u, g_depthCounter);
+
+    // the view and the legacy depth frame should contain the same data
+    ASSERT_EQ(imgWidth * imgHeight, viewDepth.size());
+    for (unsigned int i = 0; i < viewDepth.size(); ++i)
+    {
+      if (std::isinf(scan[i]))
+        EXPECT_TRUE(std::isinf(viewDepth[i]));
+      else
+        EXPECT_FLOAT_EQ(scan[i], viewDepth[i]);
+    }
+
+    // with only view listeners the legacy depth frame is not emitted
+    connection.reset();
+    depthCamera->Update();
+    EXPECT_EQ(2u, viewCounter);
+    EXPECT_EQ(1u, g_depthCounter);
+
+    viewConnection.reset();
+    delete [] scan;
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraPackedPointCloud))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // a box that only covers part of the image so the rest is out of range
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+
+    std::vector<float> rgbCloud;
+    gz::common::ConnectionPtr rgbConnection =
+      depthCamera->ConnectNewRgbPointCloud(
+          [&](const float *_data, unsigned int _width, unsigned int _height,
+              unsigned int _channels, const std::string &)
+          {
+            rgbCloud.assign(_data, _data + _width * _height * _channels);
+          });
+
+    std::vector<gz::rendering::PackedPoint> packed;
+    unsigned int packedWidth = 0u;
+    unsigned int packedHeight = 0u;
+    gz::common::ConnectionPtr packedConnection =
+      depthCamera->ConnectNewPackedPointCloud(
+          [&](const gz::rendering::PackedPoint *_points, unsigned int _count,
+              unsigned int _width, unsigned int _height)
+          {
+            packed.assign(_points, _points + _count);
+            packedWidth = _width;
+            packedHeight = _height;
+          });
+    ASSERT_NE(nullptr, packedConnection);
+
+    // organized by default, same points as the rgb point cloud
+    EXPECT_FALSE(depthCamera->PackedPointCloudFilterInvalid());
+    depthCamera->Update();
+    ASSERT_EQ(imgWidth * imgHeight, packed.size());
+    ASSERT_EQ(imgWidth * imgHeight * 4u, rgbCloud.size());
+    EXPECT_EQ(imgWidth, packedWidth);
+    EXPECT_EQ(imgHeight, packedHeight);
+    unsigned int validCount = 0u;
+    for (unsigned int i = 0; i < packed.size(); ++i)
+    {
+      if (!std::isfinite(rgbCloud[i * 4u]) ||
+          !std::isfinite(rgbCloud[i * 4u + 1u]) ||
+          !std::isfinite(rgbCloud[i * 4u + 2u]))
+      {
+        continue;
+      }
+      EXPECT_FLOAT_EQ(rgbCloud[i * 4u], packed[i].x);
+      EXPECT_FLOAT_EQ(rgbCloud[i * 4u + 1u], packed[i].y);
+      EXPECT_FLOAT_EQ(rgbCloud[i * 4u + 2u], packed[i].z);
+      validCount++;
+    }
+    EXPECT_LT(0u, validCount);
+    EXPECT_GT(imgWidth * imgHeight, validCount);
+
+    // filtering drops the out of range points
+    depthCamera->SetPackedPointCloudFilterInvalid(true);
+    EXPECT_TRUE(depthCamera->PackedPointCloudFilterInvalid());
+    depthCamera->Update();
+    EXPECT_EQ(validCount, packed.size());
+    EXPECT_EQ(validCount, packedWidth);
+    EXPECT_EQ(1u, packedHeight);
+    for (const auto &point : packed)
+    {
+      EXPECT_TRUE(std::isfinite(point.x));
+      EXPECT_TRUE(std::isfinite(point.y));
+      EXPECT_TRUE(std::isfinite(point.z));
+    }
+
+    packedConnection.reset();
+    rgbConnection.reset();
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraRgbFrame))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(0.0, 0.0, 1.0);
+
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  gz::rendering::MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  box->SetMaterial(red);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+
+    std::vector<gz::rendering::PackedPoint> packed;
+    gz::common::ConnectionPtr packedConnection =
+      depthCamera->ConnectNewPackedPointCloud(
+          [&](const gz::rendering::PackedPoint *_points, unsigned int _count,
+              unsigned int, unsigned int)
+          {
+            packed.assign(_points, _points + _count);
+          });
+
+    std::vector<unsigned char> image;
+    unsigned int channels = 0u;
+    std::string format;
+    gz::common::ConnectionPtr rgbConnection =
+      depthCamera->ConnectNewRgbFrame(
+          [&](const void *_data, unsigned int _width, unsigned int _height,
+              unsigned int _channels, const std::string &_format)
+          {
+            const unsigned char *data =
+                static_cast<const unsigned char *>(_data);
+            image.assign(data, data + _width * _height * _channels);
+            channels = _channels;
+            format = _format;
+          });
+    ASSERT_NE(nullptr, rgbConnection);
+
+    // the image has the colors of the point cloud, from the same render
+    EXPECT_EQ(gz::rendering::PF_R8G8B8, depthCamera->RgbFrameFormat());
+    depthCamera->Update();
+    ASSERT_EQ(imgWidth * imgHeight, packed.size());
+    ASSERT_EQ(imgWidth * imgHeight * 3u, image.size());
+    EXPECT_EQ(3u, channels);
+    EXPECT_EQ("PF_R8G8B8", format);
+    for (unsigned int i = 0; i < packed.size(); ++i)
+    {
+      EXPECT_EQ(packed[i].r, image[i * 3u]);
+      EXPECT_EQ(packed[i].g, image[i * 3u + 1u]);
+      EXPECT_EQ(packed[i].b, image[i * 3u + 2u]);
+    }
+
+    // red box in the middle, blue background in the corner
+    unsigned int mid = (imgHeight / 2u * imgWidth + imgWidth / 2u) * 3u;
+    EXPECT_GT(image[mid], image[mid + 2u]);
+    EXPECT_LT(image[0], image[2]);
+
+    // swapped channels
+    std::vector<unsigned char> rgb = image;
+    depthCamera->SetRgbFrameFormat(gz::rendering::PF_B8G8R8);
+    EXPECT_EQ(gz::rendering::PF_B8G8R8, depthCamera->RgbFrameFormat());
+    depthCamera->Update();
+    ASSERT_EQ(rgb.size(), image.size());
+    EXPECT_EQ("PF_B8G8R8", format);
+    for (unsigned int i = 0; i < rgb.size(); i += 3u)
+    {
+      EXPECT_EQ(rgb[i], image[i + 2u]);
+      EXPECT_EQ(rgb[i + 2u], image[i]);
+    }
+
+    // formats that are not 8 bit color are rejected
+    depthCamera->SetRgbFrameFormat(gz::rendering::PF_FLOAT32_R);
+    EXPECT_EQ(gz::rendering::PF_B8G8R8, depthCamera->RgbFrameFormat());
+
+    rgbConnection.reset();
+    packedConnection.reset();
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraOutputFormat))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // the box face is 1.3 m away from the camera
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+
+    EXPECT_EQ(gz::rendering::DCOF_DEPTH_FLOAT32, depthCamera->OutputFormat());
+
+    // copy the center and corner pixels out of the view while it is valid
+    gz::rendering::PixelFormat viewFormat = gz::rendering::PF_UNKNOWN;
+    uint16_t centerMm = 0u;
+    uint16_t cornerMm = 1u;
+    unsigned int viewCounter = 0u;
+    gz::common::ConnectionPtr viewConnection =
+      depthCamera->ConnectNewFrameView(
+          [&](const gz::rendering::FrameView &_view)
+          {
+            EXPECT_EQ(imgWidth, _view.width);
+            EXPECT_EQ(imgHeight, _view.height);
+            viewFormat = _view.format;
+            if (_view.format == gz::rendering::PF_L16)
+            {
+              EXPECT_LE(_view.width * sizeof(uint16_t), _view.rowPitch);
+              centerMm = _view.Row<uint16_t>(imgHeight / 2u)[imgWidth / 2u];
+              cornerMm = _view.Row<uint16_t>(0u)[0u];
+            }
+            viewCounter++;
+          });
+    ASSERT_NE(nullptr, viewConnection);
+
+    // millimetre depth, out of range pixels are 0
+    depthCamera->SetOutputFormat(gz::rendering::DCOF_DEPTH_UINT16_MM);
+    EXPECT_EQ(gz::rendering::DCOF_DEPTH_UINT16_MM,
+        depthCamera->OutputFormat());
+    depthCamera->Update();
+    EXPECT_EQ(1u, viewCounter);
+    EXPECT_EQ(gz::rendering::PF_L16, viewFormat);
+    EXPECT_NEAR(1300.0, centerMm, 1.0);
+    EXPECT_EQ(0u, cornerMm);
+
+    // the float32 depth frame is still available alongside
+    float *scan = new float[imgHeight * imgWidth];
+    gz::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, scan,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+    g_depthCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(2u, viewCounter);
+    EXPECT_EQ(1u, g_depthCounter);
+    unsigned int mid = imgHeight / 2u * imgWidth + imgWidth / 2u;
+    EXPECT_NEAR(scan[mid] * 1000.0, centerMm, 1.0);
+    connection.reset();
+
+    depthCamera->SetOutputFormat(gz::rendering::DCOF_DEPTH_FLOAT16);
+    depthCamera->Update();
+    EXPECT_EQ(3u, viewCounter);
+    EXPECT_EQ(gz::rendering::PF_FLOAT16_R, viewFormat);
+
+    // back to float32 views of the point cloud texture
+    depthCamera->SetOutputFormat(gz::rendering::DCOF_DEPTH_FLOAT32);
+    depthCamera->Update();
+    EXPECT_EQ(4u, viewCounter);
+    EXPECT_EQ(gz::rendering::PF_FLOAT32_RGBA, viewFormat);
+
+    viewConnection.reset();
+    delete [] scan;
+  }
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest,
+    GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraReleaseRenderTextures))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 64;
+  unsigned int imgHeight = 64;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  root->AddChild(box);
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(10.0);
+    depthCamera->SetNearClipPlane(0.15);
+    depthCamera->SetAspectRatio(1.0);
+    depthCamera->SetHFOV(1.05);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+
+    float *scan = new float[imgHeight * imgWidth];
+    gz::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, scan,
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+
+    g_depthCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(1u, g_depthCounter);
+    const unsigned int mid = imgHeight / 2u * imgWidth + imgWidth / 2u;
+    const float midDepth = scan[mid];
+    EXPECT_NEAR(1.3f, midDepth, 0.01f);
+
+    // release the textures, they are allocated again on the next update
+    EXPECT_TRUE(depthCamera->ReleaseRenderTextures());
+    EXPECT_FALSE(depthCamera->ReleaseRenderTextures());
+    depthCamera->Update();
+    EXPECT_EQ(2u, g_depthCounter);
+    EXPECT_FLOAT_EQ(midDepth, scan[mid]);
+
+    // sensors that were not rendered for long enough are released
+    scene->SetTime(std::chrono::seconds(1));
+    depthCamera->Update();
+    EXPECT_EQ(0u, scene->ReleaseSensorRenderTextures(std::chrono::seconds(1)));
+    scene->SetTime(std::chrono::seconds(3));
+    EXPECT_EQ(1u, scene->ReleaseSensorRenderTextures(std::chrono::seconds(1)));
+    EXPECT_FALSE(depthCamera->ReleaseRenderTextures());
+
+    // automatic release when a frame ends
+    scene->SetSensorReleaseTime(std::chrono::seconds(1));
+    EXPECT_EQ(std::chrono::steady_clock::duration(std::chrono::seconds(1)),
+        scene->SensorReleaseTime());
+    depthCamera->Update();
+    EXPECT_EQ(4u, g_depthCounter);
+    EXPECT_FLOAT_EQ(midDepth, scan[mid]);
+    scene->SetTime(std::chrono::seconds(5));
+    scene->PreRender();
+    scene->PostRender();
+    EXPECT_FALSE(depthCamera->ReleaseRenderTextures());
+
+    connection.reset();
+    delete [] scan;
+  }
+
+  engine->DestroyScene(scene);
+}
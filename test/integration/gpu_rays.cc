@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Image.hh>
@@ -777,6 +780,582 @@ TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SingleRay))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+/// \brief Test asynchronous readback of GPU rays data
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(AsyncReadback))
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  const double minRange = 0.05;
+  const double maxRange = 40.0;
+  const int hRayCount = 1;
+  const int vRayCount = 1;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // ray above a box looking downwards
+  gz::math::Pose3d testPose(gz::math::Vector3d(0, 0, 7),
+      gz::math::Quaterniond(0, GZ_PI/2.0, 0));
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetWorldPosition(testPose.Pos());
+  gpuRays->SetWorldRotation(testPose.Rot());
+  gpuRays->SetNearClipPlane(minRange);
+  gpuRays->SetFarClipPlane(maxRange);
+  gpuRays->SetAngleMin(0.0);
+  gpuRays->SetAngleMax(0.0);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  // synchronous readback by default
+  EXPECT_EQ(1u, gpuRays->ReadbackBufferCount());
+  gpuRays->SetReadbackBufferCount(2u);
+  EXPECT_EQ(2u, gpuRays->ReadbackBufferCount());
+
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(0, 0, 4.5);
+  root->AddChild(visualBox1);
+
+  unsigned int channels = gpuRays->Channels();
+  float *scan = new float[hRayCount * vRayCount * channels];
+  unsigned int frameCount = 0u;
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&](const float *_scan, unsigned int _width, unsigned int _height,
+            unsigned int _channels, const std::string &_format)
+        {
+          OnNewGpuRaysFrame(scan, _scan, _width, _height, _channels,
+              _format);
+          ++frameCount;
+        });
+
+  // with two readback buffers frames are delivered one update late
+  auto firstFrameTime = scene->Time();
+  gpuRays->Update();
+  EXPECT_EQ(0u, frameCount);
+
+  scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+  gpuRays->Update();
+  EXPECT_EQ(1u, frameCount);
+  EXPECT_EQ(firstFrameTime, gpuRays->DataTime());
+
+  double expectedRange = testPose.Pos().Z() - (4.5 + 0.5);
+  EXPECT_NEAR(scan[0], expectedRange, LASER_TOL);
+
+  // switching back to synchronous readback delivers frames immediately
+  gpuRays->SetReadbackBufferCount(1u);
+  scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+  gpuRays->Update();
+  EXPECT_EQ(2u, frameCount);
+  EXPECT_EQ(scene->Time(), gpuRays->DataTime());
+  EXPECT_NEAR(scan[0], expectedRange, LASER_TOL);
+
+  c.reset();
+  delete [] scan;
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test that leased data is not overwritten by later frames
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(AcquireData))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // ray above a box looking downwards
+  gz::math::Pose3d testPose(gz::math::Vector3d(0, 0, 7),
+      gz::math::Quaterniond(0, GZ_PI/2.0, 0));
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetWorldPosition(testPose.Pos());
+  gpuRays->SetWorldRotation(testPose.Rot());
+  gpuRays->SetNearClipPlane(0.05);
+  gpuRays->SetFarClipPlane(40.0);
+  gpuRays->SetAngleMin(0.0);
+  gpuRays->SetAngleMax(0.0);
+  gpuRays->SetRayCount(1);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(0, 0, 4.5);
+  root->AddChild(visualBox1);
+
+  // no frame yet
+  EXPECT_EQ(nullptr, gpuRays->AcquireData());
+
+  gpuRays->Update();
+  std::shared_ptr<const float> lease = gpuRays->AcquireData();
+  ASSERT_NE(nullptr, lease);
+  EXPECT_EQ(gpuRays->Data(), lease.get());
+  double expectedRange = testPose.Pos().Z() - (4.5 + 0.5);
+  EXPECT_NEAR(lease.get()[0], expectedRange, LASER_TOL);
+
+  // the next frame goes into another buffer while the lease is held
+  visualBox1->SetWorldPosition(0, 0, 2.5);
+  gpuRays->Update();
+  EXPECT_NE(gpuRays->Data(), lease.get());
+  EXPECT_NEAR(lease.get()[0], expectedRange, LASER_TOL);
+  EXPECT_NEAR(gpuRays->Data()[0], expectedRange + 2.0, LASER_TOL);
+
+  lease.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test compact GPU rays output formats
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(OutputFormat))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const double minRange = 0.05;
+  const double maxRange = 40.0;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // single ray looking down at a box
+  gz::math::Pose3d testPose(gz::math::Vector3d(0, 0, 7),
+      gz::math::Quaterniond(0, GZ_PI/2.0, 0));
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetWorldPosition(testPose.Pos());
+  gpuRays->SetWorldRotation(testPose.Rot());
+  gpuRays->SetNearClipPlane(minRange);
+  gpuRays->SetFarClipPlane(maxRange);
+  gpuRays->SetAngleMin(0.0);
+  gpuRays->SetAngleMax(0.0);
+  gpuRays->SetRayCount(1);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(0, 0, 4.5);
+  root->AddChild(visualBox1);
+
+  const double expectedRange = 2.0;
+
+  EXPECT_EQ(GROF_RANGE_RETRO_FLOAT32, gpuRays->OutputFormat());
+  EXPECT_EQ(3u, gpuRays->Channels());
+
+  // range only float32 data is still available through the legacy api
+  gpuRays->SetOutputFormat(GROF_RANGE_FLOAT32);
+  EXPECT_EQ(GROF_RANGE_FLOAT32, gpuRays->OutputFormat());
+  EXPECT_EQ(1u, gpuRays->Channels());
+
+  float scan[1] = {0.0f};
+  std::string format;
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&scan, &format](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &_format)
+        {
+          EXPECT_EQ(1u, _width * _height * _channels);
+          scan[0] = _scan[0];
+          format = _format;
+        });
+  gpuRays->Update();
+  EXPECT_NEAR(expectedRange, scan[0], LASER_TOL);
+  EXPECT_EQ("PF_FLOAT32_R", format);
+  c.reset();
+
+  // compact formats are delivered through frame views
+  FrameView lastView;
+  uint16_t rangeMm = 0u;
+  common::ConnectionPtr v = gpuRays->ConnectNewFrameView(
+      [&](const FrameView &_view)
+      {
+        // the data is only valid during the callback
+        lastView = _view;
+        if (_view.format == PF_L16)
+          rangeMm = _view.Row<uint16_t>(0u)[0];
+      });
+  ASSERT_NE(nullptr, v);
+
+  gpuRays->SetOutputFormat(GROF_RANGE_UINT16_MM);
+  EXPECT_EQ(1u, gpuRays->Channels());
+  gpuRays->Update();
+  EXPECT_EQ(PF_L16, lastView.format);
+  EXPECT_EQ(1u, lastView.width);
+  EXPECT_EQ(1u, lastView.height);
+  EXPECT_NEAR(expectedRange * 1000.0, rangeMm, 1.0);
+
+  gpuRays->SetOutputFormat(GROF_RANGE_RETRO_FLOAT16);
+  EXPECT_EQ(2u, gpuRays->Channels());
+  gpuRays->Update();
+  EXPECT_EQ(PF_FLOAT16_RG, lastView.format);
+  EXPECT_EQ(1u, lastView.width);
+  v.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test GPU rays cast along a scan pattern
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ScanPattern))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.05);
+  gpuRays->SetFarClipPlane(40.0);
+  gpuRays->SetAngleMin(-0.5);
+  gpuRays->SetAngleMax(0.5);
+  gpuRays->SetRayCount(10);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  // box in front of the sensor, its face is 1.5 m away
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(2, 0, 0);
+  root->AddChild(visualBox1);
+
+  // invalid patterns are rejected
+  gpuRays->SetRayDirections(std::vector<math::Vector2d>(3), 2u);
+  EXPECT_TRUE(gpuRays->RayDirections().empty());
+  EXPECT_EQ(10, gpuRays->RangeCount());
+
+  // 3 rays hitting the box and one looking backwards, on 2 rows
+  std::vector<math::Vector2d> pattern = {
+      {0.0, 0.0}, {GZ_PI, 0.0},
+      {0.1, 0.2}, {-0.2, -0.1}};
+  gpuRays->SetRayDirections(pattern, 2u);
+  EXPECT_EQ(pattern, gpuRays->RayDirections());
+  EXPECT_EQ(2, gpuRays->RangeCount());
+  EXPECT_EQ(2, gpuRays->VerticalRangeCount());
+
+  auto expectedRange = [](const math::Vector2d &_dir)
+  {
+    return 1.5 / (std::cos(_dir.X()) * std::cos(_dir.Y()));
+  };
+
+  std::vector<float> scan;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &/*_format*/)
+        {
+          scan.assign(_scan, _scan + _width * _height * _channels);
+          width = _width;
+          height = _height;
+        });
+  unsigned int channels = gpuRays->Channels();
+
+  gpuRays->Update();
+  ASSERT_EQ(2u, width);
+  ASSERT_EQ(2u, height);
+  EXPECT_NEAR(expectedRange(pattern[0]), scan[0], LASER_TOL);
+  EXPECT_FLOAT_EQ(math::INF_F, scan[1 * channels]);
+  EXPECT_NEAR(expectedRange(pattern[2]), scan[2 * channels],
+      VERTICAL_LASER_TOL);
+  EXPECT_NEAR(expectedRange(pattern[3]), scan[3 * channels],
+      VERTICAL_LASER_TOL);
+
+  // a pattern of the same size on the same faces, e.g. a rotating scan
+  std::swap(pattern[0], pattern[1]);
+  gpuRays->SetRayDirections(pattern, 2u);
+  gpuRays->Update();
+  EXPECT_FLOAT_EQ(math::INF_F, scan[0]);
+  EXPECT_NEAR(expectedRange(pattern[1]), scan[1 * channels], LASER_TOL);
+
+  // a pattern of another size
+  gpuRays->SetRayDirections({{0.0, 0.0}}, 1u);
+  gpuRays->Update();
+  ASSERT_EQ(1u, width);
+  ASSERT_EQ(1u, height);
+  EXPECT_NEAR(1.5, scan[0], LASER_TOL);
+
+  // back to the regular grid
+  gpuRays->SetRayDirections({}, 0u);
+  EXPECT_EQ(10, gpuRays->RangeCount());
+  EXPECT_EQ(1, gpuRays->VerticalRangeCount());
+  gpuRays->Update();
+  EXPECT_EQ(10u, width);
+  EXPECT_EQ(1u, height);
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test GPU rays cast from a pose that moves during the scan
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ScanMotion))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const unsigned int hRayCount = 361u;
+  const unsigned int mid = hRayCount / 2u;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // 360 degree lidar, the middle ray looks along +X
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.05);
+  gpuRays->SetFarClipPlane(40.0);
+  gpuRays->SetAngleMin(-GZ_PI);
+  gpuRays->SetAngleMax(GZ_PI);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  // box in front of the sensor, its face is 1.5 m away
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(2, 0, 0);
+  root->AddChild(visualBox1);
+
+  std::vector<float> scan;
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&scan](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &/*_format*/)
+        {
+          scan.assign(_scan, _scan + _width * _height * _channels);
+        });
+
+  EXPECT_FALSE(gpuRays->HasScanMotion());
+  gpuRays->Update();
+  ASSERT_FALSE(scan.empty());
+  EXPECT_NEAR(1.5, scan[mid * 3], LASER_TOL);
+
+  // the sensor stands 0.5 m closer to the box during the whole scan
+  const math::Pose3d closer(0.5, 0, 0, 0, 0, 0);
+  gpuRays->SetScanMotion(closer, closer);
+  EXPECT_TRUE(gpuRays->HasScanMotion());
+  gpuRays->Update();
+  EXPECT_NEAR(1.0, scan[mid * 3], LASER_TOL);
+
+  // the sensor passes the origin when it scans the middle of the box
+  gpuRays->SetScanMotion(math::Pose3d(-1, 0, 0, 0, 0, 0),
+      math::Pose3d(1, 0, 0, 0, 0, 0));
+  gpuRays->Update();
+  EXPECT_NEAR(1.5, scan[mid * 3], LASER_TOL);
+
+  gpuRays->ClearScanMotion();
+  EXPECT_FALSE(gpuRays->HasScanMotion());
+  gpuRays->Update();
+  EXPECT_NEAR(1.5, scan[mid * 3], LASER_TOL);
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test GPU rays beams that partially hit an obstacle
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(MultiReturn))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // single ray aimed at the left edge of a box, with a wall behind it
+  const double edgeAngle = std::atan2(0.5, 1.5);
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.05);
+  gpuRays->SetFarClipPlane(40.0);
+  gpuRays->SetAngleMin(edgeAngle);
+  gpuRays->SetAngleMax(edgeAngle);
+  gpuRays->SetRayCount(1);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(2, 0, 0);
+  root->AddChild(visualBox1);
+
+  VisualPtr wall = scene->CreateVisual("Wall");
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalScale(1, 10, 10);
+  wall->SetWorldPosition(5.5, 0, 0);
+  root->AddChild(wall);
+
+  EXPECT_DOUBLE_EQ(0.0, gpuRays->BeamDivergence());
+  EXPECT_EQ(1u, gpuRays->BeamSampleCount());
+
+  // invalid beams are rejected
+  gpuRays->SetBeamDivergence(-0.1, 8u);
+  gpuRays->SetBeamDivergence(0.1, 0u);
+  gpuRays->SetBeamDivergence(0.1, 17u);
+  EXPECT_DOUBLE_EQ(0.0, gpuRays->BeamDivergence());
+  EXPECT_EQ(1u, gpuRays->BeamSampleCount());
+
+  gpuRays->SetOutputFormat(GROF_MULTI_RETURN_FLOAT32);
+  EXPECT_EQ(4u, gpuRays->Channels());
+
+  float scan[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&scan](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &/*_format*/)
+        {
+          ASSERT_EQ(4u, _width * _height * _channels);
+          std::copy(_scan, _scan + 4, scan);
+        });
+
+  // an ideal ray has a single return
+  gpuRays->Update();
+  EXPECT_FLOAT_EQ(scan[0], scan[1]);
+  EXPECT_FLOAT_EQ(scan[0], scan[2]);
+
+  // a wide beam returns from both the box and the wall
+  gpuRays->SetBeamDivergence(0.1, 16u);
+  EXPECT_DOUBLE_EQ(0.1, gpuRays->BeamDivergence());
+  EXPECT_EQ(16u, gpuRays->BeamSampleCount());
+  gpuRays->Update();
+  EXPECT_GT(1.7f, scan[0]);
+  EXPECT_LT(4.5f, scan[1]);
+  EXPECT_LE(scan[0], scan[2]);
+  EXPECT_GE(scan[1], scan[2]);
+
+  // single return formats report the first return
+  c.reset();
+  float range = 0.0f;
+  c = gpuRays->ConnectNewGpuRaysFrame(
+        [&range](const float *_scan, unsigned int, unsigned int,
+          unsigned int, const std::string &)
+        {
+          range = _scan[0];
+        });
+  gpuRays->SetOutputFormat(GROF_RANGE_RETRO_FLOAT32);
+  gpuRays->Update();
+  EXPECT_FLOAT_EQ(scan[0], range);
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test GPU rays point cloud output
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(PointCloud))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetNearClipPlane(0.05);
+  gpuRays->SetFarClipPlane(40.0);
+  gpuRays->SetAngleMin(-0.2);
+  gpuRays->SetAngleMax(0.2);
+  gpuRays->SetRayCount(3);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  // box in front of the sensor, its face is 1.5 m away
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(2, 0, 0);
+  root->AddChild(visualBox1);
+
+  gpuRays->SetOutputFormat(GROF_POINT_XYZI_FLOAT32);
+  EXPECT_EQ(4u, gpuRays->Channels());
+  EXPECT_FALSE(gpuRays->PointCloudCompaction());
+
+  std::vector<float> points;
+  unsigned int width = 0u;
+  std::string format;
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &_format)
+        {
+          points.assign(_scan, _scan + _width * _height * _channels);
+          width = _width;
+          format = _format;
+        });
+
+  // points lie on the face of the box
+  gpuRays->Update();
+  ASSERT_EQ(3u, width);
+  EXPECT_EQ("PF_FLOAT32_RGBA", format);
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    const double angle = -0.2 + 0.2 * i;
+    EXPECT_NEAR(1.5, points[i * 4u], LASER_TOL);
+    EXPECT_NEAR(1.5 * std::tan(angle), points[i * 4u + 1u],
+        VERTICAL_LASER_TOL);
+    EXPECT_NEAR(0.0, points[i * 4u + 2u], LASER_TOL);
+  }
+
+  c.reset();
+
+  // only the middle ray hits the box, the others look sideways
+  GpuRaysPtr gpuRays2 = scene->CreateGpuRays("gpu_rays2");
+  gpuRays2->SetNearClipPlane(0.05);
+  gpuRays2->SetFarClipPlane(40.0);
+  gpuRays2->SetAngleMin(-GZ_PI / 2.0);
+  gpuRays2->SetAngleMax(GZ_PI / 2.0);
+  gpuRays2->SetRayCount(3);
+  gpuRays2->SetVerticalRayCount(1);
+  gpuRays2->SetOutputFormat(GROF_POINT_XYZI_FLOAT32);
+  gpuRays2->SetPointCloudCompaction(true);
+  EXPECT_TRUE(gpuRays2->PointCloudCompaction());
+  root->AddChild(gpuRays2);
+
+  c = gpuRays2->ConnectNewGpuRaysFrame(
+        [&](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int _channels,
+          const std::string &/*_format*/)
+        {
+          EXPECT_EQ(1u, _height);
+          points.assign(_scan, _scan + _width * _height * _channels);
+          width = _width;
+        });
+  gpuRays2->Update();
+  ASSERT_EQ(1u, width);
+  EXPECT_NEAR(1.5, points[0], LASER_TOL);
+  EXPECT_NEAR(0.0, points[1], LASER_TOL);
+  EXPECT_NEAR(0.0, points[2], LASER_TOL);
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Visibility))
 {
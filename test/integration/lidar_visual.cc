@@ -131,6 +131,70 @@ TEST_F(LidarVisualTest, Configure)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+/// \brief Test visualizing a GpuRays sensor bound to the lidar visual
+TEST_F(LidarVisualTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(BindGpuRays))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const int hRayCount = 9;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  gpuRays->SetWorldPosition(0, 0, 0.1);
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  gpuRays->SetAngleMin(-0.5);
+  gpuRays->SetAngleMax(0.5);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(1);
+  root->AddChild(gpuRays);
+
+  LidarVisualPtr lidarVis = scene->CreateLidarVisual();
+  lidarVis->SetWorldPosition(0, 0, 0.1);
+  lidarVis->SetType(LidarVisualType::LVT_POINTS);
+  root->AddChild(lidarVis);
+
+  // box in front of the sensor
+  VisualPtr visualBox = scene->CreateVisual("UnitBox");
+  visualBox->AddGeometry(scene->CreateBox());
+  visualBox->SetWorldPosition(3, 0, 0.5);
+  root->AddChild(visualBox);
+
+  EXPECT_EQ(nullptr, lidarVis->GpuRays());
+  lidarVis->SetGpuRays(gpuRays);
+  EXPECT_EQ(gpuRays, lidarVis->GpuRays());
+
+  gpuRays->Update();
+  lidarVis->Update();
+
+  // the visual takes the configuration and ranges of the sensor
+  EXPECT_DOUBLE_EQ(-0.5, lidarVis->MinHorizontalAngle());
+  EXPECT_DOUBLE_EQ(0.5, lidarVis->MaxHorizontalAngle());
+  EXPECT_EQ(static_cast<unsigned int>(hRayCount),
+      lidarVis->HorizontalRayCount());
+  EXPECT_DOUBLE_EQ(10.0, lidarVis->MaxRange());
+  EXPECT_EQ(static_cast<unsigned int>(hRayCount), lidarVis->PointCount());
+  std::vector<double> points = lidarVis->Points();
+  ASSERT_EQ(static_cast<size_t>(hRayCount), points.size());
+  EXPECT_NEAR(2.5, points[hRayCount / 2], LASER_TOL);
+  EXPECT_NEAR(gpuRays->Data()[(hRayCount / 2) * gpuRays->Channels()],
+      points[hRayCount / 2], DOUBLE_TOL);
+
+  // setting points unbinds the sensor
+  lidarVis->SetPoints(std::vector<double>(hRayCount, 1.0));
+  EXPECT_EQ(nullptr, lidarVis->GpuRays());
+  EXPECT_DOUBLE_EQ(1.0, lidarVis->Points()[0]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 /// \brief Test detection of different boxes
 TEST_F(LidarVisualTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RaysUnitBox))
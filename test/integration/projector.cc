@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Image.hh>
@@ -180,6 +184,90 @@ TEST_F(ProjectorTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Visibility))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(ProjectorTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(MultipleTextures))
+{
+  // projectors with different textures are shaded in the same pass
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  scene->SetBackgroundColor(0, 0, 0);
+  scene->SetAmbientLight(1, 1, 1);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  DirectionalLightPtr light0 = scene->CreateDirectionalLight();
+  light0->SetDirection(0.0, 0.0, -1);
+  light0->SetDiffuseColor(1.0, 1.0, 1.0);
+  light0->SetSpecularColor(1.0, 1.0, 1.0);
+  root->AddChild(light0);
+
+  // the camera looks down with the world x axis pointing up in the image
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetWorldPosition(0, 0, -2);
+  camera->SetWorldRotation(0, GZ_PI / 2.0, 0);
+  camera->SetImageWidth(256);
+  camera->SetImageHeight(256);
+  root->AddChild(camera);
+
+  // red projector covering the top half of the image and blue projector
+  // covering the bottom half
+  std::string textureRed = common::joinPaths(
+      TEST_MEDIA_PATH, "materials", "textures", "red_texture.png");
+  std::string textureBlue = common::joinPaths(
+      TEST_MEDIA_PATH, "materials", "textures", "blue_texture.png");
+  std::vector<ProjectorPtr> projectors;
+  for (const auto &[x, texture] : {std::make_pair(2.5, textureRed),
+      std::make_pair(-2.5, textureBlue)})
+  {
+    ProjectorPtr projector = scene->CreateProjector();
+    ASSERT_NE(nullptr, projector);
+    projector->SetNearClipPlane(1.0);
+    projector->SetFarClipPlane(6.0);
+    projector->SetTexture(texture);
+    projector->SetWorldPosition(x, 0, 0);
+    projector->SetWorldRotation(0, GZ_PI / 2.0, 0);
+    root->AddChild(projector);
+    projectors.push_back(projector);
+  }
+
+  // create background wall visual for projection
+  VisualPtr visual = scene->CreateVisual();
+  visual->AddGeometry(scene->CreateBox());
+  visual->SetWorldPosition(0.0, 0.0, -5);
+  visual->SetLocalScale(10.0, 10.0, 1.0);
+  root->AddChild(visual);
+
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetAmbient(0.0, 1.0, 0.0);
+  green->SetDiffuse(0.0, 1.0, 0.0);
+  green->SetSpecular(0.0, 1.0, 0.0);
+  visual->SetMaterial(green);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+
+  unsigned int width = camera->ImageWidth();
+  unsigned int height = camera->ImageHeight();
+  unsigned int bpp = PixelUtil::BytesPerPixel(camera->ImageFormat());
+  unsigned char *data = image.Data<unsigned char>();
+
+  unsigned int top = ((height / 4u) * width + width / 2u) * bpp;
+  EXPECT_GT(data[top], data[top + 1]);
+  EXPECT_GT(data[top], data[top + 2]);
+
+  unsigned int bottom = ((height * 3u / 4u) * width + width / 2u) * bpp;
+  EXPECT_GT(data[bottom + 2], data[bottom]);
+  EXPECT_GT(data[bottom + 2], data[bottom + 1]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(ProjectorTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Heightmap))
 {
@@ -363,8 +363,6 @@ TEST_F(RenderPassTest, GZ_UTILS_TEST_DISABLED_ON_MAC(DepthGaussianNoise))
 TEST_F(RenderPassTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Distortion))
 {
   CHECK_RENDERPASS_SUPPORTED();
-  // Distortion isn't supported in ogre2
-  CHECK_UNSUPPORTED_ENGINE("ogre2");
 
   // add resources in build dir
   this->engine->AddResourcePath(
@@ -877,3 +875,71 @@ TEST_F(RenderPassTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(LensFlareWideAnglePass))
 
   TestLensFlare(this->engine, true);
 }
+
+/////////////////////////////////////////////////
+TEST_F(RenderPassTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(GaussianNoiseChain))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  CHECK_RENDERPASS_SUPPORTED();
+
+  RenderPassSystemPtr rpSystem = this->engine->RenderPassSystem();
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.2, 0.2, 0.2);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(32);
+  camera->SetImageHeight(32);
+  root->AddChild(camera);
+
+  // the last enabled noise pass is applied by the final compositor pass
+  // instead of its own node. Passes without variance add a constant so the
+  // result must only depend on which passes are enabled.
+  auto createPass = [&](double _mean)
+  {
+    GaussianNoisePassPtr noisePass =
+        std::dynamic_pointer_cast<GaussianNoisePass>(
+        rpSystem->Create<GaussianNoisePass>());
+    noisePass->SetMean(_mean);
+    noisePass->SetStdDev(0.0);
+    return noisePass;
+  };
+
+  auto capture = [&]()
+  {
+    Image image = camera->CreateImage();
+    camera->Capture(image);
+    return static_cast<int>(image.Data<unsigned char>()[0]);
+  };
+
+  const int background = capture();
+
+  GaussianNoisePassPtr passA = createPass(0.3);
+  camera->AddRenderPass(passA);
+  const int noisy = capture();
+  EXPECT_GT(noisy, background);
+
+  // a pass that adds nothing after it, A now has its own node
+  GaussianNoisePassPtr passB = createPass(0.0);
+  camera->AddRenderPass(passB);
+  EXPECT_EQ(noisy, capture());
+
+  // A is fused again if B is disabled
+  passB->SetEnabled(false);
+  EXPECT_EQ(noisy, capture());
+
+  // and no noise is left once A is disabled too
+  passA->SetEnabled(false);
+  EXPECT_EQ(background, capture());
+
+  passB->SetEnabled(true);
+  EXPECT_EQ(background, capture());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
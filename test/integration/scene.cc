@@ -20,6 +20,8 @@
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
+#include "gz/rendering/Image.hh"
+#include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/Scene.hh"
 
 #include <gz/utils/ExtraTestMacros.hh>
@@ -192,3 +194,68 @@ TEST_F(SceneTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(VisualAt))
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(LightDirectionAtFixedTime))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(0.1, 0.1, 0.1);
+
+  VisualPtr root = scene->RootVisual();
+
+  // downward looking camera above a white box
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(10);
+  camera->SetImageHeight(10);
+  camera->SetLocalPosition(0.0, 0.0, 2.0);
+  camera->SetLocalRotation(0, 1.57, 0);
+  root->AddChild(camera);
+
+  MaterialPtr white = scene->CreateMaterial();
+  white->SetAmbient(1.0, 1.0, 1.0);
+  white->SetDiffuse(1.0, 1.0, 1.0);
+  white->SetSpecular(0.0, 0.0, 0.0);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalScale(4.0, 4.0, 1.0);
+  box->SetMaterial(white, false);
+  root->AddChild(box);
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.0, 0.0, -1.0);
+  light->SetDiffuseColor(1.0, 1.0, 1.0);
+  light->SetCastShadows(false);
+  root->AddChild(light);
+
+  Image image = camera->CreateImage();
+  const unsigned int size = camera->ImageWidth() * camera->ImageHeight() *
+      PixelUtil::BytesPerPixel(camera->ImageFormat());
+  auto brightness = [&]()
+  {
+    camera->Capture(image);
+    const unsigned char *data = image.Data<unsigned char>();
+    unsigned int sum = 0u;
+    for (unsigned int i = 0u; i < size; ++i)
+      sum += data[i];
+    return sum;
+  };
+
+  // the sim time does not change, so the second capture may only update
+  // the scene graph because the light direction marked it dirty
+  const unsigned int lit = brightness();
+  light->SetDirection(0.0, 0.0, 1.0);
+  const unsigned int unlit = brightness();
+  EXPECT_LT(unlit, lit);
+
+  // pointing the light back down lights the box again
+  light->SetDirection(0.0, 0.0, -1.0);
+  EXPECT_GT(brightness(), unlit);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
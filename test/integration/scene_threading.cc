@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include <gz/math/Color.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Scene.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Test fixture that loads the engine with scene threading enabled.
+/// Since the CommonRenderingTest loads an engine without it, we are doing a
+/// custom implementation here.
+class SceneThreadingTest: public testing::Test
+{
+  /// \brief Set up the test fixture
+  public: void SetUp() override
+  {
+    common::Console::SetVerbosity(4);
+    auto [envEngine, envBackend, envHeadless] = GetTestParams();
+    if (envEngine.empty())
+    {
+      GTEST_SKIP() << kEngineToTestEnv << " environment not set";
+    }
+    if (envEngine != "ogre2" ||
+        (envBackend != "vulkan" && envBackend != "metal"))
+    {
+      GTEST_SKIP() << "Scene threading requires the ogre2 engine with the "
+                   << "vulkan or metal backend";
+    }
+
+    this->engineToTest = envEngine;
+    auto engineParams = GetEngineParams(envEngine, envBackend, envHeadless);
+    engineParams["sceneThreading"] = "1";
+    this->engine = rendering::engine(this->engineToTest, engineParams);
+    if (!this->engine)
+    {
+      GTEST_SKIP() << "Engine '" << this->engineToTest
+                   << "' could not be loaded";
+    }
+  }
+
+  /// \brief Tear down the test fixture
+  public: void TearDown() override
+  {
+    if (this->engine)
+    {
+      ASSERT_TRUE(rendering::unloadEngine(this->engineToTest));
+    }
+  }
+
+  /// \brief Create a scene with a camera looking at a box
+  /// \param[in] _name Name of the scene
+  /// \param[in] _background Background colour of the scene
+  /// \return Camera of the scene
+  public: CameraPtr CreateScene(const std::string &_name,
+              const math::Color &_background)
+  {
+    ScenePtr scene = this->engine->CreateScene(_name);
+    if (!scene)
+      return CameraPtr();
+    scene->SetBackgroundColor(_background);
+    scene->SetAmbientLight(1.0, 1.0, 1.0);
+
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetLocalPosition(3, 0, 0);
+    scene->RootVisual()->AddChild(box);
+
+    CameraPtr camera = scene->CreateCamera();
+    camera->SetImageWidth(64);
+    camera->SetImageHeight(64);
+    camera->SetHFOV(GZ_PI / 2);
+    scene->RootVisual()->AddChild(camera);
+    return camera;
+  }
+
+  /// \brief String name of the engine to test
+  public: std::string engineToTest;
+
+  /// \brief Pointer to the rendering engine to test
+  public: RenderEngine *engine = nullptr;
+};
+
+/////////////////////////////////////////////////
+TEST_F(SceneThreadingTest, RenderScenesFromThreads)
+{
+  const std::vector<math::Color> backgrounds =
+      {math::Color::Red, math::Color::Green, math::Color::Blue};
+  std::vector<CameraPtr> cameras;
+  for (unsigned int i = 0u; i < backgrounds.size(); ++i)
+  {
+    CameraPtr camera =
+        this->CreateScene("scene" + std::to_string(i), backgrounds[i]);
+    ASSERT_NE(nullptr, camera);
+    cameras.push_back(camera);
+  }
+
+  // every thread renders its own scene and checks that the image shows
+  // its background and not the one of another scene
+  const unsigned int frameCount = 20u;
+  std::atomic<unsigned int> mismatches{0u};
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0u; i < cameras.size(); ++i)
+  {
+    threads.emplace_back([&, i]()
+    {
+      CameraPtr camera = cameras[i];
+      const math::Color &background = backgrounds[i];
+      unsigned int frames = 0u;
+      common::ConnectionPtr connection = camera->ConnectNewImageFrame(
+          [&](const unsigned char *_data, unsigned int, unsigned int,
+              unsigned int, const std::string &)
+          {
+            // top left corner, outside of the box
+            const unsigned char *pixel = _data;
+            if (std::abs(pixel[0] - background.R() * 255) > 5 ||
+                std::abs(pixel[1] - background.G() * 255) > 5 ||
+                std::abs(pixel[2] - background.B() * 255) > 5)
+            {
+              ++mismatches;
+            }
+            ++frames;
+          });
+
+      for (unsigned int f = 0u; f < frameCount; ++f)
+      {
+        camera->Update();
+        std::this_thread::yield();
+      }
+      EXPECT_EQ(frameCount, frames);
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  EXPECT_EQ(0u, mismatches);
+
+  for (auto &camera : cameras)
+    this->engine->DestroyScene(camera->Scene());
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneThreadingTest, DestroySceneWithoutPostRender)
+{
+  CameraPtr first = this->CreateScene("first", math::Color::Red);
+  ASSERT_NE(nullptr, first);
+  CameraPtr second = this->CreateScene("second", math::Color::Blue);
+  ASSERT_NE(nullptr, second);
+
+  // a thread that never calls PostRender holds the render mutex until its
+  // scene is destroyed
+  std::thread abandoned([&]()
+  {
+    ScenePtr scene = first->Scene();
+    scene->PreRender();
+    this->engine->DestroyScene(scene);
+  });
+  abandoned.join();
+
+  // the other scene still renders from another thread
+  auto rendered = std::async(std::launch::async, [&]()
+  {
+    second->Update();
+    return true;
+  });
+  ASSERT_EQ(std::future_status::ready,
+      rendered.wait_for(std::chrono::seconds(10)));
+  EXPECT_TRUE(rendered.get());
+
+  this->engine->DestroyScene(second->Scene());
+}
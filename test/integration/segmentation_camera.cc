@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Filesystem.hh>
@@ -181,6 +183,49 @@ TEST_F(SegmentationCameraTest, SegmentationCameraBoxes)
   int background = g_buffer[0];
   EXPECT_EQ(background, backgroundLabel);
 
+  // the sparse segmentation describes the same pixels
+  std::vector<SegmentationInstance> instances;
+  camera->EnableInstanceRuns(true);
+  EXPECT_TRUE(camera->IsInstanceRunsEnabled());
+  gz::common::ConnectionPtr instancesConnection =
+      camera->ConnectNewSegmentationInstances(
+          [&instances](const std::vector<SegmentationInstance> &_instances,
+                       unsigned int, unsigned int)
+          {
+            instances = _instances;
+          });
+  ASSERT_NE(nullptr, instancesConnection);
+  camera->Update();
+
+  // background and the two labels, sorted by id
+  ASSERT_EQ(3u, instances.size());
+  uint64_t pixelCount = 0u;
+  for (const auto &instance : instances)
+  {
+    uint64_t runsLength = 0u;
+    for (const auto &run : instance.runs)
+    {
+      EXPECT_LE(instance.minY, run.row);
+      EXPECT_GE(instance.maxY, run.row);
+      EXPECT_LE(instance.minX, run.start);
+      EXPECT_GE(instance.maxX, run.start + run.length - 1u);
+      for (uint32_t x = run.start; x < run.start + run.length; ++x)
+        EXPECT_EQ(instance.id & 0xFFu, g_buffer[(run.row * width + x) * 3]);
+      runsLength += run.length;
+    }
+    EXPECT_EQ(instance.pixelCount, runsLength);
+    pixelCount += instance.pixelCount;
+  }
+  EXPECT_EQ(static_cast<uint64_t>(width * height), pixelCount);
+  EXPECT_EQ(0x010101u, instances[0].id);
+  EXPECT_EQ(0x020202u, instances[1].id);
+  EXPECT_EQ(0x171717u, instances[2].id);
+  EXPECT_LE(instances[1].minX, static_cast<uint32_t>(middleProj.X()));
+  EXPECT_GE(instances[1].maxX, static_cast<uint32_t>(middleProj.X()));
+  EXPECT_LE(instances[1].minY, static_cast<uint32_t>(middleProj.Y()));
+  EXPECT_GE(instances[1].maxY, static_cast<uint32_t>(middleProj.Y()));
+  instancesConnection.reset();
+
   // Instance/Panoptic test
   camera->SetSegmentationType(SegmentationType::ST_PANOPTIC);
 
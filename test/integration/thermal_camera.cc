@@ -24,6 +24,7 @@
 
 #include <gz/math/Color.hh>
 
+#include "gz/rendering/FrameView.hh"
 #include "gz/rendering/ParticleEmitter.hh"
 #include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/Scene.hh"
@@ -548,6 +549,80 @@ TEST_F(ThermalCameraTest, ThermalCameraBoxes8Bit)
   engine->DestroyScene(scene);
 }
 
+//////////////////////////////////////////////////
+TEST_F(ThermalCameraTest, ThermalCameraColormap)
+{
+  // Only ogre2 supports false color output
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  unsigned int imgWidth = 50u;
+  unsigned int imgHeight = 50u;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  gz::rendering::VisualPtr root = scene->RootVisual();
+
+  // hot box in the middle of the image
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.8, 0.0, 0.0);
+  box->SetUserData("temperature", 600.0f);
+  root->AddChild(box);
+
+  auto thermalCamera = scene->CreateThermalCamera("ThermalCamera");
+  ASSERT_NE(thermalCamera, nullptr);
+  thermalCamera->SetImageWidth(imgWidth);
+  thermalCamera->SetImageHeight(imgHeight);
+  thermalCamera->SetFarClipPlane(10.0);
+  thermalCamera->SetNearClipPlane(0.15);
+  thermalCamera->SetHFOV(1.05);
+  thermalCamera->SetImageFormat(gz::rendering::PF_R8G8B8A8);
+  thermalCamera->SetMinTemperature(253.0f);
+  thermalCamera->SetMaxTemperature(673.0f);
+  thermalCamera->SetAmbientTemperature(296.0f);
+  root->AddChild(thermalCamera);
+
+  // false color images are not delivered as temperatures
+  unsigned int thermalFrames = 0u;
+  gz::common::ConnectionPtr thermalConnection =
+    thermalCamera->ConnectNewThermalFrame(
+        [&thermalFrames](const uint16_t *, unsigned int, unsigned int,
+                         unsigned int, const std::string &)
+        {
+          ++thermalFrames;
+        });
+
+  std::vector<unsigned char> colors(imgWidth * imgHeight * 4u);
+  gz::rendering::PixelFormat viewFormat = gz::rendering::PF_UNKNOWN;
+  gz::common::ConnectionPtr viewConnection =
+    thermalCamera->ConnectNewFrameView(
+        [&](const gz::rendering::FrameView &_view)
+        {
+          viewFormat = _view.format;
+          for (unsigned int i = 0; i < _view.height; ++i)
+          {
+            memcpy(&colors[i * imgWidth * 4u],
+                _view.Row<unsigned char>(i), imgWidth * 4u);
+          }
+        });
+
+  thermalCamera->Update();
+  EXPECT_EQ(0u, thermalFrames);
+  EXPECT_EQ(gz::rendering::PF_R8G8B8A8, viewFormat);
+
+  // the hot box is brighter than the ambient background
+  unsigned int mid = ((imgHeight / 2u) * imgWidth + imgWidth / 2u) * 4u;
+  unsigned int left = (imgHeight / 2u) * imgWidth * 4u;
+  EXPECT_GT(colors[mid] + colors[mid + 1u],
+            colors[left] + colors[left + 1u]);
+  EXPECT_EQ(255u, colors[mid + 3u]);
+  EXPECT_EQ(255u, colors[left + 3u]);
+
+  thermalConnection.reset();
+  viewConnection.reset();
+  engine->DestroyScene(scene);
+}
+
 //////////////////////////////////////////////////
 TEST_F(ThermalCameraTest, ThermalCameraParticles)
 {
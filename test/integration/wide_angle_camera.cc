@@ -455,6 +455,22 @@ TEST_F(WideAngleCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Projection))
   EXPECT_GT(screenPt.Z(), 0.0);
   EXPECT_LT(screenPt.Z(), 1.0);
 
+  // project many points at once
+  std::vector<gz::math::Vector3d> worldPoints;
+  for (int i = -2; i <= 2; ++i)
+  {
+    for (int j = -2; j <= 2; ++j)
+      worldPoints.emplace_back(1.0, i * 0.5, j * 0.5);
+  }
+  worldPoints.push_back(-gz::math::Vector3d::UnitX);
+  auto screenPts = camera->Project3d(worldPoints);
+  ASSERT_EQ(worldPoints.size(), screenPts.size());
+  for (unsigned int i = 0u; i < worldPoints.size(); ++i)
+  {
+    screenPt = camera->Project3d(worldPoints[i]);
+    EXPECT_EQ(screenPt, screenPts[i]);
+  }
+
   // Clean up
   engine->DestroyScene(scene);
 
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_TEST_PERFORMANCE_PERFUTILS_HH_
+#define GZ_RENDERING_TEST_PERFORMANCE_PERFUTILS_HH_
+
+#include <chrono>
+#include <cstdlib>
+
+/////////////////////////////////////////////////
+/// \brief Read a positive integer from the environment
+/// \param[in] _name Name of the environment variable
+/// \param[in] _default Value to use if the variable is not set or invalid
+inline unsigned int EnvParam(const char *_name, unsigned int _default)
+{
+  const char *value = std::getenv(_name);
+  if (!value)
+    return _default;
+  char *end = nullptr;
+  const long parsed = std::strtol(value, &end, 10);
+  if (end == value || parsed <= 0)
+    return _default;
+  return static_cast<unsigned int>(parsed);
+}
+
+/////////////////////////////////////////////////
+/// \brief Convert a duration to milliseconds
+inline double ToMs(std::chrono::steady_clock::duration _duration)
+{
+  return std::chrono::duration<double, std::milli>(_duration).count();
+}
+
+#endif
@@ -0,0 +1,489 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Microbenchmarks of core data structures and conversions.
+//
+// Every benchmark runs an operation over a realistic number of items,
+// e.g. 100k visuals or a 4K image, several times and reports the best and
+// mean wall clock time of a repetition and the time per item. Results are
+// recorded as gtest properties and, when GZ_RENDERING_BENCHMARK_OUTPUT is
+// set, appended to that file as one JSON object per line, in the same
+// format as the sensor rendering benchmarks.
+//
+// The sizes are parameterized with the following environment variables:
+//   GZ_RENDERING_BENCHMARK_OBJECTS      Number of visuals, boxes and
+//                                       screen positions (default 100000)
+//   GZ_RENDERING_BENCHMARK_IMAGE_WIDTH  Image width (default 3840)
+//   GZ_RENDERING_BENCHMARK_IMAGE_HEIGHT Image height (default 2160)
+//   GZ_RENDERING_BENCHMARK_REPETITIONS  Number of timed repetitions
+//                                       (default 5)
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector2.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "CommonRenderingTest.hh"
+#include "PerfUtils.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Image.hh"
+#include "gz/rendering/PixelFormat.hh"
+#include "gz/rendering/RayQuery.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/ShaderParams.hh"
+#include "gz/rendering/Utils.hh"
+#include "gz/rendering/Visual.hh"
+#include "gz/rendering/VisualDescriptor.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Benchmark results
+struct MicroBenchmarkResult
+{
+  /// \brief Number of items processed per repetition
+  unsigned int items = 0u;
+
+  /// \brief Number of timed repetitions
+  unsigned int repetitions = 0u;
+
+  /// \brief Time of the fastest repetition, in ms
+  double bestMs = 0.0;
+
+  /// \brief Average time of a repetition, in ms
+  double meanMs = 0.0;
+
+  /// \brief Time per item of the fastest repetition, in ns
+  double nsPerItem = 0.0;
+};
+
+/// \brief Times core utilities that sit on the hot paths of scene updates
+/// and sensor readback
+class CoreUtilitiesBenchmark: public CommonRenderingTest
+{
+  /// \brief Run an operation once untimed, then time the configured number
+  /// of repetitions of it and report the results
+  /// \param[in] _name Name of the benchmark
+  /// \param[in] _items Number of items the operation processes
+  /// \param[in] _op Operation to time
+  public: void Measure(const std::string &_name, unsigned int _items,
+              const std::function<void()> &_op);
+
+  /// \brief Report benchmark results
+  /// \param[in] _name Name of the benchmark
+  /// \param[in] _result Results
+  public: void Report(const std::string &_name,
+              const MicroBenchmarkResult &_result);
+
+  /// \brief Number of visuals, boxes and screen positions
+  public: const unsigned int objectCount =
+      EnvParam("GZ_RENDERING_BENCHMARK_OBJECTS", 100000u);
+
+  /// \brief Width of benchmarked images
+  public: const unsigned int imageWidth =
+      EnvParam("GZ_RENDERING_BENCHMARK_IMAGE_WIDTH", 3840u);
+
+  /// \brief Height of benchmarked images
+  public: const unsigned int imageHeight =
+      EnvParam("GZ_RENDERING_BENCHMARK_IMAGE_HEIGHT", 2160u);
+
+  /// \brief Accumulates results of the timed operations so that they are
+  /// not optimized away
+  public: double sink = 0.0;
+};
+
+/////////////////////////////////////////////////
+void CoreUtilitiesBenchmark::Measure(const std::string &_name,
+    unsigned int _items, const std::function<void()> &_op)
+{
+  const unsigned int repetitions =
+      EnvParam("GZ_RENDERING_BENCHMARK_REPETITIONS", 5u);
+
+  // warm up caches and lazily allocated buffers
+  _op();
+
+  MicroBenchmarkResult result;
+  result.items = _items;
+  result.repetitions = repetitions;
+  result.bestMs = std::numeric_limits<double>::max();
+  for (unsigned int i = 0; i < repetitions; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    _op();
+    double ms = ToMs(std::chrono::steady_clock::now() - start);
+    result.bestMs = std::min(result.bestMs, ms);
+    result.meanMs += ms / repetitions;
+  }
+  result.nsPerItem = _items > 0u ? result.bestMs * 1e6 / _items : 0.0;
+  this->Report(_name, result);
+}
+
+/////////////////////////////////////////////////
+void CoreUtilitiesBenchmark::Report(const std::string &_name,
+    const MicroBenchmarkResult &_result)
+{
+  std::ostringstream json;
+  json << "{\"benchmark\": \"" << _name << "\""
+       << ", \"engine\": \"" << this->engineToTest << "\""
+       << ", \"items\": " << _result.items
+       << ", \"repetitions\": " << _result.repetitions
+       << ", \"best_ms\": " << _result.bestMs
+       << ", \"mean_ms\": " << _result.meanMs
+       << ", \"ns_per_item\": " << _result.nsPerItem
+       << "}";
+
+  std::cout << json.str() << std::endl;
+
+  this->RecordProperty(_name + "_best_ms", std::to_string(_result.bestMs));
+  this->RecordProperty(_name + "_ns_per_item",
+      std::to_string(_result.nsPerItem));
+
+  const char *output = std::getenv("GZ_RENDERING_BENCHMARK_OUTPUT");
+  if (output)
+  {
+    std::ofstream file(output, std::ios::app);
+    if (file)
+      file << json.str() << std::endl;
+    else
+      gzerr << "Unable to write benchmark results to " << output << std::endl;
+  }
+}
+
+/////////////////////////////////////////////////
+// Scene storage: creating visuals and looking them up by id, name and index
+TEST_F(CoreUtilitiesBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(Storage))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  std::vector<VisualDescriptor> descs(this->objectCount);
+  for (unsigned int i = 0; i < this->objectCount; ++i)
+    descs[i].name = "visual_" + std::to_string(i);
+
+  std::vector<VisualPtr> visuals;
+  auto start = std::chrono::steady_clock::now();
+  visuals = scene->CreateVisuals(descs);
+  MicroBenchmarkResult create;
+  create.items = this->objectCount;
+  create.repetitions = 1u;
+  create.bestMs = ToMs(std::chrono::steady_clock::now() - start);
+  create.meanMs = create.bestMs;
+  create.nsPerItem = create.bestMs * 1e6 / this->objectCount;
+  this->Report("storage_create_visuals", create);
+  ASSERT_LE(this->objectCount, scene->VisualCount());
+
+  std::vector<unsigned int> ids;
+  ids.reserve(visuals.size());
+  for (const auto &visual : visuals)
+    ids.push_back(visual->Id());
+
+  this->Measure("storage_visual_by_id", this->objectCount, [&]()
+  {
+    for (unsigned int id : ids)
+      this->sink += scene->VisualById(id) ? 1.0 : 0.0;
+  });
+  this->Measure("storage_has_visual_id", this->objectCount, [&]()
+  {
+    for (unsigned int id : ids)
+      this->sink += scene->HasVisualId(id) ? 1.0 : 0.0;
+  });
+  this->Measure("storage_visual_by_name", this->objectCount, [&]()
+  {
+    for (const auto &desc : descs)
+      this->sink += scene->VisualByName(desc.name) ? 1.0 : 0.0;
+  });
+  this->Measure("storage_visual_by_index", this->objectCount, [&]()
+  {
+    // visuals are iterated by index throughout PreRender
+    for (unsigned int i = 0; i < this->objectCount; ++i)
+      this->sink += scene->VisualByIndex(i) ? 1.0 : 0.0;
+  });
+  this->Measure("storage_root_child_by_index", this->objectCount, [&]()
+  {
+    VisualPtr root = scene->RootVisual();
+    for (unsigned int i = 0; i < root->ChildCount(); ++i)
+      this->sink += root->ChildByIndex(i) ? 1.0 : 0.0;
+  });
+  EXPECT_GT(this->sink, 0.0);
+
+  start = std::chrono::steady_clock::now();
+  scene->DestroyVisuals();
+  MicroBenchmarkResult destroy;
+  destroy.items = this->objectCount;
+  destroy.repetitions = 1u;
+  destroy.bestMs = ToMs(std::chrono::steady_clock::now() - start);
+  destroy.meanMs = destroy.bestMs;
+  destroy.nsPerItem = destroy.bestMs * 1e6 / this->objectCount;
+  this->Report("storage_destroy_visuals", destroy);
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+// Pixel format queries and the row conversions used by sensor readback
+TEST_F(CoreUtilitiesBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(PixelUtil))
+{
+  const unsigned int pixels = this->imageWidth * this->imageHeight;
+
+  this->Measure("pixel_util_memory_size", this->objectCount, [&]()
+  {
+    for (unsigned int i = 0; i < this->objectCount; ++i)
+    {
+      PixelFormat format = static_cast<PixelFormat>(i % PF_COUNT);
+      this->sink += PixelUtil::MemorySize(format, this->imageWidth,
+          this->imageHeight);
+      this->sink += PixelUtil::ChannelCount(format);
+    }
+  });
+
+  std::vector<uint8_t> rgba8(pixels * 4u, 128u);
+  std::vector<uint8_t> rgb8(pixels * 3u);
+  this->Measure("pixel_util_rgba8_to_rgb8", pixels, [&]()
+  {
+    for (unsigned int y = 0; y < this->imageHeight; ++y)
+    {
+      PixelUtil::PackRgba8ToRgb8(rgba8.data() + y * this->imageWidth * 4u,
+          rgb8.data() + y * this->imageWidth * 3u, this->imageWidth);
+    }
+    this->sink += rgb8.back();
+  });
+
+  std::vector<float> float4(pixels * 4u, 1.0f);
+  std::vector<float> float3(pixels * 3u);
+  std::vector<float> float1(pixels);
+  this->Measure("pixel_util_float4_to_float3", pixels, [&]()
+  {
+    for (unsigned int y = 0; y < this->imageHeight; ++y)
+    {
+      PixelUtil::PackFloat4ToFloat3(float4.data() + y * this->imageWidth * 4u,
+          float3.data() + y * this->imageWidth * 3u, this->imageWidth);
+    }
+    this->sink += float3.back();
+  });
+  this->Measure("pixel_util_float4_to_float1", pixels, [&]()
+  {
+    for (unsigned int y = 0; y < this->imageHeight; ++y)
+    {
+      PixelUtil::PackFloat4ToFloat1(float4.data() + y * this->imageWidth * 4u,
+          float1.data() + y * this->imageWidth, this->imageWidth);
+    }
+    this->sink += float1.back();
+  });
+
+  std::vector<uint16_t> l16(pixels);
+  this->Measure("pixel_util_l8_to_l16", pixels, [&]()
+  {
+    for (unsigned int y = 0; y < this->imageHeight; ++y)
+    {
+      PixelUtil::WidenL8ToL16(rgba8.data() + y * this->imageWidth,
+          l16.data() + y * this->imageWidth, this->imageWidth);
+    }
+    this->sink += l16.back();
+  });
+  EXPECT_GT(this->sink, 0.0);
+}
+
+/////////////////////////////////////////////////
+// Bayer conversion of camera images
+TEST_F(CoreUtilitiesBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(RgbToBayer))
+{
+  Image image(this->imageWidth, this->imageHeight, PF_R8G8B8);
+  unsigned char *data = image.Data<unsigned char>();
+  for (unsigned int i = 0; i < image.MemorySize(); ++i)
+    data[i] = static_cast<unsigned char>(i * 7u);
+
+  const unsigned int pixels = this->imageWidth * this->imageHeight;
+  const std::vector<std::pair<std::string, PixelFormat>> formats =
+  {
+    {"rggb8", PF_BAYER_RGGB8},
+    {"bggr8", PF_BAYER_BGGR8},
+    {"gbrg8", PF_BAYER_GBRG8},
+    {"grbg8", PF_BAYER_GRBG8}
+  };
+  for (const auto &[name, format] : formats)
+  {
+    this->Measure("convert_rgb_to_bayer_" + name, pixels, [&]()
+    {
+      Image bayer = convertRGBToBayer(image, format);
+      this->sink += bayer.Data<unsigned char>()[0] + 1.0;
+    });
+  }
+  EXPECT_GT(this->sink, 0.0);
+}
+
+/////////////////////////////////////////////////
+// Bounding box transforms, done for every visual by bounding box cameras
+TEST_F(CoreUtilitiesBenchmark,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(TransformAxisAlignedBox))
+{
+  std::vector<math::AxisAlignedBox> boxes;
+  std::vector<math::Pose3d> poses;
+  boxes.reserve(this->objectCount);
+  poses.reserve(this->objectCount);
+  for (unsigned int i = 0; i < this->objectCount; ++i)
+  {
+    double s = 0.1 + (i % 10) * 0.1;
+    boxes.emplace_back(math::Vector3d(-s, -s, -s), math::Vector3d(s, s, s));
+    poses.emplace_back(i * 0.01, (i % 100) * 0.1, 0.5,
+        0.1 * (i % 7), 0.2 * (i % 5), 0.3 * (i % 3));
+  }
+
+  this->Measure("transform_axis_aligned_box", this->objectCount, [&]()
+  {
+    for (unsigned int i = 0; i < this->objectCount; ++i)
+    {
+      math::AxisAlignedBox box = transformAxisAlignedBox(boxes[i], poses[i]);
+      this->sink += box.Max().Z();
+    }
+  });
+  EXPECT_GT(this->sink, 0.0);
+}
+
+/////////////////////////////////////////////////
+// Shader params: per frame updates by name and handle, and the iteration
+// render engines do to upload dirty params
+TEST_F(CoreUtilitiesBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(ShaderParams))
+{
+  // a heavily customized material, updated once per visual and frame
+  const unsigned int paramCount = 64u;
+  const unsigned int updates = std::max(this->objectCount / paramCount, 1u);
+
+  ShaderParams params;
+  std::vector<std::string> names;
+  std::vector<ShaderParams::Handle> handles;
+  for (unsigned int i = 0; i < paramCount; ++i)
+  {
+    names.push_back("param_" + std::to_string(i));
+    handles.push_back(params.Register(names.back(),
+        ShaderParam::PARAM_FLOAT));
+  }
+
+  this->Measure("shader_params_set_by_name", updates * paramCount, [&]()
+  {
+    for (unsigned int u = 0; u < updates; ++u)
+    {
+      for (unsigned int i = 0; i < paramCount; ++i)
+        params[names[i]] = static_cast<float>(u + i);
+    }
+  });
+  this->Measure("shader_params_set_by_handle", updates * paramCount, [&]()
+  {
+    for (unsigned int u = 0; u < updates; ++u)
+    {
+      for (unsigned int i = 0; i < paramCount; ++i)
+        params[handles[i]] = static_cast<float>(u + i);
+    }
+  });
+  this->Measure("shader_params_iterate", updates * paramCount, [&]()
+  {
+    for (unsigned int u = 0; u < updates; ++u)
+    {
+      for (const auto &[name, param] : params)
+      {
+        float value = 0.0f;
+        if (param.Value(&value))
+          this->sink += value;
+      }
+    }
+  });
+  params.ClearDirty();
+  EXPECT_GT(this->sink, 0.0);
+}
+
+/////////////////////////////////////////////////
+// Mouse picking against a grid of boxes, one position at a time and in a
+// single batch
+TEST_F(CoreUtilitiesBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(ScreenToScene))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  for (int x = -10; x <= 10; ++x)
+  {
+    for (int y = -10; y <= 10; ++y)
+    {
+      VisualPtr box = scene->CreateVisual();
+      box->AddGeometry(scene->CreateBox());
+      box->SetLocalPosition(x, y, 0.0);
+      box->SetLocalScale(0.5);
+      root->AddChild(box);
+    }
+  }
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetLocalPosition(0.0, 0.0, 20.0);
+  camera->SetLocalRotation(0.0, GZ_PI / 2, 0.0);
+  const unsigned int width = 640u;
+  const unsigned int height = 480u;
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  root->AddChild(camera);
+  camera->Update();
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+
+  // picking happens at interactive rates, so use fewer positions than
+  // objects in the other benchmarks
+  const unsigned int positionCount =
+      std::max(this->objectCount / 100u, 1u);
+  std::vector<math::Vector2i> positions;
+  positions.reserve(positionCount);
+  for (unsigned int i = 0; i < positionCount; ++i)
+  {
+    positions.emplace_back(static_cast<int>((i * 37u) % width),
+        static_cast<int>((i * 53u) % height));
+  }
+
+  this->Measure("screen_to_scene", positionCount, [&]()
+  {
+    for (const auto &position : positions)
+    {
+      math::Vector3d point = screenToScene(position, camera, rayQuery, 30.0f);
+      this->sink += point.Length();
+    }
+  });
+  this->Measure("screen_to_scene_batched", positionCount, [&]()
+  {
+    std::vector<math::Vector3d> points =
+        screenToScene(positions, camera, rayQuery, 30.0f);
+    for (const auto &point : points)
+      this->sink += point.Length();
+  });
+  EXPECT_GT(this->sink, 0.0);
+
+  engine->DestroyScene(scene);
+}
@@ -0,0 +1,497 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Sensor rendering benchmarks.
+//
+// Every test builds the same deterministic scene, renders it with a set of
+// sensors and reports frames per second, the average duration of each
+// update phase, the GPU flush time, the frame counters and the peak
+// resident memory of the process. Results are recorded as gtest properties
+// and, when GZ_RENDERING_BENCHMARK_OUTPUT is set, appended to that file as
+// one JSON object per line.
+//
+// The scene is parameterized with the following environment variables:
+//   GZ_RENDERING_BENCHMARK_VISUALS   Number of box visuals (default 200)
+//   GZ_RENDERING_BENCHMARK_LIGHTS    Number of lights (default 4)
+//   GZ_RENDERING_BENCHMARK_SENSORS   Number of sensors of each type
+//                                    (default 1)
+//   GZ_RENDERING_BENCHMARK_FRAMES    Number of timed frames (default 30)
+
+#ifndef _WIN32
+# include <sys/resource.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "CommonRenderingTest.hh"
+#include "PerfUtils.hh"
+
+#include "gz/rendering/BoundingBoxCamera.hh"
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/CameraLens.hh"
+#include "gz/rendering/DepthCamera.hh"
+#include "gz/rendering/GpuRays.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/ThermalCamera.hh"
+#include "gz/rendering/WideAngleCamera.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Sensor types to benchmark
+enum BenchmarkSensorType
+{
+  BST_CAMERA,
+  BST_DEPTH,
+  BST_GPU_RAYS,
+  BST_THERMAL,
+  BST_SEGMENTATION,
+  BST_BOUNDING_BOX,
+  BST_WIDE_ANGLE
+};
+
+/// \brief Benchmark results
+struct BenchmarkResult
+{
+  /// \brief Number of timed frames
+  unsigned int frames = 0u;
+
+  /// \brief Frames rendered per second of wall clock time
+  double fps = 0.0;
+
+  /// \brief Average PreRender time of all sensors per frame, in ms
+  double preRenderMs = 0.0;
+
+  /// \brief Average Render time of all sensors per frame, in ms
+  double renderMs = 0.0;
+
+  /// \brief Average PostRender time of all sensors per frame, in ms
+  double postRenderMs = 0.0;
+
+  /// \brief Average GPU flush time per frame, in ms
+  double flushMs = 0.0;
+
+  /// \brief Draw calls of the last frame
+  uint64_t drawCalls = 0u;
+
+  /// \brief Triangles of the last frame
+  uint64_t triangles = 0u;
+
+  /// \brief Peak resident memory of the process, in KiB
+  double peakMemoryKb = 0.0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Peak resident memory of the process
+/// \return Peak resident memory in KiB, 0 if not available
+static double PeakMemoryKb()
+{
+#ifdef __linux__
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return static_cast<double>(usage.ru_maxrss);
+#elif defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+  return 0.0;
+}
+
+/// \brief Renders a parameterized scene with different sensor sets
+class SensorRenderingBenchmark: public CommonRenderingTest
+{
+  /// \brief Build the benchmark scene: a grid of boxes around the origin,
+  /// a directional light and point lights on a ring above the boxes
+  /// \param[in] _scene Scene to populate
+  public: void BuildScene(ScenePtr _scene);
+
+  /// \brief Create a sensor of the given type looking at the boxes
+  /// \param[in] _scene Scene to create the sensor in
+  /// \param[in] _type Type of sensor
+  /// \param[in] _index Index of the sensor, used to spread sensors apart
+  /// \return The sensor
+  public: CameraPtr CreateSensor(ScenePtr _scene, BenchmarkSensorType _type,
+              unsigned int _index);
+
+  /// \brief Render the scene with sensors of the given types and report
+  /// the results
+  /// \param[in] _name Name of the benchmark
+  /// \param[in] _types Types of sensors to create
+  public: void Run(const std::string &_name,
+              const std::vector<BenchmarkSensorType> &_types);
+
+  /// \brief Report benchmark results
+  /// \param[in] _name Name of the benchmark
+  /// \param[in] _result Results
+  public: void Report(const std::string &_name,
+              const BenchmarkResult &_result);
+
+  /// \brief Connections to the sensor output, so every sensor reads its
+  /// data back
+  public: std::vector<common::ConnectionPtr> connections;
+};
+
+/////////////////////////////////////////////////
+void SensorRenderingBenchmark::BuildScene(ScenePtr _scene)
+{
+  const unsigned int visualCount =
+      EnvParam("GZ_RENDERING_BENCHMARK_VISUALS", 200u);
+  const unsigned int lightCount =
+      EnvParam("GZ_RENDERING_BENCHMARK_LIGHTS", 4u);
+
+  _scene->SetAmbientLight(0.3, 0.3, 0.3);
+  VisualPtr root = _scene->RootVisual();
+
+  MaterialPtr material = _scene->CreateMaterial();
+  material->SetDiffuse(0.7, 0.7, 0.7);
+
+  // square grid of boxes in front of the sensors
+  const unsigned int side = static_cast<unsigned int>(
+      std::ceil(std::sqrt(static_cast<double>(visualCount))));
+  for (unsigned int i = 0u; i < visualCount; ++i)
+  {
+    VisualPtr box = _scene->CreateVisual();
+    box->AddGeometry(_scene->CreateBox());
+    box->SetMaterial(material, false);
+    box->SetLocalScale(0.5, 0.5, 0.5 + 0.1 * (i % 5u));
+    box->SetLocalPosition(3.0 + static_cast<double>(i / side),
+        static_cast<double>(i % side) - 0.5 * side, 0.0);
+    box->SetUserData("label", static_cast<int>(i % 10u) + 1);
+    box->SetUserData("temperature", 300.0f + static_cast<float>(i % 50u));
+    root->AddChild(box);
+  }
+
+  for (unsigned int i = 0u; i < lightCount; ++i)
+  {
+    if (i == 0u)
+    {
+      DirectionalLightPtr light = _scene->CreateDirectionalLight();
+      light->SetDirection(0.5, 0.5, -1);
+      light->SetDiffuseColor(0.8, 0.8, 0.8);
+      root->AddChild(light);
+      continue;
+    }
+    const double angle = 2.0 * GZ_PI * i / lightCount;
+    PointLightPtr light = _scene->CreatePointLight();
+    light->SetLocalPosition(3.0 + 3.0 * std::cos(angle),
+        3.0 * std::sin(angle), 3.0);
+    light->SetDiffuseColor(0.5, 0.5, 0.5);
+    light->SetAttenuationRange(20);
+    root->AddChild(light);
+  }
+}
+
+/////////////////////////////////////////////////
+CameraPtr SensorRenderingBenchmark::CreateSensor(ScenePtr _scene,
+    BenchmarkSensorType _type, unsigned int _index)
+{
+  const unsigned int width = 320u;
+  const unsigned int height = 240u;
+  CameraPtr camera;
+  switch (_type)
+  {
+    case BST_CAMERA:
+    {
+      camera = _scene->CreateCamera();
+      camera->SetImageFormat(PF_R8G8B8);
+      this->connections.push_back(camera->ConnectNewImageFrame(
+          [](const void *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      break;
+    }
+    case BST_DEPTH:
+    {
+      DepthCameraPtr depth = _scene->CreateDepthCamera();
+      depth->SetImageFormat(PF_FLOAT32_R);
+      depth->SetNearClipPlane(0.1);
+      depth->SetFarClipPlane(50.0);
+      this->connections.push_back(depth->ConnectNewDepthFrame(
+          [](const float *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      this->connections.push_back(depth->ConnectNewRgbPointCloud(
+          [](const float *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      camera = depth;
+      break;
+    }
+    case BST_GPU_RAYS:
+    {
+      GpuRaysPtr rays = _scene->CreateGpuRays();
+      rays->SetNearClipPlane(0.1);
+      rays->SetFarClipPlane(50.0);
+      rays->SetAngleMin(-GZ_PI * 0.5);
+      rays->SetAngleMax(GZ_PI * 0.5);
+      rays->SetRayCount(640u);
+      rays->SetVerticalAngleMin(-0.26);
+      rays->SetVerticalAngleMax(0.26);
+      rays->SetVerticalRayCount(16u);
+      this->connections.push_back(rays->ConnectNewGpuRaysFrame(
+          [](const float *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      camera = rays;
+      break;
+    }
+    case BST_THERMAL:
+    {
+      ThermalCameraPtr thermal = _scene->CreateThermalCamera();
+      thermal->SetAmbientTemperature(296.0f);
+      thermal->SetNearClipPlane(0.1);
+      thermal->SetFarClipPlane(50.0);
+      this->connections.push_back(thermal->ConnectNewThermalFrame(
+          [](const uint16_t *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      camera = thermal;
+      break;
+    }
+    case BST_SEGMENTATION:
+    {
+      SegmentationCameraPtr segmentation =
+          _scene->CreateSegmentationCamera();
+      segmentation->SetSegmentationType(SegmentationType::ST_SEMANTIC);
+      segmentation->EnableColoredMap(false);
+      this->connections.push_back(segmentation->ConnectNewSegmentationFrame(
+          [](const uint8_t *, unsigned int, unsigned int, unsigned int,
+             const std::string &) {}));
+      camera = segmentation;
+      break;
+    }
+    case BST_BOUNDING_BOX:
+    {
+      BoundingBoxCameraPtr bbox = _scene->CreateBoundingBoxCamera();
+      bbox->SetBoundingBoxType(BoundingBoxType::BBT_VISIBLEBOX2D);
+      this->connections.push_back(bbox->ConnectNewBoundingBoxes(
+          [](const std::vector<BoundingBox> &) {}));
+      camera = bbox;
+      break;
+    }
+    case BST_WIDE_ANGLE:
+    {
+      WideAngleCameraPtr wide = _scene->CreateWideAngleCamera();
+      CameraLens lens;
+      lens.SetType(MFT_EQUIDISTANT);
+      lens.SetCutOffAngle(GZ_PI);
+      wide->SetLens(lens);
+      this->connections.push_back(wide->ConnectNewWideAngleFrame(
+          [](const unsigned char *, unsigned int, unsigned int,
+             unsigned int, const std::string &) {}));
+      camera = wide;
+      break;
+    }
+  }
+
+  if (!camera)
+    return camera;
+
+  if (_type != BST_GPU_RAYS)
+  {
+    camera->SetImageWidth(width);
+    camera->SetImageHeight(height);
+    camera->SetAspectRatio(static_cast<double>(width) / height);
+    camera->SetHFOV(_type == BST_WIDE_ANGLE ? GZ_PI : GZ_PI * 0.5);
+  }
+  camera->SetLocalPosition(0.0, 0.2 * _index, 1.0);
+  camera->SetLocalRotation(0.0, 0.2, 0.0);
+  _scene->RootVisual()->AddChild(camera);
+  return camera;
+}
+
+/////////////////////////////////////////////////
+void SensorRenderingBenchmark::Run(const std::string &_name,
+    const std::vector<BenchmarkSensorType> &_types)
+{
+  const unsigned int sensorsPerType =
+      EnvParam("GZ_RENDERING_BENCHMARK_SENSORS", 1u);
+  const unsigned int frames = EnvParam("GZ_RENDERING_BENCHMARK_FRAMES", 30u);
+  if (frames == 0u)
+    GTEST_SKIP() << "No frames to render";
+
+  ScenePtr scene = this->engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetCameraPassCountPerGpuFlush(6u);
+  this->BuildScene(scene);
+
+  std::vector<SensorPtr> sensors;
+  for (BenchmarkSensorType type : _types)
+  {
+    for (unsigned int i = 0u; i < sensorsPerType; ++i)
+    {
+      CameraPtr sensor = this->CreateSensor(scene, type, i);
+      ASSERT_NE(nullptr, sensor);
+      sensors.push_back(sensor);
+    }
+  }
+
+  // warm up so that texture creation and shader compilation are not timed
+  scene->WarmUpShaders();
+  scene->RenderSensors(sensors);
+  scene->ResetStats();
+
+  BenchmarkResult result;
+  result.frames = frames;
+  std::chrono::steady_clock::duration preRender{0};
+  std::chrono::steady_clock::duration render{0};
+  std::chrono::steady_clock::duration postRender{0};
+  std::chrono::steady_clock::duration flush{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0u; i < frames; ++i)
+  {
+    scene->RenderSensors(sensors);
+
+    const RenderStats stats = scene->Stats();
+    for (const auto &it : stats.sensors)
+    {
+      preRender += it.second.preRenderTime;
+      render += it.second.renderTime;
+      postRender += it.second.postRenderTime;
+    }
+    flush += stats.flushTime;
+    result.drawCalls = stats.drawCalls;
+    result.triangles = stats.triangles;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  const double elapsedMs = ToMs(elapsed);
+  result.fps = elapsedMs > 0.0 ? frames * 1000.0 / elapsedMs : 0.0;
+  result.preRenderMs = ToMs(preRender) / frames;
+  result.renderMs = ToMs(render) / frames;
+  result.postRenderMs = ToMs(postRender) / frames;
+  result.flushMs = ToMs(flush) / frames;
+  result.peakMemoryKb = PeakMemoryKb();
+
+  this->Report(_name, result);
+  EXPECT_GT(result.fps, 0.0);
+
+  // Clean up
+  this->connections.clear();
+  this->engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+void SensorRenderingBenchmark::Report(const std::string &_name,
+    const BenchmarkResult &_result)
+{
+  std::ostringstream json;
+  json << "{\"benchmark\": \"" << _name << "\""
+       << ", \"engine\": \"" << this->engineToTest << "\""
+       << ", \"visuals\": " << EnvParam("GZ_RENDERING_BENCHMARK_VISUALS", 200u)
+       << ", \"lights\": " << EnvParam("GZ_RENDERING_BENCHMARK_LIGHTS", 4u)
+       << ", \"sensors_per_type\": "
+       << EnvParam("GZ_RENDERING_BENCHMARK_SENSORS", 1u)
+       << ", \"frames\": " << _result.frames
+       << ", \"fps\": " << _result.fps
+       << ", \"pre_render_ms\": " << _result.preRenderMs
+       << ", \"render_ms\": " << _result.renderMs
+       << ", \"post_render_ms\": " << _result.postRenderMs
+       << ", \"flush_ms\": " << _result.flushMs
+       << ", \"draw_calls\": " << _result.drawCalls
+       << ", \"triangles\": " << _result.triangles
+       << ", \"peak_memory_kb\": " << _result.peakMemoryKb
+       << "}";
+
+  std::cout << json.str() << std::endl;
+
+  this->RecordProperty("fps", std::to_string(_result.fps));
+  this->RecordProperty("pre_render_ms", std::to_string(_result.preRenderMs));
+  this->RecordProperty("render_ms", std::to_string(_result.renderMs));
+  this->RecordProperty("post_render_ms",
+      std::to_string(_result.postRenderMs));
+  this->RecordProperty("flush_ms", std::to_string(_result.flushMs));
+  this->RecordProperty("peak_memory_kb",
+      std::to_string(_result.peakMemoryKb));
+
+  const char *output = std::getenv("GZ_RENDERING_BENCHMARK_OUTPUT");
+  if (output)
+  {
+    std::ofstream file(output, std::ios::app);
+    if (file)
+      file << json.str() << std::endl;
+    else
+      gzerr << "Unable to write benchmark results to " << output << std::endl;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(Camera))
+{
+  this->Run("camera", {BST_CAMERA});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(Depth))
+{
+  this->Run("depth", {BST_DEPTH});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(GpuRays))
+{
+  CHECK_UNSUPPORTED_ENGINE("optix");
+  this->Run("gpu_rays", {BST_GPU_RAYS});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(Thermal))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  this->Run("thermal", {BST_THERMAL});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(Segmentation))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  this->Run("segmentation", {BST_SEGMENTATION});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(BoundingBox))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  this->Run("bounding_box", {BST_BOUNDING_BOX});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(WideAngle))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  this->Run("wide_angle", {BST_WIDE_ANGLE});
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorRenderingBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(AllSensors))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+  this->Run("all_sensors", {BST_CAMERA, BST_DEPTH, BST_GPU_RAYS, BST_THERMAL,
+      BST_SEGMENTATION, BST_BOUNDING_BOX, BST_WIDE_ANGLE});
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// World load benchmark.
+//
+// Loads a world of distinct meshes and textured materials, renders the
+// first frame with a camera and reports the time spent in every phase
+// recorded by the load trace of the render engine, e.g. mesh conversion,
+// texture requests and the first frame, which includes compiling the
+// shaders of the world. Results are recorded as gtest properties and, when
+// GZ_RENDERING_BENCHMARK_OUTPUT is set, appended to that file as one JSON
+// object per line, in the same format as the sensor rendering benchmarks.
+// The trace is written to world_load_trace.json in the test temporary
+// directory, which can be opened with chrome://tracing or Perfetto.
+//
+// Engine startup phases are only recorded when GZ_RENDERING_LOAD_TRACE is
+// set to a file path before the test runs.
+//
+// The world is parameterized with the following environment variables:
+//   GZ_RENDERING_BENCHMARK_MESHES     Number of distinct meshes
+//                                     (default 100)
+//   GZ_RENDERING_BENCHMARK_MATERIALS  Number of textured materials
+//                                     (default 16)
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/MeshManager.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "CommonRenderingTest.hh"
+#include "PerfUtils.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/LoadTrace.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Times loading a world and rendering its first frame
+class WorldLoadBenchmark: public CommonRenderingTest
+{
+  /// \brief Report the time spent in every traced phase
+  /// \param[in] _name Name of the benchmark
+  /// \param[in] _totalMs Time from the start of the load to the end of the
+  /// first frame, in ms
+  public: void Report(const std::string &_name, double _totalMs);
+
+  /// \brief Number of distinct meshes
+  public: const unsigned int meshCount =
+      EnvParam("GZ_RENDERING_BENCHMARK_MESHES", 100u);
+
+  /// \brief Number of textured materials
+  public: const unsigned int materialCount =
+      EnvParam("GZ_RENDERING_BENCHMARK_MATERIALS", 16u);
+};
+
+/////////////////////////////////////////////////
+void WorldLoadBenchmark::Report(const std::string &_name, double _totalMs)
+{
+  const LoadTrace &trace = this->engine->Trace();
+
+  std::ostringstream json;
+  json << "{\"benchmark\": \"" << _name << "\""
+       << ", \"engine\": \"" << this->engineToTest << "\""
+       << ", \"meshes\": " << this->meshCount
+       << ", \"materials\": " << this->materialCount
+       << ", \"total_ms\": " << _totalMs
+       << ", \"phases_ms\": {";
+  bool first = true;
+  for (const auto &[name, duration] : trace.Totals())
+  {
+    json << (first ? "" : ", ") << "\"" << name << "\": " << ToMs(duration);
+    this->RecordProperty(name, std::to_string(ToMs(duration)));
+    first = false;
+  }
+  json << "}}";
+
+  std::cout << json.str() << std::endl;
+
+  this->RecordProperty("total_ms", std::to_string(_totalMs));
+
+  const char *output = std::getenv("GZ_RENDERING_BENCHMARK_OUTPUT");
+  if (output)
+  {
+    std::ofstream file(output, std::ios::app);
+    if (file)
+      file << json.str() << std::endl;
+    else
+      gzerr << "Unable to write benchmark results to " << output << std::endl;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(WorldLoadBenchmark, GZ_UTILS_TEST_DISABLED_ON_WIN32(WorldLoad))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  LoadTrace &trace = this->engine->Trace();
+  const bool traceStartup = trace.Enabled();
+  if (!traceStartup)
+    trace.SetEnabled(true);
+
+  const std::string textureDir = common::joinPaths(
+      std::string(PROJECT_SOURCE_PATH), "test", "media", "materials",
+      "textures");
+  const std::vector<std::string> textures = {
+      "blue_texture.png", "gray_texture.png", "red_texture.png",
+      "texture.png"};
+
+  const auto start = std::chrono::steady_clock::now();
+  ScenePtr scene = this->engine->CreateScene("world_load");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  std::vector<MaterialPtr> materials;
+  {
+    LoadTraceScope scope(trace, "WorldLoad::CreateMaterials", "benchmark");
+    for (unsigned int i = 0u; i < this->materialCount; ++i)
+    {
+      MaterialPtr material = scene->CreateMaterial();
+      material->SetDiffuse(0.7, 0.7, 0.7);
+      material->SetTexture(common::joinPaths(textureDir,
+          textures[i % textures.size()]));
+      materials.push_back(material);
+    }
+  }
+
+  // every mesh has its own name so that each one is converted
+  std::vector<MeshDescriptor> descriptors;
+  {
+    LoadTraceScope scope(trace, "WorldLoad::GenerateMeshes", "benchmark");
+    common::MeshManager *meshManager = common::MeshManager::Instance();
+    for (unsigned int i = 0u; i < this->meshCount; ++i)
+    {
+      std::string name = "world_load_sphere_" + std::to_string(i);
+      if (!meshManager->HasMesh(name))
+        meshManager->CreateSphere(name, 0.25f, 16 + i % 16u, 16 + i % 16u);
+      MeshDescriptor descriptor(meshManager->MeshByName(name));
+      descriptor.meshName = name;
+      descriptors.push_back(descriptor);
+    }
+  }
+
+  {
+    LoadTraceScope scope(trace, "WorldLoad::CreateVisuals", "benchmark");
+    scene->PreloadMeshes(descriptors);
+
+    const unsigned int side = static_cast<unsigned int>(
+        std::ceil(std::sqrt(static_cast<double>(this->meshCount))));
+    for (unsigned int i = 0u; i < this->meshCount; ++i)
+    {
+      VisualPtr visual = scene->CreateVisual();
+      visual->AddGeometry(scene->CreateMesh(descriptors[i]));
+      visual->SetMaterial(materials[i % materials.size()], false);
+      visual->SetLocalPosition(3.0 + static_cast<double>(i / side),
+          static_cast<double>(i % side) - 0.5 * side, 0.0);
+      root->AddChild(visual);
+    }
+  }
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(320u);
+  camera->SetImageHeight(240u);
+  camera->SetHFOV(GZ_PI / 2);
+  root->AddChild(camera);
+
+  {
+    LoadTraceScope scope(trace, "WorldLoad::FirstFrame", "benchmark");
+    camera->Update();
+  }
+  const double totalMs = ToMs(std::chrono::steady_clock::now() - start);
+
+  // meshes are converted at most once, even if several visuals use them
+  unsigned int meshLoads = 0u;
+  for (const auto &event : trace.Events())
+  {
+    if (event.name == "Ogre2MeshFactory::Load")
+      ++meshLoads;
+  }
+  EXPECT_LE(meshLoads, this->meshCount);
+
+  this->Report("world_load", totalMs);
+  EXPECT_TRUE(trace.WriteChromeTrace(
+      common::joinPaths(testing::TempDir(), "world_load_trace.json")));
+
+  // Clean up
+  this->engine->DestroyScene(scene);
+  if (!traceStartup)
+  {
+    trace.SetEnabled(false);
+    trace.Clear();
+  }
+}
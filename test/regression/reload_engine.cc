@@ -19,6 +19,7 @@
 
 #include "CommonRenderingTest.hh"
 
+#include <gz/rendering/RenderEngineManager.hh>
 #include <gz/rendering/Scene.hh>
 #include <gz/rendering/Visual.hh>
 #include <gz/rendering/BoundingBoxCamera.hh>
@@ -80,6 +81,45 @@ TEST_F(ReloadEngineTest, Empty)
   this->Run([](auto){});
 }
 
+/////////////////////////////////////////////////
+TEST_F(ReloadEngineTest, Recycle)
+{
+  auto manager = gz::rendering::RenderEngineManager::Instance();
+  EXPECT_FALSE(manager->RecycleEngines());
+  manager->SetRecycleEngines(true);
+  EXPECT_TRUE(manager->RecycleEngines());
+
+  gz::rendering::RenderEngine *first = nullptr;
+  for (size_t ii = 0; ii < kNumRetries; ++ii)
+  {
+    auto engine = gz::rendering::engine(this->engineToTest,
+                                        this->engineParams);
+    ASSERT_NE(nullptr, engine);
+    EXPECT_TRUE(gz::rendering::isEngineLoaded(this->engineToTest));
+
+    // the recycled engine is reused without its scenes
+    if (first)
+      EXPECT_EQ(first, engine);
+    first = engine;
+    EXPECT_EQ(0u, engine->SceneCount());
+    auto scene = engine->CreateScene("scene");
+    ASSERT_NE(nullptr, scene);
+
+    ASSERT_TRUE(gz::rendering::unloadEngine(this->engineToTest));
+    EXPECT_FALSE(gz::rendering::isEngineLoaded(this->engineToTest));
+    EXPECT_FALSE(gz::rendering::unloadEngine(this->engineToTest));
+  }
+
+  // disabling recycling destroys the recycled engine
+  manager->SetRecycleEngines(false);
+  EXPECT_FALSE(gz::rendering::isEngineLoaded(this->engineToTest));
+  auto engine = gz::rendering::engine(this->engineToTest,
+                                      this->engineParams);
+  ASSERT_NE(nullptr, engine);
+  EXPECT_EQ(0u, engine->SceneCount());
+  EXPECT_TRUE(gz::rendering::unloadEngine(this->engineToTest));
+}
+
 /////////////////////////////////////////////////
 TEST_F(ReloadEngineTest, Scene)
 {